@@ -0,0 +1,398 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require math_boost
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require math_bits
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3917501635009707288 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace math_boost { struct AABR; };
+namespace math_boost { struct AABB; };
+namespace math_boost { struct Ray; };
+namespace math_boost {
+
+struct AABR {
+	float2 min;
+	float2 max;
+};
+static_assert(sizeof(AABR)==16,"structure size mismatch with DAS");
+static_assert(offsetof(AABR,min)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AABR,max)==8,"structure field offset mismatch with DAS");
+}
+namespace math_boost {
+
+struct AABB {
+	float3 min;
+	float3 max;
+};
+static_assert(sizeof(AABB)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AABB,min)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AABB,max)==12,"structure field offset mismatch with DAS");
+}
+namespace math_boost {
+
+struct Ray {
+	float3 dir;
+	float3 origin;
+};
+static_assert(sizeof(Ray)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Ray,dir)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Ray,origin)==12,"structure field offset mismatch with DAS");
+}
+
+inline float degrees_a661e6cfff0d8952 ( Context * __context__, float __f_rename_at_26 );
+inline float radians_aa78c69bde52354a ( Context * __context__, float __f_rename_at_30 );
+inline uint32_t RGBA_TO_UCOLOR_f52d3d498ec28ea4 ( Context * __context__, float __x_rename_at_34, float __y_rename_at_34, float __z_rename_at_34, float __w_rename_at_34 );
+inline uint32_t RGBA_TO_UCOLOR_fb5992436af224c9 ( Context * __context__, float4 __xyzw_rename_at_38 );
+inline float4 UCOLOR_TO_RGBA_df3b1693521d201f ( Context * __context__, uint32_t __x_rename_at_41 );
+inline float3 UCOLOR_TO_RGB_1557f9cd645f174a ( Context * __context__, uint32_t __x_rename_at_49 );
+inline float linear_to_SRGB_eedb6de51617a75 ( Context * __context__, float __x_rename_at_56 );
+inline float3 linear_to_SRGB_5492768924fd03c3 ( Context * __context__, float3 __c_rename_at_63 );
+inline float4 linear_to_SRGB_30ee3e123c55a357 ( Context * __context__, float4 __c_rename_at_66 );
+inline bool is_intersecting_89abf343fe43c15 ( Context * __context__, math_boost::AABR const  & __a_rename_at_69, math_boost::AABR const  & __b_rename_at_69 );
+inline bool is_intersecting_a323d15c58889625 ( Context * __context__, math_boost::AABB const  & __a_rename_at_74, math_boost::AABB const  & __b_rename_at_74 );
+inline bool is_intersecting_83c244c5cad1eaf9 ( Context * __context__, math_boost::Ray const  & __ray_rename_at_78, math_boost::AABB const  & __aabb_rename_at_78, float __Tmin_rename_at_78, float __Tmax_rename_at_78 );
+inline float4x4 look_at_lh_12ae4d22ab712b1 ( Context * __context__, float3 __Eye_rename_at_88, float3 __At_rename_at_88, float3 __Up_rename_at_88 );
+inline float4x4 look_at_rh_57fabbbe8b8576f7 ( Context * __context__, float3 __Eye_rename_at_102, float3 __At_rename_at_102, float3 __Up_rename_at_102 );
+inline float4x4 perspective_lh_2fac1cd2df0ab7fe ( Context * __context__, float __fovy_rename_at_116, float __aspect_rename_at_116, float __zn_rename_at_116, float __zf_rename_at_116 );
+inline float4x4 perspective_rh_5d20db61257b5b19 ( Context * __context__, float __fovy_rename_at_129, float __aspect_rename_at_129, float __zn_rename_at_129, float __zf_rename_at_129 );
+inline float4x4 perspective_rh_opengl_fcf6139ab08387ca ( Context * __context__, float __fovy_rename_at_142, float __aspect_rename_at_142, float __zn_rename_at_142, float __zf_rename_at_142 );
+inline float4x4 ortho_rh_f6bc4f195f22d8d5 ( Context * __context__, float __left_rename_at_155, float __right_rename_at_155, float __bottom_rename_at_155, float __top_rename_at_155, float __zNear_rename_at_155, float __zFar_rename_at_155 );
+inline float plane_dot_cf6fadebd33ebe09 ( Context * __context__, float4 __Plane_rename_at_167, float4 __Vec_rename_at_167 );
+inline float4 plane_normalize_bcd7d36c68415690 ( Context * __context__, float4 __Plane_rename_at_171 );
+inline float4 plane_from_point_normal_110b03e9793d1239 ( Context * __context__, float3 __p_rename_at_176, float3 __n_rename_at_176 );
+inline float4x4 planar_shadow_304637f7a6dac3fe ( Context * __context__, float4 __Light_rename_at_180, float4 __Plane_rename_at_180 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline float degrees_a661e6cfff0d8952 ( Context * __context__, float __f_rename_at_26 )
+{
+	return das_auto_cast<float>::cast(SimPolicy<float>::Div((__f_rename_at_26 * 180.f),3.14159274f,*__context__,nullptr));
+}
+
+inline float radians_aa78c69bde52354a ( Context * __context__, float __f_rename_at_30 )
+{
+	return das_auto_cast<float>::cast(SimPolicy<float>::Div((__f_rename_at_30 * 3.14159274f),180.f,*__context__,nullptr));
+}
+
+inline uint32_t RGBA_TO_UCOLOR_f52d3d498ec28ea4 ( Context * __context__, float __x_rename_at_34, float __y_rename_at_34, float __z_rename_at_34, float __w_rename_at_34 )
+{
+	return das_auto_cast<uint32_t>::cast(pack_float_to_byte(SimPolicy<float4>::MulVecScal(float4(__x_rename_at_34,__y_rename_at_34,__z_rename_at_34,__w_rename_at_34),cast<float>::from(255.f),*__context__,nullptr)));
+}
+
+inline uint32_t RGBA_TO_UCOLOR_fb5992436af224c9 ( Context * __context__, float4 __xyzw_rename_at_38 )
+{
+	return das_auto_cast<uint32_t>::cast(pack_float_to_byte(SimPolicy<float4>::MulVecScal(__xyzw_rename_at_38,cast<float>::from(255.f),*__context__,nullptr)));
+}
+
+inline float4 UCOLOR_TO_RGBA_df3b1693521d201f ( Context * __context__, uint32_t __x_rename_at_41 )
+{
+	return das_auto_cast<float4>::cast(float4(SimPolicy<float>::Div(float((__x_rename_at_41 >> 0x10u) & 0xffu),255.f,*__context__,nullptr),SimPolicy<float>::Div(float((__x_rename_at_41 >> 0x8u) & 0xffu),255.f,*__context__,nullptr),SimPolicy<float>::Div(float((__x_rename_at_41 >> 0x0u) & 0xffu),255.f,*__context__,nullptr),SimPolicy<float>::Div(float((__x_rename_at_41 >> 0x18u) & 0xffu),255.f,*__context__,nullptr)));
+}
+
+inline float3 UCOLOR_TO_RGB_1557f9cd645f174a ( Context * __context__, uint32_t __x_rename_at_49 )
+{
+	return das_auto_cast<float3>::cast(float3(SimPolicy<float>::Div(float((__x_rename_at_49 >> 0x10u) & 0xffu),255.f,*__context__,nullptr),SimPolicy<float>::Div(float((__x_rename_at_49 >> 0x8u) & 0xffu),255.f,*__context__,nullptr),SimPolicy<float>::Div(float((__x_rename_at_49 >> 0x0u) & 0xffu),255.f,*__context__,nullptr)));
+}
+
+inline float linear_to_SRGB_eedb6de51617a75 ( Context * __context__, float __x_rename_at_56 )
+{
+	return das_auto_cast<float>::cast((__x_rename_at_56 <= 0.000313080003f) ? das_auto_cast<float>::cast((__x_rename_at_56 * 12.9200001f)) : das_auto_cast<float>::cast(((SimPolicy<float>::Pow(__x_rename_at_56,0.416666657f,*__context__,nullptr) * 1.05499995f) - 0.0549999997f)));
+}
+
+inline float3 linear_to_SRGB_5492768924fd03c3 ( Context * __context__, float3 __c_rename_at_63 )
+{
+	return das_auto_cast<float3>::cast(float3(linear_to_SRGB_eedb6de51617a75(__context__,v_extract_x(__c_rename_at_63) /*x*/),linear_to_SRGB_eedb6de51617a75(__context__,v_extract_y(__c_rename_at_63) /*y*/),linear_to_SRGB_eedb6de51617a75(__context__,v_extract_z(__c_rename_at_63) /*z*/)));
+}
+
+inline float4 linear_to_SRGB_30ee3e123c55a357 ( Context * __context__, float4 __c_rename_at_66 )
+{
+	return das_auto_cast<float4>::cast(float4(linear_to_SRGB_eedb6de51617a75(__context__,v_extract_x(__c_rename_at_66) /*x*/),linear_to_SRGB_eedb6de51617a75(__context__,v_extract_y(__c_rename_at_66) /*y*/),linear_to_SRGB_eedb6de51617a75(__context__,v_extract_z(__c_rename_at_66) /*z*/),v_extract_w(__c_rename_at_66) /*w*/));
+}
+
+inline bool is_intersecting_89abf343fe43c15 ( Context * __context__, math_boost::AABR const  &  __a_rename_at_69, math_boost::AABR const  &  __b_rename_at_69 )
+{
+	return das_auto_cast<bool>::cast((((v_extract_x(__a_rename_at_69.min) /*x*/ <= v_extract_x(__b_rename_at_69.max) /*x*/) && (v_extract_y(__a_rename_at_69.min) /*y*/ <= v_extract_y(__b_rename_at_69.max) /*y*/)) && (v_extract_x(__a_rename_at_69.max) /*x*/ >= v_extract_x(__b_rename_at_69.min) /*x*/)) && (v_extract_y(__a_rename_at_69.max) /*y*/ >= v_extract_y(__b_rename_at_69.min) /*y*/));
+}
+
+inline bool is_intersecting_a323d15c58889625 ( Context * __context__, math_boost::AABB const  &  __a_rename_at_74, math_boost::AABB const  &  __b_rename_at_74 )
+{
+	return das_auto_cast<bool>::cast((((((v_extract_x(__a_rename_at_74.min) /*x*/ <= v_extract_x(__b_rename_at_74.max) /*x*/) && (v_extract_y(__a_rename_at_74.min) /*y*/ <= v_extract_y(__b_rename_at_74.max) /*y*/)) && (v_extract_z(__a_rename_at_74.min) /*z*/ <= v_extract_z(__b_rename_at_74.max) /*z*/)) && (v_extract_x(__a_rename_at_74.max) /*x*/ >= v_extract_x(__b_rename_at_74.min) /*x*/)) && (v_extract_y(__a_rename_at_74.max) /*y*/ >= v_extract_y(__b_rename_at_74.min) /*y*/)) && (v_extract_z(__a_rename_at_74.max) /*z*/ >= v_extract_z(__b_rename_at_74.min) /*z*/));
+}
+
+inline bool is_intersecting_83c244c5cad1eaf9 ( Context * __context__, math_boost::Ray const  &  __ray_rename_at_78, math_boost::AABB const  &  __aabb_rename_at_78, float __Tmin_rename_at_78, float __Tmax_rename_at_78 )
+{
+	float3 __invD_rename_at_79 = ((float3)SimPolicy<float3>::Rcp(__ray_rename_at_78.dir,*__context__,nullptr));
+	float3 __t0s_rename_at_80 = ((float3)(SimPolicy<float3>::Mul((SimPolicy<float3>::Sub(__aabb_rename_at_78.min,__ray_rename_at_78.origin,*__context__,nullptr)),__invD_rename_at_79,*__context__,nullptr)));
+	float3 __t1s_rename_at_81 = ((float3)(SimPolicy<float3>::Mul((SimPolicy<float3>::Sub(__aabb_rename_at_78.max,__ray_rename_at_78.origin,*__context__,nullptr)),__invD_rename_at_79,*__context__,nullptr)));
+	float3 __tsmaller_rename_at_82 = ((float3)SimPolicy<float3>::Min(__t0s_rename_at_80,__t1s_rename_at_81,*__context__,nullptr));
+	float3 __tbigger_rename_at_83 = ((float3)SimPolicy<float3>::Max(__t0s_rename_at_80,__t1s_rename_at_81,*__context__,nullptr));
+	float __tmin_rename_at_84 = ((float)SimPolicy<float>::Max(__Tmin_rename_at_78,SimPolicy<float>::Max(das_index<float3 const >::at(__tsmaller_rename_at_82,0,__context__),SimPolicy<float>::Max(das_index<float3 const >::at(__tsmaller_rename_at_82,1,__context__),das_index<float3 const >::at(__tsmaller_rename_at_82,2,__context__),*__context__,nullptr),*__context__,nullptr),*__context__,nullptr));
+	float __tmax_rename_at_85 = ((float)SimPolicy<float>::Min(__Tmax_rename_at_78,SimPolicy<float>::Min(das_index<float3 const >::at(__tbigger_rename_at_83,0,__context__),SimPolicy<float>::Min(das_index<float3 const >::at(__tbigger_rename_at_83,1,__context__),das_index<float3 const >::at(__tbigger_rename_at_83,2,__context__),*__context__,nullptr),*__context__,nullptr),*__context__,nullptr));
+	return das_auto_cast<bool>::cast(__tmin_rename_at_84 < __tmax_rename_at_85);
+}
+
+inline float4x4 look_at_lh_12ae4d22ab712b1 ( Context * __context__, float3 __Eye_rename_at_88, float3 __At_rename_at_88, float3 __Up_rename_at_88 )
+{
+	float3 __zaxis_rename_at_90 = ((float3)safe_normalize3(SimPolicy<float3>::Sub(__At_rename_at_88,__Eye_rename_at_88,*__context__,nullptr)));
+	float3 __xaxis_rename_at_91 = ((float3)safe_normalize3(cross3(__Up_rename_at_88,__zaxis_rename_at_90)));
+	float3 __yaxis_rename_at_92 = ((float3)cross3(__zaxis_rename_at_90,__xaxis_rename_at_91));
+	float4x4 __tm_rename_at_93; das_zero(__tm_rename_at_93);
+	das_copy(das_index<float4x4>::at(__tm_rename_at_93,0,__context__),float4(v_extract_x(__xaxis_rename_at_91) /*x*/,v_extract_x(__yaxis_rename_at_92) /*x*/,v_extract_x(__zaxis_rename_at_90) /*x*/,0.f));
+	das_copy(das_index<float4x4>::at(__tm_rename_at_93,1,__context__),float4(v_extract_y(__xaxis_rename_at_91) /*y*/,v_extract_y(__yaxis_rename_at_92) /*y*/,v_extract_y(__zaxis_rename_at_90) /*y*/,0.f));
+	das_copy(das_index<float4x4>::at(__tm_rename_at_93,2,__context__),float4(v_extract_z(__xaxis_rename_at_91) /*z*/,v_extract_z(__yaxis_rename_at_92) /*z*/,v_extract_z(__zaxis_rename_at_90) /*z*/,0.f));
+	das_copy(das_index<float4x4>::at(__tm_rename_at_93,3,__context__),float4(-dot3(__xaxis_rename_at_91,__Eye_rename_at_88),-dot3(__yaxis_rename_at_92,__Eye_rename_at_88),-dot3(__zaxis_rename_at_90,__Eye_rename_at_88),1.f));
+	return das_auto_cast_ref<float4x4>::cast(__tm_rename_at_93);
+}
+
+inline float4x4 look_at_rh_57fabbbe8b8576f7 ( Context * __context__, float3 __Eye_rename_at_102, float3 __At_rename_at_102, float3 __Up_rename_at_102 )
+{
+	float3 __zaxis_rename_at_104 = ((float3)safe_normalize3(SimPolicy<float3>::Sub(__Eye_rename_at_102,__At_rename_at_102,*__context__,nullptr)));
+	float3 __xaxis_rename_at_105 = ((float3)safe_normalize3(cross3(__Up_rename_at_102,__zaxis_rename_at_104)));
+	float3 __yaxis_rename_at_106 = ((float3)cross3(__zaxis_rename_at_104,__xaxis_rename_at_105));
+	float4x4 __tm_rename_at_107; das_zero(__tm_rename_at_107);
+	das_copy(das_index<float4x4>::at(__tm_rename_at_107,0,__context__),float4(v_extract_x(__xaxis_rename_at_105) /*x*/,v_extract_x(__yaxis_rename_at_106) /*x*/,v_extract_x(__zaxis_rename_at_104) /*x*/,0.f));
+	das_copy(das_index<float4x4>::at(__tm_rename_at_107,1,__context__),float4(v_extract_y(__xaxis_rename_at_105) /*y*/,v_extract_y(__yaxis_rename_at_106) /*y*/,v_extract_y(__zaxis_rename_at_104) /*y*/,0.f));
+	das_copy(das_index<float4x4>::at(__tm_rename_at_107,2,__context__),float4(v_extract_z(__xaxis_rename_at_105) /*z*/,v_extract_z(__yaxis_rename_at_106) /*z*/,v_extract_z(__zaxis_rename_at_104) /*z*/,0.f));
+	das_copy(das_index<float4x4>::at(__tm_rename_at_107,3,__context__),float4(-dot3(__xaxis_rename_at_105,__Eye_rename_at_102),-dot3(__yaxis_rename_at_106,__Eye_rename_at_102),-dot3(__zaxis_rename_at_104,__Eye_rename_at_102),1.f));
+	return das_auto_cast_ref<float4x4>::cast(__tm_rename_at_107);
+}
+
+inline float4x4 perspective_lh_2fac1cd2df0ab7fe ( Context * __context__, float __fovy_rename_at_116, float __aspect_rename_at_116, float __zn_rename_at_116, float __zf_rename_at_116 )
+{
+	float __yScale_rename_at_118 = ((float)(SimPolicy<float>::Div(1.f,SimPolicy<float>::Tan(SimPolicy<float>::Div(__fovy_rename_at_116,2.f,*__context__,nullptr),*__context__,nullptr),*__context__,nullptr)));
+	float __xScale_rename_at_119 = ((float)(SimPolicy<float>::Div(__yScale_rename_at_118,__aspect_rename_at_116,*__context__,nullptr)));
+	float4x4 __Result_rename_at_120; das_zero(__Result_rename_at_120);
+	float4x4_identity(das_arg<float4x4>::pass(__Result_rename_at_120));
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_120,0,__context__),0,__context__),__xScale_rename_at_119);
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_120,1,__context__),1,__context__),__yScale_rename_at_118);
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_120,2,__context__),2,__context__),SimPolicy<float>::Div(__zf_rename_at_116,(__zf_rename_at_116 - __zn_rename_at_116),*__context__,nullptr));
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_120,2,__context__),3,__context__),-1.f);
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_120,3,__context__),2,__context__),SimPolicy<float>::Div((-__zn_rename_at_116 * __zf_rename_at_116),(__zn_rename_at_116 - __zf_rename_at_116),*__context__,nullptr));
+	return das_auto_cast_ref<float4x4>::cast(__Result_rename_at_120);
+}
+
+inline float4x4 perspective_rh_5d20db61257b5b19 ( Context * __context__, float __fovy_rename_at_129, float __aspect_rename_at_129, float __zn_rename_at_129, float __zf_rename_at_129 )
+{
+	float __yScale_rename_at_131 = ((float)(SimPolicy<float>::Div(1.f,SimPolicy<float>::Tan(SimPolicy<float>::Div(__fovy_rename_at_129,2.f,*__context__,nullptr),*__context__,nullptr),*__context__,nullptr)));
+	float __xScale_rename_at_132 = ((float)(SimPolicy<float>::Div(__yScale_rename_at_131,__aspect_rename_at_129,*__context__,nullptr)));
+	float4x4 __Result_rename_at_133; das_zero(__Result_rename_at_133);
+	float4x4_identity(das_arg<float4x4>::pass(__Result_rename_at_133));
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_133,0,__context__),0,__context__),__xScale_rename_at_132);
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_133,1,__context__),1,__context__),__yScale_rename_at_131);
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_133,2,__context__),2,__context__),SimPolicy<float>::Div(__zf_rename_at_129,(__zn_rename_at_129 - __zf_rename_at_129),*__context__,nullptr));
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_133,2,__context__),3,__context__),-1.f);
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_133,3,__context__),2,__context__),SimPolicy<float>::Div((__zn_rename_at_129 * __zf_rename_at_129),(__zn_rename_at_129 - __zf_rename_at_129),*__context__,nullptr));
+	return das_auto_cast_ref<float4x4>::cast(__Result_rename_at_133);
+}
+
+inline float4x4 perspective_rh_opengl_fcf6139ab08387ca ( Context * __context__, float __fovy_rename_at_142, float __aspect_rename_at_142, float __zn_rename_at_142, float __zf_rename_at_142 )
+{
+	float __yScale_rename_at_144 = ((float)(SimPolicy<float>::Div(1.f,SimPolicy<float>::Tan(SimPolicy<float>::Div(__fovy_rename_at_142,2.f,*__context__,nullptr),*__context__,nullptr),*__context__,nullptr)));
+	float __xScale_rename_at_145 = ((float)(SimPolicy<float>::Div(__yScale_rename_at_144,__aspect_rename_at_142,*__context__,nullptr)));
+	float4x4 __Result_rename_at_146; das_zero(__Result_rename_at_146);
+	float4x4_identity(das_arg<float4x4>::pass(__Result_rename_at_146));
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_146,0,__context__),0,__context__),__xScale_rename_at_145);
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_146,1,__context__),1,__context__),__yScale_rename_at_144);
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_146,2,__context__),2,__context__),SimPolicy<float>::Div((__zf_rename_at_142 + __zn_rename_at_142),(__zn_rename_at_142 - __zf_rename_at_142),*__context__,nullptr));
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_146,2,__context__),3,__context__),-1.f);
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_146,3,__context__),2,__context__),SimPolicy<float>::Div(((__zn_rename_at_142 * 2.f) * __zf_rename_at_142),(__zn_rename_at_142 - __zf_rename_at_142),*__context__,nullptr));
+	return das_auto_cast_ref<float4x4>::cast(__Result_rename_at_146);
+}
+
+inline float4x4 ortho_rh_f6bc4f195f22d8d5 ( Context * __context__, float __left_rename_at_155, float __right_rename_at_155, float __bottom_rename_at_155, float __top_rename_at_155, float __zNear_rename_at_155, float __zFar_rename_at_155 )
+{
+	float4x4 __Result_rename_at_157; das_zero(__Result_rename_at_157);
+	float4x4_identity(das_arg<float4x4>::pass(__Result_rename_at_157));
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_157,0,__context__),0,__context__),SimPolicy<float>::Div(2.f,(__right_rename_at_155 - __left_rename_at_155),*__context__,nullptr));
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_157,1,__context__),1,__context__),SimPolicy<float>::Div(2.f,(__top_rename_at_155 - __bottom_rename_at_155),*__context__,nullptr));
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_157,2,__context__),2,__context__),SimPolicy<float>::Div(-2.f,(__zFar_rename_at_155 - __zNear_rename_at_155),*__context__,nullptr));
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_157,3,__context__),0,__context__),SimPolicy<float>::Div(-((__right_rename_at_155 + __left_rename_at_155)),(__right_rename_at_155 - __left_rename_at_155),*__context__,nullptr));
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_157,3,__context__),1,__context__),SimPolicy<float>::Div(-((__top_rename_at_155 + __bottom_rename_at_155)),(__top_rename_at_155 - __bottom_rename_at_155),*__context__,nullptr));
+	das_copy(das_index<float4>::at(das_index<float4x4>::at(__Result_rename_at_157,3,__context__),2,__context__),SimPolicy<float>::Div(-((__zFar_rename_at_155 + __zNear_rename_at_155)),(__zFar_rename_at_155 - __zNear_rename_at_155),*__context__,nullptr));
+	return das_auto_cast_ref<float4x4>::cast(__Result_rename_at_157);
+}
+
+inline float plane_dot_cf6fadebd33ebe09 ( Context * __context__, float4 __Plane_rename_at_167, float4 __Vec_rename_at_167 )
+{
+	return das_auto_cast<float>::cast(dot4(__Plane_rename_at_167,__Vec_rename_at_167));
+}
+
+inline float4 plane_normalize_bcd7d36c68415690 ( Context * __context__, float4 __Plane_rename_at_171 )
+{
+	float __len_rename_at_173 = ((float)length3(das_swizzle_seq<float3,float4 const ,0>::swizzle(__Plane_rename_at_171) /*xyz*/));
+	return das_auto_cast<float4>::cast((__len_rename_at_173 != 0.f) ? (vec4f)das_auto_cast<float4>::cast((SimPolicy<float4>::DivVecScal(__Plane_rename_at_171,cast<float>::from(__len_rename_at_173),*__context__,nullptr))) : (vec4f)das_auto_cast<float4>::cast(v_zero()));
+}
+
+inline float4 plane_from_point_normal_110b03e9793d1239 ( Context * __context__, float3 __p_rename_at_176, float3 __n_rename_at_176 )
+{
+	return das_auto_cast<float4>::cast(float4(v_extract_x(__n_rename_at_176) /*x*/,v_extract_y(__n_rename_at_176) /*y*/,v_extract_z(__n_rename_at_176) /*z*/,-dot3(__p_rename_at_176,__n_rename_at_176)));
+}
+
+inline float4x4 planar_shadow_304637f7a6dac3fe ( Context * __context__, float4 __Light_rename_at_180, float4 __Plane_rename_at_180 )
+{
+	float4 __P_rename_at_182 = ((float4)plane_normalize_bcd7d36c68415690(__context__,__Plane_rename_at_180));
+	float4 __L_rename_at_183 = ((float4)__Light_rename_at_180);
+	float __d_rename_at_184 = ((float)-(dot4(__P_rename_at_182,__L_rename_at_183)));
+	float4x4 __Result_rename_at_185; das_zero(__Result_rename_at_185);
+	das_copy(das_index<float4x4>::at(__Result_rename_at_185,0,__context__),float4((v_extract_x(__P_rename_at_182) /*x*/ * v_extract_x(__L_rename_at_183) /*x*/) + __d_rename_at_184,v_extract_x(__P_rename_at_182) /*x*/ * v_extract_y(__L_rename_at_183) /*y*/,v_extract_x(__P_rename_at_182) /*x*/ * v_extract_z(__L_rename_at_183) /*z*/,v_extract_x(__P_rename_at_182) /*x*/ * v_extract_w(__L_rename_at_183) /*w*/));
+	das_copy(das_index<float4x4>::at(__Result_rename_at_185,1,__context__),float4(v_extract_y(__P_rename_at_182) /*y*/ * v_extract_x(__L_rename_at_183) /*x*/,(v_extract_y(__P_rename_at_182) /*y*/ * v_extract_y(__L_rename_at_183) /*y*/) + __d_rename_at_184,v_extract_y(__P_rename_at_182) /*y*/ * v_extract_z(__L_rename_at_183) /*z*/,v_extract_y(__P_rename_at_182) /*y*/ * v_extract_w(__L_rename_at_183) /*w*/));
+	das_copy(das_index<float4x4>::at(__Result_rename_at_185,2,__context__),float4(v_extract_z(__P_rename_at_182) /*z*/ * v_extract_x(__L_rename_at_183) /*x*/,v_extract_z(__P_rename_at_182) /*z*/ * v_extract_y(__L_rename_at_183) /*y*/,(v_extract_z(__P_rename_at_182) /*z*/ * v_extract_z(__L_rename_at_183) /*z*/) + __d_rename_at_184,v_extract_z(__P_rename_at_182) /*z*/ * v_extract_w(__L_rename_at_183) /*w*/));
+	das_copy(das_index<float4x4>::at(__Result_rename_at_185,3,__context__),float4(v_extract_w(__P_rename_at_182) /*w*/ * v_extract_x(__L_rename_at_183) /*x*/,v_extract_w(__P_rename_at_182) /*w*/ * v_extract_y(__L_rename_at_183) /*y*/,v_extract_w(__P_rename_at_182) /*w*/ * v_extract_z(__L_rename_at_183) /*z*/,(v_extract_w(__P_rename_at_182) /*w*/ * v_extract_w(__L_rename_at_183) /*w*/) + __d_rename_at_184));
+	return das_auto_cast_ref<float4x4>::cast(__Result_rename_at_185);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// degrees_a661e6cfff0d8952
+	aotLib[0xf1a5775e08f61aa1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, float  ),&degrees_a661e6cfff0d8952>>();
+	};
+	// radians_aa78c69bde52354a
+	aotLib[0x513615c5c18883d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, float  ),&radians_aa78c69bde52354a>>();
+	};
+	// RGBA_TO_UCOLOR_f52d3d498ec28ea4
+	aotLib[0x459c0322bf626c2d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__, float , float , float , float  ),&RGBA_TO_UCOLOR_f52d3d498ec28ea4>>();
+	};
+	// RGBA_TO_UCOLOR_fb5992436af224c9
+	aotLib[0xd5f066b52247c695] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__, float4  ),&RGBA_TO_UCOLOR_fb5992436af224c9>>();
+	};
+	// UCOLOR_TO_RGBA_df3b1693521d201f
+	aotLib[0xe94d31deb68f3ad1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float4 (*) ( Context * __context__, uint32_t  ),&UCOLOR_TO_RGBA_df3b1693521d201f>>();
+	};
+	// UCOLOR_TO_RGB_1557f9cd645f174a
+	aotLib[0xf566c20f92724669] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, uint32_t  ),&UCOLOR_TO_RGB_1557f9cd645f174a>>();
+	};
+	// linear_to_SRGB_eedb6de51617a75
+	aotLib[0xb51f1654a6108b89] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, float  ),&linear_to_SRGB_eedb6de51617a75>>();
+	};
+	// linear_to_SRGB_5492768924fd03c3
+	aotLib[0x30da2dddfc8a8c7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, float3  ),&linear_to_SRGB_5492768924fd03c3>>();
+	};
+	// linear_to_SRGB_30ee3e123c55a357
+	aotLib[0x3a7101dcd73eeeab] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float4 (*) ( Context * __context__, float4  ),&linear_to_SRGB_30ee3e123c55a357>>();
+	};
+	// is_intersecting_89abf343fe43c15
+	aotLib[0x8d082194aae48cfd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, math_boost::AABR const  & , math_boost::AABR const  &  ),&is_intersecting_89abf343fe43c15>>();
+	};
+	// is_intersecting_a323d15c58889625
+	aotLib[0x3b63e1df016f4b2d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, math_boost::AABB const  & , math_boost::AABB const  &  ),&is_intersecting_a323d15c58889625>>();
+	};
+	// is_intersecting_83c244c5cad1eaf9
+	aotLib[0xfdf8f8a7965f72e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, math_boost::Ray const  & , math_boost::AABB const  & , float , float  ),&is_intersecting_83c244c5cad1eaf9>>();
+	};
+	// look_at_lh_12ae4d22ab712b1
+	aotLib[0x45d7790f845e1989] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<float4x4 (*) ( Context * __context__, float3 , float3 , float3  ),&look_at_lh_12ae4d22ab712b1>>();
+	};
+	// look_at_rh_57fabbbe8b8576f7
+	aotLib[0xfe89be0b804b3cf9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<float4x4 (*) ( Context * __context__, float3 , float3 , float3  ),&look_at_rh_57fabbbe8b8576f7>>();
+	};
+	// perspective_lh_2fac1cd2df0ab7fe
+	aotLib[0x65edcb27bfcdda61] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<float4x4 (*) ( Context * __context__, float , float , float , float  ),&perspective_lh_2fac1cd2df0ab7fe>>();
+	};
+	// perspective_rh_5d20db61257b5b19
+	aotLib[0x5e3c9d0fa9a4ab35] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<float4x4 (*) ( Context * __context__, float , float , float , float  ),&perspective_rh_5d20db61257b5b19>>();
+	};
+	// perspective_rh_opengl_fcf6139ab08387ca
+	aotLib[0xf89c0f626b41d12d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<float4x4 (*) ( Context * __context__, float , float , float , float  ),&perspective_rh_opengl_fcf6139ab08387ca>>();
+	};
+	// ortho_rh_f6bc4f195f22d8d5
+	aotLib[0x3165d97fa3aae235] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<float4x4 (*) ( Context * __context__, float , float , float , float , float , float  ),&ortho_rh_f6bc4f195f22d8d5>>();
+	};
+	// plane_dot_cf6fadebd33ebe09
+	aotLib[0xfe036a9d13b7e409] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, float4 , float4  ),&plane_dot_cf6fadebd33ebe09>>();
+	};
+	// plane_normalize_bcd7d36c68415690
+	aotLib[0x9c1efed8b1da3119] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float4 (*) ( Context * __context__, float4  ),&plane_normalize_bcd7d36c68415690>>();
+	};
+	// plane_from_point_normal_110b03e9793d1239
+	aotLib[0x3987ac1b43671a09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float4 (*) ( Context * __context__, float3 , float3  ),&plane_from_point_normal_110b03e9793d1239>>();
+	};
+	// planar_shadow_304637f7a6dac3fe
+	aotLib[0xbb8e47ea8fa810c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<float4x4 (*) ( Context * __context__, float4 , float4  ),&planar_shadow_304637f7a6dac3fe>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
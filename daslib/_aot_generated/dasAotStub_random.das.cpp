@@ -0,0 +1,224 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require random
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_9039956065963159497 {
+
+extern StructInfo __struct_info__341f996bfece1746;
+extern TypeInfo __type_info__90f4c07b5a6e390;
+extern TypeInfo __type_info__b9b4df4a4bacfdfc;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__7bf4f07b489d184;
+extern TypeInfo __type_info__eb5b1f38ffc4187a;
+extern VarInfo __var_info__dccae84baab67b72;
+extern VarInfo __var_info__4ed56d72366f889;
+extern VarInfo __var_info__46db835f1de6b6a2;
+extern VarInfo __var_info__488ae668be44efe3;
+extern VarInfo __var_info__b4603e4d731eb433;
+
+TypeInfo * __type_info__b4603e4d731eb433_arg_types_var_3755889303365752646[2] = { &__type_info__b9b4df4a4bacfdfc, &__type_info__7bf4f07b489d184 };
+VarInfo __struct_info__341f996bfece1746_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__b4603e4d731eb433_arg_types_var_3755889303365752646, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xb4603e4d731eb433), "__lambda", 0 };
+TypeInfo * __type_info__46db835f1de6b6a2_arg_types_var_3755889303365752646[1] = { &__type_info__eb5b1f38ffc4187a };
+VarInfo __struct_info__341f996bfece1746_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__46db835f1de6b6a2_arg_types_var_3755889303365752646, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x46db835f1de6b6a2), "__finalize", 8 };
+VarInfo __struct_info__341f996bfece1746_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x4ed56d72366f889), "__yield", 16 };
+VarInfo __struct_info__341f996bfece1746_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xdccae84baab67b72), "rnd_seed", 20 };
+VarInfo __struct_info__341f996bfece1746_field_4 =  { Type::tInt4, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 16, UINT64_C(0x488ae668be44efe3), "seed", 24 };
+VarInfo * __struct_info__341f996bfece1746_fields[5] =  { &__struct_info__341f996bfece1746_field_0, &__struct_info__341f996bfece1746_field_1, &__struct_info__341f996bfece1746_field_2, &__struct_info__341f996bfece1746_field_3, &__struct_info__341f996bfece1746_field_4 };
+StructInfo __struct_info__341f996bfece1746 = {"_lambda_random_95_8_1", "random", 6, __struct_info__341f996bfece1746_fields, 5, 40, UINT64_C(0x0), nullptr, UINT64_C(0x341f996bfece1746) };
+TypeInfo __type_info__90f4c07b5a6e390 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, UINT64_C(0x90f4c07b5a6e390) };
+TypeInfo __type_info__b9b4df4a4bacfdfc = { Type::tStructure, &__struct_info__341f996bfece1746, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 40, UINT64_C(0xb9b4df4a4bacfdfc) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__7bf4f07b489d184 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, UINT64_C(0x7bf4f07b489d184) };
+TypeInfo __type_info__eb5b1f38ffc4187a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b9b4df4a4bacfdfc, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xeb5b1f38ffc4187a) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace random { struct _lambda_random_95_8_1; };
+namespace random {
+
+struct _lambda_random_95_8_1 {
+	Func DAS_COMMENT((bool,random::_lambda_random_95_8_1,uint32_t &)) __lambda;
+	Func DAS_COMMENT((void,random::_lambda_random_95_8_1 *)) __finalize;
+	int32_t __yield;
+	int32_t rnd_seed;
+	int4 seed;
+};
+static_assert(sizeof(_lambda_random_95_8_1)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_random_95_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_random_95_8_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_random_95_8_1,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_random_95_8_1,rnd_seed)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_random_95_8_1,seed)==24,"structure field offset mismatch with DAS");
+}
+
+inline uint32_t _Funcrandom_0x60_random_uint_a20ddd90c3d8cc59 ( Context * __context__, int4 & __seed_rename_at_39 );
+inline void finalize_773add7e48ea701a ( Context * __context__, random::_lambda_random_95_8_1 & ____this_rename_at_95 );
+inline Sequence DAS_COMMENT((uint32_t)) _Funcbuiltin_0x60_each_7fe4d96adf28f971 ( Context * __context__, Lambda DAS_COMMENT((bool,uint32_t &)) const  __lam_rename_at_476 );
+inline int4 _Funcrandom_0x60_random_seed_40d32f1495a9708e ( Context * __context__, int32_t __seed_rename_at_14 );
+inline bool _Func_lambda_random_95_8_1_0x60_function_67b60f7a7f33cfb1 ( Context * __context__, random::_lambda_random_95_8_1 & ____this_rename_at_95, uint32_t & ___yield_95_rename_at_95 );
+inline void _Func_lambda_random_95_8_1_0x60_finalizer_bda79b78542307d4 ( Context * __context__, random::_lambda_random_95_8_1 * ____this_rename_at_95 );
+inline Sequence DAS_COMMENT((uint32_t)) each_random_uint_843d52252924f328 ( Context * __context__, int32_t __rnd_seed_rename_at_93 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x631b65186da051bd>(__context__) = 32767;/*LCG_RAND_MAX*/
+	das_global<int32_t,0x12e504fdf70159ba>(__context__) = 1073741823;/*LCG_RAND_MAX_BIG*/
+	das_global<float,0x4ad3ade19e4ca1c8>(__context__) = 3.05185094e-05f;/*LCG_IRAND_MAX_FLT*/
+}
+
+inline uint32_t _Funcrandom_0x60_random_uint_a20ddd90c3d8cc59 ( Context * __context__, int4 & __seed_rename_at_39 )
+{
+	das_copy(__seed_rename_at_39,SimPolicy<int4>::Add((SimPolicy<int4>::Mul(int4(214013,214013,214013,214013),__seed_rename_at_39,*__context__,nullptr)),int4(2531011,2531011,2531011,2531011),*__context__,nullptr));
+	int3 __i123_rename_at_42 = ((int3)(SimPolicy<int3>::BinAnd((SimPolicy<int3>::BinShr(das_swizzle_seq<int3,int4,0>::swizzle(__seed_rename_at_39) /*xyz*/,cast<int32_t>::from(16),*__context__,nullptr)),int3(32767,32767,32767),*__context__,nullptr)));
+	return das_auto_cast<uint32_t>::cast((uint32_t(v_extract_xi(v_cast_vec4i(__i123_rename_at_42)) /*x*/) ^ (uint32_t(v_extract_yi(v_cast_vec4i(__i123_rename_at_42)) /*y*/) << 0xfu)) ^ (uint32_t(v_extract_zi(v_cast_vec4i(__i123_rename_at_42)) /*z*/) << 0x1eu));
+}
+
+inline void finalize_773add7e48ea701a ( Context * __context__, random::_lambda_random_95_8_1 &  ____this_rename_at_95 )
+{
+	memset(&(____this_rename_at_95), 0, 40);
+}
+
+inline Sequence DAS_COMMENT((uint32_t)) _Funcbuiltin_0x60_each_7fe4d96adf28f971 ( Context * __context__, Lambda DAS_COMMENT((bool,uint32_t &)) const  __lam_rename_at_476 )
+{
+	Sequence DAS_COMMENT((uint32_t)) __it_rename_at_478; das_zero(__it_rename_at_478);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__it_rename_at_478),__lam_rename_at_476,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((uint32_t))>::cast(__it_rename_at_478);
+}
+
+inline int4 _Funcrandom_0x60_random_seed_40d32f1495a9708e ( Context * __context__, int32_t __seed_rename_at_14 )
+{
+	return das_auto_cast<int4>::cast(int4(__seed_rename_at_14,__seed_rename_at_14 + 1,__seed_rename_at_14 + 2,__seed_rename_at_14 + 3));
+}
+
+inline bool _Func_lambda_random_95_8_1_0x60_function_67b60f7a7f33cfb1 ( Context * __context__, random::_lambda_random_95_8_1 &  ____this_rename_at_95, uint32_t & ___yield_95_rename_at_95 )
+{
+	switch (____this_rename_at_95.__yield) {
+	case 0: goto label_0;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 2: goto label_2;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_95.seed,_Funcrandom_0x60_random_seed_40d32f1495a9708e(__context__,____this_rename_at_95.rnd_seed));
+	label_1:;;
+	das_copy(___yield_95_rename_at_95,_Funcrandom_0x60_random_uint_a20ddd90c3d8cc59(__context__,____this_rename_at_95.seed));
+	das_copy(____this_rename_at_95.__yield,3);
+	return das_auto_cast<bool>::cast(true);
+	label_3:;;
+	goto label_1;
+	label_2:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_random_95_8_1_0x60_finalizer_bda79b78542307d4 ( Context * __context__, random::_lambda_random_95_8_1 * ____this_rename_at_95 )
+{
+	finalize_773add7e48ea701a(__context__,das_arg<random::_lambda_random_95_8_1>::pass(das_deref(__context__,____this_rename_at_95)));
+	das_delete_lambda_struct<random::_lambda_random_95_8_1 *>::clear(__context__,____this_rename_at_95);
+}
+
+inline Sequence DAS_COMMENT((uint32_t)) each_random_uint_843d52252924f328 ( Context * __context__, int32_t __rnd_seed_rename_at_93 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((uint32_t))>::cast(_Funcbuiltin_0x60_each_7fe4d96adf28f971(__context__,das_ascend<bool,random::_lambda_random_95_8_1>::make(__context__,&__type_info__b9b4df4a4bacfdfc,(([&]() -> random::_lambda_random_95_8_1 {
+		random::_lambda_random_95_8_1 __mks_94;
+		das_zero(__mks_94);
+		das_copy((__mks_94.__lambda),(Func(__context__->fnByMangledName(/*@random::_lambda_random_95_8_1`function XS<_lambda_random_95_8_1> &u*/ 17718366829073555854u))));
+		das_copy((__mks_94.__finalize),(Func(__context__->fnByMangledName(/*@random::_lambda_random_95_8_1`finalizer X1<S<_lambda_random_95_8_1>>?*/ 10611033301232375119u))));
+		das_copy((__mks_94.rnd_seed),(__rnd_seed_rename_at_93));
+		return __mks_94;
+	})()))));
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcrandom_0x60_random_uint_a20ddd90c3d8cc59
+	aotLib[0xf7c045896d1ea645] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__, int4 &  ),&_Funcrandom_0x60_random_uint_a20ddd90c3d8cc59>>();
+	};
+	// finalize_773add7e48ea701a
+	aotLib[0x6b7eb5bc7b6a117d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, random::_lambda_random_95_8_1 &  ),&finalize_773add7e48ea701a>>();
+	};
+	// _Funcbuiltin_0x60_each_7fe4d96adf28f971
+	aotLib[0x2b7cf0e9dd55082d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((uint32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,uint32_t &)) const   ),&_Funcbuiltin_0x60_each_7fe4d96adf28f971>>();
+	};
+	// _Funcrandom_0x60_random_seed_40d32f1495a9708e
+	aotLib[0xa88480072784083d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int4 (*) ( Context * __context__, int32_t  ),&_Funcrandom_0x60_random_seed_40d32f1495a9708e>>();
+	};
+	// _Func_lambda_random_95_8_1_0x60_function_67b60f7a7f33cfb1
+	aotLib[0x555fe429f4f3748b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, random::_lambda_random_95_8_1 & , uint32_t &  ),&_Func_lambda_random_95_8_1_0x60_function_67b60f7a7f33cfb1>>();
+	};
+	// _Func_lambda_random_95_8_1_0x60_finalizer_bda79b78542307d4
+	aotLib[0x1983f3bc6d76f997] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, random::_lambda_random_95_8_1 *  ),&_Func_lambda_random_95_8_1_0x60_finalizer_bda79b78542307d4>>();
+	};
+	// each_random_uint_843d52252924f328
+	aotLib[0x6bf9d1c795d6582f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((uint32_t)) (*) ( Context * __context__, int32_t  ),&each_random_uint_843d52252924f328>>();
+	};
+	// [[ init script ]]
+	aotLib[0xb10e493287e21043] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,2262 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require regex
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_9878276369668962785 {
+
+extern StructInfo __struct_info__90edff79ff0df263;
+extern StructInfo __struct_info__290109a00f355a1d;
+extern TypeInfo __type_info__af63e84c860200f0;
+extern TypeInfo __type_info__5bbf416596e6e12a;
+extern TypeInfo __type_info__e375858168db8b63;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__df1d79dec7ea1f1f;
+extern TypeInfo __type_info__8c48207b56753d8;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__b3120c480d69888a;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__1dafad4a6313ad41;
+extern TypeInfo __type_info__4ae00d463a05655b;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern TypeInfo __type_info__f95678735cf0e442;
+extern TypeInfo __type_info__a0ce46235c7fd6e1;
+extern TypeInfo __type_info__1c40a39445126ec1;
+extern TypeInfo __type_info__6ee471041d873632;
+extern TypeInfo __type_info__af63ef4c86020cd5;
+extern VarInfo __var_info__801eea2cbd01ab82;
+extern VarInfo __var_info__46c4aae68974013c;
+extern VarInfo __var_info__f125177ee5074a2c;
+extern VarInfo __var_info__aaae75eb4558282c;
+extern VarInfo __var_info__cba517eb5789f971;
+extern VarInfo __var_info__ca591566b6160624;
+extern VarInfo __var_info__6f2a8bb3467ac7d1;
+extern VarInfo __var_info__12d7fe1ad414e6f2;
+extern VarInfo __var_info__5a36e0359ac4e7fc;
+extern VarInfo __var_info__20ea36bbd9f9b28f;
+extern VarInfo __var_info__99c9e869cdf5f631;
+extern VarInfo __var_info__1e6cc86183fe900e;
+extern VarInfo __var_info__332d1622b8fd2ba3;
+extern VarInfo __var_info__e08612711dd137b5;
+extern VarInfo __var_info__d8f7c7f7e9d5352;
+extern VarInfo __var_info__ca6d1566b626af2e;
+extern VarInfo __var_info__afb12e56747735bf;
+extern VarInfo __var_info__1db89f878375c2fe;
+extern VarInfo __var_info__f875633c0f2dbe29;
+extern VarInfo __var_info__44afa437fceca048;
+extern VarInfo __var_info__ca521566b60fe776;
+extern FuncInfo __func_info__87bf23f355201ee1;
+extern EnumInfo __enum_info__c6a7b3ce425cb39a;
+
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_0 = { "Char", 0 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_1 = { "Set", 1 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_2 = { "Any", 2 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_3 = { "Eos", 3 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_4 = { "Group", 4 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_5 = { "Plus", 5 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_6 = { "Star", 6 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_7 = { "Question", 7 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_8 = { "Concat", 8 };
+EnumValueInfo __enum_info__c6a7b3ce425cb39a_value_9 = { "Union", 9 };
+EnumValueInfo * __enum_info__c6a7b3ce425cb39a_values [] = { &__enum_info__c6a7b3ce425cb39a_value_0, &__enum_info__c6a7b3ce425cb39a_value_1, &__enum_info__c6a7b3ce425cb39a_value_2, &__enum_info__c6a7b3ce425cb39a_value_3, &__enum_info__c6a7b3ce425cb39a_value_4, &__enum_info__c6a7b3ce425cb39a_value_5, &__enum_info__c6a7b3ce425cb39a_value_6, &__enum_info__c6a7b3ce425cb39a_value_7, &__enum_info__c6a7b3ce425cb39a_value_8, &__enum_info__c6a7b3ce425cb39a_value_9 };
+EnumInfo __enum_info__c6a7b3ce425cb39a = { "ReOp", "regex", __enum_info__c6a7b3ce425cb39a_values, 10, UINT64_C(0xc6a7b3ce425cb39a) };
+VarInfo __struct_info__90edff79ff0df263_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x6f2a8bb3467ac7d1), "root", 0 };
+VarInfo __struct_info__90edff79ff0df263_field_1 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xd8f7c7f7e9d5352), "match", 8 };
+VarInfo __struct_info__90edff79ff0df263_field_2 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__5bbf416596e6e12a, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, UINT64_C(0xf875633c0f2dbe29), "groups", 16 };
+uint32_t __type_info__f125177ee5074a2c_dim_var_10443284010377278051[1] = { 8 };
+VarInfo __struct_info__90edff79ff0df263_field_3 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__f125177ee5074a2c_dim_var_10443284010377278051, 30, 32, UINT64_C(0xf125177ee5074a2c), "earlyOut", 40 };
+VarInfo __struct_info__90edff79ff0df263_field_4 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x46c4aae68974013c), "canEarlyOut", 72 };
+VarInfo * __struct_info__90edff79ff0df263_fields[5] =  { &__struct_info__90edff79ff0df263_field_0, &__struct_info__90edff79ff0df263_field_1, &__struct_info__90edff79ff0df263_field_2, &__struct_info__90edff79ff0df263_field_3, &__struct_info__90edff79ff0df263_field_4 };
+StructInfo __struct_info__90edff79ff0df263 = {"Regex", "regex", 28, __struct_info__90edff79ff0df263_fields, 5, 80, UINT64_C(0x0), nullptr, UINT64_C(0x90edff79ff0df263) };
+VarInfo __struct_info__290109a00f355a1d_field_0 =  { Type::tEnumeration, nullptr, &__enum_info__c6a7b3ce425cb39a, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xca591566b6160624), "op", 0 };
+VarInfo __struct_info__290109a00f355a1d_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xca521566b60fe776), "id", 4 };
+TypeInfo * __type_info__1e6cc86183fe900e_arg_types_var_2954653413586328093[3] = { &__type_info__1c40a39445126ec1, &__type_info__e375858168db8b63, &__type_info__a0ce46235c7fd6e1 };
+VarInfo __struct_info__290109a00f355a1d_field_2 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__b3120c480d69888a, nullptr, (TypeInfo **)__type_info__1e6cc86183fe900e_arg_types_var_2954653413586328093, nullptr, 3, 0, nullptr, 28, 8, UINT64_C(0x1e6cc86183fe900e), "fun2", 8 };
+TypeInfo * __type_info__afb12e56747735bf_arg_types_var_2954653413586328093[3] = { &__type_info__e375858168db8b63, &__type_info__df1d79dec7ea1f1f, &__type_info__f95678735cf0e442 };
+VarInfo __struct_info__290109a00f355a1d_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__afb12e56747735bf_arg_types_var_2954653413586328093, nullptr, 3, 0, nullptr, 28, 8, UINT64_C(0xafb12e56747735bf), "gen2", 16 };
+VarInfo __struct_info__290109a00f355a1d_field_4 =  { Type::tRange, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0xca6d1566b626af2e), "at", 24 };
+VarInfo __struct_info__290109a00f355a1d_field_5 =  { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaaae75eb4558282c), "text", 32 };
+VarInfo __struct_info__290109a00f355a1d_field_6 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x332d1622b8fd2ba3), "textLen", 40 };
+VarInfo __struct_info__290109a00f355a1d_field_7 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__e375858168db8b63, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, UINT64_C(0x1db89f878375c2fe), "all", 48 };
+VarInfo __struct_info__290109a00f355a1d_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x801eea2cbd01ab82), "left", 72 };
+VarInfo __struct_info__290109a00f355a1d_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x20ea36bbd9f9b28f), "right", 80 };
+VarInfo __struct_info__290109a00f355a1d_field_10 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x5a36e0359ac4e7fc), "subexpr", 88 };
+VarInfo __struct_info__290109a00f355a1d_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x12d7fe1ad414e6f2), "next", 96 };
+uint32_t __type_info__44afa437fceca048_dim_var_2954653413586328093[1] = { 8 };
+VarInfo __struct_info__290109a00f355a1d_field_12 =  { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 1, __type_info__44afa437fceca048_dim_var_2954653413586328093, 30, 32, UINT64_C(0x44afa437fceca048), "cset", 104 };
+VarInfo __struct_info__290109a00f355a1d_field_13 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x99c9e869cdf5f631), "index", 136 };
+VarInfo __struct_info__290109a00f355a1d_field_14 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xcba517eb5789f971), "tail", 144 };
+VarInfo * __struct_info__290109a00f355a1d_fields[15] =  { &__struct_info__290109a00f355a1d_field_0, &__struct_info__290109a00f355a1d_field_1, &__struct_info__290109a00f355a1d_field_2, &__struct_info__290109a00f355a1d_field_3, &__struct_info__290109a00f355a1d_field_4, &__struct_info__290109a00f355a1d_field_5, &__struct_info__290109a00f355a1d_field_6, &__struct_info__290109a00f355a1d_field_7, &__struct_info__290109a00f355a1d_field_8, &__struct_info__290109a00f355a1d_field_9, &__struct_info__290109a00f355a1d_field_10, &__struct_info__290109a00f355a1d_field_11, &__struct_info__290109a00f355a1d_field_12, &__struct_info__290109a00f355a1d_field_13, &__struct_info__290109a00f355a1d_field_14 };
+StructInfo __struct_info__290109a00f355a1d = {"ReNode", "regex", 28, __struct_info__290109a00f355a1d_fields, 15, 152, UINT64_C(0x0), nullptr, UINT64_C(0x290109a00f355a1d) };
+VarInfo __func_info__87bf23f355201ee1_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xe08612711dd137b5), "node", 0 };
+VarInfo * __func_info__87bf23f355201ee1_fields[1] =  { &__func_info__87bf23f355201ee1_field_0 };
+FuncInfo __func_info__87bf23f355201ee1 = {"invoke block<(node:regex::ReNode?):void> const", "", __func_info__87bf23f355201ee1_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x87bf23f355201ee1), 0x0 };
+TypeInfo __type_info__af63e84c860200f0 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e84c860200f0) };
+TypeInfo * __type_info__5bbf416596e6e12a_arg_types[2] = { &__type_info__af63ef4c86020cd5, &__type_info__af63ee4c86020b22 };
+TypeInfo __type_info__5bbf416596e6e12a = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__5bbf416596e6e12a_arg_types, nullptr, 2, 0, nullptr, 16390, 16, UINT64_C(0x5bbf416596e6e12a) };
+TypeInfo __type_info__e375858168db8b63 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__4ae00d463a05655b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xe375858168db8b63) };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+TypeInfo __type_info__df1d79dec7ea1f1f = { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e84c860200f0, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xdf1d79dec7ea1f1f) };
+TypeInfo __type_info__8c48207b56753d8 = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x8c48207b56753d8) };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+TypeInfo __type_info__b3120c480d69888a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xb3120c480d69888a) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__1dafad4a6313ad41 = { Type::tEnumeration, nullptr, &__enum_info__c6a7b3ce425cb39a, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x1dafad4a6313ad41) };
+TypeInfo __type_info__4ae00d463a05655b = { Type::tStructure, &__struct_info__290109a00f355a1d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 152, UINT64_C(0x4ae00d463a05655b) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+TypeInfo __type_info__f95678735cf0e442 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 40, UINT64_C(0xf95678735cf0e442) };
+TypeInfo __type_info__a0ce46235c7fd6e1 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 8236, 8, UINT64_C(0xa0ce46235c7fd6e1) };
+TypeInfo __type_info__1c40a39445126ec1 = { Type::tStructure, &__struct_info__90edff79ff0df263, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 80, UINT64_C(0x1c40a39445126ec1) };
+TypeInfo __type_info__6ee471041d873632 = { Type::tStructure, &__struct_info__90edff79ff0df263, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 80, UINT64_C(0x6ee471041d873632) };
+TypeInfo __type_info__af63ef4c86020cd5 = { Type::tRange, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0xaf63ef4c86020cd5) };
+
+static void resolveTypeInfoAnnotations()
+{
+	__type_info__f95678735cf0e442.resolveAnnotation();
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__6ee471041d873632 };
+TypeInfo * __tinfo_1[1] = { &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_2[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__1dafad4a6313ad41 };
+TypeInfo * __tinfo_3[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_4[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_5[1] = { &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_6[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_7[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_8[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_9[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_10[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_11[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_12[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_13[1] = { &__type_info__af63ee4c86020b22 };
+TypeInfo * __tinfo_14[2] = { &__type_info__af63ee4c86020b22, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_15[2] = { &__type_info__f95678735cf0e442, &__type_info__af63ee4c86020b22 };
+namespace regex { struct ReNode; };
+namespace regex { struct Regex; };
+namespace regex {
+
+enum class ReOp : int32_t {
+	Char = int32_t(0),
+	Set = int32_t(1),
+	Any = int32_t(2),
+	Eos = int32_t(3),
+	Group = int32_t(4),
+	Plus = int32_t(5),
+	Star = int32_t(6),
+	Question = int32_t(7),
+	Concat = int32_t(8),
+	Union = int32_t(9),
+};
+}
+}
+template <> struct cast< das::_anon_9878276369668962785::regex::ReOp > : cast_enum < das::_anon_9878276369668962785::regex::ReOp > {};
+namespace _anon_9878276369668962785 {
+namespace regex {
+
+struct ReNode {
+	DAS_COMMENT(enum) regex::ReOp op;
+	int32_t id;
+	Func DAS_COMMENT((uint8_t *,regex::Regex,regex::ReNode *,uint8_t * const )) fun2;
+	Func DAS_COMMENT((void,regex::ReNode *,Sequence DAS_COMMENT((uint32_t)),StringBuilderWriter)) gen2;
+	range at;
+	char * text;
+	int32_t textLen;
+	TArray<regex::ReNode *> all;
+	regex::ReNode * left;
+	regex::ReNode * right;
+	regex::ReNode * subexpr;
+	regex::ReNode * next;
+	TDim<uint32_t,8> cset;
+	int32_t index;
+	uint8_t * tail;
+};
+static_assert(sizeof(ReNode)==152,"structure size mismatch with DAS");
+static_assert(offsetof(ReNode,op)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,id)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,fun2)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,gen2)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,at)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,text)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,textLen)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,all)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,left)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,right)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,subexpr)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,next)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,cset)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,index)==136,"structure field offset mismatch with DAS");
+static_assert(offsetof(ReNode,tail)==144,"structure field offset mismatch with DAS");
+}
+namespace regex {
+
+struct Regex {
+	regex::ReNode * root;
+	uint8_t * match;
+	TArray<TTuple<16,range,char *>> groups;
+	TDim<uint32_t,8> earlyOut;
+	bool canEarlyOut;
+};
+static_assert(sizeof(Regex)==80,"structure size mismatch with DAS");
+static_assert(offsetof(Regex,root)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,match)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,groups)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,earlyOut)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(Regex,canEarlyOut)==72,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_resize_13e4a05653768251 ( Context * __context__, TArray<regex::ReNode *> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_finalize_b7deb464a4f8e41c ( Context * __context__, TArray<regex::ReNode *> & __a_rename_at_395 );
+inline int32_t _Funcbuiltin_0x60_length_7938efcc1bc3eff1 ( Context * __context__, TDim<regex::ReNode *,2> const  & __a_rename_at_221 );
+inline void finalize_cb8163f3a24e2747 ( Context * __context__, regex::ReNode & ____this_rename_at_26 );
+inline void _Funcbuiltin_0x60_push_bd6055bce97bf09e ( Context * __context__, TArray<TTuple<16,range,char *>> & __Arr_rename_at_75, TTuple<16,range,char *> const  & __value_rename_at_75 );
+inline regex::Regex & _Funcbuiltin_0x60__return_with_lockcheck_48c386c3dcec1cdd ( Context * __context__, regex::Regex & __a_rename_at_42 );
+inline void finalize_6293242d2ef1254f ( Context * __context__, TVariant<16,regex::ReNode *,void *> & ____this_rename_at_261 );
+inline void finalize_46f88278c98091eb ( Context * __context__, regex::ReNode * & ____this_rename_at_336 );
+inline void _Funcbuiltin_0x60_push_5dc212b561cc93c2 ( Context * __context__, TArray<regex::ReNode *> & __Arr_rename_at_75, regex::ReNode * const  __value_rename_at_75 );
+inline TArray<regex::ReNode *> _Funcbuiltin_0x60_to_array_move_59084725f30dd7bb ( Context * __context__, TDim<regex::ReNode *,2> & __a_rename_at_517 );
+inline bool _Funcbuiltin_0x60_next_160159e214cdd056 ( Context * __context__, Sequence DAS_COMMENT((uint32_t)) const  & __it_rename_at_427, uint32_t & __value_rename_at_427 );
+inline uint32_t re_gen_get_rep_limit_aad39a472678db9d ( Context * __context__ );
+inline void trace_89f6695f8909b072 ( Context * __context__, char * const  __msg_rename_at_72, int32_t __offset_rename_at_72 );
+inline void note_89f6695f8909b072 ( Context * __context__, char * const  __msg_rename_at_77, int32_t __offset_rename_at_77 );
+inline void trace_backtrack_c77fe5b3ac1a6a7c ( Context * __context__ );
+inline void trace_value_4739abdd3b0a7208 ( Context * __context__, regex::ReNode * const  __value_rename_at_86 );
+inline TVariant<16,regex::ReNode *,void *> nada_5086bd0a540f8186 ( Context * __context__ );
+inline TVariant<16,regex::ReNode *,void *> maybe_d7a4f325999cb99b ( Context * __context__, regex::ReNode * const  __value_rename_at_97 );
+inline bool eos_dde6e11fd3802ac8 ( Context * __context__, char * const  __expr_rename_at_101, int32_t __offset_rename_at_101 );
+inline int32_t at_c9bade5ff7edd57d ( Context * __context__, char * const  __expr_rename_at_104, int32_t __offset_rename_at_104 );
+inline int32_t next_1bd07c8c346bbbc2 ( Context * __context__, TVariant<16,regex::ReNode *,void *> const  & __re_rename_at_119 );
+inline bool is_set_empty_fb12252b2129800d ( Context * __context__, TDim<uint32_t,8> const  & __cset_rename_at_125 );
+inline void set_or_char_471888d9ed78efab ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_131, int32_t __ch_rename_at_131 );
+inline void set_or_range_a7ad44e8ef1ec07c ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_134, range __bits_rename_at_134 );
+inline void set_invert_be791c77bc6b6a11 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_138 );
+inline void set_or_set_9609a9e932b32815 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_142, TDim<uint32_t,8> const  & __eset_rename_at_142 );
+inline void set_negative_7a1fcd94df7d5358 ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_146 );
+inline void set_meta_47c27306e1ab33a ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_150, int32_t __che_rename_at_150 );
+inline bool is_meta_character_24d3d25015b1373f ( Context * __context__, int32_t __ch_rename_at_179 );
+inline bool is_set_character_11f8fcca4329c870 ( Context * __context__, int32_t __ch_rename_at_182 );
+inline TVariant<16,regex::ReNode *,void *> re_char_72b6d2190a4aa86e ( Context * __context__, char * const  __expr_rename_at_186, int32_t __offset_rename_at_186 );
+inline TVariant<16,regex::ReNode *,void *> re_set_items_e4aed5649396a9a6 ( Context * __context__, char * const  __expr_rename_at_209, int32_t __offset_rename_at_209 );
+inline TVariant<16,regex::ReNode *,void *> re_set_10c94f59326660bb ( Context * __context__, char * const  __expr_rename_at_248, int32_t __offset_rename_at_248 );
+inline TVariant<16,regex::ReNode *,void *> re_any_8127ec932cbb51d ( Context * __context__, char * const  __expr_rename_at_273, int32_t __offset_rename_at_273 );
+inline TVariant<16,regex::ReNode *,void *> re_eos_62bbb15403a7af8a ( Context * __context__, char * const  __expr_rename_at_282, int32_t __offset_rename_at_282 );
+inline TVariant<16,regex::ReNode *,void *> re_group_e305de97e880ce49 ( Context * __context__, char * const  __expr_rename_at_291, int32_t __offset_rename_at_291 );
+inline TVariant<16,regex::ReNode *,void *> re_elementary_7fb0bc5f471be253 ( Context * __context__, char * const  __expr_rename_at_306, int32_t __offset_rename_at_306 );
+inline regex::ReNode * mk_concat_4dcd600b481f43c0 ( Context * __context__, regex::ReNode * __left_rename_at_327, regex::ReNode * __right_rename_at_327 );
+inline regex::ReNode * mk_union_53d62d01f1c4cdf7 ( Context * __context__, regex::ReNode * __left_rename_at_351, regex::ReNode * __right_rename_at_351 );
+inline TVariant<16,regex::ReNode *,void *> re_re_806d249d156e8cc6 ( Context * __context__, char * const  __expr_rename_at_373, int32_t __offset_rename_at_373 );
+inline TVariant<16,regex::ReNode *,void *> re_basic_23562b17fe86ae37 ( Context * __context__, char * const  __expr_rename_at_401, int32_t __offset_rename_at_401 );
+inline regex::ReNode * re_parse_3d6f9a305b851160 ( Context * __context__, char * const  __expr_rename_at_417 );
+inline void visit_top_down_28dd8379641934af ( Context * __context__, regex::ReNode * __node_rename_at_427, Block DAS_COMMENT((void,regex::ReNode *)) const  & __blk_rename_at_427 );
+inline void re_assign_next_40df54bb93432757 ( Context * __context__, regex::Regex & __re_rename_at_438 );
+inline void re_assign_groups_fb8b490fd90b06b1 ( Context * __context__, regex::Regex & __re_rename_at_451 );
+inline void re_assign_match_functions_b0713981805262da ( Context * __context__, regex::Regex & __re_rename_at_463 );
+inline uint8_t * re_match2_single_char_ec4bd67a88d6c383 ( Context * __context__, regex::Regex & __regex_rename_at_507, regex::ReNode * __node_rename_at_507, uint8_t * const  __str_rename_at_507 );
+inline uint8_t * re_match2_char_e7712649ef04ae7d ( Context * __context__, regex::Regex & __regex_rename_at_522, regex::ReNode * __node_rename_at_522, uint8_t * const  __str_rename_at_522 );
+inline uint8_t * re_match2_union_29c921f92bb6c013 ( Context * __context__, regex::Regex & __regex_rename_at_539, regex::ReNode * __node_rename_at_539, uint8_t * const  __str_rename_at_539 );
+inline uint8_t * re_match2_set_a7d14982d3d94062 ( Context * __context__, regex::Regex & __regex_rename_at_550, regex::ReNode * __node_rename_at_550, uint8_t * const  __str_rename_at_550 );
+inline uint8_t * re_match2_any_145e1cb203d4af15 ( Context * __context__, regex::Regex & __regex_rename_at_565, regex::ReNode * __node_rename_at_565, uint8_t * const  __str_rename_at_565 );
+inline uint8_t * re_match2_concat_aa5a3133a76ae77 ( Context * __context__, regex::Regex & __regex_rename_at_580, regex::ReNode * __node_rename_at_580, uint8_t * const  __str_rename_at_580 );
+inline uint8_t * re_match2_eos_e54e018f6fdc2874 ( Context * __context__, regex::Regex & __regex_rename_at_591, regex::ReNode * __node_rename_at_591, uint8_t * const  __str_rename_at_591 );
+inline uint8_t * re_match2_question_c6073fc7d021f681 ( Context * __context__, regex::Regex & __regex_rename_at_604, regex::ReNode * __node_rename_at_604, uint8_t * const  __str_rename_at_604 );
+inline uint8_t * re_match2_plus_6caa18e9465405bd ( Context * __context__, regex::Regex & __regex_rename_at_619, regex::ReNode * __node_rename_at_619, uint8_t * const  __str_rename_at_619 );
+inline uint8_t * re_match2_plus_set_a77e502c2ce10da5 ( Context * __context__, regex::Regex & __regex_rename_at_644, regex::ReNode * __node_rename_at_644, uint8_t * const  __str_rename_at_644 );
+inline uint8_t * re_match2_star_3d9e9e017941b973 ( Context * __context__, regex::Regex & __regex_rename_at_674, regex::ReNode * __node_rename_at_674, uint8_t * const  __str_rename_at_674 );
+inline uint8_t * re_match2_group_64e1ead31a846f3e ( Context * __context__, regex::Regex & __regex_rename_at_697, regex::ReNode * __node_rename_at_697, uint8_t * const  __str_rename_at_697 );
+inline bool re_early_out_22e386bed08ccfdb ( Context * __context__, TDim<uint32_t,8> & __cset_rename_at_711, regex::ReNode * const  __node_rename_at_711 );
+inline bool is_valid_f341200a6f682e5a ( Context * __context__, regex::Regex & __re_rename_at_750 );
+inline bool regex_compile_49466229404ec92e ( Context * __context__, regex::Regex & __re_rename_at_754, char * const  __expr_rename_at_754 );
+inline regex::Regex regex_compile_3ab3aff652051470 ( Context * __context__, char * const  __expr_rename_at_766 );
+inline regex::Regex regex_compile_34958ec809c4585e ( Context * __context__, regex::Regex & __re_rename_at_772 );
+inline int32_t regex_match_270cb942810fc6f1 ( Context * __context__, regex::Regex & __regex_rename_at_778, char * const  __str_rename_at_778, int32_t __offset_rename_at_778 );
+inline char * regex_group_1f825e4ecddcb4c9 ( Context * __context__, regex::Regex const  & __regex_rename_at_792, int32_t __index_rename_at_792, char * const  __match_rename_at_792 );
+inline void regex_foreach_20e08b8606d5c3d1 ( Context * __context__, regex::Regex & __regex_rename_at_798, char * const  __str_rename_at_798, Block DAS_COMMENT((bool,range)) const  & __blk_rename_at_798 );
+inline void regex_debug_ceb0bfb647144f34 ( Context * __context__, regex::Regex const  & __regex_rename_at_837 );
+inline void debug_set_31f032942f694fa4 ( Context * __context__, TDim<uint32_t,8> const  & __cset_rename_at_850 );
+inline void debug_re_fa0b41547c802fb4 ( Context * __context__, regex::ReNode * const  __node_rename_at_859, int32_t __tab_rename_at_859 );
+inline int32_t rnd_set_character_f49e90c9ced30293 ( Context * __context__, TDim<uint32_t,8> const  & __cset_rename_at_915, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_915 );
+inline void re_gen2_fail_83869989d4feff33 ( Context * __context__, regex::ReNode * __node_rename_at_922, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_922, StringBuilderWriter & __str_rename_at_922 );
+inline void re_gen2_char_f50387c056fd98bf ( Context * __context__, regex::ReNode * __node_rename_at_927, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_927, StringBuilderWriter & __str_rename_at_927 );
+inline void re_gen2_union_9643fdb28fe9f09d ( Context * __context__, regex::ReNode * __node_rename_at_935, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_935, StringBuilderWriter & __str_rename_at_935 );
+inline void re_gen2_set_687ad6fcb132e4de ( Context * __context__, regex::ReNode * __node_rename_at_944, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_944, StringBuilderWriter & __str_rename_at_944 );
+inline void re_gen2_any_998ffcd284a238dd ( Context * __context__, regex::ReNode * __node_rename_at_952, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_952, StringBuilderWriter & __str_rename_at_952 );
+inline void re_gen2_concat_2acaded76c0d6fe4 ( Context * __context__, regex::ReNode * __node_rename_at_962, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_962, StringBuilderWriter & __str_rename_at_962 );
+inline void re_gen2_eos_b4ed344d74735b22 ( Context * __context__, regex::ReNode * __node_rename_at_968, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_968, StringBuilderWriter & __str_rename_at_968 );
+inline void re_gen2_question_9bc71016a02ceac7 ( Context * __context__, regex::ReNode * __node_rename_at_975, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_975, StringBuilderWriter & __str_rename_at_975 );
+inline void re_gen2_plus_32b59fc6bd3347f1 ( Context * __context__, regex::ReNode * __node_rename_at_988, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_988, StringBuilderWriter & __str_rename_at_988 );
+inline void re_gen2_star_e57698da7750ea56 ( Context * __context__, regex::ReNode * __node_rename_at_1002, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_1002, StringBuilderWriter & __str_rename_at_1002 );
+inline void re_gen2_group_220ee7b205b18ab6 ( Context * __context__, regex::ReNode * __node_rename_at_1016, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_1016, StringBuilderWriter & __str_rename_at_1016 );
+inline char * re_gen_782e537f3d526983 ( Context * __context__, regex::Regex & __re_rename_at_1026, Sequence DAS_COMMENT((uint32_t)) & __rnd_rename_at_1026 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<bool,0x5f00ae86cba54a79>(__context__) = false;/*log_parse_enabled*/
+	das_global<bool,0xe3b40eebb799db7>(__context__) = false;/*log_match_enabled*/
+	das_global<bool,0xdb2cb78f262cdc25>(__context__) = false;/*range_check_enabled*/
+	das_global<bool,0x65aeb70fb737f14e>(__context__) = false;/*log_gen_enabled*/
+	das_global<int32_t,0x7f437468b6b6a0da>(__context__) = 0;/*trace_tab*/
+	das_global<uint32_t,0x570cc75ae91fa86f>(__context__) = 0x8u;/*re_gen_rep_limit*/
+	das_global<char *,0x810ab8027aecb8a9>(__context__) = ((char *) "\\+-*.()[]|^");/*meta*/
+	das_global<char *,0x2ebc2ae7102a7e3c>(__context__) = ((char *) "wWsSdD");/*meta_set*/
+}
+
+inline void _Funcbuiltin_0x60_resize_13e4a05653768251 ( Context * __context__, TArray<regex::ReNode *> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<regex::ReNode *>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_b7deb464a4f8e41c ( Context * __context__, TArray<regex::ReNode *> &  __a_rename_at_395 )
+{
+	{
+		bool __need_loop_397 = true;
+		// aV : regex::ReNode? aka TT&
+		das_iterator<TArray<regex::ReNode *>> __aV_iterator(__a_rename_at_395);
+		regex::ReNode * * __aV_rename_at_397;
+		__need_loop_397 = __aV_iterator.first(__context__,(__aV_rename_at_397)) && __need_loop_397;
+		for ( ; __need_loop_397 ; __need_loop_397 = __aV_iterator.next(__context__,(__aV_rename_at_397)) )
+		{
+			finalize_46f88278c98091eb(__context__,(*__aV_rename_at_397));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_397));
+	};
+	builtin_array_free(das_arg<TArray<regex::ReNode *>>::pass(__a_rename_at_395),8,__context__);
+}
+
+inline int32_t _Funcbuiltin_0x60_length_7938efcc1bc3eff1 ( Context * __context__, TDim<regex::ReNode *,2> const  &  __a_rename_at_221 )
+{
+	return das_auto_cast<int32_t>::cast(2);
+}
+
+inline void finalize_cb8163f3a24e2747 ( Context * __context__, regex::ReNode &  ____this_rename_at_26 )
+{
+	_Funcbuiltin_0x60_finalize_b7deb464a4f8e41c(__context__,das_arg<TArray<regex::ReNode *>>::pass(____this_rename_at_26.all));
+	finalize_46f88278c98091eb(__context__,____this_rename_at_26.left);
+	finalize_46f88278c98091eb(__context__,____this_rename_at_26.right);
+	finalize_46f88278c98091eb(__context__,____this_rename_at_26.subexpr);
+	memset(&(____this_rename_at_26), 0, 152);
+}
+
+inline void _Funcbuiltin_0x60_push_bd6055bce97bf09e ( Context * __context__, TArray<TTuple<16,range,char *>> &  __Arr_rename_at_75, TTuple<16,range,char *> const  &  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<TTuple<16,range,char *>>>::pass(__Arr_rename_at_75),16,__context__),__context__),__value_rename_at_75);
+}
+
+inline regex::Regex & _Funcbuiltin_0x60__return_with_lockcheck_48c386c3dcec1cdd ( Context * __context__, regex::Regex &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<regex::Regex &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<regex::Regex &>::cast(__a_rename_at_42);
+}
+
+inline void finalize_6293242d2ef1254f ( Context * __context__, TVariant<16,regex::ReNode *,void *> &  ____this_rename_at_261 )
+{
+	if ( das_get_variant_field<regex::ReNode *,8,0>::is(____this_rename_at_261) )
+	{
+		finalize_46f88278c98091eb(__context__,das_get_variant_field<regex::ReNode *,8,0>::get(____this_rename_at_261));
+	};
+	memset(&(____this_rename_at_261), 0, 16);
+}
+
+inline void finalize_46f88278c98091eb ( Context * __context__, regex::ReNode * & ____this_rename_at_336 )
+{
+	if ( ____this_rename_at_336 != nullptr )
+	{
+		finalize_cb8163f3a24e2747(__context__,das_arg<regex::ReNode>::pass(das_deref(__context__,____this_rename_at_336)));
+		das_delete<regex::ReNode *>::clear(__context__,____this_rename_at_336);
+		das_copy(____this_rename_at_336,nullptr);
+	};
+}
+
+inline void _Funcbuiltin_0x60_push_5dc212b561cc93c2 ( Context * __context__, TArray<regex::ReNode *> &  __Arr_rename_at_75, regex::ReNode * const  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<regex::ReNode *>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline TArray<regex::ReNode *> _Funcbuiltin_0x60_to_array_move_59084725f30dd7bb ( Context * __context__, TDim<regex::ReNode *,2> &  __a_rename_at_517 )
+{
+	TArray<regex::ReNode *> __arr_rename_at_518; das_zero(__arr_rename_at_518);
+	builtin_array_resize(das_arg<TArray<regex::ReNode *>>::pass(__arr_rename_at_518),2,8,__context__);
+	das_copy(das_cast<TDim<regex::ReNode *,2>>::cast(das_ref(__context__,__arr_rename_at_518(0,__context__))),__a_rename_at_517);
+	return /* <- */ das_auto_cast_move<TArray<regex::ReNode *>>::cast(__arr_rename_at_518);
+}
+
+inline bool _Funcbuiltin_0x60_next_160159e214cdd056 ( Context * __context__, Sequence DAS_COMMENT((uint32_t)) const  &  __it_rename_at_427, uint32_t & __value_rename_at_427 )
+{
+	return das_auto_cast<bool>::cast(builtin_iterator_iterate(__it_rename_at_427,das_auto_cast<void * const >::cast(das_ref(__context__,__value_rename_at_427)),__context__));
+}
+
+inline uint32_t re_gen_get_rep_limit_aad39a472678db9d ( Context * __context__ )
+{
+	return das_auto_cast<uint32_t>::cast(das_global<uint32_t,0x570cc75ae91fa86f>(__context__) /*re_gen_rep_limit*/);
+}
+
+inline void trace_89f6695f8909b072 ( Context * __context__, char * const  __msg_rename_at_72, int32_t __offset_rename_at_72 )
+{
+}
+
+inline void note_89f6695f8909b072 ( Context * __context__, char * const  __msg_rename_at_77, int32_t __offset_rename_at_77 )
+{
+}
+
+inline void trace_backtrack_c77fe5b3ac1a6a7c ( Context * __context__ )
+{
+}
+
+inline void trace_value_4739abdd3b0a7208 ( Context * __context__, regex::ReNode * const  __value_rename_at_86 )
+{
+}
+
+inline TVariant<16,regex::ReNode *,void *> nada_5086bd0a540f8186 ( Context * __context__ )
+{
+	return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((([&]() -> TVariant<16,regex::ReNode *,void *> {
+		TVariant<16,regex::ReNode *,void *> __mkv_95;
+		das_get_variant_field<void *,8,1>::set(__mkv_95) = nullptr;
+		return __mkv_95;
+	})()));
+}
+
+inline TVariant<16,regex::ReNode *,void *> maybe_d7a4f325999cb99b ( Context * __context__, regex::ReNode * const  __value_rename_at_97 )
+{
+	return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((([&]() -> TVariant<16,regex::ReNode *,void *> {
+		TVariant<16,regex::ReNode *,void *> __mkv_99;
+		das_get_variant_field<regex::ReNode *,8,0>::set(__mkv_99) = __value_rename_at_97;
+		return __mkv_99;
+	})()));
+}
+
+inline bool eos_dde6e11fd3802ac8 ( Context * __context__, char * const  __expr_rename_at_101, int32_t __offset_rename_at_101 )
+{
+	return das_auto_cast<bool>::cast(__offset_rename_at_101 >= builtin_string_length(__expr_rename_at_101,__context__));
+}
+
+inline int32_t at_c9bade5ff7edd57d ( Context * __context__, char * const  __expr_rename_at_104, int32_t __offset_rename_at_104 )
+{
+	return das_auto_cast<int32_t>::cast(get_character_uat(__expr_rename_at_104,__offset_rename_at_104));
+}
+
+inline int32_t next_1bd07c8c346bbbc2 ( Context * __context__, TVariant<16,regex::ReNode *,void *> const  &  __re_rename_at_119 )
+{
+	if ( !das_get_variant_field<regex::ReNode *,8,0>::is(__re_rename_at_119) )
+	{
+		builtin_stackwalk(true,true,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		builtin_throw(((char *) "expecting value"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+	return das_auto_cast<int32_t>::cast(v_extract_yi(v_cast_vec4i(das_get_variant_field<regex::ReNode *,8,0>::as(__re_rename_at_119,__context__)->at)) /*y*/);
+}
+
+inline bool is_set_empty_fb12252b2129800d ( Context * __context__, TDim<uint32_t,8> const  &  __cset_rename_at_125 )
+{
+	{
+		bool __need_loop_126 = true;
+		// x : uint aka CharSet const&
+		das_iterator<TDim<uint32_t,8> const > __x_iterator(__cset_rename_at_125);
+		uint32_t const  * __x_rename_at_126;
+		__need_loop_126 = __x_iterator.first(__context__,(__x_rename_at_126)) && __need_loop_126;
+		for ( ; __need_loop_126 ; __need_loop_126 = __x_iterator.next(__context__,(__x_rename_at_126)) )
+		{
+			if ( (*__x_rename_at_126) != 0x0u )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_126));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void set_or_char_471888d9ed78efab ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_131, int32_t __ch_rename_at_131 )
+{
+	__cset_rename_at_131((__ch_rename_at_131 >> 5),__context__) |= uint32_t(1 << (__ch_rename_at_131 & 31));
+}
+
+inline void set_or_range_a7ad44e8ef1ec07c ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_134, range __bits_rename_at_134 )
+{
+	{
+		bool __need_loop_135 = true;
+		// ch : int const
+		das_iterator<range> __ch_iterator(range(v_extract_xi(v_cast_vec4i(__bits_rename_at_134)) /*x*/,v_extract_yi(v_cast_vec4i(__bits_rename_at_134)) /*y*/ + 1));
+		int32_t __ch_rename_at_135;
+		__need_loop_135 = __ch_iterator.first(__context__,(__ch_rename_at_135)) && __need_loop_135;
+		for ( ; __need_loop_135 ; __need_loop_135 = __ch_iterator.next(__context__,(__ch_rename_at_135)) )
+		{
+			__cset_rename_at_134((__ch_rename_at_135 >> 5),__context__) |= uint32_t(1 << (__ch_rename_at_135 & 31));
+		}
+		__ch_iterator.close(__context__,(__ch_rename_at_135));
+	};
+}
+
+inline void set_invert_be791c77bc6b6a11 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_138 )
+{
+	{
+		bool __need_loop_139 = true;
+		// x : uint aka CharSet& -const
+		das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_138);
+		uint32_t * __x_rename_at_139;
+		__need_loop_139 = __x_iterator.first(__context__,(__x_rename_at_139)) && __need_loop_139;
+		for ( ; __need_loop_139 ; __need_loop_139 = __x_iterator.next(__context__,(__x_rename_at_139)) )
+		{
+			(*__x_rename_at_139) ^= 0xffffffffu;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_139));
+	};
+}
+
+inline void set_or_set_9609a9e932b32815 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_142, TDim<uint32_t,8> const  &  __eset_rename_at_142 )
+{
+	{
+		bool __need_loop_143 = true;
+		// x : uint aka CharSet& -const
+		das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_142);
+		uint32_t * __x_rename_at_143;
+		__need_loop_143 = __x_iterator.first(__context__,(__x_rename_at_143)) && __need_loop_143;
+		// y : uint aka CharSet const&
+		das_iterator<TDim<uint32_t,8> const > __y_iterator(__eset_rename_at_142);
+		uint32_t const  * __y_rename_at_143;
+		__need_loop_143 = __y_iterator.first(__context__,(__y_rename_at_143)) && __need_loop_143;
+		for ( ; __need_loop_143 ; __need_loop_143 = __x_iterator.next(__context__,(__x_rename_at_143)) && __y_iterator.next(__context__,(__y_rename_at_143)) )
+		{
+			(*__x_rename_at_143) |= (*__y_rename_at_143);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_143));
+		__y_iterator.close(__context__,(__y_rename_at_143));
+	};
+}
+
+inline void set_negative_7a1fcd94df7d5358 ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_146 )
+{
+	{
+		bool __need_loop_147 = true;
+		// x : uint aka CharSet& -const
+		das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_146);
+		uint32_t * __x_rename_at_147;
+		__need_loop_147 = __x_iterator.first(__context__,(__x_rename_at_147)) && __need_loop_147;
+		for ( ; __need_loop_147 ; __need_loop_147 = __x_iterator.next(__context__,(__x_rename_at_147)) )
+		{
+			das_copy((*__x_rename_at_147),~(*__x_rename_at_147));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_147));
+	};
+}
+
+inline void set_meta_47c27306e1ab33a ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_150, int32_t __che_rename_at_150 )
+{
+	if ( __che_rename_at_150 == 119 )
+	{
+		set_or_range_a7ad44e8ef1ec07c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_150),range(97,122));
+		set_or_range_a7ad44e8ef1ec07c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_150),range(65,90));
+		set_or_range_a7ad44e8ef1ec07c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_150),range(48,57));
+		__cset_rename_at_150(2,__context__) |= 0x80000000u;
+	} else if ( __che_rename_at_150 == 87 )
+	{
+		TDim<uint32_t,8> __eset_rename_at_157; das_zero(__eset_rename_at_157);
+		set_meta_47c27306e1ab33a(__context__,das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_157),119);
+		set_or_set_9609a9e932b32815(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_150),das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_157));
+	} else if ( __che_rename_at_150 == 115 )
+	{
+		__cset_rename_at_150(1,__context__) |= 0x1u;
+		__cset_rename_at_150(0,__context__) |= 0x200u;
+	} else if ( __che_rename_at_150 == 83 )
+	{
+		TDim<uint32_t,8> __eset_rename_at_164; das_zero(__eset_rename_at_164);
+		set_meta_47c27306e1ab33a(__context__,das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_164),115);
+		set_or_set_9609a9e932b32815(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_150),das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_164));
+	} else if ( __che_rename_at_150 == 100 )
+	{
+		set_or_range_a7ad44e8ef1ec07c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_150),range(48,57));
+	} else if ( __che_rename_at_150 == 68 )
+	{
+		TDim<uint32_t,8> __eset_rename_at_170; das_zero(__eset_rename_at_170);
+		set_meta_47c27306e1ab33a(__context__,das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_170),100);
+		set_or_set_9609a9e932b32815(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_150),das_arg<TDim<uint32_t,8>>::pass(__eset_rename_at_170));
+	} else {
+		__cset_rename_at_150((__che_rename_at_150 >> 5),__context__) |= uint32_t(1 << (__che_rename_at_150 & 31));
+	};
+}
+
+inline bool is_meta_character_24d3d25015b1373f ( Context * __context__, int32_t __ch_rename_at_179 )
+{
+	return das_auto_cast<bool>::cast(builtin_find_first_char_of(((char *) "\\+-*.()[]|^"),__ch_rename_at_179,__context__) != -1);
+}
+
+inline bool is_set_character_11f8fcca4329c870 ( Context * __context__, int32_t __ch_rename_at_182 )
+{
+	return das_auto_cast<bool>::cast(builtin_find_first_char_of(((char *) "wWsSdD"),__ch_rename_at_182,__context__) != -1);
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_char_72b6d2190a4aa86e ( Context * __context__, char * const  __expr_rename_at_186, int32_t __offset_rename_at_186 )
+{
+	if ( __offset_rename_at_186 >= builtin_string_length(__expr_rename_at_186,__context__) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		int32_t __ch_rename_at_190 = ((int32_t)get_character_uat(__expr_rename_at_186,__offset_rename_at_186));
+		if ( __ch_rename_at_190 == 92 )
+		{
+			int32_t __ech_rename_at_192 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_186,__offset_rename_at_186 + 1));
+			if ( __ech_rename_at_192 == 0 )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+			} else {
+				if ( builtin_find_first_char_of(((char *) "wWsSdD"),__ech_rename_at_192,__context__) != -1 )
+				{
+					TDim<uint32_t,8> __cset_rename_at_197; das_zero(__cset_rename_at_197);
+					set_meta_47c27306e1ab33a(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_197),__ech_rename_at_192);
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+						regex::ReNode __mks_199;
+						das_zero(__mks_199);
+						das_copy((__mks_199.op),(DAS_COMMENT(enum) regex::ReOp::Set));
+						das_copy((__mks_199.cset),(__cset_rename_at_197));
+						das_copy((__mks_199.at),(range(__offset_rename_at_186,__offset_rename_at_186 + 2)));
+						return __mks_199;
+					})()))));
+				} else {
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+						regex::ReNode __mks_200;
+						das_zero(__mks_200);
+						das_copy((__mks_200.op),(DAS_COMMENT(enum) regex::ReOp::Char));
+						das_copy((__mks_200.text),(((char *)(to_string_char(__ech_rename_at_192,__context__)))));
+						das_copy((__mks_200.textLen),(1));
+						das_copy((__mks_200.at),(range(__offset_rename_at_186,__offset_rename_at_186 + 2)));
+						return __mks_200;
+					})()))));
+				};
+			};
+		} else if ( builtin_find_first_char_of(((char *) "\\+-*.()[]|^"),__ch_rename_at_190,__context__) != -1 )
+		{
+			return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+		};
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+			regex::ReNode __mks_203;
+			das_zero(__mks_203);
+			das_copy((__mks_203.op),(DAS_COMMENT(enum) regex::ReOp::Char));
+			das_copy((__mks_203.text),(((char *)(to_string_char(__ch_rename_at_190,__context__)))));
+			das_copy((__mks_203.textLen),(1));
+			das_copy((__mks_203.at),(range(__offset_rename_at_186,__offset_rename_at_186 + 1)));
+			return __mks_203;
+		})()))));
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_set_items_e4aed5649396a9a6 ( Context * __context__, char * const  __expr_rename_at_209, int32_t __offset_rename_at_209 )
+{
+	if ( __offset_rename_at_209 >= builtin_string_length(__expr_rename_at_209,__context__) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		TDim<uint32_t,8> __cset_rename_at_213; das_zero(__cset_rename_at_213);
+		int32_t __iofs_rename_at_214 = __offset_rename_at_209;
+		while ( !(__iofs_rename_at_214 >= builtin_string_length(__expr_rename_at_209,__context__)) )
+		{
+			int32_t __ch_rename_at_216 = ((int32_t)get_character_uat(__expr_rename_at_209,__iofs_rename_at_214));
+			if ( __ch_rename_at_216 == 93 )
+			{
+				break;
+			} else if ( __ch_rename_at_216 == 92 )
+			{
+				int32_t __che_rename_at_221 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_209,__iofs_rename_at_214 + 1));
+				if ( __che_rename_at_221 == 0 )
+				{
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+				} else {
+					set_meta_47c27306e1ab33a(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_213),__che_rename_at_221);
+					__iofs_rename_at_214 += 2;
+				};
+			} else if ( (at_c9bade5ff7edd57d(__context__,__expr_rename_at_209,__iofs_rename_at_214 + 1) == 45) && (at_c9bade5ff7edd57d(__context__,__expr_rename_at_209,__iofs_rename_at_214 + 2) != 93) )
+			{
+				int32_t __che_rename_at_229 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_209,__iofs_rename_at_214 + 2));
+				if ( __che_rename_at_229 == 0 )
+				{
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+				} else if ( __ch_rename_at_216 > __che_rename_at_229 )
+				{
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+				};
+				set_or_range_a7ad44e8ef1ec07c(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_213),range(__ch_rename_at_216,__che_rename_at_229));
+				__iofs_rename_at_214 += 3;
+			} else {
+				__cset_rename_at_213((__ch_rename_at_216 >> 5),__context__) |= uint32_t(1 << (__ch_rename_at_216 & 31));
+				__iofs_rename_at_214 += 1;
+			};
+		};
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+			regex::ReNode __mks_243;
+			das_zero(__mks_243);
+			das_copy((__mks_243.op),(DAS_COMMENT(enum) regex::ReOp::Set));
+			das_copy((__mks_243.cset),(__cset_rename_at_213));
+			das_copy((__mks_243.at),(range(__offset_rename_at_209,__iofs_rename_at_214)));
+			return __mks_243;
+		})()))));
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_set_10c94f59326660bb ( Context * __context__, char * const  __expr_rename_at_248, int32_t __offset_rename_at_248 )
+{
+	if ( __offset_rename_at_248 >= builtin_string_length(__expr_rename_at_248,__context__) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		if ( get_character_uat(__expr_rename_at_248,__offset_rename_at_248) != 91 )
+		{
+			return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+		} else {
+			bool __negative_rename_at_254 = false;
+			if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_248,__offset_rename_at_248 + 1) == 94 )
+			{
+				das_copy(__negative_rename_at_254,true);
+			};
+			TVariant<16,regex::ReNode *,void *> __oset_rename_at_257 = re_set_items_e4aed5649396a9a6(__context__,__expr_rename_at_248,__negative_rename_at_254 ? das_auto_cast<int32_t>::cast((__offset_rename_at_248 + 2)) : das_auto_cast<int32_t>::cast((__offset_rename_at_248 + 1)));
+			if ( das_get_variant_field<void *,8,1>::is(__oset_rename_at_257) )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+			} else {
+				if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_248,next_1bd07c8c346bbbc2(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oset_rename_at_257))) != 93 )
+				{
+					finalize_6293242d2ef1254f(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oset_rename_at_257));
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+				} else {
+					regex::ReNode * __oval_rename_at_263 = das_get_variant_field<regex::ReNode *,8,0>::as(__oset_rename_at_257,__context__);
+					das_copy(das_swizzle_ref<int32_t,range,0>::swizzle(__oval_rename_at_263->at) /*x*/,__offset_rename_at_248);
+					++das_swizzle_ref<int32_t,range,1>::swizzle(__oval_rename_at_263->at) /*y*/;
+					das_copy(__oval_rename_at_263->op,DAS_COMMENT(enum) regex::ReOp::Set);
+					if ( __negative_rename_at_254 )
+					{
+						set_negative_7a1fcd94df7d5358(__context__,das_arg<TDim<uint32_t,8>>::pass(__oval_rename_at_263->cset));
+					};
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(__oset_rename_at_257);
+				};
+			};
+		};
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_any_8127ec932cbb51d ( Context * __context__, char * const  __expr_rename_at_273, int32_t __offset_rename_at_273 )
+{
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_276_15_32;
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_278_15_48;
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_279_11_80;
+	return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((__offset_rename_at_273 >= builtin_string_length(__expr_rename_at_273,__context__)) ? das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_276_15_32 = (nada_5086bd0a540f8186(__context__)))) : das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(((get_character_uat(__expr_rename_at_273,__offset_rename_at_273) == 46) ? das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_278_15_48 = (maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+		regex::ReNode __mks_278;
+		das_zero(__mks_278);
+		das_copy((__mks_278.op),(DAS_COMMENT(enum) regex::ReOp::Any));
+		das_copy((__mks_278.at),(range(__offset_rename_at_273,__offset_rename_at_273 + 1)));
+		return __mks_278;
+	})())))))) : das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_279_11_80 = (nada_5086bd0a540f8186(__context__)))))));
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_eos_62bbb15403a7af8a ( Context * __context__, char * const  __expr_rename_at_282, int32_t __offset_rename_at_282 )
+{
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_285_15_32;
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_287_15_48;
+	TVariant<16,regex::ReNode *,void *> _temp_make_local_288_11_80;
+	return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((__offset_rename_at_282 >= builtin_string_length(__expr_rename_at_282,__context__)) ? das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_285_15_32 = (nada_5086bd0a540f8186(__context__)))) : das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(((get_character_uat(__expr_rename_at_282,__offset_rename_at_282) == 36) ? das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_287_15_48 = (maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+		regex::ReNode __mks_287;
+		das_zero(__mks_287);
+		das_copy((__mks_287.op),(DAS_COMMENT(enum) regex::ReOp::Eos));
+		das_copy((__mks_287.at),(range(__offset_rename_at_282,__offset_rename_at_282 + 1)));
+		return __mks_287;
+	})())))))) : das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_288_11_80 = (nada_5086bd0a540f8186(__context__)))))));
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_group_e305de97e880ce49 ( Context * __context__, char * const  __expr_rename_at_291, int32_t __offset_rename_at_291 )
+{
+	if ( __offset_rename_at_291 >= builtin_string_length(__expr_rename_at_291,__context__) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		if ( get_character_uat(__expr_rename_at_291,__offset_rename_at_291) != 40 )
+		{
+			return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+		} else {
+			TVariant<16,regex::ReNode *,void *> __ore_rename_at_297 = re_re_806d249d156e8cc6(__context__,__expr_rename_at_291,__offset_rename_at_291 + 1);
+			if ( das_get_variant_field<void *,8,1>::is(__ore_rename_at_297) )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+			} else {
+				if ( at_c9bade5ff7edd57d(__context__,__expr_rename_at_291,next_1bd07c8c346bbbc2(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__ore_rename_at_297))) != 41 )
+				{
+					finalize_6293242d2ef1254f(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__ore_rename_at_297));
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+				} else {
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+						regex::ReNode __mks_303;
+						das_zero(__mks_303);
+						das_copy((__mks_303.op),(DAS_COMMENT(enum) regex::ReOp::Group));
+						das_copy((__mks_303.subexpr),(das_get_variant_field<regex::ReNode *,8,0>::as(__ore_rename_at_297,__context__)));
+						das_copy((__mks_303.at),(range(__offset_rename_at_291,next_1bd07c8c346bbbc2(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__ore_rename_at_297)) + 1)));
+						return __mks_303;
+					})()))));
+				};
+			};
+		};
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_elementary_7fb0bc5f471be253 ( Context * __context__, char * const  __expr_rename_at_306, int32_t __offset_rename_at_306 )
+{
+	if ( __offset_rename_at_306 >= builtin_string_length(__expr_rename_at_306,__context__) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		TVariant<16,regex::ReNode *,void *> __ogr_rename_at_310 = re_group_e305de97e880ce49(__context__,__expr_rename_at_306,__offset_rename_at_306);
+		if ( das_get_variant_field<regex::ReNode *,8,0>::is(__ogr_rename_at_310) )
+		{
+			return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(__ogr_rename_at_310);
+		} else {
+			TVariant<16,regex::ReNode *,void *> __oany_rename_at_313 = re_any_8127ec932cbb51d(__context__,__expr_rename_at_306,__offset_rename_at_306);
+			if ( das_get_variant_field<regex::ReNode *,8,0>::is(__oany_rename_at_313) )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(__oany_rename_at_313);
+			} else {
+				TVariant<16,regex::ReNode *,void *> __oeos_rename_at_316 = re_eos_62bbb15403a7af8a(__context__,__expr_rename_at_306,__offset_rename_at_306);
+				if ( das_get_variant_field<regex::ReNode *,8,0>::is(__oeos_rename_at_316) )
+				{
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(__oeos_rename_at_316);
+				} else {
+					TVariant<16,regex::ReNode *,void *> __oset_rename_at_319 = re_set_10c94f59326660bb(__context__,__expr_rename_at_306,__offset_rename_at_306);
+					if ( das_get_variant_field<regex::ReNode *,8,0>::is(__oset_rename_at_319) )
+					{
+						return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(__oset_rename_at_319);
+					} else {
+						TVariant<16,regex::ReNode *,void *> _temp_make_local_325_11_112;
+						TVariant<16,regex::ReNode *,void *> __ochr_rename_at_322 = re_char_72b6d2190a4aa86e(__context__,__expr_rename_at_306,__offset_rename_at_306);
+						return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(das_get_variant_field<regex::ReNode *,8,0>::is(__ochr_rename_at_322) ? das_auto_cast_ref<TVariant<16,regex::ReNode *,void *> &>::cast(__ochr_rename_at_322) : das_auto_cast_ref<TVariant<16,regex::ReNode *,void *> &>::cast((_temp_make_local_325_11_112 = (nada_5086bd0a540f8186(__context__)))));
+					};
+				};
+			};
+		};
+	};
+}
+
+inline regex::ReNode * mk_concat_4dcd600b481f43c0 ( Context * __context__, regex::ReNode * __left_rename_at_327, regex::ReNode * __right_rename_at_327 )
+{
+	if ( __left_rename_at_327 == nullptr )
+	{
+		return das_auto_cast<regex::ReNode *>::cast(__right_rename_at_327);
+	} else if ( (__left_rename_at_327->op == DAS_COMMENT(enum) regex::ReOp::Char) && (__right_rename_at_327->op == DAS_COMMENT(enum) regex::ReOp::Char) )
+	{
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__left_rename_at_327->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_327->at) /*y*/);
+		SimPolicy<char *>::SetAdd((char *)&(__left_rename_at_327->text),cast<char *>::from(__right_rename_at_327->text),*__context__,nullptr);
+		__left_rename_at_327->textLen += __right_rename_at_327->textLen;
+		finalize_46f88278c98091eb(__context__,__right_rename_at_327);
+		return das_auto_cast<regex::ReNode *>::cast(__left_rename_at_327);
+	} else if ( ((__left_rename_at_327->op == DAS_COMMENT(enum) regex::ReOp::Concat) && (__left_rename_at_327->right->op == DAS_COMMENT(enum) regex::ReOp::Char)) && (__right_rename_at_327->op == DAS_COMMENT(enum) regex::ReOp::Char) )
+	{
+		regex::ReNode * __lor_rename_at_340 = __left_rename_at_327->right;
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__left_rename_at_327->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_327->at) /*y*/);
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__lor_rename_at_340->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_327->at) /*y*/);
+		SimPolicy<char *>::SetAdd((char *)&(__lor_rename_at_340->text),cast<char *>::from(__right_rename_at_327->text),*__context__,nullptr);
+		__lor_rename_at_340->textLen += __right_rename_at_327->textLen;
+		finalize_46f88278c98091eb(__context__,__right_rename_at_327);
+		return das_auto_cast<regex::ReNode *>::cast(__left_rename_at_327);
+	} else {
+		return das_auto_cast<regex::ReNode *>::cast(das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+			regex::ReNode __mks_349;
+			das_zero(__mks_349);
+			das_copy((__mks_349.op),(DAS_COMMENT(enum) regex::ReOp::Concat));
+			das_copy((__mks_349.left),(__left_rename_at_327));
+			das_copy((__mks_349.right),(__right_rename_at_327));
+			das_copy((__mks_349.at),(range(v_extract_xi(v_cast_vec4i(__left_rename_at_327->at)) /*x*/,v_extract_yi(v_cast_vec4i(__right_rename_at_327->at)) /*y*/)));
+			return __mks_349;
+		})())));
+	};
+}
+
+inline regex::ReNode * mk_union_53d62d01f1c4cdf7 ( Context * __context__, regex::ReNode * __left_rename_at_351, regex::ReNode * __right_rename_at_351 )
+{
+	if ( __left_rename_at_351->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		das_copy(das_swizzle_ref<int32_t,range,1>::swizzle(__left_rename_at_351->at) /*y*/,das_swizzle_ref<int32_t,range,1>::swizzle(__right_rename_at_351->at) /*y*/);
+		if ( __right_rename_at_351->op == DAS_COMMENT(enum) regex::ReOp::Union )
+		{
+			{
+				bool __need_loop_355 = true;
+				// x : regex::ReNode?&
+				das_iterator<TArray<regex::ReNode *>> __x_iterator(__right_rename_at_351->all);
+				regex::ReNode * * __x_rename_at_355;
+				__need_loop_355 = __x_iterator.first(__context__,(__x_rename_at_355)) && __need_loop_355;
+				for ( ; __need_loop_355 ; __need_loop_355 = __x_iterator.next(__context__,(__x_rename_at_355)) )
+				{
+					_Funcbuiltin_0x60_push_5dc212b561cc93c2(__context__,das_arg<TArray<regex::ReNode *>>::pass(__left_rename_at_351->all),(*__x_rename_at_355));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_355));
+			};
+			finalize_46f88278c98091eb(__context__,__right_rename_at_351);
+		} else {
+			_Funcbuiltin_0x60_push_5dc212b561cc93c2(__context__,das_arg<TArray<regex::ReNode *>>::pass(__left_rename_at_351->all),__right_rename_at_351);
+		};
+		return das_auto_cast<regex::ReNode *>::cast(__left_rename_at_351);
+	} else if ( __right_rename_at_351->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		das_copy(das_swizzle_ref<int32_t,range,0>::swizzle(__right_rename_at_351->at) /*x*/,das_swizzle_ref<int32_t,range,0>::swizzle(__left_rename_at_351->at) /*x*/);
+		_Funcbuiltin_0x60_push_5dc212b561cc93c2(__context__,das_arg<TArray<regex::ReNode *>>::pass(__right_rename_at_351->all),__left_rename_at_351);
+		return das_auto_cast<regex::ReNode *>::cast(__right_rename_at_351);
+	} else {
+		TDim<regex::ReNode *,2> _temp_make_local_367_50_48;
+		return das_auto_cast<regex::ReNode *>::cast(das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+			regex::ReNode __mks_367;
+			das_zero(__mks_367);
+			das_copy((__mks_367.op),(DAS_COMMENT(enum) regex::ReOp::Union));
+			das_move((__mks_367.all),(_Funcbuiltin_0x60_to_array_move_59084725f30dd7bb(__context__,das_arg<TDim<regex::ReNode *,2>>::pass((([&]() -> TDim<regex::ReNode *,2>& {
+				_temp_make_local_367_50_48(0,__context__) = __left_rename_at_351;
+				_temp_make_local_367_50_48(1,__context__) = __right_rename_at_351;
+				return _temp_make_local_367_50_48;
+			})())))));
+			das_copy((__mks_367.at),(range(v_extract_xi(v_cast_vec4i(__left_rename_at_351->at)) /*x*/,v_extract_yi(v_cast_vec4i(__right_rename_at_351->at)) /*y*/)));
+			return __mks_367;
+		})())));
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_re_806d249d156e8cc6 ( Context * __context__, char * const  __expr_rename_at_373, int32_t __offset_rename_at_373 )
+{
+	if ( __offset_rename_at_373 >= builtin_string_length(__expr_rename_at_373,__context__) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		int32_t __cofs_rename_at_377 = __offset_rename_at_373;
+		regex::ReNode * __last_rename_at_378 = 0;
+		while ( !(__cofs_rename_at_377 >= builtin_string_length(__expr_rename_at_373,__context__)) )
+		{
+			if ( get_character_uat(__expr_rename_at_373,__cofs_rename_at_377) == 124 )
+			{
+				if ( __last_rename_at_378 == nullptr )
+				{
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+				} else {
+					TVariant<16,regex::ReNode *,void *> __oright_rename_at_384 = re_re_806d249d156e8cc6(__context__,__expr_rename_at_373,__cofs_rename_at_377 + 1);
+					if ( das_get_variant_field<void *,8,1>::is(__oright_rename_at_384) )
+					{
+						return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+					} else {
+						das_copy(__last_rename_at_378,mk_union_53d62d01f1c4cdf7(__context__,__last_rename_at_378,das_get_variant_field<regex::ReNode *,8,0>::as(__oright_rename_at_384,__context__)));
+						das_copy(__cofs_rename_at_377,das_swizzle_ref<int32_t,range,1>::swizzle(__last_rename_at_378->at) /*y*/);
+					};
+				};
+			} else {
+				TVariant<16,regex::ReNode *,void *> __onext_rename_at_391 = re_basic_23562b17fe86ae37(__context__,__expr_rename_at_373,__cofs_rename_at_377);
+				if ( das_get_variant_field<void *,8,1>::is(__onext_rename_at_391) )
+				{
+					TVariant<16,regex::ReNode *,void *> _temp_make_local_393_35_80;
+					TVariant<16,regex::ReNode *,void *> _temp_make_local_393_44_96;
+					return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((__last_rename_at_378 == nullptr) ? das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_393_35_80 = (nada_5086bd0a540f8186(__context__)))) : das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast((_temp_make_local_393_44_96 = (maybe_d7a4f325999cb99b(__context__,__last_rename_at_378)))));
+				} else {
+					das_copy(__last_rename_at_378,mk_concat_4dcd600b481f43c0(__context__,__last_rename_at_378,das_get_variant_field<regex::ReNode *,8,0>::as(__onext_rename_at_391,__context__)));
+					das_copy(__cofs_rename_at_377,das_swizzle_ref<int32_t,range,1>::swizzle(__last_rename_at_378->at) /*y*/);
+				};
+			};
+		};
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_d7a4f325999cb99b(__context__,__last_rename_at_378));
+	};
+}
+
+inline TVariant<16,regex::ReNode *,void *> re_basic_23562b17fe86ae37 ( Context * __context__, char * const  __expr_rename_at_401, int32_t __offset_rename_at_401 )
+{
+	if ( __offset_rename_at_401 >= builtin_string_length(__expr_rename_at_401,__context__) )
+	{
+		return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+	} else {
+		TVariant<16,regex::ReNode *,void *> __oelem_rename_at_405 = re_elementary_7fb0bc5f471be253(__context__,__expr_rename_at_401,__offset_rename_at_401);
+		if ( das_get_variant_field<void *,8,1>::is(__oelem_rename_at_405) )
+		{
+			return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(nada_5086bd0a540f8186(__context__));
+		} else {
+			int32_t __ch_rename_at_408 = ((int32_t)at_c9bade5ff7edd57d(__context__,__expr_rename_at_401,next_1bd07c8c346bbbc2(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oelem_rename_at_405))));
+			if ( __ch_rename_at_408 == 42 )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+					regex::ReNode __mks_410;
+					das_zero(__mks_410);
+					das_copy((__mks_410.op),(DAS_COMMENT(enum) regex::ReOp::Star));
+					das_copy((__mks_410.subexpr),(das_get_variant_field<regex::ReNode *,8,0>::as(__oelem_rename_at_405,__context__)));
+					das_copy((__mks_410.at),(range(__offset_rename_at_401,next_1bd07c8c346bbbc2(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oelem_rename_at_405)) + 1)));
+					return __mks_410;
+				})()))));
+			} else if ( __ch_rename_at_408 == 43 )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+					regex::ReNode __mks_412;
+					das_zero(__mks_412);
+					das_copy((__mks_412.op),(DAS_COMMENT(enum) regex::ReOp::Plus));
+					das_copy((__mks_412.subexpr),(das_get_variant_field<regex::ReNode *,8,0>::as(__oelem_rename_at_405,__context__)));
+					das_copy((__mks_412.at),(range(__offset_rename_at_401,next_1bd07c8c346bbbc2(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oelem_rename_at_405)) + 1)));
+					return __mks_412;
+				})()))));
+			} else if ( __ch_rename_at_408 == 63 )
+			{
+				return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(maybe_d7a4f325999cb99b(__context__,das_ascend<regex::ReNode,regex::ReNode>::make(__context__,nullptr,(([&]() -> regex::ReNode {
+					regex::ReNode __mks_414;
+					das_zero(__mks_414);
+					das_copy((__mks_414.op),(DAS_COMMENT(enum) regex::ReOp::Question));
+					das_copy((__mks_414.subexpr),(das_get_variant_field<regex::ReNode *,8,0>::as(__oelem_rename_at_405,__context__)));
+					das_copy((__mks_414.at),(range(__offset_rename_at_401,next_1bd07c8c346bbbc2(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__oelem_rename_at_405)) + 1)));
+					return __mks_414;
+				})()))));
+			};
+			return das_auto_cast_ref<TVariant<16,regex::ReNode *,void *>>::cast(__oelem_rename_at_405);
+		};
+	};
+}
+
+inline regex::ReNode * re_parse_3d6f9a305b851160 ( Context * __context__, char * const  __expr_rename_at_417 )
+{
+	TVariant<16,regex::ReNode *,void *> __ore_rename_at_418 = re_re_806d249d156e8cc6(__context__,__expr_rename_at_417,0);
+	if ( das_get_variant_field<void *,8,1>::is(__ore_rename_at_418) )
+	{
+		return das_auto_cast<regex::ReNode *>::cast(nullptr);
+	} else {
+		int32_t __at_rename_at_421 = ((int32_t)next_1bd07c8c346bbbc2(__context__,das_arg<TVariant<16,regex::ReNode *,void *>>::pass(__ore_rename_at_418)));
+		return das_auto_cast<regex::ReNode *>::cast((__at_rename_at_421 != builtin_string_length(__expr_rename_at_417,__context__)) ? das_auto_cast<void * const >::cast(nullptr) : das_auto_cast<void * const >::cast(das_get_variant_field<regex::ReNode *,8,0>::as(__ore_rename_at_418,__context__)));
+	};
+}
+
+inline void visit_top_down_28dd8379641934af ( Context * __context__, regex::ReNode * __node_rename_at_427, Block DAS_COMMENT((void,regex::ReNode *)) const  &  __blk_rename_at_427 )
+{
+	das_invoke<void>::invoke<regex::ReNode *>(__context__,nullptr,__blk_rename_at_427,__node_rename_at_427);
+	{
+		bool __need_loop_429 = true;
+		// x : regex::ReNode?&
+		das_iterator<TArray<regex::ReNode *>> __x_iterator(__node_rename_at_427->all);
+		regex::ReNode * * __x_rename_at_429;
+		__need_loop_429 = __x_iterator.first(__context__,(__x_rename_at_429)) && __need_loop_429;
+		for ( ; __need_loop_429 ; __need_loop_429 = __x_iterator.next(__context__,(__x_rename_at_429)) )
+		{
+			visit_top_down_28dd8379641934af(__context__,(*__x_rename_at_429),__blk_rename_at_427);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_429));
+	};
+	if ( __node_rename_at_427->subexpr != nullptr )
+	{
+		visit_top_down_28dd8379641934af(__context__,__node_rename_at_427->subexpr,__blk_rename_at_427);
+	};
+	if ( __node_rename_at_427->left != nullptr )
+	{
+		visit_top_down_28dd8379641934af(__context__,__node_rename_at_427->left,__blk_rename_at_427);
+	};
+	if ( __node_rename_at_427->right != nullptr )
+	{
+		visit_top_down_28dd8379641934af(__context__,__node_rename_at_427->right,__blk_rename_at_427);
+	};
+}
+
+inline void re_assign_next_40df54bb93432757 ( Context * __context__, regex::Regex &  __re_rename_at_438 ) { das_stack_prologue __prologue(__context__,128,"re_assign_next " DAS_FILE_LINE);
+{
+	int32_t __id_rename_at_439 = 0;
+	visit_top_down_28dd8379641934af(__context__,__re_rename_at_438.root,das_make_block<void,regex::ReNode *>(__context__,96,0,&__func_info__87bf23f355201ee1,[&](regex::ReNode * __node_rename_at_440) -> void{
+		das_copy(__node_rename_at_440->id,__id_rename_at_439++);
+		if ( __node_rename_at_440->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+		{
+			das_copy(__node_rename_at_440->left->next,__node_rename_at_440->right);
+			das_copy(__node_rename_at_440->right->next,__node_rename_at_440->next);
+		} else if ( __node_rename_at_440->op == DAS_COMMENT(enum) regex::ReOp::Group )
+		{
+			das_copy(__node_rename_at_440->subexpr->next,__node_rename_at_440->next);
+		} else if ( __node_rename_at_440->op == DAS_COMMENT(enum) regex::ReOp::Union )
+		{
+			{
+				bool __need_loop_448 = true;
+				// sub : regex::ReNode?&
+				das_iterator<TArray<regex::ReNode *>> __sub_iterator(__node_rename_at_440->all);
+				regex::ReNode * * __sub_rename_at_448;
+				__need_loop_448 = __sub_iterator.first(__context__,(__sub_rename_at_448)) && __need_loop_448;
+				for ( ; __need_loop_448 ; __need_loop_448 = __sub_iterator.next(__context__,(__sub_rename_at_448)) )
+				{
+					das_copy((*__sub_rename_at_448)->next,__node_rename_at_440->next);
+				}
+				__sub_iterator.close(__context__,(__sub_rename_at_448));
+			};
+		};
+	}));
+}}
+
+inline void re_assign_groups_fb8b490fd90b06b1 ( Context * __context__, regex::Regex &  __re_rename_at_451 ) { das_stack_prologue __prologue(__context__,128,"re_assign_groups " DAS_FILE_LINE);
+{
+	TTuple<16,range,char *> _temp_make_local_452_27_32;
+	_Funcbuiltin_0x60_push_bd6055bce97bf09e(__context__,das_arg<TArray<TTuple<16,range,char *>>>::pass(__re_rename_at_451.groups),das_arg<TTuple<16,range,char *>>::pass((([&]() -> TTuple<16,range,char *>& {
+		das_get_tuple_field<range,0>::get(_temp_make_local_452_27_32) = range(0,0);
+		das_get_tuple_field<char *,8>::get(_temp_make_local_452_27_32) = nullptr;
+		return _temp_make_local_452_27_32;
+	})())));
+	visit_top_down_28dd8379641934af(__context__,__re_rename_at_451.root,das_make_block<void,regex::ReNode *>(__context__,80,0,&__func_info__87bf23f355201ee1,[&](regex::ReNode * __node_rename_at_453) -> void{
+		if ( __node_rename_at_453->op == DAS_COMMENT(enum) regex::ReOp::Group )
+		{
+			TTuple<16,range,char *> _temp_make_local_457_35_112;
+			int32_t __index_rename_at_455 = ((int32_t)builtin_array_size(das_arg<TArray<TTuple<16,range,char *>>>::pass(__re_rename_at_451.groups)));
+			das_copy(__node_rename_at_453->index,__index_rename_at_455);
+			_Funcbuiltin_0x60_push_bd6055bce97bf09e(__context__,das_arg<TArray<TTuple<16,range,char *>>>::pass(__re_rename_at_451.groups),das_arg<TTuple<16,range,char *>>::pass((([&]() -> TTuple<16,range,char *>& {
+				das_get_tuple_field<range,0>::get(_temp_make_local_457_35_112) = range(0,0);
+				das_get_tuple_field<char *,8>::get(_temp_make_local_457_35_112) = das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<int32_t>::from(__index_rename_at_455)));
+				return _temp_make_local_457_35_112;
+			})())));
+		};
+	}));
+}}
+
+inline void re_assign_match_functions_b0713981805262da ( Context * __context__, regex::Regex &  __re_rename_at_463 ) { das_stack_prologue __prologue(__context__,96,"re_assign_match_functions " DAS_FILE_LINE);
+{
+	visit_top_down_28dd8379641934af(__context__,__re_rename_at_463.root,das_make_block<void,regex::ReNode *>(__context__,80,0,&__func_info__87bf23f355201ee1,[&](regex::ReNode * __node_rename_at_464) -> void{
+		if ( __node_rename_at_464->op == DAS_COMMENT(enum) regex::ReOp::Char )
+		{
+			if ( __node_rename_at_464->textLen == 1 )
+			{
+				das_copy(__node_rename_at_464->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_single_char S<Regex> 1<S<ReNode>>? C1<u8>?*/ 5417525099520759799u)));
+			} else {
+				das_copy(__node_rename_at_464->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_char S<Regex> 1<S<ReNode>>? C1<u8>?*/ 8813790171797523608u)));
+			};
+			das_copy(__node_rename_at_464->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_char 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 8046241476679676768u)));
+		} else if ( __node_rename_at_464->op == DAS_COMMENT(enum) regex::ReOp::Union )
+		{
+			das_copy(__node_rename_at_464->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_union S<Regex> 1<S<ReNode>>? C1<u8>?*/ 1567949845072352365u)));
+			das_copy(__node_rename_at_464->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_union 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 7992248383695919577u)));
+		} else if ( __node_rename_at_464->op == DAS_COMMENT(enum) regex::ReOp::Set )
+		{
+			das_copy(__node_rename_at_464->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_set S<Regex> 1<S<ReNode>>? C1<u8>?*/ 2505824351754387524u)));
+			das_copy(__node_rename_at_464->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_set 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 2691984598421217298u)));
+		} else if ( __node_rename_at_464->op == DAS_COMMENT(enum) regex::ReOp::Any )
+		{
+			das_copy(__node_rename_at_464->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_any S<Regex> 1<S<ReNode>>? C1<u8>?*/ 17681010453701492986u)));
+			das_copy(__node_rename_at_464->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_any 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 8550514668015468720u)));
+		} else if ( __node_rename_at_464->op == DAS_COMMENT(enum) regex::ReOp::Eos )
+		{
+			das_copy(__node_rename_at_464->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_eos S<Regex> 1<S<ReNode>>? C1<u8>?*/ 9837147356575386631u)));
+			das_copy(__node_rename_at_464->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_eos 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 15183995938901420027u)));
+		} else if ( __node_rename_at_464->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+		{
+			das_copy(__node_rename_at_464->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_concat S<Regex> 1<S<ReNode>>? C1<u8>?*/ 10135892173037495604u)));
+			das_copy(__node_rename_at_464->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_concat 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 595739048345671168u)));
+		} else if ( __node_rename_at_464->op == DAS_COMMENT(enum) regex::ReOp::Plus )
+		{
+			if ( __node_rename_at_464->subexpr->op == DAS_COMMENT(enum) regex::ReOp::Set )
+			{
+				das_copy(__node_rename_at_464->cset,__node_rename_at_464->subexpr->cset);
+				das_copy(__node_rename_at_464->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_plus_set S<Regex> 1<S<ReNode>>? C1<u8>?*/ 3556589414834265461u)));
+			} else {
+				das_copy(__node_rename_at_464->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_plus S<Regex> 1<S<ReNode>>? C1<u8>?*/ 10809835202146601688u)));
+			};
+			das_copy(__node_rename_at_464->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_plus S<Regex> 1<S<ReNode>>? C1<u8>?*/ 10809835202146601688u)));
+			das_copy(__node_rename_at_464->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_plus 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 6368984693552296152u)));
+		} else if ( __node_rename_at_464->op == DAS_COMMENT(enum) regex::ReOp::Star )
+		{
+			das_copy(__node_rename_at_464->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_star S<Regex> 1<S<ReNode>>? C1<u8>?*/ 16602614288544775340u)));
+			das_copy(__node_rename_at_464->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_star 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 7088245411573916908u)));
+		} else if ( __node_rename_at_464->op == DAS_COMMENT(enum) regex::ReOp::Question )
+		{
+			das_copy(__node_rename_at_464->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_question S<Regex> 1<S<ReNode>>? C1<u8>?*/ 15172342848343956220u)));
+			das_copy(__node_rename_at_464->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_question 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 11766828063523245032u)));
+		} else if ( __node_rename_at_464->op == DAS_COMMENT(enum) regex::ReOp::Group )
+		{
+			das_copy(__node_rename_at_464->fun2,Func(__context__->fnByMangledName(/*@regex::re_match2_group S<Regex> 1<S<ReNode>>? C1<u8>?*/ 111822258571238289u)));
+			das_copy(__node_rename_at_464->gen2,Func(__context__->fnByMangledName(/*@regex::re_gen2_group 1<S<ReNode>>? Y<ReGenRandom>1<u>G H<strings::StringBuilderWriter>*/ 5538577211413169553u)));
+		} else {
+			builtin_throw(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_2, cast<char * const >::from(((char *) "unsupported ")), cast<DAS_COMMENT(enum) regex::ReOp>::from(__node_rename_at_464->op))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		};
+	}));
+}}
+
+inline uint8_t * re_match2_single_char_ec4bd67a88d6c383 ( Context * __context__, regex::Regex &  __regex_rename_at_507, regex::ReNode * __node_rename_at_507, uint8_t * const  __str_rename_at_507 )
+{
+	if ( get_character_uat(__node_rename_at_507->text,0) != int32_t((*(__str_rename_at_507))) )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __tail_rename_at_513 = das_ptr_add(__str_rename_at_507,1,1);
+		das_copy(__node_rename_at_507->tail,__tail_rename_at_513);
+		regex::ReNode * __node2_rename_at_515 = __node_rename_at_507->next;
+		return das_auto_cast<uint8_t *>::cast((__node2_rename_at_515 != nullptr) ? das_auto_cast<uint8_t *>::cast(das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__node2_rename_at_515->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_507),__node2_rename_at_515,__tail_rename_at_513)) : das_auto_cast<uint8_t *>::cast(__tail_rename_at_513));
+	};
+}
+
+inline uint8_t * re_match2_char_e7712649ef04ae7d ( Context * __context__, regex::Regex &  __regex_rename_at_522, regex::ReNode * __node_rename_at_522, uint8_t * const  __str_rename_at_522 )
+{
+	if ( das_memcmp(das_auto_cast<void * const >::cast(das_cast<uint8_t *>::cast(__node_rename_at_522->text)),das_auto_cast<void * const >::cast(__str_rename_at_522),__node_rename_at_522->textLen) != 0 )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __tail_rename_at_528 = das_ptr_add(__str_rename_at_522,__node_rename_at_522->textLen,1);
+		das_copy(__node_rename_at_522->tail,__tail_rename_at_528);
+		regex::ReNode * __node2_rename_at_530 = __node_rename_at_522->next;
+		return das_auto_cast<uint8_t *>::cast((__node2_rename_at_530 != nullptr) ? das_auto_cast<uint8_t *>::cast(das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__node2_rename_at_530->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_522),__node2_rename_at_530,__tail_rename_at_528)) : das_auto_cast<uint8_t *>::cast(__tail_rename_at_528));
+	};
+}
+
+inline uint8_t * re_match2_union_29c921f92bb6c013 ( Context * __context__, regex::Regex &  __regex_rename_at_539, regex::ReNode * __node_rename_at_539, uint8_t * const  __str_rename_at_539 )
+{
+	{
+		bool __need_loop_542 = true;
+		// sub : regex::ReNode?&
+		das_iterator<TArray<regex::ReNode *>> __sub_iterator(__node_rename_at_539->all);
+		regex::ReNode * * __sub_rename_at_542;
+		__need_loop_542 = __sub_iterator.first(__context__,(__sub_rename_at_542)) && __need_loop_542;
+		for ( ; __need_loop_542 ; __need_loop_542 = __sub_iterator.next(__context__,(__sub_rename_at_542)) )
+		{
+			uint8_t * __osub_rename_at_543 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t * const >(__context__,nullptr,(*__sub_rename_at_542)->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_539),(*__sub_rename_at_542),__str_rename_at_539));
+			if ( __osub_rename_at_543 != nullptr )
+			{
+				das_copy(__node_rename_at_539->tail,(*__sub_rename_at_542)->tail);
+				return das_auto_cast<uint8_t *>::cast(__osub_rename_at_543);
+			};
+		}
+		__sub_iterator.close(__context__,(__sub_rename_at_542));
+	};
+	return das_auto_cast<uint8_t *>::cast(nullptr);
+}
+
+inline uint8_t * re_match2_set_a7d14982d3d94062 ( Context * __context__, regex::Regex &  __regex_rename_at_550, regex::ReNode * __node_rename_at_550, uint8_t * const  __str_rename_at_550 )
+{
+	if ( !is_char_in_set(int32_t((*(__str_rename_at_550))),das_arg<TDim<uint32_t,8>>::pass(__node_rename_at_550->cset),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __tail_rename_at_556 = das_ptr_add(__str_rename_at_550,1,1);
+		das_copy(__node_rename_at_550->tail,__tail_rename_at_556);
+		regex::ReNode * __node2_rename_at_558 = __node_rename_at_550->next;
+		return das_auto_cast<uint8_t *>::cast((__node2_rename_at_558 != nullptr) ? das_auto_cast<uint8_t *>::cast(das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__node2_rename_at_558->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_550),__node2_rename_at_558,__tail_rename_at_556)) : das_auto_cast<uint8_t *>::cast(__tail_rename_at_556));
+	};
+}
+
+inline uint8_t * re_match2_any_145e1cb203d4af15 ( Context * __context__, regex::Regex &  __regex_rename_at_565, regex::ReNode * __node_rename_at_565, uint8_t * const  __str_rename_at_565 )
+{
+	if ( int32_t((*(__str_rename_at_565))) == 0 )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __tail_rename_at_571 = das_ptr_add(__str_rename_at_565,1,1);
+		das_copy(__node_rename_at_565->tail,__tail_rename_at_571);
+		regex::ReNode * __node2_rename_at_573 = __node_rename_at_565->next;
+		return das_auto_cast<uint8_t *>::cast((__node2_rename_at_573 != nullptr) ? das_auto_cast<uint8_t *>::cast(das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__node2_rename_at_573->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_565),__node2_rename_at_573,__tail_rename_at_571)) : das_auto_cast<uint8_t *>::cast(__tail_rename_at_571));
+	};
+}
+
+inline uint8_t * re_match2_concat_aa5a3133a76ae77 ( Context * __context__, regex::Regex &  __regex_rename_at_580, regex::ReNode * __node_rename_at_580, uint8_t * const  __str_rename_at_580 )
+{
+	regex::ReNode * __left_rename_at_583 = __node_rename_at_580->left;
+	uint8_t * __oleft_rename_at_584 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t * const >(__context__,nullptr,__left_rename_at_583->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_580),__left_rename_at_583,__str_rename_at_580));
+	if ( __oleft_rename_at_584 == nullptr )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		das_copy(__node_rename_at_580->tail,__node_rename_at_580->right->tail);
+		return das_auto_cast<uint8_t *>::cast(__oleft_rename_at_584);
+	};
+}
+
+inline uint8_t * re_match2_eos_e54e018f6fdc2874 ( Context * __context__, regex::Regex &  __regex_rename_at_591, regex::ReNode * __node_rename_at_591, uint8_t * const  __str_rename_at_591 )
+{
+	if ( int32_t((*(__str_rename_at_591))) != 0 )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		das_copy(__node_rename_at_591->tail,__str_rename_at_591);
+		regex::ReNode * __node2_rename_at_597 = __node_rename_at_591->next;
+		return das_auto_cast<uint8_t *>::cast((__node2_rename_at_597 != nullptr) ? das_auto_cast<uint8_t *>::cast(das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t * const >(__context__,nullptr,__node2_rename_at_597->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_591),__node2_rename_at_597,__str_rename_at_591)) : das_auto_cast<uint8_t *>::cast(__str_rename_at_591));
+	};
+}
+
+inline uint8_t * re_match2_question_c6073fc7d021f681 ( Context * __context__, regex::Regex &  __regex_rename_at_604, regex::ReNode * __node_rename_at_604, uint8_t * const  __str_rename_at_604 )
+{
+	regex::ReNode * __nsub_rename_at_607 = __node_rename_at_604->subexpr;
+	uint8_t * __tail_rename_at_608 = das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t * const >(__context__,nullptr,__nsub_rename_at_607->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_604),__nsub_rename_at_607,__str_rename_at_604);
+	if ( __tail_rename_at_608 == nullptr )
+	{
+		das_copy(__tail_rename_at_608,__str_rename_at_604);
+	};
+	das_copy(__node_rename_at_604->tail,__tail_rename_at_608);
+	regex::ReNode * __node2_rename_at_612 = __node_rename_at_604->next;
+	return das_auto_cast<uint8_t *>::cast((__node2_rename_at_612 != nullptr) ? das_auto_cast<uint8_t *>::cast(das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__node2_rename_at_612->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_604),__node2_rename_at_612,__tail_rename_at_608)) : das_auto_cast<uint8_t *>::cast(__tail_rename_at_608));
+}
+
+inline uint8_t * re_match2_plus_6caa18e9465405bd ( Context * __context__, regex::Regex &  __regex_rename_at_619, regex::ReNode * __node_rename_at_619, uint8_t * const  __str_rename_at_619 )
+{
+	regex::ReNode * __nsub_rename_at_622 = __node_rename_at_619->subexpr;
+	uint8_t * __osym_rename_at_623 = das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t * const >(__context__,nullptr,__nsub_rename_at_622->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_619),__nsub_rename_at_622,__str_rename_at_619);
+	if ( __osym_rename_at_623 == nullptr )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __ofs_rename_at_626 = __osym_rename_at_623;
+		regex::ReNode * __node2_rename_at_627 = __node_rename_at_619->next;
+		if ( __node2_rename_at_627 != nullptr )
+		{
+			while ( __osym_rename_at_623 != nullptr )
+			{
+				das_copy(__node_rename_at_619->tail,__osym_rename_at_623);
+				uint8_t * __otail_rename_at_631 = das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__node2_rename_at_627->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_619),__node2_rename_at_627,__osym_rename_at_623);
+				if ( __otail_rename_at_631 != nullptr )
+				{
+					return das_auto_cast<uint8_t *>::cast(__otail_rename_at_631);
+				} else {
+					das_copy(__osym_rename_at_623,das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__nsub_rename_at_622->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_619),__nsub_rename_at_622,__osym_rename_at_623));
+				};
+			};
+			return das_auto_cast<uint8_t *>::cast(nullptr);
+		} else {
+			while ( __osym_rename_at_623 != nullptr )
+			{
+				das_copy(__ofs_rename_at_626,__osym_rename_at_623);
+				das_copy(__osym_rename_at_623,das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__nsub_rename_at_622->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_619),__nsub_rename_at_622,__ofs_rename_at_626));
+			};
+			das_copy(__node_rename_at_619->tail,__ofs_rename_at_626);
+			return das_auto_cast<uint8_t *>::cast(__ofs_rename_at_626);
+		};
+	};
+}
+
+inline uint8_t * re_match2_plus_set_a77e502c2ce10da5 ( Context * __context__, regex::Regex &  __regex_rename_at_644, regex::ReNode * __node_rename_at_644, uint8_t * const  __str_rename_at_644 )
+{
+	if ( !is_char_in_set(int32_t((*(__str_rename_at_644))),das_arg<TDim<uint32_t,8>>::pass(__node_rename_at_644->cset),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __ofs_rename_at_651 = das_ptr_add(__str_rename_at_644,1,1);
+		uint8_t * __osym_rename_at_652 = __ofs_rename_at_651;
+		regex::ReNode * __node2_rename_at_653 = __node_rename_at_644->next;
+		if ( __node2_rename_at_653 != nullptr )
+		{
+			while ( __osym_rename_at_652 != nullptr )
+			{
+				das_copy(__node_rename_at_644->tail,__osym_rename_at_652);
+				uint8_t * __otail_rename_at_657 = das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__node2_rename_at_653->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_644),__node2_rename_at_653,__osym_rename_at_652);
+				if ( __otail_rename_at_657 != nullptr )
+				{
+					return das_auto_cast<uint8_t *>::cast(__otail_rename_at_657);
+				} else {
+					if ( !is_char_in_set(int32_t((*(__osym_rename_at_652))),das_arg<TDim<uint32_t,8>>::pass(__node_rename_at_644->cset),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) )
+					{
+						return das_auto_cast<uint8_t *>::cast(nullptr);
+					} else {
+						das_ptr_inc(__osym_rename_at_652,1);
+					};
+				};
+			};
+			return das_auto_cast<uint8_t *>::cast(nullptr);
+		} else {
+			while ( __osym_rename_at_652 != nullptr )
+			{
+				das_copy(__ofs_rename_at_651,__osym_rename_at_652);
+				if ( !is_char_in_set(int32_t((*(__osym_rename_at_652))),das_arg<TDim<uint32_t,8>>::pass(__node_rename_at_644->cset),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) )
+				{
+					break;
+				} else {
+					das_ptr_inc(__osym_rename_at_652,1);
+				};
+			};
+			das_copy(__node_rename_at_644->tail,__ofs_rename_at_651);
+			return das_auto_cast<uint8_t *>::cast(__ofs_rename_at_651);
+		};
+	};
+}
+
+inline uint8_t * re_match2_star_3d9e9e017941b973 ( Context * __context__, regex::Regex &  __regex_rename_at_674, regex::ReNode * __node_rename_at_674, uint8_t * const  __str_rename_at_674 )
+{
+	uint8_t * __ofs_rename_at_677 = __str_rename_at_674;
+	regex::ReNode * __node2_rename_at_678 = __node_rename_at_674->next;
+	regex::ReNode * __nsub_rename_at_679 = __node_rename_at_674->subexpr;
+	if ( __node2_rename_at_678 != nullptr )
+	{
+		while ( __ofs_rename_at_677 != nullptr )
+		{
+			das_copy(__node_rename_at_674->tail,__ofs_rename_at_677);
+			uint8_t * __oany_rename_at_683 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__node2_rename_at_678->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_674),__node2_rename_at_678,__ofs_rename_at_677));
+			if ( __oany_rename_at_683 != nullptr )
+			{
+				return das_auto_cast<uint8_t *>::cast(__oany_rename_at_683);
+			} else {
+				das_copy(__ofs_rename_at_677,das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__nsub_rename_at_679->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_674),__nsub_rename_at_679,__ofs_rename_at_677));
+			};
+		};
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		uint8_t * __osym_rename_at_689 = __ofs_rename_at_677;
+		while ( __osym_rename_at_689 != nullptr )
+		{
+			das_copy(__ofs_rename_at_677,__osym_rename_at_689);
+			das_copy(__osym_rename_at_689,das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__nsub_rename_at_679->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_674),__nsub_rename_at_679,__ofs_rename_at_677));
+		};
+		das_copy(__node_rename_at_674->tail,__ofs_rename_at_677);
+		return das_auto_cast<uint8_t *>::cast(__ofs_rename_at_677);
+	};
+}
+
+inline uint8_t * re_match2_group_64e1ead31a846f3e ( Context * __context__, regex::Regex &  __regex_rename_at_697, regex::ReNode * __node_rename_at_697, uint8_t * const  __str_rename_at_697 )
+{
+	regex::ReNode * __nsub_rename_at_700 = __node_rename_at_697->subexpr;
+	uint8_t * __osub_rename_at_701 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t * const >(__context__,nullptr,__nsub_rename_at_700->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_697),__nsub_rename_at_700,__str_rename_at_697));
+	if ( __osub_rename_at_701 == nullptr )
+	{
+		return das_auto_cast<uint8_t *>::cast(nullptr);
+	} else {
+		das_copy(das_get_tuple_field<range,0>::get(__regex_rename_at_697.groups(__node_rename_at_697->index,__context__)),range(int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__str_rename_at_697),das_auto_cast<void * const >::cast(__regex_rename_at_697.match),1)),int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__node_rename_at_697->subexpr->tail),das_auto_cast<void * const >::cast(__regex_rename_at_697.match),1))));
+		return das_auto_cast<uint8_t *>::cast(__osub_rename_at_701);
+	};
+}
+
+inline bool re_early_out_22e386bed08ccfdb ( Context * __context__, TDim<uint32_t,8> &  __cset_rename_at_711, regex::ReNode * const  __node_rename_at_711 )
+{
+	if ( __node_rename_at_711->op == DAS_COMMENT(enum) regex::ReOp::Char )
+	{
+		set_or_char_471888d9ed78efab(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_711),get_character_at(__node_rename_at_711->text,0,__context__));
+		return das_auto_cast<bool>::cast(false);
+	} else if ( __node_rename_at_711->op == DAS_COMMENT(enum) regex::ReOp::Set )
+	{
+		set_or_set_9609a9e932b32815(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_711),__node_rename_at_711->cset);
+		return das_auto_cast<bool>::cast(false);
+	} else if ( __node_rename_at_711->op == DAS_COMMENT(enum) regex::ReOp::Any )
+	{
+		{
+			bool __need_loop_719 = true;
+			// x : uint aka CharSet& -const
+			das_iterator<TDim<uint32_t,8>> __x_iterator(__cset_rename_at_711);
+			uint32_t * __x_rename_at_719;
+			__need_loop_719 = __x_iterator.first(__context__,(__x_rename_at_719)) && __need_loop_719;
+			for ( ; __need_loop_719 ; __need_loop_719 = __x_iterator.next(__context__,(__x_rename_at_719)) )
+			{
+				das_copy((*__x_rename_at_719),0xffffffffu);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_719));
+		};
+		return das_auto_cast<bool>::cast(false);
+	} else if ( __node_rename_at_711->op == DAS_COMMENT(enum) regex::ReOp::Eos )
+	{
+		return das_auto_cast<bool>::cast(false);
+	} else if ( __node_rename_at_711->op == DAS_COMMENT(enum) regex::ReOp::Group )
+	{
+		return das_auto_cast<bool>::cast(re_early_out_22e386bed08ccfdb(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_711),__node_rename_at_711->subexpr));
+	} else if ( __node_rename_at_711->op == DAS_COMMENT(enum) regex::ReOp::Plus )
+	{
+		return das_auto_cast<bool>::cast(re_early_out_22e386bed08ccfdb(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_711),__node_rename_at_711->subexpr));
+	} else if ( __node_rename_at_711->op == DAS_COMMENT(enum) regex::ReOp::Star )
+	{
+		re_early_out_22e386bed08ccfdb(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_711),__node_rename_at_711->subexpr);
+		return das_auto_cast<bool>::cast(true);
+	} else if ( __node_rename_at_711->op == DAS_COMMENT(enum) regex::ReOp::Question )
+	{
+		re_early_out_22e386bed08ccfdb(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_711),__node_rename_at_711->subexpr);
+		return das_auto_cast<bool>::cast(true);
+	} else if ( __node_rename_at_711->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+	{
+		bool __left_rename_at_735 = ((bool)re_early_out_22e386bed08ccfdb(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_711),__node_rename_at_711->left));
+		return das_auto_cast<bool>::cast(__left_rename_at_735 ? das_auto_cast<bool>::cast(re_early_out_22e386bed08ccfdb(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_711),__node_rename_at_711->right)) : das_auto_cast<bool>::cast(false));
+	} else if ( __node_rename_at_711->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		bool __any_rename_at_738 = false;
+		{
+			bool __need_loop_739 = true;
+			// sub : regex::ReNode? const&
+			das_iterator<TArray<regex::ReNode *> const > __sub_iterator(__node_rename_at_711->all);
+			regex::ReNode * const  * __sub_rename_at_739;
+			__need_loop_739 = __sub_iterator.first(__context__,(__sub_rename_at_739)) && __need_loop_739;
+			for ( ; __need_loop_739 ; __need_loop_739 = __sub_iterator.next(__context__,(__sub_rename_at_739)) )
+			{
+				das_copy(__any_rename_at_738,re_early_out_22e386bed08ccfdb(__context__,das_arg<TDim<uint32_t,8>>::pass(__cset_rename_at_711),(*__sub_rename_at_739)) || __any_rename_at_738);
+			}
+			__sub_iterator.close(__context__,(__sub_rename_at_739));
+		};
+		return das_auto_cast<bool>::cast(__any_rename_at_738);
+	} else {
+		builtin_throw(((char *) "unsupported operation"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		return das_auto_cast<bool>::cast(false);
+	};
+}
+
+inline bool is_valid_f341200a6f682e5a ( Context * __context__, regex::Regex &  __re_rename_at_750 )
+{
+	return das_auto_cast<bool>::cast(__re_rename_at_750.root != nullptr);
+}
+
+inline bool regex_compile_49466229404ec92e ( Context * __context__, regex::Regex &  __re_rename_at_754, char * const  __expr_rename_at_754 )
+{
+	das_copy(__re_rename_at_754.root,re_parse_3d6f9a305b851160(__context__,__expr_rename_at_754));
+	if ( __re_rename_at_754.root != nullptr )
+	{
+		re_assign_next_40df54bb93432757(__context__,das_arg<regex::Regex>::pass(__re_rename_at_754));
+		re_assign_groups_fb8b490fd90b06b1(__context__,das_arg<regex::Regex>::pass(__re_rename_at_754));
+		re_assign_match_functions_b0713981805262da(__context__,das_arg<regex::Regex>::pass(__re_rename_at_754));
+		re_early_out_22e386bed08ccfdb(__context__,das_arg<TDim<uint32_t,8>>::pass(__re_rename_at_754.earlyOut),__re_rename_at_754.root);
+		das_copy(__re_rename_at_754.canEarlyOut,!is_set_empty_fb12252b2129800d(__context__,das_arg<TDim<uint32_t,8>>::pass(__re_rename_at_754.earlyOut)));
+	};
+	return das_auto_cast<bool>::cast(__re_rename_at_754.root != nullptr);
+}
+
+inline regex::Regex regex_compile_3ab3aff652051470 ( Context * __context__, char * const  __expr_rename_at_766 )
+{
+	regex::Regex __re_rename_at_767; das_zero(__re_rename_at_767);
+	if ( !regex_compile_49466229404ec92e(__context__,das_arg<regex::Regex>::pass(__re_rename_at_767),__expr_rename_at_766) )
+	{
+		builtin_throw(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_3, cast<char * const >::from(((char *) "regular expression ")), cast<char * const >::from(__expr_rename_at_766), cast<char * const >::from(((char *) " did not compile")))),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+	return /* <- */ das_auto_cast_move<regex::Regex>::cast(_Funcbuiltin_0x60__return_with_lockcheck_48c386c3dcec1cdd(__context__,das_arg<regex::Regex>::pass(__re_rename_at_767)));
+}
+
+inline regex::Regex regex_compile_34958ec809c4585e ( Context * __context__, regex::Regex &  __re_rename_at_772 )
+{
+	if ( __re_rename_at_772.root != nullptr )
+	{
+		re_assign_next_40df54bb93432757(__context__,das_arg<regex::Regex>::pass(__re_rename_at_772));
+		re_assign_match_functions_b0713981805262da(__context__,das_arg<regex::Regex>::pass(__re_rename_at_772));
+	};
+	return /* <- */ das_auto_cast_move<regex::Regex>::cast(_Funcbuiltin_0x60__return_with_lockcheck_48c386c3dcec1cdd(__context__,das_arg<regex::Regex>::pass(__re_rename_at_772)));
+}
+
+inline int32_t regex_match_270cb942810fc6f1 ( Context * __context__, regex::Regex &  __regex_rename_at_778, char * const  __str_rename_at_778, int32_t __offset_rename_at_778 )
+{
+	if ( builtin_empty(__str_rename_at_778) )
+	{
+		return das_auto_cast<int32_t>::cast(-1);
+	} else {
+		das_copy(__regex_rename_at_778.match,das_cast<uint8_t *>::cast(__str_rename_at_778));
+		uint8_t * __mptr_rename_at_787 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__regex_rename_at_778.root->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_778),__regex_rename_at_778.root,__regex_rename_at_778.match));
+		return das_auto_cast<int32_t>::cast((__mptr_rename_at_787 == nullptr) ? das_auto_cast<int32_t>::cast(-1) : das_auto_cast<int32_t>::cast(int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__mptr_rename_at_787),das_auto_cast<void * const >::cast(__regex_rename_at_778.match),1))));
+	};
+}
+
+inline char * regex_group_1f825e4ecddcb4c9 ( Context * __context__, regex::Regex const  &  __regex_rename_at_792, int32_t __index_rename_at_792, char * const  __match_rename_at_792 )
+{
+	range __sub_range_rename_at_794 = ((range)das_get_tuple_field<range,0>::get(__regex_rename_at_792.groups(__index_rename_at_792,__context__)));
+	return das_auto_cast<char *>::cast(((char *)(builtin_string_slice1(__match_rename_at_792,v_extract_xi(v_cast_vec4i(__sub_range_rename_at_794)) /*x*/,v_extract_yi(v_cast_vec4i(__sub_range_rename_at_794)) /*y*/,__context__))));
+}
+
+inline void regex_foreach_20e08b8606d5c3d1 ( Context * __context__, regex::Regex &  __regex_rename_at_798, char * const  __str_rename_at_798, Block DAS_COMMENT((bool,range)) const  &  __blk_rename_at_798 )
+{
+	if ( builtin_empty(__str_rename_at_798) )
+	{
+		return ;
+	} else {
+		das_copy(__regex_rename_at_798.match,das_cast<uint8_t *>::cast(__str_rename_at_798));
+		regex::ReNode * __root_rename_at_804 = __regex_rename_at_798.root;
+		uint8_t * __pstr_rename_at_805 = das_cast<uint8_t *>::cast(__str_rename_at_798);
+		uint8_t * __cstr_rename_at_806 = __pstr_rename_at_805;
+		if ( __regex_rename_at_798.canEarlyOut )
+		{
+			while ( true )
+			{
+				int32_t __Ch_rename_at_810 = ((int32_t)int32_t((*(__cstr_rename_at_806))));
+				if ( __Ch_rename_at_810 == 0 )
+				{
+					break;
+				} else {
+					if ( is_char_in_set(__Ch_rename_at_810,das_arg<TDim<uint32_t,8>>::pass(__regex_rename_at_798.earlyOut),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))) )
+					{
+						uint8_t * __om_rename_at_814 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__root_rename_at_804->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_798),__root_rename_at_804,__cstr_rename_at_806));
+						if ( __om_rename_at_814 != nullptr )
+						{
+							if ( !das_invoke<bool>::invoke<range>(__context__,nullptr,__blk_rename_at_798,range(int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__cstr_rename_at_806),das_auto_cast<void * const >::cast(__pstr_rename_at_805),1)),int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__om_rename_at_814),das_auto_cast<void * const >::cast(__pstr_rename_at_805),1)))) )
+							{
+								break;
+							} else {
+								das_copy(__cstr_rename_at_806,__om_rename_at_814);
+							};
+						} else {
+							das_ptr_inc(__cstr_rename_at_806,1);
+						};
+					} else {
+						das_ptr_inc(__cstr_rename_at_806,1);
+					};
+				};
+			};
+		} else {
+			while ( int32_t((*(__cstr_rename_at_806))) != 0 )
+			{
+				uint8_t * __om_rename_at_825 = ((uint8_t *)das_invoke_function<uint8_t *>::invoke<regex::Regex &,regex::ReNode *,uint8_t *>(__context__,nullptr,__root_rename_at_804->fun2,das_arg<regex::Regex>::pass(__regex_rename_at_798),__root_rename_at_804,__cstr_rename_at_806));
+				if ( __om_rename_at_825 != nullptr )
+				{
+					if ( !das_invoke<bool>::invoke<range>(__context__,nullptr,__blk_rename_at_798,range(int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__cstr_rename_at_806),das_auto_cast<void * const >::cast(__pstr_rename_at_805),1)),int32_t(i_das_ptr_diff(das_auto_cast<void * const >::cast(__om_rename_at_825),das_auto_cast<void * const >::cast(__pstr_rename_at_805),1)))) )
+					{
+						break;
+					} else {
+						das_copy(__cstr_rename_at_806,__om_rename_at_825);
+					};
+				} else {
+					das_ptr_inc(__cstr_rename_at_806,1);
+				};
+			};
+		};
+	};
+}
+
+inline void regex_debug_ceb0bfb647144f34 ( Context * __context__, regex::Regex const  &  __regex_rename_at_837 )
+{
+	debug_re_fa0b41547c802fb4(__context__,__regex_rename_at_837.root,1);
+	builtin_print(((char *) "\n"),__context__);
+	if ( __regex_rename_at_837.canEarlyOut )
+	{
+		builtin_print(((char *) "early out: "),__context__);
+		debug_set_31f032942f694fa4(__context__,__regex_rename_at_837.earlyOut);
+		builtin_print(((char *) "\n"),__context__);
+	};
+	if ( builtin_array_size(__regex_rename_at_837.groups) != 0 )
+	{
+		builtin_print(((char *) "groups:"),__context__);
+		{
+			bool __need_loop_847 = true;
+			// g : tuple<range;string> const&
+			das_iterator<TArray<TTuple<16,range,char *>> const > __g_iterator(__regex_rename_at_837.groups);
+			TTuple<16,range,char *> const  * __g_rename_at_847;
+			__need_loop_847 = __g_iterator.first(__context__,(__g_rename_at_847)) && __need_loop_847;
+			for ( ; __need_loop_847 ; __need_loop_847 = __g_iterator.next(__context__,(__g_rename_at_847)) )
+			{
+				builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_4, cast<char * const >::from(((char *) "\t")), cast<char * const >::from(das_get_tuple_field<char *,8>::get((*__g_rename_at_847))), cast<char * const >::from(((char *) "\n")))),__context__);
+			}
+			__g_iterator.close(__context__,(__g_rename_at_847));
+		};
+	};
+}
+
+inline void debug_set_31f032942f694fa4 ( Context * __context__, TDim<uint32_t,8> const  &  __cset_rename_at_850 )
+{
+	{
+		bool __need_loop_852 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,256));
+		int32_t __x_rename_at_852;
+		__need_loop_852 = __x_iterator.first(__context__,(__x_rename_at_852)) && __need_loop_852;
+		for ( ; __need_loop_852 ; __need_loop_852 = __x_iterator.next(__context__,(__x_rename_at_852)) )
+		{
+			if ( (__cset_rename_at_850((__x_rename_at_852 >> 5),__context__) & uint32_t(1 << (__x_rename_at_852 & 31))) != 0x0u )
+			{
+				if ( (__x_rename_at_852 >= 32) && (__x_rename_at_852 <= 127) )
+				{
+					builtin_print(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_5, cast<char *>::from(((char *)(to_string_char(__x_rename_at_852,__context__)))))),__context__);
+				} else {
+					builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_6, cast<char * const >::from(((char *) "\\")), cast<int32_t>::from(__x_rename_at_852))),__context__);
+				};
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_852));
+	};
+}
+
+inline void debug_re_fa0b41547c802fb4 ( Context * __context__, regex::ReNode * const  __node_rename_at_859, int32_t __tab_rename_at_859 )
+{
+	builtin_print(((char *) "("),__context__);
+	if ( __node_rename_at_859 != nullptr )
+	{
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_7, cast<char * const >::from(((char *) "#")), cast<int32_t>::from(__node_rename_at_859->id))),__context__);
+		if ( __node_rename_at_859->next != nullptr )
+		{
+			builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_8, cast<char * const >::from(((char *) "->")), cast<int32_t>::from(__node_rename_at_859->next->id))),__context__);
+		} else {
+			builtin_print(((char *) "->!"),__context__);
+		};
+		builtin_print(((char *) " "),__context__);
+	};
+	if ( __node_rename_at_859 == nullptr )
+	{
+		builtin_print(((char *) "null)"),__context__);
+	} else if ( __node_rename_at_859->op == DAS_COMMENT(enum) regex::ReOp::Char )
+	{
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_9, cast<char * const >::from(((char *) "Char `")), cast<char * const >::from(__node_rename_at_859->text), cast<char * const >::from(((char *) "`)")))),__context__);
+	} else if ( __node_rename_at_859->op == DAS_COMMENT(enum) regex::ReOp::Set )
+	{
+		builtin_print(((char *) "Set "),__context__);
+		debug_set_31f032942f694fa4(__context__,__node_rename_at_859->cset);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_859->op == DAS_COMMENT(enum) regex::ReOp::Any )
+	{
+		builtin_print(((char *) "Any)"),__context__);
+	} else if ( __node_rename_at_859->op == DAS_COMMENT(enum) regex::ReOp::Eos )
+	{
+		builtin_print(((char *) "Eos)"),__context__);
+	} else if ( __node_rename_at_859->op == DAS_COMMENT(enum) regex::ReOp::Group )
+	{
+		builtin_print(((char *) "Group "),__context__);
+		debug_re_fa0b41547c802fb4(__context__,__node_rename_at_859->subexpr,__tab_rename_at_859 + 1);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_859->op == DAS_COMMENT(enum) regex::ReOp::Plus )
+	{
+		builtin_print(((char *) "Plus "),__context__);
+		debug_re_fa0b41547c802fb4(__context__,__node_rename_at_859->subexpr,__tab_rename_at_859);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_859->op == DAS_COMMENT(enum) regex::ReOp::Star )
+	{
+		builtin_print(((char *) "Star "),__context__);
+		debug_re_fa0b41547c802fb4(__context__,__node_rename_at_859->subexpr,__tab_rename_at_859);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_859->op == DAS_COMMENT(enum) regex::ReOp::Question )
+	{
+		builtin_print(((char *) "Question "),__context__);
+		debug_re_fa0b41547c802fb4(__context__,__node_rename_at_859->subexpr,__tab_rename_at_859);
+		builtin_print(((char *) ")"),__context__);
+	} else if ( __node_rename_at_859->op == DAS_COMMENT(enum) regex::ReOp::Concat )
+	{
+		builtin_print(((char *) "Contact"),__context__);
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_10, cast<char * const >::from(((char *) "\n")), cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_859,__context__)))))),__context__);
+		debug_re_fa0b41547c802fb4(__context__,__node_rename_at_859->left,__tab_rename_at_859 + 1);
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_11, cast<char * const >::from(((char *) "\n")), cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_859,__context__)))))),__context__);
+		debug_re_fa0b41547c802fb4(__context__,__node_rename_at_859->right,__tab_rename_at_859 + 1);
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_12, cast<char * const >::from(((char *) "\n")), cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_859 - 1,__context__)))), cast<char * const >::from(((char *) ")")))),__context__);
+	} else if ( __node_rename_at_859->op == DAS_COMMENT(enum) regex::ReOp::Union )
+	{
+		builtin_print(((char *) "Union\n"),__context__);
+		{
+			bool __need_loop_905 = true;
+			// sub : regex::ReNode? const&
+			das_iterator<TArray<regex::ReNode *> const > __sub_iterator(__node_rename_at_859->all);
+			regex::ReNode * const  * __sub_rename_at_905;
+			__need_loop_905 = __sub_iterator.first(__context__,(__sub_rename_at_905)) && __need_loop_905;
+			for ( ; __need_loop_905 ; __need_loop_905 = __sub_iterator.next(__context__,(__sub_rename_at_905)) )
+			{
+				builtin_print(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_13, cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_859,__context__)))))),__context__);
+				debug_re_fa0b41547c802fb4(__context__,(*__sub_rename_at_905),__tab_rename_at_859 + 1);
+				builtin_print(((char *) "\n"),__context__);
+			}
+			__sub_iterator.close(__context__,(__sub_rename_at_905));
+		};
+		builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_14, cast<char *>::from(((char *)(string_repeat(((char *) "\t"),__tab_rename_at_859 - 1,__context__)))), cast<char * const >::from(((char *) ")")))),__context__);
+	} else {
+		builtin_throw(((char *) "unsupported op"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+}
+
+inline int32_t rnd_set_character_f49e90c9ced30293 ( Context * __context__, TDim<uint32_t,8> const  &  __cset_rename_at_915, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_915 )
+{
+	uint32_t __total_rename_at_916 = ((uint32_t)char_set_total(__cset_rename_at_915));
+	uint32_t __idx_rename_at_917 = 0x0u;
+	_Funcbuiltin_0x60_next_160159e214cdd056(__context__,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_915),__idx_rename_at_917);
+	das_copy(__idx_rename_at_917,SimPolicy<uint32_t>::Mod(__idx_rename_at_917,__total_rename_at_916,*__context__,nullptr));
+	return das_auto_cast<int32_t>::cast(char_set_element(int32_t(__idx_rename_at_917),__cset_rename_at_915));
+}
+
+inline void re_gen2_fail_83869989d4feff33 ( Context * __context__, regex::ReNode * __node_rename_at_922, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_922, StringBuilderWriter &  __str_rename_at_922 )
+{
+	DAS_ASSERTF((false),(((char *) "not running generated regex")));
+}
+
+inline void re_gen2_char_f50387c056fd98bf ( Context * __context__, regex::ReNode * __node_rename_at_927, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_927, StringBuilderWriter &  __str_rename_at_927 )
+{
+	das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_15,cast<StringBuilderWriter &>::from(__str_rename_at_927),cast<char *>::from(__node_rename_at_927->text)));
+	regex::ReNode * __node2_rename_at_931 = __node_rename_at_927->next;
+	if ( __node2_rename_at_931 != nullptr )
+	{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__node2_rename_at_931->gen2,__node2_rename_at_931,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_927),das_arg<StringBuilderWriter>::pass(__str_rename_at_927));
+	};
+}
+
+inline void re_gen2_union_9643fdb28fe9f09d ( Context * __context__, regex::ReNode * __node_rename_at_935, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_935, StringBuilderWriter &  __str_rename_at_935 )
+{
+	uint32_t __nidx_rename_at_938 = 0x0u;
+	_Funcbuiltin_0x60_next_160159e214cdd056(__context__,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_935),__nidx_rename_at_938);
+	das_copy(__nidx_rename_at_938,SimPolicy<uint32_t>::Mod(__nidx_rename_at_938,uint32_t(builtin_array_size(das_arg<TArray<regex::ReNode *>>::pass(__node_rename_at_935->all))),*__context__,nullptr));
+	regex::ReNode * __sub_rename_at_941 = __node_rename_at_935->all(__nidx_rename_at_938,__context__);
+	das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__sub_rename_at_941->gen2,__sub_rename_at_941,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_935),das_arg<StringBuilderWriter>::pass(__str_rename_at_935));
+}
+
+inline void re_gen2_set_687ad6fcb132e4de ( Context * __context__, regex::ReNode * __node_rename_at_944, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_944, StringBuilderWriter &  __str_rename_at_944 )
+{
+	write_string_char(das_arg<StringBuilderWriter>::pass(__str_rename_at_944),rnd_set_character_f49e90c9ced30293(__context__,das_arg<TDim<uint32_t,8>>::pass(__node_rename_at_944->cset),das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_944)));
+	regex::ReNode * __node2_rename_at_948 = __node_rename_at_944->next;
+	if ( __node2_rename_at_948 != nullptr )
+	{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__node2_rename_at_948->gen2,__node2_rename_at_948,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_944),das_arg<StringBuilderWriter>::pass(__str_rename_at_944));
+	};
+}
+
+inline void re_gen2_any_998ffcd284a238dd ( Context * __context__, regex::ReNode * __node_rename_at_952, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_952, StringBuilderWriter &  __str_rename_at_952 )
+{
+	uint32_t __ch_rename_at_955 = 0;
+	_Funcbuiltin_0x60_next_160159e214cdd056(__context__,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_952),__ch_rename_at_955);
+	write_string_char(das_arg<StringBuilderWriter>::pass(__str_rename_at_952),int32_t((SimPolicy<uint32_t>::Mod(__ch_rename_at_955,0xffu,*__context__,nullptr)) + 0x1u));
+	regex::ReNode * __node2_rename_at_958 = __node_rename_at_952->next;
+	if ( __node2_rename_at_958 != nullptr )
+	{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__node2_rename_at_958->gen2,__node2_rename_at_958,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_952),das_arg<StringBuilderWriter>::pass(__str_rename_at_952));
+	};
+}
+
+inline void re_gen2_concat_2acaded76c0d6fe4 ( Context * __context__, regex::ReNode * __node_rename_at_962, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_962, StringBuilderWriter &  __str_rename_at_962 )
+{
+	regex::ReNode * __left_rename_at_965 = __node_rename_at_962->left;
+	das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__left_rename_at_965->gen2,__left_rename_at_965,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_962),das_arg<StringBuilderWriter>::pass(__str_rename_at_962));
+}
+
+inline void re_gen2_eos_b4ed344d74735b22 ( Context * __context__, regex::ReNode * __node_rename_at_968, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_968, StringBuilderWriter &  __str_rename_at_968 )
+{
+	regex::ReNode * __node2_rename_at_971 = __node_rename_at_968->next;
+	if ( __node2_rename_at_971 != nullptr )
+	{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__node2_rename_at_971->gen2,__node2_rename_at_971,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_968),das_arg<StringBuilderWriter>::pass(__str_rename_at_968));
+	};
+}
+
+inline void re_gen2_question_9bc71016a02ceac7 ( Context * __context__, regex::ReNode * __node_rename_at_975, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_975, StringBuilderWriter &  __str_rename_at_975 )
+{
+	uint32_t __a_rename_at_978 = 0x0u;
+	_Funcbuiltin_0x60_next_160159e214cdd056(__context__,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_975),__a_rename_at_978);
+	if ( (__a_rename_at_978 & 0x1u) != 0x0u )
+	{
+		regex::ReNode * __nsub_rename_at_981 = __node_rename_at_975->subexpr;
+		if ( __nsub_rename_at_981 != nullptr )
+		{
+			das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__nsub_rename_at_981->gen2,__nsub_rename_at_981,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_975),das_arg<StringBuilderWriter>::pass(__str_rename_at_975));
+		};
+	};
+	regex::ReNode * __node2_rename_at_984 = __node_rename_at_975->next;
+	if ( __node2_rename_at_984 != nullptr )
+	{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__node2_rename_at_984->gen2,__node2_rename_at_984,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_975),das_arg<StringBuilderWriter>::pass(__str_rename_at_975));
+	};
+}
+
+inline void re_gen2_plus_32b59fc6bd3347f1 ( Context * __context__, regex::ReNode * __node_rename_at_988, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_988, StringBuilderWriter &  __str_rename_at_988 )
+{
+	uint32_t __cnt_rename_at_991 = 0x0u;
+	_Funcbuiltin_0x60_next_160159e214cdd056(__context__,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_988),__cnt_rename_at_991);
+	das_copy(__cnt_rename_at_991,(SimPolicy<uint32_t>::Mod(__cnt_rename_at_991,das_global<uint32_t,0x570cc75ae91fa86f>(__context__) /*re_gen_rep_limit*/,*__context__,nullptr)) + 0x1u);
+	regex::ReNode * __nsub_rename_at_994 = __node_rename_at_988->subexpr;
+	if ( __nsub_rename_at_994 != nullptr )
+	{
+		{
+			bool __need_loop_996 = true;
+			// i : uint const
+			das_iterator<urange> __i_iterator(mk_urange(__cnt_rename_at_991));
+			uint32_t __i_rename_at_996;
+			__need_loop_996 = __i_iterator.first(__context__,(__i_rename_at_996)) && __need_loop_996;
+			for ( ; __need_loop_996 ; __need_loop_996 = __i_iterator.next(__context__,(__i_rename_at_996)) )
+			{
+				das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__nsub_rename_at_994->gen2,__nsub_rename_at_994,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_988),das_arg<StringBuilderWriter>::pass(__str_rename_at_988));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_996));
+		};
+	};
+	regex::ReNode * __node2_rename_at_998 = __node_rename_at_988->next;
+	if ( __node2_rename_at_998 != nullptr )
+	{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__node2_rename_at_998->gen2,__node2_rename_at_998,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_988),das_arg<StringBuilderWriter>::pass(__str_rename_at_988));
+	};
+}
+
+inline void re_gen2_star_e57698da7750ea56 ( Context * __context__, regex::ReNode * __node_rename_at_1002, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_1002, StringBuilderWriter &  __str_rename_at_1002 )
+{
+	uint32_t __cnt_rename_at_1005 = 0x0u;
+	_Funcbuiltin_0x60_next_160159e214cdd056(__context__,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_1002),__cnt_rename_at_1005);
+	das_copy(__cnt_rename_at_1005,SimPolicy<uint32_t>::Mod(__cnt_rename_at_1005,das_global<uint32_t,0x570cc75ae91fa86f>(__context__) /*re_gen_rep_limit*/,*__context__,nullptr));
+	regex::ReNode * __nsub_rename_at_1008 = __node_rename_at_1002->subexpr;
+	if ( __nsub_rename_at_1008 != nullptr )
+	{
+		{
+			bool __need_loop_1010 = true;
+			// i : uint const
+			das_iterator<urange> __i_iterator(mk_urange(__cnt_rename_at_1005));
+			uint32_t __i_rename_at_1010;
+			__need_loop_1010 = __i_iterator.first(__context__,(__i_rename_at_1010)) && __need_loop_1010;
+			for ( ; __need_loop_1010 ; __need_loop_1010 = __i_iterator.next(__context__,(__i_rename_at_1010)) )
+			{
+				das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__nsub_rename_at_1008->gen2,__nsub_rename_at_1008,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_1002),das_arg<StringBuilderWriter>::pass(__str_rename_at_1002));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_1010));
+		};
+	};
+	regex::ReNode * __node2_rename_at_1012 = __node_rename_at_1002->next;
+	if ( __node2_rename_at_1012 != nullptr )
+	{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__node2_rename_at_1012->gen2,__node2_rename_at_1012,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_1002),das_arg<StringBuilderWriter>::pass(__str_rename_at_1002));
+	};
+}
+
+inline void re_gen2_group_220ee7b205b18ab6 ( Context * __context__, regex::ReNode * __node_rename_at_1016, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_1016, StringBuilderWriter &  __str_rename_at_1016 )
+{
+	regex::ReNode * __nsub_rename_at_1019 = __node_rename_at_1016->subexpr;
+	if ( __nsub_rename_at_1019 != nullptr )
+	{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__nsub_rename_at_1019->gen2,__nsub_rename_at_1019,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_1016),das_arg<StringBuilderWriter>::pass(__str_rename_at_1016));
+	};
+	regex::ReNode * __node2_rename_at_1022 = __node_rename_at_1016->next;
+	if ( __node2_rename_at_1022 != nullptr )
+	{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__node2_rename_at_1022->gen2,__node2_rename_at_1022,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_1016),das_arg<StringBuilderWriter>::pass(__str_rename_at_1016));
+	};
+}
+
+inline char * re_gen_782e537f3d526983 ( Context * __context__, regex::Regex &  __re_rename_at_1026, Sequence DAS_COMMENT((uint32_t)) &  __rnd_rename_at_1026 )
+{
+	return das_auto_cast<char *>::cast(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_1027) DAS_AOT_INLINE_LAMBDA -> void{
+		das_invoke_function<void>::invoke<regex::ReNode *,Sequence DAS_COMMENT((uint32_t)) &,StringBuilderWriter &>(__context__,nullptr,__re_rename_at_1026.root->gen2,__re_rename_at_1026.root,das_arg<Sequence DAS_COMMENT((uint32_t))>::pass(__rnd_rename_at_1026),das_arg<StringBuilderWriter>::pass(__writer_rename_at_1027));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))));
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_13e4a05653768251
+	aotLib[0xb8d697922f2109d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<regex::ReNode *> & , int32_t  ),&_Funcbuiltin_0x60_resize_13e4a05653768251>>();
+	};
+	// _Funcbuiltin_0x60_finalize_b7deb464a4f8e41c
+	aotLib[0x659c486a4d702516] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<regex::ReNode *> &  ),&_Funcbuiltin_0x60_finalize_b7deb464a4f8e41c>>();
+	};
+	// _Funcbuiltin_0x60_length_7938efcc1bc3eff1
+	aotLib[0x494cf457a90783a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TDim<regex::ReNode *,2> const  &  ),&_Funcbuiltin_0x60_length_7938efcc1bc3eff1>>();
+	};
+	// finalize_cb8163f3a24e2747
+	aotLib[0x75390c9d35769e71] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode &  ),&finalize_cb8163f3a24e2747>>();
+	};
+	// _Funcbuiltin_0x60_push_bd6055bce97bf09e
+	aotLib[0x6d0307266f50e401] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<16,range,char *>> & , TTuple<16,range,char *> const  &  ),&_Funcbuiltin_0x60_push_bd6055bce97bf09e>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_48c386c3dcec1cdd
+	aotLib[0x15eca16e6b0825d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<regex::Regex & (*) ( Context * __context__, regex::Regex &  ),&_Funcbuiltin_0x60__return_with_lockcheck_48c386c3dcec1cdd>>();
+	};
+	// finalize_6293242d2ef1254f
+	aotLib[0x41b8759721f57cbd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TVariant<16,regex::ReNode *,void *> &  ),&finalize_6293242d2ef1254f>>();
+	};
+	// finalize_46f88278c98091eb
+	aotLib[0xaaf65aeb9fe36c9a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * &  ),&finalize_46f88278c98091eb>>();
+	};
+	// _Funcbuiltin_0x60_push_5dc212b561cc93c2
+	aotLib[0x2819a5074444d141] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<regex::ReNode *> & , regex::ReNode * const   ),&_Funcbuiltin_0x60_push_5dc212b561cc93c2>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_59084725f30dd7bb
+	aotLib[0x9b5bb601d0960479] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<regex::ReNode *> (*) ( Context * __context__, TDim<regex::ReNode *,2> &  ),&_Funcbuiltin_0x60_to_array_move_59084725f30dd7bb>>();
+	};
+	// _Funcbuiltin_0x60_next_160159e214cdd056
+	aotLib[0xd6705851b835dfed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((uint32_t)) const  & , uint32_t &  ),&_Funcbuiltin_0x60_next_160159e214cdd056>>();
+	};
+	// re_gen_get_rep_limit_aad39a472678db9d
+	aotLib[0xada002926028ce01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__ ),&re_gen_get_rep_limit_aad39a472678db9d>>();
+	};
+	// trace_89f6695f8909b072
+	aotLib[0x3501f19b79ba4ed9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , int32_t  ),&trace_89f6695f8909b072>>();
+	};
+	// note_89f6695f8909b072
+	aotLib[0x3501f19b79ba4ed9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , int32_t  ),&note_89f6695f8909b072>>();
+	};
+	// trace_backtrack_c77fe5b3ac1a6a7c
+	aotLib[0x474399c20ee853ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&trace_backtrack_c77fe5b3ac1a6a7c>>();
+	};
+	// trace_value_4739abdd3b0a7208
+	aotLib[0xd1da75c466857d11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * const   ),&trace_value_4739abdd3b0a7208>>();
+	};
+	// nada_5086bd0a540f8186
+	aotLib[0x9b6df455d513d23d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__ ),&nada_5086bd0a540f8186>>();
+	};
+	// maybe_d7a4f325999cb99b
+	aotLib[0x37a52685839e8db5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, regex::ReNode * const   ),&maybe_d7a4f325999cb99b>>();
+	};
+	// eos_dde6e11fd3802ac8
+	aotLib[0x961e013842bdd11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, char * const  , int32_t  ),&eos_dde6e11fd3802ac8>>();
+	};
+	// at_c9bade5ff7edd57d
+	aotLib[0x9d976e8cdb634999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, char * const  , int32_t  ),&at_c9bade5ff7edd57d>>();
+	};
+	// next_1bd07c8c346bbbc2
+	aotLib[0x50657c1ea7d0f2d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TVariant<16,regex::ReNode *,void *> const  &  ),&next_1bd07c8c346bbbc2>>();
+	};
+	// is_set_empty_fb12252b2129800d
+	aotLib[0x920d0936973b20a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TDim<uint32_t,8> const  &  ),&is_set_empty_fb12252b2129800d>>();
+	};
+	// set_or_char_471888d9ed78efab
+	aotLib[0xc4836b64ee70e729] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , int32_t  ),&set_or_char_471888d9ed78efab>>();
+	};
+	// set_or_range_a7ad44e8ef1ec07c
+	aotLib[0xcc4c06a5bc038efd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , range  ),&set_or_range_a7ad44e8ef1ec07c>>();
+	};
+	// set_invert_be791c77bc6b6a11
+	aotLib[0x6dfa45c4c6120e9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> &  ),&set_invert_be791c77bc6b6a11>>();
+	};
+	// set_or_set_9609a9e932b32815
+	aotLib[0xa88845650b665991] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , TDim<uint32_t,8> const  &  ),&set_or_set_9609a9e932b32815>>();
+	};
+	// set_negative_7a1fcd94df7d5358
+	aotLib[0xf2801af36a693199] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> &  ),&set_negative_7a1fcd94df7d5358>>();
+	};
+	// set_meta_47c27306e1ab33a
+	aotLib[0xdba1fcaaf8ecde6b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> & , int32_t  ),&set_meta_47c27306e1ab33a>>();
+	};
+	// is_meta_character_24d3d25015b1373f
+	aotLib[0xc2120b306e7bee35] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&is_meta_character_24d3d25015b1373f>>();
+	};
+	// is_set_character_11f8fcca4329c870
+	aotLib[0x71b9b841679480a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&is_set_character_11f8fcca4329c870>>();
+	};
+	// re_char_72b6d2190a4aa86e
+	aotLib[0x2434e90eadc3384c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_char_72b6d2190a4aa86e>>();
+	};
+	// re_set_items_e4aed5649396a9a6
+	aotLib[0xeeb1eaf3119e3244] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_set_items_e4aed5649396a9a6>>();
+	};
+	// re_set_10c94f59326660bb
+	aotLib[0x429a4af23b0a7fda] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_set_10c94f59326660bb>>();
+	};
+	// re_any_8127ec932cbb51d
+	aotLib[0x6ae3c8d9c26fad2a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_any_8127ec932cbb51d>>();
+	};
+	// re_eos_62bbb15403a7af8a
+	aotLib[0xf59b7592427d1606] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_eos_62bbb15403a7af8a>>();
+	};
+	// re_group_e305de97e880ce49
+	aotLib[0xd0b80fbf47eb770c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_group_e305de97e880ce49>>();
+	};
+	// re_elementary_7fb0bc5f471be253
+	aotLib[0xe9f5022ee1a8acb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_elementary_7fb0bc5f471be253>>();
+	};
+	// mk_concat_4dcd600b481f43c0
+	aotLib[0x3e8f2f6b19e35259] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<regex::ReNode * (*) ( Context * __context__, regex::ReNode * , regex::ReNode *  ),&mk_concat_4dcd600b481f43c0>>();
+	};
+	// mk_union_53d62d01f1c4cdf7
+	aotLib[0xa8f0ff19171e22ba] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<regex::ReNode * (*) ( Context * __context__, regex::ReNode * , regex::ReNode *  ),&mk_union_53d62d01f1c4cdf7>>();
+	};
+	// re_re_806d249d156e8cc6
+	aotLib[0xdf72674d523c547d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_re_806d249d156e8cc6>>();
+	};
+	// re_basic_23562b17fe86ae37
+	aotLib[0xe27f584472bc8a9e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<16,regex::ReNode *,void *> (*) ( Context * __context__, char * const  , int32_t  ),&re_basic_23562b17fe86ae37>>();
+	};
+	// re_parse_3d6f9a305b851160
+	aotLib[0xd62c7ef53c99f85a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<regex::ReNode * (*) ( Context * __context__, char * const   ),&re_parse_3d6f9a305b851160>>();
+	};
+	// visit_top_down_28dd8379641934af
+	aotLib[0xec71ed0af99e09b9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Block DAS_COMMENT((void,regex::ReNode *)) const  &  ),&visit_top_down_28dd8379641934af>>();
+	};
+	// re_assign_next_40df54bb93432757
+	aotLib[0x45ab2d7a39b2509a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex &  ),&re_assign_next_40df54bb93432757>>();
+	};
+	// re_assign_groups_fb8b490fd90b06b1
+	aotLib[0xbbae5bf485e018d0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex &  ),&re_assign_groups_fb8b490fd90b06b1>>();
+	};
+	// re_assign_match_functions_b0713981805262da
+	aotLib[0xe3ff7214aca1d566] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex &  ),&re_assign_match_functions_b0713981805262da>>();
+	};
+	// re_match2_single_char_ec4bd67a88d6c383
+	aotLib[0x2e702c7177d86625] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_single_char_ec4bd67a88d6c383>>();
+	};
+	// re_match2_char_e7712649ef04ae7d
+	aotLib[0x45eb6d322ffcac4d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_char_e7712649ef04ae7d>>();
+	};
+	// re_match2_union_29c921f92bb6c013
+	aotLib[0x560cd16b8831daf5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_union_29c921f92bb6c013>>();
+	};
+	// re_match2_set_a7d14982d3d94062
+	aotLib[0x49f219111f865305] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_set_a7d14982d3d94062>>();
+	};
+	// re_match2_any_145e1cb203d4af15
+	aotLib[0xff457ad5c8b4795d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_any_145e1cb203d4af15>>();
+	};
+	// re_match2_concat_aa5a3133a76ae77
+	aotLib[0x6b0f368c25a48c8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_concat_aa5a3133a76ae77>>();
+	};
+	// re_match2_eos_e54e018f6fdc2874
+	aotLib[0xe82f7890d113734d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_eos_e54e018f6fdc2874>>();
+	};
+	// re_match2_question_c6073fc7d021f681
+	aotLib[0x79e94b15ec07c1dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_question_c6073fc7d021f681>>();
+	};
+	// re_match2_plus_6caa18e9465405bd
+	aotLib[0x731697164fb987b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_plus_6caa18e9465405bd>>();
+	};
+	// re_match2_plus_set_a77e502c2ce10da5
+	aotLib[0x874ed894c86ab695] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_plus_set_a77e502c2ce10da5>>();
+	};
+	// re_match2_star_3d9e9e017941b973
+	aotLib[0xd2061c3f23ce10c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_star_3d9e9e017941b973>>();
+	};
+	// re_match2_group_64e1ead31a846f3e
+	aotLib[0x3faade41b82ee6a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint8_t * (*) ( Context * __context__, regex::Regex & , regex::ReNode * , uint8_t * const   ),&re_match2_group_64e1ead31a846f3e>>();
+	};
+	// re_early_out_22e386bed08ccfdb
+	aotLib[0xe9a2bb843b2219a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TDim<uint32_t,8> & , regex::ReNode * const   ),&re_early_out_22e386bed08ccfdb>>();
+	};
+	// is_valid_f341200a6f682e5a
+	aotLib[0xb251f5a94789ee91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, regex::Regex &  ),&is_valid_f341200a6f682e5a>>();
+	};
+	// regex_compile_49466229404ec92e
+	aotLib[0x91b3f4e46ec49294] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, regex::Regex & , char * const   ),&regex_compile_49466229404ec92e>>();
+	};
+	// regex_compile_3ab3aff652051470
+	aotLib[0xc0ffd56e81d687e6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<regex::Regex (*) ( Context * __context__, char * const   ),&regex_compile_3ab3aff652051470>>();
+	};
+	// regex_compile_34958ec809c4585e
+	aotLib[0x9a2b3bc5ffb5d7f0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<regex::Regex (*) ( Context * __context__, regex::Regex &  ),&regex_compile_34958ec809c4585e>>();
+	};
+	// regex_match_270cb942810fc6f1
+	aotLib[0xba1fdb755e116dc5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, regex::Regex & , char * const  , int32_t  ),&regex_match_270cb942810fc6f1>>();
+	};
+	// regex_group_1f825e4ecddcb4c9
+	aotLib[0x2bf3457e81b9979d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, regex::Regex const  & , int32_t , char * const   ),&regex_group_1f825e4ecddcb4c9>>();
+	};
+	// regex_foreach_20e08b8606d5c3d1
+	aotLib[0xe65abfa6409d5e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex & , char * const  , Block DAS_COMMENT((bool,range)) const  &  ),&regex_foreach_20e08b8606d5c3d1>>();
+	};
+	// regex_debug_ceb0bfb647144f34
+	aotLib[0xa02800965d6fa9d2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::Regex const  &  ),&regex_debug_ceb0bfb647144f34>>();
+	};
+	// debug_set_31f032942f694fa4
+	aotLib[0xa288dfa369c21525] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,8> const  &  ),&debug_set_31f032942f694fa4>>();
+	};
+	// debug_re_fa0b41547c802fb4
+	aotLib[0x9cdd6cbe29e30e9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * const  , int32_t  ),&debug_re_fa0b41547c802fb4>>();
+	};
+	// rnd_set_character_f49e90c9ced30293
+	aotLib[0x5b224d81600557d4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TDim<uint32_t,8> const  & , Sequence DAS_COMMENT((uint32_t)) &  ),&rnd_set_character_f49e90c9ced30293>>();
+	};
+	// re_gen2_fail_83869989d4feff33
+	aotLib[0xe9380307d33f83d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_fail_83869989d4feff33>>();
+	};
+	// re_gen2_char_f50387c056fd98bf
+	aotLib[0xc79f07ade6f2ae1d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_char_f50387c056fd98bf>>();
+	};
+	// re_gen2_union_9643fdb28fe9f09d
+	aotLib[0x636a47fcb080f478] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_union_9643fdb28fe9f09d>>();
+	};
+	// re_gen2_set_687ad6fcb132e4de
+	aotLib[0x90d4657abc818e2b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_set_687ad6fcb132e4de>>();
+	};
+	// re_gen2_any_998ffcd284a238dd
+	aotLib[0xc3fa1895cce0ca38] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_any_998ffcd284a238dd>>();
+	};
+	// re_gen2_concat_2acaded76c0d6fe4
+	aotLib[0x65643685550ef15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_concat_2acaded76c0d6fe4>>();
+	};
+	// re_gen2_eos_b4ed344d74735b22
+	aotLib[0x8352a81dae913fe5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_eos_b4ed344d74735b22>>();
+	};
+	// re_gen2_question_9bc71016a02ceac7
+	aotLib[0x89e79b16998778e0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_question_9bc71016a02ceac7>>();
+	};
+	// re_gen2_plus_32b59fc6bd3347f1
+	aotLib[0xc2155b74811a2b30] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_plus_32b59fc6bd3347f1>>();
+	};
+	// re_gen2_star_e57698da7750ea56
+	aotLib[0xfc2887988925f31c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_star_e57698da7750ea56>>();
+	};
+	// re_gen2_group_220ee7b205b18ab6
+	aotLib[0x4c4384d71588dcd1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, regex::ReNode * , Sequence DAS_COMMENT((uint32_t)) & , StringBuilderWriter &  ),&re_gen2_group_220ee7b205b18ab6>>();
+	};
+	// re_gen_782e537f3d526983
+	aotLib[0x416c24d10ba063ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, regex::Regex & , Sequence DAS_COMMENT((uint32_t)) &  ),&re_gen_782e537f3d526983>>();
+	};
+	// [[ init script ]]
+	aotLib[0x53f31391d7ece01d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
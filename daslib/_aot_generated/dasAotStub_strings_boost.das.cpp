@@ -0,0 +1,389 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require strings_boost
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5172167967587827064 {
+
+extern TypeInfo __type_info__6f902bb202c1ac85;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__2a6ca4b563f875a3;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__185ee399728dead3;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__e989483f695bcee9;
+extern FuncInfo __func_info__7fac1bd753cba6aa;
+
+VarInfo __func_info__7fac1bd753cba6aa_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, nullptr, nullptr, 0, 0, nullptr, 57442, 24, UINT64_C(0xe989483f695bcee9), "arr", 0 };
+VarInfo * __func_info__7fac1bd753cba6aa_fields[1] =  { &__func_info__7fac1bd753cba6aa_field_0 };
+FuncInfo __func_info__7fac1bd753cba6aa = {"invoke block<(arr:array<string> const#):void> const", "", __func_info__7fac1bd753cba6aa_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x7fac1bd753cba6aa), 0x0 };
+TypeInfo __type_info__6f902bb202c1ac85 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 24, UINT64_C(0x6f902bb202c1ac85) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__2a6ca4b563f875a3 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x2a6ca4b563f875a3) };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+TypeInfo __type_info__185ee399728dead3 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__2a6ca4b563f875a3, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x185ee399728dead3) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__6f902bb202c1ac85 };
+TypeInfo * __tinfo_1[1] = { &__type_info__185ee399728dead3 };
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_clone_c4443fdeccc198b5 ( Context * __context__, TArray<char *> & __a_rename_at_336, TArray<char *> const  & __b_rename_at_336 );
+inline TArray<char *> & _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465 ( Context * __context__, TArray<char *> & __a_rename_at_42 );
+inline void _Funcbuiltin_0x60_finalize_b509dde46ca14424 ( Context * __context__, TArray<TArray<int32_t>> & __a_rename_at_395 );
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> & __a_rename_at_395 );
+inline void _Funcbuiltin_0x60_resize_587b2aa94c7155cf ( Context * __context__, TArray<TArray<int32_t>> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_swap_9c26497759a39ade ( Context * __context__, TArray<int32_t> & __a_rename_at_765, TArray<int32_t> & __b_rename_at_765 );
+inline char * wide_ced1b7c44af9efab ( Context * __context__, char * const  __text_rename_at_10, int32_t __width_rename_at_10 );
+inline TArray<char *> split_9ae7413d8a97c7f9 ( Context * __context__, char * const  __text_rename_at_59, char * const  __delim_rename_at_59 );
+inline TArray<char *> split_by_chars_9aeed0dc41cd9810 ( Context * __context__, char * const  __text_rename_at_68, char * const  __delim_rename_at_68 );
+inline int32_t levenshtein_distance_4aaa1c7b844035fc ( Context * __context__, char * const  __s_rename_at_88, char * const  __t_rename_at_88 );
+inline int32_t levenshtein_distance_fast_79ab755291b2c201 ( Context * __context__, char * const  __s_rename_at_111, char * const  __t_rename_at_111 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7 ( Context * __context__, TArray<char *> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_clone_c4443fdeccc198b5 ( Context * __context__, TArray<char *> &  __a_rename_at_336, TArray<char *> const  &  __b_rename_at_336 )
+{
+	_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7(__context__,das_arg<TArray<char *>>::pass(__a_rename_at_336),builtin_array_size(__b_rename_at_336));
+	{
+		bool __need_loop_338 = true;
+		// aV : string aka TT&
+		das_iterator<TArray<char *>> __aV_iterator(__a_rename_at_336);
+		char * * __aV_rename_at_338;
+		__need_loop_338 = __aV_iterator.first(__context__,(__aV_rename_at_338)) && __need_loop_338;
+		// bV : string const&#
+		das_iterator<TArray<char *> const > __bV_iterator(__b_rename_at_336);
+		char * const  * __bV_rename_at_338;
+		__need_loop_338 = __bV_iterator.first(__context__,(__bV_rename_at_338)) && __need_loop_338;
+		for ( ; __need_loop_338 ; __need_loop_338 = __aV_iterator.next(__context__,(__aV_rename_at_338)) && __bV_iterator.next(__context__,(__bV_rename_at_338)) )
+		{
+			das_copy((*__aV_rename_at_338),((char *)(builtin_string_clone((*__bV_rename_at_338),__context__))));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_338));
+		__bV_iterator.close(__context__,(__bV_rename_at_338));
+	};
+}
+
+inline TArray<char *> & _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465 ( Context * __context__, TArray<char *> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<char *> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<char *> &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcbuiltin_0x60_finalize_b509dde46ca14424 ( Context * __context__, TArray<TArray<int32_t>> &  __a_rename_at_395 )
+{
+	{
+		bool __need_loop_397 = true;
+		// aV : array<int> aka TT&
+		das_iterator<TArray<TArray<int32_t>>> __aV_iterator(__a_rename_at_395);
+		TArray<int32_t> * __aV_rename_at_397;
+		__need_loop_397 = __aV_iterator.first(__context__,(__aV_rename_at_397)) && __need_loop_397;
+		for ( ; __need_loop_397 ; __need_loop_397 = __aV_iterator.next(__context__,(__aV_rename_at_397)) )
+		{
+			builtin_array_free(das_arg<TArray<int32_t>>::pass((*__aV_rename_at_397)),4,__context__);
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_397));
+	};
+	builtin_array_free(das_arg<TArray<TArray<int32_t>>>::pass(__a_rename_at_395),24,__context__);
+}
+
+inline void _Funcbuiltin_0x60_finalize_c5f896860856389a ( Context * __context__, TArray<int32_t> &  __a_rename_at_395 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(__a_rename_at_395),4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_587b2aa94c7155cf ( Context * __context__, TArray<TArray<int32_t>> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<TArray<TArray<int32_t>> &>::from(__Arr_rename_at_54)));
+	builtin_array_resize(das_arg<TArray<TArray<int32_t>>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,24,__context__);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_swap_9c26497759a39ade ( Context * __context__, TArray<int32_t> &  __a_rename_at_765, TArray<int32_t> &  __b_rename_at_765 )
+{
+	TArray<int32_t> __t_rename_at_766; das_zero(__t_rename_at_766); das_move(__t_rename_at_766, __a_rename_at_765);
+	das_move(__a_rename_at_765,__b_rename_at_765);
+	das_move(__b_rename_at_765,__t_rename_at_766);
+}
+
+inline char * wide_ced1b7c44af9efab ( Context * __context__, char * const  __text_rename_at_10, int32_t __width_rename_at_10 )
+{
+	int32_t __extra_rename_at_11 = ((int32_t)(__width_rename_at_10 - builtin_string_length(__text_rename_at_10,__context__)));
+	return das_auto_cast<char *>::cast((__extra_rename_at_11 > 0) ? das_auto_cast<char *>::cast((cast<char *>::to(SimPolicy<char *>::Add(cast<char *>::from(__text_rename_at_10),cast<char *>::from(((char *)(string_repeat(((char *) " "),__extra_rename_at_11,__context__)))),*__context__,nullptr)))) : das_auto_cast<char *>::cast(__text_rename_at_10));
+}
+
+inline TArray<char *> split_9ae7413d8a97c7f9 ( Context * __context__, char * const  __text_rename_at_59, char * const  __delim_rename_at_59 ) { das_stack_prologue __prologue(__context__,128,"split " DAS_FILE_LINE);
+{
+	TArray<char *> __res_rename_at_60; das_zero(__res_rename_at_60);
+	builtin_string_split(__text_rename_at_59,__delim_rename_at_59,das_make_block<void,TArray<char *> const  &>(__context__,112,0,&__func_info__7fac1bd753cba6aa,[&](TArray<char *> const  & __arr_rename_at_61) -> void{
+		_Funcbuiltin_0x60_clone_c4443fdeccc198b5(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_60),__arr_rename_at_61);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_60)));
+}}
+
+inline TArray<char *> split_by_chars_9aeed0dc41cd9810 ( Context * __context__, char * const  __text_rename_at_68, char * const  __delim_rename_at_68 ) { das_stack_prologue __prologue(__context__,128,"split_by_chars " DAS_FILE_LINE);
+{
+	TArray<char *> __res_rename_at_69; das_zero(__res_rename_at_69);
+	builtin_string_split_by_char(__text_rename_at_68,__delim_rename_at_68,das_make_block<void,TArray<char *> const  &>(__context__,112,0,&__func_info__7fac1bd753cba6aa,[&](TArray<char *> const  & __arr_rename_at_70) -> void{
+		_Funcbuiltin_0x60_clone_c4443fdeccc198b5(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_69),__arr_rename_at_70);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465(__context__,das_arg<TArray<char *>>::pass(__res_rename_at_69)));
+}}
+
+inline int32_t levenshtein_distance_4aaa1c7b844035fc ( Context * __context__, char * const  __s_rename_at_88, char * const  __t_rename_at_88 )
+{
+	int32_t __sLen_rename_at_89; memset(&__sLen_rename_at_89,0,sizeof(__sLen_rename_at_89));
+	int32_t __tLen_rename_at_90; memset(&__tLen_rename_at_90,0,sizeof(__tLen_rename_at_90));
+	TArray<TArray<int32_t>> __d_rename_at_91; memset(&__d_rename_at_91,0,sizeof(__d_rename_at_91));
+	int32_t __substitutionCost_rename_at_101; memset(&__substitutionCost_rename_at_101,0,sizeof(__substitutionCost_rename_at_101));
+/* finally */ auto __finally_89= das_finally([&](){
+	_Funcbuiltin_0x60_finalize_b509dde46ca14424(__context__,das_arg<TArray<TArray<int32_t>>>::pass(__d_rename_at_91));
+/* end finally */ });
+	__sLen_rename_at_89 = ((int32_t)builtin_string_length(__s_rename_at_88,__context__));
+	__tLen_rename_at_90 = ((int32_t)builtin_string_length(__t_rename_at_88,__context__));
+	__d_rename_at_91; das_zero(__d_rename_at_91);
+	_Funcbuiltin_0x60_resize_587b2aa94c7155cf(__context__,das_arg<TArray<TArray<int32_t>>>::pass(__d_rename_at_91),__sLen_rename_at_89 + 1);
+	{
+		bool __need_loop_93 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__sLen_rename_at_89 + 1));
+		int32_t __i_rename_at_93;
+		__need_loop_93 = __i_iterator.first(__context__,(__i_rename_at_93)) && __need_loop_93;
+		for ( ; __need_loop_93 ; __need_loop_93 = __i_iterator.next(__context__,(__i_rename_at_93)) )
+		{
+			_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__d_rename_at_91(__i_rename_at_93,__context__)),__tLen_rename_at_90 + 1);
+			das_copy(__d_rename_at_91(__i_rename_at_93,__context__)(0,__context__),__i_rename_at_93);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_93));
+	};
+	{
+		bool __need_loop_96 = true;
+		// j : int const
+		das_iterator<range> __j_iterator(mk_range(__tLen_rename_at_90 + 1));
+		int32_t __j_rename_at_96;
+		__need_loop_96 = __j_iterator.first(__context__,(__j_rename_at_96)) && __need_loop_96;
+		for ( ; __need_loop_96 ; __need_loop_96 = __j_iterator.next(__context__,(__j_rename_at_96)) )
+		{
+			das_copy(__d_rename_at_91(0,__context__)(__j_rename_at_96,__context__),__j_rename_at_96);
+		}
+		__j_iterator.close(__context__,(__j_rename_at_96));
+	};
+	{
+		bool __need_loop_99 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__sLen_rename_at_89 + 1));
+		int32_t __i_rename_at_99;
+		__need_loop_99 = __i_iterator.first(__context__,(__i_rename_at_99)) && __need_loop_99;
+		for ( ; __need_loop_99 ; __need_loop_99 = __i_iterator.next(__context__,(__i_rename_at_99)) )
+		{
+			{
+				bool __need_loop_100 = true;
+				// j : int const
+				das_iterator<range> __j_iterator(range(1,__tLen_rename_at_90 + 1));
+				int32_t __j_rename_at_100;
+				__need_loop_100 = __j_iterator.first(__context__,(__j_rename_at_100)) && __need_loop_100;
+				for ( ; __need_loop_100 ; __need_loop_100 = __j_iterator.next(__context__,(__j_rename_at_100)) )
+				{
+					__substitutionCost_rename_at_101 = ((int32_t)((get_character_uat(__s_rename_at_88,__i_rename_at_99 - 1) == get_character_uat(__t_rename_at_88,__j_rename_at_100 - 1)) ? das_auto_cast<int32_t>::cast(0) : das_auto_cast<int32_t>::cast(1)));
+					das_copy(__d_rename_at_91(__i_rename_at_99,__context__)(__j_rename_at_100,__context__),SimPolicy<int32_t>::Min(__d_rename_at_91((__i_rename_at_99 - 1),__context__)(__j_rename_at_100,__context__) + 1,__d_rename_at_91(__i_rename_at_99,__context__)((__j_rename_at_100 - 1),__context__) + 1,*__context__,nullptr));
+					das_copy(__d_rename_at_91(__i_rename_at_99,__context__)(__j_rename_at_100,__context__),SimPolicy<int32_t>::Min(__d_rename_at_91(__i_rename_at_99,__context__)(__j_rename_at_100,__context__),__d_rename_at_91((__i_rename_at_99 - 1),__context__)((__j_rename_at_100 - 1),__context__) + __substitutionCost_rename_at_101,*__context__,nullptr));
+				}
+				__j_iterator.close(__context__,(__j_rename_at_100));
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_99));
+	};
+	return das_auto_cast<int32_t>::cast(__d_rename_at_91(__sLen_rename_at_89,__context__)(__tLen_rename_at_90,__context__));
+}
+
+inline int32_t levenshtein_distance_fast_79ab755291b2c201 ( Context * __context__, char * const  __s_rename_at_111, char * const  __t_rename_at_111 )
+{
+	int32_t __sLen_rename_at_112; memset(&__sLen_rename_at_112,0,sizeof(__sLen_rename_at_112));
+	int32_t __tLen_rename_at_113; memset(&__tLen_rename_at_113,0,sizeof(__tLen_rename_at_113));
+	TArray<int32_t> __v0_rename_at_114; memset(&__v0_rename_at_114,0,sizeof(__v0_rename_at_114));
+	TArray<int32_t> __v1_rename_at_116; memset(&__v1_rename_at_116,0,sizeof(__v1_rename_at_116));
+	int32_t __deletionCost_rename_at_124; memset(&__deletionCost_rename_at_124,0,sizeof(__deletionCost_rename_at_124));
+	int32_t __insertionCost_rename_at_125; memset(&__insertionCost_rename_at_125,0,sizeof(__insertionCost_rename_at_125));
+	int32_t __substitutionCost_rename_at_126; memset(&__substitutionCost_rename_at_126,0,sizeof(__substitutionCost_rename_at_126));
+/* finally */ auto __finally_112= das_finally([&](){
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__v0_rename_at_114));
+	_Funcbuiltin_0x60_finalize_c5f896860856389a(__context__,das_arg<TArray<int32_t>>::pass(__v1_rename_at_116));
+/* end finally */ });
+	__sLen_rename_at_112 = ((int32_t)builtin_string_length(__s_rename_at_111,__context__));
+	__tLen_rename_at_113 = ((int32_t)builtin_string_length(__t_rename_at_111,__context__));
+	__v0_rename_at_114; das_zero(__v0_rename_at_114);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__v0_rename_at_114),__tLen_rename_at_113 + 1);
+	__v1_rename_at_116; das_zero(__v1_rename_at_116);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__v1_rename_at_116),__tLen_rename_at_113 + 1);
+	{
+		bool __need_loop_118 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__tLen_rename_at_113 + 1));
+		int32_t __i_rename_at_118;
+		__need_loop_118 = __i_iterator.first(__context__,(__i_rename_at_118)) && __need_loop_118;
+		for ( ; __need_loop_118 ; __need_loop_118 = __i_iterator.next(__context__,(__i_rename_at_118)) )
+		{
+			das_copy(__v0_rename_at_114(__i_rename_at_118,__context__),__i_rename_at_118);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_118));
+	};
+	{
+		bool __need_loop_121 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,__sLen_rename_at_112));
+		int32_t __i_rename_at_121;
+		__need_loop_121 = __i_iterator.first(__context__,(__i_rename_at_121)) && __need_loop_121;
+		for ( ; __need_loop_121 ; __need_loop_121 = __i_iterator.next(__context__,(__i_rename_at_121)) )
+		{
+			das_copy(__v1_rename_at_116(0,__context__),__i_rename_at_121 + 1);
+			{
+				bool __need_loop_123 = true;
+				// j : int const
+				das_iterator<range> __j_iterator(range(0,__tLen_rename_at_113));
+				int32_t __j_rename_at_123;
+				__need_loop_123 = __j_iterator.first(__context__,(__j_rename_at_123)) && __need_loop_123;
+				for ( ; __need_loop_123 ; __need_loop_123 = __j_iterator.next(__context__,(__j_rename_at_123)) )
+				{
+					__deletionCost_rename_at_124 = ((int32_t)(__v0_rename_at_114((__j_rename_at_123 + 1),__context__) + 1));
+					__insertionCost_rename_at_125 = ((int32_t)(__v1_rename_at_116(__j_rename_at_123,__context__) + 1));
+					__substitutionCost_rename_at_126 = ((int32_t)(__v0_rename_at_114(__j_rename_at_123,__context__) + ((get_character_uat(__s_rename_at_111,__i_rename_at_121) == get_character_uat(__t_rename_at_111,__j_rename_at_123)) ? das_auto_cast<int32_t>::cast(0) : das_auto_cast<int32_t>::cast(1))));
+					das_copy(__v1_rename_at_116((__j_rename_at_123 + 1),__context__),SimPolicy<int32_t>::Min(__deletionCost_rename_at_124,__insertionCost_rename_at_125,*__context__,nullptr));
+					das_copy(__v1_rename_at_116((__j_rename_at_123 + 1),__context__),SimPolicy<int32_t>::Min(__v1_rename_at_116((__j_rename_at_123 + 1),__context__),__substitutionCost_rename_at_126,*__context__,nullptr));
+				}
+				__j_iterator.close(__context__,(__j_rename_at_123));
+			};
+			_Funcbuiltin_0x60_swap_9c26497759a39ade(__context__,das_arg<TArray<int32_t>>::pass(__v0_rename_at_114),das_arg<TArray<int32_t>>::pass(__v1_rename_at_116));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_121));
+	};
+	return das_auto_cast<int32_t>::cast(__v0_rename_at_114(__tLen_rename_at_113,__context__));
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_1ce0ec61a4618bc7
+	aotLib[0xdd4771637ebae089] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&_Funcbuiltin_0x60_resize_1ce0ec61a4618bc7>>();
+	};
+	// _Funcbuiltin_0x60_clone_c4443fdeccc198b5
+	aotLib[0x3d1ffddebc32e5ef] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , TArray<char *> const  &  ),&_Funcbuiltin_0x60_clone_c4443fdeccc198b5>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465
+	aotLib[0xed99ea3c3e04d451] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<char *> & (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_28fbc15184957465>>();
+	};
+	// _Funcbuiltin_0x60_finalize_b509dde46ca14424
+	aotLib[0x26192053e4fba60d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> &  ),&_Funcbuiltin_0x60_finalize_b509dde46ca14424>>();
+	};
+	// _Funcbuiltin_0x60_finalize_c5f896860856389a
+	aotLib[0x670f07fb3b9ac4b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_finalize_c5f896860856389a>>();
+	};
+	// _Funcbuiltin_0x60_resize_587b2aa94c7155cf
+	aotLib[0xfdcc4c7d9a23aaad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> & , int32_t  ),&_Funcbuiltin_0x60_resize_587b2aa94c7155cf>>();
+	};
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Funcbuiltin_0x60_swap_9c26497759a39ade
+	aotLib[0xf89b2a533457b6a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> &  ),&_Funcbuiltin_0x60_swap_9c26497759a39ade>>();
+	};
+	// wide_ced1b7c44af9efab
+	aotLib[0x3b0c851ba21588f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, char * const  , int32_t  ),&wide_ced1b7c44af9efab>>();
+	};
+	// split_9ae7413d8a97c7f9
+	aotLib[0x85469d330a844d25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, char * const  , char * const   ),&split_9ae7413d8a97c7f9>>();
+	};
+	// split_by_chars_9aeed0dc41cd9810
+	aotLib[0x849e6f3c02f05ab1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, char * const  , char * const   ),&split_by_chars_9aeed0dc41cd9810>>();
+	};
+	// levenshtein_distance_4aaa1c7b844035fc
+	aotLib[0x6ee6e0e2a7ce51c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, char * const  , char * const   ),&levenshtein_distance_4aaa1c7b844035fc>>();
+	};
+	// levenshtein_distance_fast_79ab755291b2c201
+	aotLib[0xcabb2f8917277d98] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, char * const  , char * const   ),&levenshtein_distance_fast_79ab755291b2c201>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,866 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require path_tracer
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require random
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_17967810693933513202 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace path_tracer { struct Sphere; };
+namespace path_tracer { struct Ray; };
+namespace path_tracer { struct Hit; };
+namespace path_tracer { struct Camera; };
+namespace path_tracer { struct Material; };
+namespace random { struct _lambda_random_95_8_1; };
+// unused structure _lambda_random_95_8_1
+namespace path_tracer {
+
+enum class Type : int32_t {
+	Lambert = int32_t(0),
+	Metal = int32_t(1),
+	Dielectric = int32_t(2),
+};
+}
+}
+template <> struct cast< das::_anon_17967810693933513202::path_tracer::Type > : cast_enum < das::_anon_17967810693933513202::path_tracer::Type > {};
+namespace _anon_17967810693933513202 {
+namespace path_tracer {
+
+struct Sphere {
+	float3 center;
+	float radius;
+	float radius2;
+	float iRadius;
+	float pad1;
+	float pad2;
+};
+static_assert(sizeof(Sphere)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Sphere,center)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Sphere,radius)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Sphere,radius2)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Sphere,iRadius)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(Sphere,pad1)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(Sphere,pad2)==28,"structure field offset mismatch with DAS");
+}
+namespace path_tracer {
+
+struct Ray {
+	float3 orig;
+	float pad1;
+	float3 dir;
+	float pad2;
+};
+static_assert(sizeof(Ray)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Ray,orig)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Ray,pad1)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Ray,dir)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Ray,pad2)==28,"structure field offset mismatch with DAS");
+}
+namespace path_tracer {
+
+struct Hit {
+	float3 pos;
+	float pad;
+	float3 normal;
+	float t;
+};
+static_assert(sizeof(Hit)==32,"structure size mismatch with DAS");
+static_assert(offsetof(Hit,pos)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Hit,pad)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Hit,normal)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Hit,t)==28,"structure field offset mismatch with DAS");
+}
+namespace path_tracer {
+
+struct Camera {
+	float3 origin;
+	float3 lowerLeftCorner;
+	float3 horizontal;
+	float3 vertical;
+	float3 u;
+	float3 v;
+	float3 w;
+	float lensRadius;
+};
+static_assert(sizeof(Camera)==88,"structure size mismatch with DAS");
+static_assert(offsetof(Camera,origin)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Camera,lowerLeftCorner)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(Camera,horizontal)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(Camera,vertical)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(Camera,u)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(Camera,v)==60,"structure field offset mismatch with DAS");
+static_assert(offsetof(Camera,w)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(Camera,lensRadius)==84,"structure field offset mismatch with DAS");
+}
+namespace path_tracer {
+
+struct Material {
+	DAS_COMMENT(enum) path_tracer::Type mtype;
+	float3 albedo;
+	float3 emissive;
+	float roughness;
+	float ri;
+};
+static_assert(sizeof(Material)==36,"structure size mismatch with DAS");
+static_assert(offsetof(Material,mtype)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Material,albedo)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Material,emissive)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Material,roughness)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(Material,ri)==32,"structure field offset mismatch with DAS");
+}
+
+inline int4 _Funcrandom_0x60_random_int4_328b2382cfdb0a5d ( Context * __context__, int4 & __seed_rename_at_46 );
+inline int32_t _Funcrandom_0x60_random_int_2fd6061b7238802b ( Context * __context__, int4 & __seed_rename_at_26 );
+inline float3 _Funcrandom_0x60_random_in_unit_disk_874af9e531879036 ( Context * __context__, int4 & __seed_rename_at_83 );
+inline float3 _Funcrandom_0x60_random_unit_vector_5539c3ea4d7bb631 ( Context * __context__, int4 & __seed_rename_at_62 );
+inline float4 _Funcrandom_0x60_random_float4_a7bd627b7b8adf8a ( Context * __context__, int4 & __seed_rename_at_57 );
+inline float3 _Funcrandom_0x60_random_in_unit_sphere_1168887ec1db780f ( Context * __context__, int4 & __seed_rename_at_73 );
+inline float _Funcrandom_0x60_random_float_74d9bf7d99102f00 ( Context * __context__, int4 & __seed_rename_at_52 );
+inline int4 _Funcrandom_0x60_random_seed_40d32f1495a9708e ( Context * __context__, int32_t __seed_rename_at_14 );
+inline float schlick_3a9821b8198433c4 ( Context * __context__, float __cosine_rename_at_23, float __ri_rename_at_23 );
+inline float3 pointAt_719bd5c2cfc420b ( Context * __context__, path_tracer::Ray const  & __ray_rename_at_40, float __t_rename_at_40 );
+inline path_tracer::Camera Camera_7addb42ca6ffc84f ( Context * __context__, float3 __lookFrom_rename_at_57, float3 __lookAt_rename_at_57, float3 __vup_rename_at_57, float __vfov_rename_at_57, float __aspect_rename_at_57, float __aperture_rename_at_57, float __focusDist_rename_at_57 );
+inline path_tracer::Ray getRay_d878b35dfe5b23a4 ( Context * __context__, path_tracer::Camera const  & __that_rename_at_73, float __s_rename_at_73, float __t_rename_at_73 );
+inline void init_path_tracer_54acd80a2e66fe06 ( Context * __context__ );
+inline int32_t hitSpheres_6a52fbdded54c2ce ( Context * __context__, path_tracer::Ray const  & __r_rename_at_117, float __tMin_rename_at_117, float __tMax_rename_at_117, path_tracer::Hit & __outHit_rename_at_117 );
+inline bool hitWorld_ceaa1549ef22bdf8 ( Context * __context__, path_tracer::Ray const  & __r_rename_at_141, float __tMin_rename_at_141, float __tMax_rename_at_141, path_tracer::Hit & __outHit_rename_at_141, int32_t & __outID_rename_at_141 );
+inline bool scatter_4ed833c6250d0618 ( Context * __context__, path_tracer::Material const  & __mat_rename_at_145, path_tracer::Ray const  & __r_in_rename_at_145, path_tracer::Hit const  & __rec_rename_at_145, float3 & __attenuation_rename_at_145, path_tracer::Ray & __scattered_rename_at_145, float3 & __outLightE_rename_at_145, int32_t & __inoutRayCount_rename_at_145 );
+inline float3 trace_6bc5ad316fda0152 ( Context * __context__, path_tracer::Ray const  & __r_rename_at_202, int32_t & __inoutRayCount_rename_at_202 );
+inline int32_t trace_413a8cbe9a84b3c4 ( Context * __context__, int32_t __screenWidth_rename_at_233, int32_t __screenHeight_rename_at_233, int32_t __frameCount_rename_at_233, int32_t __ymin_rename_at_233, int32_t __ymax_rename_at_233, TArray<float3> & __backbuffer_rename_at_233, path_tracer::Camera const  & __cam_rename_at_233 );
+inline float3 draw_ray_68256aa0069590f6 ( Context * __context__, int32_t __x_rename_at_250, int32_t __y_rename_at_250, int32_t __screenWidth_rename_at_250, int32_t __screenHeight_rename_at_250 );
+inline void draw_37c2e8e354406bbd ( Context * __context__, int32_t __frameCount_rename_at_265, int32_t __screenWidth_rename_at_265, int32_t __screenHeight_rename_at_265, int32_t __ymin_rename_at_265, int32_t __ymax_rename_at_265, TArray<float3> & __backbuffer_rename_at_265, int32_t & __outRayCount_rename_at_265 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0xebcc0637cf397584>(__context__) = 32;/*DO_SAMPLES_PER_PIXEL*/
+	das_global<int32_t,0xde9a2b7cf221ae06>(__context__) = 8;/*LIGHT_SPHERE_ID*/
+	das_global<float,0xc0e6ee550d9b5968>(__context__) = 0.00100000005f;/*kMinT*/
+	das_global<float,0x2863f9a77cc4d6e>(__context__) = 10000000.f;/*kMaxT*/
+	das_global<int32_t,0x90e4e6eaa4205cac>(__context__) = 10;/*kMaxDepth*/
+	das_global_zero<int4,0xaa36806050759e34>(__context__);/*RAND_SEED*/
+	das_global<int32_t,0xf9b141ee9642e0d7>(__context__) = 9;/*TOTAL_SPHERES*/
+	das_global_zero<TDim<path_tracer::Sphere,9>,0x769c3f4bc2a503af>(__context__);/*s_Spheres*/
+	das_global_zero<TDim<path_tracer::Material,9>,0x587a7e569a38aeb7>(__context__);/*s_SphereMats*/
+}
+
+inline int4 _Funcrandom_0x60_random_int4_328b2382cfdb0a5d ( Context * __context__, int4 & __seed_rename_at_46 )
+{
+	das_copy(__seed_rename_at_46,SimPolicy<int4>::Add((SimPolicy<int4>::Mul(int4(214013,214013,214013,214013),__seed_rename_at_46,*__context__,nullptr)),int4(2531011,2531011,2531011,2531011),*__context__,nullptr));
+	return das_auto_cast<int4>::cast(SimPolicy<int4>::BinAnd((SimPolicy<int4>::BinShr(__seed_rename_at_46,cast<int32_t>::from(16),*__context__,nullptr)),int4(32767,32767,32767,32767),*__context__,nullptr));
+}
+
+inline int32_t _Funcrandom_0x60_random_int_2fd6061b7238802b ( Context * __context__, int4 & __seed_rename_at_26 )
+{
+	das_copy(das_swizzle_ref<int32_t,int4,0>::swizzle(__seed_rename_at_26) /*x*/,(v_extract_xi(v_cast_vec4i(__seed_rename_at_26)) /*x*/ * 214013) + 2531011);
+	return das_auto_cast<int32_t>::cast((v_extract_xi(v_cast_vec4i(__seed_rename_at_26)) /*x*/ >> 16) & 32767);
+}
+
+inline float3 _Funcrandom_0x60_random_in_unit_disk_874af9e531879036 ( Context * __context__, int4 & __seed_rename_at_83 )
+{
+	while ( true )
+	{
+		float2 __R_rename_at_86 = ((float2)das_swizzle_seq<float2,float4,0>::swizzle(_Funcrandom_0x60_random_float4_a7bd627b7b8adf8a(__context__,__seed_rename_at_83)) /*xy*/);
+		float3 __r_rename_at_87 = ((float3)float3(v_extract_x(__R_rename_at_86) /*x*/,v_extract_y(__R_rename_at_86) /*y*/,0.f));
+		float3 __p_rename_at_88 = ((float3)(SimPolicy<float3>::Sub((SimPolicy<float3>::Mul(v_splats(2.f),__r_rename_at_87,*__context__,nullptr)),v_make_vec4f(1.f,1.f,0.f,0.f),*__context__,nullptr)));
+		if ( lengthSq3(__p_rename_at_88) <= 1.f )
+		{
+			return das_auto_cast<float3>::cast(__p_rename_at_88);
+		};
+	};
+	return das_auto_cast<float3>::cast(v_zero());
+}
+
+inline float3 _Funcrandom_0x60_random_unit_vector_5539c3ea4d7bb631 ( Context * __context__, int4 & __seed_rename_at_62 )
+{
+	float4 __zz_rename_at_64 = ((float4)_Funcrandom_0x60_random_float4_a7bd627b7b8adf8a(__context__,__seed_rename_at_62));
+	float __z_rename_at_65 = ((float)((v_extract_x(__zz_rename_at_64) /*x*/ * 2.f) - 1.f));
+	float __a_rename_at_66 = ((float)(v_extract_y(__zz_rename_at_64) /*y*/ * 6.28318548f));
+	float __r_rename_at_67 = ((float)SimPolicy<float>::Sqrt(1.f - (__z_rename_at_65 * __z_rename_at_65),*__context__,nullptr));
+	float __x_rename_at_68 = 0; float __y_rename_at_68 = 0;
+	sincosF(__a_rename_at_66,__x_rename_at_68,__y_rename_at_68);
+	return das_auto_cast<float3>::cast(float3(__r_rename_at_67 * __x_rename_at_68,__r_rename_at_67 * __y_rename_at_68,__z_rename_at_65));
+}
+
+inline float4 _Funcrandom_0x60_random_float4_a7bd627b7b8adf8a ( Context * __context__, int4 & __seed_rename_at_57 )
+{
+	return das_auto_cast<float4>::cast(SimPolicy<float4>::Mul(cvt_ifloat4(_Funcrandom_0x60_random_int4_328b2382cfdb0a5d(__context__,__seed_rename_at_57)),v_splats(3.05185094e-05f),*__context__,nullptr));
+}
+
+inline float3 _Funcrandom_0x60_random_in_unit_sphere_1168887ec1db780f ( Context * __context__, int4 & __seed_rename_at_73 )
+{
+	while ( true )
+	{
+		float3 __r_rename_at_76 = ((float3)das_swizzle_seq<float3,float4,0>::swizzle(_Funcrandom_0x60_random_float4_a7bd627b7b8adf8a(__context__,__seed_rename_at_73)) /*xyz*/);
+		float3 __p_rename_at_77 = ((float3)(SimPolicy<float3>::Sub((SimPolicy<float3>::Mul(v_splats(2.f),__r_rename_at_76,*__context__,nullptr)),v_splats(1.f),*__context__,nullptr)));
+		if ( lengthSq3(__p_rename_at_77) <= 1.f )
+		{
+			return das_auto_cast<float3>::cast(__p_rename_at_77);
+		};
+	};
+	return das_auto_cast<float3>::cast(v_zero());
+}
+
+inline float _Funcrandom_0x60_random_float_74d9bf7d99102f00 ( Context * __context__, int4 & __seed_rename_at_52 )
+{
+	return das_auto_cast<float>::cast(float(_Funcrandom_0x60_random_int_2fd6061b7238802b(__context__,__seed_rename_at_52)) * 3.05185094e-05f);
+}
+
+inline int4 _Funcrandom_0x60_random_seed_40d32f1495a9708e ( Context * __context__, int32_t __seed_rename_at_14 )
+{
+	return das_auto_cast<int4>::cast(int4(__seed_rename_at_14,__seed_rename_at_14 + 1,__seed_rename_at_14 + 2,__seed_rename_at_14 + 3));
+}
+
+inline float schlick_3a9821b8198433c4 ( Context * __context__, float __cosine_rename_at_23, float __ri_rename_at_23 )
+{
+	float __r0_rename_at_24 = (SimPolicy<float>::Div((1.f - __ri_rename_at_23),(__ri_rename_at_23 + 1.f),*__context__,nullptr));
+	return das_auto_cast<float>::cast(SimPolicy<float>::Lerp(__r0_rename_at_24 * __r0_rename_at_24,1.f,SimPolicy<float>::Pow(1.f - __cosine_rename_at_23,5.f,*__context__,nullptr),*__context__,nullptr));
+}
+
+inline float3 pointAt_719bd5c2cfc420b ( Context * __context__, path_tracer::Ray const  &  __ray_rename_at_40, float __t_rename_at_40 )
+{
+	return das_auto_cast<float3>::cast(SimPolicy<float3>::Add(__ray_rename_at_40.orig,(SimPolicy<float3>::MulVecScal(__ray_rename_at_40.dir,cast<float>::from(__t_rename_at_40),*__context__,nullptr)),*__context__,nullptr));
+}
+
+inline path_tracer::Camera Camera_7addb42ca6ffc84f ( Context * __context__, float3 __lookFrom_rename_at_57, float3 __lookAt_rename_at_57, float3 __vup_rename_at_57, float __vfov_rename_at_57, float __aspect_rename_at_57, float __aperture_rename_at_57, float __focusDist_rename_at_57 )
+{
+	path_tracer::Camera __that_rename_at_58; das_zero(__that_rename_at_58);
+	float __theta_rename_at_59 = ((float)(SimPolicy<float>::Div((__vfov_rename_at_57 * 3.14159274f),180.f,*__context__,nullptr)));
+	float __halfHeight_rename_at_60 = ((float)SimPolicy<float>::Tan(SimPolicy<float>::Div(__theta_rename_at_59,2.f,*__context__,nullptr),*__context__,nullptr));
+	float __halfWidth_rename_at_61 = ((float)(__aspect_rename_at_57 * __halfHeight_rename_at_60));
+	das_copy(__that_rename_at_58.lensRadius,SimPolicy<float>::Div(__aperture_rename_at_57,2.f,*__context__,nullptr));
+	das_copy(__that_rename_at_58.origin,__lookFrom_rename_at_57);
+	das_copy(__that_rename_at_58.w,normalize3(SimPolicy<float3>::Sub(__lookFrom_rename_at_57,__lookAt_rename_at_57,*__context__,nullptr)));
+	das_copy(__that_rename_at_58.u,normalize3(cross3(__vup_rename_at_57,__that_rename_at_58.w)));
+	das_copy(__that_rename_at_58.v,cross3(__that_rename_at_58.w,__that_rename_at_58.u));
+	das_copy(__that_rename_at_58.lowerLeftCorner,SimPolicy<float3>::Sub((SimPolicy<float3>::Sub((SimPolicy<float3>::Sub(__that_rename_at_58.origin,(SimPolicy<float3>::MulScalVec(cast<float>::from((__halfWidth_rename_at_61 * __focusDist_rename_at_57)),__that_rename_at_58.u,*__context__,nullptr)),*__context__,nullptr)),(SimPolicy<float3>::MulScalVec(cast<float>::from((__halfHeight_rename_at_60 * __focusDist_rename_at_57)),__that_rename_at_58.v,*__context__,nullptr)),*__context__,nullptr)),(SimPolicy<float3>::MulScalVec(cast<float>::from(__focusDist_rename_at_57),__that_rename_at_58.w,*__context__,nullptr)),*__context__,nullptr));
+	das_copy(__that_rename_at_58.horizontal,SimPolicy<float3>::MulScalVec(cast<float>::from(((__halfWidth_rename_at_61 * 2.f) * __focusDist_rename_at_57)),__that_rename_at_58.u,*__context__,nullptr));
+	das_copy(__that_rename_at_58.vertical,SimPolicy<float3>::MulScalVec(cast<float>::from(((__halfHeight_rename_at_60 * 2.f) * __focusDist_rename_at_57)),__that_rename_at_58.v,*__context__,nullptr));
+	return das_auto_cast_ref<path_tracer::Camera>::cast(__that_rename_at_58);
+}
+
+inline path_tracer::Ray getRay_d878b35dfe5b23a4 ( Context * __context__, path_tracer::Camera const  &  __that_rename_at_73, float __s_rename_at_73, float __t_rename_at_73 )
+{
+	float3 __rd_rename_at_75 = ((float3)(SimPolicy<float3>::MulScalVec(cast<float>::from(__that_rename_at_73.lensRadius),_Funcrandom_0x60_random_in_unit_disk_874af9e531879036(__context__,das_global<int4,0xaa36806050759e34>(__context__) /*RAND_SEED*/),*__context__,nullptr)));
+	float3 __offset_rename_at_76 = ((float3)SimPolicy<float3>::MadS(__that_rename_at_73.u,cast<float>::from(v_extract_x(__rd_rename_at_75) /*x*/),SimPolicy<float3>::MulVecScal(__that_rename_at_73.v,cast<float>::from(v_extract_y(__rd_rename_at_75) /*y*/),*__context__,nullptr),*__context__,nullptr));
+	return das_auto_cast_ref<path_tracer::Ray>::cast((([&]() -> path_tracer::Ray {
+		path_tracer::Ray __mks_77;
+		das_zero(__mks_77);
+		das_copy((__mks_77.orig),((SimPolicy<float3>::Add(__that_rename_at_73.origin,__offset_rename_at_76,*__context__,nullptr))));
+		das_copy((__mks_77.dir),(normalize3(SimPolicy<float3>::Sub((SimPolicy<float3>::Sub(SimPolicy<float3>::MadS(__that_rename_at_73.vertical,cast<float>::from(__t_rename_at_73),SimPolicy<float3>::MadS(__that_rename_at_73.horizontal,cast<float>::from(__s_rename_at_73),__that_rename_at_73.lowerLeftCorner,*__context__,nullptr),*__context__,nullptr),__that_rename_at_73.origin,*__context__,nullptr)),__offset_rename_at_76,*__context__,nullptr))));
+		return __mks_77;
+	})()));
+}
+
+inline void init_path_tracer_54acd80a2e66fe06 ( Context * __context__ )
+{
+	das_copy(das_global<TDim<path_tracer::Sphere,9>,0x769c3f4bc2a503af>(__context__) /*s_Spheres*/(0,__context__),(([&]() -> path_tracer::Sphere {
+		path_tracer::Sphere __mks_98;
+		das_zero(__mks_98);
+		das_copy((__mks_98.center),(v_make_vec4f(0.f,-100.5f,-1.f,0.f)));
+		das_copy((__mks_98.radius),(100.f));
+		das_copy((__mks_98.radius2),(10000.f));
+		das_copy((__mks_98.iRadius),(0.00999999978f));
+		return __mks_98;
+	})()));
+	das_copy(das_global<TDim<path_tracer::Sphere,9>,0x769c3f4bc2a503af>(__context__) /*s_Spheres*/(1,__context__),(([&]() -> path_tracer::Sphere {
+		path_tracer::Sphere __mks_99;
+		das_zero(__mks_99);
+		das_copy((__mks_99.center),(v_make_vec4f(2.f,0.f,-1.f,0.f)));
+		das_copy((__mks_99.radius),(0.5f));
+		das_copy((__mks_99.radius2),(0.25f));
+		das_copy((__mks_99.iRadius),(2.f));
+		return __mks_99;
+	})()));
+	das_copy(das_global<TDim<path_tracer::Sphere,9>,0x769c3f4bc2a503af>(__context__) /*s_Spheres*/(2,__context__),(([&]() -> path_tracer::Sphere {
+		path_tracer::Sphere __mks_100;
+		das_zero(__mks_100);
+		das_copy((__mks_100.center),(v_make_vec4f(0.f,0.f,-1.f,0.f)));
+		das_copy((__mks_100.radius),(0.5f));
+		das_copy((__mks_100.radius2),(0.25f));
+		das_copy((__mks_100.iRadius),(2.f));
+		return __mks_100;
+	})()));
+	das_copy(das_global<TDim<path_tracer::Sphere,9>,0x769c3f4bc2a503af>(__context__) /*s_Spheres*/(3,__context__),(([&]() -> path_tracer::Sphere {
+		path_tracer::Sphere __mks_101;
+		das_zero(__mks_101);
+		das_copy((__mks_101.center),(v_make_vec4f(-2.f,0.f,-1.f,0.f)));
+		das_copy((__mks_101.radius),(0.5f));
+		das_copy((__mks_101.radius2),(0.25f));
+		das_copy((__mks_101.iRadius),(2.f));
+		return __mks_101;
+	})()));
+	das_copy(das_global<TDim<path_tracer::Sphere,9>,0x769c3f4bc2a503af>(__context__) /*s_Spheres*/(4,__context__),(([&]() -> path_tracer::Sphere {
+		path_tracer::Sphere __mks_102;
+		das_zero(__mks_102);
+		das_copy((__mks_102.center),(v_make_vec4f(2.f,0.f,1.f,0.f)));
+		das_copy((__mks_102.radius),(0.5f));
+		das_copy((__mks_102.radius2),(0.25f));
+		das_copy((__mks_102.iRadius),(2.f));
+		return __mks_102;
+	})()));
+	das_copy(das_global<TDim<path_tracer::Sphere,9>,0x769c3f4bc2a503af>(__context__) /*s_Spheres*/(5,__context__),(([&]() -> path_tracer::Sphere {
+		path_tracer::Sphere __mks_103;
+		das_zero(__mks_103);
+		das_copy((__mks_103.center),(v_make_vec4f(0.f,0.f,1.f,0.f)));
+		das_copy((__mks_103.radius),(0.5f));
+		das_copy((__mks_103.radius2),(0.25f));
+		das_copy((__mks_103.iRadius),(2.f));
+		return __mks_103;
+	})()));
+	das_copy(das_global<TDim<path_tracer::Sphere,9>,0x769c3f4bc2a503af>(__context__) /*s_Spheres*/(6,__context__),(([&]() -> path_tracer::Sphere {
+		path_tracer::Sphere __mks_104;
+		das_zero(__mks_104);
+		das_copy((__mks_104.center),(v_make_vec4f(-2.f,0.f,1.f,0.f)));
+		das_copy((__mks_104.radius),(0.5f));
+		das_copy((__mks_104.radius2),(0.25f));
+		das_copy((__mks_104.iRadius),(2.f));
+		return __mks_104;
+	})()));
+	das_copy(das_global<TDim<path_tracer::Sphere,9>,0x769c3f4bc2a503af>(__context__) /*s_Spheres*/(7,__context__),(([&]() -> path_tracer::Sphere {
+		path_tracer::Sphere __mks_105;
+		das_zero(__mks_105);
+		das_copy((__mks_105.center),(v_make_vec4f(0.5f,1.f,0.5f,0.f)));
+		das_copy((__mks_105.radius),(0.5f));
+		das_copy((__mks_105.radius2),(0.25f));
+		das_copy((__mks_105.iRadius),(2.f));
+		return __mks_105;
+	})()));
+	das_copy(das_global<TDim<path_tracer::Sphere,9>,0x769c3f4bc2a503af>(__context__) /*s_Spheres*/(8,__context__),(([&]() -> path_tracer::Sphere {
+		path_tracer::Sphere __mks_106;
+		das_zero(__mks_106);
+		das_copy((__mks_106.center),(v_make_vec4f(-1.5f,1.5f,0.f,0.f)));
+		das_copy((__mks_106.radius),(0.300000012f));
+		das_copy((__mks_106.radius2),(0.0900000036f));
+		das_copy((__mks_106.iRadius),(3.33333325f));
+		return __mks_106;
+	})()));
+	das_copy(das_global<TDim<path_tracer::Material,9>,0x587a7e569a38aeb7>(__context__) /*s_SphereMats*/(0,__context__),(([&]() -> path_tracer::Material {
+		path_tracer::Material __mks_107;
+		das_copy((__mks_107.mtype),(DAS_COMMENT(enum) path_tracer::Type::Lambert));
+		das_copy((__mks_107.albedo),(v_splats(0.800000012f)));
+		das_copy((__mks_107.emissive),(v_zero()));
+		das_copy((__mks_107.roughness),(0.f));
+		das_copy((__mks_107.ri),(0.f));
+		return __mks_107;
+	})()));
+	das_copy(das_global<TDim<path_tracer::Material,9>,0x587a7e569a38aeb7>(__context__) /*s_SphereMats*/(1,__context__),(([&]() -> path_tracer::Material {
+		path_tracer::Material __mks_108;
+		das_copy((__mks_108.mtype),(DAS_COMMENT(enum) path_tracer::Type::Lambert));
+		das_copy((__mks_108.albedo),(v_make_vec4f(0.800000012f,0.400000006f,0.400000006f,0.f)));
+		das_copy((__mks_108.emissive),(v_zero()));
+		das_copy((__mks_108.roughness),(0.f));
+		das_copy((__mks_108.ri),(0.f));
+		return __mks_108;
+	})()));
+	das_copy(das_global<TDim<path_tracer::Material,9>,0x587a7e569a38aeb7>(__context__) /*s_SphereMats*/(2,__context__),(([&]() -> path_tracer::Material {
+		path_tracer::Material __mks_109;
+		das_copy((__mks_109.mtype),(DAS_COMMENT(enum) path_tracer::Type::Lambert));
+		das_copy((__mks_109.albedo),(v_make_vec4f(0.400000006f,0.800000012f,0.400000006f,0.f)));
+		das_copy((__mks_109.emissive),(v_zero()));
+		das_copy((__mks_109.roughness),(0.f));
+		das_copy((__mks_109.ri),(0.f));
+		return __mks_109;
+	})()));
+	das_copy(das_global<TDim<path_tracer::Material,9>,0x587a7e569a38aeb7>(__context__) /*s_SphereMats*/(3,__context__),(([&]() -> path_tracer::Material {
+		path_tracer::Material __mks_110;
+		das_copy((__mks_110.mtype),(DAS_COMMENT(enum) path_tracer::Type::Metal));
+		das_copy((__mks_110.albedo),(v_make_vec4f(0.400000006f,0.400000006f,0.800000012f,0.f)));
+		das_copy((__mks_110.emissive),(v_zero()));
+		das_copy((__mks_110.roughness),(0.f));
+		das_copy((__mks_110.ri),(0.f));
+		return __mks_110;
+	})()));
+	das_copy(das_global<TDim<path_tracer::Material,9>,0x587a7e569a38aeb7>(__context__) /*s_SphereMats*/(4,__context__),(([&]() -> path_tracer::Material {
+		path_tracer::Material __mks_111;
+		das_copy((__mks_111.mtype),(DAS_COMMENT(enum) path_tracer::Type::Metal));
+		das_copy((__mks_111.albedo),(v_make_vec4f(0.400000006f,0.800000012f,0.400000006f,0.f)));
+		das_copy((__mks_111.emissive),(v_zero()));
+		das_copy((__mks_111.roughness),(0.f));
+		das_copy((__mks_111.ri),(0.f));
+		return __mks_111;
+	})()));
+	das_copy(das_global<TDim<path_tracer::Material,9>,0x587a7e569a38aeb7>(__context__) /*s_SphereMats*/(5,__context__),(([&]() -> path_tracer::Material {
+		path_tracer::Material __mks_112;
+		das_copy((__mks_112.mtype),(DAS_COMMENT(enum) path_tracer::Type::Metal));
+		das_copy((__mks_112.albedo),(v_make_vec4f(0.400000006f,0.800000012f,0.400000006f,0.f)));
+		das_copy((__mks_112.emissive),(v_zero()));
+		das_copy((__mks_112.roughness),(0.200000003f));
+		das_copy((__mks_112.ri),(0.f));
+		return __mks_112;
+	})()));
+	das_copy(das_global<TDim<path_tracer::Material,9>,0x587a7e569a38aeb7>(__context__) /*s_SphereMats*/(6,__context__),(([&]() -> path_tracer::Material {
+		path_tracer::Material __mks_113;
+		das_copy((__mks_113.mtype),(DAS_COMMENT(enum) path_tracer::Type::Metal));
+		das_copy((__mks_113.albedo),(v_make_vec4f(0.400000006f,0.800000012f,0.400000006f,0.f)));
+		das_copy((__mks_113.emissive),(v_zero()));
+		das_copy((__mks_113.roughness),(0.600000024f));
+		das_copy((__mks_113.ri),(0.f));
+		return __mks_113;
+	})()));
+	das_copy(das_global<TDim<path_tracer::Material,9>,0x587a7e569a38aeb7>(__context__) /*s_SphereMats*/(7,__context__),(([&]() -> path_tracer::Material {
+		path_tracer::Material __mks_114;
+		das_copy((__mks_114.mtype),(DAS_COMMENT(enum) path_tracer::Type::Dielectric));
+		das_copy((__mks_114.albedo),(v_splats(0.400000006f)));
+		das_copy((__mks_114.emissive),(v_zero()));
+		das_copy((__mks_114.roughness),(0.f));
+		das_copy((__mks_114.ri),(1.5f));
+		return __mks_114;
+	})()));
+	das_copy(das_global<TDim<path_tracer::Material,9>,0x587a7e569a38aeb7>(__context__) /*s_SphereMats*/(8,__context__),(([&]() -> path_tracer::Material {
+		path_tracer::Material __mks_115;
+		das_copy((__mks_115.mtype),(DAS_COMMENT(enum) path_tracer::Type::Lambert));
+		das_copy((__mks_115.albedo),(v_make_vec4f(0.800000012f,0.600000024f,0.200000003f,0.f)));
+		das_copy((__mks_115.emissive),(v_make_vec4f(30.f,25.f,15.f,0.f)));
+		das_copy((__mks_115.roughness),(0.f));
+		das_copy((__mks_115.ri),(0.f));
+		return __mks_115;
+	})()));
+}
+
+inline int32_t hitSpheres_6a52fbdded54c2ce ( Context * __context__, path_tracer::Ray const  &  __r_rename_at_117, float __tMin_rename_at_117, float __tMax_rename_at_117, path_tracer::Hit &  __outHit_rename_at_117 )
+{
+	float __hitT_rename_at_118 = __tMax_rename_at_117;
+	int32_t __id_rename_at_119 = -1;
+	int32_t __i_rename_at_120 = 0;
+	{
+		bool __need_loop_121 = true;
+		// sph : path_tracer::Sphere& -const
+		das_iterator<TDim<path_tracer::Sphere,9>> __sph_iterator(das_global<TDim<path_tracer::Sphere,9>,0x769c3f4bc2a503af>(__context__) /*s_Spheres*/);
+		path_tracer::Sphere * __sph_rename_at_121;
+		__need_loop_121 = __sph_iterator.first(__context__,(__sph_rename_at_121)) && __need_loop_121;
+		for ( ; __need_loop_121 ; __need_loop_121 = __sph_iterator.next(__context__,(__sph_rename_at_121)) )
+		{
+			float3 __co_rename_at_122 = ((float3)(SimPolicy<float3>::Sub((*__sph_rename_at_121).center,__r_rename_at_117.orig,*__context__,nullptr)));
+			float __nb_rename_at_123 = ((float)dot3(__co_rename_at_122,__r_rename_at_117.dir));
+			float __discr_rename_at_124 = ((float)SimPolicy<float>::Mad(__nb_rename_at_123,__nb_rename_at_123,(*__sph_rename_at_121).radius2 - lengthSq3(__co_rename_at_122),*__context__,nullptr));
+			if ( __discr_rename_at_124 > 0.f )
+			{
+				float __discrSq_rename_at_126 = ((float)SimPolicy<float>::Sqrt(__discr_rename_at_124,*__context__,nullptr));
+				float __t_rename_at_127 = (__nb_rename_at_123 - __discrSq_rename_at_126);
+				if ( __t_rename_at_127 <= __tMin_rename_at_117 )
+				{
+					das_copy(__t_rename_at_127,__nb_rename_at_123 + __discrSq_rename_at_126);
+				};
+				if ( (__t_rename_at_127 > __tMin_rename_at_117) && (__t_rename_at_127 < __hitT_rename_at_118) )
+				{
+					das_copy(__id_rename_at_119,__i_rename_at_120);
+					das_copy(__hitT_rename_at_118,__t_rename_at_127);
+				};
+			};
+			++__i_rename_at_120;
+		}
+		__sph_iterator.close(__context__,(__sph_rename_at_121));
+	};
+	if ( __id_rename_at_119 != -1 )
+	{
+		float3 __atPos_rename_at_135 = ((float3)(SimPolicy<float3>::Add(__r_rename_at_117.orig,(SimPolicy<float3>::MulVecScal(__r_rename_at_117.dir,cast<float>::from(__hitT_rename_at_118),*__context__,nullptr)),*__context__,nullptr)));
+		das_copy(__outHit_rename_at_117,(([&]() -> path_tracer::Hit {
+			path_tracer::Hit __mks_136;
+			das_zero(__mks_136);
+			das_copy((__mks_136.pos),(__atPos_rename_at_135));
+			das_copy((__mks_136.normal),((SimPolicy<float3>::MulVecScal((SimPolicy<float3>::Sub(__atPos_rename_at_135,das_global<TDim<path_tracer::Sphere,9>,0x769c3f4bc2a503af>(__context__) /*s_Spheres*/(__id_rename_at_119,__context__).center,*__context__,nullptr)),cast<float>::from(das_global<TDim<path_tracer::Sphere,9>,0x769c3f4bc2a503af>(__context__) /*s_Spheres*/(__id_rename_at_119,__context__).iRadius),*__context__,nullptr))));
+			das_copy((__mks_136.t),(__hitT_rename_at_118));
+			return __mks_136;
+		})()));
+	};
+	return das_auto_cast<int32_t>::cast(__id_rename_at_119);
+}
+
+inline bool hitWorld_ceaa1549ef22bdf8 ( Context * __context__, path_tracer::Ray const  &  __r_rename_at_141, float __tMin_rename_at_141, float __tMax_rename_at_141, path_tracer::Hit &  __outHit_rename_at_141, int32_t & __outID_rename_at_141 )
+{
+	das_copy(__outID_rename_at_141,hitSpheres_6a52fbdded54c2ce(__context__,__r_rename_at_141,__tMin_rename_at_141,__tMax_rename_at_141,das_arg<path_tracer::Hit>::pass(__outHit_rename_at_141)));
+	return das_auto_cast<bool>::cast(__outID_rename_at_141 != -1);
+}
+
+inline bool scatter_4ed833c6250d0618 ( Context * __context__, path_tracer::Material const  &  __mat_rename_at_145, path_tracer::Ray const  &  __r_in_rename_at_145, path_tracer::Hit const  &  __rec_rename_at_145, float3 & __attenuation_rename_at_145, path_tracer::Ray &  __scattered_rename_at_145, float3 & __outLightE_rename_at_145, int32_t & __inoutRayCount_rename_at_145 )
+{
+	das_copy(__outLightE_rename_at_145,v_zero());
+	if ( __mat_rename_at_145.mtype == DAS_COMMENT(enum) path_tracer::Type::Lambert )
+	{
+		float3 __target_rename_at_148 = ((float3)(SimPolicy<float3>::Add((SimPolicy<float3>::Add(__rec_rename_at_145.pos,__rec_rename_at_145.normal,*__context__,nullptr)),_Funcrandom_0x60_random_unit_vector_5539c3ea4d7bb631(__context__,das_global<int4,0xaa36806050759e34>(__context__) /*RAND_SEED*/),*__context__,nullptr)));
+		das_copy(__scattered_rename_at_145,(([&]() -> path_tracer::Ray {
+			path_tracer::Ray __mks_149;
+			das_zero(__mks_149);
+			das_copy((__mks_149.orig),(__rec_rename_at_145.pos));
+			das_copy((__mks_149.dir),(normalize3(SimPolicy<float3>::Sub(__target_rename_at_148,__rec_rename_at_145.pos,*__context__,nullptr))));
+			return __mks_149;
+		})()));
+		das_copy(__attenuation_rename_at_145,__mat_rename_at_145.albedo);
+		float3 __sc_rename_at_151 = ((float3)das_global<TDim<path_tracer::Sphere,9>,0x769c3f4bc2a503af>(__context__) /*s_Spheres*/(8,__context__).center);
+		float3 __sw_rename_at_152 = ((float3)normalize3(SimPolicy<float3>::Sub(__sc_rename_at_151,__rec_rename_at_145.pos,*__context__,nullptr)));
+		float3 __su_rename_at_153 = ((float3)normalize3(cross3((SimPolicy<float>::Abs(v_extract_x(__sw_rename_at_152) /*x*/,*__context__,nullptr) > 0.00999999978f) ? (vec4f)das_auto_cast<float3>::cast(v_make_vec4f(0.f,1.f,0.f,0.f)) : (vec4f)das_auto_cast<float3>::cast(v_make_vec4f(1.f,0.f,0.f,0.f)),__sw_rename_at_152)));
+		float3 __sv_rename_at_154 = ((float3)cross3(__sw_rename_at_152,__su_rename_at_153));
+		float __sr_rename_at_155 = ((float)das_global<TDim<path_tracer::Sphere,9>,0x769c3f4bc2a503af>(__context__) /*s_Spheres*/(8,__context__).radius);
+		float __cosAMax_rename_at_156 = ((float)SimPolicy<float>::Sqrt(SimPolicy<float>::Sat(1.f - ((__sr_rename_at_155 * __sr_rename_at_155) * invdistanceSq3(__rec_rename_at_145.pos,__sc_rename_at_151)),*__context__,nullptr),*__context__,nullptr));
+		float4 __eps_rename_at_157 = ((float4)_Funcrandom_0x60_random_float4_a7bd627b7b8adf8a(__context__,das_global<int4,0xaa36806050759e34>(__context__) /*RAND_SEED*/));
+		float __cosA_rename_at_158 = ((float)(SimPolicy<float>::Mad(v_extract_x(__eps_rename_at_157) /*x*/,__cosAMax_rename_at_156,1.f,*__context__,nullptr) - v_extract_x(__eps_rename_at_157) /*x*/));
+		float __sinA_rename_at_159 = ((float)SimPolicy<float>::Sqrt(1.f - (__cosA_rename_at_158 * __cosA_rename_at_158),*__context__,nullptr));
+		float __sinPhi_rename_at_160 = 0; float __cosPhi_rename_at_160 = 0;
+		sincosF(v_extract_y(__eps_rename_at_157) /*y*/ * 6.28318548f,__sinPhi_rename_at_160,__cosPhi_rename_at_160);
+		float3 __l_rename_at_162 = ((float3)(SimPolicy<float3>::Add((SimPolicy<float3>::Add((SimPolicy<float3>::MulVecScal(__su_rename_at_153,cast<float>::from((__cosPhi_rename_at_160 * __sinA_rename_at_159)),*__context__,nullptr)),(SimPolicy<float3>::MulVecScal(__sv_rename_at_154,cast<float>::from((__sinPhi_rename_at_160 * __sinA_rename_at_159)),*__context__,nullptr)),*__context__,nullptr)),(SimPolicy<float3>::MulVecScal(__sw_rename_at_152,cast<float>::from(__cosA_rename_at_158),*__context__,nullptr)),*__context__,nullptr)));
+		path_tracer::Hit __lightHit_rename_at_163; das_zero(__lightHit_rename_at_163);
+		int32_t __hitID_rename_at_164 = 0;
+		++__inoutRayCount_rename_at_145;
+		path_tracer::Ray __ray_rename_at_166_ConstRef = ((path_tracer::Ray)(([&]() -> path_tracer::Ray {
+			path_tracer::Ray __mks_166;
+			das_zero(__mks_166);
+			das_copy((__mks_166.orig),(__rec_rename_at_145.pos));
+			das_copy((__mks_166.dir),(__l_rename_at_162));
+			return __mks_166;
+		})()));
+	path_tracer::Ray const  & __ray_rename_at_166 = __ray_rename_at_166_ConstRef; ;
+		if ( hitWorld_ceaa1549ef22bdf8(__context__,__ray_rename_at_166,0.00100000005f,10000000.f,das_arg<path_tracer::Hit>::pass(__lightHit_rename_at_163),__hitID_rename_at_164) && (__hitID_rename_at_164 == 8) )
+		{
+			float3 __nl_rename_at_168 = ((float3)((dot3(__rec_rename_at_145.normal,__r_in_rename_at_145.dir) < 0.f) ? (vec4f)das_auto_cast<float3>::cast(__rec_rename_at_145.normal) : (vec4f)das_auto_cast<float3>::cast(SimPolicy<float3>::Unm(__rec_rename_at_145.normal,*__context__,nullptr))));
+			SimPolicy<float3>::SetAdd((char *)&(__outLightE_rename_at_145),(SimPolicy<float3>::MulVecScal((SimPolicy<float3>::Mul(__mat_rename_at_145.albedo,das_global<TDim<path_tracer::Material,9>,0x587a7e569a38aeb7>(__context__) /*s_SphereMats*/(8,__context__).emissive,*__context__,nullptr)),cast<float>::from((SimPolicy<float>::Sat(dot3(__l_rename_at_162,__nl_rename_at_168),*__context__,nullptr) * SimPolicy<float>::Mad(-2.f,__cosAMax_rename_at_156,2.f,*__context__,nullptr))),*__context__,nullptr)),*__context__,nullptr);
+		};
+		return das_auto_cast<bool>::cast(true);
+	} else if ( __mat_rename_at_145.mtype == DAS_COMMENT(enum) path_tracer::Type::Metal )
+	{
+		float3 __refl_rename_at_172 = ((float3)reflect(__r_in_rename_at_145.dir,__rec_rename_at_145.normal));
+		das_copy(__scattered_rename_at_145,(([&]() -> path_tracer::Ray {
+			path_tracer::Ray __mks_173;
+			das_zero(__mks_173);
+			das_copy((__mks_173.orig),(__rec_rename_at_145.pos));
+			das_copy((__mks_173.dir),(normalize3(SimPolicy<float3>::MadS(_Funcrandom_0x60_random_in_unit_sphere_1168887ec1db780f(__context__,das_global<int4,0xaa36806050759e34>(__context__) /*RAND_SEED*/),cast<float>::from(__mat_rename_at_145.roughness),__refl_rename_at_172,*__context__,nullptr))));
+			return __mks_173;
+		})()));
+		das_copy(__attenuation_rename_at_145,__mat_rename_at_145.albedo);
+		return das_auto_cast<bool>::cast(dot3(__scattered_rename_at_145.dir,__rec_rename_at_145.normal) > 0.f);
+	} else if ( __mat_rename_at_145.mtype == DAS_COMMENT(enum) path_tracer::Type::Dielectric )
+	{
+		das_copy(__attenuation_rename_at_145,v_splats(1.f));
+		float3 __refr_rename_at_178 = v_zero();
+		float __reflProb_rename_at_179 = 0;
+		if ( dot3(__r_in_rename_at_145.dir,__rec_rename_at_145.normal) > 0.f )
+		{
+			das_copy(__refr_rename_at_178,refract(__r_in_rename_at_145.dir,SimPolicy<float3>::Unm(__rec_rename_at_145.normal,*__context__,nullptr),__mat_rename_at_145.ri));
+			if ( lengthSq3(__refr_rename_at_178) > 0.f )
+			{
+				das_copy(__reflProb_rename_at_179,schlick_3a9821b8198433c4(__context__,__mat_rename_at_145.ri * dot3(__r_in_rename_at_145.dir,__rec_rename_at_145.normal),__mat_rename_at_145.ri));
+			} else {
+				das_copy(__reflProb_rename_at_179,1.f);
+			};
+		} else {
+			das_copy(__refr_rename_at_178,refract(__r_in_rename_at_145.dir,__rec_rename_at_145.normal,SimPolicy<float>::Div(1.f,__mat_rename_at_145.ri,*__context__,nullptr)));
+			if ( lengthSq3(__refr_rename_at_178) > 0.f )
+			{
+				das_copy(__reflProb_rename_at_179,schlick_3a9821b8198433c4(__context__,-dot3(__r_in_rename_at_145.dir,__rec_rename_at_145.normal),__mat_rename_at_145.ri));
+			} else {
+				das_copy(__reflProb_rename_at_179,1.f);
+			};
+		};
+		if ( _Funcrandom_0x60_random_float_74d9bf7d99102f00(__context__,das_global<int4,0xaa36806050759e34>(__context__) /*RAND_SEED*/) < __reflProb_rename_at_179 )
+		{
+			das_copy(__scattered_rename_at_145,(([&]() -> path_tracer::Ray {
+				path_tracer::Ray __mks_193;
+				das_zero(__mks_193);
+				das_copy((__mks_193.orig),(__rec_rename_at_145.pos));
+				das_copy((__mks_193.dir),(normalize3(reflect(__r_in_rename_at_145.dir,__rec_rename_at_145.normal))));
+				return __mks_193;
+			})()));
+		} else {
+			das_copy(__scattered_rename_at_145,(([&]() -> path_tracer::Ray {
+				path_tracer::Ray __mks_195;
+				das_zero(__mks_195);
+				das_copy((__mks_195.orig),(__rec_rename_at_145.pos));
+				das_copy((__mks_195.dir),(normalize3(__refr_rename_at_178)));
+				return __mks_195;
+			})()));
+		};
+	} else {
+		das_copy(__attenuation_rename_at_145,v_make_vec4f(1.f,0.f,1.f,0.f));
+		das_copy(__scattered_rename_at_145,(([&]() -> path_tracer::Ray {
+			path_tracer::Ray __mks_198;
+			das_zero(__mks_198);
+			das_copy((__mks_198.orig),(v_zero()));
+			das_copy((__mks_198.dir),(v_zero()));
+			return __mks_198;
+		})()));
+		return das_auto_cast<bool>::cast(false);
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline float3 trace_6bc5ad316fda0152 ( Context * __context__, path_tracer::Ray const  &  __r_rename_at_202, int32_t & __inoutRayCount_rename_at_202 )
+{
+	path_tracer::Ray __ray_rename_at_203 = __r_rename_at_202;
+	float3 __col_rename_at_204 = v_zero();
+	float3 __curAtten_rename_at_205 = v_splats(1.f);
+	bool __doMaterialE_rename_at_206 = true;
+	{
+		bool __need_loop_207 = true;
+		// depth : int const
+		das_iterator<range> __depth_iterator(range(0,10));
+		int32_t __depth_rename_at_207;
+		__need_loop_207 = __depth_iterator.first(__context__,(__depth_rename_at_207)) && __need_loop_207;
+		for ( ; __need_loop_207 ; __need_loop_207 = __depth_iterator.next(__context__,(__depth_rename_at_207)) )
+		{
+			path_tracer::Hit __rec_rename_at_208; das_zero(__rec_rename_at_208);
+			int32_t __id_rename_at_209 = 0;
+			++__inoutRayCount_rename_at_202;
+			if ( hitWorld_ceaa1549ef22bdf8(__context__,das_arg<path_tracer::Ray>::pass(__ray_rename_at_203),0.00100000005f,10000000.f,das_arg<path_tracer::Hit>::pass(__rec_rename_at_208),__id_rename_at_209) )
+			{
+				path_tracer::Ray __scattered_rename_at_212; das_zero(__scattered_rename_at_212);
+				float3 __attenuation_rename_at_213 = v_zero();
+				float3 __lightE_rename_at_214 = v_zero();
+				float3 __matE_rename_at_215 = das_global<TDim<path_tracer::Material,9>,0x587a7e569a38aeb7>(__context__) /*s_SphereMats*/(__id_rename_at_209,__context__).emissive;
+				if ( scatter_4ed833c6250d0618(__context__,das_arg<path_tracer::Material>::pass(das_global<TDim<path_tracer::Material,9>,0x587a7e569a38aeb7>(__context__) /*s_SphereMats*/(__id_rename_at_209,__context__)),das_arg<path_tracer::Ray>::pass(__ray_rename_at_203),das_arg<path_tracer::Hit>::pass(__rec_rename_at_208),__attenuation_rename_at_213,das_arg<path_tracer::Ray>::pass(__scattered_rename_at_212),__lightE_rename_at_214,__inoutRayCount_rename_at_202) )
+				{
+					if ( !__doMaterialE_rename_at_206 )
+					{
+						das_copy(__matE_rename_at_215,v_zero());
+					};
+					das_copy(__doMaterialE_rename_at_206,das_global<TDim<path_tracer::Material,9>,0x587a7e569a38aeb7>(__context__) /*s_SphereMats*/(__id_rename_at_209,__context__).mtype != DAS_COMMENT(enum) path_tracer::Type::Lambert);
+					SimPolicy<float3>::SetAdd((char *)&(__col_rename_at_204),(SimPolicy<float3>::Mul(__curAtten_rename_at_205,(SimPolicy<float3>::Add(__matE_rename_at_215,__lightE_rename_at_214,*__context__,nullptr)),*__context__,nullptr)),*__context__,nullptr);
+					SimPolicy<float3>::SetMul((char *)&(__curAtten_rename_at_205),__attenuation_rename_at_213,*__context__,nullptr);
+					das_copy(__ray_rename_at_203,__scattered_rename_at_212);
+				} else {
+					SimPolicy<float3>::SetAdd((char *)&(__col_rename_at_204),(SimPolicy<float3>::Mul(__curAtten_rename_at_205,__matE_rename_at_215,*__context__,nullptr)),*__context__,nullptr);
+					break;
+				};
+			} else {
+				float3 __t_rename_at_227 = ((float3)SimPolicy<float3>::MadS(__ray_rename_at_203.dir,cast<float>::from(0.5f),v_splats(1.f),*__context__,nullptr));
+				float3 __skyCol_rename_at_228 = ((float3)SimPolicy<float3>::Lerp(v_splats(0.300000012f),v_make_vec4f(0.150000006f,0.210000008f,0.300000012f,0.f),__t_rename_at_227,*__context__,nullptr));
+				SimPolicy<float3>::SetAdd((char *)&(__col_rename_at_204),(SimPolicy<float3>::Mul(__curAtten_rename_at_205,__skyCol_rename_at_228,*__context__,nullptr)),*__context__,nullptr);
+				break;
+			};
+		}
+		__depth_iterator.close(__context__,(__depth_rename_at_207));
+	};
+	return das_auto_cast<float3>::cast(__col_rename_at_204);
+}
+
+inline int32_t trace_413a8cbe9a84b3c4 ( Context * __context__, int32_t __screenWidth_rename_at_233, int32_t __screenHeight_rename_at_233, int32_t __frameCount_rename_at_233, int32_t __ymin_rename_at_233, int32_t __ymax_rename_at_233, TArray<float3> &  __backbuffer_rename_at_233, path_tracer::Camera const  &  __cam_rename_at_233 )
+{
+	float2 __invWH_rename_at_234 = ((float2)(SimPolicy<float2>::DivScalVec(cast<float>::from(1.f),float2(__screenWidth_rename_at_233,__screenHeight_rename_at_233),*__context__,nullptr)));
+	float3 __lerpFac_rename_at_235 = ((float3)v_splats(SimPolicy<float>::Div(float(__frameCount_rename_at_233),float(__frameCount_rename_at_233 + 1),*__context__,nullptr)));
+	int32_t __rayCount_rename_at_236 = 0;
+	int32_t __backbufferIdx_rename_at_237 = (__ymin_rename_at_233 * __screenWidth_rename_at_233);
+	{
+		bool __need_loop_238 = true;
+		// y : int const
+		das_iterator<range> __y_iterator(range(__ymin_rename_at_233,__ymax_rename_at_233));
+		int32_t __y_rename_at_238;
+		__need_loop_238 = __y_iterator.first(__context__,(__y_rename_at_238)) && __need_loop_238;
+		for ( ; __need_loop_238 ; __need_loop_238 = __y_iterator.next(__context__,(__y_rename_at_238)) )
+		{
+			das_copy(das_global<int4,0xaa36806050759e34>(__context__) /*RAND_SEED*/,_Funcrandom_0x60_random_seed_40d32f1495a9708e(__context__,(__y_rename_at_238 * 117) + (__frameCount_rename_at_233 * 13)));
+			{
+				bool __need_loop_240 = true;
+				// x : int const
+				das_iterator<range> __x_iterator(mk_range(__screenWidth_rename_at_233));
+				int32_t __x_rename_at_240;
+				__need_loop_240 = __x_iterator.first(__context__,(__x_rename_at_240)) && __need_loop_240;
+				for ( ; __need_loop_240 ; __need_loop_240 = __x_iterator.next(__context__,(__x_rename_at_240)) )
+				{
+					float3 __col_rename_at_241 = v_zero();
+					{
+						bool __need_loop_242 = true;
+						// s : int const
+						das_iterator<range> __s_iterator(range(0,32));
+						int32_t __s_rename_at_242;
+						__need_loop_242 = __s_iterator.first(__context__,(__s_rename_at_242)) && __need_loop_242;
+						for ( ; __need_loop_242 ; __need_loop_242 = __s_iterator.next(__context__,(__s_rename_at_242)) )
+						{
+							path_tracer::Ray _temp_make_local_244_30_176;
+							float2 __uv_rename_at_243 = ((float2)(SimPolicy<float2>::Mul((SimPolicy<float2>::Add(float2(__x_rename_at_240,__y_rename_at_238),das_swizzle_seq<float2,float4,0>::swizzle(_Funcrandom_0x60_random_float4_a7bd627b7b8adf8a(__context__,das_global<int4,0xaa36806050759e34>(__context__) /*RAND_SEED*/)) /*xy*/,*__context__,nullptr)),__invWH_rename_at_234,*__context__,nullptr)));
+							SimPolicy<float3>::SetAdd((char *)&(__col_rename_at_241),trace_6bc5ad316fda0152(__context__,das_arg<path_tracer::Ray>::pass((_temp_make_local_244_30_176 = (getRay_d878b35dfe5b23a4(__context__,__cam_rename_at_233,v_extract_x(__uv_rename_at_243) /*x*/,v_extract_y(__uv_rename_at_243) /*y*/)))),__rayCount_rename_at_236),*__context__,nullptr);
+						}
+						__s_iterator.close(__context__,(__s_rename_at_242));
+					};
+					SimPolicy<float3>::SetMulScal((char *)&(__col_rename_at_241),cast<float>::from(0.03125f),*__context__,nullptr);
+					das_copy(__backbuffer_rename_at_233(__backbufferIdx_rename_at_237,__context__),SimPolicy<float3>::Lerp(__col_rename_at_241,__backbuffer_rename_at_233(__backbufferIdx_rename_at_237,__context__),__lerpFac_rename_at_235,*__context__,nullptr));
+					++__backbufferIdx_rename_at_237;
+				}
+				__x_iterator.close(__context__,(__x_rename_at_240));
+			};
+		}
+		__y_iterator.close(__context__,(__y_rename_at_238));
+	};
+	return das_auto_cast<int32_t>::cast(__rayCount_rename_at_236);
+}
+
+inline float3 draw_ray_68256aa0069590f6 ( Context * __context__, int32_t __x_rename_at_250, int32_t __y_rename_at_250, int32_t __screenWidth_rename_at_250, int32_t __screenHeight_rename_at_250 )
+{
+	int32_t __rayCount_rename_at_251 = 0;
+	path_tracer::Camera __cam_rename_at_256_ConstRef = ((path_tracer::Camera)Camera_7addb42ca6ffc84f(__context__,v_make_vec4f(0.f,2.f,3.f,0.f),v_zero(),v_make_vec4f(0.f,1.f,0.f,0.f),60.f,SimPolicy<float>::Div(float(__screenWidth_rename_at_250),float(__screenHeight_rename_at_250),*__context__,nullptr),0.100000001f,3.f));
+	path_tracer::Camera const  & __cam_rename_at_256 = __cam_rename_at_256_ConstRef; ;
+	float2 __invWH_rename_at_257 = ((float2)(SimPolicy<float2>::DivScalVec(cast<float>::from(1.f),float2(__screenWidth_rename_at_250,__screenHeight_rename_at_250),*__context__,nullptr)));
+	float3 __col_rename_at_258 = v_zero();
+	{
+		bool __need_loop_259 = true;
+		// s : int const
+		das_iterator<range> __s_iterator(range(0,32));
+		int32_t __s_rename_at_259;
+		__need_loop_259 = __s_iterator.first(__context__,(__s_rename_at_259)) && __need_loop_259;
+		for ( ; __need_loop_259 ; __need_loop_259 = __s_iterator.next(__context__,(__s_rename_at_259)) )
+		{
+			path_tracer::Ray _temp_make_local_261_22_208;
+			float2 __uv_rename_at_260 = ((float2)(SimPolicy<float2>::Mul((SimPolicy<float2>::Add(float2(__x_rename_at_250,__y_rename_at_250),das_swizzle_seq<float2,float4,0>::swizzle(_Funcrandom_0x60_random_float4_a7bd627b7b8adf8a(__context__,das_global<int4,0xaa36806050759e34>(__context__) /*RAND_SEED*/)) /*xy*/,*__context__,nullptr)),__invWH_rename_at_257,*__context__,nullptr)));
+			SimPolicy<float3>::SetAdd((char *)&(__col_rename_at_258),trace_6bc5ad316fda0152(__context__,das_arg<path_tracer::Ray>::pass((_temp_make_local_261_22_208 = (getRay_d878b35dfe5b23a4(__context__,__cam_rename_at_256,v_extract_x(__uv_rename_at_260) /*x*/,v_extract_y(__uv_rename_at_260) /*y*/)))),__rayCount_rename_at_251),*__context__,nullptr);
+		}
+		__s_iterator.close(__context__,(__s_rename_at_259));
+	};
+	SimPolicy<float3>::SetMulScal((char *)&(__col_rename_at_258),cast<float>::from(0.03125f),*__context__,nullptr);
+	return das_auto_cast<float3>::cast(__col_rename_at_258);
+}
+
+inline void draw_37c2e8e354406bbd ( Context * __context__, int32_t __frameCount_rename_at_265, int32_t __screenWidth_rename_at_265, int32_t __screenHeight_rename_at_265, int32_t __ymin_rename_at_265, int32_t __ymax_rename_at_265, TArray<float3> &  __backbuffer_rename_at_265, int32_t & __outRayCount_rename_at_265 )
+{
+	int32_t __rayCount_rename_at_266 = 0;
+	path_tracer::Camera __cam_rename_at_271_ConstRef = ((path_tracer::Camera)Camera_7addb42ca6ffc84f(__context__,v_make_vec4f(0.f,2.f,3.f,0.f),v_zero(),v_make_vec4f(0.f,1.f,0.f,0.f),60.f,SimPolicy<float>::Div(float(__screenWidth_rename_at_265),float(__screenHeight_rename_at_265),*__context__,nullptr),0.100000001f,3.f));
+	path_tracer::Camera const  & __cam_rename_at_271 = __cam_rename_at_271_ConstRef; ;
+	__rayCount_rename_at_266 += trace_413a8cbe9a84b3c4(__context__,__screenWidth_rename_at_265,__screenHeight_rename_at_265,__frameCount_rename_at_265,__ymin_rename_at_265,__ymax_rename_at_265,das_arg<TArray<float3>>::pass(__backbuffer_rename_at_265),__cam_rename_at_271);
+	das_copy(__outRayCount_rename_at_265,__rayCount_rename_at_266);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcrandom_0x60_random_int4_328b2382cfdb0a5d
+	aotLib[0x3dd1ad6cd8e12835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int4 (*) ( Context * __context__, int4 &  ),&_Funcrandom_0x60_random_int4_328b2382cfdb0a5d>>();
+	};
+	// _Funcrandom_0x60_random_int_2fd6061b7238802b
+	aotLib[0xce88576071ec5209] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int4 &  ),&_Funcrandom_0x60_random_int_2fd6061b7238802b>>();
+	};
+	// _Funcrandom_0x60_random_in_unit_disk_874af9e531879036
+	aotLib[0x1ec477de6c0d24cb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, int4 &  ),&_Funcrandom_0x60_random_in_unit_disk_874af9e531879036>>();
+	};
+	// _Funcrandom_0x60_random_unit_vector_5539c3ea4d7bb631
+	aotLib[0x24a9d81c51adbc53] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, int4 &  ),&_Funcrandom_0x60_random_unit_vector_5539c3ea4d7bb631>>();
+	};
+	// _Funcrandom_0x60_random_float4_a7bd627b7b8adf8a
+	aotLib[0xaf1db2bd52def9fe] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float4 (*) ( Context * __context__, int4 &  ),&_Funcrandom_0x60_random_float4_a7bd627b7b8adf8a>>();
+	};
+	// _Funcrandom_0x60_random_in_unit_sphere_1168887ec1db780f
+	aotLib[0x14939abac01cc70b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, int4 &  ),&_Funcrandom_0x60_random_in_unit_sphere_1168887ec1db780f>>();
+	};
+	// _Funcrandom_0x60_random_float_74d9bf7d99102f00
+	aotLib[0x61939557c48ae222] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, int4 &  ),&_Funcrandom_0x60_random_float_74d9bf7d99102f00>>();
+	};
+	// _Funcrandom_0x60_random_seed_40d32f1495a9708e
+	aotLib[0xa88480072784083d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int4 (*) ( Context * __context__, int32_t  ),&_Funcrandom_0x60_random_seed_40d32f1495a9708e>>();
+	};
+	// schlick_3a9821b8198433c4
+	aotLib[0x62026607cfd8a21d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, float , float  ),&schlick_3a9821b8198433c4>>();
+	};
+	// pointAt_719bd5c2cfc420b
+	aotLib[0x3aaded514bf4bd0d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, path_tracer::Ray const  & , float  ),&pointAt_719bd5c2cfc420b>>();
+	};
+	// Camera_7addb42ca6ffc84f
+	aotLib[0xf8239615b90bd925] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<path_tracer::Camera (*) ( Context * __context__, float3 , float3 , float3 , float , float , float , float  ),&Camera_7addb42ca6ffc84f>>();
+	};
+	// getRay_d878b35dfe5b23a4
+	aotLib[0x9ffb3349192d21dc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<path_tracer::Ray (*) ( Context * __context__, path_tracer::Camera const  & , float , float  ),&getRay_d878b35dfe5b23a4>>();
+	};
+	// init_path_tracer_54acd80a2e66fe06
+	aotLib[0x48d3235679f7e995] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&init_path_tracer_54acd80a2e66fe06>>();
+	};
+	// hitSpheres_6a52fbdded54c2ce
+	aotLib[0xfb87195f73b200c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, path_tracer::Ray const  & , float , float , path_tracer::Hit &  ),&hitSpheres_6a52fbdded54c2ce>>();
+	};
+	// hitWorld_ceaa1549ef22bdf8
+	aotLib[0x27682f642f42d3ce] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, path_tracer::Ray const  & , float , float , path_tracer::Hit & , int32_t &  ),&hitWorld_ceaa1549ef22bdf8>>();
+	};
+	// scatter_4ed833c6250d0618
+	aotLib[0x806860670f7a8449] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, path_tracer::Material const  & , path_tracer::Ray const  & , path_tracer::Hit const  & , float3 & , path_tracer::Ray & , float3 & , int32_t &  ),&scatter_4ed833c6250d0618>>();
+	};
+	// trace_6bc5ad316fda0152
+	aotLib[0xf2f4fed125909b1c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, path_tracer::Ray const  & , int32_t &  ),&trace_6bc5ad316fda0152>>();
+	};
+	// trace_413a8cbe9a84b3c4
+	aotLib[0x6f8530ccd7e88635] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , int32_t , int32_t , int32_t , int32_t , TArray<float3> & , path_tracer::Camera const  &  ),&trace_413a8cbe9a84b3c4>>();
+	};
+	// draw_ray_68256aa0069590f6
+	aotLib[0x8d276a23317c9ae] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, int32_t , int32_t , int32_t , int32_t  ),&draw_ray_68256aa0069590f6>>();
+	};
+	// draw_37c2e8e354406bbd
+	aotLib[0xe72db25b0e0402b4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , int32_t , int32_t , int32_t , int32_t , TArray<float3> & , int32_t &  ),&draw_37c2e8e354406bbd>>();
+	};
+	// [[ init script ]]
+	aotLib[0xb20a3aadeb2e1873] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,365 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require annotation
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5288548038654255003 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xeeb3b74c98cb09c3), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+template<typename BT>
+inline uint32_t __query_es_pos1212_r_vel1212_r ( uint64_t /*annotationData*/, const BT & block, Context * __context )
+{
+	for ( uint32_t i=0; i != g_total; ++i ) {
+		block(g_pos[i],g_vel[i]);
+	}
+	return g_total;
+}
+
+template<typename BT>
+inline uint32_t __query_es_pos1212_r_vel1212 ( uint64_t /*annotationData*/, const BT & block, Context * __context )
+{
+	for ( uint32_t i=0; i != g_total; ++i ) {
+		block(g_pos[i],g_vel[i]);
+	}
+	return g_total;
+}
+
+template<typename BT>
+inline uint32_t __query_es_pos1212_r_vel1212_r_dt_null4 ( uint64_t /*annotationData*/, const BT & block, Context * __context )
+{
+	for ( uint32_t i=0; i != g_total; ++i ) {
+		block(g_pos[i],g_vel[i],1.f);
+	}
+	return g_total;
+}
+
+template<typename BT>
+inline uint32_t __query_es_some_name_null8 ( uint64_t /*annotationData*/, const BT & block, Context * __context )
+{
+	for ( uint32_t i=0; i != g_total; ++i ) {
+		block("no_name");
+	}
+	return g_total;
+}
+
+template<typename BT>
+inline uint32_t __query_es_pos1212_r_vel1212_defT_null4 ( uint64_t /*annotationData*/, const BT & block, Context * __context )
+{
+	for ( uint32_t i=0; i != g_total; ++i ) {
+		block(g_pos[i],g_vel[i],0.5f);
+	}
+	return g_total;
+}
+
+template<typename BT>
+inline uint32_t __query_es_pos1212_r ( uint64_t /*annotationData*/, const BT & block, Context * __context )
+{
+	for ( uint32_t i=0; i != g_total; ++i ) {
+		block(g_pos[i]);
+	}
+	return g_total;
+}
+
+
+inline void update_bddb78a1dcc3c2fc ( Context * __context__ );
+inline void update2_fa8ea074124911f2 ( Context * __context__ );
+inline void update3_86baf15b6bceeebf ( Context * __context__ );
+inline void update4_4459fde14444076b ( Context * __context__ );
+inline void queryOne_14ba0d03c8e61c3e ( Context * __context__, float __dt_rename_at_26 );
+inline void queryTwo_85d37118817b8e51 ( Context * __context__, float __dt_rename_at_30 );
+inline void queryThree_211670e5f95bba35 ( Context * __context__ );
+inline bool test_5340ad17b06f7dc1 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void update_bddb78a1dcc3c2fc ( Context * __context__ )
+{
+	__query_es_pos1212_r_vel1212_r(__context__->adBySid(9095656702827226163u),[&](float3 & __pos_rename_at_10, float3 const  & __vel_rename_at_10) DAS_AOT_INLINE_LAMBDA -> void{
+		SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_10),__vel_rename_at_10,*__context__,nullptr);
+	},__context__);
+}
+
+inline void update2_fa8ea074124911f2 ( Context * __context__ )
+{
+	__query_es_pos1212_r_vel1212(__context__->adBySid(16058850326905803329u),[&](float3 & __pos_rename_at_15, float3 __vel_rename_at_15) DAS_AOT_INLINE_LAMBDA -> void{
+
+#if 0
+v_make_vec4f(1.f,2.f,3.f,0.f)
+#endif
+		SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_15),__vel_rename_at_15,*__context__,nullptr);
+	},__context__);
+}
+
+inline void update3_86baf15b6bceeebf ( Context * __context__ )
+{
+	__query_es_pos1212_r_vel1212_r_dt_null4(__context__->adBySid(11970838694581414669u),[&](float3 & __pos_rename_at_19, float3 const  & __vel_rename_at_19, float const  __dt_rename_at_19) DAS_AOT_INLINE_LAMBDA -> void{
+
+#if 0
+1.f
+#endif
+		SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_19),(SimPolicy<float3>::MulVecScal(__vel_rename_at_19,cast<float>::from(__dt_rename_at_19),*__context__,nullptr)),*__context__,nullptr);
+	},__context__);
+}
+
+inline void update4_4459fde14444076b ( Context * __context__ )
+{
+	__query_es_some_name_null8(__context__->adBySid(17669056375593175253u),[&](char * const  __some_name_rename_at_23) DAS_AOT_INLINE_LAMBDA -> void{
+
+#if 0
+((char *) "no_name")
+#endif
+		DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__some_name_rename_at_23),cast<char *>::from(((char *) "no_name")),*__context__,nullptr)));
+	},__context__);
+}
+
+inline void queryOne_14ba0d03c8e61c3e ( Context * __context__, float __dt_rename_at_26 )
+{
+	__query_es_pos1212_r_vel1212(__context__->adBySid(6038945663573849970u),[&](float3 & __pos_rename_at_27, float3 __vel_rename_at_27) DAS_AOT_INLINE_LAMBDA -> void{
+		SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_27),(SimPolicy<float3>::MulVecScal(__vel_rename_at_27,cast<float>::from(__dt_rename_at_26),*__context__,nullptr)),*__context__,nullptr);
+	},__context__);
+}
+
+inline void queryTwo_85d37118817b8e51 ( Context * __context__, float __dt_rename_at_30 )
+{
+	__query_es_pos1212_r_vel1212_defT_null4(__context__->adBySid(15927590385651405926u),[&](float3 & __pos_rename_at_31, float3 __vel_rename_at_31, float const  __defT_rename_at_31) DAS_AOT_INLINE_LAMBDA -> void{
+
+#if 0
+0.5f
+#endif
+		SimPolicy<float3>::SetAdd((char *)&(__pos_rename_at_31),(SimPolicy<float3>::MulVecScal(__vel_rename_at_31,cast<float>::from((__defT_rename_at_31 + __dt_rename_at_30)),*__context__,nullptr)),*__context__,nullptr);
+	},__context__);
+}
+
+inline void queryThree_211670e5f95bba35 ( Context * __context__ )
+{
+	int32_t __count_rename_at_35 = 0;
+	das_try_recover(__context__, [&]()
+	{
+		__query_es_pos1212_r(__context__->adBySid(11877471282094755948u),[&](float3 const  & __pos_rename_at_37) DAS_AOT_INLINE_LAMBDA -> void{
+			float3 __position_rename_at_38 = ((float3)__pos_rename_at_37);
+			__query_es_pos1212_r(__context__->adBySid(11877471282094755948u),[&](float3 const  & __pos_rename_at_39) DAS_AOT_INLINE_LAMBDA -> void{
+				if ( SimPolicy<float3>::Equ(__position_rename_at_38,__pos_rename_at_39,*__context__,nullptr) )
+				{
+					++__count_rename_at_35;
+					if ( __count_rename_at_35 == 100 )
+					{
+						builtin_throw(((char *) "enough"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+					};
+				};
+			},__context__);
+		},__context__);
+	}, [&]()
+	{
+		DAS_ASSERT((__count_rename_at_35 == 100));
+	});
+}
+
+inline bool test_5340ad17b06f7dc1 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,464,"test " DAS_FILE_LINE);
+{
+	initEsComponents();
+	testEsUpdate(((char *) "ks"),__context__);
+	verifyEsComponents(__context__);
+	initEsComponents();
+	testEsUpdate(((char *) "ks2"),__context__);
+	verifyEsComponents(__context__);
+	initEsComponents();
+	testEsUpdate(((char *) "ks3"),__context__);
+	verifyEsComponents(__context__);
+	initEsComponents();
+	queryOne_14ba0d03c8e61c3e(__context__,1.f);
+	verifyEsComponents(__context__);
+	initEsComponents();
+	queryTwo_85d37118817b8e51(__context__,0.5f);
+	verifyEsComponents(__context__);
+	initEsComponents();
+	builtin_profile(20,((char *) "es-update"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		{
+			bool __need_loop_66 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,100));
+			int32_t __i_rename_at_66;
+			__need_loop_66 = __i_iterator.first(__context__,(__i_rename_at_66)) && __need_loop_66;
+			for ( ; __need_loop_66 ; __need_loop_66 = __i_iterator.next(__context__,(__i_rename_at_66)) )
+			{
+				testEsUpdate(((char *) "ks"),__context__);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_66));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "es-update-ref"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		{
+			bool __need_loop_69 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,100));
+			int32_t __i_rename_at_69;
+			__need_loop_69 = __i_iterator.first(__context__,(__i_rename_at_69)) && __need_loop_69;
+			for ( ; __need_loop_69 ; __need_loop_69 = __i_iterator.next(__context__,(__i_rename_at_69)) )
+			{
+				testEsUpdate(((char *) "ks2"),__context__);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_69));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "es-update-ref-const"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		{
+			bool __need_loop_72 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,100));
+			int32_t __i_rename_at_72;
+			__need_loop_72 = __i_iterator.first(__context__,(__i_rename_at_72)) && __need_loop_72;
+			for ( ; __need_loop_72 ; __need_loop_72 = __i_iterator.next(__context__,(__i_rename_at_72)) )
+			{
+				testEsUpdate(((char *) "ks3"),__context__);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_72));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "es-update-def-string"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		{
+			bool __need_loop_75 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,100));
+			int32_t __i_rename_at_75;
+			__need_loop_75 = __i_iterator.first(__context__,(__i_rename_at_75)) && __need_loop_75;
+			for ( ; __need_loop_75 ; __need_loop_75 = __i_iterator.next(__context__,(__i_rename_at_75)) )
+			{
+				testEsUpdate(((char *) "ks4"),__context__);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_75));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "query-1"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		{
+			bool __need_loop_78 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,100));
+			int32_t __i_rename_at_78;
+			__need_loop_78 = __i_iterator.first(__context__,(__i_rename_at_78)) && __need_loop_78;
+			for ( ; __need_loop_78 ; __need_loop_78 = __i_iterator.next(__context__,(__i_rename_at_78)) )
+			{
+				queryOne_14ba0d03c8e61c3e(__context__,1.f);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_78));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "query-2"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		{
+			bool __need_loop_81 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,100));
+			int32_t __i_rename_at_81;
+			__need_loop_81 = __i_iterator.first(__context__,(__i_rename_at_81)) && __need_loop_81;
+			for ( ; __need_loop_81 ; __need_loop_81 = __i_iterator.next(__context__,(__i_rename_at_81)) )
+			{
+				queryTwo_85d37118817b8e51(__context__,0.5f);
+			}
+			__i_iterator.close(__context__,(__i_rename_at_81));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "query-3"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		queryThree_211670e5f95bba35(__context__);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	releaseEsComponents();
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// update_bddb78a1dcc3c2fc
+	aotLib[0xc8b5f1c5c9758125] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&update_bddb78a1dcc3c2fc>>();
+	};
+	// update2_fa8ea074124911f2
+	aotLib[0x99a07e9192802361] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&update2_fa8ea074124911f2>>();
+	};
+	// update3_86baf15b6bceeebf
+	aotLib[0xdd5919870c865175] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&update3_86baf15b6bceeebf>>();
+	};
+	// update4_4459fde14444076b
+	aotLib[0x48eb76077e01cf49] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&update4_4459fde14444076b>>();
+	};
+	// queryOne_14ba0d03c8e61c3e
+	aotLib[0xf4a1f751d8f2ad01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float  ),&queryOne_14ba0d03c8e61c3e>>();
+	};
+	// queryTwo_85d37118817b8e51
+	aotLib[0xa3856281f130e145] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float  ),&queryTwo_85d37118817b8e51>>();
+	};
+	// queryThree_211670e5f95bba35
+	aotLib[0x9de27c133892e0a9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&queryThree_211670e5f95bba35>>();
+	};
+	// test_5340ad17b06f7dc1
+	aotLib[0xdbb8795b525de4cc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_5340ad17b06f7dc1>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,150 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1077556226583475638 {
+
+extern TypeInfo __type_info__90f4307b5a6d445;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xeeb3b74c98cb09c3), 0x0 };
+TypeInfo __type_info__90f4307b5a6d445 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f4307b5a6d445) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__90f4307b5a6d445 };
+
+inline void makeRandomSequence_151e692b29f9d43d ( Context * __context__, TArray<char *> & __src_rename_at_10 );
+inline int32_t dict_2e11db7aeb59fcd9 ( Context * __context__, TTable<char *,int32_t> & __tab_rename_at_18, TArray<char *> const  & __src_rename_at_18 );
+inline bool test_6f94edf94afc7336 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void makeRandomSequence_151e692b29f9d43d ( Context * __context__, TArray<char *> &  __src_rename_at_10 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__src_rename_at_10),500000,8,__context__);
+	{
+		bool __need_loop_14 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,500000));
+		int32_t __i_rename_at_14;
+		__need_loop_14 = __i_iterator.first(__context__,(__i_rename_at_14)) && __need_loop_14;
+		for ( ; __need_loop_14 ; __need_loop_14 = __i_iterator.next(__context__,(__i_rename_at_14)) )
+		{
+			uint32_t __num_rename_at_15 = ((uint32_t)(SimPolicy<uint32_t>::Mod((0x1033c4d7u ^ uint32_t(__i_rename_at_14 * 119)),0x7a120u,*__context__,nullptr)));
+			das_copy(__src_rename_at_10(__i_rename_at_14,__context__),das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<uint32_t>::from(__num_rename_at_15))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_14));
+	};
+}
+
+inline int32_t dict_2e11db7aeb59fcd9 ( Context * __context__, TTable<char *,int32_t> &  __tab_rename_at_18, TArray<char *> const  &  __src_rename_at_18 )
+{
+	builtin_table_clear(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_18),__context__);
+	int32_t __maxOcc_rename_at_20 = 0;
+	{
+		bool __need_loop_21 = true;
+		// s : string const&
+		das_iterator<TArray<char *> const > __s_iterator(__src_rename_at_18);
+		char * const  * __s_rename_at_21;
+		__need_loop_21 = __s_iterator.first(__context__,(__s_rename_at_21)) && __need_loop_21;
+		for ( ; __need_loop_21 ; __need_loop_21 = __s_iterator.next(__context__,(__s_rename_at_21)) )
+		{
+			das_copy(__maxOcc_rename_at_20,SimPolicy<int32_t>::Max(++__tab_rename_at_18((*__s_rename_at_21),__context__),__maxOcc_rename_at_20,*__context__,nullptr));
+		}
+		__s_iterator.close(__context__,(__s_rename_at_21));
+	};
+	return das_auto_cast<int32_t>::cast(__maxOcc_rename_at_20);
+}
+
+inline bool test_6f94edf94afc7336 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,208,"test " DAS_FILE_LINE);
+{
+	TTable<char *,int32_t> __tab_rename_at_27; das_zero(__tab_rename_at_27);
+	TArray<char *> __src_rename_at_28; das_zero(__src_rename_at_28);
+	makeRandomSequence_151e692b29f9d43d(__context__,das_arg<TArray<char *>>::pass(__src_rename_at_28));
+	builtin_profile(20,((char *) "dictionary"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		dict_2e11db7aeb59fcd9(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_27),das_arg<TArray<char *>>::pass(__src_rename_at_28));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "c++ dictionary"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		testDict(das_arg<TArray<char *>>::pass(__src_rename_at_28));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// makeRandomSequence_151e692b29f9d43d
+	aotLib[0x9cda7c0de0b6aee1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&makeRandomSequence_151e692b29f9d43d>>();
+	};
+	// dict_2e11db7aeb59fcd9
+	aotLib[0x1309f16f96518c91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTable<char *,int32_t> & , TArray<char *> const  &  ),&dict_2e11db7aeb59fcd9>>();
+	};
+	// test_6f94edf94afc7336
+	aotLib[0x51df7bd5868082de] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_6f94edf94afc7336>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,271 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_2901688936917940934 {
+
+extern TypeInfo __type_info__af63e84c860200f0;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xeeb3b74c98cb09c3), 0x0 };
+TypeInfo __type_info__af63e84c860200f0 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e84c860200f0) };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__af63e84c860200f0 };
+TypeInfo * __tinfo_1[1] = { &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_2[1] = { &__type_info__90f3d07b5a6ca13 };
+
+inline void makeStrings_8b36daf9402817f9 ( Context * __context__, TArray<char *> & __src_rename_at_4, int32_t __n_rename_at_4, int32_t __len_rename_at_4 );
+inline uint64_t hashInts_11cf8524fb521262 ( Context * __context__, int32_t __n_rename_at_12 );
+inline uint64_t hashStrings_c173948bd8b224da ( Context * __context__, TArray<char *> const  & __src_rename_at_18 );
+inline int32_t tableInts_6dac2dfe3fadbe8a ( Context * __context__, TTable<int32_t,int32_t> & __tab_rename_at_24, int32_t __n_rename_at_24 );
+inline int32_t tableStrings_6cbc1664afe7791c ( Context * __context__, TTable<char *,int32_t> & __tab_rename_at_33, TArray<char *> const  & __src_rename_at_33 );
+inline bool test_b3079e4d095b459d ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void makeStrings_8b36daf9402817f9 ( Context * __context__, TArray<char *> &  __src_rename_at_4, int32_t __n_rename_at_4, int32_t __len_rename_at_4 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__src_rename_at_4),__n_rename_at_4,8,__context__);
+	{
+		bool __need_loop_6 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_4));
+		int32_t __i_rename_at_6;
+		__need_loop_6 = __i_iterator.first(__context__,(__i_rename_at_6)) && __need_loop_6;
+		for ( ; __need_loop_6 ; __need_loop_6 = __i_iterator.next(__context__,(__i_rename_at_6)) )
+		{
+			char * __s_rename_at_7 = (char *)(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<uint32_t>::from((0x1033c4d7u ^ uint32_t(__i_rename_at_6 * 119))))));
+			while ( builtin_string_length(__s_rename_at_7,__context__) < __len_rename_at_4 )
+			{
+				SimPolicy<char *>::SetAdd((char *)&(__s_rename_at_7),cast<char *>::from(__s_rename_at_7),*__context__,nullptr);
+			};
+			das_copy(__src_rename_at_4(__i_rename_at_6,__context__),__s_rename_at_7);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_6));
+	};
+}
+
+inline uint64_t hashInts_11cf8524fb521262 ( Context * __context__, int32_t __n_rename_at_12 )
+{
+	uint64_t __t_rename_at_13 = UINT64_C(0x0);
+	{
+		bool __need_loop_14 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_12));
+		int32_t __i_rename_at_14;
+		__need_loop_14 = __i_iterator.first(__context__,(__i_rename_at_14)) && __need_loop_14;
+		for ( ; __need_loop_14 ; __need_loop_14 = __i_iterator.next(__context__,(__i_rename_at_14)) )
+		{
+			__t_rename_at_13 ^= das_call_interop<uint64_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<int32_t>::from(__i_rename_at_14)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_14));
+	};
+	return das_auto_cast<uint64_t>::cast(__t_rename_at_13);
+}
+
+inline uint64_t hashStrings_c173948bd8b224da ( Context * __context__, TArray<char *> const  &  __src_rename_at_18 )
+{
+	uint64_t __t_rename_at_19 = UINT64_C(0x0);
+	{
+		bool __need_loop_20 = true;
+		// s : string const&
+		das_iterator<TArray<char *> const > __s_iterator(__src_rename_at_18);
+		char * const  * __s_rename_at_20;
+		__need_loop_20 = __s_iterator.first(__context__,(__s_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __s_iterator.next(__context__,(__s_rename_at_20)) )
+		{
+			__t_rename_at_19 ^= das_call_interop<uint64_t>::call(&_builtin_hash,__context__,SimNode_AotInterop<1>(__tinfo_2,cast<char * const >::from((*__s_rename_at_20))));
+		}
+		__s_iterator.close(__context__,(__s_rename_at_20));
+	};
+	return das_auto_cast<uint64_t>::cast(__t_rename_at_19);
+}
+
+inline int32_t tableInts_6dac2dfe3fadbe8a ( Context * __context__, TTable<int32_t,int32_t> &  __tab_rename_at_24, int32_t __n_rename_at_24 )
+{
+	builtin_table_clear(das_arg<TTable<int32_t,int32_t>>::pass(__tab_rename_at_24),__context__);
+	{
+		bool __need_loop_26 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_24));
+		int32_t __i_rename_at_26;
+		__need_loop_26 = __i_iterator.first(__context__,(__i_rename_at_26)) && __need_loop_26;
+		for ( ; __need_loop_26 ; __need_loop_26 = __i_iterator.next(__context__,(__i_rename_at_26)) )
+		{
+			das_copy(__tab_rename_at_24((__i_rename_at_26 * 7),__context__),__i_rename_at_26);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_26));
+	};
+	int32_t __t_rename_at_28 = 0;
+	{
+		bool __need_loop_29 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_24));
+		int32_t __i_rename_at_29;
+		__need_loop_29 = __i_iterator.first(__context__,(__i_rename_at_29)) && __need_loop_29;
+		for ( ; __need_loop_29 ; __need_loop_29 = __i_iterator.next(__context__,(__i_rename_at_29)) )
+		{
+			__t_rename_at_28 += __tab_rename_at_24((__i_rename_at_29 * 7),__context__);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_29));
+	};
+	return das_auto_cast<int32_t>::cast(__t_rename_at_28);
+}
+
+inline int32_t tableStrings_6cbc1664afe7791c ( Context * __context__, TTable<char *,int32_t> &  __tab_rename_at_33, TArray<char *> const  &  __src_rename_at_33 )
+{
+	builtin_table_clear(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_33),__context__);
+	{
+		bool __need_loop_35 = true;
+		// s : string const&
+		das_iterator<TArray<char *> const > __s_iterator(__src_rename_at_33);
+		char * const  * __s_rename_at_35;
+		__need_loop_35 = __s_iterator.first(__context__,(__s_rename_at_35)) && __need_loop_35;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(builtin_array_size(__src_rename_at_33)));
+		int32_t __i_rename_at_35;
+		__need_loop_35 = __i_iterator.first(__context__,(__i_rename_at_35)) && __need_loop_35;
+		for ( ; __need_loop_35 ; __need_loop_35 = __s_iterator.next(__context__,(__s_rename_at_35)) && __i_iterator.next(__context__,(__i_rename_at_35)) )
+		{
+			das_copy(__tab_rename_at_33((*__s_rename_at_35),__context__),__i_rename_at_35);
+		}
+		__s_iterator.close(__context__,(__s_rename_at_35));
+		__i_iterator.close(__context__,(__i_rename_at_35));
+	};
+	int32_t __t_rename_at_37 = 0;
+	{
+		bool __need_loop_38 = true;
+		// s : string const&
+		das_iterator<TArray<char *> const > __s_iterator(__src_rename_at_33);
+		char * const  * __s_rename_at_38;
+		__need_loop_38 = __s_iterator.first(__context__,(__s_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __s_iterator.next(__context__,(__s_rename_at_38)) )
+		{
+			__t_rename_at_37 += __tab_rename_at_33((*__s_rename_at_38),__context__);
+		}
+		__s_iterator.close(__context__,(__s_rename_at_38));
+	};
+	return das_auto_cast<int32_t>::cast(__t_rename_at_37);
+}
+
+inline bool test_b3079e4d095b459d ( Context * __context__ ) { das_stack_prologue __prologue(__context__,448,"test " DAS_FILE_LINE);
+{
+	TArray<char *> __shortS_rename_at_45; das_zero(__shortS_rename_at_45); TArray<char *> __longS_rename_at_45; das_zero(__longS_rename_at_45);
+	makeStrings_8b36daf9402817f9(__context__,das_arg<TArray<char *>>::pass(__shortS_rename_at_45),500000,8);
+	makeStrings_8b36daf9402817f9(__context__,das_arg<TArray<char *>>::pass(__longS_rename_at_45),50000,256);
+	TTable<int32_t,int32_t> __itab_rename_at_48; das_zero(__itab_rename_at_48);
+	TTable<char *,int32_t> __stab_rename_at_49; das_zero(__stab_rename_at_49);
+	uint64_t __h_rename_at_50 = UINT64_C(0x0);
+	builtin_profile(20,((char *) "hash int"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		__h_rename_at_50 += hashInts_11cf8524fb521262(__context__,builtin_array_size(das_arg<TArray<char *>>::pass(__shortS_rename_at_45)));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "hash short string"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		__h_rename_at_50 += hashStrings_c173948bd8b224da(__context__,das_arg<TArray<char *>>::pass(__shortS_rename_at_45));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "hash long string"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		__h_rename_at_50 += hashStrings_c173948bd8b224da(__context__,das_arg<TArray<char *>>::pass(__longS_rename_at_45));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "table<int;int>"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		tableInts_6dac2dfe3fadbe8a(__context__,das_arg<TTable<int32_t,int32_t>>::pass(__itab_rename_at_48),500000);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "table<string;int>"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		tableStrings_6cbc1664afe7791c(__context__,das_arg<TTable<char *,int32_t>>::pass(__stab_rename_at_49),das_arg<TArray<char *>>::pass(__shortS_rename_at_45));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(__h_rename_at_50 != UINT64_C(0x0));
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// makeStrings_8b36daf9402817f9
+	aotLib[0xde72849c19b7696d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t , int32_t  ),&makeStrings_8b36daf9402817f9>>();
+	};
+	// hashInts_11cf8524fb521262
+	aotLib[0x9a50b3a70d94a105] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint64_t (*) ( Context * __context__, int32_t  ),&hashInts_11cf8524fb521262>>();
+	};
+	// hashStrings_c173948bd8b224da
+	aotLib[0x516aa088b3ae0d3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint64_t (*) ( Context * __context__, TArray<char *> const  &  ),&hashStrings_c173948bd8b224da>>();
+	};
+	// tableInts_6dac2dfe3fadbe8a
+	aotLib[0x74e828ad4237f579] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTable<int32_t,int32_t> & , int32_t  ),&tableInts_6dac2dfe3fadbe8a>>();
+	};
+	// tableStrings_6cbc1664afe7791c
+	aotLib[0xd8d2cf860d5305c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTable<char *,int32_t> & , TArray<char *> const  &  ),&tableStrings_6cbc1664afe7791c>>();
+	};
+	// test_b3079e4d095b459d
+	aotLib[0x9a4774629d37ed93] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_b3079e4d095b459d>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
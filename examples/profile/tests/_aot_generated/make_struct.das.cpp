@@ -0,0 +1,192 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_7076530385337193308 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xeeb3b74c98cb09c3), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+	int32_t x;
+	int32_t y;
+	int32_t z;
+	int32_t w;
+};
+static_assert(sizeof(Foo)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,z)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,w)==12,"structure field offset mismatch with DAS");
+}
+
+inline Foo make_1_b6d0fe9bcdc34491 ( Context * __context__ );
+inline Foo make_2_5822dd8c4a731ef9 ( Context * __context__ );
+inline int32_t test_1_9d72e89c45c64f49 ( Context * __context__ );
+inline int32_t test_2_cae879489a21cf9b ( Context * __context__ );
+inline bool test_516c216fe1717b9e ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Foo make_1_b6d0fe9bcdc34491 ( Context * __context__ )
+{
+	Foo __t_rename_at_6; das_zero(__t_rename_at_6);
+	das_copy(__t_rename_at_6.x,1);
+	das_copy(__t_rename_at_6.y,2);
+	das_copy(__t_rename_at_6.z,3);
+	das_copy(__t_rename_at_6.w,4);
+	return das_auto_cast_ref<Foo>::cast(__t_rename_at_6);
+}
+
+inline Foo make_2_5822dd8c4a731ef9 ( Context * __context__ )
+{
+	return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+		Foo __mks_15;
+		das_copy((__mks_15.x),(1));
+		das_copy((__mks_15.y),(2));
+		das_copy((__mks_15.z),(3));
+		das_copy((__mks_15.w),(4));
+		return __mks_15;
+	})()));
+}
+
+inline int32_t test_1_9d72e89c45c64f49 ( Context * __context__ )
+{
+	int32_t __q_rename_at_18 = 0;
+	{
+		bool __need_loop_19 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,1000000));
+		int32_t __x_rename_at_19;
+		__need_loop_19 = __x_iterator.first(__context__,(__x_rename_at_19)) && __need_loop_19;
+		for ( ; __need_loop_19 ; __need_loop_19 = __x_iterator.next(__context__,(__x_rename_at_19)) )
+		{
+			Foo _temp_make_local_20_13_64;
+			__q_rename_at_18 += (_temp_make_local_20_13_64 = (make_1_b6d0fe9bcdc34491(__context__))).x;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_19));
+	};
+	return das_auto_cast<int32_t>::cast(__q_rename_at_18);
+}
+
+inline int32_t test_2_cae879489a21cf9b ( Context * __context__ )
+{
+	int32_t __q_rename_at_24 = 0;
+	{
+		bool __need_loop_25 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,1000000));
+		int32_t __x_rename_at_25;
+		__need_loop_25 = __x_iterator.first(__context__,(__x_rename_at_25)) && __need_loop_25;
+		for ( ; __need_loop_25 ; __need_loop_25 = __x_iterator.next(__context__,(__x_rename_at_25)) )
+		{
+			Foo _temp_make_local_26_13_64;
+			__q_rename_at_24 += (_temp_make_local_26_13_64 = (make_2_5822dd8c4a731ef9(__context__))).x;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_25));
+	};
+	return das_auto_cast<int32_t>::cast(__q_rename_at_24);
+}
+
+inline bool test_516c216fe1717b9e ( Context * __context__ ) { das_stack_prologue __prologue(__context__,160,"test " DAS_FILE_LINE);
+{
+	int32_t __q1_rename_at_31 = 0;
+	builtin_profile(20,((char *) "make t.x=1;..."),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		das_copy(__q1_rename_at_31,test_1_9d72e89c45c64f49(__context__));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_ASSERT((__q1_rename_at_31 == 1000000));
+	int32_t __q2_rename_at_35 = 0;
+	builtin_profile(20,((char *) "make [[Foo x=1;...]]"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		das_copy(__q2_rename_at_35,test_2_cae879489a21cf9b(__context__));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_ASSERT((__q2_rename_at_35 == 1000000));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// make_1_b6d0fe9bcdc34491
+	aotLib[0xd20a82bafe9dd799] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&make_1_b6d0fe9bcdc34491>>();
+	};
+	// make_2_5822dd8c4a731ef9
+	aotLib[0xbdd8ee59cad0fb9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&make_2_5822dd8c4a731ef9>>();
+	};
+	// test_1_9d72e89c45c64f49
+	aotLib[0x83b89b976c6156d3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&test_1_9d72e89c45c64f49>>();
+	};
+	// test_2_cae879489a21cf9b
+	aotLib[0x86194ee4b4abffe2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&test_2_cae879489a21cf9b>>();
+	};
+	// test_516c216fe1717b9e
+	aotLib[0x534f91243ca24fa4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_516c216fe1717b9e>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,285 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15285581866671510686 {
+
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__af63d94c8601e773;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xeeb3b74c98cb09c3), 0x0 };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+TypeInfo __type_info__af63d94c8601e773 = { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0xaf63d94c8601e773) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63d94c8601e773, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_1[3] = { &__type_info__90f3d07b5a6ca13, &__type_info__af63d94c8601e773, &__type_info__90f3d07b5a6ca13 };
+namespace  { struct body; };
+namespace  {
+
+struct body {
+	double x;
+	double y;
+	double z;
+	double vx;
+	double vy;
+	double vz;
+	double mass;
+};
+static_assert(sizeof(body)==56,"structure size mismatch with DAS");
+static_assert(offsetof(body,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,y)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,z)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,vx)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,vy)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,vz)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,mass)==48,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_0x60_advance_498374cced7dd375 ( Context * __context__, double __dt_rename_at_27, TDim<body,5> & __bodies_rename_at_27 );
+inline void offset_momentum_9f818c517988e8a0 ( Context * __context__, TDim<body,5> & __bodies_rename_at_17 );
+inline double energy_f569aabbd7962ae ( Context * __context__, TDim<body,5> & __bodies_rename_at_48 );
+inline bool test_59605767a787bced ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<TDim<body,5>,0xb4a35b540d9dd21f>(__context__) = (([&]() -> TDim<body,5> {
+		TDim<body,5> __mks_61;
+		das_zero(__mks_61);
+		das_copy((__mks_61(0,__context__).mass),(39.478417604357432));
+		das_copy((__mks_61(1,__context__).x),(4.8414314424647209));
+		das_copy((__mks_61(1,__context__).y),(-1.1603200440274284));
+		das_copy((__mks_61(1,__context__).z),(-0.10362204447112311));
+		das_copy((__mks_61(1,__context__).vx),(0.60632639299583202));
+		das_copy((__mks_61(1,__context__).vy),(2.8119868449162602));
+		das_copy((__mks_61(1,__context__).vz),(-0.025218361659887629));
+		das_copy((__mks_61(1,__context__).mass),(0.037693674870389493));
+		das_copy((__mks_61(2,__context__).x),(8.3433667182445799));
+		das_copy((__mks_61(2,__context__).y),(4.1247985641243048));
+		das_copy((__mks_61(2,__context__).z),(-0.40352341711432138));
+		das_copy((__mks_61(2,__context__).vx),(-1.0107743461787924));
+		das_copy((__mks_61(2,__context__).vy),(1.8256623712304119));
+		das_copy((__mks_61(2,__context__).vz),(0.0084157613765841535));
+		das_copy((__mks_61(2,__context__).mass),(0.011286326131968767));
+		das_copy((__mks_61(3,__context__).x),(12.894369562139131));
+		das_copy((__mks_61(3,__context__).y),(-15.111151401698631));
+		das_copy((__mks_61(3,__context__).z),(-0.22330757889265573));
+		das_copy((__mks_61(3,__context__).vx),(1.0827910064415354));
+		das_copy((__mks_61(3,__context__).vy),(0.86871301816960822));
+		das_copy((__mks_61(3,__context__).vz),(-0.010832637401363636));
+		das_copy((__mks_61(3,__context__).mass),(0.0017237240570597112));
+		das_copy((__mks_61(4,__context__).x),(15.379697114850917));
+		das_copy((__mks_61(4,__context__).y),(-25.919314609987964));
+		das_copy((__mks_61(4,__context__).z),(0.17925877295037118));
+		das_copy((__mks_61(4,__context__).vx),(0.97909073224389798));
+		das_copy((__mks_61(4,__context__).vy),(0.59469899864767617));
+		das_copy((__mks_61(4,__context__).vz),(-0.034755955504078104));
+		das_copy((__mks_61(4,__context__).mass),(0.0020336868699246304));
+		return __mks_61;
+	})());/*g_bodies*/
+}
+
+inline void _Func_0x60_advance_498374cced7dd375 ( Context * __context__, double __dt_rename_at_27, TDim<body,5> &  __bodies_rename_at_27 )
+{
+	int32_t __i_rename_at_28 = 0;
+	{
+		bool __need_loop_29 = true;
+		// b : body& -const
+		das_iterator<TDim<body,5>> __b_iterator(__bodies_rename_at_27);
+		body * __b_rename_at_29;
+		__need_loop_29 = __b_iterator.first(__context__,(__b_rename_at_29)) && __need_loop_29;
+		for ( ; __need_loop_29 ; __need_loop_29 = __b_iterator.next(__context__,(__b_rename_at_29)) )
+		{
+			++__i_rename_at_28;
+			{
+				bool __need_loop_31 = true;
+				// j : int const
+				das_iterator<range> __j_iterator(range(__i_rename_at_28,5));
+				int32_t __j_rename_at_31;
+				__need_loop_31 = __j_iterator.first(__context__,(__j_rename_at_31)) && __need_loop_31;
+				for ( ; __need_loop_31 ; __need_loop_31 = __j_iterator.next(__context__,(__j_rename_at_31)) )
+				{
+					body * __b2_rename_at_32 = &(__bodies_rename_at_27(__j_rename_at_31,__context__));
+					double __dx_rename_at_33 = ((double)((*__b_rename_at_29).x - (*__b2_rename_at_32).x));
+					double __dy_rename_at_34 = ((double)((*__b_rename_at_29).y - (*__b2_rename_at_32).y));
+					double __dz_rename_at_35 = ((double)((*__b_rename_at_29).z - (*__b2_rename_at_32).z));
+					double __dsq_rename_at_36 = ((double)(((__dx_rename_at_33 * __dx_rename_at_33) + (__dy_rename_at_34 * __dy_rename_at_34)) + (__dz_rename_at_35 * __dz_rename_at_35)));
+					double __mag_rename_at_37 = ((double)(SimPolicy<double>::Div(__dt_rename_at_27,(__dsq_rename_at_36 * dsqrt(__dsq_rename_at_36)),*__context__,nullptr)));
+					(*__b_rename_at_29).vx -= (__dx_rename_at_33 * ((*__b2_rename_at_32).mass * __mag_rename_at_37));
+					(*__b_rename_at_29).vy -= (__dy_rename_at_34 * ((*__b2_rename_at_32).mass * __mag_rename_at_37));
+					(*__b_rename_at_29).vz -= (__dz_rename_at_35 * ((*__b2_rename_at_32).mass * __mag_rename_at_37));
+					(*__b2_rename_at_32).vx += (__dx_rename_at_33 * ((*__b_rename_at_29).mass * __mag_rename_at_37));
+					(*__b2_rename_at_32).vy += (__dy_rename_at_34 * ((*__b_rename_at_29).mass * __mag_rename_at_37));
+					(*__b2_rename_at_32).vz += (__dz_rename_at_35 * ((*__b_rename_at_29).mass * __mag_rename_at_37));
+				}
+				__j_iterator.close(__context__,(__j_rename_at_31));
+			};
+			(*__b_rename_at_29).x += (__dt_rename_at_27 * (*__b_rename_at_29).vx);
+			(*__b_rename_at_29).y += (__dt_rename_at_27 * (*__b_rename_at_29).vy);
+			(*__b_rename_at_29).z += (__dt_rename_at_27 * (*__b_rename_at_29).vz);
+		}
+		__b_iterator.close(__context__,(__b_rename_at_29));
+	};
+}
+
+inline void offset_momentum_9f818c517988e8a0 ( Context * __context__, TDim<body,5> &  __bodies_rename_at_17 )
+{
+	double __px_rename_at_18 = 0; double __py_rename_at_18 = 0; double __pz_rename_at_18 = 0;
+	{
+		bool __need_loop_19 = true;
+		// b : body& -const
+		das_iterator<TDim<body,5>> __b_iterator(__bodies_rename_at_17);
+		body * __b_rename_at_19;
+		__need_loop_19 = __b_iterator.first(__context__,(__b_rename_at_19)) && __need_loop_19;
+		for ( ; __need_loop_19 ; __need_loop_19 = __b_iterator.next(__context__,(__b_rename_at_19)) )
+		{
+			__px_rename_at_18 -= ((*__b_rename_at_19).vx * (*__b_rename_at_19).mass);
+			__py_rename_at_18 -= ((*__b_rename_at_19).vy * (*__b_rename_at_19).mass);
+			__pz_rename_at_18 -= ((*__b_rename_at_19).vz * (*__b_rename_at_19).mass);
+		}
+		__b_iterator.close(__context__,(__b_rename_at_19));
+	};
+	das_copy(__bodies_rename_at_17(0,__context__).vx,SimPolicy<double>::Div(__px_rename_at_18,39.478417604357432,*__context__,nullptr));
+	das_copy(__bodies_rename_at_17(0,__context__).vy,SimPolicy<double>::Div(__py_rename_at_18,39.478417604357432,*__context__,nullptr));
+	das_copy(__bodies_rename_at_17(0,__context__).vz,SimPolicy<double>::Div(__pz_rename_at_18,39.478417604357432,*__context__,nullptr));
+}
+
+inline double energy_f569aabbd7962ae ( Context * __context__, TDim<body,5> &  __bodies_rename_at_48 )
+{
+	double __e_rename_at_49 = 0.;
+	int32_t __i_rename_at_50 = 0;
+	{
+		bool __need_loop_51 = true;
+		// b : body& -const
+		das_iterator<TDim<body,5>> __b_iterator(__bodies_rename_at_48);
+		body * __b_rename_at_51;
+		__need_loop_51 = __b_iterator.first(__context__,(__b_rename_at_51)) && __need_loop_51;
+		for ( ; __need_loop_51 ; __need_loop_51 = __b_iterator.next(__context__,(__b_rename_at_51)) )
+		{
+			__e_rename_at_49 += (((*__b_rename_at_51).mass * 0.5) * ((((*__b_rename_at_51).vx * (*__b_rename_at_51).vx) + ((*__b_rename_at_51).vy * (*__b_rename_at_51).vy)) + ((*__b_rename_at_51).vz * (*__b_rename_at_51).vz)));
+			++__i_rename_at_50;
+			{
+				bool __need_loop_54 = true;
+				// j : int const
+				das_iterator<range> __j_iterator(range(__i_rename_at_50,5));
+				int32_t __j_rename_at_54;
+				__need_loop_54 = __j_iterator.first(__context__,(__j_rename_at_54)) && __need_loop_54;
+				for ( ; __need_loop_54 ; __need_loop_54 = __j_iterator.next(__context__,(__j_rename_at_54)) )
+				{
+					body __b2_rename_at_55_ConstRef = ((body)__bodies_rename_at_48(__j_rename_at_54,__context__));
+	body const  & __b2_rename_at_55 = __b2_rename_at_55_ConstRef; ;
+					__e_rename_at_49 -= (SimPolicy<double>::Div(((*__b_rename_at_51).mass * __b2_rename_at_55.mass),dsqrt(((((*__b_rename_at_51).x - __b2_rename_at_55.x) * ((*__b_rename_at_51).x - __b2_rename_at_55.x)) + (((*__b_rename_at_51).y - __b2_rename_at_55.y) * ((*__b_rename_at_51).y - __b2_rename_at_55.y))) + (((*__b_rename_at_51).z - __b2_rename_at_55.z) * ((*__b_rename_at_51).z - __b2_rename_at_55.z))),*__context__,nullptr));
+				}
+				__j_iterator.close(__context__,(__j_rename_at_54));
+			};
+		}
+		__b_iterator.close(__context__,(__b_rename_at_51));
+	};
+	return das_auto_cast<double>::cast(__e_rename_at_49);
+}
+
+inline bool test_59605767a787bced ( Context * __context__ ) { das_stack_prologue __prologue(__context__,96,"test " DAS_FILE_LINE);
+{
+	offset_momentum_9f818c517988e8a0(__context__,das_arg<TDim<body,5>>::pass(das_global<TDim<body,5>,0xb4a35b540d9dd21f>(__context__) /*g_bodies*/));
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_0, cast<char * const >::from(((char *) "initial energy ")), cast<double>::from(energy_f569aabbd7962ae(__context__,das_arg<TDim<body,5>>::pass(das_global<TDim<body,5>,0xb4a35b540d9dd21f>(__context__) /*g_bodies*/))), cast<char * const >::from(((char *) "\n")))),__context__);
+	builtin_profile(10,((char *) "n-bodies"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		{
+			bool __need_loop_87 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(range(0,500000));
+			int32_t __i_rename_at_87;
+			__need_loop_87 = __i_iterator.first(__context__,(__i_rename_at_87)) && __need_loop_87;
+			for ( ; __need_loop_87 ; __need_loop_87 = __i_iterator.next(__context__,(__i_rename_at_87)) )
+			{
+				_Func_0x60_advance_498374cced7dd375(__context__,0.01,das_arg<TDim<body,5>>::pass(das_global<TDim<body,5>,0xb4a35b540d9dd21f>(__context__) /*g_bodies*/));
+			}
+			__i_iterator.close(__context__,(__i_rename_at_87));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<3>(__tinfo_1, cast<char * const >::from(((char *) "result energy ")), cast<double>::from(energy_f569aabbd7962ae(__context__,das_arg<TDim<body,5>>::pass(das_global<TDim<body,5>,0xb4a35b540d9dd21f>(__context__) /*g_bodies*/))), cast<char * const >::from(((char *) "\n")))),__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_advance_498374cced7dd375
+	aotLib[0x654c723066223f59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, double , TDim<body,5> &  ),&_Func_0x60_advance_498374cced7dd375>>();
+	};
+	// offset_momentum_9f818c517988e8a0
+	aotLib[0xbbae07f9d94cd07d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<body,5> &  ),&offset_momentum_9f818c517988e8a0>>();
+	};
+	// energy_f569aabbd7962ae
+	aotLib[0x56875ccc860f50bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<double (*) ( Context * __context__, TDim<body,5> &  ),&energy_f569aabbd7962ae>>();
+	};
+	// test_59605767a787bced
+	aotLib[0x70b0a911405294dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_59605767a787bced>>();
+	};
+	// [[ init script ]]
+	aotLib[0x7524a0a92b464cda] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,284 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5528257322480287957 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xeeb3b74c98cb09c3), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct body; };
+namespace  {
+
+struct body {
+	float x;
+	float y;
+	float z;
+	float vx;
+	float vy;
+	float vz;
+	float mass;
+};
+static_assert(sizeof(body)==28,"structure size mismatch with DAS");
+static_assert(offsetof(body,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,z)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,vx)==12,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,vy)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,vz)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(body,mass)==24,"structure field offset mismatch with DAS");
+}
+
+inline void _Func_0x60_scale_bodies_9256f4812350bf1e ( Context * __context__, float __scale_rename_at_77 );
+inline void _Func_0x60_nbodies_18cca4b849c908a4 ( Context * __context__, int32_t __n_rename_at_84 );
+inline void offset_momentum_65fe80e378ae68d3 ( Context * __context__ );
+inline void advance_29b6f0ce267cc380 ( Context * __context__ );
+inline bool test_e894d6e8711812e3 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<TDim<body,5>,0x6ca0e44c3a6cbd35>(__context__) = (([&]() -> TDim<body,5> {
+		TDim<body,5> __mks_18;
+		das_copy((__mks_18(0,__context__).x),(0.f));
+		das_copy((__mks_18(0,__context__).y),(0.f));
+		das_copy((__mks_18(0,__context__).z),(0.f));
+		das_copy((__mks_18(0,__context__).vx),(0.f));
+		das_copy((__mks_18(0,__context__).vy),(0.f));
+		das_copy((__mks_18(0,__context__).vz),(0.f));
+		das_copy((__mks_18(0,__context__).mass),(39.4784203f));
+		das_copy((__mks_18(1,__context__).x),(4.84143162f));
+		das_copy((__mks_18(1,__context__).y),(-1.16032004f));
+		das_copy((__mks_18(1,__context__).z),(-0.103622042f));
+		das_copy((__mks_18(1,__context__).vx),(0.606326401f));
+		das_copy((__mks_18(1,__context__).vy),(2.81198692f));
+		das_copy((__mks_18(1,__context__).vz),(-0.0252183601f));
+		das_copy((__mks_18(1,__context__).mass),(0.0376936793f));
+		das_copy((__mks_18(2,__context__).x),(8.34336662f));
+		das_copy((__mks_18(2,__context__).y),(4.12479877f));
+		das_copy((__mks_18(2,__context__).z),(-0.403523415f));
+		das_copy((__mks_18(2,__context__).vx),(-1.01077425f));
+		das_copy((__mks_18(2,__context__).vy),(1.82566226f));
+		das_copy((__mks_18(2,__context__).vz),(0.0084157614f));
+		das_copy((__mks_18(2,__context__).mass),(0.0112863267f));
+		das_copy((__mks_18(3,__context__).x),(12.8943691f));
+		das_copy((__mks_18(3,__context__).y),(-15.1111517f));
+		das_copy((__mks_18(3,__context__).z),(-0.22330758f));
+		das_copy((__mks_18(3,__context__).vx),(1.08279097f));
+		das_copy((__mks_18(3,__context__).vy),(0.868712962f));
+		das_copy((__mks_18(3,__context__).vz),(-0.0108326375f));
+		das_copy((__mks_18(3,__context__).mass),(0.00172372418f));
+		das_copy((__mks_18(4,__context__).x),(15.3796968f));
+		das_copy((__mks_18(4,__context__).y),(-25.9193153f));
+		das_copy((__mks_18(4,__context__).z),(0.179258779f));
+		das_copy((__mks_18(4,__context__).vx),(0.979090691f));
+		das_copy((__mks_18(4,__context__).vy),(0.594698966f));
+		das_copy((__mks_18(4,__context__).vz),(-0.0347559527f));
+		das_copy((__mks_18(4,__context__).mass),(0.00203368696f));
+		return __mks_18;
+	})());/*bodies*/
+}
+
+inline void _Func_0x60_scale_bodies_9256f4812350bf1e ( Context * __context__, float __scale_rename_at_77 )
+{
+	{
+		bool __need_loop_78 = true;
+		// b : body&
+		das_iterator<TDim<body,5>> __b_iterator(das_global<TDim<body,5>,0x6ca0e44c3a6cbd35>(__context__) /*bodies*/);
+		body * __b_rename_at_78;
+		__need_loop_78 = __b_iterator.first(__context__,(__b_rename_at_78)) && __need_loop_78;
+		for ( ; __need_loop_78 ; __need_loop_78 = __b_iterator.next(__context__,(__b_rename_at_78)) )
+		{
+			(*__b_rename_at_78).mass *= (__scale_rename_at_77 * __scale_rename_at_77);
+			das_copy((*__b_rename_at_78).vx,(*__b_rename_at_78).vx * __scale_rename_at_77);
+			das_copy((*__b_rename_at_78).vy,(*__b_rename_at_78).vy * __scale_rename_at_77);
+			das_copy((*__b_rename_at_78).vz,(*__b_rename_at_78).vz * __scale_rename_at_77);
+		}
+		__b_iterator.close(__context__,(__b_rename_at_78));
+	};
+}
+
+inline void _Func_0x60_nbodies_18cca4b849c908a4 ( Context * __context__, int32_t __n_rename_at_84 )
+{
+	_Func_0x60_scale_bodies_9256f4812350bf1e(__context__,0.00999999978f);
+	{
+		bool __need_loop_86 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_84));
+		int32_t __i_rename_at_86;
+		__need_loop_86 = __i_iterator.first(__context__,(__i_rename_at_86)) && __need_loop_86;
+		for ( ; __need_loop_86 ; __need_loop_86 = __i_iterator.next(__context__,(__i_rename_at_86)) )
+		{
+			advance_29b6f0ce267cc380(__context__);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_86));
+	};
+	_Func_0x60_scale_bodies_9256f4812350bf1e(__context__,100.f);
+}
+
+inline void offset_momentum_65fe80e378ae68d3 ( Context * __context__ )
+{
+	float __px_rename_at_42 = 0; float __py_rename_at_42 = 0; float __pz_rename_at_42 = 0;
+	{
+		bool __need_loop_43 = true;
+		// b : body&
+		das_iterator<TDim<body,5>> __b_iterator(das_global<TDim<body,5>,0x6ca0e44c3a6cbd35>(__context__) /*bodies*/);
+		body * __b_rename_at_43;
+		__need_loop_43 = __b_iterator.first(__context__,(__b_rename_at_43)) && __need_loop_43;
+		for ( ; __need_loop_43 ; __need_loop_43 = __b_iterator.next(__context__,(__b_rename_at_43)) )
+		{
+			__px_rename_at_42 -= ((*__b_rename_at_43).vx * (*__b_rename_at_43).mass);
+			__py_rename_at_42 -= ((*__b_rename_at_43).vy * (*__b_rename_at_43).mass);
+			__pz_rename_at_42 -= ((*__b_rename_at_43).vz * (*__b_rename_at_43).mass);
+		}
+		__b_iterator.close(__context__,(__b_rename_at_43));
+	};
+	das_copy(das_global<TDim<body,5>,0x6ca0e44c3a6cbd35>(__context__) /*bodies*/(0,__context__).vx,SimPolicy<float>::Div(__px_rename_at_42,39.4784203f,*__context__,nullptr));
+	das_copy(das_global<TDim<body,5>,0x6ca0e44c3a6cbd35>(__context__) /*bodies*/(0,__context__).vy,SimPolicy<float>::Div(__py_rename_at_42,39.4784203f,*__context__,nullptr));
+	das_copy(das_global<TDim<body,5>,0x6ca0e44c3a6cbd35>(__context__) /*bodies*/(0,__context__).vz,SimPolicy<float>::Div(__pz_rename_at_42,39.4784203f,*__context__,nullptr));
+}
+
+inline void advance_29b6f0ce267cc380 ( Context * __context__ )
+{
+	{
+		bool __need_loop_52 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,5));
+		int32_t __i_rename_at_52;
+		__need_loop_52 = __i_iterator.first(__context__,(__i_rename_at_52)) && __need_loop_52;
+		for ( ; __need_loop_52 ; __need_loop_52 = __i_iterator.next(__context__,(__i_rename_at_52)) )
+		{
+			body * __b_rename_at_53 = &(das_global<TDim<body,5>,0x6ca0e44c3a6cbd35>(__context__) /*bodies*/(__i_rename_at_52,__context__));
+			{
+				bool __need_loop_54 = true;
+				// j : int const
+				das_iterator<range> __j_iterator(range(__i_rename_at_52 + 1,5));
+				int32_t __j_rename_at_54;
+				__need_loop_54 = __j_iterator.first(__context__,(__j_rename_at_54)) && __need_loop_54;
+				for ( ; __need_loop_54 ; __need_loop_54 = __j_iterator.next(__context__,(__j_rename_at_54)) )
+				{
+					body * __b2_rename_at_55 = &(das_global<TDim<body,5>,0x6ca0e44c3a6cbd35>(__context__) /*bodies*/(__j_rename_at_54,__context__));
+					float __dx_rename_at_56 = ((float)((*__b_rename_at_53).x - (*__b2_rename_at_55).x));
+					float __dy_rename_at_57 = ((float)((*__b_rename_at_53).y - (*__b2_rename_at_55).y));
+					float __dz_rename_at_58 = ((float)((*__b_rename_at_53).z - (*__b2_rename_at_55).z));
+					float __inv_distance_rename_at_59 = ((float)(SimPolicy<float>::Div(1.f,SimPolicy<float>::Sqrt(((__dx_rename_at_56 * __dx_rename_at_56) + (__dy_rename_at_57 * __dy_rename_at_57)) + (__dz_rename_at_58 * __dz_rename_at_58),*__context__,nullptr),*__context__,nullptr)));
+					float __mag_rename_at_60 = ((float)((__inv_distance_rename_at_59 * __inv_distance_rename_at_59) * __inv_distance_rename_at_59));
+					das_copy((*__b_rename_at_53).vx,(*__b_rename_at_53).vx - (__dx_rename_at_56 * ((*__b2_rename_at_55).mass * __mag_rename_at_60)));
+					das_copy((*__b_rename_at_53).vy,(*__b_rename_at_53).vy - (__dy_rename_at_57 * ((*__b2_rename_at_55).mass * __mag_rename_at_60)));
+					das_copy((*__b_rename_at_53).vz,(*__b_rename_at_53).vz - (__dz_rename_at_58 * ((*__b2_rename_at_55).mass * __mag_rename_at_60)));
+					das_copy((*__b2_rename_at_55).vx,(*__b2_rename_at_55).vx + (__dx_rename_at_56 * ((*__b_rename_at_53).mass * __mag_rename_at_60)));
+					das_copy((*__b2_rename_at_55).vy,(*__b2_rename_at_55).vy + (__dy_rename_at_57 * ((*__b_rename_at_53).mass * __mag_rename_at_60)));
+					das_copy((*__b2_rename_at_55).vz,(*__b2_rename_at_55).vz + (__dz_rename_at_58 * ((*__b_rename_at_53).mass * __mag_rename_at_60)));
+				}
+				__j_iterator.close(__context__,(__j_rename_at_54));
+			};
+			(*__b_rename_at_53).x += (*__b_rename_at_53).vx;
+			(*__b_rename_at_53).y += (*__b_rename_at_53).vy;
+			(*__b_rename_at_53).z += (*__b_rename_at_53).vz;
+		}
+		__i_iterator.close(__context__,(__i_rename_at_52));
+	};
+}
+
+inline bool test_e894d6e8711812e3 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,128,"test " DAS_FILE_LINE);
+{
+	offset_momentum_65fe80e378ae68d3(__context__);
+	builtin_profile(10,((char *) "n-bodies, scalar"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		_Func_0x60_nbodies_18cca4b849c908a4(__context__,500000);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	testNBodiesInit();
+	builtin_profile(10,((char *) "n-bodies, scalar, C++"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		testNBodiesS(500000);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_scale_bodies_9256f4812350bf1e
+	aotLib[0xf6363e104fb964c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float  ),&_Func_0x60_scale_bodies_9256f4812350bf1e>>();
+	};
+	// _Func_0x60_nbodies_18cca4b849c908a4
+	aotLib[0x289d7d1badf161c6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t  ),&_Func_0x60_nbodies_18cca4b849c908a4>>();
+	};
+	// offset_momentum_65fe80e378ae68d3
+	aotLib[0x20eb54af2b5f3ad5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&offset_momentum_65fe80e378ae68d3>>();
+	};
+	// advance_29b6f0ce267cc380
+	aotLib[0x3a47d87abc5a0e05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&advance_29b6f0ce267cc380>>();
+	};
+	// test_e894d6e8711812e3
+	aotLib[0xc0f62c586033ee07] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_e894d6e8711812e3>>();
+	};
+	// [[ init script ]]
+	aotLib[0xa647768f6f577aa3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,138 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_324862095545919497 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xeeb3b74c98cb09c3), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline void tryCatch_f6004e3e954e2f1f ( Context * __context__ );
+inline bool test_73e6ec26b7f97b85 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void tryCatch_f6004e3e954e2f1f ( Context * __context__ )
+{
+	TDim<int32_t,1000> __arr_rename_at_5_ConstRef; das_zero(__arr_rename_at_5_ConstRef);
+	TDim<int32_t,1000> const  & __arr_rename_at_5 = __arr_rename_at_5_ConstRef; ;
+	int32_t __cnt_rename_at_6 = 0;
+	{
+		bool __need_loop_7 = true;
+		// j : int const
+		das_iterator<range> __j_iterator(range(0,100));
+		int32_t __j_rename_at_7;
+		__need_loop_7 = __j_iterator.first(__context__,(__j_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __j_iterator.next(__context__,(__j_rename_at_7)) )
+		{
+			int32_t __fail_rename_at_8 = 0;
+			{
+				bool __need_loop_9 = true;
+				// i : int const
+				das_iterator<range> __i_iterator(range(0,2000));
+				int32_t __i_rename_at_9;
+				__need_loop_9 = __i_iterator.first(__context__,(__i_rename_at_9)) && __need_loop_9;
+				for ( ; __need_loop_9 ; __need_loop_9 = __i_iterator.next(__context__,(__i_rename_at_9)) )
+				{
+					das_try_recover(__context__, [&]()
+					{
+						__cnt_rename_at_6 += __arr_rename_at_5(__i_rename_at_9,__context__);
+					}, [&]()
+					{
+						++__fail_rename_at_8;
+					});
+				}
+				__i_iterator.close(__context__,(__i_rename_at_9));
+			};
+			DAS_ASSERT((__fail_rename_at_8 == 1000));
+		}
+		__j_iterator.close(__context__,(__j_rename_at_7));
+	};
+}
+
+inline bool test_73e6ec26b7f97b85 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,128,"test " DAS_FILE_LINE);
+{
+	builtin_profile(20,((char *) "try-recover"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		tryCatch_f6004e3e954e2f1f(__context__);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(20,((char *) "try-recover c++"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		testTryCatch(__context__);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// tryCatch_f6004e3e954e2f1f
+	aotLib[0x8aed964cb7d742b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&tryCatch_f6004e3e954e2f1f>>();
+	};
+	// test_73e6ec26b7f97b85
+	aotLib[0x5a4b6c2eb21f8db8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_73e6ec26b7f97b85>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
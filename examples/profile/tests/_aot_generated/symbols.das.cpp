@@ -0,0 +1,171 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15636372888079893323 {
+
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__90f4307b5a6d445;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xeeb3b74c98cb09c3), 0x0 };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+TypeInfo __type_info__90f4307b5a6d445 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f4307b5a6d445) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_1[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f4307b5a6d445 };
+
+inline void makeTokens_3822ee336c06b780 ( Context * __context__, TArray<char *> & __src_rename_at_9, int32_t __n_rename_at_9 );
+inline int32_t symbols_89ee34cb76713241 ( Context * __context__, TTable<char *,int32_t> & __tab_rename_at_15, TArray<char *> const  & __src_rename_at_15 );
+inline bool test_42437b7b10975baf ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<TDim<char *,10>,0x51bfcb8c49bfc3a0>(__context__) = (([&]() -> TDim<char *,10> {
+		TDim<char *,10> __mka_7;
+		__mka_7(0,__context__) = ((char *) "def");
+		__mka_7(1,__context__) = ((char *) "let");
+		__mka_7(2,__context__) = ((char *) "var");
+		__mka_7(3,__context__) = ((char *) "struct");
+		__mka_7(4,__context__) = ((char *) "class");
+		__mka_7(5,__context__) = ((char *) "return");
+		__mka_7(6,__context__) = ((char *) "while");
+		__mka_7(7,__context__) = ((char *) "for");
+		__mka_7(8,__context__) = ((char *) "if");
+		__mka_7(9,__context__) = ((char *) "else");
+		return __mka_7;
+	})());/*keywords*/
+}
+
+inline void makeTokens_3822ee336c06b780 ( Context * __context__, TArray<char *> &  __src_rename_at_9, int32_t __n_rename_at_9 )
+{
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__src_rename_at_9),__n_rename_at_9,8,__context__);
+	{
+		bool __need_loop_11 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_9));
+		int32_t __i_rename_at_11;
+		__need_loop_11 = __i_iterator.first(__context__,(__i_rename_at_11)) && __need_loop_11;
+		for ( ; __need_loop_11 ; __need_loop_11 = __i_iterator.next(__context__,(__i_rename_at_11)) )
+		{
+			uint32_t __num_rename_at_12 = ((uint32_t)(SimPolicy<uint32_t>::Mod((0x1033c4d7u ^ uint32_t(__i_rename_at_11 * 119)),0x1000u,*__context__,nullptr)));
+			das_copy(__src_rename_at_9(__i_rename_at_11,__context__),((__num_rename_at_12 & 0x7u) == 0x0u) ? das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_0, cast<char * const >::from(das_global<TDim<char *,10>,0x51bfcb8c49bfc3a0>(__context__) /*keywords*/((SimPolicy<int32_t>::Mod(int32_t(__num_rename_at_12 >> 0x3u),10,*__context__,nullptr)),__context__))))) : das_auto_cast<char *>::cast(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<char * const >::from(((char *) "identifier_")), cast<uint32_t>::from(__num_rename_at_12)))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_11));
+	};
+}
+
+inline int32_t symbols_89ee34cb76713241 ( Context * __context__, TTable<char *,int32_t> &  __tab_rename_at_15, TArray<char *> const  &  __src_rename_at_15 )
+{
+	builtin_table_clear(das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_15),__context__);
+	int32_t __kw_rename_at_17 = 0;
+	{
+		bool __need_loop_18 = true;
+		// s : string const&
+		das_iterator<TArray<char *> const > __s_iterator(__src_rename_at_15);
+		char * const  * __s_rename_at_18;
+		__need_loop_18 = __s_iterator.first(__context__,(__s_rename_at_18)) && __need_loop_18;
+		for ( ; __need_loop_18 ; __need_loop_18 = __s_iterator.next(__context__,(__s_rename_at_18)) )
+		{
+			++__tab_rename_at_15((*__s_rename_at_18),__context__);
+			if ( SimPolicy<char *>::Equ(cast<char *>::from((*__s_rename_at_18)),cast<char *>::from(((char *) "return")),*__context__,nullptr) )
+			{
+				++__kw_rename_at_17;
+			};
+		}
+		__s_iterator.close(__context__,(__s_rename_at_18));
+	};
+	return das_auto_cast<int32_t>::cast(__kw_rename_at_17);
+}
+
+inline bool test_42437b7b10975baf ( Context * __context__ ) { das_stack_prologue __prologue(__context__,176,"test " DAS_FILE_LINE);
+{
+	TTable<char *,int32_t> __tab_rename_at_26; das_zero(__tab_rename_at_26);
+	TArray<char *> __src_rename_at_27; das_zero(__src_rename_at_27);
+	makeTokens_3822ee336c06b780(__context__,das_arg<TArray<char *>>::pass(__src_rename_at_27),500000);
+	int32_t __t_rename_at_29 = 0;
+	builtin_profile(20,((char *) "symbol table"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		__t_rename_at_29 += symbols_89ee34cb76713241(__context__,das_arg<TTable<char *,int32_t>>::pass(__tab_rename_at_26),das_arg<TArray<char *>>::pass(__src_rename_at_27));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(__t_rename_at_29 != 0);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// makeTokens_3822ee336c06b780
+	aotLib[0xda63a55349d61825] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> & , int32_t  ),&makeTokens_3822ee336c06b780>>();
+	};
+	// symbols_89ee34cb76713241
+	aotLib[0xbc69148d6da7a199] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTable<char *,int32_t> & , TArray<char *> const  &  ),&symbols_89ee34cb76713241>>();
+	};
+	// test_42437b7b10975baf
+	aotLib[0x70e79579dc33b187] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_42437b7b10975baf>>();
+	};
+	// [[ init script ]]
+	aotLib[0xef249c54372e2d15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,136 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require testProfile
+#include "test_profile.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_167944156028483185 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xeeb3b74c98cb09c3), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline void _Funcbuiltin_0x60_sort_4732ebdcad990f07 ( Context * __context__, TArray<int32_t> & __a_rename_at_594 );
+inline void makeRandomSequence_1ec4723e5c5bb7b4 ( Context * __context__, TArray<int32_t> & __src_rename_at_6 );
+inline bool test_ce7164c454945cf4 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_sort_4732ebdcad990f07 ( Context * __context__, TArray<int32_t> &  __a_rename_at_594 )
+{
+	builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_594),__context__);
+	builtin_sort<int32_t>(das_ref(__context__,__a_rename_at_594(0,__context__)),builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_594)));
+	builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_594),__context__);
+}
+
+inline void makeRandomSequence_1ec4723e5c5bb7b4 ( Context * __context__, TArray<int32_t> &  __src_rename_at_6 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__src_rename_at_6),2000000,4,__context__);
+	{
+		bool __need_loop_10 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,2000000));
+		int32_t __i_rename_at_10;
+		__need_loop_10 = __i_iterator.first(__context__,(__i_rename_at_10)) && __need_loop_10;
+		for ( ; __need_loop_10 ; __need_loop_10 = __i_iterator.next(__context__,(__i_rename_at_10)) )
+		{
+			das_copy(__src_rename_at_6(__i_rename_at_10,__context__),int32_t(uint_noise1D(__i_rename_at_10,0x1u)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_10));
+	};
+}
+
+inline bool test_ce7164c454945cf4 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,224,"test " DAS_FILE_LINE);
+{
+	TArray<int32_t> __tab_rename_at_15; das_zero(__tab_rename_at_15);
+	makeRandomSequence_1ec4723e5c5bb7b4(__context__,das_arg<TArray<int32_t>>::pass(__tab_rename_at_15));
+	builtin_profile(1,((char *) "table-sort"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		_Funcbuiltin_0x60_sort_4732ebdcad990f07(__context__,das_arg<TArray<int32_t>>::pass(__tab_rename_at_15));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	makeRandomSequence_1ec4723e5c5bb7b4(__context__,das_arg<TArray<int32_t>>::pass(__tab_rename_at_15));
+	builtin_profile(1,((char *) "table-sort-cmp"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		builtin_sort_array_any_ref_cblock_T(das_arg<TArray<int32_t>>::pass(__tab_rename_at_15),4,0,[&](int32_t const  __a_rename_at_21, int32_t const  __b_rename_at_21) DAS_AOT_INLINE_LAMBDA -> bool{
+			return das_auto_cast<bool>::cast(!(__a_rename_at_21 < __b_rename_at_21));
+		},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_sort_4732ebdcad990f07
+	aotLib[0xbd9e102c769f911d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_sort_4732ebdcad990f07>>();
+	};
+	// makeRandomSequence_1ec4723e5c5bb7b4
+	aotLib[0x6a48c69229f27ae5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&makeRandomSequence_1ec4723e5c5bb7b4>>();
+	};
+	// test_ce7164c454945cf4
+	aotLib[0x768251e2db98b157] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_ce7164c454945cf4>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
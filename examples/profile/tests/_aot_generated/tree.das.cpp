@@ -0,0 +1,483 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require testProfile
+#include "test_profile.h"
+ // require random
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14474112730570605998 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xeeb3b74c98cb09c3), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct Node; };
+namespace  { struct Pair; };
+namespace  { struct SplitResult; };
+namespace random { struct _lambda_random_95_8_1; };
+// unused structure _lambda_random_95_8_1
+namespace  {
+
+struct Node {
+	int32_t x;
+	int32_t y;
+	Node * left;
+	Node * right;
+};
+static_assert(sizeof(Node)==24,"structure size mismatch with DAS");
+static_assert(offsetof(Node,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Node,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Node,left)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Node,right)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct Pair {
+	Node * first;
+	Node * second;
+};
+static_assert(sizeof(Pair)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Pair,first)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Pair,second)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct SplitResult {
+	Node * lower;
+	Node * equal;
+	Node * greater;
+};
+static_assert(sizeof(SplitResult)==24,"structure size mismatch with DAS");
+static_assert(offsetof(SplitResult,lower)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(SplitResult,equal)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(SplitResult,greater)==16,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_4d4dc254127ff7cc ( Context * __context__, Node & ____this_rename_at_14 );
+inline int32_t _Funcrandom_0x60_random_int_2fd6061b7238802b ( Context * __context__, int4 & __seed_rename_at_26 );
+inline void finalize_1f39b326c6530905 ( Context * __context__, Node * & ____this_rename_at_73 );
+inline Node * merge_3138ddebec5e85c5 ( Context * __context__, Node * __lower_rename_at_22, Node * __greater_rename_at_22 );
+inline Node * merge_71e7811c61c3d9b1 ( Context * __context__, Node * __lower_rename_at_34, Node * __equal_rename_at_34, Node * __greater_rename_at_34 );
+inline void split_923242f4c872dcf4 ( Context * __context__, Node * __orig_rename_at_38, Node * & __lower_rename_at_38, Node * & __greaterOrEqual_rename_at_38, int32_t __value_rename_at_38 );
+inline void split_b8a8f4bf3c990a69 ( Context * __context__, Node * __orig_rename_at_49, Node * & __lower_rename_at_49, Node * & __equal_rename_at_49, Node * & __greater_rename_at_49, int32_t __value_rename_at_49 );
+inline bool hasValue_40e5e1065fec4c6f ( Context * __context__, Node * & __mRoot_rename_at_54, int32_t __x_rename_at_54 );
+inline void insert_67d3a8b56cfd3a12 ( Context * __context__, Node * & __mRoot_rename_at_61, int32_t __x_rename_at_61 );
+inline void erase_raw_28f9b8a521e051db ( Context * __context__, Node * & __mRoot_rename_at_68, int32_t __x_rename_at_68 );
+inline int32_t main_694e881d98d74c0c ( Context * __context__ );
+inline Pair splitBinary_6b8830cb1717feff ( Context * __context__, Node * __orig_rename_at_96, int32_t __value_rename_at_96 );
+inline SplitResult splitNaive_87de6563fddd095d ( Context * __context__, Node * __orig_rename_at_113, int32_t __value_rename_at_113 );
+inline bool hasValueNaive_477ae39f0525758a ( Context * __context__, Node * & __mRoot_rename_at_118, int32_t __x_rename_at_118 );
+inline void insertNaive_9730b6df0426b435 ( Context * __context__, Node * & __mRoot_rename_at_124, int32_t __x_rename_at_124 );
+inline void erase_rawNaive_964e5115e2fdf8f4 ( Context * __context__, Node * & __mRoot_rename_at_130, int32_t __x_rename_at_130 );
+inline int32_t mainNaive_4e596568826be0b0 ( Context * __context__ );
+inline bool test_753a9d6428aa8674 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int4,0x5dabe00e974c9589>(__context__) = int4(1,1,1,1);/*seed*/
+}
+
+inline void finalize_4d4dc254127ff7cc ( Context * __context__, Node &  ____this_rename_at_14 )
+{
+	finalize_1f39b326c6530905(__context__,____this_rename_at_14.left);
+	finalize_1f39b326c6530905(__context__,____this_rename_at_14.right);
+	memset(&(____this_rename_at_14), 0, 24);
+}
+
+inline int32_t _Funcrandom_0x60_random_int_2fd6061b7238802b ( Context * __context__, int4 & __seed_rename_at_26 )
+{
+	das_copy(das_swizzle_ref<int32_t,int4,0>::swizzle(__seed_rename_at_26) /*x*/,(v_extract_xi(v_cast_vec4i(__seed_rename_at_26)) /*x*/ * 214013) + 2531011);
+	return das_auto_cast<int32_t>::cast((v_extract_xi(v_cast_vec4i(__seed_rename_at_26)) /*x*/ >> 16) & 32767);
+}
+
+inline void finalize_1f39b326c6530905 ( Context * __context__, Node * & ____this_rename_at_73 )
+{
+	if ( ____this_rename_at_73 != nullptr )
+	{
+		finalize_4d4dc254127ff7cc(__context__,das_arg<Node>::pass(das_deref(__context__,____this_rename_at_73)));
+		das_delete<Node *>::clear(__context__,____this_rename_at_73);
+		das_copy(____this_rename_at_73,nullptr);
+	};
+}
+
+inline Node * merge_3138ddebec5e85c5 ( Context * __context__, Node * __lower_rename_at_22, Node * __greater_rename_at_22 )
+{
+	if ( __lower_rename_at_22 == nullptr )
+	{
+		return das_auto_cast<Node *>::cast(__greater_rename_at_22);
+	} else {
+		if ( __greater_rename_at_22 == nullptr )
+		{
+			return das_auto_cast<Node *>::cast(__lower_rename_at_22);
+		} else {
+			if ( __lower_rename_at_22->y < __greater_rename_at_22->y )
+			{
+				das_copy(__lower_rename_at_22->right,merge_3138ddebec5e85c5(__context__,__lower_rename_at_22->right,__greater_rename_at_22));
+				return das_auto_cast<Node *>::cast(__lower_rename_at_22);
+			} else {
+				das_copy(__greater_rename_at_22->left,merge_3138ddebec5e85c5(__context__,__lower_rename_at_22,__greater_rename_at_22->left));
+				return das_auto_cast<Node *>::cast(__greater_rename_at_22);
+			};
+		};
+	};
+}
+
+inline Node * merge_71e7811c61c3d9b1 ( Context * __context__, Node * __lower_rename_at_34, Node * __equal_rename_at_34, Node * __greater_rename_at_34 )
+{
+	return das_auto_cast<Node *>::cast(merge_3138ddebec5e85c5(__context__,merge_3138ddebec5e85c5(__context__,__lower_rename_at_34,__equal_rename_at_34),__greater_rename_at_34));
+}
+
+inline void split_923242f4c872dcf4 ( Context * __context__, Node * __orig_rename_at_38, Node * & __lower_rename_at_38, Node * & __greaterOrEqual_rename_at_38, int32_t __value_rename_at_38 )
+{
+	if ( __orig_rename_at_38 == nullptr )
+	{
+		das_copy(__lower_rename_at_38,nullptr);
+		das_copy(__greaterOrEqual_rename_at_38,nullptr);
+	} else if ( __orig_rename_at_38->x < __value_rename_at_38 )
+	{
+		das_copy(__lower_rename_at_38,__orig_rename_at_38);
+		split_923242f4c872dcf4(__context__,__lower_rename_at_38->right,__lower_rename_at_38->right,__greaterOrEqual_rename_at_38,__value_rename_at_38);
+	} else {
+		das_copy(__greaterOrEqual_rename_at_38,__orig_rename_at_38);
+		split_923242f4c872dcf4(__context__,__greaterOrEqual_rename_at_38->left,__lower_rename_at_38,__greaterOrEqual_rename_at_38->left,__value_rename_at_38);
+	};
+}
+
+inline void split_b8a8f4bf3c990a69 ( Context * __context__, Node * __orig_rename_at_49, Node * & __lower_rename_at_49, Node * & __equal_rename_at_49, Node * & __greater_rename_at_49, int32_t __value_rename_at_49 )
+{
+	Node * __equalOrGreater_rename_at_50 = 0;
+	split_923242f4c872dcf4(__context__,__orig_rename_at_49,__lower_rename_at_49,__equalOrGreater_rename_at_50,__value_rename_at_49);
+	split_923242f4c872dcf4(__context__,__equalOrGreater_rename_at_50,__equal_rename_at_49,__greater_rename_at_49,__value_rename_at_49 + 1);
+}
+
+inline bool hasValue_40e5e1065fec4c6f ( Context * __context__, Node * & __mRoot_rename_at_54, int32_t __x_rename_at_54 )
+{
+	Node * __lower_rename_at_55 = 0; Node * __equal_rename_at_55 = 0; Node * __greater_rename_at_55 = 0;
+	split_b8a8f4bf3c990a69(__context__,__mRoot_rename_at_54,__lower_rename_at_55,__equal_rename_at_55,__greater_rename_at_55,__x_rename_at_54);
+	bool __res_rename_at_57 = ((bool)(__equal_rename_at_55 != nullptr));
+	das_copy(__mRoot_rename_at_54,merge_71e7811c61c3d9b1(__context__,__lower_rename_at_55,__equal_rename_at_55,__greater_rename_at_55));
+	return das_auto_cast<bool>::cast(__res_rename_at_57);
+}
+
+inline void insert_67d3a8b56cfd3a12 ( Context * __context__, Node * & __mRoot_rename_at_61, int32_t __x_rename_at_61 )
+{
+	Node * __lower_rename_at_62 = 0; Node * __equal_rename_at_62 = 0; Node * __greater_rename_at_62 = 0;
+	split_b8a8f4bf3c990a69(__context__,__mRoot_rename_at_61,__lower_rename_at_62,__equal_rename_at_62,__greater_rename_at_62,__x_rename_at_61);
+	if ( __equal_rename_at_62 == nullptr )
+	{
+		das_copy(__equal_rename_at_62,das_ascend<Node,Node>::make(__context__,nullptr,(([&]() -> Node {
+			Node __mks_65;
+			das_zero(__mks_65);
+			das_copy((__mks_65.x),(__x_rename_at_61));
+			das_copy((__mks_65.y),(_Funcrandom_0x60_random_int_2fd6061b7238802b(__context__,das_global<int4,0x5dabe00e974c9589>(__context__) /*seed*/)));
+			return __mks_65;
+		})())));
+	};
+	das_copy(__mRoot_rename_at_61,merge_71e7811c61c3d9b1(__context__,__lower_rename_at_62,__equal_rename_at_62,__greater_rename_at_62));
+}
+
+inline void erase_raw_28f9b8a521e051db ( Context * __context__, Node * & __mRoot_rename_at_68, int32_t __x_rename_at_68 )
+{
+	Node * __lower_rename_at_69 = 0; Node * __equal_rename_at_69 = 0; Node * __greater_rename_at_69 = 0;
+	split_b8a8f4bf3c990a69(__context__,__mRoot_rename_at_68,__lower_rename_at_69,__equal_rename_at_69,__greater_rename_at_69,__x_rename_at_68);
+	das_copy(__mRoot_rename_at_68,merge_3138ddebec5e85c5(__context__,__lower_rename_at_69,__greater_rename_at_69));
+	finalize_1f39b326c6530905(__context__,__equal_rename_at_69);
+}
+
+inline int32_t main_694e881d98d74c0c ( Context * __context__ )
+{
+	Node * __tree_rename_at_76 = 0;
+	int32_t __cur_rename_at_77 = 5;
+	int32_t __res_rename_at_78 = 0;
+	{
+		bool __need_loop_79 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,1000000));
+		int32_t __i_rename_at_79;
+		__need_loop_79 = __i_iterator.first(__context__,(__i_rename_at_79)) && __need_loop_79;
+		for ( ; __need_loop_79 ; __need_loop_79 = __i_iterator.next(__context__,(__i_rename_at_79)) )
+		{
+			int32_t __a_rename_at_80 = ((int32_t)(SimPolicy<int32_t>::Mod(__i_rename_at_79,3,*__context__,nullptr)));
+			das_copy(__cur_rename_at_77,SimPolicy<int32_t>::Mod(((__cur_rename_at_77 * 57) + 43),10007,*__context__,nullptr));
+			if ( __a_rename_at_80 == 0 )
+			{
+				insert_67d3a8b56cfd3a12(__context__,__tree_rename_at_76,__cur_rename_at_77);
+			} else if ( __a_rename_at_80 == 1 )
+			{
+				erase_raw_28f9b8a521e051db(__context__,__tree_rename_at_76,__cur_rename_at_77);
+			} else if ( __a_rename_at_80 == 2 )
+			{
+				__res_rename_at_78 += (hasValue_40e5e1065fec4c6f(__context__,__tree_rename_at_76,__cur_rename_at_77) ? das_auto_cast<int32_t>::cast(1) : das_auto_cast<int32_t>::cast(0));
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_79));
+	};
+	finalize_1f39b326c6530905(__context__,__tree_rename_at_76);
+	return das_auto_cast<int32_t>::cast(__res_rename_at_78);
+}
+
+inline Pair splitBinary_6b8830cb1717feff ( Context * __context__, Node * __orig_rename_at_96, int32_t __value_rename_at_96 )
+{
+	if ( __orig_rename_at_96 == nullptr )
+	{
+		return das_auto_cast_ref<Pair>::cast((([&]() -> Pair {
+			Pair __mks_98;
+			das_copy((__mks_98.first),(nullptr));
+			das_copy((__mks_98.second),(nullptr));
+			return __mks_98;
+		})()));
+	} else {
+		if ( __orig_rename_at_96->x < __value_rename_at_96 )
+		{
+			Pair __splitPair_rename_at_101_ConstRef = ((Pair)splitBinary_6b8830cb1717feff(__context__,__orig_rename_at_96->right,__value_rename_at_96));
+	Pair const  & __splitPair_rename_at_101 = __splitPair_rename_at_101_ConstRef; ;
+			das_copy(__orig_rename_at_96->right,__splitPair_rename_at_101.first);
+			return das_auto_cast_ref<Pair>::cast((([&]() -> Pair {
+				Pair __mks_103;
+				das_copy((__mks_103.first),(__orig_rename_at_96));
+				das_copy((__mks_103.second),(__splitPair_rename_at_101.second));
+				return __mks_103;
+			})()));
+		} else {
+			Pair __splitPair_rename_at_105_ConstRef = ((Pair)splitBinary_6b8830cb1717feff(__context__,__orig_rename_at_96->left,__value_rename_at_96));
+	Pair const  & __splitPair_rename_at_105 = __splitPair_rename_at_105_ConstRef; ;
+			das_copy(__orig_rename_at_96->left,__splitPair_rename_at_105.second);
+			return das_auto_cast_ref<Pair>::cast((([&]() -> Pair {
+				Pair __mks_107;
+				das_copy((__mks_107.first),(__splitPair_rename_at_105.first));
+				das_copy((__mks_107.second),(__orig_rename_at_96));
+				return __mks_107;
+			})()));
+		};
+	};
+}
+
+inline SplitResult splitNaive_87de6563fddd095d ( Context * __context__, Node * __orig_rename_at_113, int32_t __value_rename_at_113 )
+{
+	Pair __lower_eg_rename_at_114 = splitBinary_6b8830cb1717feff(__context__,__orig_rename_at_113,__value_rename_at_113);
+	Pair __equal_greater_rename_at_115 = splitBinary_6b8830cb1717feff(__context__,__lower_eg_rename_at_114.second,__value_rename_at_113 + 1);
+	return das_auto_cast_ref<SplitResult>::cast((([&]() -> SplitResult {
+		SplitResult __mks_116;
+		das_copy((__mks_116.lower),(__lower_eg_rename_at_114.first));
+		das_copy((__mks_116.equal),(__equal_greater_rename_at_115.first));
+		das_copy((__mks_116.greater),(__equal_greater_rename_at_115.second));
+		return __mks_116;
+	})()));
+}
+
+inline bool hasValueNaive_477ae39f0525758a ( Context * __context__, Node * & __mRoot_rename_at_118, int32_t __x_rename_at_118 )
+{
+	SplitResult __splited_rename_at_119 = splitNaive_87de6563fddd095d(__context__,__mRoot_rename_at_118,__x_rename_at_118);
+	bool __res_rename_at_120 = ((bool)(__splited_rename_at_119.equal != nullptr));
+	das_copy(__mRoot_rename_at_118,merge_71e7811c61c3d9b1(__context__,__splited_rename_at_119.lower,__splited_rename_at_119.equal,__splited_rename_at_119.greater));
+	return das_auto_cast<bool>::cast(__res_rename_at_120);
+}
+
+inline void insertNaive_9730b6df0426b435 ( Context * __context__, Node * & __mRoot_rename_at_124, int32_t __x_rename_at_124 )
+{
+	SplitResult __splited_rename_at_125 = splitNaive_87de6563fddd095d(__context__,__mRoot_rename_at_124,__x_rename_at_124);
+	if ( __splited_rename_at_125.equal == nullptr )
+	{
+		das_copy(__splited_rename_at_125.equal,das_ascend<Node,Node>::make(__context__,nullptr,(([&]() -> Node {
+			Node __mks_127;
+			das_zero(__mks_127);
+			das_copy((__mks_127.x),(__x_rename_at_124));
+			das_copy((__mks_127.y),(_Funcrandom_0x60_random_int_2fd6061b7238802b(__context__,das_global<int4,0x5dabe00e974c9589>(__context__) /*seed*/)));
+			return __mks_127;
+		})())));
+	};
+	das_copy(__mRoot_rename_at_124,merge_71e7811c61c3d9b1(__context__,__splited_rename_at_125.lower,__splited_rename_at_125.equal,__splited_rename_at_125.greater));
+}
+
+inline void erase_rawNaive_964e5115e2fdf8f4 ( Context * __context__, Node * & __mRoot_rename_at_130, int32_t __x_rename_at_130 )
+{
+	SplitResult __splited_rename_at_131 = splitNaive_87de6563fddd095d(__context__,__mRoot_rename_at_130,__x_rename_at_130);
+	das_copy(__mRoot_rename_at_130,merge_3138ddebec5e85c5(__context__,__splited_rename_at_131.lower,__splited_rename_at_131.greater));
+	finalize_1f39b326c6530905(__context__,__splited_rename_at_131.equal);
+}
+
+inline int32_t mainNaive_4e596568826be0b0 ( Context * __context__ )
+{
+	Node * __tree_rename_at_137 = 0;
+	int32_t __cur_rename_at_138 = 5;
+	int32_t __res_rename_at_139 = 0;
+	{
+		bool __need_loop_140 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,1000000));
+		int32_t __i_rename_at_140;
+		__need_loop_140 = __i_iterator.first(__context__,(__i_rename_at_140)) && __need_loop_140;
+		for ( ; __need_loop_140 ; __need_loop_140 = __i_iterator.next(__context__,(__i_rename_at_140)) )
+		{
+			int32_t __a_rename_at_141 = ((int32_t)(SimPolicy<int32_t>::Mod(__i_rename_at_140,3,*__context__,nullptr)));
+			das_copy(__cur_rename_at_138,SimPolicy<int32_t>::Mod(((__cur_rename_at_138 * 57) + 43),10007,*__context__,nullptr));
+			if ( __a_rename_at_141 == 0 )
+			{
+				insertNaive_9730b6df0426b435(__context__,__tree_rename_at_137,__cur_rename_at_138);
+			} else if ( __a_rename_at_141 == 1 )
+			{
+				erase_rawNaive_964e5115e2fdf8f4(__context__,__tree_rename_at_137,__cur_rename_at_138);
+			} else if ( __a_rename_at_141 == 2 )
+			{
+				__res_rename_at_139 += (hasValueNaive_477ae39f0525758a(__context__,__tree_rename_at_137,__cur_rename_at_138) ? das_auto_cast<int32_t>::cast(1) : das_auto_cast<int32_t>::cast(0));
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_140));
+	};
+	finalize_1f39b326c6530905(__context__,__tree_rename_at_137);
+	return das_auto_cast<int32_t>::cast(__res_rename_at_139);
+}
+
+inline bool test_753a9d6428aa8674 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,176,"test " DAS_FILE_LINE);
+{
+	builtin_profile(10,((char *) "tree"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		main_694e881d98d74c0c(__context__);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(10,((char *) "tree-naive"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		mainNaive_4e596568826be0b0(__context__);
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	builtin_profile(10,((char *) "tree C++"),das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		testTree();
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_4d4dc254127ff7cc
+	aotLib[0x6c07978edf9ec519] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Node &  ),&finalize_4d4dc254127ff7cc>>();
+	};
+	// _Funcrandom_0x60_random_int_2fd6061b7238802b
+	aotLib[0xce88576071ec5209] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int4 &  ),&_Funcrandom_0x60_random_int_2fd6061b7238802b>>();
+	};
+	// finalize_1f39b326c6530905
+	aotLib[0x4c93c648b17fbe49] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Node * &  ),&finalize_1f39b326c6530905>>();
+	};
+	// merge_3138ddebec5e85c5
+	aotLib[0x7111e811054f2b65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Node * (*) ( Context * __context__, Node * , Node *  ),&merge_3138ddebec5e85c5>>();
+	};
+	// merge_71e7811c61c3d9b1
+	aotLib[0xd9caab869ab93a4e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Node * (*) ( Context * __context__, Node * , Node * , Node *  ),&merge_71e7811c61c3d9b1>>();
+	};
+	// split_923242f4c872dcf4
+	aotLib[0x4028e0b8d3308985] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Node * , Node * & , Node * & , int32_t  ),&split_923242f4c872dcf4>>();
+	};
+	// split_b8a8f4bf3c990a69
+	aotLib[0x1d5af6c068f445e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Node * , Node * & , Node * & , Node * & , int32_t  ),&split_b8a8f4bf3c990a69>>();
+	};
+	// hasValue_40e5e1065fec4c6f
+	aotLib[0x25c6714dc909f1ee] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Node * & , int32_t  ),&hasValue_40e5e1065fec4c6f>>();
+	};
+	// insert_67d3a8b56cfd3a12
+	aotLib[0x79f55410878c47c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Node * & , int32_t  ),&insert_67d3a8b56cfd3a12>>();
+	};
+	// erase_raw_28f9b8a521e051db
+	aotLib[0x8354d1dbe95f3bb3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Node * & , int32_t  ),&erase_raw_28f9b8a521e051db>>();
+	};
+	// main_694e881d98d74c0c
+	aotLib[0xf9173f1bf5a120ae] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&main_694e881d98d74c0c>>();
+	};
+	// splitBinary_6b8830cb1717feff
+	aotLib[0x75235737608a1549] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Pair (*) ( Context * __context__, Node * , int32_t  ),&splitBinary_6b8830cb1717feff>>();
+	};
+	// splitNaive_87de6563fddd095d
+	aotLib[0xa7a666b8ceafcc18] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<SplitResult (*) ( Context * __context__, Node * , int32_t  ),&splitNaive_87de6563fddd095d>>();
+	};
+	// hasValueNaive_477ae39f0525758a
+	aotLib[0x72f4d58363a2d701] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Node * & , int32_t  ),&hasValueNaive_477ae39f0525758a>>();
+	};
+	// insertNaive_9730b6df0426b435
+	aotLib[0x1afc1600295611ca] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Node * & , int32_t  ),&insertNaive_9730b6df0426b435>>();
+	};
+	// erase_rawNaive_964e5115e2fdf8f4
+	aotLib[0x8f341c7733486df4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Node * & , int32_t  ),&erase_rawNaive_964e5115e2fdf8f4>>();
+	};
+	// mainNaive_4e596568826be0b0
+	aotLib[0xd1850b6e4c1b3ca6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__ ),&mainNaive_4e596568826be0b0>>();
+	};
+	// test_753a9d6428aa8674
+	aotLib[0xd3e5322ddfec1286] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_753a9d6428aa8674>>();
+	};
+	// [[ init script ]]
+	aotLib[0x41603d4a04f21737] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
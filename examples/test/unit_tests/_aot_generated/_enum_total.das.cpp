@@ -0,0 +1,225 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require _enum_total
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings_boost
+ // require ast_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_5890135805337440953 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace _enum_total { struct EnumTotalAnnotation; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstSimulateMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupSimulateMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+// unused structure AstSimulateMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+namespace ast {
+
+struct AstEnumerationAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstEnumerationAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstEnumerationAnnotation,smart_ptr_raw<Enumeration>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+};
+static_assert(sizeof(AstEnumerationAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(AstEnumerationAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstEnumerationAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(AstEnumerationAnnotation,apply)==16,"structure field offset mismatch with DAS");
+}
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupForLoopMacro
+// unused structure SetupCaptureMacro
+// unused structure SetupSimulateMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+namespace _enum_total {
+
+struct EnumTotalAnnotation {
+	void * __rtti;
+	Func DAS_COMMENT((void,ast::AstEnumerationAnnotation)) __finalize;
+	Func DAS_COMMENT((bool,ast::AstEnumerationAnnotation,smart_ptr_raw<Enumeration>,ModuleGroup,AnnotationArgumentList const ,das::string)) apply;
+};
+static_assert(sizeof(EnumTotalAnnotation)==24,"structure size mismatch with DAS");
+static_assert(offsetof(EnumTotalAnnotation,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(EnumTotalAnnotation,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(EnumTotalAnnotation,apply)==16,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_push_c3fc01769dcd195a ( Context * __context__, TArray<ast::AstEnumerationAnnotation *> & __Arr_rename_at_75, ast::AstEnumerationAnnotation * const  __value_rename_at_75 );
+inline StructInfo const  * _Funcrtti_0x60_class_info_e236558c76b9bbf9 ( Context * __context__, _enum_total::EnumTotalAnnotation const  & __cl_rename_at_86 );
+inline int32_t _Funcbuiltin_0x60_length_7feea96686af6f03 ( Context * __context__, das::vector<Enumeration::EnumEntry> const  & __vec_rename_at_443 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_push_c3fc01769dcd195a ( Context * __context__, TArray<ast::AstEnumerationAnnotation *> &  __Arr_rename_at_75, ast::AstEnumerationAnnotation * const  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<ast::AstEnumerationAnnotation *>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline StructInfo const  * _Funcrtti_0x60_class_info_e236558c76b9bbf9 ( Context * __context__, _enum_total::EnumTotalAnnotation const  &  __cl_rename_at_86 )
+{
+	return das_auto_cast<StructInfo const  *>::cast(das_cast<StructInfo const  *>::cast(das_cast<TypeInfo const  *>::cast(__cl_rename_at_86.__rtti)->structType /*structType*/));
+}
+
+inline int32_t _Funcbuiltin_0x60_length_7feea96686af6f03 ( Context * __context__, das::vector<Enumeration::EnumEntry> const  &  __vec_rename_at_443 )
+{
+	return das_auto_cast<int32_t>::cast(__vec_rename_at_443.size() /*length*/);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_push_c3fc01769dcd195a
+	aotLib[0x2fb6c25750343969] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<ast::AstEnumerationAnnotation *> & , ast::AstEnumerationAnnotation * const   ),&_Funcbuiltin_0x60_push_c3fc01769dcd195a>>();
+	};
+	// _Funcrtti_0x60_class_info_e236558c76b9bbf9
+	aotLib[0x94f673853a5fab35] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<StructInfo const  * (*) ( Context * __context__, _enum_total::EnumTotalAnnotation const  &  ),&_Funcrtti_0x60_class_info_e236558c76b9bbf9>>();
+	};
+	// _Funcbuiltin_0x60_length_7feea96686af6f03
+	aotLib[0x6a4922fb50bf311d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, das::vector<Enumeration::EnumEntry> const  &  ),&_Funcbuiltin_0x60_length_7feea96686af6f03>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
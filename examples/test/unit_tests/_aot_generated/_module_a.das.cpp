@@ -0,0 +1,132 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require _module_a
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_18165056780998119733 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline char * const  fun_1_7187ced07e258786 ( Context * __context__ );
+inline char * const  fun_2_7187ced07e258786 ( Context * __context__ );
+inline char * const  fun_3_7187ced07e258786 ( Context * __context__ );
+inline char * const  from_a_get_fun_3_7187ced07e258786 ( Context * __context__ );
+inline bool test_b0087d371648db3f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<char *,0x1c8fd34b4393b1e8>(__context__) = ((char *) "from a");/*global_1*/
+	das_global<char *,0x36c484b35937a79>(__context__) = ((char *) "from a");/*global_2*/
+	das_global<char *,0xc15814b3a7b08fe>(__context__) = ((char *) "from_a");/*global_3*/
+}
+
+inline char * const  fun_1_7187ced07e258786 ( Context * __context__ )
+{
+	return das_auto_cast<char * const >::cast(((char *) "from_a"));
+}
+
+inline char * const  fun_2_7187ced07e258786 ( Context * __context__ )
+{
+	return das_auto_cast<char * const >::cast(((char *) "from_a"));
+}
+
+inline char * const  fun_3_7187ced07e258786 ( Context * __context__ )
+{
+	return das_auto_cast<char * const >::cast(((char *) "from_a"));
+}
+
+inline char * const  from_a_get_fun_3_7187ced07e258786 ( Context * __context__ )
+{
+	return das_auto_cast<char * const >::cast(((char *) "from_a"));
+}
+
+inline bool test_b0087d371648db3f ( Context * __context__ )
+{
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// fun_1_7187ced07e258786
+	aotLib[0xf68a79edb98d1895] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__ ),&fun_1_7187ced07e258786>>();
+	};
+	// fun_2_7187ced07e258786
+	aotLib[0xf68a79edb98d1895] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__ ),&fun_2_7187ced07e258786>>();
+	};
+	// fun_3_7187ced07e258786
+	aotLib[0xf68a79edb98d1895] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__ ),&fun_3_7187ced07e258786>>();
+	};
+	// from_a_get_fun_3_7187ced07e258786
+	aotLib[0xf68a79edb98d1895] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  (*) ( Context * __context__ ),&from_a_get_fun_3_7187ced07e258786>>();
+	};
+	// test_b0087d371648db3f
+	aotLib[0x434f546c6487b225] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_b0087d371648db3f>>();
+	};
+	// [[ init script ]]
+	aotLib[0x8d22a27a14922381] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
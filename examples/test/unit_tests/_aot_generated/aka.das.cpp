@@ -0,0 +1,136 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14427811429652364163 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__6054875315d987a1;
+extern FuncInfo __func_info__4715db41dbc4845e;
+
+VarInfo __func_info__4715db41dbc4845e_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x6054875315d987a1), "x", 0 };
+VarInfo * __func_info__4715db41dbc4845e_fields[1] =  { &__func_info__4715db41dbc4845e_field_0 };
+FuncInfo __func_info__4715db41dbc4845e = {"invoke block<(x:int const):void> const", "", __func_info__4715db41dbc4845e_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x4715db41dbc4845e), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline void call_block_4b7ede6b66647277 ( Context * __context__, Block DAS_COMMENT((void,int32_t)) const  & __blk_rename_at_11 );
+inline bool test_68957c33c0ad1b6f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void call_block_4b7ede6b66647277 ( Context * __context__, Block DAS_COMMENT((void,int32_t)) const  &  __blk_rename_at_11 )
+{
+	das_invoke<void>::invoke<int32_t>(__context__,nullptr,__blk_rename_at_11,5);
+}
+
+inline bool test_68957c33c0ad1b6f ( Context * __context__ ) { das_stack_prologue __prologue(__context__,112,"test " DAS_FILE_LINE);
+{
+	call_block_4b7ede6b66647277(__context__,das_make_block<void,int32_t>(__context__,80,0,&__func_info__4715db41dbc4845e,[&](int32_t const  __x_rename_at_18) -> void{
+		int32_t __tx_rename_at_19 = ((int32_t)__x_rename_at_18);
+		DAS_ASSERT((__tx_rename_at_19 == __x_rename_at_18));
+	}));
+	int32_t __tot_rename_at_21 = 0;
+	int32_t __same_rename_at_22 = 0;
+	{
+		bool __need_loop_23 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,10));
+		int32_t __x_rename_at_23;
+		__need_loop_23 = __x_iterator.first(__context__,(__x_rename_at_23)) && __need_loop_23;
+		for ( ; __need_loop_23 ; __need_loop_23 = __x_iterator.next(__context__,(__x_rename_at_23)) )
+		{
+			{
+				bool __need_loop_24 = true;
+				// xx : int const
+				das_iterator<range> __xx_iterator(range(0,10));
+				int32_t __xx_rename_at_24;
+				__need_loop_24 = __xx_iterator.first(__context__,(__xx_rename_at_24)) && __need_loop_24;
+				for ( ; __need_loop_24 ; __need_loop_24 = __xx_iterator.next(__context__,(__xx_rename_at_24)) )
+				{
+					++__tot_rename_at_21;
+					if ( __xx_rename_at_24 == __x_rename_at_23 )
+					{
+						++__same_rename_at_22;
+					};
+				}
+				__xx_iterator.close(__context__,(__xx_rename_at_24));
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_23));
+	};
+	DAS_ASSERT((__tot_rename_at_21 == 100));
+	DAS_ASSERT((__same_rename_at_22 == 10));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// call_block_4b7ede6b66647277
+	aotLib[0x36a15997e8720c99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((void,int32_t)) const  &  ),&call_block_4b7ede6b66647277>>();
+	};
+	// test_68957c33c0ad1b6f
+	aotLib[0xd739c57ce67f9a44] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_68957c33c0ad1b6f>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
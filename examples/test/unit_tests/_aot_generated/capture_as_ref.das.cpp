@@ -0,0 +1,267 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_2403627151459031909 {
+
+extern StructInfo __struct_info__f35ff723fded4627;
+extern StructInfo __struct_info__e8bc1fe334cddcab;
+extern TypeInfo __type_info__dfd82b908f3b1490;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__c6da57122d36ac9d;
+extern TypeInfo __type_info__cc48069bba1d3bfa;
+extern TypeInfo __type_info__efce033b123fae3a;
+extern TypeInfo __type_info__441f4faaa4ccc2bb;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__ae589292e9f8b54d;
+extern VarInfo __var_info__a08ab22745ae6444;
+extern VarInfo __var_info__a08ab42745ae67aa;
+extern VarInfo __var_info__8234e8c7fdd276fe;
+extern VarInfo __var_info__b457ef1451c3a491;
+extern VarInfo __var_info__af6887d4ba6e6618;
+extern VarInfo __var_info__d67c5b1f90be14bb;
+extern VarInfo __var_info__8c250e19a21250ae;
+
+VarInfo __struct_info__f35ff723fded4627_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8c250e19a21250ae), "__rtti", 0 };
+TypeInfo * __type_info__b457ef1451c3a491_arg_types_var_17537007207960102439[1] = { &__type_info__dfd82b908f3b1490 };
+VarInfo __struct_info__f35ff723fded4627_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__b457ef1451c3a491_arg_types_var_17537007207960102439, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xb457ef1451c3a491), "__finalize", 8 };
+VarInfo __struct_info__f35ff723fded4627_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa08ab22745ae6444), "i", 16 };
+VarInfo __struct_info__f35ff723fded4627_field_3 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xa08ab42745ae67aa), "k", 24 };
+TypeInfo * __type_info__8234e8c7fdd276fe_arg_types_var_17537007207960102439[1] = { &__type_info__dfd82b908f3b1490 };
+VarInfo __struct_info__f35ff723fded4627_field_4 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c6da57122d36ac9d, nullptr, (TypeInfo **)__type_info__8234e8c7fdd276fe_arg_types_var_17537007207960102439, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x8234e8c7fdd276fe), "kaboom", 48 };
+VarInfo * __struct_info__f35ff723fded4627_fields[5] =  { &__struct_info__f35ff723fded4627_field_0, &__struct_info__f35ff723fded4627_field_1, &__struct_info__f35ff723fded4627_field_2, &__struct_info__f35ff723fded4627_field_3, &__struct_info__f35ff723fded4627_field_4 };
+StructInfo __struct_info__f35ff723fded4627 = {"Foo", "", 21, __struct_info__f35ff723fded4627_fields, 5, 56, UINT64_C(0xf2bb95199c92e1d7), nullptr, UINT64_C(0xf35ff723fded4627) };
+TypeInfo * __type_info__af6887d4ba6e6618_arg_types_var_16770314173124828331[1] = { &__type_info__cc48069bba1d3bfa };
+VarInfo __struct_info__e8bc1fe334cddcab_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, (TypeInfo **)__type_info__af6887d4ba6e6618_arg_types_var_16770314173124828331, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xaf6887d4ba6e6618), "__lambda", 0 };
+TypeInfo * __type_info__ae589292e9f8b54d_arg_types_var_16770314173124828331[1] = { &__type_info__efce033b123fae3a };
+VarInfo __struct_info__e8bc1fe334cddcab_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__ae589292e9f8b54d_arg_types_var_16770314173124828331, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xae589292e9f8b54d), "__finalize", 8 };
+VarInfo __struct_info__e8bc1fe334cddcab_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__dfd82b908f3b1490, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xd67c5b1f90be14bb), "self", 16 };
+VarInfo * __struct_info__e8bc1fe334cddcab_fields[3] =  { &__struct_info__e8bc1fe334cddcab_field_0, &__struct_info__e8bc1fe334cddcab_field_1, &__struct_info__e8bc1fe334cddcab_field_2 };
+StructInfo __struct_info__e8bc1fe334cddcab = {"_lambda_thismodule_8_3_1", "", 6, __struct_info__e8bc1fe334cddcab_fields, 3, 24, UINT64_C(0x0), nullptr, UINT64_C(0xe8bc1fe334cddcab) };
+TypeInfo __type_info__dfd82b908f3b1490 = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 56, UINT64_C(0xdfd82b908f3b1490) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__c6da57122d36ac9d = { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24576, 8, UINT64_C(0xc6da57122d36ac9d) };
+TypeInfo __type_info__cc48069bba1d3bfa = { Type::tStructure, &__struct_info__e8bc1fe334cddcab, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 24, UINT64_C(0xcc48069bba1d3bfa) };
+TypeInfo __type_info__efce033b123fae3a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cc48069bba1d3bfa, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xefce033b123fae3a) };
+TypeInfo __type_info__441f4faaa4ccc2bb = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 56, UINT64_C(0x441f4faaa4ccc2bb) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__441f4faaa4ccc2bb };
+namespace  { struct Foo; };
+namespace  { struct _lambda_thismodule_8_3_1; };
+namespace  {
+
+struct Foo {
+	void * __rtti;
+	Func DAS_COMMENT((void,Foo)) __finalize;
+	int32_t i;
+	TArray<int32_t> k;
+	Func DAS_COMMENT((Lambda DAS_COMMENT((int32_t)),Foo)) kaboom;
+};
+static_assert(sizeof(Foo)==56,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,__rtti)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,i)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,k)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,kaboom)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_8_3_1 {
+	Func DAS_COMMENT((int32_t,_lambda_thismodule_8_3_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_8_3_1 *)) __finalize;
+	Foo * self;
+};
+static_assert(sizeof(_lambda_thismodule_8_3_1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_8_3_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_8_3_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_8_3_1,self)==16,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_c3cfcf3cf07a0b99 ( Context * __context__, _lambda_thismodule_8_3_1 & ____this_rename_at_8 );
+inline Foo & _Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5 ( Context * __context__, Foo & __a_rename_at_42 );
+inline int32_t _Func_lambda_thismodule_8_3_1_0x60_function_49a7015d2420e12b ( Context * __context__, _lambda_thismodule_8_3_1 & ____this_rename_at_8 );
+inline void _Func_lambda_thismodule_8_3_1_0x60_finalizer_32b7b109e2a691fe ( Context * __context__, _lambda_thismodule_8_3_1 * ____this_rename_at_8 );
+inline void finalize_cf14726227c82aa8 ( Context * __context__, Foo & ____this_rename_at_1 );
+inline Foo Foo_fdf64fe363510f7a ( Context * __context__ );
+inline void _FuncFoo_0x60_Foo_7695b5684605df93 ( Context * __context__, Foo & __self_rename_at_4 );
+inline Lambda DAS_COMMENT((int32_t)) _FuncFoo_0x60_kaboom_914159c8d97356d0 ( Context * __context__, Foo & __self_rename_at_6 );
+inline void _FuncFoo_0x27___finalize_cb819e50386e57dd ( Context * __context__, Foo & __self_rename_at_1 );
+inline bool test_3d54a49b67ce033d ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_c3cfcf3cf07a0b99 ( Context * __context__, _lambda_thismodule_8_3_1 &  ____this_rename_at_8 )
+{
+	memset(&(____this_rename_at_8), 0, 24);
+}
+
+inline Foo & _Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5 ( Context * __context__, Foo &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<Foo &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<Foo &>::cast(__a_rename_at_42);
+}
+
+inline int32_t _Func_lambda_thismodule_8_3_1_0x60_function_49a7015d2420e12b ( Context * __context__, _lambda_thismodule_8_3_1 &  ____this_rename_at_8 )
+{
+	return das_auto_cast<int32_t>::cast(das_deref(__context__,____this_rename_at_8.self).i++);
+}
+
+inline void _Func_lambda_thismodule_8_3_1_0x60_finalizer_32b7b109e2a691fe ( Context * __context__, _lambda_thismodule_8_3_1 * ____this_rename_at_8 )
+{
+	finalize_c3cfcf3cf07a0b99(__context__,das_arg<_lambda_thismodule_8_3_1>::pass(das_deref(__context__,____this_rename_at_8)));
+	das_delete_lambda_struct<_lambda_thismodule_8_3_1 *>::clear(__context__,____this_rename_at_8);
+}
+
+inline void finalize_cf14726227c82aa8 ( Context * __context__, Foo &  ____this_rename_at_1 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(____this_rename_at_1.k),4,__context__);
+	memset(&(____this_rename_at_1), 0, 56);
+}
+
+inline Foo Foo_fdf64fe363510f7a ( Context * __context__ )
+{
+	Foo __self_rename_at_4; das_zero(__self_rename_at_4); das_move(__self_rename_at_4, (([&]() -> Foo {
+		Foo __mks_4;
+		das_zero(__mks_4);
+		das_copy((__mks_4.__rtti),(((void *)(&__type_info__dfd82b908f3b1490))));
+		das_copy((__mks_4.__finalize),(Func(__context__->fnByMangledName(/*Foo'__finalize S<::Foo>*/ 3524882781912245377u))));
+		das_copy((__mks_4.kaboom),(Func(__context__->fnByMangledName(/*Foo`kaboom S<::Foo>*/ 13368100967459009467u))));
+		return __mks_4;
+	})()));
+	_FuncFoo_0x60_Foo_7695b5684605df93(__context__,das_arg<Foo>::pass(__self_rename_at_4));
+	return /* <- */ das_auto_cast_move<Foo>::cast(_Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5(__context__,das_arg<Foo>::pass(__self_rename_at_4)));
+}
+
+inline void _FuncFoo_0x60_Foo_7695b5684605df93 ( Context * __context__, Foo &  __self_rename_at_4 )
+{
+	das_copy(__self_rename_at_4.i,5);
+}
+
+inline Lambda DAS_COMMENT((int32_t)) _FuncFoo_0x60_kaboom_914159c8d97356d0 ( Context * __context__, Foo &  __self_rename_at_6 )
+{
+	Lambda DAS_COMMENT((int32_t)) __counter_rename_at_7; das_zero(__counter_rename_at_7); das_move(__counter_rename_at_7, das_ascend<int32_t,_lambda_thismodule_8_3_1>::make(__context__,&__type_info__cc48069bba1d3bfa,(([&]() -> _lambda_thismodule_8_3_1 {
+		_lambda_thismodule_8_3_1 __mks_8;
+		das_copy((__mks_8.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_8_3_1`function XS<::_lambda_thismodule_8_3_1>*/ 3064542813929333402u))));
+		das_copy((__mks_8.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_8_3_1`finalizer X1<S<::_lambda_thismodule_8_3_1>>?*/ 6928036561868279520u))));
+		das_copy((__mks_8.self),(das_ref(__context__,__self_rename_at_6)));
+		return __mks_8;
+	})())));
+	return /* <- */ das_auto_cast_move<Lambda DAS_COMMENT((int32_t))>::cast(__counter_rename_at_7);
+}
+
+inline void _FuncFoo_0x27___finalize_cb819e50386e57dd ( Context * __context__, Foo &  __self_rename_at_1 )
+{
+	finalize_cf14726227c82aa8(__context__,das_arg<Foo>::pass(__self_rename_at_1));
+}
+
+inline bool test_3d54a49b67ce033d ( Context * __context__ )
+{
+	Foo * __x_rename_at_13 = das_new<Foo>::make_and_init(__context__,[&]() { return Foo_fdf64fe363510f7a(__context__); });
+	Lambda DAS_COMMENT((int32_t)) __boom_rename_at_14; das_zero(__boom_rename_at_14); das_move(__boom_rename_at_14, ((Lambda DAS_COMMENT((int32_t)))das_invoke_function<Lambda DAS_COMMENT((int32_t))>::invoke<Foo &>(__context__,nullptr,__x_rename_at_13->kaboom,das_arg<Foo>::pass(das_cast<Foo>::cast(das_deref(__context__,__x_rename_at_13))))));
+	DAS_ASSERT((__x_rename_at_13->i == 5));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_c3cfcf3cf07a0b99
+	aotLib[0xbdc4cf8dc916d8f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_8_3_1 &  ),&finalize_c3cfcf3cf07a0b99>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5
+	aotLib[0xb06e2106c303ef51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Foo & (*) ( Context * __context__, Foo &  ),&_Funcbuiltin_0x60__return_with_lockcheck_e3f27a37706a12a5>>();
+	};
+	// _Func_lambda_thismodule_8_3_1_0x60_function_49a7015d2420e12b
+	aotLib[0x362d49125191def9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, _lambda_thismodule_8_3_1 &  ),&_Func_lambda_thismodule_8_3_1_0x60_function_49a7015d2420e12b>>();
+	};
+	// _Func_lambda_thismodule_8_3_1_0x60_finalizer_32b7b109e2a691fe
+	aotLib[0xbf8de261316ed41c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_8_3_1 *  ),&_Func_lambda_thismodule_8_3_1_0x60_finalizer_32b7b109e2a691fe>>();
+	};
+	// finalize_cf14726227c82aa8
+	aotLib[0xcb4937fe0b69f105] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo &  ),&finalize_cf14726227c82aa8>>();
+	};
+	// Foo_fdf64fe363510f7a
+	aotLib[0x51aa427765808b6f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&Foo_fdf64fe363510f7a>>();
+	};
+	// _FuncFoo_0x60_Foo_7695b5684605df93
+	aotLib[0x520793e89b421529] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo &  ),&_FuncFoo_0x60_Foo_7695b5684605df93>>();
+	};
+	// _FuncFoo_0x60_kaboom_914159c8d97356d0
+	aotLib[0xe2c5a04915dc2588] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Lambda DAS_COMMENT((int32_t)) (*) ( Context * __context__, Foo &  ),&_FuncFoo_0x60_kaboom_914159c8d97356d0>>();
+	};
+	// _FuncFoo_0x27___finalize_cb819e50386e57dd
+	aotLib[0x3ba1ba68e389b077] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo &  ),&_FuncFoo_0x27___finalize_cb819e50386e57dd>>();
+	};
+	// test_3d54a49b67ce033d
+	aotLib[0x45d6f256b44eaaf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_3d54a49b67ce033d>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
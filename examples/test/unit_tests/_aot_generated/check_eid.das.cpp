@@ -0,0 +1,121 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3764708043289950017 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline uint64_t GetGoo_ed14a34ef7d950dc ( Context * __context__, char * const  __arg_rename_at_9 );
+inline uint64_t GetGoo2_3bd9dbb2c67d75c4 ( Context * __context__, char * const  __arg_rename_at_13 );
+inline bool test_b064e318a71388cd ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<TestObjectFoo,0x1fd45fd64d971912>(__context__);/*foo*/
+}
+
+inline uint64_t GetGoo_ed14a34ef7d950dc ( Context * __context__, char * const  __arg_rename_at_9 )
+{
+	return das_auto_cast<uint64_t>::cast(CheckEid(/*arg-0-prefix*/ das_arg<TestObjectFoo>::pass(das_global<TestObjectFoo,0x1fd45fd64d971912>(__context__) /*foo*/) /*arg-0-suffix*/,/*arg-1-prefix*/ __arg_rename_at_9 /*arg-1-suffix*/,/*arg-2-prefix*/ __context__ /*arg-2-suffix*/));
+}
+
+inline uint64_t GetGoo2_3bd9dbb2c67d75c4 ( Context * __context__, char * const  __arg_rename_at_13 )
+{
+	return das_auto_cast<uint64_t>::cast(CheckEid(das_arg<TestObjectFoo>::pass(das_global<TestObjectFoo,0x1fd45fd64d971912>(__context__) /*foo*/),__arg_rename_at_13,__context__));
+}
+
+inline bool test_b064e318a71388cd ( Context * __context__ )
+{
+	uint64_t __a_rename_at_18 = ((uint64_t)CheckEidHint(das_arg<TestObjectFoo>::pass(das_global<TestObjectFoo,0x1fd45fd64d971912>(__context__) /*foo*/),((char *) "goo"),UINT64_C(0xd4f74c18fabcaeec),__context__));
+	uint64_t __b_rename_at_19 = ((uint64_t)GetGoo_ed14a34ef7d950dc(__context__,((char *) "goo")));
+	DAS_ASSERT((__a_rename_at_18 == __b_rename_at_19));
+	uint64_t __a2_rename_at_21 = ((uint64_t)CheckEid(das_arg<TestObjectFoo>::pass(das_global<TestObjectFoo,0x1fd45fd64d971912>(__context__) /*foo*/),((char *) "goo"),__context__));
+	uint64_t __b2_rename_at_22 = ((uint64_t)GetGoo2_3bd9dbb2c67d75c4(__context__,((char *) "goo")));
+	DAS_ASSERT((__a2_rename_at_21 == __b2_rename_at_22));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// GetGoo_ed14a34ef7d950dc
+	aotLib[0x27fbe1f09c490b15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint64_t (*) ( Context * __context__, char * const   ),&GetGoo_ed14a34ef7d950dc>>();
+	};
+	// GetGoo2_3bd9dbb2c67d75c4
+	aotLib[0x1bf42c00b490ab01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint64_t (*) ( Context * __context__, char * const   ),&GetGoo2_3bd9dbb2c67d75c4>>();
+	};
+	// test_b064e318a71388cd
+	aotLib[0xf05552b5ba862bce] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_b064e318a71388cd>>();
+	};
+	// [[ init script ]]
+	aotLib[0x17face12cb4e90b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,139 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4139362523336473524 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+	int32_t a;
+	char * s;
+};
+static_assert(sizeof(Foo)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,s)==8,"structure field offset mismatch with DAS");
+}
+
+inline Foo _Funcbuiltin_0x60_clone_to_move_6546e5a8445fb13d ( Context * __context__, Foo const  & __clone_src_rename_at_318 );
+inline Foo const  test_c_fcdae697287594c ( Context * __context__ );
+inline bool test_647f74752ad5cab7 ( Context * __context__ );
+inline void clone_f4ca7135cda22aeb ( Context * __context__, Foo & __a_rename_at_1, Foo const  & __b_rename_at_1 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline Foo _Funcbuiltin_0x60_clone_to_move_6546e5a8445fb13d ( Context * __context__, Foo const  &  __clone_src_rename_at_318 )
+{
+	Foo __clone_dest_rename_at_320; das_zero(__clone_dest_rename_at_320);
+	clone_f4ca7135cda22aeb(__context__,das_arg<Foo>::pass(__clone_dest_rename_at_320),__clone_src_rename_at_318);
+	return /* <- */ das_auto_cast_move<Foo>::cast(__clone_dest_rename_at_320);
+}
+
+inline Foo const  test_c_fcdae697287594c ( Context * __context__ )
+{
+	return das_auto_cast_ref<Foo const >::cast((([&]() -> Foo {
+		Foo __mks_7;
+		das_zero(__mks_7);
+		das_copy((__mks_7.a),(4));
+		return __mks_7;
+	})()));
+}
+
+inline bool test_647f74752ad5cab7 ( Context * __context__ )
+{
+	Foo __foo_rename_at_11_ConstRef = ((Foo)test_c_fcdae697287594c(__context__));
+	Foo const  & __foo_rename_at_11 = __foo_rename_at_11_ConstRef; ;
+	Foo __cop_rename_at_12_ConstRef; das_zero(__cop_rename_at_12_ConstRef); das_move(__cop_rename_at_12_ConstRef, ((Foo)_Funcbuiltin_0x60_clone_to_move_6546e5a8445fb13d(__context__,__foo_rename_at_11)));
+	Foo const  & __cop_rename_at_12 = __cop_rename_at_12_ConstRef; ;
+	DAS_ASSERT((__foo_rename_at_11.a == 4));
+	DAS_ASSERT((__cop_rename_at_12.a == 4));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void clone_f4ca7135cda22aeb ( Context * __context__, Foo &  __a_rename_at_1, Foo const  &  __b_rename_at_1 )
+{
+	das_copy(__a_rename_at_1.a,__b_rename_at_1.a);
+	das_copy(__a_rename_at_1.s,__b_rename_at_1.s);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_clone_to_move_6546e5a8445fb13d
+	aotLib[0x56fa43011030f7c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__, Foo const  &  ),&_Funcbuiltin_0x60_clone_to_move_6546e5a8445fb13d>>();
+	};
+	// test_c_fcdae697287594c
+	aotLib[0xdc9e5c7ece71e321] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo const  (*) ( Context * __context__ ),&test_c_fcdae697287594c>>();
+	};
+	// test_647f74752ad5cab7
+	aotLib[0xbecfb9f467822ffb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_647f74752ad5cab7>>();
+	};
+	// clone_f4ca7135cda22aeb
+	aotLib[0xc597266ed3a99de5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo & , Foo const  &  ),&clone_f4ca7135cda22aeb>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
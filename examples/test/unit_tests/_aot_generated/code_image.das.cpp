@@ -0,0 +1,405 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require jobque
+#include "daScript/simulate/aot_builtin_jobque.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings_boost
+ // require ast_boost
+ // require templates
+ // require contracts
+ // require array_boost
+ // require algorithm
+ // require templates_boost
+ // require macro_boost
+ // require jobque_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_11752036064999728843 {
+
+extern StructInfo __struct_info__eab53f12449e6b91;
+extern TypeInfo __type_info__2f707f193f39acb0;
+extern TypeInfo __type_info__6c10b6e9d0f66c00;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__9f2b89ea82b475bc;
+extern VarInfo __var_info__a44240c370431c0d;
+extern VarInfo __var_info__e33909ae75ed6bd1;
+extern VarInfo __var_info__793d9663bdd9f06f;
+extern VarInfo __var_info__18aab86bb3264c3a;
+extern VarInfo __var_info__29523ae127cc747a;
+extern FuncInfo __func_info__e3ccd7343d92b33;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+TypeInfo * __type_info__29523ae127cc747a_arg_types_var_16912493323352959889[1] = { &__type_info__9f2b89ea82b475bc };
+VarInfo __struct_info__eab53f12449e6b91_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__29523ae127cc747a_arg_types_var_16912493323352959889, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x29523ae127cc747a), "__lambda", 0 };
+TypeInfo * __type_info__793d9663bdd9f06f_arg_types_var_16912493323352959889[1] = { &__type_info__6c10b6e9d0f66c00 };
+VarInfo __struct_info__eab53f12449e6b91_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__793d9663bdd9f06f_arg_types_var_16912493323352959889, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x793d9663bdd9f06f), "__finalize", 8 };
+VarInfo __struct_info__eab53f12449e6b91_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f707f193f39acb0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xe33909ae75ed6bd1), "status", 16 };
+VarInfo __struct_info__eab53f12449e6b91_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa44240c370431c0d), "x", 24 };
+VarInfo * __struct_info__eab53f12449e6b91_fields[4] =  { &__struct_info__eab53f12449e6b91_field_0, &__struct_info__eab53f12449e6b91_field_1, &__struct_info__eab53f12449e6b91_field_2, &__struct_info__eab53f12449e6b91_field_3 };
+StructInfo __struct_info__eab53f12449e6b91 = {"_lambda_thismodule_18_20_1", "", 6, __struct_info__eab53f12449e6b91_fields, 4, 32, UINT64_C(0x0), nullptr, UINT64_C(0xeab53f12449e6b91) };
+VarInfo __func_info__e3ccd7343d92b33_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f707f193f39acb0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x18aab86bb3264c3a), "status", 0 };
+VarInfo * __func_info__e3ccd7343d92b33_fields[1] =  { &__func_info__e3ccd7343d92b33_field_0 };
+FuncInfo __func_info__e3ccd7343d92b33 = {"invoke block<(status:jobque::JobStatus?):void> const", "", __func_info__e3ccd7343d92b33_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xe3ccd7343d92b33), 0x0 };
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xeeb3b74c98cb09c3), 0x0 };
+TypeInfo __type_info__2f707f193f39acb0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~jobque::JobStatus"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 104, UINT64_C(0x2f707f193f39acb0) };
+TypeInfo __type_info__6c10b6e9d0f66c00 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__9f2b89ea82b475bc, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x6c10b6e9d0f66c00) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__9f2b89ea82b475bc = { Type::tStructure, &__struct_info__eab53f12449e6b91, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 32, UINT64_C(0x9f2b89ea82b475bc) };
+
+static void resolveTypeInfoAnnotations()
+{
+	__type_info__2f707f193f39acb0.resolveAnnotation();
+}
+
+namespace  { struct _lambda_thismodule_18_20_1; };
+namespace  { struct _lambda_thismodule_18_20_1_new_job_clone; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstSimulateMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupSimulateMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+namespace templates { struct DecltypeMacro; };
+namespace templates { struct DecltypeNoRefMacro; };
+namespace templates { struct TemplateMacro; };
+namespace contracts { struct IsAnyType; };
+namespace contracts { struct IsAnyArrayMacro; };
+namespace contracts { struct IsDimMacro; };
+namespace contracts { struct IsNotDimMacro; };
+namespace contracts { struct IsAnyEnumMacro; };
+namespace contracts { struct IsAnyVectorType; };
+namespace contracts { struct IsAnyStructMacro; };
+namespace contracts { struct IsAnyNumericMacro; };
+namespace contracts { struct IsAnyWorkhorse; };
+namespace contracts { struct IsAnyWorkhorseNonPtrMacro; };
+namespace contracts { struct IsAnyTupleNonPtrMacro; };
+namespace contracts { struct IsAnyVariantNonPtrMacro; };
+namespace contracts { struct IsAnyFunctionNonPtrMacro; };
+namespace templates_boost { struct Template; };
+namespace templates_boost { struct TemplateVisitor; };
+namespace templates_boost { struct RemoveDerefVisitor; };
+namespace templates_boost { struct QRulesVisitor; };
+namespace templates_boost { struct AstQCallMacro; };
+namespace templates_boost { struct QMacro; };
+namespace templates_boost { struct QBlockMacro; };
+namespace templates_boost { struct QBlockToArrayMacro; };
+namespace templates_boost { struct QBlockExprMacro; };
+namespace templates_boost { struct QTypeMacro; };
+namespace templates_boost { struct AstQNamedMacro; };
+namespace templates_boost { struct AstQFunctionMacro; };
+namespace templates_boost { struct AstQVariableMacro; };
+namespace templates_boost { struct AstQNamedClassMacro; };
+namespace templates_boost { struct AstQMethodMacro; };
+namespace macro_boost { struct MacroVerifyMacro; };
+namespace jobque_boost { struct NewJobMacro; };
+namespace jobque_boost { struct ChannelAndStatusCapture; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+// unused structure AstSimulateMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupForLoopMacro
+// unused structure SetupCaptureMacro
+// unused structure SetupSimulateMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+// unused structure DecltypeMacro
+// unused structure DecltypeNoRefMacro
+// unused structure TemplateMacro
+// unused structure IsAnyType
+// unused structure IsAnyArrayMacro
+// unused structure IsDimMacro
+// unused structure IsNotDimMacro
+// unused structure IsAnyEnumMacro
+// unused structure IsAnyVectorType
+// unused structure IsAnyStructMacro
+// unused structure IsAnyNumericMacro
+// unused structure IsAnyWorkhorse
+// unused structure IsAnyWorkhorseNonPtrMacro
+// unused structure IsAnyTupleNonPtrMacro
+// unused structure IsAnyVariantNonPtrMacro
+// unused structure IsAnyFunctionNonPtrMacro
+// unused structure Template
+// unused structure TemplateVisitor
+// unused structure RemoveDerefVisitor
+// unused structure QRulesVisitor
+// unused structure AstQCallMacro
+// unused structure QMacro
+// unused structure QBlockMacro
+// unused structure QBlockToArrayMacro
+// unused structure QBlockExprMacro
+// unused structure QTypeMacro
+// unused structure AstQNamedMacro
+// unused structure AstQFunctionMacro
+// unused structure AstQVariableMacro
+// unused structure AstQNamedClassMacro
+// unused structure AstQMethodMacro
+// unused structure MacroVerifyMacro
+// unused structure NewJobMacro
+// unused structure ChannelAndStatusCapture
+namespace  {
+
+struct _lambda_thismodule_18_20_1 {
+	Func DAS_COMMENT((void,_lambda_thismodule_18_20_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_18_20_1 *)) __finalize;
+	JobStatus * status;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_18_20_1)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_20_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_20_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_20_1,status)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_20_1,x)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_18_20_1_new_job_clone {
+	Func DAS_COMMENT((void,_lambda_thismodule_18_20_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_18_20_1 *)) __finalize;
+	JobStatus * status;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_18_20_1_new_job_clone)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_20_1_new_job_clone,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_20_1_new_job_clone,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_20_1_new_job_clone,status)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_18_20_1_new_job_clone,x)==24,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_d93a8fea0c7d95d7 ( Context * __context__, _lambda_thismodule_18_20_1 & ____this_rename_at_18 );
+inline void clone_566e2ee124f17a03 ( Context * __context__, _lambda_thismodule_18_20_1_new_job_clone & __a_rename_at_18, _lambda_thismodule_18_20_1_new_job_clone const  & __b_rename_at_18 );
+inline void _Func_lambda_thismodule_18_20_1_0x60_function_b9c6d2a2508091bb ( Context * __context__, _lambda_thismodule_18_20_1 & ____this_rename_at_18 );
+inline void _Func_lambda_thismodule_18_20_1_0x60_finalizer_f85ba3dda71c4d12 ( Context * __context__, _lambda_thismodule_18_20_1 * ____this_rename_at_18 );
+inline int32_t fib_aa4c2d62f42b665a ( Context * __context__, int32_t __n_rename_at_7 );
+inline bool test_1fb03104fb7a4e3b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0xda60bc3116e38c25>(__context__) = 0;/*g_count*/
+}
+
+inline void finalize_d93a8fea0c7d95d7 ( Context * __context__, _lambda_thismodule_18_20_1 &  ____this_rename_at_18 )
+{
+	memset(&(____this_rename_at_18), 0, 32);
+}
+
+inline void clone_566e2ee124f17a03 ( Context * __context__, _lambda_thismodule_18_20_1_new_job_clone &  __a_rename_at_18, _lambda_thismodule_18_20_1_new_job_clone const  &  __b_rename_at_18 )
+{
+	das_copy(__a_rename_at_18.__lambda,__b_rename_at_18.__lambda);
+	das_copy(__a_rename_at_18.__finalize,__b_rename_at_18.__finalize);
+	das_copy(__a_rename_at_18.status,__b_rename_at_18.status);
+	das_copy(__a_rename_at_18.x,__b_rename_at_18.x);
+}
+
+inline void _Func_lambda_thismodule_18_20_1_0x60_function_b9c6d2a2508091bb ( Context * __context__, _lambda_thismodule_18_20_1 &  ____this_rename_at_18 )
+{
+/* finally */ auto __finally_18= das_finally([&](){
+	das_invoke_function<void>::invoke<JobStatus * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::release_capture_jobque_job_status C1<H<jobque::JobStatus>>?*/ 13882985380930343467u)),____this_rename_at_18.status);
+/* end finally */ });
+	DAS_ASSERT((fib_aa4c2d62f42b665a(__context__,____this_rename_at_18.x + 10) == (fib_aa4c2d62f42b665a(__context__,____this_rename_at_18.x + 9) + fib_aa4c2d62f42b665a(__context__,____this_rename_at_18.x + 8))));
+	notifyAndReleaseJob(____this_rename_at_18.status,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_18_20_1_0x60_finalizer_f85ba3dda71c4d12 ( Context * __context__, _lambda_thismodule_18_20_1 * ____this_rename_at_18 )
+{
+	finalize_d93a8fea0c7d95d7(__context__,das_arg<_lambda_thismodule_18_20_1>::pass(das_deref(__context__,____this_rename_at_18)));
+	das_delete_lambda_struct<_lambda_thismodule_18_20_1 *>::clear(__context__,____this_rename_at_18);
+}
+
+inline int32_t fib_aa4c2d62f42b665a ( Context * __context__, int32_t __n_rename_at_7 )
+{
+	return das_auto_cast<int32_t>::cast((__n_rename_at_7 < 2) ? das_auto_cast<int32_t>::cast(__n_rename_at_7) : das_auto_cast<int32_t>::cast((fib_aa4c2d62f42b665a(__context__,__n_rename_at_7 - 1) + fib_aa4c2d62f42b665a(__context__,__n_rename_at_7 - 2))));
+}
+
+inline bool test_1fb03104fb7a4e3b ( Context * __context__ ) { das_stack_prologue __prologue(__context__,176,"test " DAS_FILE_LINE);
+{
+	++das_global<int32_t,0xda60bc3116e38c25>(__context__) /*g_count*/;
+	withJobQue(das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		withJobStatus(4,das_make_block<void,JobStatus *>(__context__,128,0,&__func_info__e3ccd7343d92b33,[&](JobStatus * __status_rename_at_15) -> void{
+			{
+				bool __need_loop_16 = true;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,4));
+				int32_t __x_rename_at_16;
+				__need_loop_16 = __x_iterator.first(__context__,(__x_rename_at_16)) && __need_loop_16;
+				for ( ; __need_loop_16 ; __need_loop_16 = __x_iterator.next(__context__,(__x_rename_at_16)) )
+				{
+					new_job_invoke(das_ascend<void,_lambda_thismodule_18_20_1>::make(__context__,&__type_info__9f2b89ea82b475bc,(([&]() -> _lambda_thismodule_18_20_1 {
+						_lambda_thismodule_18_20_1 __mks_18;
+						das_copy((__mks_18.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_18_20_1`function XS<::_lambda_thismodule_18_20_1>*/ 16169966985493263794u))));
+						das_copy((__mks_18.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_18_20_1`finalizer X1<S<::_lambda_thismodule_18_20_1>>?*/ 10530847169005301916u))));
+						das_copy((__mks_18.status),(das_invoke_function<JobStatus *>::invoke<JobStatus * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::capture_jobque_job_status C1<H<jobque::JobStatus>>?*/ 15451494409577770137u)),__status_rename_at_15)));
+						das_copy((__mks_18.x),(__x_rename_at_16));
+						return __mks_18;
+					})())),Func(__context__->fnByMangledName(/*clone XS<::_lambda_thismodule_18_20_1_new_job_clone> CIS<::_lambda_thismodule_18_20_1_new_job_clone>*/ 14428750939509508546u)),32,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_16));
+			};
+			waitForJob(__status_rename_at_15,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_ASSERT((das_global<int32_t,0xda60bc3116e38c25>(__context__) /*g_count*/ == 1));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_d93a8fea0c7d95d7
+	aotLib[0xd851b2f0f8c677f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_18_20_1 &  ),&finalize_d93a8fea0c7d95d7>>();
+	};
+	// clone_566e2ee124f17a03
+	aotLib[0xcec9657473a0feb9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_18_20_1_new_job_clone & , _lambda_thismodule_18_20_1_new_job_clone const  &  ),&clone_566e2ee124f17a03>>();
+	};
+	// _Func_lambda_thismodule_18_20_1_0x60_function_b9c6d2a2508091bb
+	aotLib[0x8967850492fc0991] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_18_20_1 &  ),&_Func_lambda_thismodule_18_20_1_0x60_function_b9c6d2a2508091bb>>();
+	};
+	// _Func_lambda_thismodule_18_20_1_0x60_finalizer_f85ba3dda71c4d12
+	aotLib[0xe3f81ee178c27946] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_18_20_1 *  ),&_Func_lambda_thismodule_18_20_1_0x60_finalizer_f85ba3dda71c4d12>>();
+	};
+	// fib_aa4c2d62f42b665a
+	aotLib[0x1cb8e42c84c66a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&fib_aa4c2d62f42b665a>>();
+	};
+	// test_1fb03104fb7a4e3b
+	aotLib[0x7aa5f589746da77] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_1fb03104fb7a4e3b>>();
+	};
+	// [[ init script ]]
+	aotLib[0xbf50c9d2b7decd12] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
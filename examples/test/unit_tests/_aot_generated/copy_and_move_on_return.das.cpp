@@ -0,0 +1,310 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10239501239709958858 {
+
+extern StructInfo __struct_info__f35ff723fded4627;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__dfd82b908f3b1490;
+extern TypeInfo __type_info__c6da56122d36aaea;
+extern TypeInfo __type_info__3ceb21b1e6727087;
+extern VarInfo __var_info__937da3707b776e3a;
+extern FuncInfo __func_info__b8cd57da424b1af1;
+extern FuncInfo __func_info__eae2b296140f59ef;
+
+VarInfo __struct_info__f35ff723fded4627_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x937da3707b776e3a), "bar", 0 };
+VarInfo * __struct_info__f35ff723fded4627_fields[1] =  { &__struct_info__f35ff723fded4627_field_0 };
+StructInfo __struct_info__f35ff723fded4627 = {"Foo", "", 0, __struct_info__f35ff723fded4627_fields, 1, 4, UINT64_C(0x0), nullptr, UINT64_C(0xf35ff723fded4627) };
+FuncInfo __func_info__b8cd57da424b1af1 = {"invoke block<Foo> const", "", nullptr, 0, 32, &__type_info__dfd82b908f3b1490, nullptr,0,UINT64_C(0xb8cd57da424b1af1), 0x0 };
+FuncInfo __func_info__eae2b296140f59ef = {"invoke block<array<int>> const", "", nullptr, 0, 32, &__type_info__c6da56122d36aaea, nullptr,0,UINT64_C(0xeae2b296140f59ef), 0x0 };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__dfd82b908f3b1490 = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 4, UINT64_C(0xdfd82b908f3b1490) };
+TypeInfo __type_info__c6da56122d36aaea = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xc6da56122d36aaea) };
+TypeInfo __type_info__3ceb21b1e6727087 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x3ceb21b1e6727087) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__3ceb21b1e6727087 };
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+	int32_t bar;
+};
+static_assert(sizeof(Foo)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,bar)==0,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> & __Arr_rename_at_59, int32_t __newSize_rename_at_59 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> & __a_rename_at_42 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline TArray<int32_t> _Func_0x60_joinSequences_86ba8c6ede2a9218 ( Context * __context__, TArray<int32_t> const  & __l_rename_at_22, TArray<int32_t> const  & __r_rename_at_22 );
+inline TArray<int32_t> _Func_0x60_makeSequenceB_f962f40bffaea703 ( Context * __context__, Block DAS_COMMENT((TArray<int32_t>)) const  & __b_rename_at_31 );
+inline TArray<int32_t> _Func_0x60_makeSequence_73319bff2fb0d7c5 ( Context * __context__, int32_t __base_rename_at_15, int32_t __max_rename_at_15 );
+inline Foo newFoo_770d050e7e57e0c0 ( Context * __context__ );
+inline Foo newFooB_367316257dba54e5 ( Context * __context__, Block DAS_COMMENT((Foo)) const  & __b_rename_at_9 );
+inline int32_t addBar_213165c189cefb03 ( Context * __context__, Foo const  & __a_rename_at_12, Foo const  & __b_rename_at_12 );
+inline bool test_5deae43a7390ca8a ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_reserve_a0d71b661f152abb ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_59, int32_t __newSize_rename_at_59 )
+{
+	builtin_array_reserve(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_59),__newSize_rename_at_59,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline TArray<int32_t> _Func_0x60_joinSequences_86ba8c6ede2a9218 ( Context * __context__, TArray<int32_t> const  &  __l_rename_at_22, TArray<int32_t> const  &  __r_rename_at_22 )
+{
+	TArray<int32_t> __a_rename_at_23; das_zero(__a_rename_at_23);
+	_Funcbuiltin_0x60_reserve_a0d71b661f152abb(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_23),builtin_array_size(__l_rename_at_22) + builtin_array_size(__r_rename_at_22));
+	{
+		bool __need_loop_25 = true;
+		// t : int aka numT const&
+		das_iterator<TArray<int32_t> const > __t_iterator(__l_rename_at_22);
+		int32_t const  * __t_rename_at_25;
+		__need_loop_25 = __t_iterator.first(__context__,(__t_rename_at_25)) && __need_loop_25;
+		for ( ; __need_loop_25 ; __need_loop_25 = __t_iterator.next(__context__,(__t_rename_at_25)) )
+		{
+			_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_23),(*__t_rename_at_25));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_25));
+	};
+	{
+		bool __need_loop_27 = true;
+		// t : int const&
+		das_iterator<TArray<int32_t> const > __t_iterator(__r_rename_at_22);
+		int32_t const  * __t_rename_at_27;
+		__need_loop_27 = __t_iterator.first(__context__,(__t_rename_at_27)) && __need_loop_27;
+		for ( ; __need_loop_27 ; __need_loop_27 = __t_iterator.next(__context__,(__t_rename_at_27)) )
+		{
+			_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_23),(*__t_rename_at_27));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_27));
+	};
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_23)));
+}
+
+inline TArray<int32_t> _Func_0x60_makeSequenceB_f962f40bffaea703 ( Context * __context__, Block DAS_COMMENT((TArray<int32_t>)) const  &  __b_rename_at_31 )
+{
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass(das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,__b_rename_at_31))));
+}
+
+inline TArray<int32_t> _Func_0x60_makeSequence_73319bff2fb0d7c5 ( Context * __context__, int32_t __base_rename_at_15, int32_t __max_rename_at_15 )
+{
+	TArray<int32_t> __a_rename_at_16; das_zero(__a_rename_at_16);
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_16),(__max_rename_at_15 + 1) - __base_rename_at_15);
+	{
+		bool __need_loop_18 = true;
+		// t : int&
+		das_iterator<TArray<int32_t>> __t_iterator(__a_rename_at_16);
+		int32_t * __t_rename_at_18;
+		__need_loop_18 = __t_iterator.first(__context__,(__t_rename_at_18)) && __need_loop_18;
+		for ( ; __need_loop_18 ; __need_loop_18 = __t_iterator.next(__context__,(__t_rename_at_18)) )
+		{
+			das_copy((*__t_rename_at_18),__base_rename_at_15++);
+		}
+		__t_iterator.close(__context__,(__t_rename_at_18));
+	};
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_16)));
+}
+
+inline Foo newFoo_770d050e7e57e0c0 ( Context * __context__ )
+{
+	Foo __t_rename_at_5; das_zero(__t_rename_at_5);
+	das_copy(__t_rename_at_5.bar,1);
+	return das_auto_cast_ref<Foo>::cast(__t_rename_at_5);
+}
+
+inline Foo newFooB_367316257dba54e5 ( Context * __context__, Block DAS_COMMENT((Foo)) const  &  __b_rename_at_9 )
+{
+	return das_auto_cast_ref<Foo>::cast(das_invoke<Foo>::invoke_cmres(__context__,nullptr,__b_rename_at_9));
+}
+
+inline int32_t addBar_213165c189cefb03 ( Context * __context__, Foo const  &  __a_rename_at_12, Foo const  &  __b_rename_at_12 )
+{
+	return das_auto_cast<int32_t>::cast(__a_rename_at_12.bar + __b_rename_at_12.bar);
+}
+
+inline bool test_5deae43a7390ca8a ( Context * __context__ ) { das_stack_prologue __prologue(__context__,688,"test " DAS_FILE_LINE);
+{
+	Foo _temp_make_local_37_19_48;
+	Foo _temp_make_local_37_28_64;
+	Foo _temp_make_local_39_20_96;
+	Foo _temp_make_local_40_8_192;
+	TArray<int32_t> _temp_make_local_43_27_320;
+	TArray<int32_t> _temp_make_local_43_45_352;
+	TArray<int32_t> _temp_make_local_48_28_416;
+	TArray<int32_t> _temp_make_local_49_8_544;
+	int32_t __t_rename_at_37 = ((int32_t)addBar_213165c189cefb03(__context__,das_arg<Foo>::pass((_temp_make_local_37_19_48 = (newFoo_770d050e7e57e0c0(__context__)))),das_arg<Foo>::pass((_temp_make_local_37_28_64 = (newFoo_770d050e7e57e0c0(__context__))))));
+	DAS_ASSERT((__t_rename_at_37 == 2));
+	int32_t __tt_rename_at_39 = ((int32_t)addBar_213165c189cefb03(__context__,das_arg<Foo>::pass((_temp_make_local_39_20_96 = (newFooB_367316257dba54e5(__context__,das_make_block_cmres<Foo>(__context__,160,0,&__func_info__b8cd57da424b1af1,[&]() -> Foo{
+		Foo __T_rename_at_39; das_zero(__T_rename_at_39);
+		das_copy(__T_rename_at_39.bar,1);
+		return das_auto_cast_ref<Foo>::cast(__T_rename_at_39);
+	}))))),das_arg<Foo>::pass((_temp_make_local_40_8_192 = (newFooB_367316257dba54e5(__context__,das_make_block_cmres<Foo>(__context__,256,0,&__func_info__b8cd57da424b1af1,[&]() -> Foo{
+		Foo __T_rename_at_40; das_zero(__T_rename_at_40);
+		das_copy(__T_rename_at_40.bar,1);
+		return das_auto_cast_ref<Foo>::cast(__T_rename_at_40);
+	})))))));
+	DAS_ASSERT((__tt_rename_at_39 == 2));
+	TArray<int32_t> __z_rename_at_43_ConstRef; das_zero(__z_rename_at_43_ConstRef); das_move(__z_rename_at_43_ConstRef, ((TArray<int32_t>)_Func_0x60_joinSequences_86ba8c6ede2a9218(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_43_27_320 = (_Func_0x60_makeSequence_73319bff2fb0d7c5(__context__,0,4)))),das_arg<TArray<int32_t>>::pass((_temp_make_local_43_45_352 = (_Func_0x60_makeSequence_73319bff2fb0d7c5(__context__,5,9)))))));
+	TArray<int32_t> const  & __z_rename_at_43 = __z_rename_at_43_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__z_rename_at_43) == 10));
+	{
+		bool __need_loop_45 = true;
+		// ttq : int const
+		das_iterator<range> __ttq_iterator(range(0,9));
+		int32_t __ttq_rename_at_45;
+		__need_loop_45 = __ttq_iterator.first(__context__,(__ttq_rename_at_45)) && __need_loop_45;
+		for ( ; __need_loop_45 ; __need_loop_45 = __ttq_iterator.next(__context__,(__ttq_rename_at_45)) )
+		{
+			DAS_ASSERT((__z_rename_at_43(__ttq_rename_at_45,__context__) == __ttq_rename_at_45));
+		}
+		__ttq_iterator.close(__context__,(__ttq_rename_at_45));
+	};
+	TArray<int32_t> __zz_rename_at_48_ConstRef; das_zero(__zz_rename_at_48_ConstRef); das_move(__zz_rename_at_48_ConstRef, ((TArray<int32_t>)_Func_0x60_joinSequences_86ba8c6ede2a9218(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_48_28_416 = (_Func_0x60_makeSequenceB_f962f40bffaea703(__context__,das_make_block_cmres<TArray<int32_t>>(__context__,496,0,&__func_info__eae2b296140f59ef,[&]() -> TArray<int32_t>{
+		TArray<int32_t> _temp_make_local_48_54_512;
+		return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_48_54_512 = (_Func_0x60_makeSequence_73319bff2fb0d7c5(__context__,0,4))))));
+	}))))),das_arg<TArray<int32_t>>::pass((_temp_make_local_49_8_544 = (_Func_0x60_makeSequenceB_f962f40bffaea703(__context__,das_make_block_cmres<TArray<int32_t>>(__context__,624,0,&__func_info__eae2b296140f59ef,[&]() -> TArray<int32_t>{
+		TArray<int32_t> _temp_make_local_49_34_640;
+		return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_49_34_640 = (_Func_0x60_makeSequence_73319bff2fb0d7c5(__context__,5,9))))));
+	}))))))));
+	TArray<int32_t> const  & __zz_rename_at_48 = __zz_rename_at_48_ConstRef; ;
+	DAS_ASSERT((builtin_array_size(__zz_rename_at_48) == 10));
+	{
+		bool __need_loop_51 = true;
+		// ttt : int const
+		das_iterator<range> __ttt_iterator(range(0,9));
+		int32_t __ttt_rename_at_51;
+		__need_loop_51 = __ttt_iterator.first(__context__,(__ttt_rename_at_51)) && __need_loop_51;
+		for ( ; __need_loop_51 ; __need_loop_51 = __ttt_iterator.next(__context__,(__ttt_rename_at_51)) )
+		{
+			DAS_ASSERT((__zz_rename_at_48(__ttt_rename_at_51,__context__) == __ttt_rename_at_51));
+		}
+		__ttt_iterator.close(__context__,(__ttt_rename_at_51));
+	};
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_reserve_a0d71b661f152abb
+	aotLib[0xe761f57d94ab3d39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_reserve_a0d71b661f152abb>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd
+	aotLib[0x66e322246598e835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<int32_t> & (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd>>();
+	};
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Func_0x60_joinSequences_86ba8c6ede2a9218
+	aotLib[0xc1d159b077ca0f38] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TArray<int32_t> const  & , TArray<int32_t> const  &  ),&_Func_0x60_joinSequences_86ba8c6ede2a9218>>();
+	};
+	// _Func_0x60_makeSequenceB_f962f40bffaea703
+	aotLib[0xc5c333cce1587ea8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Block DAS_COMMENT((TArray<int32_t>)) const  &  ),&_Func_0x60_makeSequenceB_f962f40bffaea703>>();
+	};
+	// _Func_0x60_makeSequence_73319bff2fb0d7c5
+	aotLib[0xd723ce4f931061e4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, int32_t , int32_t  ),&_Func_0x60_makeSequence_73319bff2fb0d7c5>>();
+	};
+	// newFoo_770d050e7e57e0c0
+	aotLib[0x3ef4354fe89d86a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&newFoo_770d050e7e57e0c0>>();
+	};
+	// newFooB_367316257dba54e5
+	aotLib[0x40b501c16c9ccf19] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__, Block DAS_COMMENT((Foo)) const  &  ),&newFooB_367316257dba54e5>>();
+	};
+	// addBar_213165c189cefb03
+	aotLib[0xebf8c0a2ed979309] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Foo const  & , Foo const  &  ),&addBar_213165c189cefb03>>();
+	};
+	// test_5deae43a7390ca8a
+	aotLib[0x675366d0132d27a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_5deae43a7390ca8a>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
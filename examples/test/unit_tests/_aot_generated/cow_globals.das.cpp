@@ -0,0 +1,418 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require jobque
+#include "daScript/simulate/aot_builtin_jobque.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings_boost
+ // require ast_boost
+ // require templates
+ // require contracts
+ // require array_boost
+ // require algorithm
+ // require templates_boost
+ // require macro_boost
+ // require jobque_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_11581905448693575104 {
+
+extern StructInfo __struct_info__e9a8df1137d4a4f0;
+extern TypeInfo __type_info__2f707f193f39acb0;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__b1e3612d574dca2f;
+extern TypeInfo __type_info__af37ff7c0c305ef;
+extern VarInfo __var_info__3a468c2620ecf8c4;
+extern VarInfo __var_info__98d671a4bf5b7471;
+extern VarInfo __var_info__cf2878bd62db771e;
+extern VarInfo __var_info__18aab86bb3264c3a;
+extern VarInfo __var_info__d1ab1641b9f0de0;
+extern FuncInfo __func_info__e3ccd7343d92b33;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+TypeInfo * __type_info__98d671a4bf5b7471_arg_types_var_16836952471968720112[1] = { &__type_info__af37ff7c0c305ef };
+VarInfo __struct_info__e9a8df1137d4a4f0_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__98d671a4bf5b7471_arg_types_var_16836952471968720112, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x98d671a4bf5b7471), "__lambda", 0 };
+TypeInfo * __type_info__d1ab1641b9f0de0_arg_types_var_16836952471968720112[1] = { &__type_info__b1e3612d574dca2f };
+VarInfo __struct_info__e9a8df1137d4a4f0_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__d1ab1641b9f0de0_arg_types_var_16836952471968720112, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xd1ab1641b9f0de0), "__finalize", 8 };
+VarInfo __struct_info__e9a8df1137d4a4f0_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f707f193f39acb0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xcf2878bd62db771e), "status", 16 };
+VarInfo __struct_info__e9a8df1137d4a4f0_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x3a468c2620ecf8c4), "x", 24 };
+VarInfo * __struct_info__e9a8df1137d4a4f0_fields[4] =  { &__struct_info__e9a8df1137d4a4f0_field_0, &__struct_info__e9a8df1137d4a4f0_field_1, &__struct_info__e9a8df1137d4a4f0_field_2, &__struct_info__e9a8df1137d4a4f0_field_3 };
+StructInfo __struct_info__e9a8df1137d4a4f0 = {"_lambda_thismodule_15_20_1", "", 6, __struct_info__e9a8df1137d4a4f0_fields, 4, 32, UINT64_C(0x0), nullptr, UINT64_C(0xe9a8df1137d4a4f0) };
+VarInfo __func_info__e3ccd7343d92b33_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f707f193f39acb0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x18aab86bb3264c3a), "status", 0 };
+VarInfo * __func_info__e3ccd7343d92b33_fields[1] =  { &__func_info__e3ccd7343d92b33_field_0 };
+FuncInfo __func_info__e3ccd7343d92b33 = {"invoke block<(status:jobque::JobStatus?):void> const", "", __func_info__e3ccd7343d92b33_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xe3ccd7343d92b33), 0x0 };
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xeeb3b74c98cb09c3), 0x0 };
+TypeInfo __type_info__2f707f193f39acb0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~jobque::JobStatus"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 104, UINT64_C(0x2f707f193f39acb0) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__b1e3612d574dca2f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af37ff7c0c305ef, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xb1e3612d574dca2f) };
+TypeInfo __type_info__af37ff7c0c305ef = { Type::tStructure, &__struct_info__e9a8df1137d4a4f0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 32, UINT64_C(0xaf37ff7c0c305ef) };
+
+static void resolveTypeInfoAnnotations()
+{
+	__type_info__2f707f193f39acb0.resolveAnnotation();
+}
+
+namespace  { struct _lambda_thismodule_15_20_1; };
+namespace  { struct _lambda_thismodule_15_20_1_new_job_clone; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstSimulateMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupSimulateMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+namespace templates { struct DecltypeMacro; };
+namespace templates { struct DecltypeNoRefMacro; };
+namespace templates { struct TemplateMacro; };
+namespace contracts { struct IsAnyType; };
+namespace contracts { struct IsAnyArrayMacro; };
+namespace contracts { struct IsDimMacro; };
+namespace contracts { struct IsNotDimMacro; };
+namespace contracts { struct IsAnyEnumMacro; };
+namespace contracts { struct IsAnyVectorType; };
+namespace contracts { struct IsAnyStructMacro; };
+namespace contracts { struct IsAnyNumericMacro; };
+namespace contracts { struct IsAnyWorkhorse; };
+namespace contracts { struct IsAnyWorkhorseNonPtrMacro; };
+namespace contracts { struct IsAnyTupleNonPtrMacro; };
+namespace contracts { struct IsAnyVariantNonPtrMacro; };
+namespace contracts { struct IsAnyFunctionNonPtrMacro; };
+namespace templates_boost { struct Template; };
+namespace templates_boost { struct TemplateVisitor; };
+namespace templates_boost { struct RemoveDerefVisitor; };
+namespace templates_boost { struct QRulesVisitor; };
+namespace templates_boost { struct AstQCallMacro; };
+namespace templates_boost { struct QMacro; };
+namespace templates_boost { struct QBlockMacro; };
+namespace templates_boost { struct QBlockToArrayMacro; };
+namespace templates_boost { struct QBlockExprMacro; };
+namespace templates_boost { struct QTypeMacro; };
+namespace templates_boost { struct AstQNamedMacro; };
+namespace templates_boost { struct AstQFunctionMacro; };
+namespace templates_boost { struct AstQVariableMacro; };
+namespace templates_boost { struct AstQNamedClassMacro; };
+namespace templates_boost { struct AstQMethodMacro; };
+namespace macro_boost { struct MacroVerifyMacro; };
+namespace jobque_boost { struct NewJobMacro; };
+namespace jobque_boost { struct ChannelAndStatusCapture; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+// unused structure AstSimulateMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupForLoopMacro
+// unused structure SetupCaptureMacro
+// unused structure SetupSimulateMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+// unused structure DecltypeMacro
+// unused structure DecltypeNoRefMacro
+// unused structure TemplateMacro
+// unused structure IsAnyType
+// unused structure IsAnyArrayMacro
+// unused structure IsDimMacro
+// unused structure IsNotDimMacro
+// unused structure IsAnyEnumMacro
+// unused structure IsAnyVectorType
+// unused structure IsAnyStructMacro
+// unused structure IsAnyNumericMacro
+// unused structure IsAnyWorkhorse
+// unused structure IsAnyWorkhorseNonPtrMacro
+// unused structure IsAnyTupleNonPtrMacro
+// unused structure IsAnyVariantNonPtrMacro
+// unused structure IsAnyFunctionNonPtrMacro
+// unused structure Template
+// unused structure TemplateVisitor
+// unused structure RemoveDerefVisitor
+// unused structure QRulesVisitor
+// unused structure AstQCallMacro
+// unused structure QMacro
+// unused structure QBlockMacro
+// unused structure QBlockToArrayMacro
+// unused structure QBlockExprMacro
+// unused structure QTypeMacro
+// unused structure AstQNamedMacro
+// unused structure AstQFunctionMacro
+// unused structure AstQVariableMacro
+// unused structure AstQNamedClassMacro
+// unused structure AstQMethodMacro
+// unused structure MacroVerifyMacro
+// unused structure NewJobMacro
+// unused structure ChannelAndStatusCapture
+namespace  {
+
+struct _lambda_thismodule_15_20_1 {
+	Func DAS_COMMENT((void,_lambda_thismodule_15_20_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_15_20_1 *)) __finalize;
+	JobStatus * status;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_15_20_1)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_20_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_20_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_20_1,status)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_20_1,x)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_15_20_1_new_job_clone {
+	Func DAS_COMMENT((void,_lambda_thismodule_15_20_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_15_20_1 *)) __finalize;
+	JobStatus * status;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_15_20_1_new_job_clone)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_20_1_new_job_clone,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_20_1_new_job_clone,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_20_1_new_job_clone,status)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_15_20_1_new_job_clone,x)==24,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_d05dd4c74857e214 ( Context * __context__, _lambda_thismodule_15_20_1 & ____this_rename_at_15 );
+inline void clone_3d0d561f89cdcf1 ( Context * __context__, _lambda_thismodule_15_20_1_new_job_clone & __a_rename_at_15, _lambda_thismodule_15_20_1_new_job_clone const  & __b_rename_at_15 );
+inline void _Func_lambda_thismodule_15_20_1_0x60_function_eb6e86ad74043140 ( Context * __context__, _lambda_thismodule_15_20_1 & ____this_rename_at_15 );
+inline void _Func_lambda_thismodule_15_20_1_0x60_finalizer_1da2e25ad7f03af4 ( Context * __context__, _lambda_thismodule_15_20_1 * ____this_rename_at_15 );
+inline bool test_57e8c1b425e9a07a ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<TDim<int32_t,4>,0x4f3fbf8cc32a92ba>(__context__) = (([&]() -> TDim<int32_t,4> {
+		TDim<int32_t,4> __mka_5;
+		__mka_5(0,__context__) = 1;
+		__mka_5(1,__context__) = 2;
+		__mka_5(2,__context__) = 3;
+		__mka_5(3,__context__) = 4;
+		return __mka_5;
+	})());/*g_table*/
+	das_global<int32_t,0x28f91f2ccac8e71a>(__context__) = 13;/*g_counter*/
+}
+
+inline void finalize_d05dd4c74857e214 ( Context * __context__, _lambda_thismodule_15_20_1 &  ____this_rename_at_15 )
+{
+	memset(&(____this_rename_at_15), 0, 32);
+}
+
+inline void clone_3d0d561f89cdcf1 ( Context * __context__, _lambda_thismodule_15_20_1_new_job_clone &  __a_rename_at_15, _lambda_thismodule_15_20_1_new_job_clone const  &  __b_rename_at_15 )
+{
+	das_copy(__a_rename_at_15.__lambda,__b_rename_at_15.__lambda);
+	das_copy(__a_rename_at_15.__finalize,__b_rename_at_15.__finalize);
+	das_copy(__a_rename_at_15.status,__b_rename_at_15.status);
+	das_copy(__a_rename_at_15.x,__b_rename_at_15.x);
+}
+
+inline void _Func_lambda_thismodule_15_20_1_0x60_function_eb6e86ad74043140 ( Context * __context__, _lambda_thismodule_15_20_1 &  ____this_rename_at_15 )
+{
+/* finally */ auto __finally_15= das_finally([&](){
+	das_invoke_function<void>::invoke<JobStatus * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::release_capture_jobque_job_status C1<H<jobque::JobStatus>>?*/ 13882985380930343467u)),____this_rename_at_15.status);
+/* end finally */ });
+	DAS_ASSERT((das_global<int32_t,0x28f91f2ccac8e71a>(__context__) /*g_counter*/ == 13));
+	DAS_ASSERT((das_global<TDim<int32_t,4>,0x4f3fbf8cc32a92ba>(__context__) /*g_table*/(____this_rename_at_15.x,__context__) == (____this_rename_at_15.x + 1)));
+	das_copy(das_global<TDim<int32_t,4>,0x4f3fbf8cc32a92ba>(__context__) /*g_table*/(____this_rename_at_15.x,__context__),0);
+	das_copy(das_global<int32_t,0x28f91f2ccac8e71a>(__context__) /*g_counter*/,____this_rename_at_15.x);
+	notifyAndReleaseJob(____this_rename_at_15.status,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_15_20_1_0x60_finalizer_1da2e25ad7f03af4 ( Context * __context__, _lambda_thismodule_15_20_1 * ____this_rename_at_15 )
+{
+	finalize_d05dd4c74857e214(__context__,das_arg<_lambda_thismodule_15_20_1>::pass(das_deref(__context__,____this_rename_at_15)));
+	das_delete_lambda_struct<_lambda_thismodule_15_20_1 *>::clear(__context__,____this_rename_at_15);
+}
+
+inline bool test_57e8c1b425e9a07a ( Context * __context__ ) { das_stack_prologue __prologue(__context__,176,"test " DAS_FILE_LINE);
+{
+	das_copy(das_global<int32_t,0x28f91f2ccac8e71a>(__context__) /*g_counter*/,17);
+	withJobQue(das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		withJobStatus(4,das_make_block<void,JobStatus *>(__context__,128,0,&__func_info__e3ccd7343d92b33,[&](JobStatus * __status_rename_at_12) -> void{
+			{
+				bool __need_loop_13 = true;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,4));
+				int32_t __x_rename_at_13;
+				__need_loop_13 = __x_iterator.first(__context__,(__x_rename_at_13)) && __need_loop_13;
+				for ( ; __need_loop_13 ; __need_loop_13 = __x_iterator.next(__context__,(__x_rename_at_13)) )
+				{
+					new_job_invoke(das_ascend<void,_lambda_thismodule_15_20_1>::make(__context__,&__type_info__af37ff7c0c305ef,(([&]() -> _lambda_thismodule_15_20_1 {
+						_lambda_thismodule_15_20_1 __mks_15;
+						das_copy((__mks_15.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_15_20_1`function XS<::_lambda_thismodule_15_20_1>*/ 7983436802561820240u))));
+						das_copy((__mks_15.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_15_20_1`finalizer X1<S<::_lambda_thismodule_15_20_1>>?*/ 14056224447936632844u))));
+						das_copy((__mks_15.status),(das_invoke_function<JobStatus *>::invoke<JobStatus * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::capture_jobque_job_status C1<H<jobque::JobStatus>>?*/ 15451494409577770137u)),__status_rename_at_12)));
+						das_copy((__mks_15.x),(__x_rename_at_13));
+						return __mks_15;
+					})())),Func(__context__->fnByMangledName(/*clone XS<::_lambda_thismodule_15_20_1_new_job_clone> CIS<::_lambda_thismodule_15_20_1_new_job_clone>*/ 5307341424058419006u)),32,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_13));
+			};
+			waitForJob(__status_rename_at_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	DAS_ASSERT((das_global<int32_t,0x28f91f2ccac8e71a>(__context__) /*g_counter*/ == 17));
+	{
+		bool __need_loop_22 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,4));
+		int32_t __x_rename_at_22;
+		__need_loop_22 = __x_iterator.first(__context__,(__x_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __x_iterator.next(__context__,(__x_rename_at_22)) )
+		{
+			DAS_ASSERT((das_global<TDim<int32_t,4>,0x4f3fbf8cc32a92ba>(__context__) /*g_table*/(__x_rename_at_22,__context__) == (__x_rename_at_22 + 1)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_22));
+	};
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_d05dd4c74857e214
+	aotLib[0x12a2ddc8cc13e959] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_15_20_1 &  ),&finalize_d05dd4c74857e214>>();
+	};
+	// clone_3d0d561f89cdcf1
+	aotLib[0x9c2136fcb1ef7e3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_15_20_1_new_job_clone & , _lambda_thismodule_15_20_1_new_job_clone const  &  ),&clone_3d0d561f89cdcf1>>();
+	};
+	// _Func_lambda_thismodule_15_20_1_0x60_function_eb6e86ad74043140
+	aotLib[0x34a5054f5c96355d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_15_20_1 &  ),&_Func_lambda_thismodule_15_20_1_0x60_function_eb6e86ad74043140>>();
+	};
+	// _Func_lambda_thismodule_15_20_1_0x60_finalizer_1da2e25ad7f03af4
+	aotLib[0x92c13ae4715904e2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_15_20_1 *  ),&_Func_lambda_thismodule_15_20_1_0x60_finalizer_1da2e25ad7f03af4>>();
+	};
+	// test_57e8c1b425e9a07a
+	aotLib[0x50c83a330cc87f49] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_57e8c1b425e9a07a>>();
+	};
+	// [[ init script ]]
+	aotLib[0x1e8b05d6327c9a9a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,258 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require debugapi
+#include "daScript/simulate/aot_builtin_debugger.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_8564299097984383894 {
+
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern VarInfo __var_info__c0e00482aa9f06e4;
+extern FuncInfo __func_info__83ed5ac366c921ce;
+
+VarInfo __func_info__83ed5ac366c921ce_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xc0e00482aa9f06e4), "a", 0 };
+VarInfo * __func_info__83ed5ac366c921ce_fields[1] =  { &__func_info__83ed5ac366c921ce_field_0 };
+FuncInfo __func_info__83ed5ac366c921ce = {"invoke block<(a:int const):int> const", "", __func_info__83ed5ac366c921ce_fields, 1, 32, &__type_info__af63e44c8601fa24, nullptr,0,UINT64_C(0x83ed5ac366c921ce), 0x0 };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace debugapi { struct DapiDebugAgent; };
+namespace debugapi { struct DapiArray; };
+namespace debugapi { struct DapiTable; };
+namespace debugapi { struct DapiBlock; };
+namespace debugapi { struct DapiFunc; };
+namespace debugapi { struct DapiLambda; };
+namespace debugapi { struct DapiSequence; };
+namespace debugapi { struct DapiDataWalker; };
+namespace debugapi { struct DapiStackWalker; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused structure DapiDebugAgent
+// unused structure DapiArray
+// unused structure DapiTable
+// unused structure DapiBlock
+// unused structure DapiFunc
+// unused structure DapiLambda
+// unused structure DapiSequence
+// unused structure DapiDataWalker
+// unused structure DapiStackWalker
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline int32_t collatz_f97b43f81c9c4def ( Context * __context__, int32_t __n_rename_at_7 );
+inline int32_t sum_odd_e3ab790a8ed9404 ( Context * __context__, int32_t __n_rename_at_17 );
+inline void with_finally_904ecbc07e7b80ec ( Context * __context__, TArray<int32_t> & __log_rename_at_24, int32_t __x_rename_at_24 );
+inline int32_t invoke_twice_c0601bf03f2c9ed6 ( Context * __context__, int32_t __x_rename_at_30, Block DAS_COMMENT((int32_t,int32_t)) const  & __blk_rename_at_30 );
+inline int32_t step_in_loop_4a57351b09d8180a ( Context * __context__, int32_t __n_rename_at_33 );
+inline int32_t run_all_80cd03d97a1c5fce ( Context * __context__, int32_t __x_rename_at_41 );
+inline bool test_33403d72929786 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x29b001b28c710ea8>(__context__) = 1;/*input*/
+	das_global<char *,0x2bfad5f8d474866b>(__context__) = ((char *) "debugapi /root/repo/examples/test/unit_tests/debugger_step.das");/*__rtti_require*/
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 ) { das_stack_prologue __prologue(__context__,32,"builtin`push " DAS_FILE_LINE);
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}}
+
+inline int32_t collatz_f97b43f81c9c4def ( Context * __context__, int32_t __n_rename_at_7 ) { das_stack_prologue __prologue(__context__,48,"collatz " DAS_FILE_LINE);
+{
+	int32_t __steps_rename_at_8 = 0;
+	while ( __n_rename_at_7 > 1 )
+	{
+		if ( (SimPolicy<int32_t>::Mod(__n_rename_at_7,2,*__context__,nullptr)) == 0 )
+		{
+			__n_rename_at_7 /= 2;
+		} else {
+			das_copy(__n_rename_at_7,(__n_rename_at_7 * 3) + 1);
+		};
+		++__steps_rename_at_8;
+	};
+	return das_auto_cast<int32_t>::cast(__steps_rename_at_8);
+}}
+
+inline int32_t sum_odd_e3ab790a8ed9404 ( Context * __context__, int32_t __n_rename_at_17 ) { das_stack_prologue __prologue(__context__,64,"sum_odd " DAS_FILE_LINE);
+{
+	int32_t __t_rename_at_18 = 0;
+	{
+		bool __need_loop_19 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_17));
+		int32_t __i_rename_at_19;
+		__need_loop_19 = __i_iterator.first(__context__,(__i_rename_at_19)) && __need_loop_19;
+		for ( ; __need_loop_19 ; __need_loop_19 = __i_iterator.next(__context__,(__i_rename_at_19)) )
+		{
+			if ( (SimPolicy<int32_t>::Mod(__i_rename_at_19,2,*__context__,nullptr)) == 1 )
+			{
+				__t_rename_at_18 += __i_rename_at_19;
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_19));
+	};
+	return das_auto_cast<int32_t>::cast(__t_rename_at_18);
+}}
+
+inline void with_finally_904ecbc07e7b80ec ( Context * __context__, TArray<int32_t> &  __log_rename_at_24, int32_t __x_rename_at_24 ) { das_stack_prologue __prologue(__context__,32,"with_finally " DAS_FILE_LINE);
+{
+	if ( __x_rename_at_24 > 0 )
+	{
+	/* finally */ auto __finally_26= das_finally([&](){
+		_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__log_rename_at_24),-__x_rename_at_24);
+	/* end finally */ });
+		_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__log_rename_at_24),__x_rename_at_24);
+	};
+}}
+
+inline int32_t invoke_twice_c0601bf03f2c9ed6 ( Context * __context__, int32_t __x_rename_at_30, Block DAS_COMMENT((int32_t,int32_t)) const  &  __blk_rename_at_30 ) { das_stack_prologue __prologue(__context__,32,"invoke_twice " DAS_FILE_LINE);
+{
+	return das_auto_cast<int32_t>::cast(das_invoke<int32_t>::invoke<int32_t>(__context__,nullptr,__blk_rename_at_30,__x_rename_at_30) + das_invoke<int32_t>::invoke<int32_t>(__context__,nullptr,__blk_rename_at_30,__x_rename_at_30));
+}}
+
+inline int32_t step_in_loop_4a57351b09d8180a ( Context * __context__, int32_t __n_rename_at_33 ) { das_stack_prologue __prologue(__context__,64,"step_in_loop " DAS_FILE_LINE);
+{
+	int32_t __t_rename_at_34 = 0;
+	{
+		bool __need_loop_35 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_33));
+		int32_t __i_rename_at_35;
+		__need_loop_35 = __i_iterator.first(__context__,(__i_rename_at_35)) && __need_loop_35;
+		for ( ; __need_loop_35 ; __need_loop_35 = __i_iterator.next(__context__,(__i_rename_at_35)) )
+		{
+			debuggerSetContextSingleStep(das_arg<Context>::pass(thisContext(__context__)),(SimPolicy<int32_t>::Mod(__i_rename_at_35,2,*__context__,nullptr)) == 0);
+			__t_rename_at_34 += __i_rename_at_35;
+		}
+		__i_iterator.close(__context__,(__i_rename_at_35));
+	};
+	debuggerSetContextSingleStep(das_arg<Context>::pass(thisContext(__context__)),false);
+	return das_auto_cast<int32_t>::cast(__t_rename_at_34);
+}}
+
+inline int32_t run_all_80cd03d97a1c5fce ( Context * __context__, int32_t __x_rename_at_41 ) { das_stack_prologue __prologue(__context__,144,"run_all " DAS_FILE_LINE);
+{
+	TArray<int32_t> __log_rename_at_42; das_zero(__log_rename_at_42);
+	with_finally_904ecbc07e7b80ec(__context__,das_arg<TArray<int32_t>>::pass(__log_rename_at_42),__x_rename_at_41);
+	DAS_ASSERT((((builtin_array_size(das_arg<TArray<int32_t>>::pass(__log_rename_at_42)) == 2) && (__log_rename_at_42(0,__context__) == __x_rename_at_41)) && (__log_rename_at_42(1,__context__) == -__x_rename_at_41)));
+	int32_t __doubled_rename_at_45 = ((int32_t)invoke_twice_c0601bf03f2c9ed6(__context__,__x_rename_at_41,das_make_block<int32_t,int32_t>(__context__,128,0,&__func_info__83ed5ac366c921ce,[&](int32_t const  __a_rename_at_45) -> int32_t{
+		return das_auto_cast<int32_t>::cast(__a_rename_at_45 * 2);
+	})));
+	return das_auto_cast<int32_t>::cast((collatz_f97b43f81c9c4def(__context__,__x_rename_at_41 * 27) + sum_odd_e3ab790a8ed9404(__context__,__x_rename_at_41 * 10)) + __doubled_rename_at_45);
+}}
+
+inline bool test_33403d72929786 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,64,"test " DAS_FILE_LINE);
+{
+	int32_t __expected_rename_at_53 = ((int32_t)run_all_80cd03d97a1c5fce(__context__,das_global<int32_t,0x29b001b28c710ea8>(__context__) /*input*/));
+	DAS_ASSERT((__expected_rename_at_53 == 140));
+	debuggerSetContextSingleStep(das_arg<Context>::pass(thisContext(__context__)),true);
+	int32_t __stepped_rename_at_56 = ((int32_t)run_all_80cd03d97a1c5fce(__context__,das_global<int32_t,0x29b001b28c710ea8>(__context__) /*input*/));
+	debuggerSetContextSingleStep(das_arg<Context>::pass(thisContext(__context__)),false);
+	DAS_ASSERT((__stepped_rename_at_56 == __expected_rename_at_53));
+	DAS_VERIFY((run_all_80cd03d97a1c5fce(__context__,das_global<int32_t,0x29b001b28c710ea8>(__context__) /*input*/) == __expected_rename_at_53));
+	DAS_VERIFY((step_in_loop_4a57351b09d8180a(__context__,das_global<int32_t,0x29b001b28c710ea8>(__context__) /*input*/ * 10) == 45));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// collatz_f97b43f81c9c4def
+	aotLib[0xd7f76f7399111ef5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&collatz_f97b43f81c9c4def>>();
+	};
+	// sum_odd_e3ab790a8ed9404
+	aotLib[0x8c7ee89abf52cda5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&sum_odd_e3ab790a8ed9404>>();
+	};
+	// with_finally_904ecbc07e7b80ec
+	aotLib[0x5fb2c736cdce6444] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&with_finally_904ecbc07e7b80ec>>();
+	};
+	// invoke_twice_c0601bf03f2c9ed6
+	aotLib[0xcf4afc9c5d6ed65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , Block DAS_COMMENT((int32_t,int32_t)) const  &  ),&invoke_twice_c0601bf03f2c9ed6>>();
+	};
+	// step_in_loop_4a57351b09d8180a
+	aotLib[0x86f2f6484a6b9b25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&step_in_loop_4a57351b09d8180a>>();
+	};
+	// run_all_80cd03d97a1c5fce
+	aotLib[0xbc63e8b93f6ff73] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&run_all_80cd03d97a1c5fce>>();
+	};
+	// test_33403d72929786
+	aotLib[0xbb28d59c49000413] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_33403d72929786>>();
+	};
+	// [[ init script ]]
+	aotLib[0x96bbfd044dea13ee] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,244 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4531419659637636080 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline int32_t _Func_0x60_div_by_zero_119e24ef628e9254 ( Context * __context__, int32_t __num_rename_at_2 );
+inline int32_t _Func_0x60_mod_by_zero_f7aaf86dc3bf08ff ( Context * __context__, int32_t __num_rename_at_12 );
+inline uint32_t _Func_0x60_div_by_zero_6d879d8c876b6555 ( Context * __context__, uint32_t __num_rename_at_2 );
+inline uint32_t _Func_0x60_mod_by_zero_3544b6b4fb591a00 ( Context * __context__, uint32_t __num_rename_at_12 );
+inline int64_t _Func_0x60_div_by_zero_e632b8f69000283a ( Context * __context__, int64_t __num_rename_at_2 );
+inline int64_t _Func_0x60_mod_by_zero_bf762dc5762717dd ( Context * __context__, int64_t __num_rename_at_12 );
+inline uint64_t _Func_0x60_div_by_zero_c5c4afd1601f3e47 ( Context * __context__, uint64_t __num_rename_at_2 );
+inline uint64_t _Func_0x60_mod_by_zero_3deaba1180f4834e ( Context * __context__, uint64_t __num_rename_at_12 );
+inline bool test_3876a7facc11ab16 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t _Func_0x60_div_by_zero_119e24ef628e9254 ( Context * __context__, int32_t __num_rename_at_2 )
+{
+	bool __ex_rename_at_3 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<int32_t>::cast(SimPolicy<int32_t>::Div(__num_rename_at_2,0,*__context__,nullptr));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_3,true);
+	});
+	DAS_ASSERT((__ex_rename_at_3));
+	return das_auto_cast<int32_t>::cast(__num_rename_at_2);
+}
+
+inline int32_t _Func_0x60_mod_by_zero_f7aaf86dc3bf08ff ( Context * __context__, int32_t __num_rename_at_12 )
+{
+	bool __ex_rename_at_13 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<int32_t>::cast(SimPolicy<int32_t>::Mod(__num_rename_at_12,0,*__context__,nullptr));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_13,true);
+	});
+	DAS_ASSERT((__ex_rename_at_13));
+	return das_auto_cast<int32_t>::cast(__num_rename_at_12);
+}
+
+inline uint32_t _Func_0x60_div_by_zero_6d879d8c876b6555 ( Context * __context__, uint32_t __num_rename_at_2 )
+{
+	bool __ex_rename_at_3 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<uint32_t>::cast(SimPolicy<uint32_t>::Div(__num_rename_at_2,0x0u,*__context__,nullptr));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_3,true);
+	});
+	DAS_ASSERT((__ex_rename_at_3));
+	return das_auto_cast<uint32_t>::cast(__num_rename_at_2);
+}
+
+inline uint32_t _Func_0x60_mod_by_zero_3544b6b4fb591a00 ( Context * __context__, uint32_t __num_rename_at_12 )
+{
+	bool __ex_rename_at_13 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<uint32_t>::cast(SimPolicy<uint32_t>::Mod(__num_rename_at_12,0x0u,*__context__,nullptr));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_13,true);
+	});
+	DAS_ASSERT((__ex_rename_at_13));
+	return das_auto_cast<uint32_t>::cast(__num_rename_at_12);
+}
+
+inline int64_t _Func_0x60_div_by_zero_e632b8f69000283a ( Context * __context__, int64_t __num_rename_at_2 )
+{
+	bool __ex_rename_at_3 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<int64_t>::cast(SimPolicy<int64_t>::Div(__num_rename_at_2,INT64_C(0),*__context__,nullptr));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_3,true);
+	});
+	DAS_ASSERT((__ex_rename_at_3));
+	return das_auto_cast<int64_t>::cast(__num_rename_at_2);
+}
+
+inline int64_t _Func_0x60_mod_by_zero_bf762dc5762717dd ( Context * __context__, int64_t __num_rename_at_12 )
+{
+	bool __ex_rename_at_13 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<int64_t>::cast(SimPolicy<int64_t>::Mod(__num_rename_at_12,INT64_C(0),*__context__,nullptr));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_13,true);
+	});
+	DAS_ASSERT((__ex_rename_at_13));
+	return das_auto_cast<int64_t>::cast(__num_rename_at_12);
+}
+
+inline uint64_t _Func_0x60_div_by_zero_c5c4afd1601f3e47 ( Context * __context__, uint64_t __num_rename_at_2 )
+{
+	bool __ex_rename_at_3 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<uint64_t>::cast(SimPolicy<uint64_t>::Div(__num_rename_at_2,UINT64_C(0x0),*__context__,nullptr));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_3,true);
+	});
+	DAS_ASSERT((__ex_rename_at_3));
+	return das_auto_cast<uint64_t>::cast(__num_rename_at_2);
+}
+
+inline uint64_t _Func_0x60_mod_by_zero_3deaba1180f4834e ( Context * __context__, uint64_t __num_rename_at_12 )
+{
+	bool __ex_rename_at_13 = false;
+	das_try_recover(__context__, [&]()
+	{
+		return das_auto_cast<uint64_t>::cast(SimPolicy<uint64_t>::Mod(__num_rename_at_12,UINT64_C(0x0),*__context__,nullptr));
+	}, [&]()
+	{
+		das_copy(__ex_rename_at_13,true);
+	});
+	DAS_ASSERT((__ex_rename_at_13));
+	return das_auto_cast<uint64_t>::cast(__num_rename_at_12);
+}
+
+inline bool test_3876a7facc11ab16 ( Context * __context__ )
+{
+	DAS_VERIFY((_Func_0x60_div_by_zero_119e24ef628e9254(__context__,1) == 1));
+	DAS_VERIFY((_Func_0x60_mod_by_zero_f7aaf86dc3bf08ff(__context__,1) == 1));
+	DAS_VERIFY((_Func_0x60_div_by_zero_6d879d8c876b6555(__context__,0x1u) == 0x1u));
+	DAS_VERIFY((_Func_0x60_mod_by_zero_3544b6b4fb591a00(__context__,0x1u) == 0x1u));
+	DAS_VERIFY((_Func_0x60_div_by_zero_e632b8f69000283a(__context__,INT64_C(1)) == INT64_C(1)));
+	DAS_VERIFY((_Func_0x60_mod_by_zero_bf762dc5762717dd(__context__,INT64_C(1)) == INT64_C(1)));
+	DAS_VERIFY((_Func_0x60_div_by_zero_c5c4afd1601f3e47(__context__,UINT64_C(0x1)) == UINT64_C(0x1)));
+	DAS_VERIFY((_Func_0x60_mod_by_zero_3deaba1180f4834e(__context__,UINT64_C(0x1)) == UINT64_C(0x1)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_div_by_zero_119e24ef628e9254
+	aotLib[0xc9df50ce778a0425] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_div_by_zero_119e24ef628e9254>>();
+	};
+	// _Func_0x60_mod_by_zero_f7aaf86dc3bf08ff
+	aotLib[0x9395e0da29008c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&_Func_0x60_mod_by_zero_f7aaf86dc3bf08ff>>();
+	};
+	// _Func_0x60_div_by_zero_6d879d8c876b6555
+	aotLib[0x53536c12385c1e01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__, uint32_t  ),&_Func_0x60_div_by_zero_6d879d8c876b6555>>();
+	};
+	// _Func_0x60_mod_by_zero_3544b6b4fb591a00
+	aotLib[0xd361c2d66b6a8481] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__, uint32_t  ),&_Func_0x60_mod_by_zero_3544b6b4fb591a00>>();
+	};
+	// _Func_0x60_div_by_zero_e632b8f69000283a
+	aotLib[0xad996fdecf5464a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int64_t (*) ( Context * __context__, int64_t  ),&_Func_0x60_div_by_zero_e632b8f69000283a>>();
+	};
+	// _Func_0x60_mod_by_zero_bf762dc5762717dd
+	aotLib[0x8d13e9fe6f992025] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int64_t (*) ( Context * __context__, int64_t  ),&_Func_0x60_mod_by_zero_bf762dc5762717dd>>();
+	};
+	// _Func_0x60_div_by_zero_c5c4afd1601f3e47
+	aotLib[0x284a4857dc6cde5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint64_t (*) ( Context * __context__, uint64_t  ),&_Func_0x60_div_by_zero_c5c4afd1601f3e47>>();
+	};
+	// _Func_0x60_mod_by_zero_3deaba1180f4834e
+	aotLib[0x1462fc3bdd5e9c65] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint64_t (*) ( Context * __context__, uint64_t  ),&_Func_0x60_mod_by_zero_3deaba1180f4834e>>();
+	};
+	// test_3876a7facc11ab16
+	aotLib[0xfb719dc03e2c023a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_3876a7facc11ab16>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,218 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_17620036793419700872 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline void _Func_0x60_checkz_5d4c538fae8debda ( Context * __context__, char * const  __txt_rename_at_4, Func DAS_COMMENT((int32_t,char * const )) const  __fn_rename_at_4 );
+inline void _Func_0x60_checkz_e41f89267991964f ( Context * __context__, char * const  __txt_rename_at_4, Func DAS_COMMENT((uint32_t,char * const )) const  __fn_rename_at_4 );
+inline void _Func_0x60_checkz_f0b605b3fabb0dfc ( Context * __context__, char * const  __txt_rename_at_4, Func DAS_COMMENT((int64_t,char * const )) const  __fn_rename_at_4 );
+inline void _Func_0x60_checkz_4ca828c95018b4f9 ( Context * __context__, char * const  __txt_rename_at_4, Func DAS_COMMENT((uint64_t,char * const )) const  __fn_rename_at_4 );
+inline void _Func_0x60_checkz_510184d2cb7123a3 ( Context * __context__, char * const  __txt_rename_at_4, Func DAS_COMMENT((float,char * const )) const  __fn_rename_at_4 );
+inline void _Func_0x60_checkz_168915f2afbe524e ( Context * __context__, char * const  __txt_rename_at_4, Func DAS_COMMENT((double,char * const )) const  __fn_rename_at_4 );
+inline int32_t _Func_localfunction_thismodule_11_34_1_0x60_function_eb100592c1658132 ( Context * __context__, char * const  __x_rename_at_11 );
+inline uint32_t _Func_localfunction_thismodule_12_34_2_0x60_function_47e6a081f27b4476 ( Context * __context__, char * const  __x_rename_at_12 );
+inline int64_t _Func_localfunction_thismodule_13_34_3_0x60_function_d813ea0e9631f4a6 ( Context * __context__, char * const  __x_rename_at_13 );
+inline uint64_t _Func_localfunction_thismodule_14_34_4_0x60_function_1b1c908878e2c38a ( Context * __context__, char * const  __x_rename_at_14 );
+inline float _Func_localfunction_thismodule_15_34_5_0x60_function_4eb18f3f56c241a ( Context * __context__, char * const  __x_rename_at_15 );
+inline double _Func_localfunction_thismodule_16_34_6_0x60_function_a218e58f38c49c8 ( Context * __context__, char * const  __x_rename_at_16 );
+inline bool test_7eb52e3fd6cdb04f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_0x60_checkz_5d4c538fae8debda ( Context * __context__, char * const  __txt_rename_at_4, Func DAS_COMMENT((int32_t,char * const )) const  __fn_rename_at_4 )
+{
+	int32_t __t_rename_at_5 = ((int32_t)das_invoke_function<int32_t>::invoke<char * const >(__context__,nullptr,__fn_rename_at_4,__txt_rename_at_4));
+	DAS_ASSERT((__t_rename_at_5 == 0));
+}
+
+inline void _Func_0x60_checkz_e41f89267991964f ( Context * __context__, char * const  __txt_rename_at_4, Func DAS_COMMENT((uint32_t,char * const )) const  __fn_rename_at_4 )
+{
+	uint32_t __t_rename_at_5 = ((uint32_t)das_invoke_function<uint32_t>::invoke<char * const >(__context__,nullptr,__fn_rename_at_4,__txt_rename_at_4));
+	DAS_ASSERT((__t_rename_at_5 == 0x0u));
+}
+
+inline void _Func_0x60_checkz_f0b605b3fabb0dfc ( Context * __context__, char * const  __txt_rename_at_4, Func DAS_COMMENT((int64_t,char * const )) const  __fn_rename_at_4 )
+{
+	int64_t __t_rename_at_5 = ((int64_t)das_invoke_function<int64_t>::invoke<char * const >(__context__,nullptr,__fn_rename_at_4,__txt_rename_at_4));
+	DAS_ASSERT((__t_rename_at_5 == INT64_C(0)));
+}
+
+inline void _Func_0x60_checkz_4ca828c95018b4f9 ( Context * __context__, char * const  __txt_rename_at_4, Func DAS_COMMENT((uint64_t,char * const )) const  __fn_rename_at_4 )
+{
+	uint64_t __t_rename_at_5 = ((uint64_t)das_invoke_function<uint64_t>::invoke<char * const >(__context__,nullptr,__fn_rename_at_4,__txt_rename_at_4));
+	DAS_ASSERT((__t_rename_at_5 == UINT64_C(0x0)));
+}
+
+inline void _Func_0x60_checkz_510184d2cb7123a3 ( Context * __context__, char * const  __txt_rename_at_4, Func DAS_COMMENT((float,char * const )) const  __fn_rename_at_4 )
+{
+	float __t_rename_at_5 = ((float)das_invoke_function<float>::invoke<char * const >(__context__,nullptr,__fn_rename_at_4,__txt_rename_at_4));
+	DAS_ASSERT((__t_rename_at_5 == 0.f));
+}
+
+inline void _Func_0x60_checkz_168915f2afbe524e ( Context * __context__, char * const  __txt_rename_at_4, Func DAS_COMMENT((double,char * const )) const  __fn_rename_at_4 )
+{
+	double __t_rename_at_5 = ((double)das_invoke_function<double>::invoke<char * const >(__context__,nullptr,__fn_rename_at_4,__txt_rename_at_4));
+	DAS_ASSERT((__t_rename_at_5 == 0.));
+}
+
+inline int32_t _Func_localfunction_thismodule_11_34_1_0x60_function_eb100592c1658132 ( Context * __context__, char * const  __x_rename_at_11 )
+{
+	return das_auto_cast<int32_t>::cast(fast_to_int(__x_rename_at_11,false));
+}
+
+inline uint32_t _Func_localfunction_thismodule_12_34_2_0x60_function_47e6a081f27b4476 ( Context * __context__, char * const  __x_rename_at_12 )
+{
+	return das_auto_cast<uint32_t>::cast(fast_to_uint(__x_rename_at_12,false));
+}
+
+inline int64_t _Func_localfunction_thismodule_13_34_3_0x60_function_d813ea0e9631f4a6 ( Context * __context__, char * const  __x_rename_at_13 )
+{
+	return das_auto_cast<int64_t>::cast(fast_to_int64(__x_rename_at_13,false));
+}
+
+inline uint64_t _Func_localfunction_thismodule_14_34_4_0x60_function_1b1c908878e2c38a ( Context * __context__, char * const  __x_rename_at_14 )
+{
+	return das_auto_cast<uint64_t>::cast(fast_to_uint64(__x_rename_at_14,false));
+}
+
+inline float _Func_localfunction_thismodule_15_34_5_0x60_function_4eb18f3f56c241a ( Context * __context__, char * const  __x_rename_at_15 )
+{
+	return das_auto_cast<float>::cast(fast_to_float(__x_rename_at_15));
+}
+
+inline double _Func_localfunction_thismodule_16_34_6_0x60_function_a218e58f38c49c8 ( Context * __context__, char * const  __x_rename_at_16 )
+{
+	return das_auto_cast<double>::cast(fast_to_double(__x_rename_at_16));
+}
+
+inline bool test_7eb52e3fd6cdb04f ( Context * __context__ )
+{
+	_Func_0x60_checkz_5d4c538fae8debda(__context__,((char *) "str"),Func(__context__->fnByMangledName(/*_localfunction_thismodule_11_34_1`function Cs*/ 6096652727286044303u)));
+	_Func_0x60_checkz_e41f89267991964f(__context__,((char *) "str"),Func(__context__->fnByMangledName(/*_localfunction_thismodule_12_34_2`function Cs*/ 4613235167042195997u)));
+	_Func_0x60_checkz_f0b605b3fabb0dfc(__context__,((char *) "str"),Func(__context__->fnByMangledName(/*_localfunction_thismodule_13_34_3`function Cs*/ 10981998386383521991u)));
+	_Func_0x60_checkz_4ca828c95018b4f9(__context__,((char *) "str"),Func(__context__->fnByMangledName(/*_localfunction_thismodule_14_34_4`function Cs*/ 7464974590790153737u)));
+	_Func_0x60_checkz_510184d2cb7123a3(__context__,((char *) "str"),Func(__context__->fnByMangledName(/*_localfunction_thismodule_15_34_5`function Cs*/ 2151774467527109607u)));
+	_Func_0x60_checkz_168915f2afbe524e(__context__,((char *) "str"),Func(__context__->fnByMangledName(/*_localfunction_thismodule_16_34_6`function Cs*/ 12476224342433486165u)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_checkz_5d4c538fae8debda
+	aotLib[0xdd2038052a6bdb35] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , Func DAS_COMMENT((int32_t,char * const )) const   ),&_Func_0x60_checkz_5d4c538fae8debda>>();
+	};
+	// _Func_0x60_checkz_e41f89267991964f
+	aotLib[0xd862d1e2cdce9069] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , Func DAS_COMMENT((uint32_t,char * const )) const   ),&_Func_0x60_checkz_e41f89267991964f>>();
+	};
+	// _Func_0x60_checkz_f0b605b3fabb0dfc
+	aotLib[0xd998f0c5ce621a5d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , Func DAS_COMMENT((int64_t,char * const )) const   ),&_Func_0x60_checkz_f0b605b3fabb0dfc>>();
+	};
+	// _Func_0x60_checkz_4ca828c95018b4f9
+	aotLib[0xddad982f97c666e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , Func DAS_COMMENT((uint64_t,char * const )) const   ),&_Func_0x60_checkz_4ca828c95018b4f9>>();
+	};
+	// _Func_0x60_checkz_510184d2cb7123a3
+	aotLib[0xb03fa265f6f733e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , Func DAS_COMMENT((float,char * const )) const   ),&_Func_0x60_checkz_510184d2cb7123a3>>();
+	};
+	// _Func_0x60_checkz_168915f2afbe524e
+	aotLib[0x27afe72e6da686f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const  , Func DAS_COMMENT((double,char * const )) const   ),&_Func_0x60_checkz_168915f2afbe524e>>();
+	};
+	// _Func_localfunction_thismodule_11_34_1_0x60_function_eb100592c1658132
+	aotLib[0x7ce0726134a59b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, char * const   ),&_Func_localfunction_thismodule_11_34_1_0x60_function_eb100592c1658132>>();
+	};
+	// _Func_localfunction_thismodule_12_34_2_0x60_function_47e6a081f27b4476
+	aotLib[0x580708fafa64a4f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__, char * const   ),&_Func_localfunction_thismodule_12_34_2_0x60_function_47e6a081f27b4476>>();
+	};
+	// _Func_localfunction_thismodule_13_34_3_0x60_function_d813ea0e9631f4a6
+	aotLib[0x8e24f586a07c411d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int64_t (*) ( Context * __context__, char * const   ),&_Func_localfunction_thismodule_13_34_3_0x60_function_d813ea0e9631f4a6>>();
+	};
+	// _Func_localfunction_thismodule_14_34_4_0x60_function_1b1c908878e2c38a
+	aotLib[0x7e16eb294055dce5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint64_t (*) ( Context * __context__, char * const   ),&_Func_localfunction_thismodule_14_34_4_0x60_function_1b1c908878e2c38a>>();
+	};
+	// _Func_localfunction_thismodule_15_34_5_0x60_function_4eb18f3f56c241a
+	aotLib[0xb96ccd778bf4f0b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float (*) ( Context * __context__, char * const   ),&_Func_localfunction_thismodule_15_34_5_0x60_function_4eb18f3f56c241a>>();
+	};
+	// _Func_localfunction_thismodule_16_34_6_0x60_function_a218e58f38c49c8
+	aotLib[0xf386b99d4fe87619] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<double (*) ( Context * __context__, char * const   ),&_Func_localfunction_thismodule_16_34_6_0x60_function_a218e58f38c49c8>>();
+	};
+	// test_7eb52e3fd6cdb04f
+	aotLib[0x88b834d918ed44a4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_7eb52e3fd6cdb04f>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,108 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require UnitTest
+#include "unitTest.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15691854681602807235 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline bool on_armor_hit_fx_effect_es_a365b32d6ad267d0 ( Context * __context__, char * const  __visual_armor_hit_dot_effectName_rename_at_4 );
+inline bool test_51dfc88a1b93dd7b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool on_armor_hit_fx_effect_es_a365b32d6ad267d0 ( Context * __context__, char * const  __visual_armor_hit_dot_effectName_rename_at_4 )
+{
+	float3x4 __tm_rename_at_5; das_zero(__tm_rename_at_5);
+	float3x4_identity(das_arg<float3x4>::pass(__tm_rename_at_5));
+	return das_auto_cast<bool>::cast(start_effect(__visual_armor_hit_dot_effectName_rename_at_4,das_arg<float3x4>::pass(__tm_rename_at_5),1.f));
+}
+
+inline bool test_51dfc88a1b93dd7b ( Context * __context__ )
+{
+	DAS_VERIFY((!on_armor_hit_fx_effect_es_a365b32d6ad267d0(__context__,((char *) "test"))));
+	float3x4 __tm_rename_at_12; das_zero(__tm_rename_at_12);
+	float3x4_identity(das_arg<float3x4>::pass(__tm_rename_at_12));
+	start_effect(((char *) "test-test"),das_arg<float3x4>::pass(__tm_rename_at_12),1.f);
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// on_armor_hit_fx_effect_es_a365b32d6ad267d0
+	aotLib[0xb4b337e40b67b5f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, char * const   ),&on_armor_hit_fx_effect_es_a365b32d6ad267d0>>();
+	};
+	// test_51dfc88a1b93dd7b
+	aotLib[0xd5a088c3f0bc79f4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_51dfc88a1b93dd7b>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,5492 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require functional
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_18023163524492816917 {
+
+extern StructInfo __struct_info__bc31bf648a4fd53f;
+extern StructInfo __struct_info__a85847e7150b5eb8;
+extern StructInfo __struct_info__e96d13f924cb0a0d;
+extern StructInfo __struct_info__457a06e6215cbac5;
+extern StructInfo __struct_info__e06853efcc15cee5;
+extern StructInfo __struct_info__e95a96f774b5ed21;
+extern StructInfo __struct_info__92b50408061416b3;
+extern StructInfo __struct_info__2ce346746a0ac39d;
+extern StructInfo __struct_info__47fc2a4c742091d5;
+extern StructInfo __struct_info__69d04685e0a74560;
+extern StructInfo __struct_info__5f8903b3d8aed323;
+extern StructInfo __struct_info__5f8905b3d8aed689;
+extern StructInfo __struct_info__898e7dd97feabbf5;
+extern StructInfo __struct_info__1743555009ae510e;
+extern StructInfo __struct_info__2243015f6b9fdc53;
+extern StructInfo __struct_info__c20bde997ea8ce0c;
+extern StructInfo __struct_info__173fd45009ab4004;
+extern StructInfo __struct_info__a48507c33051b48b;
+extern StructInfo __struct_info__e96d12f924cb085a;
+extern StructInfo __struct_info__6b2f06a43c338f58;
+extern StructInfo __struct_info__d7b9a3ba8861754d;
+extern StructInfo __struct_info__22486cd2ebc9b078;
+extern StructInfo __struct_info__bf6564276a883dd0;
+extern StructInfo __struct_info__1743595009ae57da;
+extern StructInfo __struct_info__f0c3644e1dd3b80a;
+extern StructInfo __struct_info__ca3914c19c51387d;
+extern StructInfo __struct_info__23a9b8787b3aeb3f;
+extern StructInfo __struct_info__1743535009ae4da8;
+extern StructInfo __struct_info__366ee2fedfe092b9;
+extern StructInfo __struct_info__ee404e56325864fc;
+extern StructInfo __struct_info__76faad0f01a00c4b;
+extern StructInfo __struct_info__e6264309573020f1;
+extern StructInfo __struct_info__366edffedfe08da0;
+extern StructInfo __struct_info__1743545009ae4f5b;
+extern StructInfo __struct_info__79929d78926b8fa7;
+extern StructInfo __struct_info__a49d73ae35705aaa;
+extern TypeInfo __type_info__3c6cf2e5c7dde6ad;
+extern TypeInfo __type_info__ebd38f9580aaf596;
+extern TypeInfo __type_info__1198f06e88481148;
+extern TypeInfo __type_info__6cde42349a0dc4e2;
+extern TypeInfo __type_info__cd1cc76c0b5b3a3b;
+extern TypeInfo __type_info__a8f3a4fc49b1f977;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__90f4c07b5a6e390;
+extern TypeInfo __type_info__2fe94926eb8cf0d9;
+extern TypeInfo __type_info__4f1bdf8b4f0601a8;
+extern TypeInfo __type_info__7478fdc114c254be;
+extern TypeInfo __type_info__bc40da34bfd9f5ff;
+extern TypeInfo __type_info__ecf20d246ea2da8d;
+extern TypeInfo __type_info__2f475a6f20815946;
+extern TypeInfo __type_info__b72dfbdc59493992;
+extern TypeInfo __type_info__2a6ca4b563f875a3;
+extern TypeInfo __type_info__a1b1f7687b7fc012;
+extern TypeInfo __type_info__6794cf34222edd2b;
+extern TypeInfo __type_info__af63df4c8601f1a5;
+extern TypeInfo __type_info__1c031d28e891379a;
+extern TypeInfo __type_info__2e782afea9b10540;
+extern TypeInfo __type_info__ce32da0418ebc6d6;
+extern TypeInfo __type_info__1dfcb9675860dcfc;
+extern TypeInfo __type_info__be112fe42453df14;
+extern TypeInfo __type_info__60d5936f4e638ac2;
+extern TypeInfo __type_info__877b7ef8a083a14d;
+extern TypeInfo __type_info__230ec6e68c66775c;
+extern TypeInfo __type_info__d6ada678229fa84;
+extern TypeInfo __type_info__15b5672770fd3027;
+extern TypeInfo __type_info__76536af0b3b31538;
+extern TypeInfo __type_info__af63db4c8601ead9;
+extern TypeInfo __type_info__185ee399728dead3;
+extern TypeInfo __type_info__c0cb38a461eda129;
+extern TypeInfo __type_info__4db90dc5fb10ec13;
+extern TypeInfo __type_info__561b702296a83038;
+extern TypeInfo __type_info__fd3623f6e384d1fc;
+extern TypeInfo __type_info__7e6855f89b4191ef;
+extern TypeInfo __type_info__b25e1bb1a5322a06;
+extern TypeInfo __type_info__b29301ae75415d99;
+extern TypeInfo __type_info__7be087906ac5ce63;
+extern TypeInfo __type_info__b69bd28e2d842dd9;
+extern TypeInfo __type_info__6a3930e350d8b9e7;
+extern TypeInfo __type_info__e732f984707a7444;
+extern TypeInfo __type_info__387198ea4805b6c5;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__c6da56122d36aaea;
+extern TypeInfo __type_info__25a520ad1b30fd9;
+extern TypeInfo __type_info__34421b571f99edfd;
+extern TypeInfo __type_info__da4249a84c6b6676;
+extern TypeInfo __type_info__7f1bcfa1de88e6ed;
+extern TypeInfo __type_info__d727cf470ebcdf10;
+extern TypeInfo __type_info__53c59994f551fa0a;
+extern TypeInfo __type_info__a52e7c07602356af;
+extern TypeInfo __type_info__70a81b3f032e03aa;
+extern TypeInfo __type_info__ade9b1523a00b747;
+extern TypeInfo __type_info__db27357fa3eaaa3e;
+extern TypeInfo __type_info__ad5ae31b901fa5d1;
+extern TypeInfo __type_info__be0705f80ec4dc07;
+extern TypeInfo __type_info__cb7308b44d3f8ad6;
+extern TypeInfo __type_info__8875b5a4bb8f230d;
+extern TypeInfo __type_info__fe5a5d63abb87972;
+extern TypeInfo __type_info__7bf5307b489d850;
+extern TypeInfo __type_info__7e7953f89b5001bc;
+extern TypeInfo __type_info__dc109ea7c63e48a;
+extern TypeInfo __type_info__8eea9764bc67c160;
+extern TypeInfo __type_info__ff3972fdddb91dec;
+extern TypeInfo __type_info__ebd3969580ab017b;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern TypeInfo __type_info__ab77db4aa00841a;
+extern TypeInfo __type_info__80dd745abd5652a4;
+extern TypeInfo __type_info__6eaa4ee09cf6186c;
+extern TypeInfo __type_info__7e7cd5f89b531479;
+extern TypeInfo __type_info__bd650e7b2b33be23;
+extern TypeInfo __type_info__64be5dc860f5ba81;
+extern TypeInfo __type_info__d85a88cb0811b649;
+extern TypeInfo __type_info__acf481f9d180d4ea;
+extern TypeInfo __type_info__b7347bdc594e7ec0;
+extern TypeInfo __type_info__be14b1e42456f1d1;
+extern TypeInfo __type_info__2feb34e5d3529432;
+extern TypeInfo __type_info__3c724274ce6fd088;
+extern TypeInfo __type_info__eaa81096831f6030;
+extern TypeInfo __type_info__6dc3a106a88db057;
+extern TypeInfo __type_info__8c109174916e450c;
+extern TypeInfo __type_info__31552b1055a4b99e;
+extern TypeInfo __type_info__f115a91bb8be6d87;
+extern TypeInfo __type_info__7bf5e07b489eb01;
+extern TypeInfo __type_info__e0e54947cf742a95;
+extern TypeInfo __type_info__a177731b62cb70ec;
+extern TypeInfo __type_info__bbbb40b84cc1be8d;
+extern TypeInfo __type_info__5f97da61fb7344c5;
+extern TypeInfo __type_info__40f0563f55af18bb;
+extern TypeInfo __type_info__f7ec7d284ff120e4;
+extern TypeInfo __type_info__289c16574f003020;
+extern TypeInfo __type_info__acfe83f9d1892cd5;
+extern TypeInfo __type_info__aacae256c3713dd6;
+extern TypeInfo __type_info__d579d48436105d0b;
+extern TypeInfo __type_info__7e75d5f89b4cf5cb;
+extern TypeInfo __type_info__48dc519e0431cc1c;
+extern TypeInfo __type_info__de08c93623814fb7;
+extern TypeInfo __type_info__3ceb21b1e6727087;
+extern TypeInfo __type_info__2c1eae6fb4c32392;
+extern TypeInfo __type_info__6c9108b7732f1af7;
+extern TypeInfo __type_info__b26665b98547da46;
+extern VarInfo __var_info__95097913d8c9a606;
+extern VarInfo __var_info__9faf4e1c1adc9dd1;
+extern VarInfo __var_info__1d770815a53c04bb;
+extern VarInfo __var_info__d0c438e07c16dcb5;
+extern VarInfo __var_info__41231575836789c2;
+extern VarInfo __var_info__35c2487ba7ef17fe;
+extern VarInfo __var_info__4ab95a7c317fa2de;
+extern VarInfo __var_info__fe3d081b660c6e7b;
+extern VarInfo __var_info__12e982af3775fae3;
+extern VarInfo __var_info__1873c8a855f79b6e;
+extern VarInfo __var_info__a37a3c165ae7832c;
+extern VarInfo __var_info__ac02cfd09037e57;
+extern VarInfo __var_info__c213154ac11a2dcc;
+extern VarInfo __var_info__898d1eb9d23a75d7;
+extern VarInfo __var_info__6b4521e7fd2ebe2f;
+extern VarInfo __var_info__a4bccc0ed934e5c9;
+extern VarInfo __var_info__2cb9aa944b8ef1b3;
+extern VarInfo __var_info__b464c5bdbd7a130b;
+extern VarInfo __var_info__897bb4368f829982;
+extern VarInfo __var_info__371637f723fd59d1;
+extern VarInfo __var_info__1ad75405a467fd15;
+extern VarInfo __var_info__78645d3e211d16f4;
+extern VarInfo __var_info__67d84515ff43695;
+extern VarInfo __var_info__83a240376fba7081;
+extern VarInfo __var_info__c7d609c58cc11315;
+extern VarInfo __var_info__68ef825d703ef71;
+extern VarInfo __var_info__7bfdb89e4b590691;
+extern VarInfo __var_info__537c6d5ffaf9692a;
+extern VarInfo __var_info__ab3a58fc3117cb4e;
+extern VarInfo __var_info__fdd2746267d2c809;
+extern VarInfo __var_info__5ba65153a93c6a2f;
+extern VarInfo __var_info__6a08a50c5c0db60a;
+extern VarInfo __var_info__f5dc27165de2f399;
+extern VarInfo __var_info__e1ed5cefcddbeb30;
+extern VarInfo __var_info__a0171bc0f8854128;
+extern VarInfo __var_info__1ed134c32a1f50a5;
+extern VarInfo __var_info__62da62c08251ad55;
+extern VarInfo __var_info__30e23e45df954d4b;
+extern VarInfo __var_info__e580f363d7a18d2;
+extern VarInfo __var_info__7e47d08137f74379;
+extern VarInfo __var_info__3bf2dc2b5c1215a;
+extern VarInfo __var_info__feafe9e27e51081b;
+extern VarInfo __var_info__8797e91dbbd7cc1d;
+extern VarInfo __var_info__be85c60ad0237b62;
+extern VarInfo __var_info__bbe94c5171af218d;
+extern VarInfo __var_info__2b26f00c9f1f8fc9;
+extern VarInfo __var_info__5136ccb418dde17b;
+extern VarInfo __var_info__6f9fa2b60d3e80df;
+extern VarInfo __var_info__b09d39a1455a86fb;
+extern VarInfo __var_info__ed5415ff51555740;
+extern VarInfo __var_info__a56319fc1b731951;
+extern VarInfo __var_info__76840e7f9dafabc3;
+extern VarInfo __var_info__157dd1a46e60a6e9;
+extern VarInfo __var_info__99cdc6fd055b9a5b;
+extern VarInfo __var_info__82a035dddb61418;
+extern VarInfo __var_info__ad07be719b3aa1a5;
+extern VarInfo __var_info__e0ab72d649936481;
+extern VarInfo __var_info__aac9369c197d5649;
+extern VarInfo __var_info__e27dc4c062dc47a4;
+extern VarInfo __var_info__7cfae91f69fc3d9;
+extern VarInfo __var_info__9ce73ac1ed50da6d;
+extern VarInfo __var_info__948779044d80fec3;
+extern VarInfo __var_info__6054875315d987a1;
+extern VarInfo __var_info__2458bfbb07d8c6d0;
+extern VarInfo __var_info__bf9493d0b2f0be00;
+extern VarInfo __var_info__ab6d31d2f97e4af7;
+extern VarInfo __var_info__6375f2921bd56be5;
+extern VarInfo __var_info__832290ce4c3b78df;
+extern VarInfo __var_info__66afd6417fa18235;
+extern VarInfo __var_info__163dcaf95ed08777;
+extern VarInfo __var_info__bc76fe9107390716;
+extern VarInfo __var_info__9223ab46decd43db;
+extern VarInfo __var_info__4037491be402e7dc;
+extern VarInfo __var_info__1ad74305a467e032;
+extern VarInfo __var_info__f36e0c86f50e735c;
+extern VarInfo __var_info__78df872dbd51dfb3;
+extern VarInfo __var_info__f53397247a56b545;
+extern VarInfo __var_info__d494a76e2edd1910;
+extern VarInfo __var_info__f1f1094e9689c328;
+extern VarInfo __var_info__905392d1129959f5;
+extern VarInfo __var_info__991dd422f0c17fe9;
+extern VarInfo __var_info__4fa697303724052c;
+extern VarInfo __var_info__aed2074595e0777a;
+extern VarInfo __var_info__44f9d2d40a46ea36;
+extern VarInfo __var_info__81938ad16aacacc6;
+extern VarInfo __var_info__b026655373c1087;
+extern VarInfo __var_info__5bfe33da07321ca0;
+extern VarInfo __var_info__6f5cb03c59af98ed;
+extern VarInfo __var_info__3d73060effc14244;
+extern VarInfo __var_info__6deeb8339a632378;
+extern VarInfo __var_info__45ea83d3054cb475;
+extern VarInfo __var_info__9f1479c51ff7caaa;
+extern VarInfo __var_info__818b334628890f2d;
+extern VarInfo __var_info__b9b727d7bba08ca8;
+extern VarInfo __var_info__ac359d27050c5f00;
+extern VarInfo __var_info__8cc8f0abc3db6e4f;
+extern VarInfo __var_info__be54eece67686ec1;
+extern VarInfo __var_info__f7ee46e1bcd59f84;
+extern VarInfo __var_info__f8cefcec84dc5a29;
+extern VarInfo __var_info__93b964ec7ad58454;
+extern VarInfo __var_info__8b3b768da817dba2;
+extern VarInfo __var_info__f20dd0af259bb5c9;
+extern VarInfo __var_info__231a1f3163e7dc36;
+extern VarInfo __var_info__ec26e76da39561d5;
+extern VarInfo __var_info__ff6211d224168632;
+extern VarInfo __var_info__c136ef23591a4ad1;
+extern VarInfo __var_info__5444c3f5adffa911;
+extern VarInfo __var_info__5facc252a7dcade5;
+extern VarInfo __var_info__7d26b512c5e363ff;
+extern VarInfo __var_info__b5a1d18006486e34;
+extern VarInfo __var_info__7f814b0819b7668c;
+extern VarInfo __var_info__1f48c8b904d5503;
+extern VarInfo __var_info__ac59981b9015d82d;
+extern VarInfo __var_info__122c87a5ad47aba1;
+extern VarInfo __var_info__87972290f7741d36;
+extern VarInfo __var_info__1e82045e6ea2140;
+extern VarInfo __var_info__1e65be642d25562e;
+extern VarInfo __var_info__4258a41421462d3;
+extern VarInfo __var_info__49d76b94f9b4ef52;
+extern VarInfo __var_info__d80749743c69bf50;
+extern VarInfo __var_info__6e0b4988804ad6b8;
+extern VarInfo __var_info__a07d9a8c63bd952c;
+extern VarInfo __var_info__3a99fc763b36bbe6;
+extern VarInfo __var_info__e20ef7ef257d39ea;
+extern VarInfo __var_info__dc2a748afab4266b;
+extern VarInfo __var_info__9e065e59db76f854;
+extern VarInfo __var_info__ca393ac68b11b641;
+extern VarInfo __var_info__9abfbd5359fea4a9;
+extern VarInfo __var_info__dc593d7378e45729;
+extern VarInfo __var_info__f9b5a6442a826f3a;
+extern VarInfo __var_info__ffdb5433e02d3217;
+extern VarInfo __var_info__bf06151889a0f864;
+extern VarInfo __var_info__800fccae2dafff6d;
+extern VarInfo __var_info__8058880d30e89f33;
+extern VarInfo __var_info__bf91dac1c0424d3e;
+extern VarInfo __var_info__c145a61aa5ecee30;
+extern VarInfo __var_info__5f33efcf236c505f;
+extern VarInfo __var_info__5d004f3a7ea79b7;
+extern VarInfo __var_info__7391abfefd6316ec;
+extern VarInfo __var_info__1444690d84e23dce;
+extern VarInfo __var_info__6edfdcdc50b73c6d;
+extern VarInfo __var_info__2b3f4342556f7e01;
+extern VarInfo __var_info__ae654662ea95624f;
+extern VarInfo __var_info__57bb36efad57442b;
+extern VarInfo __var_info__f17fbc91307fb4ad;
+extern VarInfo __var_info__ee24fbe32338f0a8;
+extern VarInfo __var_info__6ecb0f443ca8f3c0;
+extern VarInfo __var_info__2fbc78f773d7401d;
+extern VarInfo __var_info__347d7050bf525b84;
+extern VarInfo __var_info__abadc2ee138856cb;
+extern VarInfo __var_info__7bac14dce6b97f79;
+extern VarInfo __var_info__c692fab658a2ce97;
+extern VarInfo __var_info__4760267365f86032;
+extern VarInfo __var_info__b614d294a5ded023;
+extern VarInfo __var_info__cd26af3866590474;
+extern VarInfo __var_info__9e81c6e3a7ba927e;
+extern VarInfo __var_info__f86d83b5ca51c3ea;
+extern VarInfo __var_info__4830feddba5e014e;
+extern VarInfo __var_info__41aa78d84739c1c7;
+extern VarInfo __var_info__e36c59adb16278e0;
+extern VarInfo __var_info__cf5c33e33c49929a;
+extern VarInfo __var_info__84f207feddc48571;
+extern VarInfo __var_info__7160bb0c10662731;
+extern VarInfo __var_info__a49a49c3fd0a8446;
+extern VarInfo __var_info__45455872f6f037a;
+extern VarInfo __var_info__bfc98ab803ed9d82;
+extern VarInfo __var_info__eff1d041c451a868;
+extern VarInfo __var_info__c2977d0a60befee7;
+extern VarInfo __var_info__375056677c1f74a3;
+extern VarInfo __var_info__ab7550fe797dc16a;
+extern VarInfo __var_info__fcdb742ff91db1c1;
+extern VarInfo __var_info__fbcc151a65f17740;
+extern VarInfo __var_info__fe998d9d0f6bc528;
+extern VarInfo __var_info__b52cf84bf8e283c0;
+extern VarInfo __var_info__54411c6b38a28dd5;
+extern VarInfo __var_info__ac35ae27050c7be3;
+extern VarInfo __var_info__368b60f81ba8e635;
+extern VarInfo __var_info__f19741651e90cef1;
+extern VarInfo __var_info__72f5717b3bf020d7;
+extern VarInfo __var_info__8387c2d6dcaed554;
+extern VarInfo __var_info__adaedadacd0f085f;
+extern VarInfo __var_info__4761f0b3c6e47a8a;
+extern VarInfo __var_info__d2a7f8e63673c022;
+extern VarInfo __var_info__8d473e4f1ce92dfe;
+extern VarInfo __var_info__749acbacc93fc07c;
+extern VarInfo __var_info__48c4d8a6c320c20;
+extern VarInfo __var_info__70e48adb22814621;
+extern VarInfo __var_info__bd50b74f615831e9;
+extern VarInfo __var_info__8892acbbf6998612;
+extern VarInfo __var_info__ae984b4a2a657ad7;
+extern VarInfo __var_info__c8b67a30d00b1caa;
+extern VarInfo __var_info__8e22436da23cb23d;
+extern VarInfo __var_info__5f2380a2c7a44fb9;
+extern VarInfo __var_info__36fbc9b846da90d7;
+extern VarInfo __var_info__2267d7b2c69e338;
+extern VarInfo __var_info__66afc5417fa16552;
+extern VarInfo __var_info__ac41e8bd3cbf4ede;
+extern VarInfo __var_info__b66247b3756707db;
+extern VarInfo __var_info__93ff79d4ff5841eb;
+extern VarInfo __var_info__f46e34f491e167e3;
+extern VarInfo __var_info__7095e673cd21edc4;
+extern VarInfo __var_info__6521a8783973c7c9;
+extern VarInfo __var_info__393619cede13c908;
+extern VarInfo __var_info__597bcb3d9aa72afd;
+extern VarInfo __var_info__16796673da7414ca;
+extern VarInfo __var_info__ecc2047731861164;
+extern VarInfo __var_info__3512e3fe9267cced;
+extern VarInfo __var_info__7a9b50bc0a2db157;
+extern VarInfo __var_info__c3fbeaac879ce632;
+extern VarInfo __var_info__e57ac08dd74e8745;
+extern VarInfo __var_info__1bd5e7672cedea36;
+extern VarInfo __var_info__e600a40d6be6f72f;
+extern VarInfo __var_info__c2f5d90eba080c3d;
+extern VarInfo __var_info__adc9c6d905f2d2ff;
+extern VarInfo __var_info__5697acd26dc5f8fe;
+extern VarInfo __var_info__27c2ade1f0b016d8;
+extern VarInfo __var_info__e762ab09a3f51b17;
+extern VarInfo __var_info__5d418d0654bd23cb;
+extern VarInfo __var_info__b46cb50d5f520605;
+extern VarInfo __var_info__46fcef6ab54163d9;
+extern VarInfo __var_info__6578f543d644cb07;
+extern VarInfo __var_info__d17e81dc4873c953;
+extern VarInfo __var_info__589ef7d16f645296;
+extern VarInfo __var_info__588e13bb234da5e7;
+extern VarInfo __var_info__dd0898ced9a07c76;
+extern VarInfo __var_info__a4bc273a4f6f9e6f;
+extern VarInfo __var_info__2f554df5aa41a39c;
+extern VarInfo __var_info__770a3ee43868cd44;
+extern VarInfo __var_info__bcd51b7900f91916;
+extern VarInfo __var_info__75b6cfa209f981ce;
+extern VarInfo __var_info__b7a0b6874528c2f5;
+extern VarInfo __var_info__c27c02167ddba684;
+extern VarInfo __var_info__a4aa293da3c04d67;
+extern VarInfo __var_info__2508bc17acf0a66a;
+extern VarInfo __var_info__11d56358b0659031;
+extern VarInfo __var_info__f5db623078e901eb;
+extern VarInfo __var_info__4b683374b4b91f6b;
+extern VarInfo __var_info__1c065fb77cbdeed4;
+extern VarInfo __var_info__c5d5dfa2c166d0bb;
+extern VarInfo __var_info__1c8a3c4c73d07c76;
+extern VarInfo __var_info__1e8688891df1d4b6;
+extern VarInfo __var_info__c75e4bd4ae46f7f6;
+extern VarInfo __var_info__746bb02146de3942;
+extern VarInfo __var_info__3b686ed80504e925;
+extern VarInfo __var_info__ca6ab96203a999a1;
+extern VarInfo __var_info__527d4d4089b4faa7;
+extern VarInfo __var_info__f8ab8e8bcae5f4c0;
+extern VarInfo __var_info__df2773d8d4f7fc57;
+extern VarInfo __var_info__525157ac5b2e5776;
+extern VarInfo __var_info__3f939f26ce246836;
+extern VarInfo __var_info__b8aa2266b59867ec;
+extern VarInfo __var_info__9b1cd299e7625f53;
+extern VarInfo __var_info__63d47077158a3190;
+extern VarInfo __var_info__6c5038a240a45167;
+extern VarInfo __var_info__defc66e2747a5923;
+extern VarInfo __var_info__7aefb0706a098634;
+extern VarInfo __var_info__6bb0f926bf66015;
+extern VarInfo __var_info__b2a19359ea5385b0;
+extern VarInfo __var_info__1f2814e9177d3688;
+extern FuncInfo __func_info__7e09640bf63233b;
+extern FuncInfo __func_info__d38a664a1724371c;
+
+TypeInfo * __type_info__a37a3c165ae7832c_arg_types_var_13560830391527396671[2] = { &__type_info__da4249a84c6b6676, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__bc31bf648a4fd53f_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__a37a3c165ae7832c_arg_types_var_13560830391527396671, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xa37a3c165ae7832c), "__lambda", 0 };
+TypeInfo * __type_info__a4bccc0ed934e5c9_arg_types_var_13560830391527396671[1] = { &__type_info__b25e1bb1a5322a06 };
+VarInfo __struct_info__bc31bf648a4fd53f_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__a4bccc0ed934e5c9_arg_types_var_13560830391527396671, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xa4bccc0ed934e5c9), "__finalize", 8 };
+VarInfo __struct_info__bc31bf648a4fd53f_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x393619cede13c908), "__yield", 16 };
+VarInfo __struct_info__bc31bf648a4fd53f_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x7391abfefd6316ec), "count", 20 };
+VarInfo __struct_info__bc31bf648a4fd53f_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xe580f363d7a18d2), "value", 24 };
+VarInfo __struct_info__bc31bf648a4fd53f_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x371637f723fd59d1), "_loop_at_183", 28 };
+VarInfo __struct_info__bc31bf648a4fd53f_field_6 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x6b4521e7fd2ebe2f), "x", 32 };
+VarInfo __struct_info__bc31bf648a4fd53f_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xd0c438e07c16dcb5), "_pvar_0_at_183", 40 };
+VarInfo __struct_info__bc31bf648a4fd53f_field_8 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x5f2380a2c7a44fb9), "_source_0_at_183", 48 };
+VarInfo * __struct_info__bc31bf648a4fd53f_fields[9] =  { &__struct_info__bc31bf648a4fd53f_field_0, &__struct_info__bc31bf648a4fd53f_field_1, &__struct_info__bc31bf648a4fd53f_field_2, &__struct_info__bc31bf648a4fd53f_field_3, &__struct_info__bc31bf648a4fd53f_field_4, &__struct_info__bc31bf648a4fd53f_field_5, &__struct_info__bc31bf648a4fd53f_field_6, &__struct_info__bc31bf648a4fd53f_field_7, &__struct_info__bc31bf648a4fd53f_field_8 };
+StructInfo __struct_info__bc31bf648a4fd53f = {"_lambda_thismodule_180_8_3", "", 14, __struct_info__bc31bf648a4fd53f_fields, 9, 56, UINT64_C(0x0), nullptr, UINT64_C(0xbc31bf648a4fd53f) };
+TypeInfo * __type_info__991dd422f0c17fe9_arg_types_var_12130524654138515128[2] = { &__type_info__bd650e7b2b33be23, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__a85847e7150b5eb8_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__991dd422f0c17fe9_arg_types_var_12130524654138515128, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x991dd422f0c17fe9), "__lambda", 0 };
+TypeInfo * __type_info__eff1d041c451a868_arg_types_var_12130524654138515128[1] = { &__type_info__be0705f80ec4dc07 };
+VarInfo __struct_info__a85847e7150b5eb8_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__eff1d041c451a868_arg_types_var_12130524654138515128, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xeff1d041c451a868), "__finalize", 8 };
+VarInfo * __struct_info__a85847e7150b5eb8_fields[2] =  { &__struct_info__a85847e7150b5eb8_field_0, &__struct_info__a85847e7150b5eb8_field_1 };
+StructInfo __struct_info__a85847e7150b5eb8 = {"_lambda_thismodule_180_30_18", "", 6, __struct_info__a85847e7150b5eb8_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xa85847e7150b5eb8) };
+TypeInfo * __type_info__3f939f26ce246836_arg_types_var_16820122144083741197[2] = { &__type_info__be112fe42453df14, &__type_info__7478fdc114c254be };
+VarInfo __struct_info__e96d13f924cb0a0d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__3f939f26ce246836_arg_types_var_16820122144083741197, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x3f939f26ce246836), "__lambda", 0 };
+TypeInfo * __type_info__948779044d80fec3_arg_types_var_16820122144083741197[1] = { &__type_info__76536af0b3b31538 };
+VarInfo __struct_info__e96d13f924cb0a0d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__948779044d80fec3_arg_types_var_16820122144083741197, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x948779044d80fec3), "__finalize", 8 };
+VarInfo __struct_info__e96d13f924cb0a0d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x746bb02146de3942), "__yield", 16 };
+VarInfo __struct_info__e96d13f924cb0a0d_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__15b5672770fd3027, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x36fbc9b846da90d7), "src", 24 };
+VarInfo __struct_info__e96d13f924cb0a0d_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__c6da56122d36aaea, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xbfc98ab803ed9d82), "arr", 32 };
+VarInfo __struct_info__e96d13f924cb0a0d_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x54411c6b38a28dd5), "___loop_at_137_rename_at_137", 56 };
+VarInfo __struct_info__e96d13f924cb0a0d_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c6da56122d36aaea, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x6e0b4988804ad6b8), "__x_rename_at_137", 64 };
+VarInfo __struct_info__e96d13f924cb0a0d_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xca6ab96203a999a1), "___pvar_0_at_137_rename_at_137", 72 };
+VarInfo __struct_info__e96d13f924cb0a0d_field_8 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xb52cf84bf8e283c0), "_loop_at_133", 80 };
+VarInfo __struct_info__e96d13f924cb0a0d_field_9 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__15b5672770fd3027, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xcd26af3866590474), "_source_0_at_133", 88 };
+VarInfo __struct_info__e96d13f924cb0a0d_field_10 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xbd50b74f615831e9), "x", 96 };
+VarInfo __struct_info__e96d13f924cb0a0d_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xfe998d9d0f6bc528), "_pvar_0_at_133", 120 };
+VarInfo __struct_info__e96d13f924cb0a0d_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__ce32da0418ebc6d6, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x6375f2921bd56be5), "___source_0_at_137_rename_at_137", 128 };
+VarInfo * __struct_info__e96d13f924cb0a0d_fields[13] =  { &__struct_info__e96d13f924cb0a0d_field_0, &__struct_info__e96d13f924cb0a0d_field_1, &__struct_info__e96d13f924cb0a0d_field_2, &__struct_info__e96d13f924cb0a0d_field_3, &__struct_info__e96d13f924cb0a0d_field_4, &__struct_info__e96d13f924cb0a0d_field_5, &__struct_info__e96d13f924cb0a0d_field_6, &__struct_info__e96d13f924cb0a0d_field_7, &__struct_info__e96d13f924cb0a0d_field_8, &__struct_info__e96d13f924cb0a0d_field_9, &__struct_info__e96d13f924cb0a0d_field_10, &__struct_info__e96d13f924cb0a0d_field_11, &__struct_info__e96d13f924cb0a0d_field_12 };
+StructInfo __struct_info__e96d13f924cb0a0d = {"_lambda_thismodule_132_12_29", "", 30, __struct_info__e96d13f924cb0a0d_fields, 13, 136, UINT64_C(0x0), nullptr, UINT64_C(0xe96d13f924cb0a0d) };
+TypeInfo * __type_info__ac41e8bd3cbf4ede_arg_types_var_5006321521247697605[2] = { &__type_info__2f475a6f20815946, &__type_info__c6da56122d36aaea };
+VarInfo __struct_info__457a06e6215cbac5_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__ac41e8bd3cbf4ede_arg_types_var_5006321521247697605, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xac41e8bd3cbf4ede), "__lambda", 0 };
+TypeInfo * __type_info__99cdc6fd055b9a5b_arg_types_var_5006321521247697605[1] = { &__type_info__d6ada678229fa84 };
+VarInfo __struct_info__457a06e6215cbac5_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__99cdc6fd055b9a5b_arg_types_var_5006321521247697605, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x99cdc6fd055b9a5b), "__finalize", 8 };
+VarInfo __struct_info__457a06e6215cbac5_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xe20ef7ef257d39ea), "__yield", 16 };
+VarInfo __struct_info__457a06e6215cbac5_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x87972290f7741d36), "_loop_at_90", 20 };
+VarInfo __struct_info__457a06e6215cbac5_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa56319fc1b731951), "x", 24 };
+VarInfo __struct_info__457a06e6215cbac5_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8d473e4f1ce92dfe), "_pvar_0_at_90", 32 };
+VarInfo __struct_info__457a06e6215cbac5_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x8b3b768da817dba2), "_source_0_at_90", 40 };
+VarInfo * __struct_info__457a06e6215cbac5_fields[7] =  { &__struct_info__457a06e6215cbac5_field_0, &__struct_info__457a06e6215cbac5_field_1, &__struct_info__457a06e6215cbac5_field_2, &__struct_info__457a06e6215cbac5_field_3, &__struct_info__457a06e6215cbac5_field_4, &__struct_info__457a06e6215cbac5_field_5, &__struct_info__457a06e6215cbac5_field_6 };
+StructInfo __struct_info__457a06e6215cbac5 = {"_lambda_thismodule_90_14_11", "", 14, __struct_info__457a06e6215cbac5_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x457a06e6215cbac5) };
+TypeInfo * __type_info__9e81c6e3a7ba927e_arg_types_var_16170266751460036325[2] = { &__type_info__db27357fa3eaaa3e, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__e06853efcc15cee5_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__9e81c6e3a7ba927e_arg_types_var_16170266751460036325, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x9e81c6e3a7ba927e), "__lambda", 0 };
+TypeInfo * __type_info__b09d39a1455a86fb_arg_types_var_16170266751460036325[1] = { &__type_info__8c109174916e450c };
+VarInfo __struct_info__e06853efcc15cee5_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__b09d39a1455a86fb_arg_types_var_16170266751460036325, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xb09d39a1455a86fb), "__finalize", 8 };
+VarInfo __struct_info__e06853efcc15cee5_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x6a08a50c5c0db60a), "__yield", 16 };
+VarInfo __struct_info__e06853efcc15cee5_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xf1f1094e9689c328), "_loop_at_227", 20 };
+VarInfo __struct_info__e06853efcc15cee5_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x84f207feddc48571), "x", 24 };
+VarInfo __struct_info__e06853efcc15cee5_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xb2a19359ea5385b0), "_pvar_0_at_227", 32 };
+VarInfo __struct_info__e06853efcc15cee5_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xecc2047731861164), "_source_0_at_227", 40 };
+VarInfo * __struct_info__e06853efcc15cee5_fields[7] =  { &__struct_info__e06853efcc15cee5_field_0, &__struct_info__e06853efcc15cee5_field_1, &__struct_info__e06853efcc15cee5_field_2, &__struct_info__e06853efcc15cee5_field_3, &__struct_info__e06853efcc15cee5_field_4, &__struct_info__e06853efcc15cee5_field_5, &__struct_info__e06853efcc15cee5_field_6 };
+StructInfo __struct_info__e06853efcc15cee5 = {"_lambda_thismodule_227_19_7", "", 14, __struct_info__e06853efcc15cee5_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0xe06853efcc15cee5) };
+TypeInfo * __type_info__2508bc17acf0a66a_arg_types_var_16814918148300336417[2] = { &__type_info__3c724274ce6fd088, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__e95a96f774b5ed21_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__2508bc17acf0a66a_arg_types_var_16814918148300336417, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x2508bc17acf0a66a), "__lambda", 0 };
+TypeInfo * __type_info__adc9c6d905f2d2ff_arg_types_var_16814918148300336417[1] = { &__type_info__fd3623f6e384d1fc };
+VarInfo __struct_info__e95a96f774b5ed21_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__adc9c6d905f2d2ff_arg_types_var_16814918148300336417, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xadc9c6d905f2d2ff), "__finalize", 8 };
+VarInfo * __struct_info__e95a96f774b5ed21_fields[2] =  { &__struct_info__e95a96f774b5ed21_field_0, &__struct_info__e95a96f774b5ed21_field_1 };
+StructInfo __struct_info__e95a96f774b5ed21 = {"_lambda_thismodule_163_30_16", "", 6, __struct_info__e95a96f774b5ed21_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xe95a96f774b5ed21) };
+TypeInfo * __type_info__c145a61aa5ecee30_arg_types_var_10571360132830336691[2] = { &__type_info__2feb34e5d3529432, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__92b50408061416b3_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, (TypeInfo **)__type_info__c145a61aa5ecee30_arg_types_var_10571360132830336691, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xc145a61aa5ecee30), "__lambda", 0 };
+TypeInfo * __type_info__ec26e76da39561d5_arg_types_var_10571360132830336691[1] = { &__type_info__a1b1f7687b7fc012 };
+VarInfo __struct_info__92b50408061416b3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__ec26e76da39561d5_arg_types_var_10571360132830336691, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xec26e76da39561d5), "__finalize", 8 };
+VarInfo * __struct_info__92b50408061416b3_fields[2] =  { &__struct_info__92b50408061416b3_field_0, &__struct_info__92b50408061416b3_field_1 };
+StructInfo __struct_info__92b50408061416b3 = {"_lambda_thismodule_85_28_1", "", 6, __struct_info__92b50408061416b3_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x92b50408061416b3) };
+TypeInfo * __type_info__3a99fc763b36bbe6_arg_types_var_3234506423191389085[2] = { &__type_info__561b702296a83038, &__type_info__c6da56122d36aaea };
+VarInfo __struct_info__2ce346746a0ac39d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__3a99fc763b36bbe6_arg_types_var_3234506423191389085, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x3a99fc763b36bbe6), "__lambda", 0 };
+TypeInfo * __type_info__9b1cd299e7625f53_arg_types_var_3234506423191389085[1] = { &__type_info__eaa81096831f6030 };
+VarInfo __struct_info__2ce346746a0ac39d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__9b1cd299e7625f53_arg_types_var_3234506423191389085, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x9b1cd299e7625f53), "__finalize", 8 };
+VarInfo __struct_info__2ce346746a0ac39d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x4760267365f86032), "__yield", 16 };
+VarInfo __struct_info__2ce346746a0ac39d_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xdefc66e2747a5923), "_loop_at_240", 20 };
+VarInfo __struct_info__2ce346746a0ac39d_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x46fcef6ab54163d9), "x", 24 };
+VarInfo __struct_info__2ce346746a0ac39d_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x93ff79d4ff5841eb), "_pvar_0_at_240", 32 };
+VarInfo __struct_info__2ce346746a0ac39d_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x7d26b512c5e363ff), "_source_0_at_240", 40 };
+VarInfo * __struct_info__2ce346746a0ac39d_fields[7] =  { &__struct_info__2ce346746a0ac39d_field_0, &__struct_info__2ce346746a0ac39d_field_1, &__struct_info__2ce346746a0ac39d_field_2, &__struct_info__2ce346746a0ac39d_field_3, &__struct_info__2ce346746a0ac39d_field_4, &__struct_info__2ce346746a0ac39d_field_5, &__struct_info__2ce346746a0ac39d_field_6 };
+StructInfo __struct_info__2ce346746a0ac39d = {"_lambda_thismodule_240_10_12", "", 14, __struct_info__2ce346746a0ac39d_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x2ce346746a0ac39d) };
+TypeInfo * __type_info__4830feddba5e014e_arg_types_var_5187067378678141397[2] = { &__type_info__1198f06e88481148, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__47fc2a4c742091d5_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__4830feddba5e014e_arg_types_var_5187067378678141397, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x4830feddba5e014e), "__lambda", 0 };
+TypeInfo * __type_info__f5db623078e901eb_arg_types_var_5187067378678141397[1] = { &__type_info__f7ec7d284ff120e4 };
+VarInfo __struct_info__47fc2a4c742091d5_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__f5db623078e901eb_arg_types_var_5187067378678141397, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xf5db623078e901eb), "__finalize", 8 };
+VarInfo __struct_info__47fc2a4c742091d5_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xcf5c33e33c49929a), "__yield", 16 };
+VarInfo __struct_info__47fc2a4c742091d5_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x6f9fa2b60d3e80df), "src", 24 };
+VarInfo __struct_info__47fc2a4c742091d5_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xf86d83b5ca51c3ea), "arr", 32 };
+VarInfo __struct_info__47fc2a4c742091d5_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x6bb0f926bf66015), "___loop_at_125_rename_at_125", 56 };
+VarInfo __struct_info__47fc2a4c742091d5_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x375056677c1f74a3), "__x_rename_at_125", 64 };
+VarInfo __struct_info__47fc2a4c742091d5_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x11d56358b0659031), "___pvar_0_at_125_rename_at_125", 72 };
+VarInfo __struct_info__47fc2a4c742091d5_field_8 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x5136ccb418dde17b), "_loop_at_121", 80 };
+VarInfo __struct_info__47fc2a4c742091d5_field_9 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xadaedadacd0f085f), "_source_0_at_121", 88 };
+VarInfo __struct_info__47fc2a4c742091d5_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xe0ab72d649936481), "x", 96 };
+VarInfo __struct_info__47fc2a4c742091d5_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xf46e34f491e167e3), "_pvar_0_at_121", 104 };
+VarInfo __struct_info__47fc2a4c742091d5_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__7bf5307b489d850, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x905392d1129959f5), "___source_0_at_125_rename_at_125", 112 };
+VarInfo * __struct_info__47fc2a4c742091d5_fields[13] =  { &__struct_info__47fc2a4c742091d5_field_0, &__struct_info__47fc2a4c742091d5_field_1, &__struct_info__47fc2a4c742091d5_field_2, &__struct_info__47fc2a4c742091d5_field_3, &__struct_info__47fc2a4c742091d5_field_4, &__struct_info__47fc2a4c742091d5_field_5, &__struct_info__47fc2a4c742091d5_field_6, &__struct_info__47fc2a4c742091d5_field_7, &__struct_info__47fc2a4c742091d5_field_8, &__struct_info__47fc2a4c742091d5_field_9, &__struct_info__47fc2a4c742091d5_field_10, &__struct_info__47fc2a4c742091d5_field_11, &__struct_info__47fc2a4c742091d5_field_12 };
+StructInfo __struct_info__47fc2a4c742091d5 = {"_lambda_thismodule_120_12_20", "", 30, __struct_info__47fc2a4c742091d5_fields, 13, 120, UINT64_C(0x0), nullptr, UINT64_C(0x47fc2a4c742091d5) };
+TypeInfo * __type_info__ca393ac68b11b641_arg_types_var_7624671709951903072[2] = { &__type_info__25a520ad1b30fd9, &__type_info__a52e7c07602356af };
+VarInfo __struct_info__69d04685e0a74560_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__ca393ac68b11b641_arg_types_var_7624671709951903072, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xca393ac68b11b641), "__lambda", 0 };
+TypeInfo * __type_info__2458bfbb07d8c6d0_arg_types_var_7624671709951903072[1] = { &__type_info__d579d48436105d0b };
+VarInfo __struct_info__69d04685e0a74560_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__2458bfbb07d8c6d0_arg_types_var_7624671709951903072, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x2458bfbb07d8c6d0), "__finalize", 8 };
+VarInfo * __struct_info__69d04685e0a74560_fields[2] =  { &__struct_info__69d04685e0a74560_field_0, &__struct_info__69d04685e0a74560_field_1 };
+StructInfo __struct_info__69d04685e0a74560 = {"_lambda_thismodule_91_25_26", "", 6, __struct_info__69d04685e0a74560_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x69d04685e0a74560) };
+TypeInfo * __type_info__1e82045e6ea2140_arg_types_var_6884037576381879075[2] = { &__type_info__b72dfbdc59493992, &__type_info__7478fdc114c254be };
+VarInfo __struct_info__5f8903b3d8aed323_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__1e82045e6ea2140_arg_types_var_6884037576381879075, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x1e82045e6ea2140), "__lambda", 0 };
+TypeInfo * __type_info__f53397247a56b545_arg_types_var_6884037576381879075[1] = { &__type_info__31552b1055a4b99e };
+VarInfo __struct_info__5f8903b3d8aed323_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__f53397247a56b545_arg_types_var_6884037576381879075, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xf53397247a56b545), "__finalize", 8 };
+VarInfo __struct_info__5f8903b3d8aed323_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x78645d3e211d16f4), "__yield", 16 };
+VarInfo __struct_info__5f8903b3d8aed323_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__6794cf34222edd2b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x45ea83d3054cb475), "src", 24 };
+VarInfo __struct_info__5f8903b3d8aed323_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x5d418d0654bd23cb), "start", 32 };
+VarInfo __struct_info__5f8903b3d8aed323_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x7cfae91f69fc3d9), "stop", 36 };
+VarInfo __struct_info__5f8903b3d8aed323_field_6 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x63d47077158a3190), "_loop_at_153", 40 };
+VarInfo __struct_info__5f8903b3d8aed323_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__6794cf34222edd2b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x48c4d8a6c320c20), "_source_0_at_153", 48 };
+VarInfo __struct_info__5f8903b3d8aed323_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__15b5672770fd3027, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xac35ae27050c7be3), "x", 56 };
+VarInfo __struct_info__5f8903b3d8aed323_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8387c2d6dcaed554), "_pvar_0_at_153", 64 };
+VarInfo __struct_info__5f8903b3d8aed323_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xac359d27050c5f00), "i", 72 };
+VarInfo __struct_info__5f8903b3d8aed323_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x68ef825d703ef71), "_pvar_1_at_153", 80 };
+VarInfo __struct_info__5f8903b3d8aed323_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x3512e3fe9267cced), "_source_1_at_153", 88 };
+VarInfo * __struct_info__5f8903b3d8aed323_fields[13] =  { &__struct_info__5f8903b3d8aed323_field_0, &__struct_info__5f8903b3d8aed323_field_1, &__struct_info__5f8903b3d8aed323_field_2, &__struct_info__5f8903b3d8aed323_field_3, &__struct_info__5f8903b3d8aed323_field_4, &__struct_info__5f8903b3d8aed323_field_5, &__struct_info__5f8903b3d8aed323_field_6, &__struct_info__5f8903b3d8aed323_field_7, &__struct_info__5f8903b3d8aed323_field_8, &__struct_info__5f8903b3d8aed323_field_9, &__struct_info__5f8903b3d8aed323_field_10, &__struct_info__5f8903b3d8aed323_field_11, &__struct_info__5f8903b3d8aed323_field_12 };
+StructInfo __struct_info__5f8903b3d8aed323 = {"_lambda_thismodule_153_12_33", "", 14, __struct_info__5f8903b3d8aed323_fields, 13, 96, UINT64_C(0x0), nullptr, UINT64_C(0x5f8903b3d8aed323) };
+TypeInfo * __type_info__be85c60ad0237b62_arg_types_var_6884039775405135497[2] = { &__type_info__b7347bdc594e7ec0, &__type_info__d727cf470ebcdf10 };
+VarInfo __struct_info__5f8905b3d8aed689_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__be85c60ad0237b62_arg_types_var_6884039775405135497, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xbe85c60ad0237b62), "__lambda", 0 };
+TypeInfo * __type_info__a4aa293da3c04d67_arg_types_var_6884039775405135497[1] = { &__type_info__2e782afea9b10540 };
+VarInfo __struct_info__5f8905b3d8aed689_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__a4aa293da3c04d67_arg_types_var_6884039775405135497, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xa4aa293da3c04d67), "__finalize", 8 };
+VarInfo __struct_info__5f8905b3d8aed689_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x81938ad16aacacc6), "__yield", 16 };
+VarInfo __struct_info__5f8905b3d8aed689_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__ecf20d246ea2da8d, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x76840e7f9dafabc3), "src", 24 };
+VarInfo __struct_info__5f8905b3d8aed689_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xad07be719b3aa1a5), "start", 32 };
+VarInfo __struct_info__5f8905b3d8aed689_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xdf2773d8d4f7fc57), "stop", 36 };
+VarInfo __struct_info__5f8905b3d8aed689_field_6 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x1bd5e7672cedea36), "_loop_at_153", 40 };
+VarInfo __struct_info__5f8905b3d8aed689_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__ecf20d246ea2da8d, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x45455872f6f037a), "_source_0_at_153", 48 };
+VarInfo __struct_info__5f8905b3d8aed689_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b69bd28e2d842dd9, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x1ad75405a467fd15), "x", 56 };
+VarInfo __struct_info__5f8905b3d8aed689_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x1c8a3c4c73d07c76), "_pvar_0_at_153", 64 };
+VarInfo __struct_info__5f8905b3d8aed689_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x1ad74305a467e032), "i", 72 };
+VarInfo __struct_info__5f8905b3d8aed689_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xd17e81dc4873c953), "_pvar_1_at_153", 80 };
+VarInfo __struct_info__5f8905b3d8aed689_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xae984b4a2a657ad7), "_source_1_at_153", 88 };
+VarInfo * __struct_info__5f8905b3d8aed689_fields[13] =  { &__struct_info__5f8905b3d8aed689_field_0, &__struct_info__5f8905b3d8aed689_field_1, &__struct_info__5f8905b3d8aed689_field_2, &__struct_info__5f8905b3d8aed689_field_3, &__struct_info__5f8905b3d8aed689_field_4, &__struct_info__5f8905b3d8aed689_field_5, &__struct_info__5f8905b3d8aed689_field_6, &__struct_info__5f8905b3d8aed689_field_7, &__struct_info__5f8905b3d8aed689_field_8, &__struct_info__5f8905b3d8aed689_field_9, &__struct_info__5f8905b3d8aed689_field_10, &__struct_info__5f8905b3d8aed689_field_11, &__struct_info__5f8905b3d8aed689_field_12 };
+StructInfo __struct_info__5f8905b3d8aed689 = {"_lambda_thismodule_153_12_31", "", 14, __struct_info__5f8905b3d8aed689_fields, 13, 96, UINT64_C(0x0), nullptr, UINT64_C(0x5f8905b3d8aed689) };
+TypeInfo * __type_info__1873c8a855f79b6e_arg_types_var_9911998202996505589[3] = { &__type_info__1dfcb9675860dcfc, &__type_info__90f5707b5a6f641, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__898e7dd97feabbf5_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f5707b5a6f641, nullptr, (TypeInfo **)__type_info__1873c8a855f79b6e_arg_types_var_9911998202996505589, nullptr, 3, 0, nullptr, 28, 8, UINT64_C(0x1873c8a855f79b6e), "__lambda", 0 };
+TypeInfo * __type_info__b464c5bdbd7a130b_arg_types_var_9911998202996505589[1] = { &__type_info__8eea9764bc67c160 };
+VarInfo __struct_info__898e7dd97feabbf5_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__b464c5bdbd7a130b_arg_types_var_9911998202996505589, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xb464c5bdbd7a130b), "__finalize", 8 };
+VarInfo * __struct_info__898e7dd97feabbf5_fields[2] =  { &__struct_info__898e7dd97feabbf5_field_0, &__struct_info__898e7dd97feabbf5_field_1 };
+StructInfo __struct_info__898e7dd97feabbf5 = {"_lambda_thismodule_115_27_15", "", 6, __struct_info__898e7dd97feabbf5_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x898e7dd97feabbf5) };
+TypeInfo * __type_info__dc2a748afab4266b_arg_types_var_1676277288560120078[2] = { &__type_info__7e75d5f89b4cf5cb, &__type_info__230ec6e68c66775c };
+VarInfo __struct_info__1743555009ae510e_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__dc2a748afab4266b_arg_types_var_1676277288560120078, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xdc2a748afab4266b), "__lambda", 0 };
+TypeInfo * __type_info__16796673da7414ca_arg_types_var_1676277288560120078[1] = { &__type_info__2fe94926eb8cf0d9 };
+VarInfo __struct_info__1743555009ae510e_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__16796673da7414ca_arg_types_var_1676277288560120078, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x16796673da7414ca), "__finalize", 8 };
+VarInfo __struct_info__1743555009ae510e_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x2b3f4342556f7e01), "__yield", 16 };
+TypeInfo * __type_info__3b686ed80504e925_arg_types_var_1676277288560120078[1] = { &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__1743555009ae510e_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__6c9108b7732f1af7, nullptr, (TypeInfo **)__type_info__3b686ed80504e925_arg_types_var_1676277288560120078, nullptr, 1, 0, nullptr, 24576, 8, UINT64_C(0x3b686ed80504e925), "blk", 24 };
+VarInfo __struct_info__1743555009ae510e_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xb9b727d7bba08ca8), "src", 32 };
+VarInfo __struct_info__1743555009ae510e_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xbbe94c5171af218d), "_loop_at_32", 40 };
+VarInfo __struct_info__1743555009ae510e_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x62da62c08251ad55), "_source_0_at_32", 48 };
+VarInfo __struct_info__1743555009ae510e_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xe762ab09a3f51b17), "w", 56 };
+VarInfo __struct_info__1743555009ae510e_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xfcdb742ff91db1c1), "_pvar_0_at_32", 64 };
+VarInfo * __struct_info__1743555009ae510e_fields[9] =  { &__struct_info__1743555009ae510e_field_0, &__struct_info__1743555009ae510e_field_1, &__struct_info__1743555009ae510e_field_2, &__struct_info__1743555009ae510e_field_3, &__struct_info__1743555009ae510e_field_4, &__struct_info__1743555009ae510e_field_5, &__struct_info__1743555009ae510e_field_6, &__struct_info__1743555009ae510e_field_7, &__struct_info__1743555009ae510e_field_8 };
+StructInfo __struct_info__1743555009ae510e = {"_lambda_thismodule_32_12_27", "", 14, __struct_info__1743555009ae510e_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0x1743555009ae510e) };
+TypeInfo * __type_info__d80749743c69bf50_arg_types_var_2468818530068323411[2] = { &__type_info__6eaa4ee09cf6186c, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__2243015f6b9fdc53_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__d80749743c69bf50_arg_types_var_2468818530068323411, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xd80749743c69bf50), "__lambda", 0 };
+TypeInfo * __type_info__b7a0b6874528c2f5_arg_types_var_2468818530068323411[1] = { &__type_info__dc109ea7c63e48a };
+VarInfo __struct_info__2243015f6b9fdc53_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__b7a0b6874528c2f5_arg_types_var_2468818530068323411, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xb7a0b6874528c2f5), "__finalize", 8 };
+VarInfo * __struct_info__2243015f6b9fdc53_fields[2] =  { &__struct_info__2243015f6b9fdc53_field_0, &__struct_info__2243015f6b9fdc53_field_1 };
+StructInfo __struct_info__2243015f6b9fdc53 = {"_lambda_thismodule_71_25_14", "", 6, __struct_info__2243015f6b9fdc53_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x2243015f6b9fdc53) };
+TypeInfo * __type_info__2fbc78f773d7401d_arg_types_var_13982514218938191372[2] = { &__type_info__8875b5a4bb8f230d, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__c20bde997ea8ce0c_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__230ec6e68c66775c, nullptr, (TypeInfo **)__type_info__2fbc78f773d7401d_arg_types_var_13982514218938191372, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x2fbc78f773d7401d), "__lambda", 0 };
+TypeInfo * __type_info__e27dc4c062dc47a4_arg_types_var_13982514218938191372[1] = { &__type_info__a8f3a4fc49b1f977 };
+VarInfo __struct_info__c20bde997ea8ce0c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__e27dc4c062dc47a4_arg_types_var_13982514218938191372, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xe27dc4c062dc47a4), "__finalize", 8 };
+VarInfo * __struct_info__c20bde997ea8ce0c_fields[2] =  { &__struct_info__c20bde997ea8ce0c_field_0, &__struct_info__c20bde997ea8ce0c_field_1 };
+StructInfo __struct_info__c20bde997ea8ce0c = {"_lambda_thismodule_139_28_6", "", 6, __struct_info__c20bde997ea8ce0c_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xc20bde997ea8ce0c) };
+TypeInfo * __type_info__e57ac08dd74e8745_arg_types_var_1675291026629804036[2] = { &__type_info__877b7ef8a083a14d, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__173fd45009ab4004_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__e57ac08dd74e8745_arg_types_var_1675291026629804036, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xe57ac08dd74e8745), "__lambda", 0 };
+TypeInfo * __type_info__749acbacc93fc07c_arg_types_var_1675291026629804036[1] = { &__type_info__f115a91bb8be6d87 };
+VarInfo __struct_info__173fd45009ab4004_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__749acbacc93fc07c_arg_types_var_1675291026629804036, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x749acbacc93fc07c), "__finalize", 8 };
+VarInfo __struct_info__173fd45009ab4004_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x78df872dbd51dfb3), "__yield", 16 };
+TypeInfo * __type_info__5f33efcf236c505f_arg_types_var_1675291026629804036[1] = { &__type_info__a52e7c07602356af };
+VarInfo __struct_info__173fd45009ab4004_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__ebd3969580ab017b, nullptr, (TypeInfo **)__type_info__5f33efcf236c505f_arg_types_var_1675291026629804036, nullptr, 1, 0, nullptr, 24576, 8, UINT64_C(0x5f33efcf236c505f), "blk", 24 };
+VarInfo __struct_info__173fd45009ab4004_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__15b5672770fd3027, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xdd0898ced9a07c76), "src", 32 };
+VarInfo __struct_info__173fd45009ab4004_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xabadc2ee138856cb), "_loop_at_32", 40 };
+VarInfo __struct_info__173fd45009ab4004_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__15b5672770fd3027, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xffdb5433e02d3217), "_source_0_at_32", 48 };
+VarInfo __struct_info__173fd45009ab4004_field_7 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x5facc252a7dcade5), "w", 56 };
+VarInfo __struct_info__173fd45009ab4004_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x4258a41421462d3), "_pvar_0_at_32", 80 };
+VarInfo * __struct_info__173fd45009ab4004_fields[9] =  { &__struct_info__173fd45009ab4004_field_0, &__struct_info__173fd45009ab4004_field_1, &__struct_info__173fd45009ab4004_field_2, &__struct_info__173fd45009ab4004_field_3, &__struct_info__173fd45009ab4004_field_4, &__struct_info__173fd45009ab4004_field_5, &__struct_info__173fd45009ab4004_field_6, &__struct_info__173fd45009ab4004_field_7, &__struct_info__173fd45009ab4004_field_8 };
+StructInfo __struct_info__173fd45009ab4004 = {"_lambda_thismodule_32_12_36", "", 30, __struct_info__173fd45009ab4004_fields, 9, 88, UINT64_C(0x0), nullptr, UINT64_C(0x173fd45009ab4004) };
+TypeInfo * __type_info__6deeb8339a632378_arg_types_var_11854890129033376907[2] = { &__type_info__a177731b62cb70ec, &__type_info__40f0563f55af18bb };
+VarInfo __struct_info__a48507c33051b48b_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__6deeb8339a632378_arg_types_var_11854890129033376907, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x6deeb8339a632378), "__lambda", 0 };
+TypeInfo * __type_info__f17fbc91307fb4ad_arg_types_var_11854890129033376907[1] = { &__type_info__cb7308b44d3f8ad6 };
+VarInfo __struct_info__a48507c33051b48b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__f17fbc91307fb4ad_arg_types_var_11854890129033376907, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xf17fbc91307fb4ad), "__finalize", 8 };
+VarInfo __struct_info__a48507c33051b48b_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x4fa697303724052c), "__yield", 16 };
+VarInfo __struct_info__a48507c33051b48b_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x44f9d2d40a46ea36), "_loop_at_106", 20 };
+VarInfo __struct_info__a48507c33051b48b_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xfeafe9e27e51081b), "x", 24 };
+VarInfo __struct_info__a48507c33051b48b_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x537c6d5ffaf9692a), "_pvar_0_at_106", 32 };
+VarInfo __struct_info__a48507c33051b48b_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x589ef7d16f645296), "_source_0_at_106", 40 };
+VarInfo * __struct_info__a48507c33051b48b_fields[7] =  { &__struct_info__a48507c33051b48b_field_0, &__struct_info__a48507c33051b48b_field_1, &__struct_info__a48507c33051b48b_field_2, &__struct_info__a48507c33051b48b_field_3, &__struct_info__a48507c33051b48b_field_4, &__struct_info__a48507c33051b48b_field_5, &__struct_info__a48507c33051b48b_field_6 };
+StructInfo __struct_info__a48507c33051b48b = {"_lambda_thismodule_106_15_5", "", 14, __struct_info__a48507c33051b48b_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0xa48507c33051b48b) };
+TypeInfo * __type_info__c2977d0a60befee7_arg_types_var_16820121044572112986[2] = { &__type_info__be14b1e42456f1d1, &__type_info__d727cf470ebcdf10 };
+VarInfo __struct_info__e96d12f924cb085a_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__c2977d0a60befee7_arg_types_var_16820121044572112986, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xc2977d0a60befee7), "__lambda", 0 };
+TypeInfo * __type_info__ab3a58fc3117cb4e_arg_types_var_16820121044572112986[1] = { &__type_info__387198ea4805b6c5 };
+VarInfo __struct_info__e96d12f924cb085a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__ab3a58fc3117cb4e_arg_types_var_16820121044572112986, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xab3a58fc3117cb4e), "__finalize", 8 };
+VarInfo __struct_info__e96d12f924cb085a_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xc7d609c58cc11315), "__yield", 16 };
+VarInfo __struct_info__e96d12f924cb085a_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b69bd28e2d842dd9, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x3d73060effc14244), "src", 24 };
+VarInfo __struct_info__e96d12f924cb085a_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__230ec6e68c66775c, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xc2f5d90eba080c3d), "arr", 32 };
+VarInfo __struct_info__e96d12f924cb085a_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x9e065e59db76f854), "___loop_at_137_rename_at_137", 56 };
+VarInfo __struct_info__e96d12f924cb085a_field_6 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__230ec6e68c66775c, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x5d004f3a7ea79b7), "__x_rename_at_137", 64 };
+VarInfo __struct_info__e96d12f924cb085a_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x770a3ee43868cd44), "___pvar_0_at_137_rename_at_137", 72 };
+VarInfo __struct_info__e96d12f924cb085a_field_8 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xf5dc27165de2f399), "_loop_at_133", 80 };
+VarInfo __struct_info__e96d12f924cb085a_field_9 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b69bd28e2d842dd9, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x157dd1a46e60a6e9), "_source_0_at_133", 88 };
+TypeInfo * __type_info__d2a7f8e63673c022_arg_types_var_16820121044572112986[2] = { &__type_info__af63e44c8601fa24, &__type_info__af63db4c8601ead9 };
+VarInfo __struct_info__e96d12f924cb085a_field_10 =  { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__d2a7f8e63673c022_arg_types_var_16820121044572112986, nullptr, 2, 0, nullptr, 30, 8, UINT64_C(0xd2a7f8e63673c022), "x", 96 };
+VarInfo __struct_info__e96d12f924cb085a_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8797e91dbbd7cc1d), "_pvar_0_at_133", 104 };
+VarInfo __struct_info__e96d12f924cb085a_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__4f1bdf8b4f0601a8, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xf8ab8e8bcae5f4c0), "___source_0_at_137_rename_at_137", 112 };
+VarInfo * __struct_info__e96d12f924cb085a_fields[13] =  { &__struct_info__e96d12f924cb085a_field_0, &__struct_info__e96d12f924cb085a_field_1, &__struct_info__e96d12f924cb085a_field_2, &__struct_info__e96d12f924cb085a_field_3, &__struct_info__e96d12f924cb085a_field_4, &__struct_info__e96d12f924cb085a_field_5, &__struct_info__e96d12f924cb085a_field_6, &__struct_info__e96d12f924cb085a_field_7, &__struct_info__e96d12f924cb085a_field_8, &__struct_info__e96d12f924cb085a_field_9, &__struct_info__e96d12f924cb085a_field_10, &__struct_info__e96d12f924cb085a_field_11, &__struct_info__e96d12f924cb085a_field_12 };
+StructInfo __struct_info__e96d12f924cb085a = {"_lambda_thismodule_132_12_28", "", 30, __struct_info__e96d12f924cb085a_fields, 13, 120, UINT64_C(0x0), nullptr, UINT64_C(0xe96d12f924cb085a) };
+TypeInfo * __type_info__fdd2746267d2c809_arg_types_var_7723399188418105176[2] = { &__type_info__bbbb40b84cc1be8d, &__type_info__c6da56122d36aaea };
+VarInfo __struct_info__6b2f06a43c338f58_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__fdd2746267d2c809_arg_types_var_7723399188418105176, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xfdd2746267d2c809), "__lambda", 0 };
+TypeInfo * __type_info__1f2814e9177d3688_arg_types_var_7723399188418105176[1] = { &__type_info__ade9b1523a00b747 };
+VarInfo __struct_info__6b2f06a43c338f58_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__1f2814e9177d3688_arg_types_var_7723399188418105176, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x1f2814e9177d3688), "__finalize", 8 };
+VarInfo __struct_info__6b2f06a43c338f58_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x5ba65153a93c6a2f), "__yield", 16 };
+VarInfo __struct_info__6b2f06a43c338f58_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x8e22436da23cb23d), "_loop_at_56", 20 };
+VarInfo __struct_info__6b2f06a43c338f58_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x2f554df5aa41a39c), "x", 24 };
+VarInfo __struct_info__6b2f06a43c338f58_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x818b334628890f2d), "_pvar_0_at_56", 32 };
+VarInfo __struct_info__6b2f06a43c338f58_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x122c87a5ad47aba1), "_source_0_at_56", 40 };
+VarInfo * __struct_info__6b2f06a43c338f58_fields[7] =  { &__struct_info__6b2f06a43c338f58_field_0, &__struct_info__6b2f06a43c338f58_field_1, &__struct_info__6b2f06a43c338f58_field_2, &__struct_info__6b2f06a43c338f58_field_3, &__struct_info__6b2f06a43c338f58_field_4, &__struct_info__6b2f06a43c338f58_field_5, &__struct_info__6b2f06a43c338f58_field_6 };
+StructInfo __struct_info__6b2f06a43c338f58 = {"_lambda_thismodule_56_21_10", "", 14, __struct_info__6b2f06a43c338f58_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x6b2f06a43c338f58) };
+TypeInfo * __type_info__525157ac5b2e5776_arg_types_var_15544635610393310541[2] = { &__type_info__1c031d28e891379a, &__type_info__230ec6e68c66775c };
+VarInfo __struct_info__d7b9a3ba8861754d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__525157ac5b2e5776_arg_types_var_15544635610393310541, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x525157ac5b2e5776), "__lambda", 0 };
+TypeInfo * __type_info__1f48c8b904d5503_arg_types_var_15544635610393310541[1] = { &__type_info__48dc519e0431cc1c };
+VarInfo __struct_info__d7b9a3ba8861754d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__1f48c8b904d5503_arg_types_var_15544635610393310541, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x1f48c8b904d5503), "__finalize", 8 };
+VarInfo __struct_info__d7b9a3ba8861754d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x897bb4368f829982), "__yield", 16 };
+VarInfo __struct_info__d7b9a3ba8861754d_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x12e982af3775fae3), "_loop_at_235", 20 };
+VarInfo __struct_info__d7b9a3ba8861754d_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf8cefcec84dc5a29), "x", 24 };
+VarInfo __struct_info__d7b9a3ba8861754d_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x4b683374b4b91f6b), "_pvar_0_at_235", 32 };
+VarInfo __struct_info__d7b9a3ba8861754d_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xa4bc273a4f6f9e6f), "_source_0_at_235", 40 };
+VarInfo * __struct_info__d7b9a3ba8861754d_fields[7] =  { &__struct_info__d7b9a3ba8861754d_field_0, &__struct_info__d7b9a3ba8861754d_field_1, &__struct_info__d7b9a3ba8861754d_field_2, &__struct_info__d7b9a3ba8861754d_field_3, &__struct_info__d7b9a3ba8861754d_field_4, &__struct_info__d7b9a3ba8861754d_field_5, &__struct_info__d7b9a3ba8861754d_field_6 };
+StructInfo __struct_info__d7b9a3ba8861754d = {"_lambda_thismodule_235_18_9", "", 14, __struct_info__d7b9a3ba8861754d_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0xd7b9a3ba8861754d) };
+TypeInfo * __type_info__9abfbd5359fea4a9_arg_types_var_2470344048767512696[2] = { &__type_info__7f1bcfa1de88e6ed, &__type_info__7478fdc114c254be };
+VarInfo __struct_info__22486cd2ebc9b078_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__9abfbd5359fea4a9_arg_types_var_2470344048767512696, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x9abfbd5359fea4a9), "__lambda", 0 };
+TypeInfo * __type_info__a0171bc0f8854128_arg_types_var_2470344048767512696[1] = { &__type_info__7be087906ac5ce63 };
+VarInfo __struct_info__22486cd2ebc9b078_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__a0171bc0f8854128_arg_types_var_2470344048767512696, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xa0171bc0f8854128), "__finalize", 8 };
+VarInfo __struct_info__22486cd2ebc9b078_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xae654662ea95624f), "__yield", 16 };
+TypeInfo * __type_info__b66247b3756707db_arg_types_var_2470344048767512696[1] = { &__type_info__a52e7c07602356af };
+VarInfo __struct_info__22486cd2ebc9b078_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__b66247b3756707db_arg_types_var_2470344048767512696, nullptr, 1, 0, nullptr, 24576, 8, UINT64_C(0xb66247b3756707db), "blk", 24 };
+VarInfo __struct_info__22486cd2ebc9b078_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__15b5672770fd3027, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x4761f0b3c6e47a8a), "src", 32 };
+VarInfo __struct_info__22486cd2ebc9b078_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xf20dd0af259bb5c9), "_loop_at_16", 40 };
+VarInfo __struct_info__22486cd2ebc9b078_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__15b5672770fd3027, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x368b60f81ba8e635), "_source_0_at_16", 48 };
+VarInfo __struct_info__22486cd2ebc9b078_field_7 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x70e48adb22814621), "w", 56 };
+VarInfo __struct_info__22486cd2ebc9b078_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x7e47d08137f74379), "_pvar_0_at_16", 80 };
+VarInfo * __struct_info__22486cd2ebc9b078_fields[9] =  { &__struct_info__22486cd2ebc9b078_field_0, &__struct_info__22486cd2ebc9b078_field_1, &__struct_info__22486cd2ebc9b078_field_2, &__struct_info__22486cd2ebc9b078_field_3, &__struct_info__22486cd2ebc9b078_field_4, &__struct_info__22486cd2ebc9b078_field_5, &__struct_info__22486cd2ebc9b078_field_6, &__struct_info__22486cd2ebc9b078_field_7, &__struct_info__22486cd2ebc9b078_field_8 };
+StructInfo __struct_info__22486cd2ebc9b078 = {"_lambda_thismodule_16_12_30", "", 30, __struct_info__22486cd2ebc9b078_fields, 9, 88, UINT64_C(0x0), nullptr, UINT64_C(0x22486cd2ebc9b078) };
+TypeInfo * __type_info__c136ef23591a4ad1_arg_types_var_13791539554345827792[2] = { &__type_info__cd1cc76c0b5b3a3b, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__bf6564276a883dd0_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__c136ef23591a4ad1_arg_types_var_13791539554345827792, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xc136ef23591a4ad1), "__lambda", 0 };
+TypeInfo * __type_info__ed5415ff51555740_arg_types_var_13791539554345827792[1] = { &__type_info__4db90dc5fb10ec13 };
+VarInfo __struct_info__bf6564276a883dd0_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__ed5415ff51555740_arg_types_var_13791539554345827792, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xed5415ff51555740), "__finalize", 8 };
+VarInfo * __struct_info__bf6564276a883dd0_fields[2] =  { &__struct_info__bf6564276a883dd0_field_0, &__struct_info__bf6564276a883dd0_field_1 };
+StructInfo __struct_info__bf6564276a883dd0 = {"_lambda_thismodule_172_30_17", "", 6, __struct_info__bf6564276a883dd0_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xbf6564276a883dd0) };
+TypeInfo * __type_info__6c5038a240a45167_arg_types_var_1676281686606632922[2] = { &__type_info__7e6855f89b4191ef, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__1743595009ae57da_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__6c5038a240a45167_arg_types_var_1676281686606632922, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x6c5038a240a45167), "__lambda", 0 };
+TypeInfo * __type_info__75b6cfa209f981ce_arg_types_var_1676281686606632922[1] = { &__type_info__e0e54947cf742a95 };
+VarInfo __struct_info__1743595009ae57da_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__75b6cfa209f981ce_arg_types_var_1676281686606632922, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x75b6cfa209f981ce), "__finalize", 8 };
+VarInfo __struct_info__1743595009ae57da_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x67d84515ff43695), "__yield", 16 };
+TypeInfo * __type_info__dc593d7378e45729_arg_types_var_1676281686606632922[1] = { &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__1743595009ae57da_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ebd3969580ab017b, nullptr, (TypeInfo **)__type_info__dc593d7378e45729_arg_types_var_1676281686606632922, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xdc593d7378e45729), "blk", 24 };
+VarInfo __struct_info__1743595009ae57da_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x7095e673cd21edc4), "src", 32 };
+VarInfo __struct_info__1743595009ae57da_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xbe54eece67686ec1), "_loop_at_32", 40 };
+VarInfo __struct_info__1743595009ae57da_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x9faf4e1c1adc9dd1), "_source_0_at_32", 48 };
+VarInfo __struct_info__1743595009ae57da_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x1d770815a53c04bb), "w", 56 };
+VarInfo __struct_info__1743595009ae57da_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x6edfdcdc50b73c6d), "_pvar_0_at_32", 64 };
+VarInfo * __struct_info__1743595009ae57da_fields[9] =  { &__struct_info__1743595009ae57da_field_0, &__struct_info__1743595009ae57da_field_1, &__struct_info__1743595009ae57da_field_2, &__struct_info__1743595009ae57da_field_3, &__struct_info__1743595009ae57da_field_4, &__struct_info__1743595009ae57da_field_5, &__struct_info__1743595009ae57da_field_6, &__struct_info__1743595009ae57da_field_7, &__struct_info__1743595009ae57da_field_8 };
+StructInfo __struct_info__1743595009ae57da = {"_lambda_thismodule_32_12_23", "", 14, __struct_info__1743595009ae57da_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0x1743595009ae57da) };
+TypeInfo * __type_info__ab6d31d2f97e4af7_arg_types_var_17348820476231923722[2] = { &__type_info__6a3930e350d8b9e7, &__type_info__a52e7c07602356af };
+VarInfo __struct_info__f0c3644e1dd3b80a_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, (TypeInfo **)__type_info__ab6d31d2f97e4af7_arg_types_var_17348820476231923722, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xab6d31d2f97e4af7), "__lambda", 0 };
+TypeInfo * __type_info__bf91dac1c0424d3e_arg_types_var_17348820476231923722[1] = { &__type_info__3c6cf2e5c7dde6ad };
+VarInfo __struct_info__f0c3644e1dd3b80a_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__bf91dac1c0424d3e_arg_types_var_17348820476231923722, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xbf91dac1c0424d3e), "__finalize", 8 };
+VarInfo * __struct_info__f0c3644e1dd3b80a_fields[2] =  { &__struct_info__f0c3644e1dd3b80a_field_0, &__struct_info__f0c3644e1dd3b80a_field_1 };
+StructInfo __struct_info__f0c3644e1dd3b80a = {"_lambda_thismodule_93_29_35", "", 6, __struct_info__f0c3644e1dd3b80a_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xf0c3644e1dd3b80a) };
+TypeInfo * __type_info__a49a49c3fd0a8446_arg_types_var_14571700891117762685[2] = { &__type_info__ab77db4aa00841a, &__type_info__c6da56122d36aaea };
+VarInfo __struct_info__ca3914c19c51387d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__a49a49c3fd0a8446_arg_types_var_14571700891117762685, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xa49a49c3fd0a8446), "__lambda", 0 };
+TypeInfo * __type_info__2cb9aa944b8ef1b3_arg_types_var_14571700891117762685[1] = { &__type_info__80dd745abd5652a4 };
+VarInfo __struct_info__ca3914c19c51387d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__2cb9aa944b8ef1b3_arg_types_var_14571700891117762685, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x2cb9aa944b8ef1b3), "__finalize", 8 };
+VarInfo __struct_info__ca3914c19c51387d_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x8892acbbf6998612), "__yield", 16 };
+TypeInfo * __type_info__f9b5a6442a826f3a_arg_types_var_14571700891117762685[1] = { &__type_info__a52e7c07602356af };
+VarInfo __struct_info__ca3914c19c51387d_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__5f97da61fb7344c5, nullptr, (TypeInfo **)__type_info__f9b5a6442a826f3a_arg_types_var_14571700891117762685, nullptr, 1, 0, nullptr, 24576, 8, UINT64_C(0xf9b5a6442a826f3a), "blk", 24 };
+VarInfo __struct_info__ca3914c19c51387d_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__6794cf34222edd2b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x6578f543d644cb07), "src", 32 };
+VarInfo __struct_info__ca3914c19c51387d_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x7bfdb89e4b590691), "_loop_at_37", 40 };
+VarInfo __struct_info__ca3914c19c51387d_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__6794cf34222edd2b, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x1ed134c32a1f50a5), "_source_0_at_37", 48 };
+VarInfo __struct_info__ca3914c19c51387d_field_7 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__15b5672770fd3027, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xf7ee46e1bcd59f84), "w", 56 };
+VarInfo __struct_info__ca3914c19c51387d_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x2b26f00c9f1f8fc9), "_pvar_0_at_37", 64 };
+VarInfo * __struct_info__ca3914c19c51387d_fields[9] =  { &__struct_info__ca3914c19c51387d_field_0, &__struct_info__ca3914c19c51387d_field_1, &__struct_info__ca3914c19c51387d_field_2, &__struct_info__ca3914c19c51387d_field_3, &__struct_info__ca3914c19c51387d_field_4, &__struct_info__ca3914c19c51387d_field_5, &__struct_info__ca3914c19c51387d_field_6, &__struct_info__ca3914c19c51387d_field_7, &__struct_info__ca3914c19c51387d_field_8 };
+StructInfo __struct_info__ca3914c19c51387d = {"_lambda_thismodule_37_12_34", "", 14, __struct_info__ca3914c19c51387d_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0xca3914c19c51387d) };
+TypeInfo * __type_info__a07d9a8c63bd952c_arg_types_var_2569787889994623807[2] = { &__type_info__2c1eae6fb4c32392, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__23a9b8787b3aeb3f_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__a07d9a8c63bd952c_arg_types_var_2569787889994623807, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xa07d9a8c63bd952c), "__lambda", 0 };
+TypeInfo * __type_info__6521a8783973c7c9_arg_types_var_2569787889994623807[1] = { &__type_info__b26665b98547da46 };
+VarInfo __struct_info__23a9b8787b3aeb3f_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__6521a8783973c7c9_arg_types_var_2569787889994623807, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x6521a8783973c7c9), "__finalize", 8 };
+VarInfo __struct_info__23a9b8787b3aeb3f_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x7a9b50bc0a2db157), "start", 16 };
+VarInfo __struct_info__23a9b8787b3aeb3f_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x163dcaf95ed08777), "step", 20 };
+VarInfo * __struct_info__23a9b8787b3aeb3f_fields[4] =  { &__struct_info__23a9b8787b3aeb3f_field_0, &__struct_info__23a9b8787b3aeb3f_field_1, &__struct_info__23a9b8787b3aeb3f_field_2, &__struct_info__23a9b8787b3aeb3f_field_3 };
+StructInfo __struct_info__23a9b8787b3aeb3f = {"_lambda_thismodule_163_8_2", "", 6, __struct_info__23a9b8787b3aeb3f_fields, 4, 24, UINT64_C(0x0), nullptr, UINT64_C(0x23a9b8787b3aeb3f) };
+TypeInfo * __type_info__7bac14dce6b97f79_arg_types_var_1676275089536863656[2] = { &__type_info__7e7cd5f89b531479, &__type_info__7bf5e07b489eb01 };
+VarInfo __struct_info__1743535009ae4da8_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__7bac14dce6b97f79_arg_types_var_1676275089536863656, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x7bac14dce6b97f79), "__lambda", 0 };
+TypeInfo * __type_info__27c2ade1f0b016d8_arg_types_var_1676275089536863656[1] = { &__type_info__de08c93623814fb7 };
+VarInfo __struct_info__1743535009ae4da8_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__27c2ade1f0b016d8_arg_types_var_1676275089536863656, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x27c2ade1f0b016d8), "__finalize", 8 };
+VarInfo __struct_info__1743535009ae4da8_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x832290ce4c3b78df), "__yield", 16 };
+TypeInfo * __type_info__30e23e45df954d4b_arg_types_var_1676275089536863656[1] = { &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__1743535009ae4da8_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__ebd38f9580aaf596, nullptr, (TypeInfo **)__type_info__30e23e45df954d4b_arg_types_var_1676275089536863656, nullptr, 1, 0, nullptr, 24576, 8, UINT64_C(0x30e23e45df954d4b), "blk", 24 };
+VarInfo __struct_info__1743535009ae4da8_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xaed2074595e0777a), "src", 32 };
+VarInfo __struct_info__1743535009ae4da8_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x588e13bb234da5e7), "_loop_at_32", 40 };
+VarInfo __struct_info__1743535009ae4da8_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xfe3d081b660c6e7b), "_source_0_at_32", 48 };
+VarInfo __struct_info__1743535009ae4da8_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x7160bb0c10662731), "w", 56 };
+VarInfo __struct_info__1743535009ae4da8_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x72f5717b3bf020d7), "_pvar_0_at_32", 64 };
+VarInfo * __struct_info__1743535009ae4da8_fields[9] =  { &__struct_info__1743535009ae4da8_field_0, &__struct_info__1743535009ae4da8_field_1, &__struct_info__1743535009ae4da8_field_2, &__struct_info__1743535009ae4da8_field_3, &__struct_info__1743535009ae4da8_field_4, &__struct_info__1743535009ae4da8_field_5, &__struct_info__1743535009ae4da8_field_6, &__struct_info__1743535009ae4da8_field_7, &__struct_info__1743535009ae4da8_field_8 };
+StructInfo __struct_info__1743535009ae4da8 = {"_lambda_thismodule_32_12_25", "", 14, __struct_info__1743535009ae4da8_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0x1743535009ae4da8) };
+TypeInfo * __type_info__ff6211d224168632_arg_types_var_3922321909791888057[2] = { &__type_info__acf481f9d180d4ea, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__366ee2fedfe092b9_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__ff6211d224168632_arg_types_var_3922321909791888057, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xff6211d224168632), "__lambda", 0 };
+TypeInfo * __type_info__ac02cfd09037e57_arg_types_var_3922321909791888057[1] = { &__type_info__ff3972fdddb91dec };
+VarInfo __struct_info__366ee2fedfe092b9_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__ac02cfd09037e57_arg_types_var_3922321909791888057, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xac02cfd09037e57), "__finalize", 8 };
+VarInfo __struct_info__366ee2fedfe092b9_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbcd51b7900f91916), "__yield", 16 };
+TypeInfo * __type_info__1444690d84e23dce_arg_types_var_3922321909791888057[1] = { &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__366ee2fedfe092b9_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__1444690d84e23dce_arg_types_var_3922321909791888057, nullptr, 1, 0, nullptr, 24576, 8, UINT64_C(0x1444690d84e23dce), "blk", 24 };
+VarInfo __struct_info__366ee2fedfe092b9_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x8058880d30e89f33), "src", 32 };
+VarInfo __struct_info__366ee2fedfe092b9_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xc8b67a30d00b1caa), "_loop_at_10", 40 };
+VarInfo __struct_info__366ee2fedfe092b9_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x5697acd26dc5f8fe), "_source_0_at_10", 48 };
+VarInfo __struct_info__366ee2fedfe092b9_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x82a035dddb61418), "w", 56 };
+VarInfo __struct_info__366ee2fedfe092b9_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x9f1479c51ff7caaa), "_pvar_0_at_10", 64 };
+VarInfo * __struct_info__366ee2fedfe092b9_fields[9] =  { &__struct_info__366ee2fedfe092b9_field_0, &__struct_info__366ee2fedfe092b9_field_1, &__struct_info__366ee2fedfe092b9_field_2, &__struct_info__366ee2fedfe092b9_field_3, &__struct_info__366ee2fedfe092b9_field_4, &__struct_info__366ee2fedfe092b9_field_5, &__struct_info__366ee2fedfe092b9_field_6, &__struct_info__366ee2fedfe092b9_field_7, &__struct_info__366ee2fedfe092b9_field_8 };
+StructInfo __struct_info__366ee2fedfe092b9 = {"_lambda_thismodule_10_12_22", "", 14, __struct_info__366ee2fedfe092b9_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0x366ee2fedfe092b9) };
+TypeInfo * __type_info__800fccae2dafff6d_arg_types_var_17167807911655138556[2] = { &__type_info__d85a88cb0811b649, &__type_info__a52e7c07602356af };
+VarInfo __struct_info__ee404e56325864fc_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__c6da56122d36aaea, nullptr, (TypeInfo **)__type_info__800fccae2dafff6d_arg_types_var_17167807911655138556, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x800fccae2dafff6d), "__lambda", 0 };
+TypeInfo * __type_info__1c065fb77cbdeed4_arg_types_var_17167807911655138556[1] = { &__type_info__bc40da34bfd9f5ff };
+VarInfo __struct_info__ee404e56325864fc_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__1c065fb77cbdeed4_arg_types_var_17167807911655138556, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x1c065fb77cbdeed4), "__finalize", 8 };
+VarInfo * __struct_info__ee404e56325864fc_fields[2] =  { &__struct_info__ee404e56325864fc_field_0, &__struct_info__ee404e56325864fc_field_1 };
+StructInfo __struct_info__ee404e56325864fc = {"_lambda_thismodule_92_36_32", "", 6, __struct_info__ee404e56325864fc_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0xee404e56325864fc) };
+TypeInfo * __type_info__2267d7b2c69e338_arg_types_var_8573355120616541259[2] = { &__type_info__aacae256c3713dd6, &__type_info__c6da56122d36aaea };
+VarInfo __struct_info__76faad0f01a00c4b_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__2267d7b2c69e338_arg_types_var_8573355120616541259, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x2267d7b2c69e338), "__lambda", 0 };
+TypeInfo * __type_info__9ce73ac1ed50da6d_arg_types_var_8573355120616541259[1] = { &__type_info__60d5936f4e638ac2 };
+VarInfo __struct_info__76faad0f01a00c4b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__9ce73ac1ed50da6d_arg_types_var_8573355120616541259, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x9ce73ac1ed50da6d), "__finalize", 8 };
+VarInfo __struct_info__76faad0f01a00c4b_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xb8aa2266b59867ec), "__yield", 16 };
+VarInfo __struct_info__76faad0f01a00c4b_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x6ecb0f443ca8f3c0), "_loop_at_243", 20 };
+VarInfo __struct_info__76faad0f01a00c4b_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x9223ab46decd43db), "x", 24 };
+VarInfo __struct_info__76faad0f01a00c4b_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xc27c02167ddba684), "_pvar_0_at_243", 32 };
+VarInfo __struct_info__76faad0f01a00c4b_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x5bfe33da07321ca0), "_source_0_at_243", 40 };
+VarInfo * __struct_info__76faad0f01a00c4b_fields[7] =  { &__struct_info__76faad0f01a00c4b_field_0, &__struct_info__76faad0f01a00c4b_field_1, &__struct_info__76faad0f01a00c4b_field_2, &__struct_info__76faad0f01a00c4b_field_3, &__struct_info__76faad0f01a00c4b_field_4, &__struct_info__76faad0f01a00c4b_field_5, &__struct_info__76faad0f01a00c4b_field_6 };
+StructInfo __struct_info__76faad0f01a00c4b = {"_lambda_thismodule_243_18_13", "", 14, __struct_info__76faad0f01a00c4b_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x76faad0f01a00c4b) };
+TypeInfo * __type_info__3bf2dc2b5c1215a_arg_types_var_16584016385234968817[2] = { &__type_info__fe5a5d63abb87972, &__type_info__230ec6e68c66775c };
+VarInfo __struct_info__e6264309573020f1_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__3bf2dc2b5c1215a_arg_types_var_16584016385234968817, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x3bf2dc2b5c1215a), "__lambda", 0 };
+TypeInfo * __type_info__8cc8f0abc3db6e4f_arg_types_var_16584016385234968817[1] = { &__type_info__e732f984707a7444 };
+VarInfo __struct_info__e6264309573020f1_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__8cc8f0abc3db6e4f_arg_types_var_16584016385234968817, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x8cc8f0abc3db6e4f), "__finalize", 8 };
+VarInfo __struct_info__e6264309573020f1_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x35c2487ba7ef17fe), "__yield", 16 };
+VarInfo __struct_info__e6264309573020f1_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x231a1f3163e7dc36), "_loop_at_232", 20 };
+VarInfo __struct_info__e6264309573020f1_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x6f5cb03c59af98ed), "x", 24 };
+VarInfo __struct_info__e6264309573020f1_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xbc76fe9107390716), "_pvar_0_at_232", 32 };
+VarInfo __struct_info__e6264309573020f1_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x41231575836789c2), "_source_0_at_232", 40 };
+VarInfo * __struct_info__e6264309573020f1_fields[7] =  { &__struct_info__e6264309573020f1_field_0, &__struct_info__e6264309573020f1_field_1, &__struct_info__e6264309573020f1_field_2, &__struct_info__e6264309573020f1_field_3, &__struct_info__e6264309573020f1_field_4, &__struct_info__e6264309573020f1_field_5, &__struct_info__e6264309573020f1_field_6 };
+StructInfo __struct_info__e6264309573020f1 = {"_lambda_thismodule_232_10_8", "", 14, __struct_info__e6264309573020f1_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0xe6264309573020f1) };
+TypeInfo * __type_info__83a240376fba7081_arg_types_var_3922318611257003424[2] = { &__type_info__acfe83f9d1892cd5, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__366edffedfe08da0_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__83a240376fba7081_arg_types_var_3922318611257003424, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x83a240376fba7081), "__lambda", 0 };
+TypeInfo * __type_info__d494a76e2edd1910_arg_types_var_3922318611257003424[1] = { &__type_info__6dc3a106a88db057 };
+VarInfo __struct_info__366edffedfe08da0_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__d494a76e2edd1910_arg_types_var_3922318611257003424, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xd494a76e2edd1910), "__finalize", 8 };
+VarInfo __struct_info__366edffedfe08da0_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xb026655373c1087), "__yield", 16 };
+TypeInfo * __type_info__b614d294a5ded023_arg_types_var_3922318611257003424[1] = { &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__366edffedfe08da0_field_3 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63df4c8601f1a5, nullptr, (TypeInfo **)__type_info__b614d294a5ded023_arg_types_var_3922318611257003424, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xb614d294a5ded023), "blk", 24 };
+VarInfo __struct_info__366edffedfe08da0_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x49d76b94f9b4ef52), "src", 32 };
+VarInfo __struct_info__366edffedfe08da0_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x898d1eb9d23a75d7), "_loop_at_10", 40 };
+VarInfo __struct_info__366edffedfe08da0_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xc5d5dfa2c166d0bb), "_source_0_at_10", 48 };
+VarInfo __struct_info__366edffedfe08da0_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaac9369c197d5649), "w", 56 };
+VarInfo __struct_info__366edffedfe08da0_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x41aa78d84739c1c7), "_pvar_0_at_10", 64 };
+VarInfo * __struct_info__366edffedfe08da0_fields[9] =  { &__struct_info__366edffedfe08da0_field_0, &__struct_info__366edffedfe08da0_field_1, &__struct_info__366edffedfe08da0_field_2, &__struct_info__366edffedfe08da0_field_3, &__struct_info__366edffedfe08da0_field_4, &__struct_info__366edffedfe08da0_field_5, &__struct_info__366edffedfe08da0_field_6, &__struct_info__366edffedfe08da0_field_7, &__struct_info__366edffedfe08da0_field_8 };
+StructInfo __struct_info__366edffedfe08da0 = {"_lambda_thismodule_10_12_21", "", 14, __struct_info__366edffedfe08da0_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0x366edffedfe08da0) };
+TypeInfo * __type_info__ee24fbe32338f0a8_arg_types_var_1676276189048491867[2] = { &__type_info__7e7953f89b5001bc, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__1743545009ae4f5b_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__ee24fbe32338f0a8_arg_types_var_1676276189048491867, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xee24fbe32338f0a8), "__lambda", 0 };
+TypeInfo * __type_info__597bcb3d9aa72afd_arg_types_var_1676276189048491867[1] = { &__type_info__70a81b3f032e03aa };
+VarInfo __struct_info__1743545009ae4f5b_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__597bcb3d9aa72afd_arg_types_var_1676276189048491867, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x597bcb3d9aa72afd), "__finalize", 8 };
+VarInfo __struct_info__1743545009ae4f5b_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf36e0c86f50e735c), "__yield", 16 };
+TypeInfo * __type_info__4037491be402e7dc_arg_types_var_1676276189048491867[1] = { &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__1743545009ae4f5b_field_3 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__ebd3969580ab017b, nullptr, (TypeInfo **)__type_info__4037491be402e7dc_arg_types_var_1676276189048491867, nullptr, 1, 0, nullptr, 24576, 8, UINT64_C(0x4037491be402e7dc), "blk", 24 };
+VarInfo __struct_info__1743545009ae4f5b_field_4 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xac59981b9015d82d), "src", 32 };
+VarInfo __struct_info__1743545009ae4f5b_field_5 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xfbcc151a65f17740), "_loop_at_32", 40 };
+VarInfo __struct_info__1743545009ae4f5b_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0xe36c59adb16278e0), "_source_0_at_32", 48 };
+VarInfo __struct_info__1743545009ae4f5b_field_7 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xc3fbeaac879ce632), "w", 56 };
+VarInfo __struct_info__1743545009ae4f5b_field_8 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xb5a1d18006486e34), "_pvar_0_at_32", 64 };
+VarInfo * __struct_info__1743545009ae4f5b_fields[9] =  { &__struct_info__1743545009ae4f5b_field_0, &__struct_info__1743545009ae4f5b_field_1, &__struct_info__1743545009ae4f5b_field_2, &__struct_info__1743545009ae4f5b_field_3, &__struct_info__1743545009ae4f5b_field_4, &__struct_info__1743545009ae4f5b_field_5, &__struct_info__1743545009ae4f5b_field_6, &__struct_info__1743545009ae4f5b_field_7, &__struct_info__1743545009ae4f5b_field_8 };
+StructInfo __struct_info__1743545009ae4f5b = {"_lambda_thismodule_32_12_24", "", 14, __struct_info__1743545009ae4f5b_fields, 9, 72, UINT64_C(0x0), nullptr, UINT64_C(0x1743545009ae4f5b) };
+TypeInfo * __type_info__bf06151889a0f864_arg_types_var_8760237366367195047[2] = { &__type_info__6cde42349a0dc4e2, &__type_info__40f0563f55af18bb };
+VarInfo __struct_info__79929d78926b8fa7_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__bf06151889a0f864_arg_types_var_8760237366367195047, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xbf06151889a0f864), "__lambda", 0 };
+TypeInfo * __type_info__5444c3f5adffa911_arg_types_var_8760237366367195047[1] = { &__type_info__53c59994f551fa0a };
+VarInfo __struct_info__79929d78926b8fa7_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__5444c3f5adffa911_arg_types_var_8760237366367195047, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x5444c3f5adffa911), "__finalize", 8 };
+VarInfo __struct_info__79929d78926b8fa7_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xbf9493d0b2f0be00), "__yield", 16 };
+VarInfo __struct_info__79929d78926b8fa7_field_3 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x7f814b0819b7668c), "_loop_at_50", 20 };
+VarInfo __struct_info__79929d78926b8fa7_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x527d4d4089b4faa7), "x", 24 };
+VarInfo __struct_info__79929d78926b8fa7_field_5 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xe1ed5cefcddbeb30), "_pvar_0_at_50", 32 };
+VarInfo __struct_info__79929d78926b8fa7_field_6 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x347d7050bf525b84), "_source_0_at_50", 40 };
+VarInfo * __struct_info__79929d78926b8fa7_fields[7] =  { &__struct_info__79929d78926b8fa7_field_0, &__struct_info__79929d78926b8fa7_field_1, &__struct_info__79929d78926b8fa7_field_2, &__struct_info__79929d78926b8fa7_field_3, &__struct_info__79929d78926b8fa7_field_4, &__struct_info__79929d78926b8fa7_field_5, &__struct_info__79929d78926b8fa7_field_6 };
+StructInfo __struct_info__79929d78926b8fa7 = {"_lambda_thismodule_50_23_4", "", 14, __struct_info__79929d78926b8fa7_fields, 7, 48, UINT64_C(0x0), nullptr, UINT64_C(0x79929d78926b8fa7) };
+TypeInfo * __type_info__c692fab658a2ce97_arg_types_var_11861764185621813930[2] = { &__type_info__c0cb38a461eda129, &__type_info__7bf5307b489d850 };
+VarInfo __struct_info__a49d73ae35705aaa_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__c692fab658a2ce97_arg_types_var_11861764185621813930, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xc692fab658a2ce97), "__lambda", 0 };
+TypeInfo * __type_info__4ab95a7c317fa2de_arg_types_var_11861764185621813930[1] = { &__type_info__34421b571f99edfd };
+VarInfo __struct_info__a49d73ae35705aaa_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__4ab95a7c317fa2de_arg_types_var_11861764185621813930, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x4ab95a7c317fa2de), "__finalize", 8 };
+VarInfo __struct_info__a49d73ae35705aaa_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xb46cb50d5f520605), "__yield", 16 };
+VarInfo __struct_info__a49d73ae35705aaa_field_3 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x93b964ec7ad58454), "src", 24 };
+VarInfo __struct_info__a49d73ae35705aaa_field_4 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x1e65be642d25562e), "start", 32 };
+VarInfo __struct_info__a49d73ae35705aaa_field_5 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xc75e4bd4ae46f7f6), "stop", 36 };
+VarInfo __struct_info__a49d73ae35705aaa_field_6 =  { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x1e8688891df1d4b6), "_loop_at_147", 40 };
+VarInfo __struct_info__a49d73ae35705aaa_field_7 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__b29301ae75415d99, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x95097913d8c9a606), "_source_0_at_147", 48 };
+VarInfo __struct_info__a49d73ae35705aaa_field_8 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x66afc5417fa16552), "x", 56 };
+VarInfo __struct_info__a49d73ae35705aaa_field_9 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xab7550fe797dc16a), "_pvar_0_at_147", 64 };
+VarInfo __struct_info__a49d73ae35705aaa_field_10 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x66afd6417fa18235), "i", 72 };
+VarInfo __struct_info__a49d73ae35705aaa_field_11 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xe600a40d6be6f72f), "_pvar_1_at_147", 80 };
+VarInfo __struct_info__a49d73ae35705aaa_field_12 =  { Type::tIterator, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 24602, 8, UINT64_C(0x57bb36efad57442b), "_source_1_at_147", 88 };
+VarInfo * __struct_info__a49d73ae35705aaa_fields[13] =  { &__struct_info__a49d73ae35705aaa_field_0, &__struct_info__a49d73ae35705aaa_field_1, &__struct_info__a49d73ae35705aaa_field_2, &__struct_info__a49d73ae35705aaa_field_3, &__struct_info__a49d73ae35705aaa_field_4, &__struct_info__a49d73ae35705aaa_field_5, &__struct_info__a49d73ae35705aaa_field_6, &__struct_info__a49d73ae35705aaa_field_7, &__struct_info__a49d73ae35705aaa_field_8, &__struct_info__a49d73ae35705aaa_field_9, &__struct_info__a49d73ae35705aaa_field_10, &__struct_info__a49d73ae35705aaa_field_11, &__struct_info__a49d73ae35705aaa_field_12 };
+StructInfo __struct_info__a49d73ae35705aaa = {"_lambda_thismodule_147_12_19", "", 14, __struct_info__a49d73ae35705aaa_fields, 13, 96, UINT64_C(0x0), nullptr, UINT64_C(0xa49d73ae35705aaa) };
+TypeInfo * __type_info__f19741651e90cef1_arg_types_var_567618757881701179[2] = { &__type_info__af63e44c8601fa24, &__type_info__af63db4c8601ead9 };
+VarInfo __func_info__7e09640bf63233b_field_0 =  { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__f19741651e90cef1_arg_types_var_567618757881701179, nullptr, 2, 0, nullptr, 62, 8, UINT64_C(0xf19741651e90cef1), "x", 0 };
+TypeInfo * __type_info__7aefb0706a098634_arg_types_var_567618757881701179[2] = { &__type_info__af63e44c8601fa24, &__type_info__af63db4c8601ead9 };
+VarInfo __func_info__7e09640bf63233b_field_1 =  { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__7aefb0706a098634_arg_types_var_567618757881701179, nullptr, 2, 0, nullptr, 62, 8, UINT64_C(0x7aefb0706a098634), "y", 0 };
+VarInfo * __func_info__7e09640bf63233b_fields[2] =  { &__func_info__7e09640bf63233b_field_0, &__func_info__7e09640bf63233b_field_1 };
+FuncInfo __func_info__7e09640bf63233b = {"invoke block<(x:tuple<int;float> const;y:tuple<int;float> const):tuple<int;float> const> const", "", __func_info__7e09640bf63233b_fields, 2, 32, &__type_info__ad5ae31b901fa5d1, nullptr,0,UINT64_C(0x7e09640bf63233b), 0x0 };
+VarInfo __func_info__d38a664a1724371c_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x6054875315d987a1), "x", 0 };
+VarInfo __func_info__d38a664a1724371c_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xc213154ac11a2dcc), "y", 0 };
+VarInfo * __func_info__d38a664a1724371c_fields[2] =  { &__func_info__d38a664a1724371c_field_0, &__func_info__d38a664a1724371c_field_1 };
+FuncInfo __func_info__d38a664a1724371c = {"invoke block<(x:int const;y:int const):int const> const", "", __func_info__d38a664a1724371c_fields, 2, 32, &__type_info__90f5707b5a6f641, nullptr,0,UINT64_C(0xd38a664a1724371c), 0x0 };
+TypeInfo __type_info__3c6cf2e5c7dde6ad = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6a3930e350d8b9e7, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x3c6cf2e5c7dde6ad) };
+TypeInfo __type_info__ebd38f9580aaf596 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xebd38f9580aaf596) };
+TypeInfo __type_info__1198f06e88481148 = { Type::tStructure, &__struct_info__47fc2a4c742091d5, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 120, UINT64_C(0x1198f06e88481148) };
+TypeInfo __type_info__6cde42349a0dc4e2 = { Type::tStructure, &__struct_info__79929d78926b8fa7, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0x6cde42349a0dc4e2) };
+TypeInfo __type_info__cd1cc76c0b5b3a3b = { Type::tStructure, &__struct_info__bf6564276a883dd0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0xcd1cc76c0b5b3a3b) };
+TypeInfo __type_info__a8f3a4fc49b1f977 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__8875b5a4bb8f230d, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xa8f3a4fc49b1f977) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__90f4c07b5a6e390 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, UINT64_C(0x90f4c07b5a6e390) };
+TypeInfo __type_info__2fe94926eb8cf0d9 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7e75d5f89b4cf5cb, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x2fe94926eb8cf0d9) };
+TypeInfo * __type_info__4f1bdf8b4f0601a8_arg_types[2] = { &__type_info__af63e44c8601fa24, &__type_info__af63db4c8601ead9 };
+TypeInfo __type_info__4f1bdf8b4f0601a8 = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__4f1bdf8b4f0601a8_arg_types, nullptr, 2, 0, nullptr, 286, 8, UINT64_C(0x4f1bdf8b4f0601a8) };
+TypeInfo __type_info__7478fdc114c254be = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c6da56122d36aaea, nullptr, nullptr, nullptr, 0, 0, nullptr, 8461, 8, UINT64_C(0x7478fdc114c254be) };
+TypeInfo __type_info__bc40da34bfd9f5ff = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d85a88cb0811b649, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xbc40da34bfd9f5ff) };
+TypeInfo * __type_info__ecf20d246ea2da8d_arg_types[2] = { &__type_info__af63e44c8601fa24, &__type_info__af63db4c8601ead9 };
+TypeInfo __type_info__ecf20d246ea2da8d = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__ecf20d246ea2da8d_arg_types, nullptr, 2, 0, nullptr, 286, 8, UINT64_C(0xecf20d246ea2da8d) };
+TypeInfo __type_info__2f475a6f20815946 = { Type::tStructure, &__struct_info__457a06e6215cbac5, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0x2f475a6f20815946) };
+TypeInfo __type_info__b72dfbdc59493992 = { Type::tStructure, &__struct_info__5f8903b3d8aed323, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 96, UINT64_C(0xb72dfbdc59493992) };
+TypeInfo __type_info__2a6ca4b563f875a3 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x2a6ca4b563f875a3) };
+TypeInfo __type_info__a1b1f7687b7fc012 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2feb34e5d3529432, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xa1b1f7687b7fc012) };
+TypeInfo __type_info__6794cf34222edd2b = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 41218, 24, UINT64_C(0x6794cf34222edd2b) };
+TypeInfo __type_info__af63df4c8601f1a5 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0xaf63df4c8601f1a5) };
+TypeInfo __type_info__1c031d28e891379a = { Type::tStructure, &__struct_info__d7b9a3ba8861754d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0x1c031d28e891379a) };
+TypeInfo __type_info__2e782afea9b10540 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b7347bdc594e7ec0, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x2e782afea9b10540) };
+TypeInfo __type_info__ce32da0418ebc6d6 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 41218, 24, UINT64_C(0xce32da0418ebc6d6) };
+TypeInfo __type_info__1dfcb9675860dcfc = { Type::tStructure, &__struct_info__898e7dd97feabbf5, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0x1dfcb9675860dcfc) };
+TypeInfo __type_info__be112fe42453df14 = { Type::tStructure, &__struct_info__e96d13f924cb0a0d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 136, UINT64_C(0xbe112fe42453df14) };
+TypeInfo __type_info__60d5936f4e638ac2 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__aacae256c3713dd6, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x60d5936f4e638ac2) };
+TypeInfo __type_info__877b7ef8a083a14d = { Type::tStructure, &__struct_info__173fd45009ab4004, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 88, UINT64_C(0x877b7ef8a083a14d) };
+TypeInfo * __type_info__230ec6e68c66775c_arg_types[2] = { &__type_info__af63e44c8601fa24, &__type_info__af63db4c8601ead9 };
+TypeInfo __type_info__230ec6e68c66775c = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__230ec6e68c66775c_arg_types, nullptr, 2, 0, nullptr, 30, 8, UINT64_C(0x230ec6e68c66775c) };
+TypeInfo __type_info__d6ada678229fa84 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f475a6f20815946, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xd6ada678229fa84) };
+TypeInfo __type_info__15b5672770fd3027 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x15b5672770fd3027) };
+TypeInfo __type_info__76536af0b3b31538 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__be112fe42453df14, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x76536af0b3b31538) };
+TypeInfo __type_info__af63db4c8601ead9 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63db4c8601ead9) };
+TypeInfo __type_info__185ee399728dead3 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__2a6ca4b563f875a3, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x185ee399728dead3) };
+TypeInfo __type_info__c0cb38a461eda129 = { Type::tStructure, &__struct_info__a49d73ae35705aaa, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 96, UINT64_C(0xc0cb38a461eda129) };
+TypeInfo __type_info__4db90dc5fb10ec13 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__cd1cc76c0b5b3a3b, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x4db90dc5fb10ec13) };
+TypeInfo __type_info__561b702296a83038 = { Type::tStructure, &__struct_info__2ce346746a0ac39d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0x561b702296a83038) };
+TypeInfo __type_info__fd3623f6e384d1fc = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__3c724274ce6fd088, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xfd3623f6e384d1fc) };
+TypeInfo __type_info__7e6855f89b4191ef = { Type::tStructure, &__struct_info__1743595009ae57da, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 72, UINT64_C(0x7e6855f89b4191ef) };
+TypeInfo __type_info__b25e1bb1a5322a06 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__da4249a84c6b6676, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xb25e1bb1a5322a06) };
+TypeInfo __type_info__b29301ae75415d99 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xb29301ae75415d99) };
+TypeInfo __type_info__7be087906ac5ce63 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7f1bcfa1de88e6ed, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x7be087906ac5ce63) };
+TypeInfo * __type_info__b69bd28e2d842dd9_arg_types[2] = { &__type_info__af63e44c8601fa24, &__type_info__af63db4c8601ead9 };
+TypeInfo __type_info__b69bd28e2d842dd9 = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__b69bd28e2d842dd9_arg_types, nullptr, 2, 0, nullptr, 30, 8, UINT64_C(0xb69bd28e2d842dd9) };
+TypeInfo __type_info__6a3930e350d8b9e7 = { Type::tStructure, &__struct_info__f0c3644e1dd3b80a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0x6a3930e350d8b9e7) };
+TypeInfo __type_info__e732f984707a7444 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fe5a5d63abb87972, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xe732f984707a7444) };
+TypeInfo __type_info__387198ea4805b6c5 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__be14b1e42456f1d1, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x387198ea4805b6c5) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__c6da56122d36aaea = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xc6da56122d36aaea) };
+TypeInfo __type_info__25a520ad1b30fd9 = { Type::tStructure, &__struct_info__69d04685e0a74560, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0x25a520ad1b30fd9) };
+TypeInfo __type_info__34421b571f99edfd = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__c0cb38a461eda129, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x34421b571f99edfd) };
+TypeInfo __type_info__da4249a84c6b6676 = { Type::tStructure, &__struct_info__bc31bf648a4fd53f, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 56, UINT64_C(0xda4249a84c6b6676) };
+TypeInfo __type_info__7f1bcfa1de88e6ed = { Type::tStructure, &__struct_info__22486cd2ebc9b078, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 88, UINT64_C(0x7f1bcfa1de88e6ed) };
+TypeInfo __type_info__d727cf470ebcdf10 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__230ec6e68c66775c, nullptr, nullptr, nullptr, 0, 0, nullptr, 8461, 8, UINT64_C(0xd727cf470ebcdf10) };
+TypeInfo __type_info__53c59994f551fa0a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6cde42349a0dc4e2, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x53c59994f551fa0a) };
+TypeInfo __type_info__a52e7c07602356af = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40994, 24, UINT64_C(0xa52e7c07602356af) };
+TypeInfo __type_info__70a81b3f032e03aa = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7e7953f89b5001bc, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x70a81b3f032e03aa) };
+TypeInfo __type_info__ade9b1523a00b747 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bbbb40b84cc1be8d, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xade9b1523a00b747) };
+TypeInfo __type_info__db27357fa3eaaa3e = { Type::tStructure, &__struct_info__e06853efcc15cee5, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0xdb27357fa3eaaa3e) };
+TypeInfo * __type_info__ad5ae31b901fa5d1_arg_types[2] = { &__type_info__af63e44c8601fa24, &__type_info__af63db4c8601ead9 };
+TypeInfo __type_info__ad5ae31b901fa5d1 = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__ad5ae31b901fa5d1_arg_types, nullptr, 2, 0, nullptr, 62, 8, UINT64_C(0xad5ae31b901fa5d1) };
+TypeInfo __type_info__be0705f80ec4dc07 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__bd650e7b2b33be23, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xbe0705f80ec4dc07) };
+TypeInfo __type_info__cb7308b44d3f8ad6 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__a177731b62cb70ec, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xcb7308b44d3f8ad6) };
+TypeInfo __type_info__8875b5a4bb8f230d = { Type::tStructure, &__struct_info__c20bde997ea8ce0c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0x8875b5a4bb8f230d) };
+TypeInfo __type_info__fe5a5d63abb87972 = { Type::tStructure, &__struct_info__e6264309573020f1, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0xfe5a5d63abb87972) };
+TypeInfo __type_info__7bf5307b489d850 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 4, UINT64_C(0x7bf5307b489d850) };
+TypeInfo __type_info__7e7953f89b5001bc = { Type::tStructure, &__struct_info__1743545009ae4f5b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 72, UINT64_C(0x7e7953f89b5001bc) };
+TypeInfo __type_info__dc109ea7c63e48a = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6eaa4ee09cf6186c, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xdc109ea7c63e48a) };
+TypeInfo __type_info__8eea9764bc67c160 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1dfcb9675860dcfc, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8eea9764bc67c160) };
+TypeInfo __type_info__ff3972fdddb91dec = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__acf481f9d180d4ea, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xff3972fdddb91dec) };
+TypeInfo __type_info__ebd3969580ab017b = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xebd3969580ab017b) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+TypeInfo __type_info__ab77db4aa00841a = { Type::tStructure, &__struct_info__ca3914c19c51387d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 72, UINT64_C(0xab77db4aa00841a) };
+TypeInfo __type_info__80dd745abd5652a4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__ab77db4aa00841a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x80dd745abd5652a4) };
+TypeInfo __type_info__6eaa4ee09cf6186c = { Type::tStructure, &__struct_info__2243015f6b9fdc53, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0x6eaa4ee09cf6186c) };
+TypeInfo __type_info__7e7cd5f89b531479 = { Type::tStructure, &__struct_info__1743535009ae4da8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 72, UINT64_C(0x7e7cd5f89b531479) };
+TypeInfo __type_info__bd650e7b2b33be23 = { Type::tStructure, &__struct_info__a85847e7150b5eb8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0xbd650e7b2b33be23) };
+TypeInfo __type_info__64be5dc860f5ba81 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x64be5dc860f5ba81) };
+TypeInfo __type_info__d85a88cb0811b649 = { Type::tStructure, &__struct_info__ee404e56325864fc, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0xd85a88cb0811b649) };
+TypeInfo __type_info__acf481f9d180d4ea = { Type::tStructure, &__struct_info__366ee2fedfe092b9, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 72, UINT64_C(0xacf481f9d180d4ea) };
+TypeInfo __type_info__b7347bdc594e7ec0 = { Type::tStructure, &__struct_info__5f8905b3d8aed689, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 96, UINT64_C(0xb7347bdc594e7ec0) };
+TypeInfo __type_info__be14b1e42456f1d1 = { Type::tStructure, &__struct_info__e96d12f924cb085a, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 57346, 120, UINT64_C(0xbe14b1e42456f1d1) };
+TypeInfo __type_info__2feb34e5d3529432 = { Type::tStructure, &__struct_info__92b50408061416b3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0x2feb34e5d3529432) };
+TypeInfo __type_info__3c724274ce6fd088 = { Type::tStructure, &__struct_info__e95a96f774b5ed21, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0x3c724274ce6fd088) };
+TypeInfo __type_info__eaa81096831f6030 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__561b702296a83038, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xeaa81096831f6030) };
+TypeInfo __type_info__6dc3a106a88db057 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__acfe83f9d1892cd5, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x6dc3a106a88db057) };
+TypeInfo __type_info__8c109174916e450c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__db27357fa3eaaa3e, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x8c109174916e450c) };
+TypeInfo __type_info__31552b1055a4b99e = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__b72dfbdc59493992, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x31552b1055a4b99e) };
+TypeInfo __type_info__f115a91bb8be6d87 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__877b7ef8a083a14d, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xf115a91bb8be6d87) };
+TypeInfo __type_info__7bf5e07b489eb01 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 285, 1, UINT64_C(0x7bf5e07b489eb01) };
+TypeInfo __type_info__e0e54947cf742a95 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7e6855f89b4191ef, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xe0e54947cf742a95) };
+TypeInfo __type_info__a177731b62cb70ec = { Type::tStructure, &__struct_info__a48507c33051b48b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0xa177731b62cb70ec) };
+TypeInfo __type_info__bbbb40b84cc1be8d = { Type::tStructure, &__struct_info__6b2f06a43c338f58, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0xbbbb40b84cc1be8d) };
+TypeInfo __type_info__5f97da61fb7344c5 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x5f97da61fb7344c5) };
+TypeInfo __type_info__40f0563f55af18bb = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__90f5707b5a6f641, nullptr, nullptr, nullptr, 0, 0, nullptr, 8461, 8, UINT64_C(0x40f0563f55af18bb) };
+TypeInfo __type_info__f7ec7d284ff120e4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1198f06e88481148, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xf7ec7d284ff120e4) };
+TypeInfo __type_info__289c16574f003020 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x289c16574f003020) };
+TypeInfo __type_info__acfe83f9d1892cd5 = { Type::tStructure, &__struct_info__366edffedfe08da0, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 72, UINT64_C(0xacfe83f9d1892cd5) };
+TypeInfo __type_info__aacae256c3713dd6 = { Type::tStructure, &__struct_info__76faad0f01a00c4b, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24586, 48, UINT64_C(0xaacae256c3713dd6) };
+TypeInfo __type_info__d579d48436105d0b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__25a520ad1b30fd9, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xd579d48436105d0b) };
+TypeInfo __type_info__7e75d5f89b4cf5cb = { Type::tStructure, &__struct_info__1743555009ae510e, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 72, UINT64_C(0x7e75d5f89b4cf5cb) };
+TypeInfo __type_info__48dc519e0431cc1c = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__1c031d28e891379a, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0x48dc519e0431cc1c) };
+TypeInfo __type_info__de08c93623814fb7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__7e7cd5f89b531479, nullptr, nullptr, nullptr, 0, 0, nullptr, 24588, 8, UINT64_C(0xde08c93623814fb7) };
+TypeInfo __type_info__3ceb21b1e6727087 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x3ceb21b1e6727087) };
+TypeInfo __type_info__2c1eae6fb4c32392 = { Type::tStructure, &__struct_info__23a9b8787b3aeb3f, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 24, UINT64_C(0x2c1eae6fb4c32392) };
+TypeInfo * __type_info__6c9108b7732f1af7_arg_types[2] = { &__type_info__af63e44c8601fa24, &__type_info__af63db4c8601ead9 };
+TypeInfo __type_info__6c9108b7732f1af7 = { Type::tTuple, nullptr, nullptr, nullptr, nullptr, nullptr, (TypeInfo **)__type_info__6c9108b7732f1af7_arg_types, nullptr, 2, 0, nullptr, 30, 8, UINT64_C(0x6c9108b7732f1af7) };
+TypeInfo __type_info__b26665b98547da46 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2c1eae6fb4c32392, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xb26665b98547da46) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__64be5dc860f5ba81 };
+TypeInfo * __tinfo_1[1] = { &__type_info__289c16574f003020 };
+TypeInfo * __tinfo_2[1] = { &__type_info__185ee399728dead3 };
+TypeInfo * __tinfo_3[1] = { &__type_info__185ee399728dead3 };
+TypeInfo * __tinfo_4[1] = { &__type_info__3ceb21b1e6727087 };
+namespace  { struct _lambda_thismodule_85_28_1; };
+namespace  { struct _lambda_thismodule_163_8_2; };
+namespace  { struct _lambda_thismodule_180_8_3; };
+namespace  { struct _lambda_thismodule_50_23_4; };
+namespace  { struct _lambda_thismodule_106_15_5; };
+namespace  { struct _lambda_thismodule_139_28_6; };
+namespace  { struct _lambda_thismodule_227_19_7; };
+namespace  { struct _lambda_thismodule_232_10_8; };
+namespace  { struct _lambda_thismodule_235_18_9; };
+namespace  { struct _lambda_thismodule_56_21_10; };
+namespace  { struct _lambda_thismodule_90_14_11; };
+namespace  { struct _lambda_thismodule_240_10_12; };
+namespace  { struct _lambda_thismodule_243_18_13; };
+namespace  { struct _lambda_thismodule_71_25_14; };
+namespace  { struct _lambda_thismodule_115_27_15; };
+namespace  { struct _lambda_thismodule_163_30_16; };
+namespace  { struct _lambda_thismodule_172_30_17; };
+namespace  { struct _lambda_thismodule_180_30_18; };
+namespace  { struct _lambda_thismodule_147_12_19; };
+namespace  { struct _lambda_thismodule_120_12_20; };
+namespace  { struct _lambda_thismodule_10_12_21; };
+namespace  { struct _lambda_thismodule_10_12_22; };
+namespace  { struct _lambda_thismodule_32_12_23; };
+namespace  { struct _lambda_thismodule_32_12_24; };
+namespace  { struct _lambda_thismodule_32_12_25; };
+namespace  { struct _lambda_thismodule_91_25_26; };
+namespace  { struct _lambda_thismodule_32_12_27; };
+namespace  { struct _lambda_thismodule_132_12_28; };
+namespace  { struct _lambda_thismodule_132_12_29; };
+namespace  { struct _lambda_thismodule_16_12_30; };
+namespace  { struct _lambda_thismodule_153_12_31; };
+namespace  { struct _lambda_thismodule_92_36_32; };
+namespace  { struct _lambda_thismodule_153_12_33; };
+namespace  { struct _lambda_thismodule_37_12_34; };
+namespace  { struct _lambda_thismodule_93_29_35; };
+namespace  { struct _lambda_thismodule_32_12_36; };
+namespace  {
+
+struct _lambda_thismodule_85_28_1 {
+	Func DAS_COMMENT((int32_t,_lambda_thismodule_85_28_1,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_85_28_1 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_85_28_1)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_85_28_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_85_28_1,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_163_8_2 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_163_8_2,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_163_8_2 *)) __finalize;
+	int32_t start;
+	int32_t step;
+};
+static_assert(sizeof(_lambda_thismodule_163_8_2)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_8_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_8_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_8_2,start)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_8_2,step)==20,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_180_8_3 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_180_8_3,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_180_8_3 *)) __finalize;
+	int32_t __yield;
+	int32_t count;
+	int32_t value;
+	bool _loop_at_183;
+	int32_t x;
+	void * _pvar_0_at_183;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_183;
+};
+static_assert(sizeof(_lambda_thismodule_180_8_3)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_180_8_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_180_8_3,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_180_8_3,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_180_8_3,count)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_180_8_3,value)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_180_8_3,_loop_at_183)==28,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_180_8_3,x)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_180_8_3,_pvar_0_at_183)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_180_8_3,_source_0_at_183)==48,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_50_23_4 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_50_23_4,int32_t const  * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_50_23_4 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_50;
+	int32_t x;
+	void * _pvar_0_at_50;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_50;
+};
+static_assert(sizeof(_lambda_thismodule_50_23_4)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,_loop_at_50)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,_pvar_0_at_50)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_50_23_4,_source_0_at_50)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_106_15_5 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_106_15_5,int32_t const  * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_106_15_5 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_106;
+	int32_t x;
+	void * _pvar_0_at_106;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_106;
+};
+static_assert(sizeof(_lambda_thismodule_106_15_5)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,_loop_at_106)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,_pvar_0_at_106)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_106_15_5,_source_0_at_106)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_139_28_6 {
+	Func DAS_COMMENT((TTuple<8,int32_t,float>,_lambda_thismodule_139_28_6,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_139_28_6 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_139_28_6)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_28_6,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_139_28_6,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_227_19_7 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_227_19_7,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_227_19_7 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_227;
+	int32_t x;
+	void * _pvar_0_at_227;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_227;
+};
+static_assert(sizeof(_lambda_thismodule_227_19_7)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,_loop_at_227)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,_pvar_0_at_227)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_227_19_7,_source_0_at_227)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_232_10_8 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_232_10_8,TTuple<8,int32_t,float>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_232_10_8 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_232;
+	int32_t x;
+	void * _pvar_0_at_232;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_232;
+};
+static_assert(sizeof(_lambda_thismodule_232_10_8)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,_loop_at_232)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,_pvar_0_at_232)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_232_10_8,_source_0_at_232)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_235_18_9 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_235_18_9,TTuple<8,int32_t,float>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_235_18_9 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_235;
+	int32_t x;
+	void * _pvar_0_at_235;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_235;
+};
+static_assert(sizeof(_lambda_thismodule_235_18_9)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,_loop_at_235)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,_pvar_0_at_235)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_235_18_9,_source_0_at_235)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_56_21_10 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_56_21_10,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_56_21_10 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_56;
+	int32_t x;
+	void * _pvar_0_at_56;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_56;
+};
+static_assert(sizeof(_lambda_thismodule_56_21_10)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,_loop_at_56)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,_pvar_0_at_56)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_56_21_10,_source_0_at_56)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_90_14_11 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_90_14_11,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_90_14_11 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_90;
+	int32_t x;
+	void * _pvar_0_at_90;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_90;
+};
+static_assert(sizeof(_lambda_thismodule_90_14_11)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,_loop_at_90)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,_pvar_0_at_90)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_90_14_11,_source_0_at_90)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_240_10_12 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_240_10_12,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_240_10_12 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_240;
+	int32_t x;
+	void * _pvar_0_at_240;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_240;
+};
+static_assert(sizeof(_lambda_thismodule_240_10_12)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,_loop_at_240)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,_pvar_0_at_240)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_240_10_12,_source_0_at_240)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_243_18_13 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_243_18_13,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_243_18_13 *)) __finalize;
+	int32_t __yield;
+	bool _loop_at_243;
+	int32_t x;
+	void * _pvar_0_at_243;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_243;
+};
+static_assert(sizeof(_lambda_thismodule_243_18_13)==48,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,_loop_at_243)==20,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,_pvar_0_at_243)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_243_18_13,_source_0_at_243)==40,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_71_25_14 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_71_25_14,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_71_25_14 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_71_25_14)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_71_25_14,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_71_25_14,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_115_27_15 {
+	Func DAS_COMMENT((int32_t,_lambda_thismodule_115_27_15,int32_t,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_115_27_15 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_115_27_15)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_115_27_15,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_115_27_15,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_163_30_16 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_163_30_16,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_163_30_16 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_163_30_16)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_30_16,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_163_30_16,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_172_30_17 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_172_30_17,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_172_30_17 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_172_30_17)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_172_30_17,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_172_30_17,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_180_30_18 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_180_30_18,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_180_30_18 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_180_30_18)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_180_30_18,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_180_30_18,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_147_12_19 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_147_12_19,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_147_12_19 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((int32_t)) src;
+	int32_t start;
+	int32_t stop;
+	bool _loop_at_147;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_147;
+	int32_t x;
+	void * _pvar_0_at_147;
+	int32_t i;
+	void * _pvar_1_at_147;
+	Sequence DAS_COMMENT((int32_t)) _source_1_at_147;
+};
+static_assert(sizeof(_lambda_thismodule_147_12_19)==96,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_147_12_19,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_147_12_19,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_147_12_19,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_147_12_19,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_147_12_19,start)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_147_12_19,stop)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_147_12_19,_loop_at_147)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_147_12_19,_source_0_at_147)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_147_12_19,x)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_147_12_19,_pvar_0_at_147)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_147_12_19,i)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_147_12_19,_pvar_1_at_147)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_147_12_19,_source_1_at_147)==88,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_120_12_20 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_120_12_20,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_120_12_20 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((int32_t)) src;
+	TArray<int32_t> arr;
+	bool ___loop_at_125_rename_at_125;
+	int32_t * __x_rename_at_125;
+	void * ___pvar_0_at_125_rename_at_125;
+	bool _loop_at_121;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_121;
+	int32_t x;
+	void * _pvar_0_at_121;
+	Sequence DAS_COMMENT((int32_t &)) ___source_0_at_125_rename_at_125;
+};
+static_assert(sizeof(_lambda_thismodule_120_12_20)==120,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_120_12_20,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_120_12_20,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_120_12_20,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_120_12_20,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_120_12_20,arr)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_120_12_20,___loop_at_125_rename_at_125)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_120_12_20,__x_rename_at_125)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_120_12_20,___pvar_0_at_125_rename_at_125)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_120_12_20,_loop_at_121)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_120_12_20,_source_0_at_121)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_120_12_20,x)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_120_12_20,_pvar_0_at_121)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_120_12_20,___source_0_at_125_rename_at_125)==112,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_10_12_21 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_10_12_21,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_10_12_21 *)) __finalize;
+	int32_t __yield;
+	Func DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_10;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_10;
+	int32_t w;
+	void * _pvar_0_at_10;
+};
+static_assert(sizeof(_lambda_thismodule_10_12_21)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_21,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_21,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_21,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_21,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_21,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_21,_loop_at_10)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_21,_source_0_at_10)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_21,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_21,_pvar_0_at_10)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_10_12_22 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_10_12_22,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_10_12_22 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_10;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_10;
+	int32_t w;
+	void * _pvar_0_at_10;
+};
+static_assert(sizeof(_lambda_thismodule_10_12_22)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_22,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_22,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_22,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_22,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_22,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_22,_loop_at_10)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_22,_source_0_at_10)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_22,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_10_12_22,_pvar_0_at_10)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_32_12_23 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_32_12_23,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_32_12_23 *)) __finalize;
+	int32_t __yield;
+	Func DAS_COMMENT((int32_t,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_32;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_32;
+	int32_t w;
+	void * _pvar_0_at_32;
+};
+static_assert(sizeof(_lambda_thismodule_32_12_23)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_23,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_23,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_23,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_23,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_23,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_23,_loop_at_32)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_23,_source_0_at_32)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_23,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_23,_pvar_0_at_32)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_32_12_24 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_32_12_24,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_32_12_24 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((int32_t,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_32;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_32;
+	int32_t w;
+	void * _pvar_0_at_32;
+};
+static_assert(sizeof(_lambda_thismodule_32_12_24)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_24,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_24,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_24,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_24,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_24,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_24,_loop_at_32)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_24,_source_0_at_32)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_24,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_24,_pvar_0_at_32)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_32_12_25 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_32_12_25,bool &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_32_12_25 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_32;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_32;
+	int32_t w;
+	void * _pvar_0_at_32;
+};
+static_assert(sizeof(_lambda_thismodule_32_12_25)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_25,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_25,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_25,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_25,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_25,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_25,_loop_at_32)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_25,_source_0_at_32)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_25,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_25,_pvar_0_at_32)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_91_25_26 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_91_25_26,TArray<int32_t> const )) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_91_25_26 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_91_25_26)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_91_25_26,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_91_25_26,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_32_12_27 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_32_12_27,TTuple<8,int32_t,float>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_32_12_27 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) blk;
+	Sequence DAS_COMMENT((int32_t)) src;
+	bool _loop_at_32;
+	Sequence DAS_COMMENT((int32_t)) _source_0_at_32;
+	int32_t w;
+	void * _pvar_0_at_32;
+};
+static_assert(sizeof(_lambda_thismodule_32_12_27)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_27,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_27,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_27,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_27,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_27,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_27,_loop_at_32)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_27,_source_0_at_32)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_27,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_27,_pvar_0_at_32)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_132_12_28 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_132_12_28,TTuple<8,int32_t,float> * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_132_12_28 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) src;
+	TArray<TTuple<8,int32_t,float>> arr;
+	bool ___loop_at_137_rename_at_137;
+	TTuple<8,int32_t,float> * __x_rename_at_137;
+	void * ___pvar_0_at_137_rename_at_137;
+	bool _loop_at_133;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _source_0_at_133;
+	TTuple<8,int32_t,float> x;
+	void * _pvar_0_at_133;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) ___source_0_at_137_rename_at_137;
+};
+static_assert(sizeof(_lambda_thismodule_132_12_28)==120,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_28,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_28,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_28,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_28,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_28,arr)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_28,___loop_at_137_rename_at_137)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_28,__x_rename_at_137)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_28,___pvar_0_at_137_rename_at_137)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_28,_loop_at_133)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_28,_source_0_at_133)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_28,x)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_28,_pvar_0_at_133)==104,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_28,___source_0_at_137_rename_at_137)==112,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_132_12_29 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_132_12_29,TArray<int32_t> * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_132_12_29 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((TArray<int32_t>)) src;
+	TArray<TArray<int32_t>> arr;
+	bool ___loop_at_137_rename_at_137;
+	TArray<int32_t> * __x_rename_at_137;
+	void * ___pvar_0_at_137_rename_at_137;
+	bool _loop_at_133;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _source_0_at_133;
+	TArray<int32_t> x;
+	void * _pvar_0_at_133;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) ___source_0_at_137_rename_at_137;
+};
+static_assert(sizeof(_lambda_thismodule_132_12_29)==136,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_29,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_29,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_29,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_29,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_29,arr)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_29,___loop_at_137_rename_at_137)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_29,__x_rename_at_137)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_29,___pvar_0_at_137_rename_at_137)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_29,_loop_at_133)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_29,_source_0_at_133)==88,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_29,x)==96,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_29,_pvar_0_at_133)==120,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_132_12_29,___source_0_at_137_rename_at_137)==128,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_16_12_30 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_16_12_30,TArray<int32_t> * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_16_12_30 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((bool,TArray<int32_t> const )) blk;
+	Sequence DAS_COMMENT((TArray<int32_t>)) src;
+	bool _loop_at_16;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _source_0_at_16;
+	TArray<int32_t> w;
+	void * _pvar_0_at_16;
+};
+static_assert(sizeof(_lambda_thismodule_16_12_30)==88,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_12_30,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_12_30,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_12_30,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_12_30,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_12_30,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_12_30,_loop_at_16)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_12_30,_source_0_at_16)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_12_30,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_12_30,_pvar_0_at_16)==80,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_153_12_31 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_153_12_31,TTuple<8,int32_t,float> * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_153_12_31 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) src;
+	int32_t start;
+	int32_t stop;
+	bool _loop_at_153;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _source_0_at_153;
+	TTuple<8,int32_t,float> * x;
+	void * _pvar_0_at_153;
+	int32_t i;
+	void * _pvar_1_at_153;
+	Sequence DAS_COMMENT((int32_t)) _source_1_at_153;
+};
+static_assert(sizeof(_lambda_thismodule_153_12_31)==96,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_31,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_31,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_31,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_31,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_31,start)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_31,stop)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_31,_loop_at_153)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_31,_source_0_at_153)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_31,x)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_31,_pvar_0_at_153)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_31,i)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_31,_pvar_1_at_153)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_31,_source_1_at_153)==88,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_92_36_32 {
+	Func DAS_COMMENT((TArray<int32_t>,_lambda_thismodule_92_36_32,TArray<int32_t> const )) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_92_36_32 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_92_36_32)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_92_36_32,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_92_36_32,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_153_12_33 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_153_12_33,TArray<int32_t> * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_153_12_33 *)) __finalize;
+	int32_t __yield;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) src;
+	int32_t start;
+	int32_t stop;
+	bool _loop_at_153;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) _source_0_at_153;
+	TArray<int32_t> * x;
+	void * _pvar_0_at_153;
+	int32_t i;
+	void * _pvar_1_at_153;
+	Sequence DAS_COMMENT((int32_t)) _source_1_at_153;
+};
+static_assert(sizeof(_lambda_thismodule_153_12_33)==96,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_33,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_33,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_33,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_33,src)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_33,start)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_33,stop)==36,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_33,_loop_at_153)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_33,_source_0_at_153)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_33,x)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_33,_pvar_0_at_153)==64,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_33,i)==72,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_33,_pvar_1_at_153)==80,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_153_12_33,_source_1_at_153)==88,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_37_12_34 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_37_12_34,TArray<int32_t>)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_37_12_34 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) blk;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) src;
+	bool _loop_at_37;
+	Sequence DAS_COMMENT((TArray<int32_t> &)) _source_0_at_37;
+	TArray<int32_t> * w;
+	void * _pvar_0_at_37;
+};
+static_assert(sizeof(_lambda_thismodule_37_12_34)==72,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_12_34,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_12_34,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_12_34,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_12_34,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_12_34,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_12_34,_loop_at_37)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_12_34,_source_0_at_37)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_12_34,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_37_12_34,_pvar_0_at_37)==64,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_93_29_35 {
+	Func DAS_COMMENT((int32_t,_lambda_thismodule_93_29_35,TArray<int32_t> const )) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_93_29_35 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_93_29_35)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_29_35,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_93_29_35,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_32_12_36 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_32_12_36,int32_t &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_32_12_36 *)) __finalize;
+	int32_t __yield;
+	Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) blk;
+	Sequence DAS_COMMENT((TArray<int32_t>)) src;
+	bool _loop_at_32;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _source_0_at_32;
+	TArray<int32_t> w;
+	void * _pvar_0_at_32;
+};
+static_assert(sizeof(_lambda_thismodule_32_12_36)==88,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_36,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_36,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_36,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_36,blk)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_36,src)==32,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_36,_loop_at_32)==40,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_36,_source_0_at_32)==48,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_36,w)==56,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_12_36,_pvar_0_at_32)==80,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_cdc972ff02046fd8 ( Context * __context__, _lambda_thismodule_32_12_36 & ____this_rename_at_32 );
+inline bool _Func_lambda_thismodule_32_12_36_0x60_function_f607d9b61b3cbd65 ( Context * __context__, _lambda_thismodule_32_12_36 & ____this_rename_at_32, int32_t & ___yield_32_rename_at_32 );
+inline void _Func_lambda_thismodule_32_12_36_0x60_finalizer_49b7f8641ea22224 ( Context * __context__, _lambda_thismodule_32_12_36 * ____this_rename_at_32 );
+inline void finalize_a7122cc19257df9a ( Context * __context__, _lambda_thismodule_93_29_35 & ____this_rename_at_93 );
+inline void _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07 ( Context * __context__, TArray<int32_t> & __a_rename_at_31, TArray<int32_t> & __b_rename_at_31 );
+inline int32_t _Func_lambda_thismodule_93_29_35_0x60_function_9952822083039823 ( Context * __context__, _lambda_thismodule_93_29_35 & ____this_rename_at_93, TArray<int32_t> const  & __x_rename_at_93 );
+inline void _Func_lambda_thismodule_93_29_35_0x60_finalizer_77b7ae3fdea0e0ca ( Context * __context__, _lambda_thismodule_93_29_35 * ____this_rename_at_93 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_6f89c8d21fd305a3 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_29, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) __blk_rename_at_29 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_82ad2f6322b2be3d ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_47, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const  __blk_rename_at_47 );
+inline void finalize_3c86c1bfde120dbf ( Context * __context__, _lambda_thismodule_37_12_34 & ____this_rename_at_37 );
+inline bool _Func_lambda_thismodule_37_12_34_0x60_function_f63c018422c49b61 ( Context * __context__, _lambda_thismodule_37_12_34 & ____this_rename_at_37, TArray<int32_t> & ___yield_37_rename_at_37 );
+inline void _Func_lambda_thismodule_37_12_34_0x60_finalizer_d0d84ad0da7c7220 ( Context * __context__, _lambda_thismodule_37_12_34 * ____this_rename_at_37 );
+inline bool _Func_0x60_is_same_b2ee21551accec13 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) const  & __a_rename_at_37, Sequence DAS_COMMENT((TArray<int32_t>)) const  & __b_rename_at_37 );
+inline void finalize_a8708c1dfb490536 ( Context * __context__, _lambda_thismodule_153_12_33 & ____this_rename_at_153 );
+inline bool _Func_0x60_is_same_84e5a5cb0f2aec39 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) const  & __a_rename_at_37, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & __b_rename_at_37 );
+inline void finalize_6d04359a0a5cd8f8 ( Context * __context__, _lambda_thismodule_153_12_31 & ____this_rename_at_153 );
+inline void finalize_3f3f5513ea66b214 ( Context * __context__, _lambda_thismodule_92_36_32 & ____this_rename_at_92 );
+inline bool _Func_lambda_thismodule_153_12_33_0x60_function_9e9637b431e74b6 ( Context * __context__, _lambda_thismodule_153_12_33 & ____this_rename_at_153, TArray<int32_t> * & ___ryield153_rename_at_153 );
+inline void _Func_lambda_thismodule_153_12_33_0x60_finalizer_bb33e00c565f4444 ( Context * __context__, _lambda_thismodule_153_12_33 * ____this_rename_at_153 );
+inline void _Funcbuiltin_0x60_finalize_b509dde46ca14424 ( Context * __context__, TArray<TArray<int32_t>> & __a_rename_at_395 );
+inline bool _Func_lambda_thismodule_153_12_31_0x60_function_80fcd9ca7e3cf082 ( Context * __context__, _lambda_thismodule_153_12_31 & ____this_rename_at_153, TTuple<8,int32_t,float> * & ___ryield153_rename_at_153 );
+inline void _Func_lambda_thismodule_153_12_31_0x60_finalizer_663d1dae9fd024f8 ( Context * __context__, _lambda_thismodule_153_12_31 * ____this_rename_at_153 );
+inline void _Funcbuiltin_0x60_finalize_943699eaf2940908 ( Context * __context__, TArray<TTuple<8,int32_t,float>> & __a_rename_at_395 );
+inline void _Funcbuiltin_0x60_clone_4bc3594d348ca0bd ( Context * __context__, TArray<int32_t> & __a_rename_at_331, TArray<int32_t> const  & __b_rename_at_331 );
+inline TArray<int32_t> _Func_lambda_thismodule_92_36_32_0x60_function_cc78477825a25340 ( Context * __context__, _lambda_thismodule_92_36_32 & ____this_rename_at_92, TArray<int32_t> const  & __x_rename_at_92 );
+inline void _Func_lambda_thismodule_92_36_32_0x60_finalizer_cc7541e2ca708852 ( Context * __context__, _lambda_thismodule_92_36_32 * ____this_rename_at_92 );
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcfunctional_0x60_map_any_abb3c25e106a138f ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & __src_rename_at_29, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) __blk_rename_at_29 );
+inline void finalize_554c45dda146b8a6 ( Context * __context__, TTuple<8,int32_t,float> & ____this_rename_at_133 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcbuiltin_0x60_each_e5c085c7199596c7 ( Context * __context__, TArray<TArray<int32_t>> const  & __a_rename_at_471 );
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcfunctional_0x60_map_cb33d88d14d2480d ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & __src_rename_at_47, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) const  __blk_rename_at_47 );
+inline int32_t _Func_0x60_first_7932efd700c6a809 ( Context * __context__, TTuple<8,int32_t,float> const  & __x_rename_at_23 );
+inline bool _Funcfunctional_0x60_not_4c37d11112acdd2e ( Context * __context__, bool __x_rename_at_195 );
+inline void finalize_b17394eacc4c2fb4 ( Context * __context__, _lambda_thismodule_16_12_30 & ____this_rename_at_16 );
+inline TTuple<8,int32_t,float> _Funcfunctional_0x60_reduce_any_63ae0eb44c98ece3 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & __it_rename_at_56, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  & __functor_rename_at_56 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcbuiltin_0x60_each_6a927dd59cc9e5af ( Context * __context__, TArray<TTuple<8,int32_t,float>> const  & __a_rename_at_471 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_islice_5c22d8af0bcd782e ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & __src_rename_at_143, int32_t __start_rename_at_143, int32_t __stop_rename_at_143 );
+inline void finalize_c46c891cf327d7cc ( Context * __context__, _lambda_thismodule_132_12_29 & ____this_rename_at_132 );
+inline bool _Func_lambda_thismodule_16_12_30_0x60_function_36566582fa5a0c04 ( Context * __context__, _lambda_thismodule_16_12_30 & ____this_rename_at_16, TArray<int32_t> * & ___ryield16_rename_at_16 );
+inline void _Func_lambda_thismodule_16_12_30_0x60_finalizer_d2e3d911fdbb85c0 ( Context * __context__, _lambda_thismodule_16_12_30 * ____this_rename_at_16 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcbuiltin_0x60_each_ref_ecc07dbeee89a093 ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t> * &)) const  __lam_rename_at_483 );
+inline TTuple<8,int32_t,float> _Funcfunctional_0x60_reduce_8ae7fcb7e421f194 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & __it_rename_at_80, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  & __blk_rename_at_80 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcfunctional_0x60_islice_512aa7be2811ad88 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) & __src_rename_at_143, int32_t __start_rename_at_143, int32_t __stop_rename_at_143 );
+inline void finalize_d954bc5c1531c3e8 ( Context * __context__, _lambda_thismodule_32_12_27 & ____this_rename_at_32 );
+inline void finalize_5b1a9415fc6c513f ( Context * __context__, _lambda_thismodule_132_12_28 & ____this_rename_at_132 );
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_a87e3fc9767b4917 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_471 );
+inline void _Funcbuiltin_0x60_push_clone_17e595ccf2ea82f6 ( Context * __context__, TArray<TArray<int32_t>> & __Arr_rename_at_156, TArray<int32_t> const  & __value_rename_at_156 );
+inline bool _Func_lambda_thismodule_132_12_29_0x60_function_7d490eafd2c92d0c ( Context * __context__, _lambda_thismodule_132_12_29 & ____this_rename_at_132, TArray<int32_t> * & ___ryield132_rename_at_132 );
+inline void _Func_lambda_thismodule_132_12_29_0x60_finalizer_ea6bb7fa1060675c ( Context * __context__, _lambda_thismodule_132_12_29 * ____this_rename_at_132 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcbuiltin_0x60_each_ref_a42878a1c521709b ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float> * &)) const  __lam_rename_at_483 );
+inline void _Func_0x60_verify_even_b071089197a7ced6 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __arr_rename_at_19 );
+inline bool _Funcfunctional_0x60_any_cf35c74e31a01f2b ( Context * __context__, Sequence DAS_COMMENT((bool)) const  & __it_rename_at_93 );
+inline bool _Funcfunctional_0x60_all_927327c38b4c115b ( Context * __context__, Sequence DAS_COMMENT((bool)) const  & __it_rename_at_105 );
+inline bool _Func_0x60_is_same_dfa418e31d233806 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __a_rename_at_37, Sequence DAS_COMMENT((int32_t)) const  & __b_rename_at_37 );
+inline void finalize_9f43dfdcfe3beb0e ( Context * __context__, _lambda_thismodule_10_12_21 & ____this_rename_at_10 );
+inline void finalize_813bce9eea228d97 ( Context * __context__, _lambda_thismodule_10_12_22 & ____this_rename_at_10 );
+inline void finalize_7b71d48649e95514 ( Context * __context__, _lambda_thismodule_32_12_23 & ____this_rename_at_32 );
+inline void finalize_396e7fbc677b3265 ( Context * __context__, _lambda_thismodule_32_12_24 & ____this_rename_at_32 );
+inline void finalize_c08c6d331036ffee ( Context * __context__, _lambda_thismodule_32_12_25 & ____this_rename_at_32 );
+inline void finalize_2b16ae00fd6cbbd8 ( Context * __context__, _lambda_thismodule_91_25_26 & ____this_rename_at_91 );
+inline bool _Func_lambda_thismodule_32_12_27_0x60_function_d147be9547759e46 ( Context * __context__, _lambda_thismodule_32_12_27 & ____this_rename_at_32, TTuple<8,int32_t,float> & ___yield_32_rename_at_32 );
+inline void _Func_lambda_thismodule_32_12_27_0x60_finalizer_f0b7c8307943e9f0 ( Context * __context__, _lambda_thismodule_32_12_27 * ____this_rename_at_32 );
+inline void _Funcbuiltin_0x60_push_clone_ad6a7f9847ce0226 ( Context * __context__, TArray<TTuple<8,int32_t,float>> & __Arr_rename_at_156, TTuple<8,int32_t,float> const  & __value_rename_at_156 );
+inline bool _Func_lambda_thismodule_132_12_28_0x60_function_3db3659e3c49d80f ( Context * __context__, _lambda_thismodule_132_12_28 & ____this_rename_at_132, TTuple<8,int32_t,float> * & ___ryield132_rename_at_132 );
+inline void _Func_lambda_thismodule_132_12_28_0x60_finalizer_783b74ffb2f82a90 ( Context * __context__, _lambda_thismodule_132_12_28 * ____this_rename_at_132 );
+inline Sequence DAS_COMMENT((bool)) _Funcbuiltin_0x60_each_32709ce2e3c1fbc5 ( Context * __context__, Lambda DAS_COMMENT((bool,bool &)) const  __lam_rename_at_476 );
+inline void finalize_37c401bbe712aa43 ( Context * __context__, _lambda_thismodule_147_12_19 & ____this_rename_at_147 );
+inline void finalize_c32e57face1564c ( Context * __context__, _lambda_thismodule_120_12_20 & ____this_rename_at_120 );
+inline bool _Func_lambda_thismodule_10_12_21_0x60_function_fc1ca1e77ce10205 ( Context * __context__, _lambda_thismodule_10_12_21 & ____this_rename_at_10, int32_t & ___yield_10_rename_at_10 );
+inline void _Func_lambda_thismodule_10_12_21_0x60_finalizer_6cc1eed0b9a897f4 ( Context * __context__, _lambda_thismodule_10_12_21 * ____this_rename_at_10 );
+inline bool _Func_lambda_thismodule_10_12_22_0x60_function_63e23fcd6be7b2a8 ( Context * __context__, _lambda_thismodule_10_12_22 & ____this_rename_at_10, int32_t & ___yield_10_rename_at_10 );
+inline void _Func_lambda_thismodule_10_12_22_0x60_finalizer_bae38db824aeb9e4 ( Context * __context__, _lambda_thismodule_10_12_22 * ____this_rename_at_10 );
+inline bool _Func_lambda_thismodule_32_12_23_0x60_function_2e741abb3aa6adb0 ( Context * __context__, _lambda_thismodule_32_12_23 & ____this_rename_at_32, int32_t & ___yield_32_rename_at_32 );
+inline void _Func_lambda_thismodule_32_12_23_0x60_finalizer_87217fcfa3f68a10 ( Context * __context__, _lambda_thismodule_32_12_23 * ____this_rename_at_32 );
+inline bool _Func_lambda_thismodule_32_12_24_0x60_function_b489ed5292d4adb1 ( Context * __context__, _lambda_thismodule_32_12_24 & ____this_rename_at_32, int32_t & ___yield_32_rename_at_32 );
+inline void _Func_lambda_thismodule_32_12_24_0x60_finalizer_9cf00ca9417815b4 ( Context * __context__, _lambda_thismodule_32_12_24 * ____this_rename_at_32 );
+inline bool _Func_lambda_thismodule_32_12_25_0x60_function_998f9452d47a6b9d ( Context * __context__, _lambda_thismodule_32_12_25 & ____this_rename_at_32, bool & ___yield_32_rename_at_32 );
+inline void _Func_lambda_thismodule_32_12_25_0x60_finalizer_6405205b252e1870 ( Context * __context__, _lambda_thismodule_32_12_25 * ____this_rename_at_32 );
+inline bool _Func_lambda_thismodule_91_25_26_0x60_function_15f2a680f0c86a65 ( Context * __context__, _lambda_thismodule_91_25_26 & ____this_rename_at_91, TArray<int32_t> const  & __x_rename_at_91 );
+inline void _Func_lambda_thismodule_91_25_26_0x60_finalizer_17737d2831ca41c6 ( Context * __context__, _lambda_thismodule_91_25_26 * ____this_rename_at_91 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_filter_any_8ac13c6d58727a6f ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_7, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) __blk_rename_at_7 );
+inline bool _Func_lambda_thismodule_147_12_19_0x60_function_93f0381787fb4a78 ( Context * __context__, _lambda_thismodule_147_12_19 & ____this_rename_at_147, int32_t & ___yield_147_rename_at_147 );
+inline void _Func_lambda_thismodule_147_12_19_0x60_finalizer_b08b52f53fe2adaa ( Context * __context__, _lambda_thismodule_147_12_19 * ____this_rename_at_147 );
+inline bool _Func_lambda_thismodule_120_12_20_0x60_function_4b1f73fc73a6c778 ( Context * __context__, _lambda_thismodule_120_12_20 & ____this_rename_at_120, int32_t & ___yield_120_rename_at_120 );
+inline void _Func_lambda_thismodule_120_12_20_0x60_finalizer_3735d8877c952ae0 ( Context * __context__, _lambda_thismodule_120_12_20 * ____this_rename_at_120 );
+inline void finalize_d2bdfafa2f479e21 ( Context * __context__, _lambda_thismodule_71_25_14 & ____this_rename_at_71 );
+inline int32_t _Funcfunctional_0x60_reduce_any_ee3d36589b55482d ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & __it_rename_at_56, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __functor_rename_at_56 );
+inline void finalize_b1fbd3f7f17aa107 ( Context * __context__, _lambda_thismodule_115_27_15 & ____this_rename_at_115 );
+inline void finalize_4e811d32879905fb ( Context * __context__, _lambda_thismodule_163_30_16 & ____this_rename_at_163 );
+inline void finalize_9241f8123a6109c0 ( Context * __context__, _lambda_thismodule_172_30_17 & ____this_rename_at_172 );
+inline void finalize_3da670ae0d0fd49c ( Context * __context__, _lambda_thismodule_180_30_18 & ____this_rename_at_180 );
+inline void _Funcbuiltin_0x60_push_clone_caf6494d1f59cf4e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_156, int32_t __value_rename_at_156 );
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Func_0x60_verify_14_c7953d9d52dffeef ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) const  & __t_rename_at_43 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_filter_64323d9de00083a ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_21, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) const  __blk_rename_at_21 );
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_cycle_25feb1b3c1b57b4d ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & __src_rename_at_116 );
+inline void finalize_dca9089a796b169e ( Context * __context__, _lambda_thismodule_56_21_10 & ____this_rename_at_56 );
+inline void finalize_3c00f319f5878b9f ( Context * __context__, _lambda_thismodule_90_14_11 & ____this_rename_at_90 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcfunctional_0x60_map_any_2c26bc83fad607e0 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_29, Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) __blk_rename_at_29 );
+inline void finalize_95e8646aced816cb ( Context * __context__, _lambda_thismodule_240_10_12 & ____this_rename_at_240 );
+inline void finalize_5d81d27f4ab6f1ad ( Context * __context__, _lambda_thismodule_243_18_13 & ____this_rename_at_243 );
+inline void _Func_0x60_verify_even_7e6d5ca7b65b79bf ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & __arr_rename_at_19 );
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcbuiltin_0x60_each_7f633a072c41b03c ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t>)) const  __lam_rename_at_476 );
+inline bool _Func_lambda_thismodule_71_25_14_0x60_function_4ef28c57d655e61b ( Context * __context__, _lambda_thismodule_71_25_14 & ____this_rename_at_71, int32_t __x_rename_at_71 );
+inline void _Func_lambda_thismodule_71_25_14_0x60_finalizer_1de86f8b7e406fde ( Context * __context__, _lambda_thismodule_71_25_14 * ____this_rename_at_71 );
+inline int32_t _Funcfunctional_0x60_reduce_e2370503bc5489f5 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & __it_rename_at_80, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __blk_rename_at_80 );
+inline int32_t _Func_lambda_thismodule_115_27_15_0x60_function_76c593a2d975afd9 ( Context * __context__, _lambda_thismodule_115_27_15 & ____this_rename_at_115, int32_t __x_rename_at_115, int32_t __y_rename_at_115 );
+inline void _Func_lambda_thismodule_115_27_15_0x60_finalizer_b7ae6dadf312675a ( Context * __context__, _lambda_thismodule_115_27_15 * ____this_rename_at_115 );
+inline bool _Func_lambda_thismodule_163_30_16_0x60_function_7c6e7fcacb6ae853 ( Context * __context__, _lambda_thismodule_163_30_16 & ____this_rename_at_163, int32_t __x_rename_at_163 );
+inline void _Func_lambda_thismodule_163_30_16_0x60_finalizer_1efff7382e84e2aa ( Context * __context__, _lambda_thismodule_163_30_16 * ____this_rename_at_163 );
+inline bool _Func_lambda_thismodule_172_30_17_0x60_function_42c5b6ebaac79686 ( Context * __context__, _lambda_thismodule_172_30_17 & ____this_rename_at_172, int32_t __x_rename_at_172 );
+inline void _Func_lambda_thismodule_172_30_17_0x60_finalizer_8ed4bb4bd4545e60 ( Context * __context__, _lambda_thismodule_172_30_17 * ____this_rename_at_172 );
+inline bool _Func_lambda_thismodule_180_30_18_0x60_function_d983c4a30551bc1c ( Context * __context__, _lambda_thismodule_180_30_18 & ____this_rename_at_180, int32_t __x_rename_at_180 );
+inline void _Func_lambda_thismodule_180_30_18_0x60_finalizer_526d77f2b8437988 ( Context * __context__, _lambda_thismodule_180_30_18 * ____this_rename_at_180 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_937a16f0c7f42db ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_502 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcfunctional_0x60_cycle_1fda9f623e354c0f ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) & __src_rename_at_116 );
+inline void finalize_9fda4bcc4531188d ( Context * __context__, _lambda_thismodule_163_8_2 & ____this_rename_at_163 );
+inline void finalize_274ecf742fbb4581 ( Context * __context__, _lambda_thismodule_180_8_3 & ____this_rename_at_180 );
+inline void finalize_50a2b26c59df4fa5 ( Context * __context__, _lambda_thismodule_50_23_4 & ____this_rename_at_50 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_d390534166c9b0fe ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_7, Func DAS_COMMENT((bool,int32_t)) __blk_rename_at_7 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_16f495c9a4a7b638 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_7, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_7 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_a5ff5c864782eff8 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_29, Func DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_29 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_44bf1e6652c8539 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_29, Lambda DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_29 );
+inline int32_t _Funcfunctional_0x60_reduce_any_4f62a6a9473e89cc ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_56, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __functor_rename_at_56 );
+inline void finalize_1141d7256c227d21 ( Context * __context__, _lambda_thismodule_106_15_5 & ____this_rename_at_106 );
+inline int32_t _Funcfunctional_0x60_reduce_any_97635aab05d44747 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_56, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_56 );
+inline int32_t _Funcfunctional_0x60_reduce_any_79d34fbb97d5d871 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_56, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_56 );
+inline void finalize_18fe4fcb57354a0c ( Context * __context__, _lambda_thismodule_139_28_6 & ____this_rename_at_139 );
+inline Sequence DAS_COMMENT((bool)) _Funcfunctional_0x60_map_any_a694c9dcae22302f ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_29, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_29 );
+inline void finalize_36a3b02b1fb3dcf7 ( Context * __context__, _lambda_thismodule_227_19_7 & ____this_rename_at_227 );
+inline void finalize_a109dfbebfbc079f ( Context * __context__, _lambda_thismodule_232_10_8 & ____this_rename_at_232 );
+inline void finalize_daf2db5be95cd687 ( Context * __context__, _lambda_thismodule_235_18_9 & ____this_rename_at_235 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_2290b067fc65760f ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_476 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_each_ref_77eafe8c9006a0 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t const  * &)) const  __lam_rename_at_483 );
+inline bool _Func_lambda_thismodule_56_21_10_0x60_function_c1552182905b575e ( Context * __context__, _lambda_thismodule_56_21_10 & ____this_rename_at_56, TArray<int32_t> & ___yield_56_rename_at_56 );
+inline void _Func_lambda_thismodule_56_21_10_0x60_finalizer_6390258da803cc74 ( Context * __context__, _lambda_thismodule_56_21_10 * ____this_rename_at_56 );
+inline void _Funcbuiltin_0x60_emplace_46aeb6a61c4e9221 ( Context * __context__, TArray<TArray<int32_t>> & __Arr_rename_at_120, TArray<int32_t> & __value_rename_at_120 );
+inline void _Func_0x60_verify_14_ad9c7b801e624df0 ( Context * __context__, TArray<TArray<int32_t>> const  & __t_rename_at_43 );
+inline bool _Func_lambda_thismodule_90_14_11_0x60_function_97913e537eef3fc2 ( Context * __context__, _lambda_thismodule_90_14_11 & ____this_rename_at_90, TArray<int32_t> & ___yield_90_rename_at_90 );
+inline void _Func_lambda_thismodule_90_14_11_0x60_finalizer_398faab869104a98 ( Context * __context__, _lambda_thismodule_90_14_11 * ____this_rename_at_90 );
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> & __a_rename_at_42 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcfunctional_0x60_map_e65bba8c18888e75 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_47, Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) const  __blk_rename_at_47 );
+inline bool _Funcfunctional_0x60_is_equal_2af44bbc0bb6f328 ( Context * __context__, int32_t __a_rename_at_187, int32_t __b_rename_at_187 );
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcbuiltin_0x60_each_5b8f7b8f8a92acc2 ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float>)) const  __lam_rename_at_476 );
+inline bool _Func_lambda_thismodule_240_10_12_0x60_function_c0a50a3c44fb0f2b ( Context * __context__, _lambda_thismodule_240_10_12 & ____this_rename_at_240, TArray<int32_t> & ___yield_240_rename_at_240 );
+inline void _Func_lambda_thismodule_240_10_12_0x60_finalizer_722f889b1020677c ( Context * __context__, _lambda_thismodule_240_10_12 * ____this_rename_at_240 );
+inline bool _Func_lambda_thismodule_243_18_13_0x60_function_f36f4e4156384531 ( Context * __context__, _lambda_thismodule_243_18_13 & ____this_rename_at_243, TArray<int32_t> & ___yield_243_rename_at_243 );
+inline void _Func_lambda_thismodule_243_18_13_0x60_finalizer_5c6dfa59ff707404 ( Context * __context__, _lambda_thismodule_243_18_13 * ____this_rename_at_243 );
+inline void finalize_2e9b369ff6b06689 ( Context * __context__, _lambda_thismodule_85_28_1 & ____this_rename_at_85 );
+inline bool _Func_lambda_thismodule_163_8_2_0x60_function_cbaeea5cd4355223 ( Context * __context__, _lambda_thismodule_163_8_2 & ____this_rename_at_163, int32_t & __result_rename_at_162 );
+inline void _Func_lambda_thismodule_163_8_2_0x60_finalizer_97ef0e5f56e2c5fe ( Context * __context__, _lambda_thismodule_163_8_2 * ____this_rename_at_163 );
+inline bool _Func_lambda_thismodule_180_8_3_0x60_function_a9f4fc5559e8f55a ( Context * __context__, _lambda_thismodule_180_8_3 & ____this_rename_at_180, int32_t & ___yield_180_rename_at_180 );
+inline void _Func_lambda_thismodule_180_8_3_0x60_finalizer_b1b7f491be37702c ( Context * __context__, _lambda_thismodule_180_8_3 * ____this_rename_at_180 );
+inline bool _Func_lambda_thismodule_50_23_4_0x60_function_acc8ccfc59a727e8 ( Context * __context__, _lambda_thismodule_50_23_4 & ____this_rename_at_50, int32_t const  * & ___ryield50_rename_at_50 );
+inline void _Func_lambda_thismodule_50_23_4_0x60_finalizer_d48a0c4dc1dec02c ( Context * __context__, _lambda_thismodule_50_23_4 * ____this_rename_at_50 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline void _Func_0x60_verify_even_6703252febc142e7 ( Context * __context__, TArray<int32_t> const  & __arr_rename_at_19 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_196d50d6a5b657be ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_26, Func DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_26 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_53efa21008623dcb ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_21, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_21 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_a60435d0c6456bd4 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_52, Func DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_52 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_58dc263556f6d651 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_47, Lambda DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_47 );
+inline int32_t _Funcfunctional_0x60_reduce_4a5fef6152ecc35b ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_80, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  & __blk_rename_at_80 );
+inline bool _Func_lambda_thismodule_106_15_5_0x60_function_4edb7cf4dd0af38f ( Context * __context__, _lambda_thismodule_106_15_5 & ____this_rename_at_106, int32_t const  * & ___ryield106_rename_at_106 );
+inline void _Func_lambda_thismodule_106_15_5_0x60_finalizer_b87dcc28f4b26ad4 ( Context * __context__, _lambda_thismodule_106_15_5 * ____this_rename_at_106 );
+inline int32_t _Funcfunctional_0x60_reduce_a0bccddb56b604f ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_70, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_70 );
+inline int32_t _Funcfunctional_0x60_reduce_c149d972cb8a23ee ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_76, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_76 );
+inline TTuple<8,int32_t,float> _Func_lambda_thismodule_139_28_6_0x60_function_ecdee715a1fae593 ( Context * __context__, _lambda_thismodule_139_28_6 & ____this_rename_at_139, int32_t __x_rename_at_139 );
+inline void _Func_lambda_thismodule_139_28_6_0x60_finalizer_b747e97a7829fa46 ( Context * __context__, _lambda_thismodule_139_28_6 * ____this_rename_at_139 );
+inline int32_t _Funcfunctional_0x60_sum_c6bb83657fd0ca16 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & __it_rename_at_84 );
+inline Sequence DAS_COMMENT((bool)) _Funcfunctional_0x60_map_c631eb0100c760c2 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_47, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_47 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_islice_4597761baec84852 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_143, int32_t __start_rename_at_143, int32_t __stop_rename_at_143 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_cycle_591674320dc1e79c ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & __src_rename_at_116 );
+inline bool _Func_lambda_thismodule_227_19_7_0x60_function_1cec87bec4f6e7e1 ( Context * __context__, _lambda_thismodule_227_19_7 & ____this_rename_at_227, int32_t & ___yield_227_rename_at_227 );
+inline void _Func_lambda_thismodule_227_19_7_0x60_finalizer_f6e0cad214e51598 ( Context * __context__, _lambda_thismodule_227_19_7 * ____this_rename_at_227 );
+inline bool _Func_lambda_thismodule_232_10_8_0x60_function_b0f6cea462a9698d ( Context * __context__, _lambda_thismodule_232_10_8 & ____this_rename_at_232, TTuple<8,int32_t,float> & ___yield_232_rename_at_232 );
+inline void _Func_lambda_thismodule_232_10_8_0x60_finalizer_f0c678795587145c ( Context * __context__, _lambda_thismodule_232_10_8 * ____this_rename_at_232 );
+inline bool _Func_lambda_thismodule_235_18_9_0x60_function_2c3ebc5409dda05f ( Context * __context__, _lambda_thismodule_235_18_9 & ____this_rename_at_235, TTuple<8,int32_t,float> & ___yield_235_rename_at_235 );
+inline void _Func_lambda_thismodule_235_18_9_0x60_finalizer_f01773fb180129d8 ( Context * __context__, _lambda_thismodule_235_18_9 * ____this_rename_at_235 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_4a0c453305a7dd5 ( Context * __context__, TDim<int32_t,2> & __a_rename_at_517 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_447 );
+inline int32_t _Func_lambda_thismodule_85_28_1_0x60_function_bddb2af26f5dab07 ( Context * __context__, _lambda_thismodule_85_28_1 & ____this_rename_at_85, int32_t __x_rename_at_85 );
+inline void _Func_lambda_thismodule_85_28_1_0x60_finalizer_3dc36ce0a81f940e ( Context * __context__, _lambda_thismodule_85_28_1 * ____this_rename_at_85 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_f9adbdca370c7b15 ( Context * __context__, TDim<int32_t,3> & __a_rename_at_517 );
+inline bool _Funcfunctional_0x60_any_a5606ed295f053c9 ( Context * __context__, TDim<bool,2> const  & __it_rename_at_93 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_count_25d3d15e5f3ded6d ( Context * __context__, int32_t __start_rename_at_160, int32_t __step_rename_at_160 );
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_repeat_429cd11f93b0bf2d ( Context * __context__, int32_t __value_rename_at_177, int32_t __count_rename_at_177 );
+inline bool is_even_9f92407af8b51b2c ( Context * __context__, int32_t __x_rename_at_9 );
+inline int32_t twice_aa4c716c97740337 ( Context * __context__, int32_t __x_rename_at_12 );
+inline int32_t add_8997dbbc2c7fa6aa ( Context * __context__, int32_t __a_rename_at_15, int32_t __b_rename_at_15 );
+inline bool _FuncExclEqu_d496bfa20e8277a0 ( Context * __context__, TTuple<8,int32_t,float> const  & __a_rename_at_26, TTuple<8,int32_t,float> const  & __b_rename_at_26 );
+inline bool _FuncExclEqu_46b76804d5e31c7b ( Context * __context__, TArray<int32_t> const  & __a_rename_at_29, TArray<int32_t> const  & __b_rename_at_29 );
+inline bool test_253505bb95c128bc ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_cdc972ff02046fd8 ( Context * __context__, _lambda_thismodule_32_12_36 &  ____this_rename_at_32 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_32._source_0_at_32),__context__);
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(____this_rename_at_32.w),4,__context__);
+	memset(&(____this_rename_at_32), 0, 88);
+}
+
+inline bool _Func_lambda_thismodule_32_12_36_0x60_function_f607d9b61b3cbd65 ( Context * __context__, _lambda_thismodule_32_12_36 &  ____this_rename_at_32, int32_t & ___yield_32_rename_at_32 )
+{
+	switch (____this_rename_at_32.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_32._loop_at_32,true);
+	das_move(____this_rename_at_32._source_0_at_32,____this_rename_at_32.src);
+	memset(&(____this_rename_at_32.w), 0, 24);
+	das_copy(____this_rename_at_32._pvar_0_at_32,das_ref(__context__,____this_rename_at_32.w));
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_32._loop_at_32 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_32_rename_at_32,das_invoke_lambda<int32_t>::invoke<TArray<int32_t> &>(__context__,nullptr,____this_rename_at_32.blk,das_arg<TArray<int32_t>>::pass(____this_rename_at_32.w)));
+	das_copy(____this_rename_at_32.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_32_12_36_0x60_finalizer_49b7f8641ea22224 ( Context * __context__, _lambda_thismodule_32_12_36 * ____this_rename_at_32 )
+{
+	finalize_cdc972ff02046fd8(__context__,das_arg<_lambda_thismodule_32_12_36>::pass(das_deref(__context__,____this_rename_at_32)));
+	das_delete_lambda_struct<_lambda_thismodule_32_12_36 *>::clear(__context__,____this_rename_at_32);
+}
+
+inline void finalize_a7122cc19257df9a ( Context * __context__, _lambda_thismodule_93_29_35 &  ____this_rename_at_93 )
+{
+	memset(&(____this_rename_at_93), 0, 16);
+}
+
+inline void _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07 ( Context * __context__, TArray<int32_t> &  __a_rename_at_31, TArray<int32_t> &  __b_rename_at_31 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_31)));
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<TArray<int32_t> &>::from(__b_rename_at_31)));
+	das_move(__a_rename_at_31,__b_rename_at_31);
+}
+
+inline int32_t _Func_lambda_thismodule_93_29_35_0x60_function_9952822083039823 ( Context * __context__, _lambda_thismodule_93_29_35 &  ____this_rename_at_93, TArray<int32_t> const  &  __x_rename_at_93 )
+{
+	return das_auto_cast<int32_t>::cast(__x_rename_at_93(0,__context__));
+}
+
+inline void _Func_lambda_thismodule_93_29_35_0x60_finalizer_77b7ae3fdea0e0ca ( Context * __context__, _lambda_thismodule_93_29_35 * ____this_rename_at_93 )
+{
+	finalize_a7122cc19257df9a(__context__,das_arg<_lambda_thismodule_93_29_35>::pass(das_deref(__context__,____this_rename_at_93)));
+	das_delete_lambda_struct<_lambda_thismodule_93_29_35 *>::clear(__context__,____this_rename_at_93);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_6f89c8d21fd305a3 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_29, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) __blk_rename_at_29 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_32_12_36>::make(__context__,&__type_info__877b7ef8a083a14d,(([&]() -> _lambda_thismodule_32_12_36 {
+		_lambda_thismodule_32_12_36 __mks_31;
+		das_zero(__mks_31);
+		das_copy((__mks_31.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_32_12_36`function XS<::_lambda_thismodule_32_12_36> &i*/ 4576504208601628069u))));
+		das_copy((__mks_31.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_32_12_36`finalizer X1<S<::_lambda_thismodule_32_12_36>>?*/ 272730712072428102u))));
+		das_move((__mks_31.blk),(__blk_rename_at_29));
+		das_move((__mks_31.src),(__src_rename_at_29));
+		return __mks_31;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_82ad2f6322b2be3d ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_47, Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const  __blk_rename_at_47 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcfunctional_0x60_map_any_6f89c8d21fd305a3(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__src_rename_at_47),__blk_rename_at_47));
+}
+
+inline void finalize_3c86c1bfde120dbf ( Context * __context__, _lambda_thismodule_37_12_34 &  ____this_rename_at_37 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_37._source_0_at_37),__context__);
+	memset(&(____this_rename_at_37), 0, 72);
+}
+
+inline bool _Func_lambda_thismodule_37_12_34_0x60_function_f63c018422c49b61 ( Context * __context__, _lambda_thismodule_37_12_34 &  ____this_rename_at_37, TArray<int32_t> &  ___yield_37_rename_at_37 )
+{
+	switch (____this_rename_at_37.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_37._loop_at_37,true);
+	das_move(____this_rename_at_37._source_0_at_37,____this_rename_at_37.src);
+	memset(&(____this_rename_at_37.w), 0, 8);
+	das_copy(____this_rename_at_37._pvar_0_at_37,das_ref(__context__,____this_rename_at_37.w));
+	DAS_SETBOOLAND((____this_rename_at_37._loop_at_37),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_37._source_0_at_37),____this_rename_at_37._pvar_0_at_37,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_37._loop_at_37 )
+	{
+		goto label_4;
+	};
+	_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07(__context__,das_arg<TArray<int32_t>>::pass(___yield_37_rename_at_37),das_arg<TArray<int32_t>>::pass(das_invoke_lambda<TArray<int32_t>>::invoke_cmres<TArray<int32_t> &>(__context__,nullptr,____this_rename_at_37.blk,das_arg<TArray<int32_t>>::pass(das_deref(__context__,____this_rename_at_37.w)))));
+	das_copy(____this_rename_at_37.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_37._loop_at_37),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_37._source_0_at_37),____this_rename_at_37._pvar_0_at_37,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_37._source_0_at_37),____this_rename_at_37._pvar_0_at_37,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_37_12_34_0x60_finalizer_d0d84ad0da7c7220 ( Context * __context__, _lambda_thismodule_37_12_34 * ____this_rename_at_37 )
+{
+	finalize_3c86c1bfde120dbf(__context__,das_arg<_lambda_thismodule_37_12_34>::pass(das_deref(__context__,____this_rename_at_37)));
+	das_delete_lambda_struct<_lambda_thismodule_37_12_34 *>::clear(__context__,____this_rename_at_37);
+}
+
+inline bool _Func_0x60_is_same_b2ee21551accec13 ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) const  &  __a_rename_at_37, Sequence DAS_COMMENT((TArray<int32_t>)) const  &  __b_rename_at_37 )
+{
+	{
+		bool __need_loop_38 = true;
+		// x : array<int> const&
+		das_iterator<Sequence DAS_COMMENT((TArray<int32_t>)) const > __x_iterator(__a_rename_at_37);
+		TArray<int32_t> const  * __x_rename_at_38;
+		__need_loop_38 = __x_iterator.first(__context__,(__x_rename_at_38)) && __need_loop_38;
+		// y : array<int> const
+		das_iterator<Sequence DAS_COMMENT((TArray<int32_t>)) const > __y_iterator(__b_rename_at_37);
+		TArray<int32_t> const  __y_rename_at_38;
+		__need_loop_38 = __y_iterator.first(__context__,(__y_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __x_iterator.next(__context__,(__x_rename_at_38)) && __y_iterator.next(__context__,(__y_rename_at_38)) )
+		{
+			if ( _FuncExclEqu_46b76804d5e31c7b(__context__,(*__x_rename_at_38),__y_rename_at_38) )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_38));
+		__y_iterator.close(__context__,(__y_rename_at_38));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void finalize_a8708c1dfb490536 ( Context * __context__, _lambda_thismodule_153_12_33 &  ____this_rename_at_153 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_153._source_0_at_153),__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_153._source_1_at_153),__context__);
+	memset(&(____this_rename_at_153), 0, 96);
+}
+
+inline bool _Func_0x60_is_same_84e5a5cb0f2aec39 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) const  &  __a_rename_at_37, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  &  __b_rename_at_37 )
+{
+	{
+		bool __need_loop_38 = true;
+		// x : tuple<int;float> const&
+		das_iterator<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const > __x_iterator(__a_rename_at_37);
+		TTuple<8,int32_t,float> const  * __x_rename_at_38;
+		__need_loop_38 = __x_iterator.first(__context__,(__x_rename_at_38)) && __need_loop_38;
+		// y : tuple<int;float> const
+		das_iterator<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const > __y_iterator(__b_rename_at_37);
+		TTuple<8,int32_t,float> const  __y_rename_at_38;
+		__need_loop_38 = __y_iterator.first(__context__,(__y_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __x_iterator.next(__context__,(__x_rename_at_38)) && __y_iterator.next(__context__,(__y_rename_at_38)) )
+		{
+			if ( _FuncExclEqu_d496bfa20e8277a0(__context__,(*__x_rename_at_38),__y_rename_at_38) )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_38));
+		__y_iterator.close(__context__,(__y_rename_at_38));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void finalize_6d04359a0a5cd8f8 ( Context * __context__, _lambda_thismodule_153_12_31 &  ____this_rename_at_153 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_153._source_0_at_153),__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_153._source_1_at_153),__context__);
+	memset(&(____this_rename_at_153), 0, 96);
+}
+
+inline void finalize_3f3f5513ea66b214 ( Context * __context__, _lambda_thismodule_92_36_32 &  ____this_rename_at_92 )
+{
+	memset(&(____this_rename_at_92), 0, 16);
+}
+
+inline bool _Func_lambda_thismodule_153_12_33_0x60_function_9e9637b431e74b6 ( Context * __context__, _lambda_thismodule_153_12_33 &  ____this_rename_at_153, TArray<int32_t> * & ___ryield153_rename_at_153 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_153_12_32;
+	switch (____this_rename_at_153.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_153._loop_at_153,true);
+	das_move(____this_rename_at_153._source_0_at_153,____this_rename_at_153.src);
+	memset(&(____this_rename_at_153.x), 0, 8);
+	das_copy(____this_rename_at_153._pvar_0_at_153,das_ref(__context__,____this_rename_at_153.x));
+	DAS_SETBOOLAND((____this_rename_at_153._loop_at_153),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_153._source_0_at_153),____this_rename_at_153._pvar_0_at_153,__context__)));
+	das_move(____this_rename_at_153._source_1_at_153,(_temp_make_local_153_12_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,mk_range(____this_rename_at_153.stop)))));
+	memset(&(____this_rename_at_153.i), 0, 4);
+	das_copy(____this_rename_at_153._pvar_1_at_153,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_153.i)));
+	DAS_SETBOOLAND((____this_rename_at_153._loop_at_153),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_153._source_1_at_153),____this_rename_at_153._pvar_1_at_153,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_153._loop_at_153 )
+	{
+		goto label_5;
+	};
+	if ( !(____this_rename_at_153.i >= ____this_rename_at_153.start) )
+	{
+		goto label_2;
+	};
+	das_copy(___ryield153_rename_at_153,das_ref(__context__,das_deref(__context__,____this_rename_at_153.x)));
+	das_copy(____this_rename_at_153.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_153._loop_at_153),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_153._source_0_at_153),____this_rename_at_153._pvar_0_at_153,__context__)));
+	DAS_SETBOOLAND((____this_rename_at_153._loop_at_153),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_153._source_1_at_153),____this_rename_at_153._pvar_1_at_153,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_153._source_0_at_153),____this_rename_at_153._pvar_0_at_153,__context__);
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_153._source_1_at_153),____this_rename_at_153._pvar_1_at_153,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_153_12_33_0x60_finalizer_bb33e00c565f4444 ( Context * __context__, _lambda_thismodule_153_12_33 * ____this_rename_at_153 )
+{
+	finalize_a8708c1dfb490536(__context__,das_arg<_lambda_thismodule_153_12_33>::pass(das_deref(__context__,____this_rename_at_153)));
+	das_delete_lambda_struct<_lambda_thismodule_153_12_33 *>::clear(__context__,____this_rename_at_153);
+}
+
+inline void _Funcbuiltin_0x60_finalize_b509dde46ca14424 ( Context * __context__, TArray<TArray<int32_t>> &  __a_rename_at_395 )
+{
+	{
+		bool __need_loop_397 = true;
+		// aV : array<int> aka TT&
+		das_iterator<TArray<TArray<int32_t>>> __aV_iterator(__a_rename_at_395);
+		TArray<int32_t> * __aV_rename_at_397;
+		__need_loop_397 = __aV_iterator.first(__context__,(__aV_rename_at_397)) && __need_loop_397;
+		for ( ; __need_loop_397 ; __need_loop_397 = __aV_iterator.next(__context__,(__aV_rename_at_397)) )
+		{
+			builtin_array_free(das_arg<TArray<int32_t>>::pass((*__aV_rename_at_397)),4,__context__);
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_397));
+	};
+	builtin_array_free(das_arg<TArray<TArray<int32_t>>>::pass(__a_rename_at_395),24,__context__);
+}
+
+inline bool _Func_lambda_thismodule_153_12_31_0x60_function_80fcd9ca7e3cf082 ( Context * __context__, _lambda_thismodule_153_12_31 &  ____this_rename_at_153, TTuple<8,int32_t,float> * & ___ryield153_rename_at_153 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_153_12_32;
+	switch (____this_rename_at_153.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_153._loop_at_153,true);
+	das_move(____this_rename_at_153._source_0_at_153,____this_rename_at_153.src);
+	memset(&(____this_rename_at_153.x), 0, 8);
+	das_copy(____this_rename_at_153._pvar_0_at_153,das_ref(__context__,____this_rename_at_153.x));
+	DAS_SETBOOLAND((____this_rename_at_153._loop_at_153),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_153._source_0_at_153),____this_rename_at_153._pvar_0_at_153,__context__)));
+	das_move(____this_rename_at_153._source_1_at_153,(_temp_make_local_153_12_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,mk_range(____this_rename_at_153.stop)))));
+	memset(&(____this_rename_at_153.i), 0, 4);
+	das_copy(____this_rename_at_153._pvar_1_at_153,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_153.i)));
+	DAS_SETBOOLAND((____this_rename_at_153._loop_at_153),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_153._source_1_at_153),____this_rename_at_153._pvar_1_at_153,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_153._loop_at_153 )
+	{
+		goto label_5;
+	};
+	if ( !(____this_rename_at_153.i >= ____this_rename_at_153.start) )
+	{
+		goto label_2;
+	};
+	das_copy(___ryield153_rename_at_153,das_ref(__context__,das_deref(__context__,____this_rename_at_153.x)));
+	das_copy(____this_rename_at_153.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_153._loop_at_153),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_153._source_0_at_153),____this_rename_at_153._pvar_0_at_153,__context__)));
+	DAS_SETBOOLAND((____this_rename_at_153._loop_at_153),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_153._source_1_at_153),____this_rename_at_153._pvar_1_at_153,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_153._source_0_at_153),____this_rename_at_153._pvar_0_at_153,__context__);
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_153._source_1_at_153),____this_rename_at_153._pvar_1_at_153,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_153_12_31_0x60_finalizer_663d1dae9fd024f8 ( Context * __context__, _lambda_thismodule_153_12_31 * ____this_rename_at_153 )
+{
+	finalize_6d04359a0a5cd8f8(__context__,das_arg<_lambda_thismodule_153_12_31>::pass(das_deref(__context__,____this_rename_at_153)));
+	das_delete_lambda_struct<_lambda_thismodule_153_12_31 *>::clear(__context__,____this_rename_at_153);
+}
+
+inline void _Funcbuiltin_0x60_finalize_943699eaf2940908 ( Context * __context__, TArray<TTuple<8,int32_t,float>> &  __a_rename_at_395 )
+{
+	{
+		bool __need_loop_397 = true;
+		// aV : tuple<int;float> aka TT&
+		das_iterator<TArray<TTuple<8,int32_t,float>>> __aV_iterator(__a_rename_at_395);
+		TTuple<8,int32_t,float> * __aV_rename_at_397;
+		__need_loop_397 = __aV_iterator.first(__context__,(__aV_rename_at_397)) && __need_loop_397;
+		for ( ; __need_loop_397 ; __need_loop_397 = __aV_iterator.next(__context__,(__aV_rename_at_397)) )
+		{
+			finalize_554c45dda146b8a6(__context__,das_arg<TTuple<8,int32_t,float>>::pass((*__aV_rename_at_397)));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_397));
+	};
+	builtin_array_free(das_arg<TArray<TTuple<8,int32_t,float>>>::pass(__a_rename_at_395),8,__context__);
+}
+
+inline void _Funcbuiltin_0x60_clone_4bc3594d348ca0bd ( Context * __context__, TArray<int32_t> &  __a_rename_at_331, TArray<int32_t> const  &  __b_rename_at_331 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_331),builtin_array_size(__b_rename_at_331));
+	{
+		bool __need_loop_333 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_331);
+		int32_t * __aV_rename_at_333;
+		__need_loop_333 = __aV_iterator.first(__context__,(__aV_rename_at_333)) && __need_loop_333;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_331);
+		int32_t const  * __bV_rename_at_333;
+		__need_loop_333 = __bV_iterator.first(__context__,(__bV_rename_at_333)) && __need_loop_333;
+		for ( ; __need_loop_333 ; __need_loop_333 = __aV_iterator.next(__context__,(__aV_rename_at_333)) && __bV_iterator.next(__context__,(__bV_rename_at_333)) )
+		{
+			das_copy((*__aV_rename_at_333),(*__bV_rename_at_333));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_333));
+		__bV_iterator.close(__context__,(__bV_rename_at_333));
+	};
+}
+
+inline TArray<int32_t> _Func_lambda_thismodule_92_36_32_0x60_function_cc78477825a25340 ( Context * __context__, _lambda_thismodule_92_36_32 &  ____this_rename_at_92, TArray<int32_t> const  &  __x_rename_at_92 )
+{
+	TArray<int32_t> _temp_make_local_92_42_32;
+	TDim<int32_t,3> _temp_make_local_92_42_64;
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_92_42_32 = (_Funcbuiltin_0x60_to_array_move_f9adbdca370c7b15(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+		_temp_make_local_92_42_64(0,__context__) = __x_rename_at_92(0,__context__);
+		_temp_make_local_92_42_64(1,__context__) = __x_rename_at_92(0,__context__);
+		_temp_make_local_92_42_64(2,__context__) = __x_rename_at_92(0,__context__);
+		return _temp_make_local_92_42_64;
+	})()))))))));
+}
+
+inline void _Func_lambda_thismodule_92_36_32_0x60_finalizer_cc7541e2ca708852 ( Context * __context__, _lambda_thismodule_92_36_32 * ____this_rename_at_92 )
+{
+	finalize_3f3f5513ea66b214(__context__,das_arg<_lambda_thismodule_92_36_32>::pass(das_deref(__context__,____this_rename_at_92)));
+	das_delete_lambda_struct<_lambda_thismodule_92_36_32 *>::clear(__context__,____this_rename_at_92);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcfunctional_0x60_map_any_abb3c25e106a138f ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) &  __src_rename_at_29, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) __blk_rename_at_29 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t>))>::cast(_Funcbuiltin_0x60_each_7f633a072c41b03c(__context__,das_ascend<bool,_lambda_thismodule_37_12_34>::make(__context__,&__type_info__ab77db4aa00841a,(([&]() -> _lambda_thismodule_37_12_34 {
+		_lambda_thismodule_37_12_34 __mks_36;
+		das_zero(__mks_36);
+		das_copy((__mks_36.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_37_12_34`function XS<::_lambda_thismodule_37_12_34> 1<i>A*/ 8403057034658846505u))));
+		das_copy((__mks_36.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_37_12_34`finalizer X1<S<::_lambda_thismodule_37_12_34>>?*/ 10506598147203150980u))));
+		das_move((__mks_36.blk),(__blk_rename_at_29));
+		das_move((__mks_36.src),(__src_rename_at_29));
+		return __mks_36;
+	})()))));
+}
+
+inline void finalize_554c45dda146b8a6 ( Context * __context__, TTuple<8,int32_t,float> &  ____this_rename_at_133 )
+{
+	memset(&(____this_rename_at_133), 0, 8);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcbuiltin_0x60_each_e5c085c7199596c7 ( Context * __context__, TArray<TArray<int32_t>> const  &  __a_rename_at_471 )
+{
+	Sequence DAS_COMMENT((TArray<int32_t> *)) __it_rename_at_472; das_zero(__it_rename_at_472);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__it_rename_at_472),__a_rename_at_471,24,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(__it_rename_at_472);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcfunctional_0x60_map_cb33d88d14d2480d ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) &  __src_rename_at_47, Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) const  __blk_rename_at_47 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t>))>::cast(_Funcfunctional_0x60_map_any_abb3c25e106a138f(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__src_rename_at_47),__blk_rename_at_47));
+}
+
+inline int32_t _Func_0x60_first_7932efd700c6a809 ( Context * __context__, TTuple<8,int32_t,float> const  &  __x_rename_at_23 )
+{
+	return das_auto_cast<int32_t>::cast(das_get_tuple_field<int32_t,0>::get(__x_rename_at_23));
+}
+
+inline bool _Funcfunctional_0x60_not_4c37d11112acdd2e ( Context * __context__, bool __x_rename_at_195 )
+{
+	return das_auto_cast<bool>::cast(!__x_rename_at_195);
+}
+
+inline void finalize_b17394eacc4c2fb4 ( Context * __context__, _lambda_thismodule_16_12_30 &  ____this_rename_at_16 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_16._source_0_at_16),__context__);
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(____this_rename_at_16.w),4,__context__);
+	memset(&(____this_rename_at_16), 0, 88);
+}
+
+inline TTuple<8,int32_t,float> _Funcfunctional_0x60_reduce_any_63ae0eb44c98ece3 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  &  __it_rename_at_56, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  __functor_rename_at_56 )
+{
+	TTuple<8,int32_t,float> __left_rename_at_57; das_zero(__left_rename_at_57);
+	bool __first_rename_at_58 = true;
+	{
+		bool __need_loop_59 = true;
+		// right : tuple<int;float> aka TT const
+		das_iterator<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const > __right_iterator(__it_rename_at_56);
+		TTuple<8,int32_t,float> const  __right_rename_at_59;
+		__need_loop_59 = __right_iterator.first(__context__,(__right_rename_at_59)) && __need_loop_59;
+		for ( ; __need_loop_59 ; __need_loop_59 = __right_iterator.next(__context__,(__right_rename_at_59)) )
+		{
+			if ( __first_rename_at_58 )
+			{
+				das_copy(__first_rename_at_58,false);
+				das_copy(__left_rename_at_57,__right_rename_at_59);
+			} else {
+				das_copy(__left_rename_at_57,das_invoke<TTuple<8,int32_t,float> const >::invoke_cmres<TTuple<8,int32_t,float> &,TTuple<8,int32_t,float> const  &>(__context__,nullptr,__functor_rename_at_56,das_arg<TTuple<8,int32_t,float>>::pass(__left_rename_at_57),__right_rename_at_59));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_59));
+	};
+	if ( __first_rename_at_58 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+	return das_auto_cast_ref<TTuple<8,int32_t,float>>::cast(__left_rename_at_57);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcbuiltin_0x60_each_6a927dd59cc9e5af ( Context * __context__, TArray<TTuple<8,int32_t,float>> const  &  __a_rename_at_471 )
+{
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) __it_rename_at_472; das_zero(__it_rename_at_472);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(__it_rename_at_472),__a_rename_at_471,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &))>::cast(__it_rename_at_472);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_islice_5c22d8af0bcd782e ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) &  __src_rename_at_143, int32_t __start_rename_at_143, int32_t __stop_rename_at_143 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(_Funcbuiltin_0x60_each_ref_ecc07dbeee89a093(__context__,das_ascend<bool,_lambda_thismodule_153_12_33>::make(__context__,&__type_info__b72dfbdc59493992,(([&]() -> _lambda_thismodule_153_12_33 {
+		_lambda_thismodule_153_12_33 __mks_152;
+		das_zero(__mks_152);
+		das_copy((__mks_152.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_153_12_33`function XS<::_lambda_thismodule_153_12_33> &1<1<i>A>?*/ 14947417855844832169u))));
+		das_copy((__mks_152.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_153_12_33`finalizer X1<S<::_lambda_thismodule_153_12_33>>?*/ 13752155301642031896u))));
+		das_move((__mks_152.src),(__src_rename_at_143));
+		das_copy((__mks_152.start),(__start_rename_at_143));
+		das_copy((__mks_152.stop),(__stop_rename_at_143));
+		return __mks_152;
+	})()))));
+}
+
+inline void finalize_c46c891cf327d7cc ( Context * __context__, _lambda_thismodule_132_12_29 &  ____this_rename_at_132 )
+{
+	_Funcbuiltin_0x60_finalize_b509dde46ca14424(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____this_rename_at_132.arr));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_132._source_0_at_133),__context__);
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(____this_rename_at_132.x),4,__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_132.___source_0_at_137_rename_at_137),__context__);
+	memset(&(____this_rename_at_132), 0, 136);
+}
+
+inline bool _Func_lambda_thismodule_16_12_30_0x60_function_36566582fa5a0c04 ( Context * __context__, _lambda_thismodule_16_12_30 &  ____this_rename_at_16, TArray<int32_t> * & ___ryield16_rename_at_16 )
+{
+	switch (____this_rename_at_16.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_16._loop_at_16,true);
+	das_move(____this_rename_at_16._source_0_at_16,____this_rename_at_16.src);
+	memset(&(____this_rename_at_16.w), 0, 24);
+	das_copy(____this_rename_at_16._pvar_0_at_16,das_ref(__context__,____this_rename_at_16.w));
+	DAS_SETBOOLAND((____this_rename_at_16._loop_at_16),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_16._source_0_at_16),____this_rename_at_16._pvar_0_at_16,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_16._loop_at_16 )
+	{
+		goto label_5;
+	};
+	if ( !das_invoke_lambda<bool>::invoke<TArray<int32_t> &>(__context__,nullptr,____this_rename_at_16.blk,das_arg<TArray<int32_t>>::pass(____this_rename_at_16.w)) )
+	{
+		goto label_2;
+	};
+	das_copy(___ryield16_rename_at_16,das_ref(__context__,____this_rename_at_16.w));
+	das_copy(____this_rename_at_16.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_16._loop_at_16),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_16._source_0_at_16),____this_rename_at_16._pvar_0_at_16,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_16._source_0_at_16),____this_rename_at_16._pvar_0_at_16,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_16_12_30_0x60_finalizer_d2e3d911fdbb85c0 ( Context * __context__, _lambda_thismodule_16_12_30 * ____this_rename_at_16 )
+{
+	finalize_b17394eacc4c2fb4(__context__,das_arg<_lambda_thismodule_16_12_30>::pass(das_deref(__context__,____this_rename_at_16)));
+	das_delete_lambda_struct<_lambda_thismodule_16_12_30 *>::clear(__context__,____this_rename_at_16);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcbuiltin_0x60_each_ref_ecc07dbeee89a093 ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t> * &)) const  __lam_rename_at_483 )
+{
+	Sequence DAS_COMMENT((TArray<int32_t> *)) __it_rename_at_484; das_zero(__it_rename_at_484);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__it_rename_at_484),__lam_rename_at_483,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(__it_rename_at_484);
+}
+
+inline TTuple<8,int32_t,float> _Funcfunctional_0x60_reduce_8ae7fcb7e421f194 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  &  __it_rename_at_80, Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  __blk_rename_at_80 )
+{
+	return das_auto_cast_ref<TTuple<8,int32_t,float>>::cast(_Funcfunctional_0x60_reduce_any_63ae0eb44c98ece3(__context__,__it_rename_at_80,__blk_rename_at_80));
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcfunctional_0x60_islice_512aa7be2811ad88 ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) &  __src_rename_at_143, int32_t __start_rename_at_143, int32_t __stop_rename_at_143 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &))>::cast(_Funcbuiltin_0x60_each_ref_a42878a1c521709b(__context__,das_ascend<bool,_lambda_thismodule_153_12_31>::make(__context__,&__type_info__b7347bdc594e7ec0,(([&]() -> _lambda_thismodule_153_12_31 {
+		_lambda_thismodule_153_12_31 __mks_152;
+		das_zero(__mks_152);
+		das_copy((__mks_152.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_153_12_31`function XS<::_lambda_thismodule_153_12_31> &1<0<i;f>U>?*/ 8468170942995423519u))));
+		das_copy((__mks_152.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_153_12_31`finalizer X1<S<::_lambda_thismodule_153_12_31>>?*/ 7197705300203597564u))));
+		das_move((__mks_152.src),(__src_rename_at_143));
+		das_copy((__mks_152.start),(__start_rename_at_143));
+		das_copy((__mks_152.stop),(__stop_rename_at_143));
+		return __mks_152;
+	})()))));
+}
+
+inline void finalize_d954bc5c1531c3e8 ( Context * __context__, _lambda_thismodule_32_12_27 &  ____this_rename_at_32 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),__context__);
+	memset(&(____this_rename_at_32), 0, 72);
+}
+
+inline void finalize_5b1a9415fc6c513f ( Context * __context__, _lambda_thismodule_132_12_28 &  ____this_rename_at_132 )
+{
+	_Funcbuiltin_0x60_finalize_943699eaf2940908(__context__,das_arg<TArray<TTuple<8,int32_t,float>>>::pass(____this_rename_at_132.arr));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_132._source_0_at_133),__context__);
+	finalize_554c45dda146b8a6(__context__,das_arg<TTuple<8,int32_t,float>>::pass(____this_rename_at_132.x));
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_132.___source_0_at_137_rename_at_137),__context__);
+	memset(&(____this_rename_at_132), 0, 120);
+}
+
+inline Sequence DAS_COMMENT((int32_t &)) _Funcbuiltin_0x60_each_a87e3fc9767b4917 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_471 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_472; das_zero(__it_rename_at_472);
+	builtin_make_good_array_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_472),__a_rename_at_471,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t &))>::cast(__it_rename_at_472);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_17e595ccf2ea82f6 ( Context * __context__, TArray<TArray<int32_t>> &  __Arr_rename_at_156, TArray<int32_t> const  &  __value_rename_at_156 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_2,cast<TArray<TArray<int32_t>> &>::from(__Arr_rename_at_156)));
+	_Funcbuiltin_0x60_clone_4bc3594d348ca0bd(__context__,das_arg<TArray<int32_t>>::pass(__Arr_rename_at_156(builtin_array_push_back_zero(das_arg<TArray<TArray<int32_t>>>::pass(__Arr_rename_at_156),24,__context__),__context__)),__value_rename_at_156);
+}
+
+inline bool _Func_lambda_thismodule_132_12_29_0x60_function_7d490eafd2c92d0c ( Context * __context__, _lambda_thismodule_132_12_29 &  ____this_rename_at_132, TArray<int32_t> * & ___ryield132_rename_at_132 )
+{
+	Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_137_16_32;
+	switch (____this_rename_at_132.__yield) {
+	case 0: goto label_0;
+	case 8: goto label_8;
+	case 7: goto label_7;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	case 5: goto label_5;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	memset(&(____this_rename_at_132.arr), 0, 24);
+	das_copy(____this_rename_at_132._loop_at_133,true);
+	das_move(____this_rename_at_132._source_0_at_133,____this_rename_at_132.src);
+	memset(&(____this_rename_at_132.x), 0, 24);
+	das_copy(____this_rename_at_132._pvar_0_at_133,das_ref(__context__,____this_rename_at_132.x));
+	DAS_SETBOOLAND((____this_rename_at_132._loop_at_133),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_132._source_0_at_133),____this_rename_at_132._pvar_0_at_133,__context__)));
+	label_8:;;
+	if ( !____this_rename_at_132._loop_at_133 )
+	{
+		goto label_10;
+	};
+	das_copy(___ryield132_rename_at_132,das_ref(__context__,____this_rename_at_132.x));
+	das_copy(____this_rename_at_132.__yield,7);
+	return das_auto_cast<bool>::cast(true);
+	label_7:;;
+	_Funcbuiltin_0x60_push_clone_17e595ccf2ea82f6(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____this_rename_at_132.arr),das_arg<TArray<int32_t>>::pass(____this_rename_at_132.x));
+	label_9:;;
+	DAS_SETBOOLAND((____this_rename_at_132._loop_at_133),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_132._source_0_at_133),____this_rename_at_132._pvar_0_at_133,__context__)));
+	goto label_8;
+	label_10:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_132._source_0_at_133),____this_rename_at_132._pvar_0_at_133,__context__);
+	label_5:;;
+	das_copy(____this_rename_at_132.___loop_at_137_rename_at_137,true);
+	das_move(____this_rename_at_132.___source_0_at_137_rename_at_137,(_temp_make_local_137_16_32 = (_Funcbuiltin_0x60_each_e5c085c7199596c7(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____this_rename_at_132.arr)))));
+	memset(&(____this_rename_at_132.__x_rename_at_137), 0, 8);
+	das_copy(____this_rename_at_132.___pvar_0_at_137_rename_at_137,das_ref(__context__,____this_rename_at_132.__x_rename_at_137));
+	DAS_SETBOOLAND((____this_rename_at_132.___loop_at_137_rename_at_137),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_132.___source_0_at_137_rename_at_137),____this_rename_at_132.___pvar_0_at_137_rename_at_137,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_132.___loop_at_137_rename_at_137 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield132_rename_at_132,das_ref(__context__,das_deref(__context__,____this_rename_at_132.__x_rename_at_137)));
+	das_copy(____this_rename_at_132.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_132.___loop_at_137_rename_at_137),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_132.___source_0_at_137_rename_at_137),____this_rename_at_132.___pvar_0_at_137_rename_at_137,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(____this_rename_at_132.___source_0_at_137_rename_at_137),____this_rename_at_132.___pvar_0_at_137_rename_at_137,__context__);
+	goto label_5;
+	label_6:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_132_12_29_0x60_finalizer_ea6bb7fa1060675c ( Context * __context__, _lambda_thismodule_132_12_29 * ____this_rename_at_132 )
+{
+	builtin_array_clear_lock(das_arg<TArray<TArray<int32_t>>>::pass(das_deref(__context__,____this_rename_at_132).arr),__context__);
+	finalize_c46c891cf327d7cc(__context__,das_arg<_lambda_thismodule_132_12_29>::pass(das_deref(__context__,____this_rename_at_132)));
+	das_delete_lambda_struct<_lambda_thismodule_132_12_29 *>::clear(__context__,____this_rename_at_132);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcbuiltin_0x60_each_ref_a42878a1c521709b ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float> * &)) const  __lam_rename_at_483 )
+{
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) __it_rename_at_484; das_zero(__it_rename_at_484);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(__it_rename_at_484),__lam_rename_at_483,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &))>::cast(__it_rename_at_484);
+}
+
+inline void _Func_0x60_verify_even_b071089197a7ced6 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __arr_rename_at_19 )
+{
+	{
+		bool __need_loop_20 = true;
+		// x : int const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__arr_rename_at_19);
+		int32_t __x_rename_at_20;
+		__need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20)) && __need_loop_20;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,50));
+		int32_t __y_rename_at_20;
+		__need_loop_20 = __y_iterator.first(__context__,(__y_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20)) && __y_iterator.next(__context__,(__y_rename_at_20)) )
+		{
+			DAS_ASSERT((__x_rename_at_20 == (__y_rename_at_20 * 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_20));
+		__y_iterator.close(__context__,(__y_rename_at_20));
+	};
+}
+
+inline bool _Funcfunctional_0x60_any_cf35c74e31a01f2b ( Context * __context__, Sequence DAS_COMMENT((bool)) const  &  __it_rename_at_93 )
+{
+	{
+		bool __need_loop_99 = true;
+		// x : bool const
+		das_iterator<Sequence DAS_COMMENT((bool)) const > __x_iterator(__it_rename_at_93);
+		bool __x_rename_at_99;
+		__need_loop_99 = __x_iterator.first(__context__,(__x_rename_at_99)) && __need_loop_99;
+		for ( ; __need_loop_99 ; __need_loop_99 = __x_iterator.next(__context__,(__x_rename_at_99)) )
+		{
+			if ( __x_rename_at_99 )
+			{
+				return das_auto_cast<bool>::cast(true);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_99));
+	};
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline bool _Funcfunctional_0x60_all_927327c38b4c115b ( Context * __context__, Sequence DAS_COMMENT((bool)) const  &  __it_rename_at_105 )
+{
+	{
+		bool __need_loop_111 = true;
+		// x : bool const
+		das_iterator<Sequence DAS_COMMENT((bool)) const > __x_iterator(__it_rename_at_105);
+		bool __x_rename_at_111;
+		__need_loop_111 = __x_iterator.first(__context__,(__x_rename_at_111)) && __need_loop_111;
+		for ( ; __need_loop_111 ; __need_loop_111 = __x_iterator.next(__context__,(__x_rename_at_111)) )
+		{
+			if ( !__x_rename_at_111 )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_111));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline bool _Func_0x60_is_same_dfa418e31d233806 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __a_rename_at_37, Sequence DAS_COMMENT((int32_t)) const  &  __b_rename_at_37 )
+{
+	{
+		bool __need_loop_38 = true;
+		// x : int const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__a_rename_at_37);
+		int32_t __x_rename_at_38;
+		__need_loop_38 = __x_iterator.first(__context__,(__x_rename_at_38)) && __need_loop_38;
+		// y : int const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __y_iterator(__b_rename_at_37);
+		int32_t __y_rename_at_38;
+		__need_loop_38 = __y_iterator.first(__context__,(__y_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __x_iterator.next(__context__,(__x_rename_at_38)) && __y_iterator.next(__context__,(__y_rename_at_38)) )
+		{
+			if ( __x_rename_at_38 != __y_rename_at_38 )
+			{
+				return das_auto_cast<bool>::cast(false);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_38));
+		__y_iterator.close(__context__,(__y_rename_at_38));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void finalize_9f43dfdcfe3beb0e ( Context * __context__, _lambda_thismodule_10_12_21 &  ____this_rename_at_10 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),__context__);
+	memset(&(____this_rename_at_10), 0, 72);
+}
+
+inline void finalize_813bce9eea228d97 ( Context * __context__, _lambda_thismodule_10_12_22 &  ____this_rename_at_10 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),__context__);
+	memset(&(____this_rename_at_10), 0, 72);
+}
+
+inline void finalize_7b71d48649e95514 ( Context * __context__, _lambda_thismodule_32_12_23 &  ____this_rename_at_32 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),__context__);
+	memset(&(____this_rename_at_32), 0, 72);
+}
+
+inline void finalize_396e7fbc677b3265 ( Context * __context__, _lambda_thismodule_32_12_24 &  ____this_rename_at_32 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),__context__);
+	memset(&(____this_rename_at_32), 0, 72);
+}
+
+inline void finalize_c08c6d331036ffee ( Context * __context__, _lambda_thismodule_32_12_25 &  ____this_rename_at_32 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),__context__);
+	memset(&(____this_rename_at_32), 0, 72);
+}
+
+inline void finalize_2b16ae00fd6cbbd8 ( Context * __context__, _lambda_thismodule_91_25_26 &  ____this_rename_at_91 )
+{
+	memset(&(____this_rename_at_91), 0, 16);
+}
+
+inline bool _Func_lambda_thismodule_32_12_27_0x60_function_d147be9547759e46 ( Context * __context__, _lambda_thismodule_32_12_27 &  ____this_rename_at_32, TTuple<8,int32_t,float> &  ___yield_32_rename_at_32 )
+{
+	switch (____this_rename_at_32.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_32._loop_at_32,true);
+	das_move(____this_rename_at_32._source_0_at_32,____this_rename_at_32.src);
+	memset(&(____this_rename_at_32.w), 0, 4);
+	das_copy(____this_rename_at_32._pvar_0_at_32,das_ref(__context__,____this_rename_at_32.w));
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_32._loop_at_32 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_32_rename_at_32,das_invoke_lambda<TTuple<8,int32_t,float>>::invoke_cmres<int32_t>(__context__,nullptr,____this_rename_at_32.blk,____this_rename_at_32.w));
+	das_copy(____this_rename_at_32.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_32_12_27_0x60_finalizer_f0b7c8307943e9f0 ( Context * __context__, _lambda_thismodule_32_12_27 * ____this_rename_at_32 )
+{
+	finalize_d954bc5c1531c3e8(__context__,das_arg<_lambda_thismodule_32_12_27>::pass(das_deref(__context__,____this_rename_at_32)));
+	das_delete_lambda_struct<_lambda_thismodule_32_12_27 *>::clear(__context__,____this_rename_at_32);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_ad6a7f9847ce0226 ( Context * __context__, TArray<TTuple<8,int32_t,float>> &  __Arr_rename_at_156, TTuple<8,int32_t,float> const  &  __value_rename_at_156 )
+{
+	das_copy(__Arr_rename_at_156(builtin_array_push_back_zero(das_arg<TArray<TTuple<8,int32_t,float>>>::pass(__Arr_rename_at_156),8,__context__),__context__),__value_rename_at_156);
+}
+
+inline bool _Func_lambda_thismodule_132_12_28_0x60_function_3db3659e3c49d80f ( Context * __context__, _lambda_thismodule_132_12_28 &  ____this_rename_at_132, TTuple<8,int32_t,float> * & ___ryield132_rename_at_132 )
+{
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) _temp_make_local_137_16_32;
+	switch (____this_rename_at_132.__yield) {
+	case 0: goto label_0;
+	case 8: goto label_8;
+	case 7: goto label_7;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	case 5: goto label_5;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	memset(&(____this_rename_at_132.arr), 0, 24);
+	das_copy(____this_rename_at_132._loop_at_133,true);
+	das_move(____this_rename_at_132._source_0_at_133,____this_rename_at_132.src);
+	memset(&(____this_rename_at_132.x), 0, 8);
+	das_copy(____this_rename_at_132._pvar_0_at_133,das_ref(__context__,____this_rename_at_132.x));
+	DAS_SETBOOLAND((____this_rename_at_132._loop_at_133),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_132._source_0_at_133),____this_rename_at_132._pvar_0_at_133,__context__)));
+	label_8:;;
+	if ( !____this_rename_at_132._loop_at_133 )
+	{
+		goto label_10;
+	};
+	das_copy(___ryield132_rename_at_132,das_ref(__context__,____this_rename_at_132.x));
+	das_copy(____this_rename_at_132.__yield,7);
+	return das_auto_cast<bool>::cast(true);
+	label_7:;;
+	_Funcbuiltin_0x60_push_clone_ad6a7f9847ce0226(__context__,das_arg<TArray<TTuple<8,int32_t,float>>>::pass(____this_rename_at_132.arr),das_arg<TTuple<8,int32_t,float>>::pass(____this_rename_at_132.x));
+	label_9:;;
+	DAS_SETBOOLAND((____this_rename_at_132._loop_at_133),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_132._source_0_at_133),____this_rename_at_132._pvar_0_at_133,__context__)));
+	goto label_8;
+	label_10:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_132._source_0_at_133),____this_rename_at_132._pvar_0_at_133,__context__);
+	label_5:;;
+	das_copy(____this_rename_at_132.___loop_at_137_rename_at_137,true);
+	das_move(____this_rename_at_132.___source_0_at_137_rename_at_137,(_temp_make_local_137_16_32 = (_Funcbuiltin_0x60_each_6a927dd59cc9e5af(__context__,das_arg<TArray<TTuple<8,int32_t,float>>>::pass(____this_rename_at_132.arr)))));
+	memset(&(____this_rename_at_132.__x_rename_at_137), 0, 8);
+	das_copy(____this_rename_at_132.___pvar_0_at_137_rename_at_137,das_ref(__context__,____this_rename_at_132.__x_rename_at_137));
+	DAS_SETBOOLAND((____this_rename_at_132.___loop_at_137_rename_at_137),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_132.___source_0_at_137_rename_at_137),____this_rename_at_132.___pvar_0_at_137_rename_at_137,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_132.___loop_at_137_rename_at_137 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield132_rename_at_132,das_ref(__context__,das_deref(__context__,____this_rename_at_132.__x_rename_at_137)));
+	das_copy(____this_rename_at_132.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_132.___loop_at_137_rename_at_137),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_132.___source_0_at_137_rename_at_137),____this_rename_at_132.___pvar_0_at_137_rename_at_137,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(____this_rename_at_132.___source_0_at_137_rename_at_137),____this_rename_at_132.___pvar_0_at_137_rename_at_137,__context__);
+	goto label_5;
+	label_6:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_132_12_28_0x60_finalizer_783b74ffb2f82a90 ( Context * __context__, _lambda_thismodule_132_12_28 * ____this_rename_at_132 )
+{
+	builtin_array_clear_lock(das_arg<TArray<TTuple<8,int32_t,float>>>::pass(das_deref(__context__,____this_rename_at_132).arr),__context__);
+	finalize_5b1a9415fc6c513f(__context__,das_arg<_lambda_thismodule_132_12_28>::pass(das_deref(__context__,____this_rename_at_132)));
+	das_delete_lambda_struct<_lambda_thismodule_132_12_28 *>::clear(__context__,____this_rename_at_132);
+}
+
+inline Sequence DAS_COMMENT((bool)) _Funcbuiltin_0x60_each_32709ce2e3c1fbc5 ( Context * __context__, Lambda DAS_COMMENT((bool,bool &)) const  __lam_rename_at_476 )
+{
+	Sequence DAS_COMMENT((bool)) __it_rename_at_478; das_zero(__it_rename_at_478);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((bool))>::pass(__it_rename_at_478),__lam_rename_at_476,1,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((bool))>::cast(__it_rename_at_478);
+}
+
+inline void finalize_37c401bbe712aa43 ( Context * __context__, _lambda_thismodule_147_12_19 &  ____this_rename_at_147 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_147._source_0_at_147),__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_147._source_1_at_147),__context__);
+	memset(&(____this_rename_at_147), 0, 96);
+}
+
+inline void finalize_c32e57face1564c ( Context * __context__, _lambda_thismodule_120_12_20 &  ____this_rename_at_120 )
+{
+	builtin_array_free(das_arg<TArray<int32_t>>::pass(____this_rename_at_120.arr),4,__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_120._source_0_at_121),__context__);
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_120.___source_0_at_125_rename_at_125),__context__);
+	memset(&(____this_rename_at_120), 0, 120);
+}
+
+inline bool _Func_lambda_thismodule_10_12_21_0x60_function_fc1ca1e77ce10205 ( Context * __context__, _lambda_thismodule_10_12_21 &  ____this_rename_at_10, int32_t & ___yield_10_rename_at_10 )
+{
+	switch (____this_rename_at_10.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_10._loop_at_10,true);
+	das_move(____this_rename_at_10._source_0_at_10,____this_rename_at_10.src);
+	memset(&(____this_rename_at_10.w), 0, 4);
+	das_copy(____this_rename_at_10._pvar_0_at_10,das_ref(__context__,____this_rename_at_10.w));
+	DAS_SETBOOLAND((____this_rename_at_10._loop_at_10),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),____this_rename_at_10._pvar_0_at_10,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_10._loop_at_10 )
+	{
+		goto label_5;
+	};
+	if ( !das_invoke_function<bool>::invoke<int32_t>(__context__,nullptr,____this_rename_at_10.blk,____this_rename_at_10.w) )
+	{
+		goto label_2;
+	};
+	das_copy(___yield_10_rename_at_10,____this_rename_at_10.w);
+	das_copy(____this_rename_at_10.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_10._loop_at_10),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),____this_rename_at_10._pvar_0_at_10,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),____this_rename_at_10._pvar_0_at_10,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_10_12_21_0x60_finalizer_6cc1eed0b9a897f4 ( Context * __context__, _lambda_thismodule_10_12_21 * ____this_rename_at_10 )
+{
+	finalize_9f43dfdcfe3beb0e(__context__,das_arg<_lambda_thismodule_10_12_21>::pass(das_deref(__context__,____this_rename_at_10)));
+	das_delete_lambda_struct<_lambda_thismodule_10_12_21 *>::clear(__context__,____this_rename_at_10);
+}
+
+inline bool _Func_lambda_thismodule_10_12_22_0x60_function_63e23fcd6be7b2a8 ( Context * __context__, _lambda_thismodule_10_12_22 &  ____this_rename_at_10, int32_t & ___yield_10_rename_at_10 )
+{
+	switch (____this_rename_at_10.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_10._loop_at_10,true);
+	das_move(____this_rename_at_10._source_0_at_10,____this_rename_at_10.src);
+	memset(&(____this_rename_at_10.w), 0, 4);
+	das_copy(____this_rename_at_10._pvar_0_at_10,das_ref(__context__,____this_rename_at_10.w));
+	DAS_SETBOOLAND((____this_rename_at_10._loop_at_10),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),____this_rename_at_10._pvar_0_at_10,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_10._loop_at_10 )
+	{
+		goto label_5;
+	};
+	if ( !das_invoke_lambda<bool>::invoke<int32_t>(__context__,nullptr,____this_rename_at_10.blk,____this_rename_at_10.w) )
+	{
+		goto label_2;
+	};
+	das_copy(___yield_10_rename_at_10,____this_rename_at_10.w);
+	das_copy(____this_rename_at_10.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_10._loop_at_10),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),____this_rename_at_10._pvar_0_at_10,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_10._source_0_at_10),____this_rename_at_10._pvar_0_at_10,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_10_12_22_0x60_finalizer_bae38db824aeb9e4 ( Context * __context__, _lambda_thismodule_10_12_22 * ____this_rename_at_10 )
+{
+	finalize_813bce9eea228d97(__context__,das_arg<_lambda_thismodule_10_12_22>::pass(das_deref(__context__,____this_rename_at_10)));
+	das_delete_lambda_struct<_lambda_thismodule_10_12_22 *>::clear(__context__,____this_rename_at_10);
+}
+
+inline bool _Func_lambda_thismodule_32_12_23_0x60_function_2e741abb3aa6adb0 ( Context * __context__, _lambda_thismodule_32_12_23 &  ____this_rename_at_32, int32_t & ___yield_32_rename_at_32 )
+{
+	switch (____this_rename_at_32.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_32._loop_at_32,true);
+	das_move(____this_rename_at_32._source_0_at_32,____this_rename_at_32.src);
+	memset(&(____this_rename_at_32.w), 0, 4);
+	das_copy(____this_rename_at_32._pvar_0_at_32,das_ref(__context__,____this_rename_at_32.w));
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_32._loop_at_32 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_32_rename_at_32,das_invoke_function<int32_t>::invoke<int32_t>(__context__,nullptr,____this_rename_at_32.blk,____this_rename_at_32.w));
+	das_copy(____this_rename_at_32.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_32_12_23_0x60_finalizer_87217fcfa3f68a10 ( Context * __context__, _lambda_thismodule_32_12_23 * ____this_rename_at_32 )
+{
+	finalize_7b71d48649e95514(__context__,das_arg<_lambda_thismodule_32_12_23>::pass(das_deref(__context__,____this_rename_at_32)));
+	das_delete_lambda_struct<_lambda_thismodule_32_12_23 *>::clear(__context__,____this_rename_at_32);
+}
+
+inline bool _Func_lambda_thismodule_32_12_24_0x60_function_b489ed5292d4adb1 ( Context * __context__, _lambda_thismodule_32_12_24 &  ____this_rename_at_32, int32_t & ___yield_32_rename_at_32 )
+{
+	switch (____this_rename_at_32.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_32._loop_at_32,true);
+	das_move(____this_rename_at_32._source_0_at_32,____this_rename_at_32.src);
+	memset(&(____this_rename_at_32.w), 0, 4);
+	das_copy(____this_rename_at_32._pvar_0_at_32,das_ref(__context__,____this_rename_at_32.w));
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_32._loop_at_32 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_32_rename_at_32,das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,nullptr,____this_rename_at_32.blk,____this_rename_at_32.w));
+	das_copy(____this_rename_at_32.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_32_12_24_0x60_finalizer_9cf00ca9417815b4 ( Context * __context__, _lambda_thismodule_32_12_24 * ____this_rename_at_32 )
+{
+	finalize_396e7fbc677b3265(__context__,das_arg<_lambda_thismodule_32_12_24>::pass(das_deref(__context__,____this_rename_at_32)));
+	das_delete_lambda_struct<_lambda_thismodule_32_12_24 *>::clear(__context__,____this_rename_at_32);
+}
+
+inline bool _Func_lambda_thismodule_32_12_25_0x60_function_998f9452d47a6b9d ( Context * __context__, _lambda_thismodule_32_12_25 &  ____this_rename_at_32, bool & ___yield_32_rename_at_32 )
+{
+	switch (____this_rename_at_32.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_32._loop_at_32,true);
+	das_move(____this_rename_at_32._source_0_at_32,____this_rename_at_32.src);
+	memset(&(____this_rename_at_32.w), 0, 4);
+	das_copy(____this_rename_at_32._pvar_0_at_32,das_ref(__context__,____this_rename_at_32.w));
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_32._loop_at_32 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_32_rename_at_32,das_invoke_lambda<bool>::invoke<int32_t>(__context__,nullptr,____this_rename_at_32.blk,____this_rename_at_32.w));
+	das_copy(____this_rename_at_32.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_32._loop_at_32),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_32._source_0_at_32),____this_rename_at_32._pvar_0_at_32,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_32_12_25_0x60_finalizer_6405205b252e1870 ( Context * __context__, _lambda_thismodule_32_12_25 * ____this_rename_at_32 )
+{
+	finalize_c08c6d331036ffee(__context__,das_arg<_lambda_thismodule_32_12_25>::pass(das_deref(__context__,____this_rename_at_32)));
+	das_delete_lambda_struct<_lambda_thismodule_32_12_25 *>::clear(__context__,____this_rename_at_32);
+}
+
+inline bool _Func_lambda_thismodule_91_25_26_0x60_function_15f2a680f0c86a65 ( Context * __context__, _lambda_thismodule_91_25_26 &  ____this_rename_at_91, TArray<int32_t> const  &  __x_rename_at_91 )
+{
+	return das_auto_cast<bool>::cast((SimPolicy<int32_t>::Mod(__x_rename_at_91(0,__context__),2,*__context__,nullptr)) == 0);
+}
+
+inline void _Func_lambda_thismodule_91_25_26_0x60_finalizer_17737d2831ca41c6 ( Context * __context__, _lambda_thismodule_91_25_26 * ____this_rename_at_91 )
+{
+	finalize_2b16ae00fd6cbbd8(__context__,das_arg<_lambda_thismodule_91_25_26>::pass(das_deref(__context__,____this_rename_at_91)));
+	das_delete_lambda_struct<_lambda_thismodule_91_25_26 *>::clear(__context__,____this_rename_at_91);
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_filter_any_8ac13c6d58727a6f ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_7, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) __blk_rename_at_7 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(_Funcbuiltin_0x60_each_ref_ecc07dbeee89a093(__context__,das_ascend<bool,_lambda_thismodule_16_12_30>::make(__context__,&__type_info__7f1bcfa1de88e6ed,(([&]() -> _lambda_thismodule_16_12_30 {
+		_lambda_thismodule_16_12_30 __mks_15;
+		das_zero(__mks_15);
+		das_copy((__mks_15.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_16_12_30`function XS<::_lambda_thismodule_16_12_30> &1<1<i>A>?*/ 8472641604803922615u))));
+		das_copy((__mks_15.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_16_12_30`finalizer X1<S<::_lambda_thismodule_16_12_30>>?*/ 18412142008793088354u))));
+		das_move((__mks_15.blk),(__blk_rename_at_7));
+		das_move((__mks_15.src),(__src_rename_at_7));
+		return __mks_15;
+	})()))));
+}
+
+inline bool _Func_lambda_thismodule_147_12_19_0x60_function_93f0381787fb4a78 ( Context * __context__, _lambda_thismodule_147_12_19 &  ____this_rename_at_147, int32_t & ___yield_147_rename_at_147 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_147_12_32;
+	switch (____this_rename_at_147.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_147._loop_at_147,true);
+	das_move(____this_rename_at_147._source_0_at_147,____this_rename_at_147.src);
+	memset(&(____this_rename_at_147.x), 0, 4);
+	das_copy(____this_rename_at_147._pvar_0_at_147,das_ref(__context__,____this_rename_at_147.x));
+	DAS_SETBOOLAND((____this_rename_at_147._loop_at_147),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_147._source_0_at_147),____this_rename_at_147._pvar_0_at_147,__context__)));
+	das_move(____this_rename_at_147._source_1_at_147,(_temp_make_local_147_12_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,mk_range(____this_rename_at_147.stop)))));
+	memset(&(____this_rename_at_147.i), 0, 4);
+	das_copy(____this_rename_at_147._pvar_1_at_147,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_147.i)));
+	DAS_SETBOOLAND((____this_rename_at_147._loop_at_147),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_147._source_1_at_147),____this_rename_at_147._pvar_1_at_147,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_147._loop_at_147 )
+	{
+		goto label_5;
+	};
+	if ( !(____this_rename_at_147.i >= ____this_rename_at_147.start) )
+	{
+		goto label_2;
+	};
+	das_copy(___yield_147_rename_at_147,____this_rename_at_147.x);
+	das_copy(____this_rename_at_147.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_147._loop_at_147),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_147._source_0_at_147),____this_rename_at_147._pvar_0_at_147,__context__)));
+	DAS_SETBOOLAND((____this_rename_at_147._loop_at_147),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_147._source_1_at_147),____this_rename_at_147._pvar_1_at_147,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_147._source_0_at_147),____this_rename_at_147._pvar_0_at_147,__context__);
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_147._source_1_at_147),____this_rename_at_147._pvar_1_at_147,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_147_12_19_0x60_finalizer_b08b52f53fe2adaa ( Context * __context__, _lambda_thismodule_147_12_19 * ____this_rename_at_147 )
+{
+	finalize_37c401bbe712aa43(__context__,das_arg<_lambda_thismodule_147_12_19>::pass(das_deref(__context__,____this_rename_at_147)));
+	das_delete_lambda_struct<_lambda_thismodule_147_12_19 *>::clear(__context__,____this_rename_at_147);
+}
+
+inline bool _Func_lambda_thismodule_120_12_20_0x60_function_4b1f73fc73a6c778 ( Context * __context__, _lambda_thismodule_120_12_20 &  ____this_rename_at_120, int32_t & ___yield_120_rename_at_120 )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_125_16_32;
+	switch (____this_rename_at_120.__yield) {
+	case 0: goto label_0;
+	case 8: goto label_8;
+	case 7: goto label_7;
+	case 9: goto label_9;
+	case 10: goto label_10;
+	case 5: goto label_5;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	memset(&(____this_rename_at_120.arr), 0, 24);
+	das_copy(____this_rename_at_120._loop_at_121,true);
+	das_move(____this_rename_at_120._source_0_at_121,____this_rename_at_120.src);
+	memset(&(____this_rename_at_120.x), 0, 4);
+	das_copy(____this_rename_at_120._pvar_0_at_121,das_ref(__context__,____this_rename_at_120.x));
+	DAS_SETBOOLAND((____this_rename_at_120._loop_at_121),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_120._source_0_at_121),____this_rename_at_120._pvar_0_at_121,__context__)));
+	label_8:;;
+	if ( !____this_rename_at_120._loop_at_121 )
+	{
+		goto label_10;
+	};
+	das_copy(___yield_120_rename_at_120,____this_rename_at_120.x);
+	das_copy(____this_rename_at_120.__yield,7);
+	return das_auto_cast<bool>::cast(true);
+	label_7:;;
+	_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_120.arr),____this_rename_at_120.x);
+	label_9:;;
+	DAS_SETBOOLAND((____this_rename_at_120._loop_at_121),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_120._source_0_at_121),____this_rename_at_120._pvar_0_at_121,__context__)));
+	goto label_8;
+	label_10:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_120._source_0_at_121),____this_rename_at_120._pvar_0_at_121,__context__);
+	label_5:;;
+	das_copy(____this_rename_at_120.___loop_at_125_rename_at_125,true);
+	das_move(____this_rename_at_120.___source_0_at_125_rename_at_125,(_temp_make_local_125_16_32 = (_Funcbuiltin_0x60_each_a87e3fc9767b4917(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_120.arr)))));
+	memset(&(____this_rename_at_120.__x_rename_at_125), 0, 8);
+	das_copy(____this_rename_at_120.___pvar_0_at_125_rename_at_125,das_ref(__context__,____this_rename_at_120.__x_rename_at_125));
+	DAS_SETBOOLAND((____this_rename_at_120.___loop_at_125_rename_at_125),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_120.___source_0_at_125_rename_at_125),____this_rename_at_120.___pvar_0_at_125_rename_at_125,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_120.___loop_at_125_rename_at_125 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_120_rename_at_120,das_deref(__context__,____this_rename_at_120.__x_rename_at_125));
+	das_copy(____this_rename_at_120.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_120.___loop_at_125_rename_at_125),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_120.___source_0_at_125_rename_at_125),____this_rename_at_120.___pvar_0_at_125_rename_at_125,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_120.___source_0_at_125_rename_at_125),____this_rename_at_120.___pvar_0_at_125_rename_at_125,__context__);
+	goto label_5;
+	label_6:;;
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_120_12_20_0x60_finalizer_3735d8877c952ae0 ( Context * __context__, _lambda_thismodule_120_12_20 * ____this_rename_at_120 )
+{
+	builtin_array_clear_lock(das_arg<TArray<int32_t>>::pass(das_deref(__context__,____this_rename_at_120).arr),__context__);
+	finalize_c32e57face1564c(__context__,das_arg<_lambda_thismodule_120_12_20>::pass(das_deref(__context__,____this_rename_at_120)));
+	das_delete_lambda_struct<_lambda_thismodule_120_12_20 *>::clear(__context__,____this_rename_at_120);
+}
+
+inline void finalize_d2bdfafa2f479e21 ( Context * __context__, _lambda_thismodule_71_25_14 &  ____this_rename_at_71 )
+{
+	memset(&(____this_rename_at_71), 0, 16);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_any_ee3d36589b55482d ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  __it_rename_at_56, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __functor_rename_at_56 )
+{
+	int32_t __left_rename_at_57 = 0;
+	bool __first_rename_at_58 = true;
+	{
+		bool __need_loop_59 = true;
+		// right : int aka TT const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const )) const > __right_iterator(__it_rename_at_56);
+		int32_t const  * __right_rename_at_59;
+		__need_loop_59 = __right_iterator.first(__context__,(__right_rename_at_59)) && __need_loop_59;
+		for ( ; __need_loop_59 ; __need_loop_59 = __right_iterator.next(__context__,(__right_rename_at_59)) )
+		{
+			if ( __first_rename_at_58 )
+			{
+				das_copy(__first_rename_at_58,false);
+				das_copy(__left_rename_at_57,(*__right_rename_at_59));
+			} else {
+				das_copy(__left_rename_at_57,das_invoke<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,__functor_rename_at_56,__left_rename_at_57,(*__right_rename_at_59)));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_59));
+	};
+	if ( __first_rename_at_58 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+	return das_auto_cast<int32_t>::cast(__left_rename_at_57);
+}
+
+inline void finalize_b1fbd3f7f17aa107 ( Context * __context__, _lambda_thismodule_115_27_15 &  ____this_rename_at_115 )
+{
+	memset(&(____this_rename_at_115), 0, 16);
+}
+
+inline void finalize_4e811d32879905fb ( Context * __context__, _lambda_thismodule_163_30_16 &  ____this_rename_at_163 )
+{
+	memset(&(____this_rename_at_163), 0, 16);
+}
+
+inline void finalize_9241f8123a6109c0 ( Context * __context__, _lambda_thismodule_172_30_17 &  ____this_rename_at_172 )
+{
+	memset(&(____this_rename_at_172), 0, 16);
+}
+
+inline void finalize_3da670ae0d0fd49c ( Context * __context__, _lambda_thismodule_180_30_18 &  ____this_rename_at_180 )
+{
+	memset(&(____this_rename_at_180), 0, 16);
+}
+
+inline void _Funcbuiltin_0x60_push_clone_caf6494d1f59cf4e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_156, int32_t __value_rename_at_156 )
+{
+	das_copy(__Arr_rename_at_156(builtin_array_push_back_zero(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_156),4,__context__),__context__),__value_rename_at_156);
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Func_0x60_verify_14_c7953d9d52dffeef ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) const  &  __t_rename_at_43 )
+{
+	{
+		bool __need_loop_44 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(1,4));
+		int32_t __x_rename_at_44;
+		__need_loop_44 = __x_iterator.first(__context__,(__x_rename_at_44)) && __need_loop_44;
+		// y : array<int> const
+		das_iterator<Sequence DAS_COMMENT((TArray<int32_t>)) const > __y_iterator(__t_rename_at_43);
+		TArray<int32_t> const  __y_rename_at_44;
+		__need_loop_44 = __y_iterator.first(__context__,(__y_rename_at_44)) && __need_loop_44;
+		for ( ; __need_loop_44 ; __need_loop_44 = __x_iterator.next(__context__,(__x_rename_at_44)) && __y_iterator.next(__context__,(__y_rename_at_44)) )
+		{
+			DAS_ASSERT(((__y_rename_at_44(0,__context__) == __x_rename_at_44) && (__y_rename_at_44(1,__context__) == 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_44));
+		__y_iterator.close(__context__,(__y_rename_at_44));
+	};
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_filter_64323d9de00083a ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_21, Lambda DAS_COMMENT((bool,TArray<int32_t> const )) const  __blk_rename_at_21 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(_Funcfunctional_0x60_filter_any_8ac13c6d58727a6f(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__src_rename_at_21),__blk_rename_at_21));
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t> &)) _Funcfunctional_0x60_cycle_25feb1b3c1b57b4d ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  __src_rename_at_116 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t> &))>::cast(_Funcbuiltin_0x60_each_ref_ecc07dbeee89a093(__context__,das_ascend<bool,_lambda_thismodule_132_12_29>::make(__context__,&__type_info__be112fe42453df14,(([&]() -> _lambda_thismodule_132_12_29 {
+		_lambda_thismodule_132_12_29 __mks_131;
+		das_zero(__mks_131);
+		das_copy((__mks_131.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_132_12_29`function XS<::_lambda_thismodule_132_12_29> &1<1<i>A>?*/ 11394970500639640009u))));
+		das_copy((__mks_131.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_132_12_29`finalizer X1<S<::_lambda_thismodule_132_12_29>>?*/ 13538381615065428264u))));
+		das_move((__mks_131.src),(__src_rename_at_116));
+		return __mks_131;
+	})()))));
+}
+
+inline void finalize_dca9089a796b169e ( Context * __context__, _lambda_thismodule_56_21_10 &  ____this_rename_at_56 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_56._source_0_at_56),__context__);
+	memset(&(____this_rename_at_56), 0, 48);
+}
+
+inline void finalize_3c00f319f5878b9f ( Context * __context__, _lambda_thismodule_90_14_11 &  ____this_rename_at_90 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_90._source_0_at_90),__context__);
+	memset(&(____this_rename_at_90), 0, 48);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcfunctional_0x60_map_any_2c26bc83fad607e0 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_29, Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) __blk_rename_at_29 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::cast(_Funcbuiltin_0x60_each_5b8f7b8f8a92acc2(__context__,das_ascend<bool,_lambda_thismodule_32_12_27>::make(__context__,&__type_info__7e75d5f89b4cf5cb,(([&]() -> _lambda_thismodule_32_12_27 {
+		_lambda_thismodule_32_12_27 __mks_31;
+		das_zero(__mks_31);
+		das_copy((__mks_31.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_32_12_27`function XS<::_lambda_thismodule_32_12_27> 0<i;f>U*/ 9539088504260785859u))));
+		das_copy((__mks_31.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_32_12_27`finalizer X1<S<::_lambda_thismodule_32_12_27>>?*/ 804921687606687922u))));
+		das_move((__mks_31.blk),(__blk_rename_at_29));
+		das_move((__mks_31.src),(__src_rename_at_29));
+		return __mks_31;
+	})()))));
+}
+
+inline void finalize_95e8646aced816cb ( Context * __context__, _lambda_thismodule_240_10_12 &  ____this_rename_at_240 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_240._source_0_at_240),__context__);
+	memset(&(____this_rename_at_240), 0, 48);
+}
+
+inline void finalize_5d81d27f4ab6f1ad ( Context * __context__, _lambda_thismodule_243_18_13 &  ____this_rename_at_243 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_243._source_0_at_243),__context__);
+	memset(&(____this_rename_at_243), 0, 48);
+}
+
+inline void _Func_0x60_verify_even_7e6d5ca7b65b79bf ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  __arr_rename_at_19 )
+{
+	{
+		bool __need_loop_20 = true;
+		// x : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const )) const > __x_iterator(__arr_rename_at_19);
+		int32_t const  * __x_rename_at_20;
+		__need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20)) && __need_loop_20;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,50));
+		int32_t __y_rename_at_20;
+		__need_loop_20 = __y_iterator.first(__context__,(__y_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20)) && __y_iterator.next(__context__,(__y_rename_at_20)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_20) == (__y_rename_at_20 * 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_20));
+		__y_iterator.close(__context__,(__y_rename_at_20));
+	};
+}
+
+inline Sequence DAS_COMMENT((TArray<int32_t>)) _Funcbuiltin_0x60_each_7f633a072c41b03c ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t>)) const  __lam_rename_at_476 )
+{
+	Sequence DAS_COMMENT((TArray<int32_t>)) __it_rename_at_478; das_zero(__it_rename_at_478);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass(__it_rename_at_478),__lam_rename_at_476,24,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TArray<int32_t>))>::cast(__it_rename_at_478);
+}
+
+inline bool _Func_lambda_thismodule_71_25_14_0x60_function_4ef28c57d655e61b ( Context * __context__, _lambda_thismodule_71_25_14 &  ____this_rename_at_71, int32_t __x_rename_at_71 )
+{
+	return das_auto_cast<bool>::cast((SimPolicy<int32_t>::Mod(__x_rename_at_71,2,*__context__,nullptr)) == 0);
+}
+
+inline void _Func_lambda_thismodule_71_25_14_0x60_finalizer_1de86f8b7e406fde ( Context * __context__, _lambda_thismodule_71_25_14 * ____this_rename_at_71 )
+{
+	finalize_d2bdfafa2f479e21(__context__,das_arg<_lambda_thismodule_71_25_14>::pass(das_deref(__context__,____this_rename_at_71)));
+	das_delete_lambda_struct<_lambda_thismodule_71_25_14 *>::clear(__context__,____this_rename_at_71);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_e2370503bc5489f5 ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  __it_rename_at_80, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __blk_rename_at_80 )
+{
+	return das_auto_cast<int32_t>::cast(_Funcfunctional_0x60_reduce_any_ee3d36589b55482d(__context__,__it_rename_at_80,__blk_rename_at_80));
+}
+
+inline int32_t _Func_lambda_thismodule_115_27_15_0x60_function_76c593a2d975afd9 ( Context * __context__, _lambda_thismodule_115_27_15 &  ____this_rename_at_115, int32_t __x_rename_at_115, int32_t __y_rename_at_115 )
+{
+	return das_auto_cast<int32_t>::cast(__x_rename_at_115 + __y_rename_at_115);
+}
+
+inline void _Func_lambda_thismodule_115_27_15_0x60_finalizer_b7ae6dadf312675a ( Context * __context__, _lambda_thismodule_115_27_15 * ____this_rename_at_115 )
+{
+	finalize_b1fbd3f7f17aa107(__context__,das_arg<_lambda_thismodule_115_27_15>::pass(das_deref(__context__,____this_rename_at_115)));
+	das_delete_lambda_struct<_lambda_thismodule_115_27_15 *>::clear(__context__,____this_rename_at_115);
+}
+
+inline bool _Func_lambda_thismodule_163_30_16_0x60_function_7c6e7fcacb6ae853 ( Context * __context__, _lambda_thismodule_163_30_16 &  ____this_rename_at_163, int32_t __x_rename_at_163 )
+{
+	return das_auto_cast<bool>::cast(__x_rename_at_163 > 30);
+}
+
+inline void _Func_lambda_thismodule_163_30_16_0x60_finalizer_1efff7382e84e2aa ( Context * __context__, _lambda_thismodule_163_30_16 * ____this_rename_at_163 )
+{
+	finalize_4e811d32879905fb(__context__,das_arg<_lambda_thismodule_163_30_16>::pass(das_deref(__context__,____this_rename_at_163)));
+	das_delete_lambda_struct<_lambda_thismodule_163_30_16 *>::clear(__context__,____this_rename_at_163);
+}
+
+inline bool _Func_lambda_thismodule_172_30_17_0x60_function_42c5b6ebaac79686 ( Context * __context__, _lambda_thismodule_172_30_17 &  ____this_rename_at_172, int32_t __x_rename_at_172 )
+{
+	return das_auto_cast<bool>::cast(__x_rename_at_172 < 100);
+}
+
+inline void _Func_lambda_thismodule_172_30_17_0x60_finalizer_8ed4bb4bd4545e60 ( Context * __context__, _lambda_thismodule_172_30_17 * ____this_rename_at_172 )
+{
+	finalize_9241f8123a6109c0(__context__,das_arg<_lambda_thismodule_172_30_17>::pass(das_deref(__context__,____this_rename_at_172)));
+	das_delete_lambda_struct<_lambda_thismodule_172_30_17 *>::clear(__context__,____this_rename_at_172);
+}
+
+inline bool _Func_lambda_thismodule_180_30_18_0x60_function_d983c4a30551bc1c ( Context * __context__, _lambda_thismodule_180_30_18 &  ____this_rename_at_180, int32_t __x_rename_at_180 )
+{
+	return das_auto_cast<bool>::cast(__x_rename_at_180 > 0);
+}
+
+inline void _Func_lambda_thismodule_180_30_18_0x60_finalizer_526d77f2b8437988 ( Context * __context__, _lambda_thismodule_180_30_18 * ____this_rename_at_180 )
+{
+	finalize_3da670ae0d0fd49c(__context__,das_arg<_lambda_thismodule_180_30_18>::pass(das_deref(__context__,____this_rename_at_180)));
+	das_delete_lambda_struct<_lambda_thismodule_180_30_18 *>::clear(__context__,____this_rename_at_180);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_937a16f0c7f42db ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_502 )
+{
+	TArray<int32_t> __arr_rename_at_503; das_zero(__arr_rename_at_503);
+	{
+		bool __need_loop_504 = true;
+		// x : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__it_rename_at_502);
+		int32_t __x_rename_at_504;
+		__need_loop_504 = __x_iterator.first(__context__,(__x_rename_at_504)) && __need_loop_504;
+		for ( ; __need_loop_504 ; __need_loop_504 = __x_iterator.next(__context__,(__x_rename_at_504)) )
+		{
+			_Funcbuiltin_0x60_push_clone_caf6494d1f59cf4e(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_503),__x_rename_at_504);
+		}
+		__x_iterator.close(__context__,(__x_rename_at_504));
+	};
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_503);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) _Funcfunctional_0x60_cycle_1fda9f623e354c0f ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) &  __src_rename_at_116 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &))>::cast(_Funcbuiltin_0x60_each_ref_a42878a1c521709b(__context__,das_ascend<bool,_lambda_thismodule_132_12_28>::make(__context__,&__type_info__be14b1e42456f1d1,(([&]() -> _lambda_thismodule_132_12_28 {
+		_lambda_thismodule_132_12_28 __mks_131;
+		das_zero(__mks_131);
+		das_copy((__mks_131.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_132_12_28`function XS<::_lambda_thismodule_132_12_28> &1<0<i;f>U>?*/ 15560983072914810913u))));
+		das_copy((__mks_131.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_132_12_28`finalizer X1<S<::_lambda_thismodule_132_12_28>>?*/ 11321721241087545068u))));
+		das_move((__mks_131.src),(__src_rename_at_116));
+		return __mks_131;
+	})()))));
+}
+
+inline void finalize_9fda4bcc4531188d ( Context * __context__, _lambda_thismodule_163_8_2 &  ____this_rename_at_163 )
+{
+	memset(&(____this_rename_at_163), 0, 24);
+}
+
+inline void finalize_274ecf742fbb4581 ( Context * __context__, _lambda_thismodule_180_8_3 &  ____this_rename_at_180 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_180._source_0_at_183),__context__);
+	memset(&(____this_rename_at_180), 0, 56);
+}
+
+inline void finalize_50a2b26c59df4fa5 ( Context * __context__, _lambda_thismodule_50_23_4 &  ____this_rename_at_50 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50._source_0_at_50),__context__);
+	memset(&(____this_rename_at_50), 0, 48);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_d390534166c9b0fe ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_7, Func DAS_COMMENT((bool,int32_t)) __blk_rename_at_7 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_10_12_21>::make(__context__,&__type_info__acfe83f9d1892cd5,(([&]() -> _lambda_thismodule_10_12_21 {
+		_lambda_thismodule_10_12_21 __mks_9;
+		das_zero(__mks_9);
+		das_copy((__mks_9.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_10_12_21`function XS<::_lambda_thismodule_10_12_21> &i*/ 16178759263744704649u))));
+		das_copy((__mks_9.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_10_12_21`finalizer X1<S<::_lambda_thismodule_10_12_21>>?*/ 4949192709771928642u))));
+		das_move((__mks_9.blk),(__blk_rename_at_7));
+		das_move((__mks_9.src),(__src_rename_at_7));
+		return __mks_9;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_any_16f495c9a4a7b638 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_7, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_7 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_10_12_22>::make(__context__,&__type_info__acf481f9d180d4ea,(([&]() -> _lambda_thismodule_10_12_22 {
+		_lambda_thismodule_10_12_22 __mks_9;
+		das_zero(__mks_9);
+		das_copy((__mks_9.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_10_12_22`function XS<::_lambda_thismodule_10_12_22> &i*/ 1647560581833523341u))));
+		das_copy((__mks_9.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_10_12_22`finalizer X1<S<::_lambda_thismodule_10_12_22>>?*/ 3555566221350202424u))));
+		das_move((__mks_9.blk),(__blk_rename_at_7));
+		das_move((__mks_9.src),(__src_rename_at_7));
+		return __mks_9;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_a5ff5c864782eff8 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_29, Func DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_29 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_32_12_23>::make(__context__,&__type_info__7e6855f89b4191ef,(([&]() -> _lambda_thismodule_32_12_23 {
+		_lambda_thismodule_32_12_23 __mks_31;
+		das_zero(__mks_31);
+		das_copy((__mks_31.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_32_12_23`function XS<::_lambda_thismodule_32_12_23> &i*/ 1921186083502348957u))));
+		das_copy((__mks_31.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_32_12_23`finalizer X1<S<::_lambda_thismodule_32_12_23>>?*/ 10513000611344226058u))));
+		das_move((__mks_31.blk),(__blk_rename_at_29));
+		das_move((__mks_31.src),(__src_rename_at_29));
+		return __mks_31;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_any_44bf1e6652c8539 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_29, Lambda DAS_COMMENT((int32_t,int32_t)) __blk_rename_at_29 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_32_12_24>::make(__context__,&__type_info__7e7953f89b5001bc,(([&]() -> _lambda_thismodule_32_12_24 {
+		_lambda_thismodule_32_12_24 __mks_31;
+		das_zero(__mks_31);
+		das_copy((__mks_31.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_32_12_24`function XS<::_lambda_thismodule_32_12_24> &i*/ 8911661300514564349u))));
+		das_copy((__mks_31.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_32_12_24`finalizer X1<S<::_lambda_thismodule_32_12_24>>?*/ 6484742786648912640u))));
+		das_move((__mks_31.blk),(__blk_rename_at_29));
+		das_move((__mks_31.src),(__src_rename_at_29));
+		return __mks_31;
+	})()))));
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_any_4f62a6a9473e89cc ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_56, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __functor_rename_at_56 )
+{
+	int32_t __left_rename_at_57 = 0;
+	bool __first_rename_at_58 = true;
+	{
+		bool __need_loop_59 = true;
+		// right : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __right_iterator(__it_rename_at_56);
+		int32_t __right_rename_at_59;
+		__need_loop_59 = __right_iterator.first(__context__,(__right_rename_at_59)) && __need_loop_59;
+		for ( ; __need_loop_59 ; __need_loop_59 = __right_iterator.next(__context__,(__right_rename_at_59)) )
+		{
+			if ( __first_rename_at_58 )
+			{
+				das_copy(__first_rename_at_58,false);
+				das_copy(__left_rename_at_57,__right_rename_at_59);
+			} else {
+				das_copy(__left_rename_at_57,das_invoke<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,__functor_rename_at_56,__left_rename_at_57,__right_rename_at_59));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_59));
+	};
+	if ( __first_rename_at_58 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+	return das_auto_cast<int32_t>::cast(__left_rename_at_57);
+}
+
+inline void finalize_1141d7256c227d21 ( Context * __context__, _lambda_thismodule_106_15_5 &  ____this_rename_at_106 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_106._source_0_at_106),__context__);
+	memset(&(____this_rename_at_106), 0, 48);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_any_97635aab05d44747 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_56, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_56 )
+{
+	int32_t __left_rename_at_57 = 0;
+	bool __first_rename_at_58 = true;
+	{
+		bool __need_loop_59 = true;
+		// right : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __right_iterator(__it_rename_at_56);
+		int32_t __right_rename_at_59;
+		__need_loop_59 = __right_iterator.first(__context__,(__right_rename_at_59)) && __need_loop_59;
+		for ( ; __need_loop_59 ; __need_loop_59 = __right_iterator.next(__context__,(__right_rename_at_59)) )
+		{
+			if ( __first_rename_at_58 )
+			{
+				das_copy(__first_rename_at_58,false);
+				das_copy(__left_rename_at_57,__right_rename_at_59);
+			} else {
+				das_copy(__left_rename_at_57,das_invoke_lambda<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,__functor_rename_at_56,__left_rename_at_57,__right_rename_at_59));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_59));
+	};
+	if ( __first_rename_at_58 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+	return das_auto_cast<int32_t>::cast(__left_rename_at_57);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_any_79d34fbb97d5d871 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_56, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __functor_rename_at_56 )
+{
+	int32_t __left_rename_at_57 = 0;
+	bool __first_rename_at_58 = true;
+	{
+		bool __need_loop_59 = true;
+		// right : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __right_iterator(__it_rename_at_56);
+		int32_t __right_rename_at_59;
+		__need_loop_59 = __right_iterator.first(__context__,(__right_rename_at_59)) && __need_loop_59;
+		for ( ; __need_loop_59 ; __need_loop_59 = __right_iterator.next(__context__,(__right_rename_at_59)) )
+		{
+			if ( __first_rename_at_58 )
+			{
+				das_copy(__first_rename_at_58,false);
+				das_copy(__left_rename_at_57,__right_rename_at_59);
+			} else {
+				das_copy(__left_rename_at_57,das_invoke_function<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,__functor_rename_at_56,__left_rename_at_57,__right_rename_at_59));
+			};
+		}
+		__right_iterator.close(__context__,(__right_rename_at_59));
+	};
+	if ( __first_rename_at_58 )
+	{
+		builtin_throw(((char *) "can't reduce empty sequence"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	};
+	return das_auto_cast<int32_t>::cast(__left_rename_at_57);
+}
+
+inline void finalize_18fe4fcb57354a0c ( Context * __context__, _lambda_thismodule_139_28_6 &  ____this_rename_at_139 )
+{
+	memset(&(____this_rename_at_139), 0, 16);
+}
+
+inline Sequence DAS_COMMENT((bool)) _Funcfunctional_0x60_map_any_a694c9dcae22302f ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_29, Lambda DAS_COMMENT((bool,int32_t)) __blk_rename_at_29 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((bool))>::cast(_Funcbuiltin_0x60_each_32709ce2e3c1fbc5(__context__,das_ascend<bool,_lambda_thismodule_32_12_25>::make(__context__,&__type_info__7e7cd5f89b531479,(([&]() -> _lambda_thismodule_32_12_25 {
+		_lambda_thismodule_32_12_25 __mks_31;
+		das_zero(__mks_31);
+		das_copy((__mks_31.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_32_12_25`function XS<::_lambda_thismodule_32_12_25> &b*/ 1152472725587228544u))));
+		das_copy((__mks_31.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_32_12_25`finalizer X1<S<::_lambda_thismodule_32_12_25>>?*/ 7727499823491496702u))));
+		das_move((__mks_31.blk),(__blk_rename_at_29));
+		das_move((__mks_31.src),(__src_rename_at_29));
+		return __mks_31;
+	})()))));
+}
+
+inline void finalize_36a3b02b1fb3dcf7 ( Context * __context__, _lambda_thismodule_227_19_7 &  ____this_rename_at_227 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_227._source_0_at_227),__context__);
+	memset(&(____this_rename_at_227), 0, 48);
+}
+
+inline void finalize_a109dfbebfbc079f ( Context * __context__, _lambda_thismodule_232_10_8 &  ____this_rename_at_232 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_232._source_0_at_232),__context__);
+	memset(&(____this_rename_at_232), 0, 48);
+}
+
+inline void finalize_daf2db5be95cd687 ( Context * __context__, _lambda_thismodule_235_18_9 &  ____this_rename_at_235 )
+{
+	builtin_iterator_delete(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_235._source_0_at_235),__context__);
+	memset(&(____this_rename_at_235), 0, 48);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_2290b067fc65760f ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const  __lam_rename_at_476 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_478; das_zero(__it_rename_at_478);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_478),__lam_rename_at_476,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_478);
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_each_ref_77eafe8c9006a0 ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t const  * &)) const  __lam_rename_at_483 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_484; das_zero(__it_rename_at_484);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_484),__lam_rename_at_483,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t const  &))>::cast(__it_rename_at_484);
+}
+
+inline bool _Func_lambda_thismodule_56_21_10_0x60_function_c1552182905b575e ( Context * __context__, _lambda_thismodule_56_21_10 &  ____this_rename_at_56, TArray<int32_t> &  ___yield_56_rename_at_56 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_56_21_32;
+	TArray<int32_t> _temp_make_local_56_42_32;
+	TDim<int32_t,2> _temp_make_local_56_42_64;
+	switch (____this_rename_at_56.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_56._loop_at_56,true);
+	das_move(____this_rename_at_56._source_0_at_56,(_temp_make_local_56_21_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(1,4)))));
+	memset(&(____this_rename_at_56.x), 0, 4);
+	das_copy(____this_rename_at_56._pvar_0_at_56,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_56.x)));
+	DAS_SETBOOLAND((____this_rename_at_56._loop_at_56),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_56._source_0_at_56),____this_rename_at_56._pvar_0_at_56,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_56._loop_at_56 )
+	{
+		goto label_4;
+	};
+	das_move(___yield_56_rename_at_56,(_temp_make_local_56_42_32 = (_Funcbuiltin_0x60_to_array_move_4a0c453305a7dd5(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_56_42_64(0,__context__) = ____this_rename_at_56.x;
+		_temp_make_local_56_42_64(1,__context__) = 2;
+		return _temp_make_local_56_42_64;
+	})()))))));
+	das_copy(____this_rename_at_56.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_56._loop_at_56),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_56._source_0_at_56),____this_rename_at_56._pvar_0_at_56,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_56._source_0_at_56),____this_rename_at_56._pvar_0_at_56,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_56_21_10_0x60_finalizer_6390258da803cc74 ( Context * __context__, _lambda_thismodule_56_21_10 * ____this_rename_at_56 )
+{
+	finalize_dca9089a796b169e(__context__,das_arg<_lambda_thismodule_56_21_10>::pass(das_deref(__context__,____this_rename_at_56)));
+	das_delete_lambda_struct<_lambda_thismodule_56_21_10 *>::clear(__context__,____this_rename_at_56);
+}
+
+inline void _Funcbuiltin_0x60_emplace_46aeb6a61c4e9221 ( Context * __context__, TArray<TArray<int32_t>> &  __Arr_rename_at_120, TArray<int32_t> &  __value_rename_at_120 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_3,cast<TArray<TArray<int32_t>> &>::from(__Arr_rename_at_120)));
+	das_move(__Arr_rename_at_120(builtin_array_push_back(das_arg<TArray<TArray<int32_t>>>::pass(__Arr_rename_at_120),24,__context__),__context__),__value_rename_at_120);
+}
+
+inline void _Func_0x60_verify_14_ad9c7b801e624df0 ( Context * __context__, TArray<TArray<int32_t>> const  &  __t_rename_at_43 )
+{
+	{
+		bool __need_loop_44 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(1,4));
+		int32_t __x_rename_at_44;
+		__need_loop_44 = __x_iterator.first(__context__,(__x_rename_at_44)) && __need_loop_44;
+		// y : array<int> const&
+		das_iterator<TArray<TArray<int32_t>> const > __y_iterator(__t_rename_at_43);
+		TArray<int32_t> const  * __y_rename_at_44;
+		__need_loop_44 = __y_iterator.first(__context__,(__y_rename_at_44)) && __need_loop_44;
+		for ( ; __need_loop_44 ; __need_loop_44 = __x_iterator.next(__context__,(__x_rename_at_44)) && __y_iterator.next(__context__,(__y_rename_at_44)) )
+		{
+			DAS_ASSERT((((*__y_rename_at_44)(0,__context__) == __x_rename_at_44) && ((*__y_rename_at_44)(1,__context__) == 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_44));
+		__y_iterator.close(__context__,(__y_rename_at_44));
+	};
+}
+
+inline bool _Func_lambda_thismodule_90_14_11_0x60_function_97913e537eef3fc2 ( Context * __context__, _lambda_thismodule_90_14_11 &  ____this_rename_at_90, TArray<int32_t> &  ___yield_90_rename_at_90 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_90_14_32;
+	TArray<int32_t> _temp_make_local_90_35_32;
+	TDim<int32_t,2> _temp_make_local_90_35_64;
+	switch (____this_rename_at_90.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_90._loop_at_90,true);
+	das_move(____this_rename_at_90._source_0_at_90,(_temp_make_local_90_14_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,100)))));
+	memset(&(____this_rename_at_90.x), 0, 4);
+	das_copy(____this_rename_at_90._pvar_0_at_90,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_90.x)));
+	DAS_SETBOOLAND((____this_rename_at_90._loop_at_90),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_90._source_0_at_90),____this_rename_at_90._pvar_0_at_90,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_90._loop_at_90 )
+	{
+		goto label_4;
+	};
+	das_move(___yield_90_rename_at_90,(_temp_make_local_90_35_32 = (_Funcbuiltin_0x60_to_array_move_4a0c453305a7dd5(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_90_35_64(0,__context__) = ____this_rename_at_90.x;
+		_temp_make_local_90_35_64(1,__context__) = 2;
+		return _temp_make_local_90_35_64;
+	})()))))));
+	das_copy(____this_rename_at_90.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_90._loop_at_90),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_90._source_0_at_90),____this_rename_at_90._pvar_0_at_90,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_90._source_0_at_90),____this_rename_at_90._pvar_0_at_90,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_90_14_11_0x60_finalizer_398faab869104a98 ( Context * __context__, _lambda_thismodule_90_14_11 * ____this_rename_at_90 )
+{
+	finalize_3c00f319f5878b9f(__context__,das_arg<_lambda_thismodule_90_14_11>::pass(das_deref(__context__,____this_rename_at_90)));
+	das_delete_lambda_struct<_lambda_thismodule_90_14_11 *>::clear(__context__,____this_rename_at_90);
+}
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_4,cast<TArray<int32_t> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_42);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcfunctional_0x60_map_e65bba8c18888e75 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_47, Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) const  __blk_rename_at_47 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::cast(_Funcfunctional_0x60_map_any_2c26bc83fad607e0(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_47),__blk_rename_at_47));
+}
+
+inline bool _Funcfunctional_0x60_is_equal_2af44bbc0bb6f328 ( Context * __context__, int32_t __a_rename_at_187, int32_t __b_rename_at_187 )
+{
+	return das_auto_cast<bool>::cast(__a_rename_at_187 == __b_rename_at_187);
+}
+
+inline Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _Funcbuiltin_0x60_each_5b8f7b8f8a92acc2 ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float>)) const  __lam_rename_at_476 )
+{
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) __it_rename_at_478; das_zero(__it_rename_at_478);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass(__it_rename_at_478),__lam_rename_at_476,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::cast(__it_rename_at_478);
+}
+
+inline bool _Func_lambda_thismodule_240_10_12_0x60_function_c0a50a3c44fb0f2b ( Context * __context__, _lambda_thismodule_240_10_12 &  ____this_rename_at_240, TArray<int32_t> &  ___yield_240_rename_at_240 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_240_10_32;
+	TArray<int32_t> _temp_make_local_240_31_32;
+	TDim<int32_t,2> _temp_make_local_240_31_64;
+	switch (____this_rename_at_240.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_240._loop_at_240,true);
+	das_move(____this_rename_at_240._source_0_at_240,(_temp_make_local_240_10_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(1,4)))));
+	memset(&(____this_rename_at_240.x), 0, 4);
+	das_copy(____this_rename_at_240._pvar_0_at_240,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_240.x)));
+	DAS_SETBOOLAND((____this_rename_at_240._loop_at_240),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_240._source_0_at_240),____this_rename_at_240._pvar_0_at_240,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_240._loop_at_240 )
+	{
+		goto label_4;
+	};
+	das_move(___yield_240_rename_at_240,(_temp_make_local_240_31_32 = (_Funcbuiltin_0x60_to_array_move_4a0c453305a7dd5(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_240_31_64(0,__context__) = ____this_rename_at_240.x;
+		_temp_make_local_240_31_64(1,__context__) = 2;
+		return _temp_make_local_240_31_64;
+	})()))))));
+	das_copy(____this_rename_at_240.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_240._loop_at_240),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_240._source_0_at_240),____this_rename_at_240._pvar_0_at_240,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_240._source_0_at_240),____this_rename_at_240._pvar_0_at_240,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_240_10_12_0x60_finalizer_722f889b1020677c ( Context * __context__, _lambda_thismodule_240_10_12 * ____this_rename_at_240 )
+{
+	finalize_95e8646aced816cb(__context__,das_arg<_lambda_thismodule_240_10_12>::pass(das_deref(__context__,____this_rename_at_240)));
+	das_delete_lambda_struct<_lambda_thismodule_240_10_12 *>::clear(__context__,____this_rename_at_240);
+}
+
+inline bool _Func_lambda_thismodule_243_18_13_0x60_function_f36f4e4156384531 ( Context * __context__, _lambda_thismodule_243_18_13 &  ____this_rename_at_243, TArray<int32_t> &  ___yield_243_rename_at_243 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_243_18_32;
+	TArray<int32_t> _temp_make_local_243_38_32;
+	TDim<int32_t,2> _temp_make_local_243_38_64;
+	switch (____this_rename_at_243.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_243._loop_at_243,true);
+	das_move(____this_rename_at_243._source_0_at_243,(_temp_make_local_243_18_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,10)))));
+	memset(&(____this_rename_at_243.x), 0, 4);
+	das_copy(____this_rename_at_243._pvar_0_at_243,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_243.x)));
+	DAS_SETBOOLAND((____this_rename_at_243._loop_at_243),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_243._source_0_at_243),____this_rename_at_243._pvar_0_at_243,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_243._loop_at_243 )
+	{
+		goto label_4;
+	};
+	das_move(___yield_243_rename_at_243,(_temp_make_local_243_38_32 = (_Funcbuiltin_0x60_to_array_move_4a0c453305a7dd5(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+		_temp_make_local_243_38_64(0,__context__) = ((SimPolicy<int32_t>::Mod(____this_rename_at_243.x,3,*__context__,nullptr)) + 1);
+		_temp_make_local_243_38_64(1,__context__) = 2;
+		return _temp_make_local_243_38_64;
+	})()))))));
+	das_copy(____this_rename_at_243.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_243._loop_at_243),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_243._source_0_at_243),____this_rename_at_243._pvar_0_at_243,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_243._source_0_at_243),____this_rename_at_243._pvar_0_at_243,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_243_18_13_0x60_finalizer_5c6dfa59ff707404 ( Context * __context__, _lambda_thismodule_243_18_13 * ____this_rename_at_243 )
+{
+	finalize_5d81d27f4ab6f1ad(__context__,das_arg<_lambda_thismodule_243_18_13>::pass(das_deref(__context__,____this_rename_at_243)));
+	das_delete_lambda_struct<_lambda_thismodule_243_18_13 *>::clear(__context__,____this_rename_at_243);
+}
+
+inline void finalize_2e9b369ff6b06689 ( Context * __context__, _lambda_thismodule_85_28_1 &  ____this_rename_at_85 )
+{
+	memset(&(____this_rename_at_85), 0, 16);
+}
+
+inline bool _Func_lambda_thismodule_163_8_2_0x60_function_cbaeea5cd4355223 ( Context * __context__, _lambda_thismodule_163_8_2 &  ____this_rename_at_163, int32_t & __result_rename_at_162 )
+{
+	das_copy(__result_rename_at_162,____this_rename_at_163.start);
+	____this_rename_at_163.start += ____this_rename_at_163.step;
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void _Func_lambda_thismodule_163_8_2_0x60_finalizer_97ef0e5f56e2c5fe ( Context * __context__, _lambda_thismodule_163_8_2 * ____this_rename_at_163 )
+{
+	finalize_9fda4bcc4531188d(__context__,das_arg<_lambda_thismodule_163_8_2>::pass(das_deref(__context__,____this_rename_at_163)));
+	das_delete_lambda_struct<_lambda_thismodule_163_8_2 *>::clear(__context__,____this_rename_at_163);
+}
+
+inline bool _Func_lambda_thismodule_180_8_3_0x60_function_a9f4fc5559e8f55a ( Context * __context__, _lambda_thismodule_180_8_3 &  ____this_rename_at_180, int32_t & ___yield_180_rename_at_180 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_183_8_32;
+	switch (____this_rename_at_180.__yield) {
+	case 0: goto label_0;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 6: goto label_6;
+	case 5: goto label_5;
+	case 7: goto label_7;
+	case 8: goto label_8;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	if ( !(____this_rename_at_180.count == 0) )
+	{
+		goto label_4;
+	};
+	label_1:;;
+	das_copy(___yield_180_rename_at_180,____this_rename_at_180.value);
+	das_copy(____this_rename_at_180.__yield,3);
+	return das_auto_cast<bool>::cast(true);
+	label_3:;;
+	goto label_1;
+	label_2:;;
+	label_4:;;
+	das_copy(____this_rename_at_180._loop_at_183,true);
+	das_move(____this_rename_at_180._source_0_at_183,(_temp_make_local_183_8_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,mk_range(____this_rename_at_180.count)))));
+	memset(&(____this_rename_at_180.x), 0, 4);
+	das_copy(____this_rename_at_180._pvar_0_at_183,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_180.x)));
+	DAS_SETBOOLAND((____this_rename_at_180._loop_at_183),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_180._source_0_at_183),____this_rename_at_180._pvar_0_at_183,__context__)));
+	label_6:;;
+	if ( !____this_rename_at_180._loop_at_183 )
+	{
+		goto label_8;
+	};
+	das_copy(___yield_180_rename_at_180,____this_rename_at_180.value);
+	das_copy(____this_rename_at_180.__yield,5);
+	return das_auto_cast<bool>::cast(true);
+	label_5:;;
+	label_7:;;
+	DAS_SETBOOLAND((____this_rename_at_180._loop_at_183),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_180._source_0_at_183),____this_rename_at_180._pvar_0_at_183,__context__)));
+	goto label_6;
+	label_8:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_180._source_0_at_183),____this_rename_at_180._pvar_0_at_183,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_180_8_3_0x60_finalizer_b1b7f491be37702c ( Context * __context__, _lambda_thismodule_180_8_3 * ____this_rename_at_180 )
+{
+	finalize_274ecf742fbb4581(__context__,das_arg<_lambda_thismodule_180_8_3>::pass(das_deref(__context__,____this_rename_at_180)));
+	das_delete_lambda_struct<_lambda_thismodule_180_8_3 *>::clear(__context__,____this_rename_at_180);
+}
+
+inline bool _Func_lambda_thismodule_50_23_4_0x60_function_acc8ccfc59a727e8 ( Context * __context__, _lambda_thismodule_50_23_4 &  ____this_rename_at_50, int32_t const  * & ___ryield50_rename_at_50 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_50_23_32;
+	switch (____this_rename_at_50.__yield) {
+	case 0: goto label_0;
+	case 3: goto label_3;
+	case 1: goto label_1;
+	case 2: goto label_2;
+	case 4: goto label_4;
+	case 5: goto label_5;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_50._loop_at_50,true);
+	das_move(____this_rename_at_50._source_0_at_50,(_temp_make_local_50_23_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,100)))));
+	memset(&(____this_rename_at_50.x), 0, 4);
+	das_copy(____this_rename_at_50._pvar_0_at_50,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_50.x)));
+	DAS_SETBOOLAND((____this_rename_at_50._loop_at_50),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50._source_0_at_50),____this_rename_at_50._pvar_0_at_50,__context__)));
+	label_3:;;
+	if ( !____this_rename_at_50._loop_at_50 )
+	{
+		goto label_5;
+	};
+	if ( !((SimPolicy<int32_t>::Mod(____this_rename_at_50.x,2,*__context__,nullptr)) == 0) )
+	{
+		goto label_2;
+	};
+	das_copy(___ryield50_rename_at_50,das_ref(__context__,____this_rename_at_50.x));
+	das_copy(____this_rename_at_50.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_2:;;
+	label_4:;;
+	DAS_SETBOOLAND((____this_rename_at_50._loop_at_50),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50._source_0_at_50),____this_rename_at_50._pvar_0_at_50,__context__)));
+	goto label_3;
+	label_5:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_50._source_0_at_50),____this_rename_at_50._pvar_0_at_50,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_50_23_4_0x60_finalizer_d48a0c4dc1dec02c ( Context * __context__, _lambda_thismodule_50_23_4 * ____this_rename_at_50 )
+{
+	finalize_50a2b26c59df4fa5(__context__,das_arg<_lambda_thismodule_50_23_4>::pass(das_deref(__context__,____this_rename_at_50)));
+	das_delete_lambda_struct<_lambda_thismodule_50_23_4 *>::clear(__context__,____this_rename_at_50);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Func_0x60_verify_even_6703252febc142e7 ( Context * __context__, TArray<int32_t> const  &  __arr_rename_at_19 )
+{
+	{
+		bool __need_loop_20 = true;
+		// x : int const&
+		das_iterator<TArray<int32_t> const > __x_iterator(__arr_rename_at_19);
+		int32_t const  * __x_rename_at_20;
+		__need_loop_20 = __x_iterator.first(__context__,(__x_rename_at_20)) && __need_loop_20;
+		// y : int const
+		das_iterator<range> __y_iterator(range(0,50));
+		int32_t __y_rename_at_20;
+		__need_loop_20 = __y_iterator.first(__context__,(__y_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __x_iterator.next(__context__,(__x_rename_at_20)) && __y_iterator.next(__context__,(__y_rename_at_20)) )
+		{
+			DAS_ASSERT(((*__x_rename_at_20) == (__y_rename_at_20 * 2)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_20));
+		__y_iterator.close(__context__,(__y_rename_at_20));
+	};
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_196d50d6a5b657be ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_26, Func DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_26 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcfunctional_0x60_filter_any_d390534166c9b0fe(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_26),__blk_rename_at_26));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_filter_53efa21008623dcb ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_21, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_21 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcfunctional_0x60_filter_any_16f495c9a4a7b638(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_21),__blk_rename_at_21));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_a60435d0c6456bd4 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_52, Func DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_52 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcfunctional_0x60_map_any_a5ff5c864782eff8(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_52),__blk_rename_at_52));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_map_58dc263556f6d651 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_47, Lambda DAS_COMMENT((int32_t,int32_t)) const  __blk_rename_at_47 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcfunctional_0x60_map_any_44bf1e6652c8539(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_47),__blk_rename_at_47));
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_4a5fef6152ecc35b ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_80, Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  __blk_rename_at_80 )
+{
+	return das_auto_cast<int32_t>::cast(_Funcfunctional_0x60_reduce_any_4f62a6a9473e89cc(__context__,__it_rename_at_80,__blk_rename_at_80));
+}
+
+inline bool _Func_lambda_thismodule_106_15_5_0x60_function_4edb7cf4dd0af38f ( Context * __context__, _lambda_thismodule_106_15_5 &  ____this_rename_at_106, int32_t const  * & ___ryield106_rename_at_106 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_106_15_32;
+	switch (____this_rename_at_106.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_106._loop_at_106,true);
+	das_move(____this_rename_at_106._source_0_at_106,(_temp_make_local_106_15_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,10)))));
+	memset(&(____this_rename_at_106.x), 0, 4);
+	das_copy(____this_rename_at_106._pvar_0_at_106,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_106.x)));
+	DAS_SETBOOLAND((____this_rename_at_106._loop_at_106),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_106._source_0_at_106),____this_rename_at_106._pvar_0_at_106,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_106._loop_at_106 )
+	{
+		goto label_4;
+	};
+	das_copy(___ryield106_rename_at_106,das_ref(__context__,____this_rename_at_106.x));
+	das_copy(____this_rename_at_106.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_106._loop_at_106),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_106._source_0_at_106),____this_rename_at_106._pvar_0_at_106,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_106._source_0_at_106),____this_rename_at_106._pvar_0_at_106,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_106_15_5_0x60_finalizer_b87dcc28f4b26ad4 ( Context * __context__, _lambda_thismodule_106_15_5 * ____this_rename_at_106 )
+{
+	finalize_1141d7256c227d21(__context__,das_arg<_lambda_thismodule_106_15_5>::pass(das_deref(__context__,____this_rename_at_106)));
+	das_delete_lambda_struct<_lambda_thismodule_106_15_5 *>::clear(__context__,____this_rename_at_106);
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_a0bccddb56b604f ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_70, Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_70 )
+{
+	return das_auto_cast<int32_t>::cast(_Funcfunctional_0x60_reduce_any_97635aab05d44747(__context__,__it_rename_at_70,__blk_rename_at_70));
+}
+
+inline int32_t _Funcfunctional_0x60_reduce_c149d972cb8a23ee ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_76, Func DAS_COMMENT((int32_t,int32_t,int32_t)) const  __blk_rename_at_76 )
+{
+	return das_auto_cast<int32_t>::cast(_Funcfunctional_0x60_reduce_any_79d34fbb97d5d871(__context__,__it_rename_at_76,__blk_rename_at_76));
+}
+
+inline TTuple<8,int32_t,float> _Func_lambda_thismodule_139_28_6_0x60_function_ecdee715a1fae593 ( Context * __context__, _lambda_thismodule_139_28_6 &  ____this_rename_at_139, int32_t __x_rename_at_139 )
+{
+	return das_auto_cast_ref<TTuple<8,int32_t,float>>::cast((([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_139;
+		das_get_tuple_field<int32_t,0>::get(__mkt_139) = __x_rename_at_139;
+		das_get_tuple_field<float,4>::get(__mkt_139) = 1.5f;
+		return __mkt_139;
+	})()));
+}
+
+inline void _Func_lambda_thismodule_139_28_6_0x60_finalizer_b747e97a7829fa46 ( Context * __context__, _lambda_thismodule_139_28_6 * ____this_rename_at_139 )
+{
+	finalize_18fe4fcb57354a0c(__context__,das_arg<_lambda_thismodule_139_28_6>::pass(das_deref(__context__,____this_rename_at_139)));
+	das_delete_lambda_struct<_lambda_thismodule_139_28_6 *>::clear(__context__,____this_rename_at_139);
+}
+
+inline int32_t _Funcfunctional_0x60_sum_c6bb83657fd0ca16 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  __it_rename_at_84 )
+{
+	int32_t __temp_rename_at_87 = 0;
+	{
+		bool __need_loop_88 = true;
+		// x : int aka TT const
+		das_iterator<Sequence DAS_COMMENT((int32_t)) const > __x_iterator(__it_rename_at_84);
+		int32_t __x_rename_at_88;
+		__need_loop_88 = __x_iterator.first(__context__,(__x_rename_at_88)) && __need_loop_88;
+		for ( ; __need_loop_88 ; __need_loop_88 = __x_iterator.next(__context__,(__x_rename_at_88)) )
+		{
+			__temp_rename_at_87 += __x_rename_at_88;
+		}
+		__x_iterator.close(__context__,(__x_rename_at_88));
+	};
+	return das_auto_cast<int32_t>::cast(__temp_rename_at_87);
+}
+
+inline Sequence DAS_COMMENT((bool)) _Funcfunctional_0x60_map_c631eb0100c760c2 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_47, Lambda DAS_COMMENT((bool,int32_t)) const  __blk_rename_at_47 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((bool))>::cast(_Funcfunctional_0x60_map_any_a694c9dcae22302f(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__src_rename_at_47),__blk_rename_at_47));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_islice_4597761baec84852 ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_143, int32_t __start_rename_at_143, int32_t __stop_rename_at_143 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_147_12_19>::make(__context__,&__type_info__c0cb38a461eda129,(([&]() -> _lambda_thismodule_147_12_19 {
+		_lambda_thismodule_147_12_19 __mks_146;
+		das_zero(__mks_146);
+		das_copy((__mks_146.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_147_12_19`function XS<::_lambda_thismodule_147_12_19> &i*/ 3560004814580317917u))));
+		das_copy((__mks_146.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_147_12_19`finalizer X1<S<::_lambda_thismodule_147_12_19>>?*/ 5450551009936128644u))));
+		das_move((__mks_146.src),(__src_rename_at_143));
+		das_copy((__mks_146.start),(__start_rename_at_143));
+		das_copy((__mks_146.stop),(__stop_rename_at_143));
+		return __mks_146;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_cycle_591674320dc1e79c ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  __src_rename_at_116 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_120_12_20>::make(__context__,&__type_info__1198f06e88481148,(([&]() -> _lambda_thismodule_120_12_20 {
+		_lambda_thismodule_120_12_20 __mks_119;
+		das_zero(__mks_119);
+		das_copy((__mks_119.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_120_12_20`function XS<::_lambda_thismodule_120_12_20> &i*/ 13737734316773257699u))));
+		das_copy((__mks_119.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_120_12_20`finalizer X1<S<::_lambda_thismodule_120_12_20>>?*/ 9023340199484040316u))));
+		das_move((__mks_119.src),(__src_rename_at_116));
+		return __mks_119;
+	})()))));
+}
+
+inline bool _Func_lambda_thismodule_227_19_7_0x60_function_1cec87bec4f6e7e1 ( Context * __context__, _lambda_thismodule_227_19_7 &  ____this_rename_at_227, int32_t & ___yield_227_rename_at_227 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_227_19_32;
+	switch (____this_rename_at_227.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_227._loop_at_227,true);
+	das_move(____this_rename_at_227._source_0_at_227,(_temp_make_local_227_19_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,10)))));
+	memset(&(____this_rename_at_227.x), 0, 4);
+	das_copy(____this_rename_at_227._pvar_0_at_227,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_227.x)));
+	DAS_SETBOOLAND((____this_rename_at_227._loop_at_227),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_227._source_0_at_227),____this_rename_at_227._pvar_0_at_227,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_227._loop_at_227 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_227_rename_at_227,(SimPolicy<int32_t>::Mod(____this_rename_at_227.x,3,*__context__,nullptr)) + 1);
+	das_copy(____this_rename_at_227.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_227._loop_at_227),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_227._source_0_at_227),____this_rename_at_227._pvar_0_at_227,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_227._source_0_at_227),____this_rename_at_227._pvar_0_at_227,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_227_19_7_0x60_finalizer_f6e0cad214e51598 ( Context * __context__, _lambda_thismodule_227_19_7 * ____this_rename_at_227 )
+{
+	finalize_36a3b02b1fb3dcf7(__context__,das_arg<_lambda_thismodule_227_19_7>::pass(das_deref(__context__,____this_rename_at_227)));
+	das_delete_lambda_struct<_lambda_thismodule_227_19_7 *>::clear(__context__,____this_rename_at_227);
+}
+
+inline bool _Func_lambda_thismodule_232_10_8_0x60_function_b0f6cea462a9698d ( Context * __context__, _lambda_thismodule_232_10_8 &  ____this_rename_at_232, TTuple<8,int32_t,float> &  ___yield_232_rename_at_232 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_232_10_32;
+	switch (____this_rename_at_232.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_232._loop_at_232,true);
+	das_move(____this_rename_at_232._source_0_at_232,(_temp_make_local_232_10_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(1,4)))));
+	memset(&(____this_rename_at_232.x), 0, 4);
+	das_copy(____this_rename_at_232._pvar_0_at_232,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_232.x)));
+	DAS_SETBOOLAND((____this_rename_at_232._loop_at_232),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_232._source_0_at_232),____this_rename_at_232._pvar_0_at_232,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_232._loop_at_232 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_232_rename_at_232,(([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_232;
+		das_get_tuple_field<int32_t,0>::get(__mkt_232) = ____this_rename_at_232.x;
+		das_get_tuple_field<float,4>::get(__mkt_232) = 2.5f;
+		return __mkt_232;
+	})()));
+	das_copy(____this_rename_at_232.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_232._loop_at_232),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_232._source_0_at_232),____this_rename_at_232._pvar_0_at_232,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_232._source_0_at_232),____this_rename_at_232._pvar_0_at_232,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_232_10_8_0x60_finalizer_f0c678795587145c ( Context * __context__, _lambda_thismodule_232_10_8 * ____this_rename_at_232 )
+{
+	finalize_a109dfbebfbc079f(__context__,das_arg<_lambda_thismodule_232_10_8>::pass(das_deref(__context__,____this_rename_at_232)));
+	das_delete_lambda_struct<_lambda_thismodule_232_10_8 *>::clear(__context__,____this_rename_at_232);
+}
+
+inline bool _Func_lambda_thismodule_235_18_9_0x60_function_2c3ebc5409dda05f ( Context * __context__, _lambda_thismodule_235_18_9 &  ____this_rename_at_235, TTuple<8,int32_t,float> &  ___yield_235_rename_at_235 )
+{
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_235_18_32;
+	switch (____this_rename_at_235.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	case 4: goto label_4;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	das_copy(____this_rename_at_235._loop_at_235,true);
+	das_move(____this_rename_at_235._source_0_at_235,(_temp_make_local_235_18_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,10)))));
+	memset(&(____this_rename_at_235.x), 0, 4);
+	das_copy(____this_rename_at_235._pvar_0_at_235,das_cast<void *>::cast(das_ref(__context__,____this_rename_at_235.x)));
+	DAS_SETBOOLAND((____this_rename_at_235._loop_at_235),(builtin_iterator_first(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_235._source_0_at_235),____this_rename_at_235._pvar_0_at_235,__context__)));
+	label_2:;;
+	if ( !____this_rename_at_235._loop_at_235 )
+	{
+		goto label_4;
+	};
+	das_copy(___yield_235_rename_at_235,(([&]() -> TTuple<8,int32_t,float> {
+		TTuple<8,int32_t,float> __mkt_235;
+		das_get_tuple_field<int32_t,0>::get(__mkt_235) = ((SimPolicy<int32_t>::Mod(____this_rename_at_235.x,3,*__context__,nullptr)) + 1);
+		das_get_tuple_field<float,4>::get(__mkt_235) = 2.5f;
+		return __mkt_235;
+	})()));
+	das_copy(____this_rename_at_235.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	label_3:;;
+	DAS_SETBOOLAND((____this_rename_at_235._loop_at_235),(builtin_iterator_next(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_235._source_0_at_235),____this_rename_at_235._pvar_0_at_235,__context__)));
+	goto label_2;
+	label_4:;;
+	builtin_iterator_close(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(____this_rename_at_235._source_0_at_235),____this_rename_at_235._pvar_0_at_235,__context__);
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_235_18_9_0x60_finalizer_f01773fb180129d8 ( Context * __context__, _lambda_thismodule_235_18_9 * ____this_rename_at_235 )
+{
+	finalize_daf2db5be95cd687(__context__,das_arg<_lambda_thismodule_235_18_9>::pass(das_deref(__context__,____this_rename_at_235)));
+	das_delete_lambda_struct<_lambda_thismodule_235_18_9 *>::clear(__context__,____this_rename_at_235);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_4a0c453305a7dd5 ( Context * __context__, TDim<int32_t,2> &  __a_rename_at_517 )
+{
+	TArray<int32_t> __arr_rename_at_518; das_zero(__arr_rename_at_518);
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__arr_rename_at_518),2,4,__context__);
+	das_copy(das_cast<TDim<int32_t,2>>::cast(das_ref(__context__,__arr_rename_at_518(0,__context__))),__a_rename_at_517);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_518);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcbuiltin_0x60_each_5cbab1dfe9635bc1 ( Context * __context__, range __rng_rename_at_447 )
+{
+	Sequence DAS_COMMENT((int32_t)) __it_rename_at_448; das_zero(__it_rename_at_448);
+	builtin_make_range_iterator(das_arg<Sequence DAS_COMMENT((int32_t))>::pass(__it_rename_at_448),__rng_rename_at_447,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(__it_rename_at_448);
+}
+
+inline int32_t _Func_lambda_thismodule_85_28_1_0x60_function_bddb2af26f5dab07 ( Context * __context__, _lambda_thismodule_85_28_1 &  ____this_rename_at_85, int32_t __x_rename_at_85 )
+{
+	return das_auto_cast<int32_t>::cast(__x_rename_at_85 + __x_rename_at_85);
+}
+
+inline void _Func_lambda_thismodule_85_28_1_0x60_finalizer_3dc36ce0a81f940e ( Context * __context__, _lambda_thismodule_85_28_1 * ____this_rename_at_85 )
+{
+	finalize_2e9b369ff6b06689(__context__,das_arg<_lambda_thismodule_85_28_1>::pass(das_deref(__context__,____this_rename_at_85)));
+	das_delete_lambda_struct<_lambda_thismodule_85_28_1 *>::clear(__context__,____this_rename_at_85);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_f9adbdca370c7b15 ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_517 )
+{
+	TArray<int32_t> __arr_rename_at_518; das_zero(__arr_rename_at_518);
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__arr_rename_at_518),3,4,__context__);
+	das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_518(0,__context__))),__a_rename_at_517);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_518);
+}
+
+inline bool _Funcfunctional_0x60_any_a5606ed295f053c9 ( Context * __context__, TDim<bool,2> const  &  __it_rename_at_93 )
+{
+	{
+		bool __need_loop_99 = true;
+		// x : bool const&
+		das_iterator<TDim<bool,2> const > __x_iterator(__it_rename_at_93);
+		bool const  * __x_rename_at_99;
+		__need_loop_99 = __x_iterator.first(__context__,(__x_rename_at_99)) && __need_loop_99;
+		for ( ; __need_loop_99 ; __need_loop_99 = __x_iterator.next(__context__,(__x_rename_at_99)) )
+		{
+			if ( (*__x_rename_at_99) )
+			{
+				return das_auto_cast<bool>::cast(true);
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_99));
+	};
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_count_25d3d15e5f3ded6d ( Context * __context__, int32_t __start_rename_at_160, int32_t __step_rename_at_160 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_163_8_2>::make(__context__,&__type_info__2c1eae6fb4c32392,(([&]() -> _lambda_thismodule_163_8_2 {
+		_lambda_thismodule_163_8_2 __mks_163;
+		das_copy((__mks_163.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_163_8_2`function XS<::_lambda_thismodule_163_8_2> &i*/ 12943977054262947935u))));
+		das_copy((__mks_163.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_163_8_2`finalizer X1<S<::_lambda_thismodule_163_8_2>>?*/ 8496600777995093296u))));
+		das_copy((__mks_163.start),(__start_rename_at_160));
+		das_copy((__mks_163.step),(__step_rename_at_160));
+		return __mks_163;
+	})()))));
+}
+
+inline Sequence DAS_COMMENT((int32_t)) _Funcfunctional_0x60_repeat_429cd11f93b0bf2d ( Context * __context__, int32_t __value_rename_at_177, int32_t __count_rename_at_177 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t))>::cast(_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_180_8_3>::make(__context__,&__type_info__da4249a84c6b6676,(([&]() -> _lambda_thismodule_180_8_3 {
+		_lambda_thismodule_180_8_3 __mks_179;
+		das_zero(__mks_179);
+		das_copy((__mks_179.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_180_8_3`function XS<::_lambda_thismodule_180_8_3> &Xi*/ 11443680702611617987u))));
+		das_copy((__mks_179.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_180_8_3`finalizer X1<S<::_lambda_thismodule_180_8_3>>?*/ 17770384046396544416u))));
+		das_copy((__mks_179.count),(__count_rename_at_177));
+		das_copy((__mks_179.value),(__value_rename_at_177));
+		return __mks_179;
+	})()))));
+}
+
+inline bool is_even_9f92407af8b51b2c ( Context * __context__, int32_t __x_rename_at_9 )
+{
+	return das_auto_cast<bool>::cast((SimPolicy<int32_t>::Mod(__x_rename_at_9,2,*__context__,nullptr)) == 0);
+}
+
+inline int32_t twice_aa4c716c97740337 ( Context * __context__, int32_t __x_rename_at_12 )
+{
+	return das_auto_cast<int32_t>::cast(__x_rename_at_12 + __x_rename_at_12);
+}
+
+inline int32_t add_8997dbbc2c7fa6aa ( Context * __context__, int32_t __a_rename_at_15, int32_t __b_rename_at_15 )
+{
+	return das_auto_cast<int32_t>::cast(__a_rename_at_15 + __b_rename_at_15);
+}
+
+inline bool _FuncExclEqu_d496bfa20e8277a0 ( Context * __context__, TTuple<8,int32_t,float> const  &  __a_rename_at_26, TTuple<8,int32_t,float> const  &  __b_rename_at_26 )
+{
+	return das_auto_cast<bool>::cast((das_get_tuple_field<int32_t,0>::get(__a_rename_at_26) != das_get_tuple_field<int32_t,0>::get(__b_rename_at_26)) || (das_get_tuple_field<float,4>::get(__a_rename_at_26) != das_get_tuple_field<float,4>::get(__b_rename_at_26)));
+}
+
+inline bool _FuncExclEqu_46b76804d5e31c7b ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_29, TArray<int32_t> const  &  __b_rename_at_29 )
+{
+	if ( builtin_array_size(__a_rename_at_29) != builtin_array_size(__b_rename_at_29) )
+	{
+		return das_auto_cast<bool>::cast(true);
+	} else {
+		{
+			bool __need_loop_32 = true;
+			// x : int const&
+			das_iterator<TArray<int32_t> const > __x_iterator(__a_rename_at_29);
+			int32_t const  * __x_rename_at_32;
+			__need_loop_32 = __x_iterator.first(__context__,(__x_rename_at_32)) && __need_loop_32;
+			// y : int const&
+			das_iterator<TArray<int32_t> const > __y_iterator(__b_rename_at_29);
+			int32_t const  * __y_rename_at_32;
+			__need_loop_32 = __y_iterator.first(__context__,(__y_rename_at_32)) && __need_loop_32;
+			for ( ; __need_loop_32 ; __need_loop_32 = __x_iterator.next(__context__,(__x_rename_at_32)) && __y_iterator.next(__context__,(__y_rename_at_32)) )
+			{
+				if ( (*__x_rename_at_32) != (*__y_rename_at_32) )
+				{
+					return das_auto_cast<bool>::cast(true);
+				};
+			}
+			__x_iterator.close(__context__,(__x_rename_at_32));
+			__y_iterator.close(__context__,(__y_rename_at_32));
+		};
+		return das_auto_cast<bool>::cast(false);
+	};
+}
+
+inline bool test_253505bb95c128bc ( Context * __context__ ) { das_stack_prologue __prologue(__context__,224,"test " DAS_FILE_LINE);
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_50_23_32;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_56_21_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_64_12_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_63_12_48;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_71_12_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_70_12_48;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_78_12_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_77_12_48;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_85_12_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_84_12_48;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_93_12_32;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_92_12_48;
+	Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_91_12_64;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_90_14_80;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_99_12_32;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_106_15_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_114_12_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_122_12_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_130_12_32;
+	TTuple<8,int32_t,float> _temp_make_local_140_12_32;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _temp_make_local_139_12_48;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_138_12_64;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_148_12_32;
+	TDim<bool,2> _temp_make_local_155_12_32;
+	Sequence DAS_COMMENT((bool)) _temp_make_local_163_12_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_162_12_48;
+	Sequence DAS_COMMENT((bool)) _temp_make_local_172_12_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_171_12_48;
+	Sequence DAS_COMMENT((bool)) _temp_make_local_180_12_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_179_12_48;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_191_12_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_190_12_48;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_199_12_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_198_12_48;
+	TArray<int32_t> _temp_make_local_208_12_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_207_12_64;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_206_12_80;
+	TArray<int32_t> _temp_make_local_216_12_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_215_12_64;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_226_8_32;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_225_8_48;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_224_8_64;
+	Sequence DAS_COMMENT((int32_t)) _temp_make_local_227_19_80;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) _temp_make_local_234_8_32;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float> *)) _temp_make_local_233_8_48;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _temp_make_local_232_10_64;
+	Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) _temp_make_local_235_18_96;
+	Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_242_8_32;
+	Sequence DAS_COMMENT((TArray<int32_t> *)) _temp_make_local_241_8_48;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_240_10_64;
+	Sequence DAS_COMMENT((TArray<int32_t>)) _temp_make_local_243_18_96;
+	_Func_0x60_verify_even_7e6d5ca7b65b79bf(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass((_temp_make_local_50_23_32 = (_Funcbuiltin_0x60_each_ref_77eafe8c9006a0(__context__,das_ascend<bool,_lambda_thismodule_50_23_4>::make(__context__,&__type_info__6cde42349a0dc4e2,(([&]() -> _lambda_thismodule_50_23_4 {
+		_lambda_thismodule_50_23_4 __mks_50;
+		das_zero(__mks_50);
+		das_copy((__mks_50.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_50_23_4`function XS<::_lambda_thismodule_50_23_4> &1<Ci>?*/ 2670477349306073666u))));
+		das_copy((__mks_50.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_50_23_4`finalizer X1<S<::_lambda_thismodule_50_23_4>>?*/ 12851092492806755024u))));
+		return __mks_50;
+	})())))))));
+	_Func_0x60_verify_even_6703252febc142e7(__context__,das_arg<TArray<int32_t>>::pass(das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<int32_t>{
+		TArray<int32_t> ____acomp_53_rename_at_53; das_zero(____acomp_53_rename_at_53);
+		builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_53_rename_at_53),false);
+		{
+			bool __need_loop_53 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,100));
+			int32_t __x_rename_at_53;
+			__need_loop_53 = __x_iterator.first(__context__,(__x_rename_at_53)) && __need_loop_53;
+			for ( ; __need_loop_53 ; __need_loop_53 = __x_iterator.next(__context__,(__x_rename_at_53)) )
+			{
+				if ( (SimPolicy<int32_t>::Mod(__x_rename_at_53,2,*__context__,nullptr)) == 0 )
+				{
+					_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____acomp_53_rename_at_53),__x_rename_at_53);
+				};
+			}
+			__x_iterator.close(__context__,(__x_rename_at_53));
+		};
+		builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_53_rename_at_53),true);
+		return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(____acomp_53_rename_at_53);
+	})));
+	_Func_0x60_verify_14_c7953d9d52dffeef(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_56_21_32 = (_Funcbuiltin_0x60_each_7f633a072c41b03c(__context__,das_ascend<bool,_lambda_thismodule_56_21_10>::make(__context__,&__type_info__bbbb40b84cc1be8d,(([&]() -> _lambda_thismodule_56_21_10 {
+		_lambda_thismodule_56_21_10 __mks_56;
+		das_zero(__mks_56);
+		das_copy((__mks_56.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_56_21_10`function XS<::_lambda_thismodule_56_21_10> 1<i>A*/ 945866718390883397u))));
+		das_copy((__mks_56.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_56_21_10`finalizer X1<S<::_lambda_thismodule_56_21_10>>?*/ 16622501033528147810u))));
+		return __mks_56;
+	})())))))));
+	_Func_0x60_verify_14_ad9c7b801e624df0(__context__,das_arg<TArray<TArray<int32_t>>>::pass(das_invoke<TArray<TArray<int32_t>>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<TArray<int32_t>>{
+		TArray<TArray<int32_t>> ____acomp_59_rename_at_59; das_zero(____acomp_59_rename_at_59);
+		builtin_set_verify_array_locks(das_arg<TArray<TArray<int32_t>>>::pass(____acomp_59_rename_at_59),false);
+		{
+			bool __need_loop_59 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(1,4));
+			int32_t __x_rename_at_59;
+			__need_loop_59 = __x_iterator.first(__context__,(__x_rename_at_59)) && __need_loop_59;
+			for ( ; __need_loop_59 ; __need_loop_59 = __x_iterator.next(__context__,(__x_rename_at_59)) )
+			{
+				TArray<int32_t> _temp_make_local_59_42_176;
+				TDim<int32_t,2> _temp_make_local_59_42_208;
+				_Funcbuiltin_0x60_emplace_46aeb6a61c4e9221(__context__,das_arg<TArray<TArray<int32_t>>>::pass(____acomp_59_rename_at_59),das_arg<TArray<int32_t>>::pass((_temp_make_local_59_42_176 = (_Funcbuiltin_0x60_to_array_move_4a0c453305a7dd5(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+					_temp_make_local_59_42_208(0,__context__) = __x_rename_at_59;
+					_temp_make_local_59_42_208(1,__context__) = 2;
+					return _temp_make_local_59_42_208;
+				})())))))));
+			}
+			__x_iterator.close(__context__,(__x_rename_at_59));
+		};
+		builtin_set_verify_array_locks(das_arg<TArray<TArray<int32_t>>>::pass(____acomp_59_rename_at_59),true);
+		return /* <- */ das_auto_cast_move<TArray<TArray<int32_t>>>::cast(____acomp_59_rename_at_59);
+	})));
+	_Func_0x60_verify_even_b071089197a7ced6(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_64_12_32 = (_Funcfunctional_0x60_filter_196d50d6a5b657be(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_63_12_48 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,100))))),Func(__context__->fnByMangledName(/*is_even Ci*/ 13416377918219290010u)))))));
+	_Func_0x60_verify_even_b071089197a7ced6(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_71_12_32 = (_Funcfunctional_0x60_filter_53efa21008623dcb(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_70_12_48 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,100))))),das_ascend<bool,_lambda_thismodule_71_25_14>::make(__context__,&__type_info__6eaa4ee09cf6186c,(([&]() -> _lambda_thismodule_71_25_14 {
+		_lambda_thismodule_71_25_14 __mks_71;
+		das_copy((__mks_71.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_71_25_14`function XS<::_lambda_thismodule_71_25_14> Ci*/ 5833227212949650636u))));
+		das_copy((__mks_71.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_71_25_14`finalizer X1<S<::_lambda_thismodule_71_25_14>>?*/ 17323985314034454032u))));
+		return __mks_71;
+	})())))))));
+	_Func_0x60_verify_even_b071089197a7ced6(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_78_12_32 = (_Funcfunctional_0x60_map_a60435d0c6456bd4(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_77_12_48 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,50))))),Func(__context__->fnByMangledName(/*twice Ci*/ 8053380109654962965u)))))));
+	_Func_0x60_verify_even_b071089197a7ced6(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_85_12_32 = (_Funcfunctional_0x60_map_58dc263556f6d651(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_84_12_48 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,50))))),das_ascend<int32_t,_lambda_thismodule_85_28_1>::make(__context__,&__type_info__2feb34e5d3529432,(([&]() -> _lambda_thismodule_85_28_1 {
+		_lambda_thismodule_85_28_1 __mks_85;
+		das_copy((__mks_85.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_85_28_1`function XS<::_lambda_thismodule_85_28_1> Ci*/ 7553957166788205930u))));
+		das_copy((__mks_85.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_85_28_1`finalizer X1<S<::_lambda_thismodule_85_28_1>>?*/ 4424892993805582696u))));
+		return __mks_85;
+	})())))))));
+	_Func_0x60_verify_even_b071089197a7ced6(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_93_12_32 = (_Funcfunctional_0x60_map_82ad2f6322b2be3d(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_92_12_48 = (_Funcfunctional_0x60_map_cb33d88d14d2480d(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_91_12_64 = (_Funcfunctional_0x60_filter_64323d9de00083a(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_90_14_80 = (_Funcbuiltin_0x60_each_7f633a072c41b03c(__context__,das_ascend<bool,_lambda_thismodule_90_14_11>::make(__context__,&__type_info__2f475a6f20815946,(([&]() -> _lambda_thismodule_90_14_11 {
+		_lambda_thismodule_90_14_11 __mks_90;
+		das_zero(__mks_90);
+		das_copy((__mks_90.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_90_14_11`function XS<::_lambda_thismodule_90_14_11> 1<i>A*/ 8752476815890222389u))));
+		das_copy((__mks_90.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_90_14_11`finalizer X1<S<::_lambda_thismodule_90_14_11>>?*/ 7977738798050276396u))));
+		return __mks_90;
+	})())))))),das_ascend<bool,_lambda_thismodule_91_25_26>::make(__context__,&__type_info__25a520ad1b30fd9,(([&]() -> _lambda_thismodule_91_25_26 {
+		_lambda_thismodule_91_25_26 __mks_91;
+		das_copy((__mks_91.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_91_25_26`function XS<::_lambda_thismodule_91_25_26> C1<i>A*/ 7486578186552142202u))));
+		das_copy((__mks_91.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_91_25_26`finalizer X1<S<::_lambda_thismodule_91_25_26>>?*/ 6208914807321435222u))));
+		return __mks_91;
+	})())))))),das_ascend<TArray<int32_t>,_lambda_thismodule_92_36_32>::make(__context__,&__type_info__d85a88cb0811b649,(([&]() -> _lambda_thismodule_92_36_32 {
+		_lambda_thismodule_92_36_32 __mks_92;
+		das_copy((__mks_92.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_92_36_32`function XS<::_lambda_thismodule_92_36_32> C1<i>A*/ 5831925149992380994u))));
+		das_copy((__mks_92.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_92_36_32`finalizer X1<S<::_lambda_thismodule_92_36_32>>?*/ 4579485301633637370u))));
+		return __mks_92;
+	})())))))),das_ascend<int32_t,_lambda_thismodule_93_29_35>::make(__context__,&__type_info__6a3930e350d8b9e7,(([&]() -> _lambda_thismodule_93_29_35 {
+		_lambda_thismodule_93_29_35 __mks_93;
+		das_copy((__mks_93.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_93_29_35`function XS<::_lambda_thismodule_93_29_35> C1<i>A*/ 10431591211831891946u))));
+		das_copy((__mks_93.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_93_29_35`finalizer X1<S<::_lambda_thismodule_93_29_35>>?*/ 10794705547767295626u))));
+		return __mks_93;
+	})())))))));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,_Funcfunctional_0x60_reduce_4a5fef6152ecc35b(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_99_12_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,10))))),das_make_block<int32_t,int32_t,int32_t>(__context__,96,0,&__func_info__d38a664a1724371c,[&](int32_t const  __x_rename_at_100, int32_t const  __y_rename_at_100) -> int32_t{
+		return das_auto_cast<int32_t>::cast(__x_rename_at_100 + __y_rename_at_100);
+	})),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,_Funcfunctional_0x60_reduce_e2370503bc5489f5(__context__,das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass((_temp_make_local_106_15_32 = (_Funcbuiltin_0x60_each_ref_77eafe8c9006a0(__context__,das_ascend<bool,_lambda_thismodule_106_15_5>::make(__context__,&__type_info__a177731b62cb70ec,(([&]() -> _lambda_thismodule_106_15_5 {
+		_lambda_thismodule_106_15_5 __mks_106;
+		das_zero(__mks_106);
+		das_copy((__mks_106.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_106_15_5`function XS<::_lambda_thismodule_106_15_5> &1<Ci>?*/ 6772321299619138280u))));
+		das_copy((__mks_106.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_106_15_5`finalizer X1<S<::_lambda_thismodule_106_15_5>>?*/ 17401491653742923728u))));
+		return __mks_106;
+	})())))))),das_make_block<int32_t,int32_t,int32_t>(__context__,112,0,&__func_info__d38a664a1724371c,[&](int32_t const  __x_rename_at_107, int32_t const  __y_rename_at_107) -> int32_t{
+		return das_auto_cast<int32_t>::cast(__x_rename_at_107 + __y_rename_at_107);
+	})),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,_Funcfunctional_0x60_reduce_a0bccddb56b604f(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_114_12_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,10))))),das_ascend<int32_t,_lambda_thismodule_115_27_15>::make(__context__,&__type_info__1dfcb9675860dcfc,(([&]() -> _lambda_thismodule_115_27_15 {
+		_lambda_thismodule_115_27_15 __mks_115;
+		das_copy((__mks_115.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_115_27_15`function XS<::_lambda_thismodule_115_27_15> Ci Ci*/ 15458072574639753146u))));
+		das_copy((__mks_115.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_115_27_15`finalizer X1<S<::_lambda_thismodule_115_27_15>>?*/ 8844705764011535640u))));
+		return __mks_115;
+	})()))),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,_Funcfunctional_0x60_reduce_c149d972cb8a23ee(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_122_12_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,10))))),Func(__context__->fnByMangledName(/*add Ci Ci*/ 18334826246998135716u))),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,_Funcfunctional_0x60_reduce_c149d972cb8a23ee(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_130_12_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(45,46))))),Func(__context__->fnByMangledName(/*add Ci Ci*/ 18334826246998135716u))),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,_Func_0x60_first_7932efd700c6a809(__context__,das_arg<TTuple<8,int32_t,float>>::pass((_temp_make_local_140_12_32 = (_Funcfunctional_0x60_reduce_8ae7fcb7e421f194(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_139_12_48 = (_Funcfunctional_0x60_map_e65bba8c18888e75(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_138_12_64 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,10))))),das_ascend<TTuple<8,int32_t,float>,_lambda_thismodule_139_28_6>::make(__context__,&__type_info__8875b5a4bb8f230d,(([&]() -> _lambda_thismodule_139_28_6 {
+		_lambda_thismodule_139_28_6 __mks_139;
+		das_copy((__mks_139.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_139_28_6`function XS<::_lambda_thismodule_139_28_6> Ci*/ 10337168955661683764u))));
+		das_copy((__mks_139.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_139_28_6`finalizer X1<S<::_lambda_thismodule_139_28_6>>?*/ 101448240992313054u))));
+		return __mks_139;
+	})())))))),das_make_block_cmres<TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const  &,TTuple<8,int32_t,float> const  &>(__context__,144,0,&__func_info__7e09640bf63233b,[&](TTuple<8,int32_t,float> const  & __x_rename_at_140, TTuple<8,int32_t,float> const  & __y_rename_at_140) -> TTuple<8,int32_t,float> const {
+		return das_auto_cast_ref<TTuple<8,int32_t,float> const >::cast((([&]() -> TTuple<8,int32_t,float> {
+			TTuple<8,int32_t,float> __mkt_140;
+			das_get_tuple_field<int32_t,0>::get(__mkt_140) = (das_get_tuple_field<int32_t,0>::get(__x_rename_at_140) + das_get_tuple_field<int32_t,0>::get(__y_rename_at_140));
+			das_get_tuple_field<float,4>::get(__mkt_140) = 2.f;
+			return __mkt_140;
+		})()));
+	})))))),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,_Funcfunctional_0x60_sum_c6bb83657fd0ca16(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_148_12_32 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,10)))))),45)));
+	DAS_VERIFY((_Funcfunctional_0x60_any_a5606ed295f053c9(__context__,das_arg<TDim<bool,2>>::pass((([&]() -> TDim<bool,2>& {
+		_temp_make_local_155_12_32(0,__context__) = true;
+		_temp_make_local_155_12_32(1,__context__) = false;
+		return _temp_make_local_155_12_32;
+	})())))));
+	DAS_VERIFY((_Funcfunctional_0x60_not_4c37d11112acdd2e(__context__,_Funcfunctional_0x60_any_cf35c74e31a01f2b(__context__,das_arg<Sequence DAS_COMMENT((bool))>::pass((_temp_make_local_163_12_32 = (_Funcfunctional_0x60_map_c631eb0100c760c2(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_162_12_48 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,10))))),das_ascend<bool,_lambda_thismodule_163_30_16>::make(__context__,&__type_info__3c724274ce6fd088,(([&]() -> _lambda_thismodule_163_30_16 {
+		_lambda_thismodule_163_30_16 __mks_163;
+		das_copy((__mks_163.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_163_30_16`function XS<::_lambda_thismodule_163_30_16> Ci*/ 6967241967881677426u))));
+		das_copy((__mks_163.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_163_30_16`finalizer X1<S<::_lambda_thismodule_163_30_16>>?*/ 16540221710712481608u))));
+		return __mks_163;
+	})()))))))))));
+	DAS_VERIFY((_Funcfunctional_0x60_all_927327c38b4c115b(__context__,das_arg<Sequence DAS_COMMENT((bool))>::pass((_temp_make_local_172_12_32 = (_Funcfunctional_0x60_map_c631eb0100c760c2(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_171_12_48 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,10))))),das_ascend<bool,_lambda_thismodule_172_30_17>::make(__context__,&__type_info__cd1cc76c0b5b3a3b,(([&]() -> _lambda_thismodule_172_30_17 {
+		_lambda_thismodule_172_30_17 __mks_172;
+		das_copy((__mks_172.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_172_30_17`function XS<::_lambda_thismodule_172_30_17> Ci*/ 13223761252910389548u))));
+		das_copy((__mks_172.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_172_30_17`finalizer X1<S<::_lambda_thismodule_172_30_17>>?*/ 16557156517026331416u))));
+		return __mks_172;
+	})())))))))));
+	DAS_VERIFY((_Funcfunctional_0x60_not_4c37d11112acdd2e(__context__,_Funcfunctional_0x60_all_927327c38b4c115b(__context__,das_arg<Sequence DAS_COMMENT((bool))>::pass((_temp_make_local_180_12_32 = (_Funcfunctional_0x60_map_c631eb0100c760c2(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_179_12_48 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,10))))),das_ascend<bool,_lambda_thismodule_180_30_18>::make(__context__,&__type_info__bd650e7b2b33be23,(([&]() -> _lambda_thismodule_180_30_18 {
+		_lambda_thismodule_180_30_18 __mks_180;
+		das_copy((__mks_180.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_180_30_18`function XS<::_lambda_thismodule_180_30_18> Ci*/ 16289326180299914960u))));
+		das_copy((__mks_180.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_180_30_18`finalizer X1<S<::_lambda_thismodule_180_30_18>>?*/ 16085197035545635080u))));
+		return __mks_180;
+	})()))))))))));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,_Funcfunctional_0x60_sum_c6bb83657fd0ca16(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_191_12_32 = (_Funcfunctional_0x60_islice_4597761baec84852(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_190_12_48 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(0,10))))),1,4))))),6)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,_Funcfunctional_0x60_sum_c6bb83657fd0ca16(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_199_12_32 = (_Funcfunctional_0x60_islice_4597761baec84852(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_198_12_48 = (_Funcfunctional_0x60_count_25d3d15e5f3ded6d(__context__,0,10)))),0,10))))),450)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,builtin_array_size(das_arg<TArray<int32_t>>::pass((_temp_make_local_208_12_32 = (_Funcbuiltin_0x60_to_array_937a16f0c7f42db(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_207_12_64 = (_Funcfunctional_0x60_islice_4597761baec84852(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_206_12_80 = (_Funcfunctional_0x60_repeat_429cd11f93b0bf2d(__context__,10,0)))),0,5))))))))),5)));
+	DAS_VERIFY((_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328(__context__,builtin_array_size(das_arg<TArray<int32_t>>::pass((_temp_make_local_216_12_32 = (_Funcbuiltin_0x60_to_array_937a16f0c7f42db(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_215_12_64 = (_Funcfunctional_0x60_repeat_429cd11f93b0bf2d(__context__,10,6))))))))),6)));
+	DAS_VERIFY((_Func_0x60_is_same_dfa418e31d233806(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_226_8_32 = (_Funcfunctional_0x60_islice_4597761baec84852(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_225_8_48 = (_Funcfunctional_0x60_cycle_591674320dc1e79c(__context__,das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_224_8_64 = (_Funcbuiltin_0x60_each_5cbab1dfe9635bc1(__context__,range(1,4))))))))),0,10)))),das_arg<Sequence DAS_COMMENT((int32_t))>::pass((_temp_make_local_227_19_80 = (_Funcbuiltin_0x60_each_2290b067fc65760f(__context__,das_ascend<bool,_lambda_thismodule_227_19_7>::make(__context__,&__type_info__db27357fa3eaaa3e,(([&]() -> _lambda_thismodule_227_19_7 {
+		_lambda_thismodule_227_19_7 __mks_227;
+		das_zero(__mks_227);
+		das_copy((__mks_227.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_227_19_7`function XS<::_lambda_thismodule_227_19_7> &i*/ 14000129570724364177u))));
+		das_copy((__mks_227.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_227_19_7`finalizer X1<S<::_lambda_thismodule_227_19_7>>?*/ 1520284161826329556u))));
+		return __mks_227;
+	})())))))))));
+	DAS_VERIFY((_Func_0x60_is_same_84e5a5cb0f2aec39(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_234_8_32 = (_Funcfunctional_0x60_islice_512aa7be2811ad88(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_233_8_48 = (_Funcfunctional_0x60_cycle_1fda9f623e354c0f(__context__,das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_232_10_64 = (_Funcbuiltin_0x60_each_5b8f7b8f8a92acc2(__context__,das_ascend<bool,_lambda_thismodule_232_10_8>::make(__context__,&__type_info__fe5a5d63abb87972,(([&]() -> _lambda_thismodule_232_10_8 {
+		_lambda_thismodule_232_10_8 __mks_232;
+		das_zero(__mks_232);
+		das_copy((__mks_232.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_232_10_8`function XS<::_lambda_thismodule_232_10_8> 0<i;f>U*/ 13898216724500756851u))));
+		das_copy((__mks_232.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_232_10_8`finalizer X1<S<::_lambda_thismodule_232_10_8>>?*/ 17503386922363931336u))));
+		return __mks_232;
+	})())))))))))),0,10)))),das_arg<Sequence DAS_COMMENT((TTuple<8,int32_t,float>))>::pass((_temp_make_local_235_18_96 = (_Funcbuiltin_0x60_each_5b8f7b8f8a92acc2(__context__,das_ascend<bool,_lambda_thismodule_235_18_9>::make(__context__,&__type_info__1c031d28e891379a,(([&]() -> _lambda_thismodule_235_18_9 {
+		_lambda_thismodule_235_18_9 __mks_235;
+		das_zero(__mks_235);
+		das_copy((__mks_235.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_235_18_9`function XS<::_lambda_thismodule_235_18_9> 0<i;f>U*/ 17532435174113720731u))));
+		das_copy((__mks_235.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_235_18_9`finalizer X1<S<::_lambda_thismodule_235_18_9>>?*/ 6243026897735230540u))));
+		return __mks_235;
+	})())))))))));
+	DAS_VERIFY((_Func_0x60_is_same_b2ee21551accec13(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_242_8_32 = (_Funcfunctional_0x60_islice_5c22d8af0bcd782e(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_241_8_48 = (_Funcfunctional_0x60_cycle_25feb1b3c1b57b4d(__context__,das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_240_10_64 = (_Funcbuiltin_0x60_each_7f633a072c41b03c(__context__,das_ascend<bool,_lambda_thismodule_240_10_12>::make(__context__,&__type_info__561b702296a83038,(([&]() -> _lambda_thismodule_240_10_12 {
+		_lambda_thismodule_240_10_12 __mks_240;
+		das_zero(__mks_240);
+		das_copy((__mks_240.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_240_10_12`function XS<::_lambda_thismodule_240_10_12> 1<i>A*/ 9303789722340153559u))));
+		das_copy((__mks_240.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_240_10_12`finalizer X1<S<::_lambda_thismodule_240_10_12>>?*/ 13001115373317045936u))));
+		return __mks_240;
+	})())))))))))),0,10)))),das_arg<Sequence DAS_COMMENT((TArray<int32_t>))>::pass((_temp_make_local_243_18_96 = (_Funcbuiltin_0x60_each_7f633a072c41b03c(__context__,das_ascend<bool,_lambda_thismodule_243_18_13>::make(__context__,&__type_info__aacae256c3713dd6,(([&]() -> _lambda_thismodule_243_18_13 {
+		_lambda_thismodule_243_18_13 __mks_243;
+		das_zero(__mks_243);
+		das_copy((__mks_243.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_243_18_13`function XS<::_lambda_thismodule_243_18_13> 1<i>A*/ 9720217594959356831u))));
+		das_copy((__mks_243.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_243_18_13`finalizer X1<S<::_lambda_thismodule_243_18_13>>?*/ 1624281604795845336u))));
+		return __mks_243;
+	})())))))))));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_cdc972ff02046fd8
+	aotLib[0xffaac39cba6e6445] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_36 &  ),&finalize_cdc972ff02046fd8>>();
+	};
+	// _Func_lambda_thismodule_32_12_36_0x60_function_f607d9b61b3cbd65
+	aotLib[0x5169b4b9d08e7915] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_32_12_36 & , int32_t &  ),&_Func_lambda_thismodule_32_12_36_0x60_function_f607d9b61b3cbd65>>();
+	};
+	// _Func_lambda_thismodule_32_12_36_0x60_finalizer_49b7f8641ea22224
+	aotLib[0x9d3d186d3e2fadc1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_36 *  ),&_Func_lambda_thismodule_32_12_36_0x60_finalizer_49b7f8641ea22224>>();
+	};
+	// finalize_a7122cc19257df9a
+	aotLib[0xd5fe2b2c25e0148d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_93_29_35 &  ),&finalize_a7122cc19257df9a>>();
+	};
+	// _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07
+	aotLib[0x44c6ff6768abbc55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> &  ),&_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07>>();
+	};
+	// _Func_lambda_thismodule_93_29_35_0x60_function_9952822083039823
+	aotLib[0x9bb9a44d74a4c4d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, _lambda_thismodule_93_29_35 & , TArray<int32_t> const  &  ),&_Func_lambda_thismodule_93_29_35_0x60_function_9952822083039823>>();
+	};
+	// _Func_lambda_thismodule_93_29_35_0x60_finalizer_77b7ae3fdea0e0ca
+	aotLib[0x6b4e4415e02a3ffd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_93_29_35 *  ),&_Func_lambda_thismodule_93_29_35_0x60_finalizer_77b7ae3fdea0e0ca>>();
+	};
+	// _Funcfunctional_0x60_map_any_6f89c8d21fd305a3
+	aotLib[0xc36f72dd40244ced] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & , Lambda DAS_COMMENT((int32_t,TArray<int32_t> const ))  ),&_Funcfunctional_0x60_map_any_6f89c8d21fd305a3>>();
+	};
+	// _Funcfunctional_0x60_map_82ad2f6322b2be3d
+	aotLib[0xf1f9225aa6d7c685] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & , Lambda DAS_COMMENT((int32_t,TArray<int32_t> const )) const   ),&_Funcfunctional_0x60_map_82ad2f6322b2be3d>>();
+	};
+	// finalize_3c86c1bfde120dbf
+	aotLib[0xe4de6a4268c955a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_37_12_34 &  ),&finalize_3c86c1bfde120dbf>>();
+	};
+	// _Func_lambda_thismodule_37_12_34_0x60_function_f63c018422c49b61
+	aotLib[0x8cd8e28df5622219] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_37_12_34 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_37_12_34_0x60_function_f63c018422c49b61>>();
+	};
+	// _Func_lambda_thismodule_37_12_34_0x60_finalizer_d0d84ad0da7c7220
+	aotLib[0xdefa8c13620f231f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_37_12_34 *  ),&_Func_lambda_thismodule_37_12_34_0x60_finalizer_d0d84ad0da7c7220>>();
+	};
+	// _Func_0x60_is_same_b2ee21551accec13
+	aotLib[0x8e28dbb598257b4f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) const  & , Sequence DAS_COMMENT((TArray<int32_t>)) const  &  ),&_Func_0x60_is_same_b2ee21551accec13>>();
+	};
+	// finalize_a8708c1dfb490536
+	aotLib[0xb76cd68157bb2045] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_153_12_33 &  ),&finalize_a8708c1dfb490536>>();
+	};
+	// _Func_0x60_is_same_84e5a5cb0f2aec39
+	aotLib[0xf104f53c45501321] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) const  & , Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  &  ),&_Func_0x60_is_same_84e5a5cb0f2aec39>>();
+	};
+	// finalize_6d04359a0a5cd8f8
+	aotLib[0xdd7117ff1aac07f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_153_12_31 &  ),&finalize_6d04359a0a5cd8f8>>();
+	};
+	// finalize_3f3f5513ea66b214
+	aotLib[0x9d38f712032a61c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_92_36_32 &  ),&finalize_3f3f5513ea66b214>>();
+	};
+	// _Func_lambda_thismodule_153_12_33_0x60_function_9e9637b431e74b6
+	aotLib[0x8896157d44c3512b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_153_12_33 & , TArray<int32_t> * &  ),&_Func_lambda_thismodule_153_12_33_0x60_function_9e9637b431e74b6>>();
+	};
+	// _Func_lambda_thismodule_153_12_33_0x60_finalizer_bb33e00c565f4444
+	aotLib[0xa9d88f7d48d06a8d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_153_12_33 *  ),&_Func_lambda_thismodule_153_12_33_0x60_finalizer_bb33e00c565f4444>>();
+	};
+	// _Funcbuiltin_0x60_finalize_b509dde46ca14424
+	aotLib[0x26192053e4fba60d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> &  ),&_Funcbuiltin_0x60_finalize_b509dde46ca14424>>();
+	};
+	// _Func_lambda_thismodule_153_12_31_0x60_function_80fcd9ca7e3cf082
+	aotLib[0xbd955925140d5f37] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_153_12_31 & , TTuple<8,int32_t,float> * &  ),&_Func_lambda_thismodule_153_12_31_0x60_function_80fcd9ca7e3cf082>>();
+	};
+	// _Func_lambda_thismodule_153_12_31_0x60_finalizer_663d1dae9fd024f8
+	aotLib[0x2eb1fd08e8ccbb85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_153_12_31 *  ),&_Func_lambda_thismodule_153_12_31_0x60_finalizer_663d1dae9fd024f8>>();
+	};
+	// _Funcbuiltin_0x60_finalize_943699eaf2940908
+	aotLib[0xa3f5c118930fbae3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<8,int32_t,float>> &  ),&_Funcbuiltin_0x60_finalize_943699eaf2940908>>();
+	};
+	// _Funcbuiltin_0x60_clone_4bc3594d348ca0bd
+	aotLib[0x1366ab6fb285c311] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_4bc3594d348ca0bd>>();
+	};
+	// _Func_lambda_thismodule_92_36_32_0x60_function_cc78477825a25340
+	aotLib[0x8b86c9a8eb2dff0e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, _lambda_thismodule_92_36_32 & , TArray<int32_t> const  &  ),&_Func_lambda_thismodule_92_36_32_0x60_function_cc78477825a25340>>();
+	};
+	// _Func_lambda_thismodule_92_36_32_0x60_finalizer_cc7541e2ca708852
+	aotLib[0x7a0e77dc85bcd4c1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_92_36_32 *  ),&_Func_lambda_thismodule_92_36_32_0x60_finalizer_cc7541e2ca708852>>();
+	};
+	// _Funcfunctional_0x60_map_any_abb3c25e106a138f
+	aotLib[0x816a59b039448ae4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t>)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & , Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const ))  ),&_Funcfunctional_0x60_map_any_abb3c25e106a138f>>();
+	};
+	// finalize_554c45dda146b8a6
+	aotLib[0x44f1f99164dafc69] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTuple<8,int32_t,float> &  ),&finalize_554c45dda146b8a6>>();
+	};
+	// _Funcbuiltin_0x60_each_e5c085c7199596c7
+	aotLib[0x3d1d6c1e748b8145] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, TArray<TArray<int32_t>> const  &  ),&_Funcbuiltin_0x60_each_e5c085c7199596c7>>();
+	};
+	// _Funcfunctional_0x60_map_cb33d88d14d2480d
+	aotLib[0x5c14ba0d7c3d2e32] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t>)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & , Lambda DAS_COMMENT((TArray<int32_t>,TArray<int32_t> const )) const   ),&_Funcfunctional_0x60_map_cb33d88d14d2480d>>();
+	};
+	// _Func_0x60_first_7932efd700c6a809
+	aotLib[0xf10802b672f22f95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TTuple<8,int32_t,float> const  &  ),&_Func_0x60_first_7932efd700c6a809>>();
+	};
+	// _Funcfunctional_0x60_not_4c37d11112acdd2e
+	aotLib[0xb4a3b9bed97b34bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, bool  ),&_Funcfunctional_0x60_not_4c37d11112acdd2e>>();
+	};
+	// finalize_b17394eacc4c2fb4
+	aotLib[0x79ea2629e738ad49] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_16_12_30 &  ),&finalize_b17394eacc4c2fb4>>();
+	};
+	// _Funcfunctional_0x60_reduce_any_63ae0eb44c98ece3
+	aotLib[0xee8e1e56519ec1e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTuple<8,int32_t,float> (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & , Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  ),&_Funcfunctional_0x60_reduce_any_63ae0eb44c98ece3>>();
+	};
+	// _Funcbuiltin_0x60_each_6a927dd59cc9e5af
+	aotLib[0x575449b94eb1ad09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) (*) ( Context * __context__, TArray<TTuple<8,int32_t,float>> const  &  ),&_Funcbuiltin_0x60_each_6a927dd59cc9e5af>>();
+	};
+	// _Funcfunctional_0x60_islice_5c22d8af0bcd782e
+	aotLib[0x6367be8732d1c960] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t> &)) & , int32_t , int32_t  ),&_Funcfunctional_0x60_islice_5c22d8af0bcd782e>>();
+	};
+	// finalize_c46c891cf327d7cc
+	aotLib[0xa1b60f9fc68d451] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_132_12_29 &  ),&finalize_c46c891cf327d7cc>>();
+	};
+	// _Func_lambda_thismodule_16_12_30_0x60_function_36566582fa5a0c04
+	aotLib[0x7d3fb766d272f8e1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_16_12_30 & , TArray<int32_t> * &  ),&_Func_lambda_thismodule_16_12_30_0x60_function_36566582fa5a0c04>>();
+	};
+	// _Func_lambda_thismodule_16_12_30_0x60_finalizer_d2e3d911fdbb85c0
+	aotLib[0x32ffb553e6adaad6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_16_12_30 *  ),&_Func_lambda_thismodule_16_12_30_0x60_finalizer_d2e3d911fdbb85c0>>();
+	};
+	// _Funcbuiltin_0x60_each_ref_ecc07dbeee89a093
+	aotLib[0xa9515bca006f3bed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t> * &)) const   ),&_Funcbuiltin_0x60_each_ref_ecc07dbeee89a093>>();
+	};
+	// _Funcfunctional_0x60_reduce_8ae7fcb7e421f194
+	aotLib[0xfede870018d9006b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTuple<8,int32_t,float> (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) const  & , Block DAS_COMMENT((TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const ,TTuple<8,int32_t,float> const )) const  &  ),&_Funcfunctional_0x60_reduce_8ae7fcb7e421f194>>();
+	};
+	// _Funcfunctional_0x60_islice_512aa7be2811ad88
+	aotLib[0x7627a7c8ef2fdd01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) & , int32_t , int32_t  ),&_Funcfunctional_0x60_islice_512aa7be2811ad88>>();
+	};
+	// finalize_d954bc5c1531c3e8
+	aotLib[0x5e593be97f3205d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_27 &  ),&finalize_d954bc5c1531c3e8>>();
+	};
+	// finalize_5b1a9415fc6c513f
+	aotLib[0xb273ccf87c9f6e3d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_132_12_28 &  ),&finalize_5b1a9415fc6c513f>>();
+	};
+	// _Funcbuiltin_0x60_each_a87e3fc9767b4917
+	aotLib[0xa9042b9c676edab5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t &)) (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_each_a87e3fc9767b4917>>();
+	};
+	// _Funcbuiltin_0x60_push_clone_17e595ccf2ea82f6
+	aotLib[0x7f77f81434f4f6a0] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_push_clone_17e595ccf2ea82f6>>();
+	};
+	// _Func_lambda_thismodule_132_12_29_0x60_function_7d490eafd2c92d0c
+	aotLib[0x7847e70f4e16b08f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_132_12_29 & , TArray<int32_t> * &  ),&_Func_lambda_thismodule_132_12_29_0x60_function_7d490eafd2c92d0c>>();
+	};
+	// _Func_lambda_thismodule_132_12_29_0x60_finalizer_ea6bb7fa1060675c
+	aotLib[0x9ef221c33a22773d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_132_12_29 *  ),&_Func_lambda_thismodule_132_12_29_0x60_finalizer_ea6bb7fa1060675c>>();
+	};
+	// _Funcbuiltin_0x60_each_ref_a42878a1c521709b
+	aotLib[0x9eb172e6ecc82025] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float> * &)) const   ),&_Funcbuiltin_0x60_each_ref_a42878a1c521709b>>();
+	};
+	// _Func_0x60_verify_even_b071089197a7ced6
+	aotLib[0x2f4f13f8dc531f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Func_0x60_verify_even_b071089197a7ced6>>();
+	};
+	// _Funcfunctional_0x60_any_cf35c74e31a01f2b
+	aotLib[0xeaf0278bd17dcedd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((bool)) const  &  ),&_Funcfunctional_0x60_any_cf35c74e31a01f2b>>();
+	};
+	// _Funcfunctional_0x60_all_927327c38b4c115b
+	aotLib[0x9b17e5fc8e4a0529] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((bool)) const  &  ),&_Funcfunctional_0x60_all_927327c38b4c115b>>();
+	};
+	// _Func_0x60_is_same_dfa418e31d233806
+	aotLib[0x5c2fae9d55da9b25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Sequence DAS_COMMENT((int32_t)) const  &  ),&_Func_0x60_is_same_dfa418e31d233806>>();
+	};
+	// finalize_9f43dfdcfe3beb0e
+	aotLib[0x2eb378e1cd314e11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_10_12_21 &  ),&finalize_9f43dfdcfe3beb0e>>();
+	};
+	// finalize_813bce9eea228d97
+	aotLib[0xf2221541225db825] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_10_12_22 &  ),&finalize_813bce9eea228d97>>();
+	};
+	// finalize_7b71d48649e95514
+	aotLib[0x95ecbdb4fb6eef11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_23 &  ),&finalize_7b71d48649e95514>>();
+	};
+	// finalize_396e7fbc677b3265
+	aotLib[0xd4f755303e8884d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_24 &  ),&finalize_396e7fbc677b3265>>();
+	};
+	// finalize_c08c6d331036ffee
+	aotLib[0x2484f4219214c359] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_25 &  ),&finalize_c08c6d331036ffee>>();
+	};
+	// finalize_2b16ae00fd6cbbd8
+	aotLib[0xd7fed082cdafb0f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_91_25_26 &  ),&finalize_2b16ae00fd6cbbd8>>();
+	};
+	// _Func_lambda_thismodule_32_12_27_0x60_function_d147be9547759e46
+	aotLib[0x908b2018ddf342b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_32_12_27 & , TTuple<8,int32_t,float> &  ),&_Func_lambda_thismodule_32_12_27_0x60_function_d147be9547759e46>>();
+	};
+	// _Func_lambda_thismodule_32_12_27_0x60_finalizer_f0b7c8307943e9f0
+	aotLib[0x2bb15ad34faf553d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_27 *  ),&_Func_lambda_thismodule_32_12_27_0x60_finalizer_f0b7c8307943e9f0>>();
+	};
+	// _Funcbuiltin_0x60_push_clone_ad6a7f9847ce0226
+	aotLib[0x63cda50c9b6f2d51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<8,int32_t,float>> & , TTuple<8,int32_t,float> const  &  ),&_Funcbuiltin_0x60_push_clone_ad6a7f9847ce0226>>();
+	};
+	// _Func_lambda_thismodule_132_12_28_0x60_function_3db3659e3c49d80f
+	aotLib[0xcd7f52b1d696921] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_132_12_28 & , TTuple<8,int32_t,float> * &  ),&_Func_lambda_thismodule_132_12_28_0x60_function_3db3659e3c49d80f>>();
+	};
+	// _Func_lambda_thismodule_132_12_28_0x60_finalizer_783b74ffb2f82a90
+	aotLib[0xa83fe0d42f882757] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_132_12_28 *  ),&_Func_lambda_thismodule_132_12_28_0x60_finalizer_783b74ffb2f82a90>>();
+	};
+	// _Funcbuiltin_0x60_each_32709ce2e3c1fbc5
+	aotLib[0x5a4e9c18a9a464a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((bool)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,bool &)) const   ),&_Funcbuiltin_0x60_each_32709ce2e3c1fbc5>>();
+	};
+	// finalize_37c401bbe712aa43
+	aotLib[0x6b0664be0991b071] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_147_12_19 &  ),&finalize_37c401bbe712aa43>>();
+	};
+	// finalize_c32e57face1564c
+	aotLib[0xf3014ca08c92f67d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_120_12_20 &  ),&finalize_c32e57face1564c>>();
+	};
+	// _Func_lambda_thismodule_10_12_21_0x60_function_fc1ca1e77ce10205
+	aotLib[0x7bd70b42c843351] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_10_12_21 & , int32_t &  ),&_Func_lambda_thismodule_10_12_21_0x60_function_fc1ca1e77ce10205>>();
+	};
+	// _Func_lambda_thismodule_10_12_21_0x60_finalizer_6cc1eed0b9a897f4
+	aotLib[0x207c50886a23f630] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_10_12_21 *  ),&_Func_lambda_thismodule_10_12_21_0x60_finalizer_6cc1eed0b9a897f4>>();
+	};
+	// _Func_lambda_thismodule_10_12_22_0x60_function_63e23fcd6be7b2a8
+	aotLib[0x78b515fde8ca55dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_10_12_22 & , int32_t &  ),&_Func_lambda_thismodule_10_12_22_0x60_function_63e23fcd6be7b2a8>>();
+	};
+	// _Func_lambda_thismodule_10_12_22_0x60_finalizer_bae38db824aeb9e4
+	aotLib[0xdee3205edfc9ecc9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_10_12_22 *  ),&_Func_lambda_thismodule_10_12_22_0x60_finalizer_bae38db824aeb9e4>>();
+	};
+	// _Func_lambda_thismodule_32_12_23_0x60_function_2e741abb3aa6adb0
+	aotLib[0xbf5812096be1bba5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_32_12_23 & , int32_t &  ),&_Func_lambda_thismodule_32_12_23_0x60_function_2e741abb3aa6adb0>>();
+	};
+	// _Func_lambda_thismodule_32_12_23_0x60_finalizer_87217fcfa3f68a10
+	aotLib[0x5d7b78d47df8e46e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_23 *  ),&_Func_lambda_thismodule_32_12_23_0x60_finalizer_87217fcfa3f68a10>>();
+	};
+	// _Func_lambda_thismodule_32_12_24_0x60_function_b489ed5292d4adb1
+	aotLib[0x950834b8342034e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_32_12_24 & , int32_t &  ),&_Func_lambda_thismodule_32_12_24_0x60_function_b489ed5292d4adb1>>();
+	};
+	// _Func_lambda_thismodule_32_12_24_0x60_finalizer_9cf00ca9417815b4
+	aotLib[0x14a1208bff2ad9fc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_24 *  ),&_Func_lambda_thismodule_32_12_24_0x60_finalizer_9cf00ca9417815b4>>();
+	};
+	// _Func_lambda_thismodule_32_12_25_0x60_function_998f9452d47a6b9d
+	aotLib[0x3ff25eed29fcb10d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_32_12_25 & , bool &  ),&_Func_lambda_thismodule_32_12_25_0x60_function_998f9452d47a6b9d>>();
+	};
+	// _Func_lambda_thismodule_32_12_25_0x60_finalizer_6405205b252e1870
+	aotLib[0xa57a936a7b8b0034] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_12_25 *  ),&_Func_lambda_thismodule_32_12_25_0x60_finalizer_6405205b252e1870>>();
+	};
+	// _Func_lambda_thismodule_91_25_26_0x60_function_15f2a680f0c86a65
+	aotLib[0x3ff8af4f35cea115] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_91_25_26 & , TArray<int32_t> const  &  ),&_Func_lambda_thismodule_91_25_26_0x60_function_15f2a680f0c86a65>>();
+	};
+	// _Func_lambda_thismodule_91_25_26_0x60_finalizer_17737d2831ca41c6
+	aotLib[0x51a59350ccbee87e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_91_25_26 *  ),&_Func_lambda_thismodule_91_25_26_0x60_finalizer_17737d2831ca41c6>>();
+	};
+	// _Funcfunctional_0x60_filter_any_8ac13c6d58727a6f
+	aotLib[0xe9231e94a5899c96] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & , Lambda DAS_COMMENT((bool,TArray<int32_t> const ))  ),&_Funcfunctional_0x60_filter_any_8ac13c6d58727a6f>>();
+	};
+	// _Func_lambda_thismodule_147_12_19_0x60_function_93f0381787fb4a78
+	aotLib[0x5f43ec294ae8990f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_147_12_19 & , int32_t &  ),&_Func_lambda_thismodule_147_12_19_0x60_function_93f0381787fb4a78>>();
+	};
+	// _Func_lambda_thismodule_147_12_19_0x60_finalizer_b08b52f53fe2adaa
+	aotLib[0x59a4c2e2c8f89a36] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_147_12_19 *  ),&_Func_lambda_thismodule_147_12_19_0x60_finalizer_b08b52f53fe2adaa>>();
+	};
+	// _Func_lambda_thismodule_120_12_20_0x60_function_4b1f73fc73a6c778
+	aotLib[0xe1c12125471b2a5b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_120_12_20 & , int32_t &  ),&_Func_lambda_thismodule_120_12_20_0x60_function_4b1f73fc73a6c778>>();
+	};
+	// _Func_lambda_thismodule_120_12_20_0x60_finalizer_3735d8877c952ae0
+	aotLib[0x7729054911535418] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_120_12_20 *  ),&_Func_lambda_thismodule_120_12_20_0x60_finalizer_3735d8877c952ae0>>();
+	};
+	// finalize_d2bdfafa2f479e21
+	aotLib[0x67dc79e5bf7d4d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_71_25_14 &  ),&finalize_d2bdfafa2f479e21>>();
+	};
+	// _Funcfunctional_0x60_reduce_any_ee3d36589b55482d
+	aotLib[0x17e0fa1550d98565] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & , Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  ),&_Funcfunctional_0x60_reduce_any_ee3d36589b55482d>>();
+	};
+	// finalize_b1fbd3f7f17aa107
+	aotLib[0x2a2c25d1169bb081] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_115_27_15 &  ),&finalize_b1fbd3f7f17aa107>>();
+	};
+	// finalize_4e811d32879905fb
+	aotLib[0x944ba510df1512d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_163_30_16 &  ),&finalize_4e811d32879905fb>>();
+	};
+	// finalize_9241f8123a6109c0
+	aotLib[0xe1eedb34cbdc7bf9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_172_30_17 &  ),&finalize_9241f8123a6109c0>>();
+	};
+	// finalize_3da670ae0d0fd49c
+	aotLib[0xa47707c93124647d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_180_30_18 &  ),&finalize_3da670ae0d0fd49c>>();
+	};
+	// _Funcbuiltin_0x60_push_clone_caf6494d1f59cf4e
+	aotLib[0x683c44aa23b4b64d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_clone_caf6494d1f59cf4e>>();
+	};
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Func_0x60_verify_14_c7953d9d52dffeef
+	aotLib[0xdfef0bdba8dc12e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) const  &  ),&_Func_0x60_verify_14_c7953d9d52dffeef>>();
+	};
+	// _Funcfunctional_0x60_filter_64323d9de00083a
+	aotLib[0xea8620a7c9a6b51f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) & , Lambda DAS_COMMENT((bool,TArray<int32_t> const )) const   ),&_Funcfunctional_0x60_filter_64323d9de00083a>>();
+	};
+	// _Funcfunctional_0x60_cycle_25feb1b3c1b57b4d
+	aotLib[0xe5cded0922c52432] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TArray<int32_t>)) &  ),&_Funcfunctional_0x60_cycle_25feb1b3c1b57b4d>>();
+	};
+	// finalize_dca9089a796b169e
+	aotLib[0xee807ba376e56789] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_56_21_10 &  ),&finalize_dca9089a796b169e>>();
+	};
+	// finalize_3c00f319f5878b9f
+	aotLib[0xc3df21be9eaefe61] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_90_14_11 &  ),&finalize_3c00f319f5878b9f>>();
+	};
+	// _Funcfunctional_0x60_map_any_2c26bc83fad607e0
+	aotLib[0x6afbde6dab9fba0c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t))  ),&_Funcfunctional_0x60_map_any_2c26bc83fad607e0>>();
+	};
+	// finalize_95e8646aced816cb
+	aotLib[0xb13322d9b7ead269] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_240_10_12 &  ),&finalize_95e8646aced816cb>>();
+	};
+	// finalize_5d81d27f4ab6f1ad
+	aotLib[0x9508fc5632cf05d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_243_18_13 &  ),&finalize_5d81d27f4ab6f1ad>>();
+	};
+	// _Func_0x60_verify_even_7e6d5ca7b65b79bf
+	aotLib[0x63c7e9a0ef114741] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  &  ),&_Func_0x60_verify_even_7e6d5ca7b65b79bf>>();
+	};
+	// _Funcbuiltin_0x60_each_7f633a072c41b03c
+	aotLib[0x424c8986aefc8339] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TArray<int32_t>)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TArray<int32_t>)) const   ),&_Funcbuiltin_0x60_each_7f633a072c41b03c>>();
+	};
+	// _Func_lambda_thismodule_71_25_14_0x60_function_4ef28c57d655e61b
+	aotLib[0xebccb3be27d0b6e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_71_25_14 & , int32_t  ),&_Func_lambda_thismodule_71_25_14_0x60_function_4ef28c57d655e61b>>();
+	};
+	// _Func_lambda_thismodule_71_25_14_0x60_finalizer_1de86f8b7e406fde
+	aotLib[0xcc63117a478adc5f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_71_25_14 *  ),&_Func_lambda_thismodule_71_25_14_0x60_finalizer_1de86f8b7e406fde>>();
+	};
+	// _Funcfunctional_0x60_reduce_e2370503bc5489f5
+	aotLib[0xa7a2a7724b930be1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t const  &)) const  & , Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  ),&_Funcfunctional_0x60_reduce_e2370503bc5489f5>>();
+	};
+	// _Func_lambda_thismodule_115_27_15_0x60_function_76c593a2d975afd9
+	aotLib[0xb1a1544dc1b70689] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, _lambda_thismodule_115_27_15 & , int32_t , int32_t  ),&_Func_lambda_thismodule_115_27_15_0x60_function_76c593a2d975afd9>>();
+	};
+	// _Func_lambda_thismodule_115_27_15_0x60_finalizer_b7ae6dadf312675a
+	aotLib[0xa5fc347f2f1995e6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_115_27_15 *  ),&_Func_lambda_thismodule_115_27_15_0x60_finalizer_b7ae6dadf312675a>>();
+	};
+	// _Func_lambda_thismodule_163_30_16_0x60_function_7c6e7fcacb6ae853
+	aotLib[0xe128c2d9cab5e035] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_163_30_16 & , int32_t  ),&_Func_lambda_thismodule_163_30_16_0x60_function_7c6e7fcacb6ae853>>();
+	};
+	// _Func_lambda_thismodule_163_30_16_0x60_finalizer_1efff7382e84e2aa
+	aotLib[0x90595d2504eddbf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_163_30_16 *  ),&_Func_lambda_thismodule_163_30_16_0x60_finalizer_1efff7382e84e2aa>>();
+	};
+	// _Func_lambda_thismodule_172_30_17_0x60_function_42c5b6ebaac79686
+	aotLib[0xcbc1273b086b310d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_172_30_17 & , int32_t  ),&_Func_lambda_thismodule_172_30_17_0x60_function_42c5b6ebaac79686>>();
+	};
+	// _Func_lambda_thismodule_172_30_17_0x60_finalizer_8ed4bb4bd4545e60
+	aotLib[0x154b6a1d40cc71a8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_172_30_17 *  ),&_Func_lambda_thismodule_172_30_17_0x60_finalizer_8ed4bb4bd4545e60>>();
+	};
+	// _Func_lambda_thismodule_180_30_18_0x60_function_d983c4a30551bc1c
+	aotLib[0xf94d719ae433068d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_180_30_18 & , int32_t  ),&_Func_lambda_thismodule_180_30_18_0x60_function_d983c4a30551bc1c>>();
+	};
+	// _Func_lambda_thismodule_180_30_18_0x60_finalizer_526d77f2b8437988
+	aotLib[0xe895d4dd55f97f2a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_180_30_18 *  ),&_Func_lambda_thismodule_180_30_18_0x60_finalizer_526d77f2b8437988>>();
+	};
+	// _Funcbuiltin_0x60_to_array_937a16f0c7f42db
+	aotLib[0xd5858834f9027884] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Funcbuiltin_0x60_to_array_937a16f0c7f42db>>();
+	};
+	// _Funcfunctional_0x60_cycle_1fda9f623e354c0f
+	aotLib[0x1c806d971aa4f4c8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float> &)) (*) ( Context * __context__, Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) &  ),&_Funcfunctional_0x60_cycle_1fda9f623e354c0f>>();
+	};
+	// finalize_9fda4bcc4531188d
+	aotLib[0x3b389fc04c6e7d31] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_163_8_2 &  ),&finalize_9fda4bcc4531188d>>();
+	};
+	// finalize_274ecf742fbb4581
+	aotLib[0x967a8107ceb3666d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_180_8_3 &  ),&finalize_274ecf742fbb4581>>();
+	};
+	// finalize_50a2b26c59df4fa5
+	aotLib[0x900a6b7adb72958d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_50_23_4 &  ),&finalize_50a2b26c59df4fa5>>();
+	};
+	// _Funcfunctional_0x60_filter_any_d390534166c9b0fe
+	aotLib[0xd2f061a15afa5d86] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Func DAS_COMMENT((bool,int32_t))  ),&_Funcfunctional_0x60_filter_any_d390534166c9b0fe>>();
+	};
+	// _Funcfunctional_0x60_filter_any_16f495c9a4a7b638
+	aotLib[0x1a63412d8b005890] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t))  ),&_Funcfunctional_0x60_filter_any_16f495c9a4a7b638>>();
+	};
+	// _Funcfunctional_0x60_map_any_a5ff5c864782eff8
+	aotLib[0x4368a722334d2f4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Func DAS_COMMENT((int32_t,int32_t))  ),&_Funcfunctional_0x60_map_any_a5ff5c864782eff8>>();
+	};
+	// _Funcfunctional_0x60_map_any_44bf1e6652c8539
+	aotLib[0x78e693425c4dd0b8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((int32_t,int32_t))  ),&_Funcfunctional_0x60_map_any_44bf1e6652c8539>>();
+	};
+	// _Funcfunctional_0x60_reduce_any_4f62a6a9473e89cc
+	aotLib[0x64c299e2ed724f25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  ),&_Funcfunctional_0x60_reduce_any_4f62a6a9473e89cc>>();
+	};
+	// finalize_1141d7256c227d21
+	aotLib[0xb77e767401933ed9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_106_15_5 &  ),&finalize_1141d7256c227d21>>();
+	};
+	// _Funcfunctional_0x60_reduce_any_97635aab05d44747
+	aotLib[0xe430da2ef42b8c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Funcfunctional_0x60_reduce_any_97635aab05d44747>>();
+	};
+	// _Funcfunctional_0x60_reduce_any_79d34fbb97d5d871
+	aotLib[0xa8593f7793bd31b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Func DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Funcfunctional_0x60_reduce_any_79d34fbb97d5d871>>();
+	};
+	// finalize_18fe4fcb57354a0c
+	aotLib[0xa1b51673a2c93b6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_139_28_6 &  ),&finalize_18fe4fcb57354a0c>>();
+	};
+	// _Funcfunctional_0x60_map_any_a694c9dcae22302f
+	aotLib[0xc0b9d2c20ee2f0b3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((bool)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t))  ),&_Funcfunctional_0x60_map_any_a694c9dcae22302f>>();
+	};
+	// finalize_36a3b02b1fb3dcf7
+	aotLib[0x12cf0178d7c5a5fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_227_19_7 &  ),&finalize_36a3b02b1fb3dcf7>>();
+	};
+	// finalize_a109dfbebfbc079f
+	aotLib[0x1e843425a469981d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_232_10_8 &  ),&finalize_a109dfbebfbc079f>>();
+	};
+	// finalize_daf2db5be95cd687
+	aotLib[0xbe1022c473cd9485] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_235_18_9 &  ),&finalize_daf2db5be95cd687>>();
+	};
+	// _Funcbuiltin_0x60_each_2290b067fc65760f
+	aotLib[0x2174fbe7e898cabd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t &)) const   ),&_Funcbuiltin_0x60_each_2290b067fc65760f>>();
+	};
+	// _Funcbuiltin_0x60_each_ref_77eafe8c9006a0
+	aotLib[0x16fe52960f26f455] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,int32_t const  * &)) const   ),&_Funcbuiltin_0x60_each_ref_77eafe8c9006a0>>();
+	};
+	// _Func_lambda_thismodule_56_21_10_0x60_function_c1552182905b575e
+	aotLib[0xa149f3a173a105f4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_56_21_10 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_56_21_10_0x60_function_c1552182905b575e>>();
+	};
+	// _Func_lambda_thismodule_56_21_10_0x60_finalizer_6390258da803cc74
+	aotLib[0x4c21d5e5ac150206] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_56_21_10 *  ),&_Func_lambda_thismodule_56_21_10_0x60_finalizer_6390258da803cc74>>();
+	};
+	// _Funcbuiltin_0x60_emplace_46aeb6a61c4e9221
+	aotLib[0xcf2120c183f7a219] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> & , TArray<int32_t> &  ),&_Funcbuiltin_0x60_emplace_46aeb6a61c4e9221>>();
+	};
+	// _Func_0x60_verify_14_ad9c7b801e624df0
+	aotLib[0x9a7e7eea6d8192f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TArray<int32_t>> const  &  ),&_Func_0x60_verify_14_ad9c7b801e624df0>>();
+	};
+	// _Func_lambda_thismodule_90_14_11_0x60_function_97913e537eef3fc2
+	aotLib[0x9452fd5439120d80] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_90_14_11 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_90_14_11_0x60_function_97913e537eef3fc2>>();
+	};
+	// _Func_lambda_thismodule_90_14_11_0x60_finalizer_398faab869104a98
+	aotLib[0x30d145301b4fe9d7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_90_14_11 *  ),&_Func_lambda_thismodule_90_14_11_0x60_finalizer_398faab869104a98>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd
+	aotLib[0x66e322246598e835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<int32_t> & (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd>>();
+	};
+	// _Funcfunctional_0x60_map_e65bba8c18888e75
+	aotLib[0x5dc5b8c8cf712d08] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((TTuple<8,int32_t,float>,int32_t)) const   ),&_Funcfunctional_0x60_map_e65bba8c18888e75>>();
+	};
+	// _Funcfunctional_0x60_is_equal_2af44bbc0bb6f328
+	aotLib[0xed006e1459e96d11] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t , int32_t  ),&_Funcfunctional_0x60_is_equal_2af44bbc0bb6f328>>();
+	};
+	// _Funcbuiltin_0x60_each_5b8f7b8f8a92acc2
+	aotLib[0x5ff902efa64c797d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((TTuple<8,int32_t,float>)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,TTuple<8,int32_t,float>)) const   ),&_Funcbuiltin_0x60_each_5b8f7b8f8a92acc2>>();
+	};
+	// _Func_lambda_thismodule_240_10_12_0x60_function_c0a50a3c44fb0f2b
+	aotLib[0x810c935862ba77ac] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_240_10_12 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_240_10_12_0x60_function_c0a50a3c44fb0f2b>>();
+	};
+	// _Func_lambda_thismodule_240_10_12_0x60_finalizer_722f889b1020677c
+	aotLib[0xad9b34ea3256bfc7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_240_10_12 *  ),&_Func_lambda_thismodule_240_10_12_0x60_finalizer_722f889b1020677c>>();
+	};
+	// _Func_lambda_thismodule_243_18_13_0x60_function_f36f4e4156384531
+	aotLib[0xaf42c33955271554] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_243_18_13 & , TArray<int32_t> &  ),&_Func_lambda_thismodule_243_18_13_0x60_function_f36f4e4156384531>>();
+	};
+	// _Func_lambda_thismodule_243_18_13_0x60_finalizer_5c6dfa59ff707404
+	aotLib[0xef4c4fc64acb0770] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_243_18_13 *  ),&_Func_lambda_thismodule_243_18_13_0x60_finalizer_5c6dfa59ff707404>>();
+	};
+	// finalize_2e9b369ff6b06689
+	aotLib[0xfe6880a5162199ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_85_28_1 &  ),&finalize_2e9b369ff6b06689>>();
+	};
+	// _Func_lambda_thismodule_163_8_2_0x60_function_cbaeea5cd4355223
+	aotLib[0xbbaa1b8e49a569cd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_163_8_2 & , int32_t &  ),&_Func_lambda_thismodule_163_8_2_0x60_function_cbaeea5cd4355223>>();
+	};
+	// _Func_lambda_thismodule_163_8_2_0x60_finalizer_97ef0e5f56e2c5fe
+	aotLib[0x69b05bbf8df06774] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_163_8_2 *  ),&_Func_lambda_thismodule_163_8_2_0x60_finalizer_97ef0e5f56e2c5fe>>();
+	};
+	// _Func_lambda_thismodule_180_8_3_0x60_function_a9f4fc5559e8f55a
+	aotLib[0x45e9d6d1e567672f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_180_8_3 & , int32_t &  ),&_Func_lambda_thismodule_180_8_3_0x60_function_a9f4fc5559e8f55a>>();
+	};
+	// _Func_lambda_thismodule_180_8_3_0x60_finalizer_b1b7f491be37702c
+	aotLib[0x60be945e5e778303] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_180_8_3 *  ),&_Func_lambda_thismodule_180_8_3_0x60_finalizer_b1b7f491be37702c>>();
+	};
+	// _Func_lambda_thismodule_50_23_4_0x60_function_acc8ccfc59a727e8
+	aotLib[0x12227083d5a3c043] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_50_23_4 & , int32_t const  * &  ),&_Func_lambda_thismodule_50_23_4_0x60_function_acc8ccfc59a727e8>>();
+	};
+	// _Func_lambda_thismodule_50_23_4_0x60_finalizer_d48a0c4dc1dec02c
+	aotLib[0x8571a4e804bfecbd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_50_23_4 *  ),&_Func_lambda_thismodule_50_23_4_0x60_finalizer_d48a0c4dc1dec02c>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Func_0x60_verify_even_6703252febc142e7
+	aotLib[0xd222e52d59a18749] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Func_0x60_verify_even_6703252febc142e7>>();
+	};
+	// _Funcfunctional_0x60_filter_196d50d6a5b657be
+	aotLib[0x514d5bb8f763b052] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Func DAS_COMMENT((bool,int32_t)) const   ),&_Funcfunctional_0x60_filter_196d50d6a5b657be>>();
+	};
+	// _Funcfunctional_0x60_filter_53efa21008623dcb
+	aotLib[0x7938d877f641a6e9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t)) const   ),&_Funcfunctional_0x60_filter_53efa21008623dcb>>();
+	};
+	// _Funcfunctional_0x60_map_a60435d0c6456bd4
+	aotLib[0xb41e6de9a044d64c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Func DAS_COMMENT((int32_t,int32_t)) const   ),&_Funcfunctional_0x60_map_a60435d0c6456bd4>>();
+	};
+	// _Funcfunctional_0x60_map_58dc263556f6d651
+	aotLib[0x382ef1174238c117] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((int32_t,int32_t)) const   ),&_Funcfunctional_0x60_map_58dc263556f6d651>>();
+	};
+	// _Funcfunctional_0x60_reduce_4a5fef6152ecc35b
+	aotLib[0x692675df59da9329] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Block DAS_COMMENT((int32_t,int32_t,int32_t)) const  &  ),&_Funcfunctional_0x60_reduce_4a5fef6152ecc35b>>();
+	};
+	// _Func_lambda_thismodule_106_15_5_0x60_function_4edb7cf4dd0af38f
+	aotLib[0x86ff1fe4dc741967] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_106_15_5 & , int32_t const  * &  ),&_Func_lambda_thismodule_106_15_5_0x60_function_4edb7cf4dd0af38f>>();
+	};
+	// _Func_lambda_thismodule_106_15_5_0x60_finalizer_b87dcc28f4b26ad4
+	aotLib[0x57c3d99eb6882ae3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_106_15_5 *  ),&_Func_lambda_thismodule_106_15_5_0x60_finalizer_b87dcc28f4b26ad4>>();
+	};
+	// _Funcfunctional_0x60_reduce_a0bccddb56b604f
+	aotLib[0xe1ac7d213133244f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Lambda DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Funcfunctional_0x60_reduce_a0bccddb56b604f>>();
+	};
+	// _Funcfunctional_0x60_reduce_c149d972cb8a23ee
+	aotLib[0x5a013afd0ba9035a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  & , Func DAS_COMMENT((int32_t,int32_t,int32_t)) const   ),&_Funcfunctional_0x60_reduce_c149d972cb8a23ee>>();
+	};
+	// _Func_lambda_thismodule_139_28_6_0x60_function_ecdee715a1fae593
+	aotLib[0xf7a7c1486298abf9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTuple<8,int32_t,float> (*) ( Context * __context__, _lambda_thismodule_139_28_6 & , int32_t  ),&_Func_lambda_thismodule_139_28_6_0x60_function_ecdee715a1fae593>>();
+	};
+	// _Func_lambda_thismodule_139_28_6_0x60_finalizer_b747e97a7829fa46
+	aotLib[0xe8c473a85585f4b7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_139_28_6 *  ),&_Func_lambda_thismodule_139_28_6_0x60_finalizer_b747e97a7829fa46>>();
+	};
+	// _Funcfunctional_0x60_sum_c6bb83657fd0ca16
+	aotLib[0xf14d34f54916e785] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) const  &  ),&_Funcfunctional_0x60_sum_c6bb83657fd0ca16>>();
+	};
+	// _Funcfunctional_0x60_map_c631eb0100c760c2
+	aotLib[0x94f1ec316d6cc021] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((bool)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , Lambda DAS_COMMENT((bool,int32_t)) const   ),&_Funcfunctional_0x60_map_c631eb0100c760c2>>();
+	};
+	// _Funcfunctional_0x60_islice_4597761baec84852
+	aotLib[0xbcdacd8b0aec6b45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) & , int32_t , int32_t  ),&_Funcfunctional_0x60_islice_4597761baec84852>>();
+	};
+	// _Funcfunctional_0x60_cycle_591674320dc1e79c
+	aotLib[0x66cecb8c0baa6bce] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, Sequence DAS_COMMENT((int32_t)) &  ),&_Funcfunctional_0x60_cycle_591674320dc1e79c>>();
+	};
+	// _Func_lambda_thismodule_227_19_7_0x60_function_1cec87bec4f6e7e1
+	aotLib[0xf3b131fe778fc47f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_227_19_7 & , int32_t &  ),&_Func_lambda_thismodule_227_19_7_0x60_function_1cec87bec4f6e7e1>>();
+	};
+	// _Func_lambda_thismodule_227_19_7_0x60_finalizer_f6e0cad214e51598
+	aotLib[0x77900dd802ebcd22] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_227_19_7 *  ),&_Func_lambda_thismodule_227_19_7_0x60_finalizer_f6e0cad214e51598>>();
+	};
+	// _Func_lambda_thismodule_232_10_8_0x60_function_b0f6cea462a9698d
+	aotLib[0x3f84eaf18b3ba11b] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_232_10_8 & , TTuple<8,int32_t,float> &  ),&_Func_lambda_thismodule_232_10_8_0x60_function_b0f6cea462a9698d>>();
+	};
+	// _Func_lambda_thismodule_232_10_8_0x60_finalizer_f0c678795587145c
+	aotLib[0xb1e787faf5eb31cf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_232_10_8 *  ),&_Func_lambda_thismodule_232_10_8_0x60_finalizer_f0c678795587145c>>();
+	};
+	// _Func_lambda_thismodule_235_18_9_0x60_function_2c3ebc5409dda05f
+	aotLib[0x2b220b4a2a6bb61f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_235_18_9 & , TTuple<8,int32_t,float> &  ),&_Func_lambda_thismodule_235_18_9_0x60_function_2c3ebc5409dda05f>>();
+	};
+	// _Func_lambda_thismodule_235_18_9_0x60_finalizer_f01773fb180129d8
+	aotLib[0xc04d2bc1809e669] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_235_18_9 *  ),&_Func_lambda_thismodule_235_18_9_0x60_finalizer_f01773fb180129d8>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_4a0c453305a7dd5
+	aotLib[0xc571c6f94ed2c5f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,2> &  ),&_Funcbuiltin_0x60_to_array_move_4a0c453305a7dd5>>();
+	};
+	// _Funcbuiltin_0x60_each_5cbab1dfe9635bc1
+	aotLib[0x8c2bf3089ff8b6f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, range  ),&_Funcbuiltin_0x60_each_5cbab1dfe9635bc1>>();
+	};
+	// _Func_lambda_thismodule_85_28_1_0x60_function_bddb2af26f5dab07
+	aotLib[0xcc3887418a859821] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, _lambda_thismodule_85_28_1 & , int32_t  ),&_Func_lambda_thismodule_85_28_1_0x60_function_bddb2af26f5dab07>>();
+	};
+	// _Func_lambda_thismodule_85_28_1_0x60_finalizer_3dc36ce0a81f940e
+	aotLib[0x327edf23af463190] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_85_28_1 *  ),&_Func_lambda_thismodule_85_28_1_0x60_finalizer_3dc36ce0a81f940e>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_f9adbdca370c7b15
+	aotLib[0xc186aedfb6d4be05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,3> &  ),&_Funcbuiltin_0x60_to_array_move_f9adbdca370c7b15>>();
+	};
+	// _Funcfunctional_0x60_any_a5606ed295f053c9
+	aotLib[0xdae7885028c860f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TDim<bool,2> const  &  ),&_Funcfunctional_0x60_any_a5606ed295f053c9>>();
+	};
+	// _Funcfunctional_0x60_count_25d3d15e5f3ded6d
+	aotLib[0xfc5f02dd9c70f52] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, int32_t , int32_t  ),&_Funcfunctional_0x60_count_25d3d15e5f3ded6d>>();
+	};
+	// _Funcfunctional_0x60_repeat_429cd11f93b0bf2d
+	aotLib[0x2163e4a7bd425f08] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t)) (*) ( Context * __context__, int32_t , int32_t  ),&_Funcfunctional_0x60_repeat_429cd11f93b0bf2d>>();
+	};
+	// is_even_9f92407af8b51b2c
+	aotLib[0xd071b9d19a9085c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, int32_t  ),&is_even_9f92407af8b51b2c>>();
+	};
+	// twice_aa4c716c97740337
+	aotLib[0xe9815055f07f1799] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&twice_aa4c716c97740337>>();
+	};
+	// add_8997dbbc2c7fa6aa
+	aotLib[0xded93289f7948165] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , int32_t  ),&add_8997dbbc2c7fa6aa>>();
+	};
+	// _FuncExclEqu_d496bfa20e8277a0
+	aotLib[0xa8294fdb7fe5db95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTuple<8,int32_t,float> const  & , TTuple<8,int32_t,float> const  &  ),&_FuncExclEqu_d496bfa20e8277a0>>();
+	};
+	// _FuncExclEqu_46b76804d5e31c7b
+	aotLib[0x41720b69387cc809] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<int32_t> const  & , TArray<int32_t> const  &  ),&_FuncExclEqu_46b76804d5e31c7b>>();
+	};
+	// test_253505bb95c128bc
+	aotLib[0x97d9261503521e7e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_253505bb95c128bc>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,113 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12185213865964997412 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline int32_t add_8997dbbc2c7fa6aa ( Context * __context__, int32_t __a_rename_at_1, int32_t __b_rename_at_1 );
+inline bool test_732326fd930b29e7 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t add_8997dbbc2c7fa6aa ( Context * __context__, int32_t __a_rename_at_1, int32_t __b_rename_at_1 )
+{
+	return das_auto_cast<int32_t>::cast(__a_rename_at_1 + __b_rename_at_1);
+}
+
+inline bool test_732326fd930b29e7 ( Context * __context__ )
+{
+	Func DAS_COMMENT((int32_t,int32_t,int32_t)) __fn_rename_at_6 = ((Func DAS_COMMENT((int32_t,int32_t,int32_t)))Func(__context__->fnByMangledName(/*add Ci Ci*/ 18334826246998135716u)));
+	int32_t __t_rename_at_7 = ((int32_t)das_invoke_function<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,__fn_rename_at_6,1,2));
+	DAS_ASSERT((__t_rename_at_7 == 3));
+	DAS_ASSERT((__fn_rename_at_6 != nullptr));
+	DAS_ASSERT((__fn_rename_at_6 == Func(__context__->fnByMangledName(/*add Ci Ci*/ 18334826246998135716u))));
+	DAS_ASSERT((!(__fn_rename_at_6 == nullptr)));
+	DAS_ASSERT((!(__fn_rename_at_6 != Func(__context__->fnByMangledName(/*add Ci Ci*/ 18334826246998135716u)))));
+	Func DAS_COMMENT((void)) __qq_rename_at_13; das_zero(__qq_rename_at_13);
+	DAS_ASSERT((__qq_rename_at_13 == nullptr));
+	bool __failed_rename_at_15 = false;
+	das_try_recover(__context__, [&]()
+	{
+		Func DAS_COMMENT((int32_t,int32_t,int32_t)) __fn2_rename_at_17; das_zero(__fn2_rename_at_17);
+		int32_t __t2_rename_at_18 = ((int32_t)das_invoke_function<int32_t>::invoke<int32_t,int32_t>(__context__,nullptr,__fn2_rename_at_17,1,2));
+	}, [&]()
+	{
+		das_copy(__failed_rename_at_15,true);
+	});
+	DAS_ASSERTF((__failed_rename_at_15),(((char *) "has to fail, invoking null function")));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// add_8997dbbc2c7fa6aa
+	aotLib[0xded93289f7948165] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , int32_t  ),&add_8997dbbc2c7fa6aa>>();
+	};
+	// test_732326fd930b29e7
+	aotLib[0xcb8e4a469754ae3f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_732326fd930b29e7>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
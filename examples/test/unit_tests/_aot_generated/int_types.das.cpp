@@ -0,0 +1,174 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15760793706931508851 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline void _Func_0x60_check12_e6461697caa060b7 ( Context * __context__, int32_t __a_rename_at_4, int32_t __b_rename_at_4, int8_t __c_rename_at_4 );
+inline void _Func_0x60_check12_2f585fae7bc23fe0 ( Context * __context__, int32_t __a_rename_at_4, int32_t __b_rename_at_4, uint8_t __c_rename_at_4 );
+inline void _Func_0x60_check12_16791310be80e1fa ( Context * __context__, int32_t __a_rename_at_4, int32_t __b_rename_at_4, int16_t __c_rename_at_4 );
+inline void _Func_0x60_check12_92087a1c8fead117 ( Context * __context__, int32_t __a_rename_at_4, int32_t __b_rename_at_4, uint16_t __c_rename_at_4 );
+inline bool test_3afc15a43ddf552 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Func_0x60_check12_e6461697caa060b7 ( Context * __context__, int32_t __a_rename_at_4, int32_t __b_rename_at_4, int8_t __c_rename_at_4 )
+{
+	int8_t __A_rename_at_5 = ((int8_t)int8_t(__a_rename_at_4));
+	int8_t __B_rename_at_6 = ((int8_t)int8_t(__b_rename_at_4));
+	int8_t __A__rename_at_7 = ((int8_t)int8_t(__a_rename_at_4 + 1));
+	DAS_ASSERT((!(das_equ_val(__A_rename_at_5,__B_rename_at_6))));
+	DAS_ASSERT((das_equ_val(__A__rename_at_7,__B_rename_at_6)));
+	DAS_ASSERT((das_nequ_val(__A_rename_at_5,__B_rename_at_6)));
+	DAS_ASSERT((!(das_nequ_val(__A__rename_at_7,__B_rename_at_6))));
+	DAS_ASSERT((das_equ_val(__c_rename_at_4,int8_t(0))));
+}
+
+inline void _Func_0x60_check12_2f585fae7bc23fe0 ( Context * __context__, int32_t __a_rename_at_4, int32_t __b_rename_at_4, uint8_t __c_rename_at_4 )
+{
+	uint8_t __A_rename_at_5 = ((uint8_t)uint8_t(__a_rename_at_4));
+	uint8_t __B_rename_at_6 = ((uint8_t)uint8_t(__b_rename_at_4));
+	uint8_t __A__rename_at_7 = ((uint8_t)uint8_t(__a_rename_at_4 + 1));
+	DAS_ASSERT((!(das_equ_val(__A_rename_at_5,__B_rename_at_6))));
+	DAS_ASSERT((das_equ_val(__A__rename_at_7,__B_rename_at_6)));
+	DAS_ASSERT((das_nequ_val(__A_rename_at_5,__B_rename_at_6)));
+	DAS_ASSERT((!(das_nequ_val(__A__rename_at_7,__B_rename_at_6))));
+	DAS_ASSERT((das_equ_val(__c_rename_at_4,uint8_t(0))));
+}
+
+inline void _Func_0x60_check12_16791310be80e1fa ( Context * __context__, int32_t __a_rename_at_4, int32_t __b_rename_at_4, int16_t __c_rename_at_4 )
+{
+	int16_t __A_rename_at_5 = ((int16_t)int16_t(__a_rename_at_4));
+	int16_t __B_rename_at_6 = ((int16_t)int16_t(__b_rename_at_4));
+	int16_t __A__rename_at_7 = ((int16_t)int16_t(__a_rename_at_4 + 1));
+	DAS_ASSERT((!(das_equ_val(__A_rename_at_5,__B_rename_at_6))));
+	DAS_ASSERT((das_equ_val(__A__rename_at_7,__B_rename_at_6)));
+	DAS_ASSERT((das_nequ_val(__A_rename_at_5,__B_rename_at_6)));
+	DAS_ASSERT((!(das_nequ_val(__A__rename_at_7,__B_rename_at_6))));
+	DAS_ASSERT((das_equ_val(__c_rename_at_4,int16_t(0))));
+}
+
+inline void _Func_0x60_check12_92087a1c8fead117 ( Context * __context__, int32_t __a_rename_at_4, int32_t __b_rename_at_4, uint16_t __c_rename_at_4 )
+{
+	uint16_t __A_rename_at_5 = ((uint16_t)uint16_t(__a_rename_at_4));
+	uint16_t __B_rename_at_6 = ((uint16_t)uint16_t(__b_rename_at_4));
+	uint16_t __A__rename_at_7 = ((uint16_t)uint16_t(__a_rename_at_4 + 1));
+	DAS_ASSERT((!(das_equ_val(__A_rename_at_5,__B_rename_at_6))));
+	DAS_ASSERT((das_equ_val(__A__rename_at_7,__B_rename_at_6)));
+	DAS_ASSERT((das_nequ_val(__A_rename_at_5,__B_rename_at_6)));
+	DAS_ASSERT((!(das_nequ_val(__A__rename_at_7,__B_rename_at_6))));
+	DAS_ASSERT((das_equ_val(__c_rename_at_4,uint16_t(0))));
+}
+
+inline bool test_3afc15a43ddf552 ( Context * __context__ )
+{
+	int32_t __i_rename_at_16 = 100500;
+	int64_t __li_rename_at_17 = INT64_C(100500100500100500);
+	uint32_t __u_rename_at_18 = 0xeu;
+	uint64_t __ul_rename_at_19 = UINT64_C(0x1650c4f16331594);
+	uint32_t __uh_rename_at_20 = 0x1au;
+	uint32_t __uhu_rename_at_21 = 0x12345678u;
+	uint64_t __uhl_rename_at_22 = UINT64_C(0x123456789abcdef);
+	uint64_t __uhlu_rename_at_23 = UINT64_C(0x123456789abcdef);
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	DAS_ASSERT((true));
+	int32_t __ch_rename_at_32 = ((int32_t)97);
+	DAS_ASSERT((__ch_rename_at_32 == 97));
+	_Func_0x60_check12_e6461697caa060b7(__context__,1,2,int8_t(0));
+	_Func_0x60_check12_2f585fae7bc23fe0(__context__,1,2,uint8_t(0));
+	_Func_0x60_check12_16791310be80e1fa(__context__,1,2,int16_t(0));
+	_Func_0x60_check12_92087a1c8fead117(__context__,1,2,uint16_t(0));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_check12_e6461697caa060b7
+	aotLib[0x4c8493823b11a825] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , int32_t , int8_t  ),&_Func_0x60_check12_e6461697caa060b7>>();
+	};
+	// _Func_0x60_check12_2f585fae7bc23fe0
+	aotLib[0x16ef471974d614bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , int32_t , uint8_t  ),&_Func_0x60_check12_2f585fae7bc23fe0>>();
+	};
+	// _Func_0x60_check12_16791310be80e1fa
+	aotLib[0xd3515dfe1d9b5bc9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , int32_t , int16_t  ),&_Func_0x60_check12_16791310be80e1fa>>();
+	};
+	// _Func_0x60_check12_92087a1c8fead117
+	aotLib[0xf7da874663735c89] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , int32_t , uint16_t  ),&_Func_0x60_check12_92087a1c8fead117>>();
+	};
+	// test_3afc15a43ddf552
+	aotLib[0xd01b91dd77c575bb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_3afc15a43ddf552>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,122 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_1324966002356073945 {
+
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__90f5707b5a6f641;
+
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+TypeInfo * __tinfo_1[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__90f5707b5a6f641 };
+
+inline bool test_3e60d3feb6fd9e88 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_3e60d3feb6fd9e88 ( Context * __context__ )
+{
+	char * __d_rename_at_17 = (char *)(((char *) "sy"));
+	SimPolicy<char *>::SetAdd((char *)&(__d_rename_at_17),cast<char *>::from(((char *) "m1")),*__context__,nullptr);
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__d_rename_at_17),cast<char *>::from(((char *) "sym1")),*__context__,nullptr)));
+	DAS_ASSERT((builtin_string_length(__d_rename_at_17,__context__) == 4));
+	TTable<char *,int32_t> __tab_rename_at_21; das_zero(__tab_rename_at_21);
+	{
+		bool __need_loop_22 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,100));
+		int32_t __i_rename_at_22;
+		__need_loop_22 = __i_iterator.first(__context__,(__i_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __i_iterator.next(__context__,(__i_rename_at_22)) )
+		{
+			das_copy(__tab_rename_at_21(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "sym")), cast<int32_t>::from(__i_rename_at_22))),__context__),__i_rename_at_22);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_22));
+	};
+	{
+		bool __need_loop_24 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(0,100));
+		int32_t __i_rename_at_24;
+		__need_loop_24 = __i_iterator.first(__context__,(__i_rename_at_24)) && __need_loop_24;
+		for ( ; __need_loop_24 ; __need_loop_24 = __i_iterator.next(__context__,(__i_rename_at_24)) )
+		{
+			DAS_VERIFY((__tab_rename_at_21(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_1, cast<char * const >::from(((char *) "sym")), cast<int32_t>::from(__i_rename_at_24))),__context__) == __i_rename_at_24));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_24));
+	};
+	DAS_VERIFY((__tab_rename_at_21(((char *) "sym42"),__context__) == 42));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// test_3e60d3feb6fd9e88
+	aotLib[0x340d8183506492a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_3e60d3feb6fd9e88>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
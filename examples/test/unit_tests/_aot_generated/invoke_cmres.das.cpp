@@ -0,0 +1,689 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15787415464048213641 {
+
+extern StructInfo __struct_info__7baa42e06e7590bc;
+extern StructInfo __struct_info__967c17db77d79ba5;
+extern StructInfo __struct_info__f35ff723fded4627;
+extern StructInfo __struct_info__3b3a59cd428063ff;
+extern StructInfo __struct_info__9815ec0219836ca3;
+extern TypeInfo __type_info__dfd82b908f3b1490;
+extern TypeInfo __type_info__ce34cf44aed6443;
+extern TypeInfo __type_info__e29d217e8d811cbd;
+extern TypeInfo __type_info__3fc36e1e5e709ce0;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__d76eb030cfea1752;
+extern TypeInfo __type_info__d2c88e34438c5e70;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern TypeInfo __type_info__929bca9ab5064930;
+extern TypeInfo __type_info__dcf75eab98dcc41b;
+extern TypeInfo __type_info__702268e1d54b40ce;
+extern TypeInfo __type_info__8f4face31c28dbd6;
+extern VarInfo __var_info__b7e826edd2c5a5e5;
+extern VarInfo __var_info__7ada44cb4eff3b94;
+extern VarInfo __var_info__a08aad2745ae5bc5;
+extern VarInfo __var_info__79aa75d0162b1cbb;
+extern VarInfo __var_info__3016ac89734381c0;
+extern VarInfo __var_info__a08aaa2745ae56ac;
+extern VarInfo __var_info__79f872afee1a3d89;
+extern VarInfo __var_info__2e512714657e5d3e;
+extern VarInfo __var_info__77820c1bf638a9c5;
+extern VarInfo __var_info__40582219b2d2f42d;
+extern VarInfo __var_info__562db9f4adbc4bec;
+extern FuncInfo __func_info__e7ce8e58c239d2f5;
+extern FuncInfo __func_info__b8cd57da424b1af1;
+extern FuncInfo __func_info__cacacf3c20c2af42;
+extern FuncInfo __func_info__3dbf6435ea5d39e8;
+
+TypeInfo * __type_info__40582219b2d2f42d_arg_types_var_8911008344399253692[2] = { &__type_info__e29d217e8d811cbd, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__7baa42e06e7590bc_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__dfd82b908f3b1490, nullptr, (TypeInfo **)__type_info__40582219b2d2f42d_arg_types_var_8911008344399253692, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x40582219b2d2f42d), "__lambda", 0 };
+TypeInfo * __type_info__7ada44cb4eff3b94_arg_types_var_8911008344399253692[1] = { &__type_info__dcf75eab98dcc41b };
+VarInfo __struct_info__7baa42e06e7590bc_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__7ada44cb4eff3b94_arg_types_var_8911008344399253692, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x7ada44cb4eff3b94), "__finalize", 8 };
+VarInfo * __struct_info__7baa42e06e7590bc_fields[2] =  { &__struct_info__7baa42e06e7590bc_field_0, &__struct_info__7baa42e06e7590bc_field_1 };
+StructInfo __struct_info__7baa42e06e7590bc = {"_lambda_thismodule_82_8_3", "", 6, __struct_info__7baa42e06e7590bc_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x7baa42e06e7590bc) };
+TypeInfo * __type_info__2e512714657e5d3e_arg_types_var_10843568234177207205[1] = { &__type_info__d76eb030cfea1752 };
+VarInfo __struct_info__967c17db77d79ba5_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ce34cf44aed6443, nullptr, (TypeInfo **)__type_info__2e512714657e5d3e_arg_types_var_10843568234177207205, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x2e512714657e5d3e), "__lambda", 0 };
+TypeInfo * __type_info__79aa75d0162b1cbb_arg_types_var_10843568234177207205[1] = { &__type_info__3fc36e1e5e709ce0 };
+VarInfo __struct_info__967c17db77d79ba5_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__79aa75d0162b1cbb_arg_types_var_10843568234177207205, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x79aa75d0162b1cbb), "__finalize", 8 };
+VarInfo * __struct_info__967c17db77d79ba5_fields[2] =  { &__struct_info__967c17db77d79ba5_field_0, &__struct_info__967c17db77d79ba5_field_1 };
+StructInfo __struct_info__967c17db77d79ba5 = {"_lambda_thismodule_80_8_2", "", 6, __struct_info__967c17db77d79ba5_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x967c17db77d79ba5) };
+VarInfo __struct_info__f35ff723fded4627_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa08aaa2745ae56ac), "a", 0 };
+VarInfo __struct_info__f35ff723fded4627_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa08aad2745ae5bc5), "b", 4 };
+VarInfo * __struct_info__f35ff723fded4627_fields[2] =  { &__struct_info__f35ff723fded4627_field_0, &__struct_info__f35ff723fded4627_field_1 };
+StructInfo __struct_info__f35ff723fded4627 = {"Foo", "", 0, __struct_info__f35ff723fded4627_fields, 2, 8, UINT64_C(0x0), nullptr, UINT64_C(0xf35ff723fded4627) };
+TypeInfo * __type_info__562db9f4adbc4bec_arg_types_var_4267822335005844479[2] = { &__type_info__d2c88e34438c5e70, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__3b3a59cd428063ff_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ce34cf44aed6443, nullptr, (TypeInfo **)__type_info__562db9f4adbc4bec_arg_types_var_4267822335005844479, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x562db9f4adbc4bec), "__lambda", 0 };
+TypeInfo * __type_info__79f872afee1a3d89_arg_types_var_4267822335005844479[1] = { &__type_info__702268e1d54b40ce };
+VarInfo __struct_info__3b3a59cd428063ff_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__79f872afee1a3d89_arg_types_var_4267822335005844479, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x79f872afee1a3d89), "__finalize", 8 };
+VarInfo * __struct_info__3b3a59cd428063ff_fields[2] =  { &__struct_info__3b3a59cd428063ff_field_0, &__struct_info__3b3a59cd428063ff_field_1 };
+StructInfo __struct_info__3b3a59cd428063ff = {"_lambda_thismodule_84_8_4", "", 6, __struct_info__3b3a59cd428063ff_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x3b3a59cd428063ff) };
+TypeInfo * __type_info__3016ac89734381c0_arg_types_var_10958924762038103203[1] = { &__type_info__929bca9ab5064930 };
+VarInfo __struct_info__9815ec0219836ca3_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__dfd82b908f3b1490, nullptr, (TypeInfo **)__type_info__3016ac89734381c0_arg_types_var_10958924762038103203, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x3016ac89734381c0), "__lambda", 0 };
+TypeInfo * __type_info__77820c1bf638a9c5_arg_types_var_10958924762038103203[1] = { &__type_info__8f4face31c28dbd6 };
+VarInfo __struct_info__9815ec0219836ca3_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__77820c1bf638a9c5_arg_types_var_10958924762038103203, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x77820c1bf638a9c5), "__finalize", 8 };
+VarInfo * __struct_info__9815ec0219836ca3_fields[2] =  { &__struct_info__9815ec0219836ca3_field_0, &__struct_info__9815ec0219836ca3_field_1 };
+StructInfo __struct_info__9815ec0219836ca3 = {"_lambda_thismodule_78_8_1", "", 6, __struct_info__9815ec0219836ca3_fields, 2, 16, UINT64_C(0x0), nullptr, UINT64_C(0x9815ec0219836ca3) };
+VarInfo __func_info__e7ce8e58c239d2f5_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xb7e826edd2c5a5e5), "t", 0 };
+VarInfo * __func_info__e7ce8e58c239d2f5_fields[1] =  { &__func_info__e7ce8e58c239d2f5_field_0 };
+FuncInfo __func_info__e7ce8e58c239d2f5 = {"invoke block<(t:int const):Foo const> const", "", __func_info__e7ce8e58c239d2f5_fields, 1, 32, &__type_info__ce34cf44aed6443, nullptr,0,UINT64_C(0xe7ce8e58c239d2f5), 0x0 };
+FuncInfo __func_info__b8cd57da424b1af1 = {"invoke block<Foo> const", "", nullptr, 0, 32, &__type_info__dfd82b908f3b1490, nullptr,0,UINT64_C(0xb8cd57da424b1af1), 0x0 };
+VarInfo __func_info__cacacf3c20c2af42_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0xb7e826edd2c5a5e5), "t", 0 };
+VarInfo * __func_info__cacacf3c20c2af42_fields[1] =  { &__func_info__cacacf3c20c2af42_field_0 };
+FuncInfo __func_info__cacacf3c20c2af42 = {"invoke block<(t:int const):Foo> const", "", __func_info__cacacf3c20c2af42_fields, 1, 32, &__type_info__dfd82b908f3b1490, nullptr,0,UINT64_C(0xcacacf3c20c2af42), 0x0 };
+FuncInfo __func_info__3dbf6435ea5d39e8 = {"invoke block<Foo const> const", "", nullptr, 0, 32, &__type_info__ce34cf44aed6443, nullptr,0,UINT64_C(0x3dbf6435ea5d39e8), 0x0 };
+TypeInfo __type_info__dfd82b908f3b1490 = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 8, UINT64_C(0xdfd82b908f3b1490) };
+TypeInfo __type_info__ce34cf44aed6443 = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 62, 8, UINT64_C(0xce34cf44aed6443) };
+TypeInfo __type_info__e29d217e8d811cbd = { Type::tStructure, &__struct_info__7baa42e06e7590bc, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0xe29d217e8d811cbd) };
+TypeInfo __type_info__3fc36e1e5e709ce0 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d76eb030cfea1752, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x3fc36e1e5e709ce0) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__d76eb030cfea1752 = { Type::tStructure, &__struct_info__967c17db77d79ba5, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0xd76eb030cfea1752) };
+TypeInfo __type_info__d2c88e34438c5e70 = { Type::tStructure, &__struct_info__3b3a59cd428063ff, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0xd2c88e34438c5e70) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+TypeInfo __type_info__929bca9ab5064930 = { Type::tStructure, &__struct_info__9815ec0219836ca3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 16, UINT64_C(0x929bca9ab5064930) };
+TypeInfo __type_info__dcf75eab98dcc41b = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__e29d217e8d811cbd, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xdcf75eab98dcc41b) };
+TypeInfo __type_info__702268e1d54b40ce = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__d2c88e34438c5e70, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x702268e1d54b40ce) };
+TypeInfo __type_info__8f4face31c28dbd6 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__929bca9ab5064930, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x8f4face31c28dbd6) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct Foo; };
+namespace  { struct _lambda_thismodule_78_8_1; };
+namespace  { struct _lambda_thismodule_80_8_2; };
+namespace  { struct _lambda_thismodule_82_8_3; };
+namespace  { struct _lambda_thismodule_84_8_4; };
+namespace  {
+
+struct Foo {
+	int32_t a;
+	int32_t b;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,a)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,b)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_78_8_1 {
+	Func DAS_COMMENT((Foo,_lambda_thismodule_78_8_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_78_8_1 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_78_8_1)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_78_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_78_8_1,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_80_8_2 {
+	Func DAS_COMMENT((Foo const ,_lambda_thismodule_80_8_2)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_80_8_2 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_80_8_2)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_80_8_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_80_8_2,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_82_8_3 {
+	Func DAS_COMMENT((Foo,_lambda_thismodule_82_8_3,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_82_8_3 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_82_8_3)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_82_8_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_82_8_3,__finalize)==8,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_84_8_4 {
+	Func DAS_COMMENT((Foo const ,_lambda_thismodule_84_8_4,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_84_8_4 *)) __finalize;
+};
+static_assert(sizeof(_lambda_thismodule_84_8_4)==16,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_84_8_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_84_8_4,__finalize)==8,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_f8583d09d2384fc5 ( Context * __context__, _lambda_thismodule_78_8_1 & ____this_rename_at_78 );
+inline void finalize_4559dafab4214607 ( Context * __context__, _lambda_thismodule_80_8_2 & ____this_rename_at_80 );
+inline void finalize_1ed22215a2d9efe8 ( Context * __context__, _lambda_thismodule_82_8_3 & ____this_rename_at_82 );
+inline void finalize_ff4d98c30878d45d ( Context * __context__, _lambda_thismodule_84_8_4 & ____this_rename_at_84 );
+inline void _Func_0x60_checkInvoke_f6acb50e76d02cea ( Context * __context__, Lambda DAS_COMMENT((Foo)) const  __obj_rename_at_43 );
+inline void _Func_0x60_checkInvoke_fbe025ecd36e091f ( Context * __context__, Lambda DAS_COMMENT((Foo const )) const  __obj_rename_at_43 );
+inline void _Func_0x60_checkInvoke_8b17825f9e1d8a3a ( Context * __context__, int32_t __arg_rename_at_47, Lambda DAS_COMMENT((Foo,int32_t)) const  __obj_rename_at_47 );
+inline void _Func_0x60_checkInvoke_a376f88edd75c28b ( Context * __context__, int32_t __arg_rename_at_47, Lambda DAS_COMMENT((Foo const ,int32_t)) const  __obj_rename_at_47 );
+inline void _Func_0x60_checkInvoke_2512a7eb20637486 ( Context * __context__, Func DAS_COMMENT((Foo)) const  __obj_rename_at_43 );
+inline void _Func_0x60_checkInvoke_4581c8bd7f19c7a ( Context * __context__, int32_t __arg_rename_at_47, Func DAS_COMMENT((Foo,int32_t)) const  __obj_rename_at_47 );
+inline void _Func_0x60_checkInvoke_21006ea006fac2fb ( Context * __context__, Func DAS_COMMENT((Foo const )) const  __obj_rename_at_43 );
+inline void _Func_0x60_checkInvoke_a9aa914cdb996ee3 ( Context * __context__, int32_t __arg_rename_at_47, Func DAS_COMMENT((Foo const ,int32_t)) const  __obj_rename_at_47 );
+inline void _Func_0x60_checkInvoke_45fdeafee28b3fc3 ( Context * __context__, Block DAS_COMMENT((Foo)) const  & __obj_rename_at_43 );
+inline void _Func_0x60_checkInvoke_d26305b7ba2b474a ( Context * __context__, Block DAS_COMMENT((Foo const )) const  & __obj_rename_at_43 );
+inline void _Func_0x60_checkInvoke_8537f1a4eca1f943 ( Context * __context__, int32_t __arg_rename_at_47, Block DAS_COMMENT((Foo,int32_t)) const  & __obj_rename_at_47 );
+inline void _Func_0x60_checkInvoke_f84b9263af85f04e ( Context * __context__, int32_t __arg_rename_at_47, Block DAS_COMMENT((Foo const ,int32_t)) const  & __obj_rename_at_47 );
+inline Foo _Func_lambda_thismodule_78_8_1_0x60_function_d499dd3966d78408 ( Context * __context__, _lambda_thismodule_78_8_1 & ____this_rename_at_78 );
+inline void _Func_lambda_thismodule_78_8_1_0x60_finalizer_30d07f40de87ba0a ( Context * __context__, _lambda_thismodule_78_8_1 * ____this_rename_at_78 );
+inline Foo const  _Func_lambda_thismodule_80_8_2_0x60_function_94d681e4e44cb9f9 ( Context * __context__, _lambda_thismodule_80_8_2 & ____this_rename_at_80 );
+inline void _Func_lambda_thismodule_80_8_2_0x60_finalizer_2471aee2d2bd95a ( Context * __context__, _lambda_thismodule_80_8_2 * ____this_rename_at_80 );
+inline Foo _Func_lambda_thismodule_82_8_3_0x60_function_26a3b921841e5b8 ( Context * __context__, _lambda_thismodule_82_8_3 & ____this_rename_at_82, int32_t __t_rename_at_81 );
+inline void _Func_lambda_thismodule_82_8_3_0x60_finalizer_5decda060d043a96 ( Context * __context__, _lambda_thismodule_82_8_3 * ____this_rename_at_82 );
+inline Foo const  _Func_lambda_thismodule_84_8_4_0x60_function_7aadc960c0193382 ( Context * __context__, _lambda_thismodule_84_8_4 & ____this_rename_at_84, int32_t __t_rename_at_83 );
+inline void _Func_lambda_thismodule_84_8_4_0x60_finalizer_7513e69faa3ed99e ( Context * __context__, _lambda_thismodule_84_8_4 * ____this_rename_at_84 );
+inline Foo func_7e7e557ba6b27168 ( Context * __context__ );
+inline Foo const  funcC_30e1dda0012bd03b ( Context * __context__ );
+inline Foo funcA_e054e073f79ca411 ( Context * __context__, int32_t __t_rename_at_16 );
+inline Foo const  funcAC_62759c7e77f0e4e0 ( Context * __context__, int32_t __t_rename_at_19 );
+inline Foo hfunc_7e7e557ba6b27168 ( Context * __context__ );
+inline Foo const  hfuncC_30e1dda0012bd03b ( Context * __context__ );
+inline Foo hfuncA_e054e073f79ca411 ( Context * __context__, int32_t __t_rename_at_31 );
+inline Foo const  hfuncAC_62759c7e77f0e4e0 ( Context * __context__, int32_t __t_rename_at_35 );
+inline void check_20af5b2d7236b527 ( Context * __context__, Foo const  & __t_rename_at_39 );
+inline bool test_c3c0b74dc9399ffe ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_f8583d09d2384fc5 ( Context * __context__, _lambda_thismodule_78_8_1 &  ____this_rename_at_78 )
+{
+	memset(&(____this_rename_at_78), 0, 16);
+}
+
+inline void finalize_4559dafab4214607 ( Context * __context__, _lambda_thismodule_80_8_2 &  ____this_rename_at_80 )
+{
+	memset(&(____this_rename_at_80), 0, 16);
+}
+
+inline void finalize_1ed22215a2d9efe8 ( Context * __context__, _lambda_thismodule_82_8_3 &  ____this_rename_at_82 )
+{
+	memset(&(____this_rename_at_82), 0, 16);
+}
+
+inline void finalize_ff4d98c30878d45d ( Context * __context__, _lambda_thismodule_84_8_4 &  ____this_rename_at_84 )
+{
+	memset(&(____this_rename_at_84), 0, 16);
+}
+
+inline void _Func_0x60_checkInvoke_f6acb50e76d02cea ( Context * __context__, Lambda DAS_COMMENT((Foo)) const  __obj_rename_at_43 )
+{
+	check_20af5b2d7236b527(__context__,das_arg<Foo>::pass(das_invoke_lambda<Foo>::invoke_cmres(__context__,nullptr,__obj_rename_at_43)));
+}
+
+inline void _Func_0x60_checkInvoke_fbe025ecd36e091f ( Context * __context__, Lambda DAS_COMMENT((Foo const )) const  __obj_rename_at_43 )
+{
+	check_20af5b2d7236b527(__context__,das_invoke_lambda<Foo const >::invoke_cmres(__context__,nullptr,__obj_rename_at_43));
+}
+
+inline void _Func_0x60_checkInvoke_8b17825f9e1d8a3a ( Context * __context__, int32_t __arg_rename_at_47, Lambda DAS_COMMENT((Foo,int32_t)) const  __obj_rename_at_47 )
+{
+	check_20af5b2d7236b527(__context__,das_arg<Foo>::pass(das_invoke_lambda<Foo>::invoke_cmres<int32_t>(__context__,nullptr,__obj_rename_at_47,__arg_rename_at_47)));
+}
+
+inline void _Func_0x60_checkInvoke_a376f88edd75c28b ( Context * __context__, int32_t __arg_rename_at_47, Lambda DAS_COMMENT((Foo const ,int32_t)) const  __obj_rename_at_47 )
+{
+	check_20af5b2d7236b527(__context__,das_invoke_lambda<Foo const >::invoke_cmres<int32_t>(__context__,nullptr,__obj_rename_at_47,__arg_rename_at_47));
+}
+
+inline void _Func_0x60_checkInvoke_2512a7eb20637486 ( Context * __context__, Func DAS_COMMENT((Foo)) const  __obj_rename_at_43 )
+{
+	check_20af5b2d7236b527(__context__,das_arg<Foo>::pass(das_invoke_function<Foo>::invoke_cmres(__context__,nullptr,__obj_rename_at_43)));
+}
+
+inline void _Func_0x60_checkInvoke_4581c8bd7f19c7a ( Context * __context__, int32_t __arg_rename_at_47, Func DAS_COMMENT((Foo,int32_t)) const  __obj_rename_at_47 )
+{
+	check_20af5b2d7236b527(__context__,das_arg<Foo>::pass(das_invoke_function<Foo>::invoke_cmres<int32_t>(__context__,nullptr,__obj_rename_at_47,__arg_rename_at_47)));
+}
+
+inline void _Func_0x60_checkInvoke_21006ea006fac2fb ( Context * __context__, Func DAS_COMMENT((Foo const )) const  __obj_rename_at_43 )
+{
+	check_20af5b2d7236b527(__context__,das_invoke_function<Foo const >::invoke_cmres(__context__,nullptr,__obj_rename_at_43));
+}
+
+inline void _Func_0x60_checkInvoke_a9aa914cdb996ee3 ( Context * __context__, int32_t __arg_rename_at_47, Func DAS_COMMENT((Foo const ,int32_t)) const  __obj_rename_at_47 )
+{
+	check_20af5b2d7236b527(__context__,das_invoke_function<Foo const >::invoke_cmres<int32_t>(__context__,nullptr,__obj_rename_at_47,__arg_rename_at_47));
+}
+
+inline void _Func_0x60_checkInvoke_45fdeafee28b3fc3 ( Context * __context__, Block DAS_COMMENT((Foo)) const  &  __obj_rename_at_43 )
+{
+	check_20af5b2d7236b527(__context__,das_arg<Foo>::pass(das_invoke<Foo>::invoke_cmres(__context__,nullptr,__obj_rename_at_43)));
+}
+
+inline void _Func_0x60_checkInvoke_d26305b7ba2b474a ( Context * __context__, Block DAS_COMMENT((Foo const )) const  &  __obj_rename_at_43 )
+{
+	check_20af5b2d7236b527(__context__,das_invoke<Foo const >::invoke_cmres(__context__,nullptr,__obj_rename_at_43));
+}
+
+inline void _Func_0x60_checkInvoke_8537f1a4eca1f943 ( Context * __context__, int32_t __arg_rename_at_47, Block DAS_COMMENT((Foo,int32_t)) const  &  __obj_rename_at_47 )
+{
+	check_20af5b2d7236b527(__context__,das_arg<Foo>::pass(das_invoke<Foo>::invoke_cmres<int32_t>(__context__,nullptr,__obj_rename_at_47,__arg_rename_at_47)));
+}
+
+inline void _Func_0x60_checkInvoke_f84b9263af85f04e ( Context * __context__, int32_t __arg_rename_at_47, Block DAS_COMMENT((Foo const ,int32_t)) const  &  __obj_rename_at_47 )
+{
+	check_20af5b2d7236b527(__context__,das_invoke<Foo const >::invoke_cmres<int32_t>(__context__,nullptr,__obj_rename_at_47,__arg_rename_at_47));
+}
+
+inline Foo _Func_lambda_thismodule_78_8_1_0x60_function_d499dd3966d78408 ( Context * __context__, _lambda_thismodule_78_8_1 &  ____this_rename_at_78 )
+{
+	return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+		Foo __mks_78;
+		das_copy((__mks_78.a),(1));
+		das_copy((__mks_78.b),(2));
+		return __mks_78;
+	})()));
+}
+
+inline void _Func_lambda_thismodule_78_8_1_0x60_finalizer_30d07f40de87ba0a ( Context * __context__, _lambda_thismodule_78_8_1 * ____this_rename_at_78 )
+{
+	finalize_f8583d09d2384fc5(__context__,das_arg<_lambda_thismodule_78_8_1>::pass(das_deref(__context__,____this_rename_at_78)));
+	das_delete_lambda_struct<_lambda_thismodule_78_8_1 *>::clear(__context__,____this_rename_at_78);
+}
+
+inline Foo const  _Func_lambda_thismodule_80_8_2_0x60_function_94d681e4e44cb9f9 ( Context * __context__, _lambda_thismodule_80_8_2 &  ____this_rename_at_80 )
+{
+	return das_auto_cast_ref<Foo const >::cast((([&]() -> Foo {
+		Foo __mks_80;
+		das_copy((__mks_80.a),(1));
+		das_copy((__mks_80.b),(2));
+		return __mks_80;
+	})()));
+}
+
+inline void _Func_lambda_thismodule_80_8_2_0x60_finalizer_2471aee2d2bd95a ( Context * __context__, _lambda_thismodule_80_8_2 * ____this_rename_at_80 )
+{
+	finalize_4559dafab4214607(__context__,das_arg<_lambda_thismodule_80_8_2>::pass(das_deref(__context__,____this_rename_at_80)));
+	das_delete_lambda_struct<_lambda_thismodule_80_8_2 *>::clear(__context__,____this_rename_at_80);
+}
+
+inline Foo _Func_lambda_thismodule_82_8_3_0x60_function_26a3b921841e5b8 ( Context * __context__, _lambda_thismodule_82_8_3 &  ____this_rename_at_82, int32_t __t_rename_at_81 )
+{
+	return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+		Foo __mks_82;
+		das_copy((__mks_82.a),(__t_rename_at_81));
+		das_copy((__mks_82.b),((__t_rename_at_81 + 1)));
+		return __mks_82;
+	})()));
+}
+
+inline void _Func_lambda_thismodule_82_8_3_0x60_finalizer_5decda060d043a96 ( Context * __context__, _lambda_thismodule_82_8_3 * ____this_rename_at_82 )
+{
+	finalize_1ed22215a2d9efe8(__context__,das_arg<_lambda_thismodule_82_8_3>::pass(das_deref(__context__,____this_rename_at_82)));
+	das_delete_lambda_struct<_lambda_thismodule_82_8_3 *>::clear(__context__,____this_rename_at_82);
+}
+
+inline Foo const  _Func_lambda_thismodule_84_8_4_0x60_function_7aadc960c0193382 ( Context * __context__, _lambda_thismodule_84_8_4 &  ____this_rename_at_84, int32_t __t_rename_at_83 )
+{
+	return das_auto_cast_ref<Foo const >::cast((([&]() -> Foo {
+		Foo __mks_84;
+		das_copy((__mks_84.a),(__t_rename_at_83));
+		das_copy((__mks_84.b),((__t_rename_at_83 + 1)));
+		return __mks_84;
+	})()));
+}
+
+inline void _Func_lambda_thismodule_84_8_4_0x60_finalizer_7513e69faa3ed99e ( Context * __context__, _lambda_thismodule_84_8_4 * ____this_rename_at_84 )
+{
+	finalize_ff4d98c30878d45d(__context__,das_arg<_lambda_thismodule_84_8_4>::pass(das_deref(__context__,____this_rename_at_84)));
+	das_delete_lambda_struct<_lambda_thismodule_84_8_4 *>::clear(__context__,____this_rename_at_84);
+}
+
+inline Foo func_7e7e557ba6b27168 ( Context * __context__ )
+{
+	return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+		Foo __mks_11;
+		das_copy((__mks_11.a),(1));
+		das_copy((__mks_11.b),(2));
+		return __mks_11;
+	})()));
+}
+
+inline Foo const  funcC_30e1dda0012bd03b ( Context * __context__ )
+{
+	return das_auto_cast_ref<Foo const >::cast((([&]() -> Foo {
+		Foo __mks_14;
+		das_copy((__mks_14.a),(1));
+		das_copy((__mks_14.b),(2));
+		return __mks_14;
+	})()));
+}
+
+inline Foo funcA_e054e073f79ca411 ( Context * __context__, int32_t __t_rename_at_16 )
+{
+	return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+		Foo __mks_17;
+		das_copy((__mks_17.a),(__t_rename_at_16));
+		das_copy((__mks_17.b),((__t_rename_at_16 + 1)));
+		return __mks_17;
+	})()));
+}
+
+inline Foo const  funcAC_62759c7e77f0e4e0 ( Context * __context__, int32_t __t_rename_at_19 )
+{
+	return das_auto_cast_ref<Foo const >::cast((([&]() -> Foo {
+		Foo __mks_20;
+		das_copy((__mks_20.a),(__t_rename_at_19));
+		das_copy((__mks_20.b),((__t_rename_at_19 + 1)));
+		return __mks_20;
+	})()));
+}
+
+inline Foo hfunc_7e7e557ba6b27168 ( Context * __context__ )
+{
+	return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+		Foo __mks_24;
+		das_copy((__mks_24.a),(1));
+		das_copy((__mks_24.b),(2));
+		return __mks_24;
+	})()));
+}
+
+inline Foo const  hfuncC_30e1dda0012bd03b ( Context * __context__ )
+{
+	return das_auto_cast_ref<Foo const >::cast((([&]() -> Foo {
+		Foo __mks_28;
+		das_copy((__mks_28.a),(1));
+		das_copy((__mks_28.b),(2));
+		return __mks_28;
+	})()));
+}
+
+inline Foo hfuncA_e054e073f79ca411 ( Context * __context__, int32_t __t_rename_at_31 )
+{
+	return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+		Foo __mks_32;
+		das_copy((__mks_32.a),(__t_rename_at_31));
+		das_copy((__mks_32.b),((__t_rename_at_31 + 1)));
+		return __mks_32;
+	})()));
+}
+
+inline Foo const  hfuncAC_62759c7e77f0e4e0 ( Context * __context__, int32_t __t_rename_at_35 )
+{
+	return das_auto_cast_ref<Foo const >::cast((([&]() -> Foo {
+		Foo __mks_36;
+		das_copy((__mks_36.a),(__t_rename_at_35));
+		das_copy((__mks_36.b),((__t_rename_at_35 + 1)));
+		return __mks_36;
+	})()));
+}
+
+inline void check_20af5b2d7236b527 ( Context * __context__, Foo const  &  __t_rename_at_39 )
+{
+	DAS_ASSERT(((__t_rename_at_39.a == 1) && (__t_rename_at_39.b == 2)));
+}
+
+inline bool test_c3c0b74dc9399ffe ( Context * __context__ ) { das_stack_prologue __prologue(__context__,112,"test " DAS_FILE_LINE);
+{
+	Foo _temp_make_local_53_10_32;
+	Foo _temp_make_local_54_10_32;
+	Foo _temp_make_local_55_10_32;
+	Foo _temp_make_local_56_10_32;
+	Foo _temp_make_local_58_10_32;
+	Foo _temp_make_local_59_10_32;
+	Foo _temp_make_local_60_10_32;
+	Foo _temp_make_local_61_10_32;
+	check_20af5b2d7236b527(__context__,das_arg<Foo>::pass((_temp_make_local_53_10_32 = (func_7e7e557ba6b27168(__context__)))));
+	check_20af5b2d7236b527(__context__,das_arg<Foo>::pass((_temp_make_local_54_10_32 = (funcA_e054e073f79ca411(__context__,1)))));
+	check_20af5b2d7236b527(__context__,(_temp_make_local_55_10_32 = (funcC_30e1dda0012bd03b(__context__))));
+	check_20af5b2d7236b527(__context__,(_temp_make_local_56_10_32 = (funcAC_62759c7e77f0e4e0(__context__,1))));
+	check_20af5b2d7236b527(__context__,das_arg<Foo>::pass((_temp_make_local_58_10_32 = (das_invoke_function<Foo>::invoke_cmres(__context__,nullptr,Func(__context__->fnByMangledName(/*hfunc*/ 12678799806380041669u)))))));
+	check_20af5b2d7236b527(__context__,das_arg<Foo>::pass((_temp_make_local_59_10_32 = (das_invoke_function<Foo>::invoke_cmres<int32_t>(__context__,nullptr,Func(__context__->fnByMangledName(/*hfuncA Ci*/ 7127291853104642852u)),1)))));
+	check_20af5b2d7236b527(__context__,(_temp_make_local_60_10_32 = (das_invoke_function<Foo const >::invoke_cmres(__context__,nullptr,Func(__context__->fnByMangledName(/*hfuncC*/ 10286451569924506290u))))));
+	check_20af5b2d7236b527(__context__,(_temp_make_local_61_10_32 = (das_invoke_function<Foo const >::invoke_cmres<int32_t>(__context__,nullptr,Func(__context__->fnByMangledName(/*hfuncAC Ci*/ 8176580411409194527u)),1))));
+	_Func_0x60_checkInvoke_2512a7eb20637486(__context__,Func(__context__->fnByMangledName(/*func*/ 9683446703893978791u)));
+	_Func_0x60_checkInvoke_4581c8bd7f19c7a(__context__,1,Func(__context__->fnByMangledName(/*funcA Ci*/ 400755876040597266u)));
+	_Func_0x60_checkInvoke_21006ea006fac2fb(__context__,Func(__context__->fnByMangledName(/*funcC*/ 6954765484320980332u)));
+	_Func_0x60_checkInvoke_a9aa914cdb996ee3(__context__,1,Func(__context__->fnByMangledName(/*funcAC Ci*/ 12322104027896331301u)));
+	_Func_0x60_checkInvoke_45fdeafee28b3fc3(__context__,das_make_block_cmres<Foo>(__context__,80,0,&__func_info__b8cd57da424b1af1,[&]() -> Foo{
+		return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+			Foo __mks_69;
+			das_copy((__mks_69.a),(1));
+			das_copy((__mks_69.b),(2));
+			return __mks_69;
+		})()));
+	}));
+	_Func_0x60_checkInvoke_d26305b7ba2b474a(__context__,das_make_block_cmres<Foo const >(__context__,80,0,&__func_info__3dbf6435ea5d39e8,[&]() -> Foo const {
+		return das_auto_cast_ref<Foo const >::cast((([&]() -> Foo {
+			Foo __mks_71;
+			das_copy((__mks_71.a),(1));
+			das_copy((__mks_71.b),(2));
+			return __mks_71;
+		})()));
+	}));
+	_Func_0x60_checkInvoke_8537f1a4eca1f943(__context__,1,das_make_block_cmres<Foo,int32_t>(__context__,80,0,&__func_info__cacacf3c20c2af42,[&](int32_t const  __t_rename_at_72) -> Foo{
+		return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+			Foo __mks_73;
+			das_copy((__mks_73.a),(__t_rename_at_72));
+			das_copy((__mks_73.b),((__t_rename_at_72 + 1)));
+			return __mks_73;
+		})()));
+	}));
+	_Func_0x60_checkInvoke_f84b9263af85f04e(__context__,1,das_make_block_cmres<Foo const ,int32_t>(__context__,80,0,&__func_info__e7ce8e58c239d2f5,[&](int32_t const  __t_rename_at_74) -> Foo const {
+		return das_auto_cast_ref<Foo const >::cast((([&]() -> Foo {
+			Foo __mks_75;
+			das_copy((__mks_75.a),(__t_rename_at_74));
+			das_copy((__mks_75.b),((__t_rename_at_74 + 1)));
+			return __mks_75;
+		})()));
+	}));
+	_Func_0x60_checkInvoke_f6acb50e76d02cea(__context__,das_ascend<Foo,_lambda_thismodule_78_8_1>::make(__context__,&__type_info__929bca9ab5064930,(([&]() -> _lambda_thismodule_78_8_1 {
+		_lambda_thismodule_78_8_1 __mks_78;
+		das_copy((__mks_78.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_78_8_1`function XS<::_lambda_thismodule_78_8_1>*/ 13138676524240961128u))));
+		das_copy((__mks_78.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_78_8_1`finalizer X1<S<::_lambda_thismodule_78_8_1>>?*/ 9614160402735625584u))));
+		return __mks_78;
+	})())));
+	_Func_0x60_checkInvoke_fbe025ecd36e091f(__context__,das_ascend<Foo,_lambda_thismodule_80_8_2>::make(__context__,&__type_info__d76eb030cfea1752,(([&]() -> _lambda_thismodule_80_8_2 {
+		_lambda_thismodule_80_8_2 __mks_80;
+		das_copy((__mks_80.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_80_8_2`function XS<::_lambda_thismodule_80_8_2>*/ 1722361982195479240u))));
+		das_copy((__mks_80.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_80_8_2`finalizer X1<S<::_lambda_thismodule_80_8_2>>?*/ 10412935729603487096u))));
+		return __mks_80;
+	})())));
+	_Func_0x60_checkInvoke_8b17825f9e1d8a3a(__context__,1,das_ascend<Foo,_lambda_thismodule_82_8_3>::make(__context__,&__type_info__e29d217e8d811cbd,(([&]() -> _lambda_thismodule_82_8_3 {
+		_lambda_thismodule_82_8_3 __mks_82;
+		das_copy((__mks_82.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_82_8_3`function XS<::_lambda_thismodule_82_8_3> Ci*/ 6059213712577217288u))));
+		das_copy((__mks_82.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_82_8_3`finalizer X1<S<::_lambda_thismodule_82_8_3>>?*/ 16306215717724919366u))));
+		return __mks_82;
+	})())));
+	_Func_0x60_checkInvoke_a376f88edd75c28b(__context__,1,das_ascend<Foo,_lambda_thismodule_84_8_4>::make(__context__,&__type_info__d2c88e34438c5e70,(([&]() -> _lambda_thismodule_84_8_4 {
+		_lambda_thismodule_84_8_4 __mks_84;
+		das_copy((__mks_84.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_84_8_4`function XS<::_lambda_thismodule_84_8_4> Ci*/ 14858810262760268588u))));
+		das_copy((__mks_84.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_84_8_4`finalizer X1<S<::_lambda_thismodule_84_8_4>>?*/ 16121846440888050288u))));
+		return __mks_84;
+	})())));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_f8583d09d2384fc5
+	aotLib[0x28a609e5e77c0155] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_78_8_1 &  ),&finalize_f8583d09d2384fc5>>();
+	};
+	// finalize_4559dafab4214607
+	aotLib[0x6cfbe0df377ac8f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_80_8_2 &  ),&finalize_4559dafab4214607>>();
+	};
+	// finalize_1ed22215a2d9efe8
+	aotLib[0x1beb03c85f196f99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_82_8_3 &  ),&finalize_1ed22215a2d9efe8>>();
+	};
+	// finalize_ff4d98c30878d45d
+	aotLib[0xd119836f9280a149] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_84_8_4 &  ),&finalize_ff4d98c30878d45d>>();
+	};
+	// _Func_0x60_checkInvoke_f6acb50e76d02cea
+	aotLib[0x2632fcd21462f496] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Lambda DAS_COMMENT((Foo)) const   ),&_Func_0x60_checkInvoke_f6acb50e76d02cea>>();
+	};
+	// _Func_0x60_checkInvoke_fbe025ecd36e091f
+	aotLib[0x4f00a1e70bcc6836] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Lambda DAS_COMMENT((Foo const )) const   ),&_Func_0x60_checkInvoke_fbe025ecd36e091f>>();
+	};
+	// _Func_0x60_checkInvoke_8b17825f9e1d8a3a
+	aotLib[0x1359c794a9dbafb6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Lambda DAS_COMMENT((Foo,int32_t)) const   ),&_Func_0x60_checkInvoke_8b17825f9e1d8a3a>>();
+	};
+	// _Func_0x60_checkInvoke_a376f88edd75c28b
+	aotLib[0x1cf4a3571c53af8e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Lambda DAS_COMMENT((Foo const ,int32_t)) const   ),&_Func_0x60_checkInvoke_a376f88edd75c28b>>();
+	};
+	// _Func_0x60_checkInvoke_2512a7eb20637486
+	aotLib[0xa72060d4d67684ae] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Func DAS_COMMENT((Foo)) const   ),&_Func_0x60_checkInvoke_2512a7eb20637486>>();
+	};
+	// _Func_0x60_checkInvoke_4581c8bd7f19c7a
+	aotLib[0x767bc8ddb8261c0e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Func DAS_COMMENT((Foo,int32_t)) const   ),&_Func_0x60_checkInvoke_4581c8bd7f19c7a>>();
+	};
+	// _Func_0x60_checkInvoke_21006ea006fac2fb
+	aotLib[0xbd99edf8272551be] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Func DAS_COMMENT((Foo const )) const   ),&_Func_0x60_checkInvoke_21006ea006fac2fb>>();
+	};
+	// _Func_0x60_checkInvoke_a9aa914cdb996ee3
+	aotLib[0xfebc56f98cdab00e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Func DAS_COMMENT((Foo const ,int32_t)) const   ),&_Func_0x60_checkInvoke_a9aa914cdb996ee3>>();
+	};
+	// _Func_0x60_checkInvoke_45fdeafee28b3fc3
+	aotLib[0x595580c9cdbc804a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((Foo)) const  &  ),&_Func_0x60_checkInvoke_45fdeafee28b3fc3>>();
+	};
+	// _Func_0x60_checkInvoke_d26305b7ba2b474a
+	aotLib[0xfba6c56c5e3222d2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Block DAS_COMMENT((Foo const )) const  &  ),&_Func_0x60_checkInvoke_d26305b7ba2b474a>>();
+	};
+	// _Func_0x60_checkInvoke_8537f1a4eca1f943
+	aotLib[0x6a68b8cbfe6cdc12] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Block DAS_COMMENT((Foo,int32_t)) const  &  ),&_Func_0x60_checkInvoke_8537f1a4eca1f943>>();
+	};
+	// _Func_0x60_checkInvoke_f84b9263af85f04e
+	aotLib[0xa879b40fcb17380e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t , Block DAS_COMMENT((Foo const ,int32_t)) const  &  ),&_Func_0x60_checkInvoke_f84b9263af85f04e>>();
+	};
+	// _Func_lambda_thismodule_78_8_1_0x60_function_d499dd3966d78408
+	aotLib[0xc8a916e09c9f3d51] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__, _lambda_thismodule_78_8_1 &  ),&_Func_lambda_thismodule_78_8_1_0x60_function_d499dd3966d78408>>();
+	};
+	// _Func_lambda_thismodule_78_8_1_0x60_finalizer_30d07f40de87ba0a
+	aotLib[0x2b5db4b4a21bafdd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_78_8_1 *  ),&_Func_lambda_thismodule_78_8_1_0x60_finalizer_30d07f40de87ba0a>>();
+	};
+	// _Func_lambda_thismodule_80_8_2_0x60_function_94d681e4e44cb9f9
+	aotLib[0xa282ab4ebea4511d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo const  (*) ( Context * __context__, _lambda_thismodule_80_8_2 &  ),&_Func_lambda_thismodule_80_8_2_0x60_function_94d681e4e44cb9f9>>();
+	};
+	// _Func_lambda_thismodule_80_8_2_0x60_finalizer_2471aee2d2bd95a
+	aotLib[0x20440243cb148e63] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_80_8_2 *  ),&_Func_lambda_thismodule_80_8_2_0x60_finalizer_2471aee2d2bd95a>>();
+	};
+	// _Func_lambda_thismodule_82_8_3_0x60_function_26a3b921841e5b8
+	aotLib[0xc1997f4cea70fa75] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__, _lambda_thismodule_82_8_3 & , int32_t  ),&_Func_lambda_thismodule_82_8_3_0x60_function_26a3b921841e5b8>>();
+	};
+	// _Func_lambda_thismodule_82_8_3_0x60_finalizer_5decda060d043a96
+	aotLib[0x8485e6cc5a2ccd40] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_82_8_3 *  ),&_Func_lambda_thismodule_82_8_3_0x60_finalizer_5decda060d043a96>>();
+	};
+	// _Func_lambda_thismodule_84_8_4_0x60_function_7aadc960c0193382
+	aotLib[0xb5c97075459328f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo const  (*) ( Context * __context__, _lambda_thismodule_84_8_4 & , int32_t  ),&_Func_lambda_thismodule_84_8_4_0x60_function_7aadc960c0193382>>();
+	};
+	// _Func_lambda_thismodule_84_8_4_0x60_finalizer_7513e69faa3ed99e
+	aotLib[0xe3e9318056aac73] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_84_8_4 *  ),&_Func_lambda_thismodule_84_8_4_0x60_finalizer_7513e69faa3ed99e>>();
+	};
+	// func_7e7e557ba6b27168
+	aotLib[0x95c79943aa44459d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&func_7e7e557ba6b27168>>();
+	};
+	// funcC_30e1dda0012bd03b
+	aotLib[0x62e7e84739e23b25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo const  (*) ( Context * __context__ ),&funcC_30e1dda0012bd03b>>();
+	};
+	// funcA_e054e073f79ca411
+	aotLib[0xebec7eb7a12c8809] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__, int32_t  ),&funcA_e054e073f79ca411>>();
+	};
+	// funcAC_62759c7e77f0e4e0
+	aotLib[0x194418d4e7214f55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo const  (*) ( Context * __context__, int32_t  ),&funcAC_62759c7e77f0e4e0>>();
+	};
+	// hfunc_7e7e557ba6b27168
+	aotLib[0x95c79943aa44459d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&hfunc_7e7e557ba6b27168>>();
+	};
+	// hfuncC_30e1dda0012bd03b
+	aotLib[0x62e7e84739e23b25] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo const  (*) ( Context * __context__ ),&hfuncC_30e1dda0012bd03b>>();
+	};
+	// hfuncA_e054e073f79ca411
+	aotLib[0xebec7eb7a12c8809] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__, int32_t  ),&hfuncA_e054e073f79ca411>>();
+	};
+	// hfuncAC_62759c7e77f0e4e0
+	aotLib[0x194418d4e7214f55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo const  (*) ( Context * __context__, int32_t  ),&hfuncAC_62759c7e77f0e4e0>>();
+	};
+	// check_20af5b2d7236b527
+	aotLib[0xda3418b4a16dc15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Foo const  &  ),&check_20af5b2d7236b527>>();
+	};
+	// test_c3c0b74dc9399ffe
+	aotLib[0x3c698ebd365c4659] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_c3c0b74dc9399ffe>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
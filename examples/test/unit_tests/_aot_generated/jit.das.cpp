@@ -0,0 +1,266 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14711897760739908563 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline int32_t fib_aa4c2d62f42b665a ( Context * __context__, int32_t __n_rename_at_5 );
+inline int32_t sum_range_1e86edc8386976f9 ( Context * __context__, int32_t __n_rename_at_10 );
+inline int32_t count_down_24616503c03c82c8 ( Context * __context__, int64_t __n_rename_at_20 );
+inline uint32_t compare_555e9ce86092e4b6 ( Context * __context__, double __a_rename_at_30, double __b_rename_at_30 );
+inline int32_t divide_855e5fcd1ca0b8b5 ( Context * __context__, int32_t __a_rename_at_44, int32_t __b_rename_at_44 );
+inline char * first_word_927ae8fc36393c30 ( Context * __context__, char * const  __s_rename_at_47 );
+inline int32_t bump_610bc68148e2f08e ( Context * __context__, uint32_t __n_rename_at_57 );
+inline bool test_b46484a474afc1c1 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0xb15812401eb66400>(__context__) = 0;/*counter*/
+	das_global<int32_t,0x29b001b28c710ea8>(__context__) = 2;/*input*/
+	das_global<char *,0x6f4a5f519ff2c873>(__context__) = ((char *) "hello world");/*greeting*/
+}
+
+inline int32_t fib_aa4c2d62f42b665a ( Context * __context__, int32_t __n_rename_at_5 )
+{
+	return das_auto_cast<int32_t>::cast((__n_rename_at_5 < 2) ? das_auto_cast<int32_t>::cast(__n_rename_at_5) : das_auto_cast<int32_t>::cast((fib_aa4c2d62f42b665a(__context__,__n_rename_at_5 - 1) + fib_aa4c2d62f42b665a(__context__,__n_rename_at_5 - 2))));
+}
+
+inline int32_t sum_range_1e86edc8386976f9 ( Context * __context__, int32_t __n_rename_at_10 )
+{
+	int32_t __t_rename_at_11 = 0;
+	{
+		bool __need_loop_12 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(__n_rename_at_10));
+		int32_t __i_rename_at_12;
+		__need_loop_12 = __i_iterator.first(__context__,(__i_rename_at_12)) && __need_loop_12;
+		for ( ; __need_loop_12 ; __need_loop_12 = __i_iterator.next(__context__,(__i_rename_at_12)) )
+		{
+			if ( (SimPolicy<int32_t>::Mod(__i_rename_at_12,3,*__context__,nullptr)) == 0 )
+			{
+				continue;
+			} else {
+				if ( __i_rename_at_12 > 1000 )
+				{
+					break;
+				} else {
+					__t_rename_at_11 += __i_rename_at_12;
+				};
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_12));
+	};
+	return das_auto_cast<int32_t>::cast(__t_rename_at_11);
+}
+
+inline int32_t count_down_24616503c03c82c8 ( Context * __context__, int64_t __n_rename_at_20 )
+{
+	int32_t __steps_rename_at_21 = 0;
+	while ( __n_rename_at_20 > INT64_C(1) )
+	{
+		das_copy(__n_rename_at_20,((SimPolicy<int64_t>::Mod(__n_rename_at_20,INT64_C(2),*__context__,nullptr)) == INT64_C(0)) ? das_auto_cast<int64_t>::cast((SimPolicy<int64_t>::Div(__n_rename_at_20,INT64_C(2),*__context__,nullptr))) : das_auto_cast<int64_t>::cast(((__n_rename_at_20 * INT64_C(3)) + INT64_C(1))));
+		++__steps_rename_at_21;
+	};
+	return das_auto_cast<int32_t>::cast(__steps_rename_at_21);
+}
+
+inline uint32_t compare_555e9ce86092e4b6 ( Context * __context__, double __a_rename_at_30, double __b_rename_at_30 )
+{
+	uint32_t __bits_rename_at_31 = 0x0u;
+	if ( __a_rename_at_30 < __b_rename_at_30 )
+	{
+		__bits_rename_at_31 |= 0x1u;
+	};
+	if ( __a_rename_at_30 <= __b_rename_at_30 )
+	{
+		__bits_rename_at_31 |= 0x2u;
+	};
+	if ( __a_rename_at_30 == __b_rename_at_30 )
+	{
+		__bits_rename_at_31 |= 0x4u;
+	};
+	if ( __a_rename_at_30 != __b_rename_at_30 )
+	{
+		__bits_rename_at_31 |= 0x8u;
+	};
+	if ( !((__a_rename_at_30 > __b_rename_at_30)) && !((__a_rename_at_30 >= __b_rename_at_30)) )
+	{
+		__bits_rename_at_31 |= 0x10u;
+	};
+	return das_auto_cast<uint32_t>::cast(__bits_rename_at_31);
+}
+
+inline int32_t divide_855e5fcd1ca0b8b5 ( Context * __context__, int32_t __a_rename_at_44, int32_t __b_rename_at_44 )
+{
+	return das_auto_cast<int32_t>::cast(SimPolicy<int32_t>::Div(__a_rename_at_44,__b_rename_at_44,*__context__,nullptr));
+}
+
+inline char * first_word_927ae8fc36393c30 ( Context * __context__, char * const  __s_rename_at_47 )
+{
+	{
+		bool __need_loop_48 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(mk_range(builtin_string_length(__s_rename_at_47,__context__)));
+		int32_t __i_rename_at_48;
+		__need_loop_48 = __i_iterator.first(__context__,(__i_rename_at_48)) && __need_loop_48;
+		for ( ; __need_loop_48 ; __need_loop_48 = __i_iterator.next(__context__,(__i_rename_at_48)) )
+		{
+			if ( get_character_at(__s_rename_at_47,__i_rename_at_48,__context__) == 32 )
+			{
+				return das_auto_cast<char *>::cast(((char *)(builtin_string_slice1(__s_rename_at_47,0,__i_rename_at_48,__context__))));
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_48));
+	};
+	return das_auto_cast<char *>::cast(__s_rename_at_47);
+}
+
+inline int32_t bump_610bc68148e2f08e ( Context * __context__, uint32_t __n_rename_at_57 )
+{
+	{
+		bool __need_loop_58 = true;
+		// i : uint const
+		das_iterator<urange> __i_iterator(mk_urange(__n_rename_at_57));
+		uint32_t __i_rename_at_58;
+		__need_loop_58 = __i_iterator.first(__context__,(__i_rename_at_58)) && __need_loop_58;
+		for ( ; __need_loop_58 ; __need_loop_58 = __i_iterator.next(__context__,(__i_rename_at_58)) )
+		{
+			das_global<int32_t,0xb15812401eb66400>(__context__) /*counter*/ += int32_t(__i_rename_at_58 & 0x1u);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_58));
+	};
+	return das_auto_cast<int32_t>::cast(das_global<int32_t,0xb15812401eb66400>(__context__) /*counter*/);
+}
+
+inline bool test_b46484a474afc1c1 ( Context * __context__ )
+{
+	int32_t __two_rename_at_64 = ((int32_t)das_global<int32_t,0x29b001b28c710ea8>(__context__) /*input*/);
+	DAS_ASSERT((fib_aa4c2d62f42b665a(__context__,__two_rename_at_64 * 10) == 6765));
+	DAS_ASSERT((sum_range_1e86edc8386976f9(__context__,__two_rename_at_64 * 5) == 27));
+	DAS_ASSERT((sum_range_1e86edc8386976f9(__context__,__two_rename_at_64 * 2500) == 333667));
+	DAS_VERIFY((count_down_24616503c03c82c8(__context__,(int64_t(__two_rename_at_64) * INT64_C(13)) + INT64_C(1)) == 111));
+	float __half_rename_at_69 = ((float)(float(__two_rename_at_64) * 0.125f));
+	DAS_ASSERT(((1.f + (2.f * __half_rename_at_69)) == 1.5f));
+	double __one_rename_at_71 = ((double)(double(__two_rename_at_64) * 0.5));
+	DAS_ASSERT((compare_555e9ce86092e4b6(__context__,__one_rename_at_71,2.) == 0x1bu));
+	DAS_ASSERT((compare_555e9ce86092e4b6(__context__,__one_rename_at_71 * 2.,2.) == 0x6u));
+	double __nan_rename_at_74 = ((double)(SimPolicy<double>::Div((__one_rename_at_71 - 1.),(__one_rename_at_71 - 1.),*__context__,nullptr)));
+	DAS_ASSERT((compare_555e9ce86092e4b6(__context__,__nan_rename_at_74,__one_rename_at_71) == 0x18u));
+	DAS_ASSERT(((SimPolicy<int32_t>::Div(-7,__two_rename_at_64,*__context__,nullptr)) == -3));
+	bool __failed_rename_at_77 = false;
+	das_try_recover(__context__, [&]()
+	{
+		das_copy(das_global<int32_t,0xb15812401eb66400>(__context__) /*counter*/,divide_855e5fcd1ca0b8b5(__context__,1,__two_rename_at_64 - 2));
+	}, [&]()
+	{
+		das_copy(__failed_rename_at_77,true);
+	});
+	DAS_ASSERT((__failed_rename_at_77));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(first_word_927ae8fc36393c30(__context__,das_global<char *,0x6f4a5f519ff2c873>(__context__) /*greeting*/)),cast<char *>::from(((char *) "hello")),*__context__,nullptr)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(first_word_927ae8fc36393c30(__context__,((char *)(builtin_string_slice2(das_global<char *,0x6f4a5f519ff2c873>(__context__) /*greeting*/,__two_rename_at_64 * 3,__context__))))),cast<char *>::from(((char *) "world")),*__context__,nullptr)));
+	DAS_VERIFY((bump_610bc68148e2f08e(__context__,uint32_t(__two_rename_at_64) * 0x5u) == 5));
+	DAS_VERIFY((bump_610bc68148e2f08e(__context__,uint32_t(__two_rename_at_64) * 0x5u) == 10));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// fib_aa4c2d62f42b665a
+	aotLib[0x1cb8e42c84c66a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&fib_aa4c2d62f42b665a>>();
+	};
+	// sum_range_1e86edc8386976f9
+	aotLib[0xc6462abcd5244461] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&sum_range_1e86edc8386976f9>>();
+	};
+	// count_down_24616503c03c82c8
+	aotLib[0x98946d4a40b31bb9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int64_t  ),&count_down_24616503c03c82c8>>();
+	};
+	// compare_555e9ce86092e4b6
+	aotLib[0x65f3631be6a8ae09] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<uint32_t (*) ( Context * __context__, double , double  ),&compare_555e9ce86092e4b6>>();
+	};
+	// divide_855e5fcd1ca0b8b5
+	aotLib[0xeb40acf61fb54cad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t , int32_t  ),&divide_855e5fcd1ca0b8b5>>();
+	};
+	// first_word_927ae8fc36393c30
+	aotLib[0xde346f8237ac50fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__, char * const   ),&first_word_927ae8fc36393c30>>();
+	};
+	// bump_610bc68148e2f08e
+	aotLib[0xd2ba39dcc020d61] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, uint32_t  ),&bump_610bc68148e2f08e>>();
+	};
+	// test_b46484a474afc1c1
+	aotLib[0xdd09185111fff12a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_b46484a474afc1c1>>();
+	};
+	// [[ init script ]]
+	aotLib[0x45c9a701a8ce9d56] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,394 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12103613998293278935 {
+
+extern StructInfo __struct_info__2b2b47dc214d433c;
+extern StructInfo __struct_info__d818b7737815cc14;
+extern StructInfo __struct_info__f8310e04e98d7b70;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__45bb7fabc8ebee89;
+extern TypeInfo __type_info__fd978c5c1218516b;
+extern TypeInfo __type_info__8c48207b56753d8;
+extern TypeInfo __type_info__810f4ecfa430936f;
+extern TypeInfo __type_info__e44c54f54ecfa949;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__a0ce90235c80549f;
+extern TypeInfo __type_info__2e56fa71f715189f;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern TypeInfo __type_info__69131663c1c8a63d;
+extern TypeInfo __type_info__9aecd6e08459ab96;
+extern VarInfo __var_info__6b7a6acceae66960;
+extern VarInfo __var_info__8bf04e77b9de08ad;
+extern VarInfo __var_info__d773961ec2c85533;
+extern VarInfo __var_info__6d20525acbff17ad;
+extern VarInfo __var_info__866f4b2e3bdae3f1;
+extern VarInfo __var_info__658021c5b0362f4b;
+extern VarInfo __var_info__8adaeae2c18b6b14;
+extern VarInfo __var_info__39184260b941ae8f;
+extern FuncInfo __func_info__d3b307c446b1e15e;
+
+TypeInfo * __type_info__6d20525acbff17ad_arg_types_var_3110658978406548284[2] = { &__type_info__45bb7fabc8ebee89, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__2b2b47dc214d433c_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, (TypeInfo **)__type_info__6d20525acbff17ad_arg_types_var_3110658978406548284, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x6d20525acbff17ad), "__lambda", 0 };
+TypeInfo * __type_info__8adaeae2c18b6b14_arg_types_var_3110658978406548284[1] = { &__type_info__810f4ecfa430936f };
+VarInfo __struct_info__2b2b47dc214d433c_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__8adaeae2c18b6b14_arg_types_var_3110658978406548284, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x8adaeae2c18b6b14), "__finalize", 8 };
+VarInfo __struct_info__2b2b47dc214d433c_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x658021c5b0362f4b), "CNT", 16 };
+VarInfo * __struct_info__2b2b47dc214d433c_fields[3] =  { &__struct_info__2b2b47dc214d433c_field_0, &__struct_info__2b2b47dc214d433c_field_1, &__struct_info__2b2b47dc214d433c_field_2 };
+StructInfo __struct_info__2b2b47dc214d433c = {"_lambda_thismodule_32_8_2", "", 6, __struct_info__2b2b47dc214d433c_fields, 3, 24, UINT64_C(0x0), nullptr, UINT64_C(0x2b2b47dc214d433c) };
+TypeInfo * __type_info__d773961ec2c85533_arg_types_var_15571397418197306388[1] = { &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__d818b7737815cc14_field_0 =  { Type::tLambda, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, (TypeInfo **)__type_info__d773961ec2c85533_arg_types_var_15571397418197306388, nullptr, 1, 0, nullptr, 24576, 8, UINT64_C(0xd773961ec2c85533), "cnt", 0 };
+VarInfo * __struct_info__d818b7737815cc14_fields[1] =  { &__struct_info__d818b7737815cc14_field_0 };
+StructInfo __struct_info__d818b7737815cc14 = {"Message", "", 12, __struct_info__d818b7737815cc14_fields, 1, 8, UINT64_C(0x0), nullptr, UINT64_C(0xd818b7737815cc14) };
+TypeInfo * __type_info__866f4b2e3bdae3f1_arg_types_var_17884091009525971824[2] = { &__type_info__69131663c1c8a63d, &__type_info__90f5707b5a6f641 };
+VarInfo __struct_info__f8310e04e98d7b70_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, (TypeInfo **)__type_info__866f4b2e3bdae3f1_arg_types_var_17884091009525971824, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0x866f4b2e3bdae3f1), "__lambda", 0 };
+TypeInfo * __type_info__6b7a6acceae66960_arg_types_var_17884091009525971824[1] = { &__type_info__2e56fa71f715189f };
+VarInfo __struct_info__f8310e04e98d7b70_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__6b7a6acceae66960_arg_types_var_17884091009525971824, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x6b7a6acceae66960), "__finalize", 8 };
+VarInfo __struct_info__f8310e04e98d7b70_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x39184260b941ae8f), "a", 16 };
+VarInfo * __struct_info__f8310e04e98d7b70_fields[3] =  { &__struct_info__f8310e04e98d7b70_field_0, &__struct_info__f8310e04e98d7b70_field_1, &__struct_info__f8310e04e98d7b70_field_2 };
+StructInfo __struct_info__f8310e04e98d7b70 = {"_lambda_thismodule_26_8_1", "", 6, __struct_info__f8310e04e98d7b70_fields, 3, 24, UINT64_C(0x0), nullptr, UINT64_C(0xf8310e04e98d7b70) };
+VarInfo __func_info__d3b307c446b1e15e_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 40994, 24, UINT64_C(0x8bf04e77b9de08ad), "data", 0 };
+VarInfo * __func_info__d3b307c446b1e15e_fields[1] =  { &__func_info__d3b307c446b1e15e_field_0 };
+FuncInfo __func_info__d3b307c446b1e15e = {"invoke block<(data:array<uint8> const):void> const", "", __func_info__d3b307c446b1e15e_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xd3b307c446b1e15e), 0x0 };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__45bb7fabc8ebee89 = { Type::tStructure, &__struct_info__2b2b47dc214d433c, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 24, UINT64_C(0x45bb7fabc8ebee89) };
+TypeInfo * __type_info__fd978c5c1218516b_arg_types[1] = { &__type_info__a0ce90235c80549f };
+TypeInfo __type_info__fd978c5c1218516b = { Type::tBlock, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__fd978c5c1218516b_arg_types, nullptr, 1, 0, nullptr, 34, 48, UINT64_C(0xfd978c5c1218516b) };
+TypeInfo __type_info__8c48207b56753d8 = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x8c48207b56753d8) };
+TypeInfo __type_info__810f4ecfa430936f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__45bb7fabc8ebee89, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x810f4ecfa430936f) };
+TypeInfo __type_info__e44c54f54ecfa949 = { Type::tStructure, &__struct_info__d818b7737815cc14, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24578, 8, UINT64_C(0xe44c54f54ecfa949) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__a0ce90235c80549f = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 40994, 24, UINT64_C(0xa0ce90235c80549f) };
+TypeInfo __type_info__2e56fa71f715189f = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__69131663c1c8a63d, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x2e56fa71f715189f) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+TypeInfo __type_info__69131663c1c8a63d = { Type::tStructure, &__struct_info__f8310e04e98d7b70, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8222, 24, UINT64_C(0x69131663c1c8a63d) };
+TypeInfo __type_info__9aecd6e08459ab96 = { Type::tStructure, &__struct_info__d818b7737815cc14, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 24610, 8, UINT64_C(0x9aecd6e08459ab96) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__9aecd6e08459ab96, &__type_info__fd978c5c1218516b };
+TypeInfo * __tinfo_1[2] = { &__type_info__e44c54f54ecfa949, &__type_info__a0ce90235c80549f };
+namespace  { struct Message; };
+namespace  { struct _lambda_thismodule_26_8_1; };
+namespace  { struct _lambda_thismodule_32_8_2; };
+namespace  {
+
+struct Message {
+	Lambda DAS_COMMENT((int32_t,int32_t)) cnt;
+};
+static_assert(sizeof(Message)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Message,cnt)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_26_8_1 {
+	Func DAS_COMMENT((int32_t,_lambda_thismodule_26_8_1,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_26_8_1 *)) __finalize;
+	int32_t a;
+};
+static_assert(sizeof(_lambda_thismodule_26_8_1)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_26_8_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_26_8_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_26_8_1,a)==16,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_32_8_2 {
+	Func DAS_COMMENT((int32_t,_lambda_thismodule_32_8_2,int32_t)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_32_8_2 *)) __finalize;
+	int32_t CNT;
+};
+static_assert(sizeof(_lambda_thismodule_32_8_2)==24,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_8_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_8_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_32_8_2,CNT)==16,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_resize_8b9bf29a687b3e9d ( Context * __context__, TArray<uint8_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_clone_67b037a581fb735d ( Context * __context__, TArray<uint8_t> & __a_rename_at_331, TArray<uint8_t> const  & __b_rename_at_331 );
+inline void finalize_eb32dbbcfacb758c ( Context * __context__, _lambda_thismodule_26_8_1 & ____this_rename_at_26 );
+inline void finalize_978f70739e077c5c ( Context * __context__, _lambda_thismodule_32_8_2 & ____this_rename_at_32 );
+inline void _Funcbuiltin_0x60_binary_save_a5df83e9dc7c73b3 ( Context * __context__, Message const  & __obj_rename_at_309, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  & __subexpr_rename_at_309 );
+inline void _Funcbuiltin_0x60_binary_load_518db28af2c7362a ( Context * __context__, Message & __obj_rename_at_313, TArray<uint8_t> const  & __data_rename_at_313 );
+inline int32_t _Func_lambda_thismodule_26_8_1_0x60_function_494491d4d5bf65e3 ( Context * __context__, _lambda_thismodule_26_8_1 & ____this_rename_at_26, int32_t __b_rename_at_25 );
+inline void _Func_lambda_thismodule_26_8_1_0x60_finalizer_9c5998f770b93b62 ( Context * __context__, _lambda_thismodule_26_8_1 * ____this_rename_at_26 );
+inline int32_t _Func_lambda_thismodule_32_8_2_0x60_function_57f732cbcbc81ea5 ( Context * __context__, _lambda_thismodule_32_8_2 & ____this_rename_at_32, int32_t __extra_rename_at_31 );
+inline void _Func_lambda_thismodule_32_8_2_0x60_finalizer_97054b620e078c7a ( Context * __context__, _lambda_thismodule_32_8_2 * ____this_rename_at_32 );
+inline void send_bbeef9b7f724fec9 ( Context * __context__, Lambda DAS_COMMENT((int32_t,int32_t)) __t_rename_at_9 );
+inline Lambda DAS_COMMENT((int32_t,int32_t)) recv_d5a75202a1f3c17f ( Context * __context__ );
+inline void onlyNull_5a44edcbabed5240 ( Context * __context__, Lambda DAS_COMMENT((int32_t,int32_t)) const  __bar_rename_at_20 );
+inline Lambda DAS_COMMENT((int32_t,int32_t)) addX_71b0aba558695c43 ( Context * __context__, int32_t __a_rename_at_24 );
+inline bool test_89f5860fe601ad0 ( Context * __context__ );
+inline void main_13f21b0ea414e87b ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<TArray<uint8_t>,0x54cb5db96d916eae>(__context__);/*network*/
+}
+
+inline void _Funcbuiltin_0x60_resize_8b9bf29a687b3e9d ( Context * __context__, TArray<uint8_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<uint8_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,1,__context__);
+}
+
+inline void _Funcbuiltin_0x60_clone_67b037a581fb735d ( Context * __context__, TArray<uint8_t> &  __a_rename_at_331, TArray<uint8_t> const  &  __b_rename_at_331 )
+{
+	_Funcbuiltin_0x60_resize_8b9bf29a687b3e9d(__context__,das_arg<TArray<uint8_t>>::pass(__a_rename_at_331),builtin_array_size(__b_rename_at_331));
+	{
+		bool __need_loop_333 = true;
+		// aV : uint8 aka TT&
+		das_iterator<TArray<uint8_t>> __aV_iterator(__a_rename_at_331);
+		uint8_t * __aV_rename_at_333;
+		__need_loop_333 = __aV_iterator.first(__context__,(__aV_rename_at_333)) && __need_loop_333;
+		// bV : uint8 const&
+		das_iterator<TArray<uint8_t> const > __bV_iterator(__b_rename_at_331);
+		uint8_t const  * __bV_rename_at_333;
+		__need_loop_333 = __bV_iterator.first(__context__,(__bV_rename_at_333)) && __need_loop_333;
+		for ( ; __need_loop_333 ; __need_loop_333 = __aV_iterator.next(__context__,(__aV_rename_at_333)) && __bV_iterator.next(__context__,(__bV_rename_at_333)) )
+		{
+			das_copy((*__aV_rename_at_333),(*__bV_rename_at_333));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_333));
+		__bV_iterator.close(__context__,(__bV_rename_at_333));
+	};
+}
+
+inline void finalize_eb32dbbcfacb758c ( Context * __context__, _lambda_thismodule_26_8_1 &  ____this_rename_at_26 )
+{
+	memset(&(____this_rename_at_26), 0, 24);
+}
+
+inline void finalize_978f70739e077c5c ( Context * __context__, _lambda_thismodule_32_8_2 &  ____this_rename_at_32 )
+{
+	memset(&(____this_rename_at_32), 0, 24);
+}
+
+inline void _Funcbuiltin_0x60_binary_save_a5df83e9dc7c73b3 ( Context * __context__, Message const  &  __obj_rename_at_309, Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  __subexpr_rename_at_309 )
+{
+	das_call_interop<void>::call(&_builtin_binary_save,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<Message const  &>::from(__obj_rename_at_309),cast<Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &>::from(__subexpr_rename_at_309)));
+}
+
+inline void _Funcbuiltin_0x60_binary_load_518db28af2c7362a ( Context * __context__, Message &  __obj_rename_at_313, TArray<uint8_t> const  &  __data_rename_at_313 )
+{
+	das_call_interop<void>::call(&_builtin_binary_load,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<Message &>::from(__obj_rename_at_313),cast<TArray<uint8_t> const  &>::from(__data_rename_at_313)));
+}
+
+inline int32_t _Func_lambda_thismodule_26_8_1_0x60_function_494491d4d5bf65e3 ( Context * __context__, _lambda_thismodule_26_8_1 &  ____this_rename_at_26, int32_t __b_rename_at_25 )
+{
+	return das_auto_cast<int32_t>::cast(____this_rename_at_26.a + __b_rename_at_25);
+}
+
+inline void _Func_lambda_thismodule_26_8_1_0x60_finalizer_9c5998f770b93b62 ( Context * __context__, _lambda_thismodule_26_8_1 * ____this_rename_at_26 )
+{
+	finalize_eb32dbbcfacb758c(__context__,das_arg<_lambda_thismodule_26_8_1>::pass(das_deref(__context__,____this_rename_at_26)));
+	das_delete_lambda_struct<_lambda_thismodule_26_8_1 *>::clear(__context__,____this_rename_at_26);
+}
+
+inline int32_t _Func_lambda_thismodule_32_8_2_0x60_function_57f732cbcbc81ea5 ( Context * __context__, _lambda_thismodule_32_8_2 &  ____this_rename_at_32, int32_t __extra_rename_at_31 )
+{
+	return das_auto_cast<int32_t>::cast((____this_rename_at_32.CNT++) + __extra_rename_at_31);
+}
+
+inline void _Func_lambda_thismodule_32_8_2_0x60_finalizer_97054b620e078c7a ( Context * __context__, _lambda_thismodule_32_8_2 * ____this_rename_at_32 )
+{
+	finalize_978f70739e077c5c(__context__,das_arg<_lambda_thismodule_32_8_2>::pass(das_deref(__context__,____this_rename_at_32)));
+	das_delete_lambda_struct<_lambda_thismodule_32_8_2 *>::clear(__context__,____this_rename_at_32);
+}
+
+inline void send_bbeef9b7f724fec9 ( Context * __context__, Lambda DAS_COMMENT((int32_t,int32_t)) __t_rename_at_9 ) { das_stack_prologue __prologue(__context__,112,"send " DAS_FILE_LINE);
+{
+	Message __msg_rename_at_10; das_zero(__msg_rename_at_10); das_move(__msg_rename_at_10, (([&]() -> Message {
+		Message __mks_10;
+		das_move((__mks_10.cnt),(__t_rename_at_9));
+		return __mks_10;
+	})()));
+	_Funcbuiltin_0x60_binary_save_a5df83e9dc7c73b3(__context__,das_arg<Message>::pass(__msg_rename_at_10),das_make_block<void,TArray<uint8_t> const  &>(__context__,96,0,&__func_info__d3b307c446b1e15e,[&](TArray<uint8_t> const  & __data_rename_at_11) -> void{
+		_Funcbuiltin_0x60_clone_67b037a581fb735d(__context__,das_arg<TArray<uint8_t>>::pass(das_global<TArray<uint8_t>,0x54cb5db96d916eae>(__context__) /*network*/),__data_rename_at_11);
+	}));
+}}
+
+inline Lambda DAS_COMMENT((int32_t,int32_t)) recv_d5a75202a1f3c17f ( Context * __context__ )
+{
+	Message __t_rename_at_15; das_zero(__t_rename_at_15);
+	_Funcbuiltin_0x60_binary_load_518db28af2c7362a(__context__,das_arg<Message>::pass(__t_rename_at_15),das_arg<TArray<uint8_t>>::pass(das_global<TArray<uint8_t>,0x54cb5db96d916eae>(__context__) /*network*/));
+	return /* <- */ das_auto_cast_move<Lambda DAS_COMMENT((int32_t,int32_t))>::cast(__t_rename_at_15.cnt);
+}
+
+inline void onlyNull_5a44edcbabed5240 ( Context * __context__, Lambda DAS_COMMENT((int32_t,int32_t)) const  __bar_rename_at_20 )
+{
+	if ( __bar_rename_at_20 != nullptr )
+	{
+		DAS_ASSERTF((false),(((char *) "has to be null")));
+	};
+}
+
+inline Lambda DAS_COMMENT((int32_t,int32_t)) addX_71b0aba558695c43 ( Context * __context__, int32_t __a_rename_at_24 )
+{
+	return das_auto_cast<Lambda DAS_COMMENT((int32_t,int32_t))>::cast(das_ascend<int32_t,_lambda_thismodule_26_8_1>::make(__context__,&__type_info__69131663c1c8a63d,(([&]() -> _lambda_thismodule_26_8_1 {
+		_lambda_thismodule_26_8_1 __mks_26;
+		das_copy((__mks_26.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_26_8_1`function XS<::_lambda_thismodule_26_8_1> Ci*/ 15774974645030674928u))));
+		das_copy((__mks_26.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_26_8_1`finalizer X1<S<::_lambda_thismodule_26_8_1>>?*/ 15188195692632750698u))));
+		das_copy((__mks_26.a),(__a_rename_at_24));
+		return __mks_26;
+	})())));
+}
+
+inline bool test_89f5860fe601ad0 ( Context * __context__ )
+{
+	int32_t __CNT_rename_at_30 = 0;
+	Lambda DAS_COMMENT((int32_t,int32_t)) __counter_rename_at_31; das_zero(__counter_rename_at_31); das_move(__counter_rename_at_31, ((Lambda DAS_COMMENT((int32_t,int32_t)))das_ascend<int32_t,_lambda_thismodule_32_8_2>::make(__context__,&__type_info__45bb7fabc8ebee89,(([&]() -> _lambda_thismodule_32_8_2 {
+		_lambda_thismodule_32_8_2 __mks_32;
+		das_copy((__mks_32.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_32_8_2`function XS<::_lambda_thismodule_32_8_2> Ci*/ 12191315004383452788u))));
+		das_copy((__mks_32.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_32_8_2`finalizer X1<S<::_lambda_thismodule_32_8_2>>?*/ 4731437915942256658u))));
+		das_copy((__mks_32.CNT),(__CNT_rename_at_30));
+		return __mks_32;
+	})()))));
+	int32_t __x_rename_at_33 = das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,nullptr,__counter_rename_at_31,13);
+	das_copy(__CNT_rename_at_30,100500);
+	int32_t __y_rename_at_35 = ((int32_t)das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,nullptr,__counter_rename_at_31,13));
+	DAS_ASSERT(((__x_rename_at_33 == 13) && (__y_rename_at_35 == 14)));
+	send_bbeef9b7f724fec9(__context__,__counter_rename_at_31);
+	Lambda DAS_COMMENT((int32_t,int32_t)) __net_counter_rename_at_38; das_zero(__net_counter_rename_at_38); das_move(__net_counter_rename_at_38, ((Lambda DAS_COMMENT((int32_t,int32_t)))recv_d5a75202a1f3c17f(__context__)));
+	int32_t __z_rename_at_39 = ((int32_t)das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,nullptr,__net_counter_rename_at_38,13));
+	DAS_ASSERT((__z_rename_at_39 == 15));
+	das_copy(__x_rename_at_33,das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,nullptr,__counter_rename_at_31,13));
+	DAS_ASSERT((__x_rename_at_33 == 15));
+	Lambda DAS_COMMENT((int32_t,int32_t)) __l_rename_at_43; das_zero(__l_rename_at_43);
+	onlyNull_5a44edcbabed5240(__context__,__l_rename_at_43);
+	Lambda DAS_COMMENT((int32_t,int32_t)) __t_rename_at_45; das_zero(__t_rename_at_45); das_move(__t_rename_at_45, ((Lambda DAS_COMMENT((int32_t,int32_t)))addX_71b0aba558695c43(__context__,1)));
+	int32_t __q_rename_at_46 = ((int32_t)das_invoke_lambda<int32_t>::invoke<int32_t>(__context__,nullptr,__t_rename_at_45,2));
+	DAS_ASSERT((__q_rename_at_46 == 3));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void main_13f21b0ea414e87b ( Context * __context__ )
+{
+	test_89f5860fe601ad0(__context__);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_8b9bf29a687b3e9d
+	aotLib[0xd467d57646ae4a91] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_8b9bf29a687b3e9d>>();
+	};
+	// _Funcbuiltin_0x60_clone_67b037a581fb735d
+	aotLib[0x8a379b7b467385eb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint8_t> & , TArray<uint8_t> const  &  ),&_Funcbuiltin_0x60_clone_67b037a581fb735d>>();
+	};
+	// finalize_eb32dbbcfacb758c
+	aotLib[0x974e7aff20c68ee5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_26_8_1 &  ),&finalize_eb32dbbcfacb758c>>();
+	};
+	// finalize_978f70739e077c5c
+	aotLib[0x21f5b9394d3fd0ad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_8_2 &  ),&finalize_978f70739e077c5c>>();
+	};
+	// _Funcbuiltin_0x60_binary_save_a5df83e9dc7c73b3
+	aotLib[0xa0fa494992291579] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Message const  & , Block DAS_COMMENT((void,TArray<uint8_t> const )) const  &  ),&_Funcbuiltin_0x60_binary_save_a5df83e9dc7c73b3>>();
+	};
+	// _Funcbuiltin_0x60_binary_load_518db28af2c7362a
+	aotLib[0x547340a6b57f88f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Message & , TArray<uint8_t> const  &  ),&_Funcbuiltin_0x60_binary_load_518db28af2c7362a>>();
+	};
+	// _Func_lambda_thismodule_26_8_1_0x60_function_494491d4d5bf65e3
+	aotLib[0x6109e5e54d4911c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, _lambda_thismodule_26_8_1 & , int32_t  ),&_Func_lambda_thismodule_26_8_1_0x60_function_494491d4d5bf65e3>>();
+	};
+	// _Func_lambda_thismodule_26_8_1_0x60_finalizer_9c5998f770b93b62
+	aotLib[0x74cfd60c981a881] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_26_8_1 *  ),&_Func_lambda_thismodule_26_8_1_0x60_finalizer_9c5998f770b93b62>>();
+	};
+	// _Func_lambda_thismodule_32_8_2_0x60_function_57f732cbcbc81ea5
+	aotLib[0xeb15127164b6a46d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, _lambda_thismodule_32_8_2 & , int32_t  ),&_Func_lambda_thismodule_32_8_2_0x60_function_57f732cbcbc81ea5>>();
+	};
+	// _Func_lambda_thismodule_32_8_2_0x60_finalizer_97054b620e078c7a
+	aotLib[0x9cf97e6b1898de49] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_32_8_2 *  ),&_Func_lambda_thismodule_32_8_2_0x60_finalizer_97054b620e078c7a>>();
+	};
+	// send_bbeef9b7f724fec9
+	aotLib[0xcc0afae4d2a6a844] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Lambda DAS_COMMENT((int32_t,int32_t))  ),&send_bbeef9b7f724fec9>>();
+	};
+	// recv_d5a75202a1f3c17f
+	aotLib[0x7eb506e78e970bfa] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Lambda DAS_COMMENT((int32_t,int32_t)) (*) ( Context * __context__ ),&recv_d5a75202a1f3c17f>>();
+	};
+	// onlyNull_5a44edcbabed5240
+	aotLib[0x7436e550fb2b10c5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Lambda DAS_COMMENT((int32_t,int32_t)) const   ),&onlyNull_5a44edcbabed5240>>();
+	};
+	// addX_71b0aba558695c43
+	aotLib[0x9945522771186f15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Lambda DAS_COMMENT((int32_t,int32_t)) (*) ( Context * __context__, int32_t  ),&addX_71b0aba558695c43>>();
+	};
+	// test_89f5860fe601ad0
+	aotLib[0xb327135a904f9456] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_89f5860fe601ad0>>();
+	};
+	// main_13f21b0ea414e87b
+	aotLib[0xefe22f9f2cb3c8f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&main_13f21b0ea414e87b>>();
+	};
+	// [[ init script ]]
+	aotLib[0x2f86d3b7696756dc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
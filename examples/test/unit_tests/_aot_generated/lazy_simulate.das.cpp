@@ -0,0 +1,404 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require jobque
+#include "daScript/simulate/aot_builtin_jobque.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings_boost
+ // require ast_boost
+ // require templates
+ // require contracts
+ // require array_boost
+ // require algorithm
+ // require templates_boost
+ // require macro_boost
+ // require jobque_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_8910260562708430741 {
+
+extern StructInfo __struct_info__730bde65988d0945;
+extern TypeInfo __type_info__2be34ed071faa10;
+extern TypeInfo __type_info__2f707f193f39acb0;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__6a2fe2a04b7d19c;
+extern VarInfo __var_info__de9bb61030383005;
+extern VarInfo __var_info__3edb2588b8de37d1;
+extern VarInfo __var_info__18aab86bb3264c3a;
+extern VarInfo __var_info__7872f643fc9ddddb;
+extern VarInfo __var_info__a87b81a69e7665e;
+extern FuncInfo __func_info__e3ccd7343d92b33;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+TypeInfo * __type_info__a87b81a69e7665e_arg_types_var_8289964067037972805[1] = { &__type_info__6a2fe2a04b7d19c };
+VarInfo __struct_info__730bde65988d0945_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__a87b81a69e7665e_arg_types_var_8289964067037972805, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xa87b81a69e7665e), "__lambda", 0 };
+TypeInfo * __type_info__7872f643fc9ddddb_arg_types_var_8289964067037972805[1] = { &__type_info__2be34ed071faa10 };
+VarInfo __struct_info__730bde65988d0945_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__7872f643fc9ddddb_arg_types_var_8289964067037972805, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x7872f643fc9ddddb), "__finalize", 8 };
+VarInfo __struct_info__730bde65988d0945_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f707f193f39acb0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xde9bb61030383005), "status", 16 };
+VarInfo __struct_info__730bde65988d0945_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x3edb2588b8de37d1), "x", 24 };
+VarInfo * __struct_info__730bde65988d0945_fields[4] =  { &__struct_info__730bde65988d0945_field_0, &__struct_info__730bde65988d0945_field_1, &__struct_info__730bde65988d0945_field_2, &__struct_info__730bde65988d0945_field_3 };
+StructInfo __struct_info__730bde65988d0945 = {"_lambda_thismodule_21_20_1", "", 6, __struct_info__730bde65988d0945_fields, 4, 32, UINT64_C(0x0), nullptr, UINT64_C(0x730bde65988d0945) };
+VarInfo __func_info__e3ccd7343d92b33_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f707f193f39acb0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x18aab86bb3264c3a), "status", 0 };
+VarInfo * __func_info__e3ccd7343d92b33_fields[1] =  { &__func_info__e3ccd7343d92b33_field_0 };
+FuncInfo __func_info__e3ccd7343d92b33 = {"invoke block<(status:jobque::JobStatus?):void> const", "", __func_info__e3ccd7343d92b33_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xe3ccd7343d92b33), 0x0 };
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xeeb3b74c98cb09c3), 0x0 };
+TypeInfo __type_info__2be34ed071faa10 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__6a2fe2a04b7d19c, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x2be34ed071faa10) };
+TypeInfo __type_info__2f707f193f39acb0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~jobque::JobStatus"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 104, UINT64_C(0x2f707f193f39acb0) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__6a2fe2a04b7d19c = { Type::tStructure, &__struct_info__730bde65988d0945, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 32, UINT64_C(0x6a2fe2a04b7d19c) };
+
+static void resolveTypeInfoAnnotations()
+{
+	__type_info__2f707f193f39acb0.resolveAnnotation();
+}
+
+namespace  { struct _lambda_thismodule_21_20_1; };
+namespace  { struct _lambda_thismodule_21_20_1_new_job_clone; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstSimulateMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupSimulateMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+namespace templates { struct DecltypeMacro; };
+namespace templates { struct DecltypeNoRefMacro; };
+namespace templates { struct TemplateMacro; };
+namespace contracts { struct IsAnyType; };
+namespace contracts { struct IsAnyArrayMacro; };
+namespace contracts { struct IsDimMacro; };
+namespace contracts { struct IsNotDimMacro; };
+namespace contracts { struct IsAnyEnumMacro; };
+namespace contracts { struct IsAnyVectorType; };
+namespace contracts { struct IsAnyStructMacro; };
+namespace contracts { struct IsAnyNumericMacro; };
+namespace contracts { struct IsAnyWorkhorse; };
+namespace contracts { struct IsAnyWorkhorseNonPtrMacro; };
+namespace contracts { struct IsAnyTupleNonPtrMacro; };
+namespace contracts { struct IsAnyVariantNonPtrMacro; };
+namespace contracts { struct IsAnyFunctionNonPtrMacro; };
+namespace templates_boost { struct Template; };
+namespace templates_boost { struct TemplateVisitor; };
+namespace templates_boost { struct RemoveDerefVisitor; };
+namespace templates_boost { struct QRulesVisitor; };
+namespace templates_boost { struct AstQCallMacro; };
+namespace templates_boost { struct QMacro; };
+namespace templates_boost { struct QBlockMacro; };
+namespace templates_boost { struct QBlockToArrayMacro; };
+namespace templates_boost { struct QBlockExprMacro; };
+namespace templates_boost { struct QTypeMacro; };
+namespace templates_boost { struct AstQNamedMacro; };
+namespace templates_boost { struct AstQFunctionMacro; };
+namespace templates_boost { struct AstQVariableMacro; };
+namespace templates_boost { struct AstQNamedClassMacro; };
+namespace templates_boost { struct AstQMethodMacro; };
+namespace macro_boost { struct MacroVerifyMacro; };
+namespace jobque_boost { struct NewJobMacro; };
+namespace jobque_boost { struct ChannelAndStatusCapture; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+// unused structure AstSimulateMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupForLoopMacro
+// unused structure SetupCaptureMacro
+// unused structure SetupSimulateMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+// unused structure DecltypeMacro
+// unused structure DecltypeNoRefMacro
+// unused structure TemplateMacro
+// unused structure IsAnyType
+// unused structure IsAnyArrayMacro
+// unused structure IsDimMacro
+// unused structure IsNotDimMacro
+// unused structure IsAnyEnumMacro
+// unused structure IsAnyVectorType
+// unused structure IsAnyStructMacro
+// unused structure IsAnyNumericMacro
+// unused structure IsAnyWorkhorse
+// unused structure IsAnyWorkhorseNonPtrMacro
+// unused structure IsAnyTupleNonPtrMacro
+// unused structure IsAnyVariantNonPtrMacro
+// unused structure IsAnyFunctionNonPtrMacro
+// unused structure Template
+// unused structure TemplateVisitor
+// unused structure RemoveDerefVisitor
+// unused structure QRulesVisitor
+// unused structure AstQCallMacro
+// unused structure QMacro
+// unused structure QBlockMacro
+// unused structure QBlockToArrayMacro
+// unused structure QBlockExprMacro
+// unused structure QTypeMacro
+// unused structure AstQNamedMacro
+// unused structure AstQFunctionMacro
+// unused structure AstQVariableMacro
+// unused structure AstQNamedClassMacro
+// unused structure AstQMethodMacro
+// unused structure MacroVerifyMacro
+// unused structure NewJobMacro
+// unused structure ChannelAndStatusCapture
+namespace  {
+
+struct _lambda_thismodule_21_20_1 {
+	Func DAS_COMMENT((void,_lambda_thismodule_21_20_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_21_20_1 *)) __finalize;
+	JobStatus * status;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_21_20_1)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_20_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_20_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_20_1,status)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_20_1,x)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_21_20_1_new_job_clone {
+	Func DAS_COMMENT((void,_lambda_thismodule_21_20_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_21_20_1 *)) __finalize;
+	JobStatus * status;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_21_20_1_new_job_clone)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_20_1_new_job_clone,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_20_1_new_job_clone,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_20_1_new_job_clone,status)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_21_20_1_new_job_clone,x)==24,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_1bff14cede7f4487 ( Context * __context__, _lambda_thismodule_21_20_1 & ____this_rename_at_21 );
+inline void clone_ccbc85a695667e7f ( Context * __context__, _lambda_thismodule_21_20_1_new_job_clone & __a_rename_at_21, _lambda_thismodule_21_20_1_new_job_clone const  & __b_rename_at_21 );
+inline void _Func_lambda_thismodule_21_20_1_0x60_function_c6f722e69a6948cb ( Context * __context__, _lambda_thismodule_21_20_1 & ____this_rename_at_21 );
+inline void _Func_lambda_thismodule_21_20_1_0x60_finalizer_df3fae33f567e662 ( Context * __context__, _lambda_thismodule_21_20_1 * ____this_rename_at_21 );
+inline int32_t fib_aa4c2d62f42b665a ( Context * __context__, int32_t __n_rename_at_5 );
+inline bool test_5560d2e320fd4744 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<int32_t,0x4c584f6952c4c6c3>(__context__) = 55;/*g_fib*/
+}
+
+inline void finalize_1bff14cede7f4487 ( Context * __context__, _lambda_thismodule_21_20_1 &  ____this_rename_at_21 )
+{
+	memset(&(____this_rename_at_21), 0, 32);
+}
+
+inline void clone_ccbc85a695667e7f ( Context * __context__, _lambda_thismodule_21_20_1_new_job_clone &  __a_rename_at_21, _lambda_thismodule_21_20_1_new_job_clone const  &  __b_rename_at_21 )
+{
+	das_copy(__a_rename_at_21.__lambda,__b_rename_at_21.__lambda);
+	das_copy(__a_rename_at_21.__finalize,__b_rename_at_21.__finalize);
+	das_copy(__a_rename_at_21.status,__b_rename_at_21.status);
+	das_copy(__a_rename_at_21.x,__b_rename_at_21.x);
+}
+
+inline void _Func_lambda_thismodule_21_20_1_0x60_function_c6f722e69a6948cb ( Context * __context__, _lambda_thismodule_21_20_1 &  ____this_rename_at_21 )
+{
+/* finally */ auto __finally_21= das_finally([&](){
+	das_invoke_function<void>::invoke<JobStatus * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::release_capture_jobque_job_status C1<H<jobque::JobStatus>>?*/ 13882985380930343467u)),____this_rename_at_21.status);
+/* end finally */ });
+	DAS_ASSERT((fib_aa4c2d62f42b665a(__context__,____this_rename_at_21.x + 10) == (fib_aa4c2d62f42b665a(__context__,____this_rename_at_21.x + 9) + fib_aa4c2d62f42b665a(__context__,____this_rename_at_21.x + 8))));
+	notifyAndReleaseJob(____this_rename_at_21.status,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_21_20_1_0x60_finalizer_df3fae33f567e662 ( Context * __context__, _lambda_thismodule_21_20_1 * ____this_rename_at_21 )
+{
+	finalize_1bff14cede7f4487(__context__,das_arg<_lambda_thismodule_21_20_1>::pass(das_deref(__context__,____this_rename_at_21)));
+	das_delete_lambda_struct<_lambda_thismodule_21_20_1 *>::clear(__context__,____this_rename_at_21);
+}
+
+inline int32_t fib_aa4c2d62f42b665a ( Context * __context__, int32_t __n_rename_at_5 )
+{
+	return das_auto_cast<int32_t>::cast((__n_rename_at_5 < 2) ? das_auto_cast<int32_t>::cast(__n_rename_at_5) : das_auto_cast<int32_t>::cast((fib_aa4c2d62f42b665a(__context__,__n_rename_at_5 - 1) + fib_aa4c2d62f42b665a(__context__,__n_rename_at_5 - 2))));
+}
+
+inline bool test_5560d2e320fd4744 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,176,"test " DAS_FILE_LINE);
+{
+	DAS_ASSERT((das_global<int32_t,0x4c584f6952c4c6c3>(__context__) /*g_fib*/ == 55));
+	withJobQue(das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		withJobStatus(4,das_make_block<void,JobStatus *>(__context__,128,0,&__func_info__e3ccd7343d92b33,[&](JobStatus * __status_rename_at_18) -> void{
+			{
+				bool __need_loop_19 = true;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,4));
+				int32_t __x_rename_at_19;
+				__need_loop_19 = __x_iterator.first(__context__,(__x_rename_at_19)) && __need_loop_19;
+				for ( ; __need_loop_19 ; __need_loop_19 = __x_iterator.next(__context__,(__x_rename_at_19)) )
+				{
+					new_job_invoke(das_ascend<void,_lambda_thismodule_21_20_1>::make(__context__,&__type_info__6a2fe2a04b7d19c,(([&]() -> _lambda_thismodule_21_20_1 {
+						_lambda_thismodule_21_20_1 __mks_21;
+						das_copy((__mks_21.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_21_20_1`function XS<::_lambda_thismodule_21_20_1>*/ 8858512915301717306u))));
+						das_copy((__mks_21.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_21_20_1`finalizer X1<S<::_lambda_thismodule_21_20_1>>?*/ 11359113736473354488u))));
+						das_copy((__mks_21.status),(das_invoke_function<JobStatus *>::invoke<JobStatus * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::capture_jobque_job_status C1<H<jobque::JobStatus>>?*/ 15451494409577770137u)),__status_rename_at_18)));
+						das_copy((__mks_21.x),(__x_rename_at_19));
+						return __mks_21;
+					})())),Func(__context__->fnByMangledName(/*clone XS<::_lambda_thismodule_21_20_1_new_job_clone> CIS<::_lambda_thismodule_21_20_1_new_job_clone>*/ 7941176323307231294u)),32,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_19));
+			};
+			waitForJob(__status_rename_at_18,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_1bff14cede7f4487
+	aotLib[0xbe18bd1756d4d7f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_21_20_1 &  ),&finalize_1bff14cede7f4487>>();
+	};
+	// clone_ccbc85a695667e7f
+	aotLib[0xb0846cd460cf2219] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_21_20_1_new_job_clone & , _lambda_thismodule_21_20_1_new_job_clone const  &  ),&clone_ccbc85a695667e7f>>();
+	};
+	// _Func_lambda_thismodule_21_20_1_0x60_function_c6f722e69a6948cb
+	aotLib[0xddca530cfb838ca1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_21_20_1 &  ),&_Func_lambda_thismodule_21_20_1_0x60_function_c6f722e69a6948cb>>();
+	};
+	// _Func_lambda_thismodule_21_20_1_0x60_finalizer_df3fae33f567e662
+	aotLib[0xacf5f778c0e3a8fb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_21_20_1 *  ),&_Func_lambda_thismodule_21_20_1_0x60_finalizer_df3fae33f567e662>>();
+	};
+	// fib_aa4c2d62f42b665a
+	aotLib[0x1cb8e42c84c66a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&fib_aa4c2d62f42b665a>>();
+	};
+	// test_5560d2e320fd4744
+	aotLib[0x79bd6e2c60c487b4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_5560d2e320fd4744>>();
+	};
+	// [[ init script ]]
+	aotLib[0xf048d756e11c1c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,346 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_15284454922743948949 {
+
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__ab623c79443cb772;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern VarInfo __var_info__2b53753c9e06b87e;
+extern VarInfo __var_info__7ebc384e9ad54cf5;
+extern VarInfo __var_info__4db606ebbb415df4;
+extern VarInfo __var_info__b860b353cf55600d;
+extern VarInfo __var_info__e8a86008e72808fa;
+extern VarInfo __var_info__c7c61dae2d1d01b4;
+extern FuncInfo __func_info__7b907b9bb53120a1;
+extern FuncInfo __func_info__39e68453484bfe78;
+extern FuncInfo __func_info__d288526b39488ae2;
+extern FuncInfo __func_info__987684a7db7b0827;
+extern FuncInfo __func_info__e9a029d22c57d9c0;
+
+VarInfo __func_info__7b907b9bb53120a1_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__90f5707b5a6f641, nullptr, nullptr, nullptr, 0, 0, nullptr, 8428, 8, UINT64_C(0xe8a86008e72808fa), "data", 0 };
+VarInfo __func_info__7b907b9bb53120a1_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x4db606ebbb415df4), "size", 0 };
+VarInfo * __func_info__7b907b9bb53120a1_fields[2] =  { &__func_info__7b907b9bb53120a1_field_0, &__func_info__7b907b9bb53120a1_field_1 };
+FuncInfo __func_info__7b907b9bb53120a1 = {"invoke block<(data:int const? const# implicit;size:int const):void> const", "", __func_info__7b907b9bb53120a1_fields, 2, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x7b907b9bb53120a1), 0x0 };
+VarInfo __func_info__39e68453484bfe78_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 41154, 24, UINT64_C(0xb860b353cf55600d), "tarr2", 0 };
+VarInfo * __func_info__39e68453484bfe78_fields[1] =  { &__func_info__39e68453484bfe78_field_0 };
+FuncInfo __func_info__39e68453484bfe78 = {"invoke block<(tarr2:array<int># implicit):void> const", "", __func_info__39e68453484bfe78_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x39e68453484bfe78), 0x0 };
+VarInfo __func_info__d288526b39488ae2_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 41186, 24, UINT64_C(0xc7c61dae2d1d01b4), "tarr", 0 };
+VarInfo * __func_info__d288526b39488ae2_fields[1] =  { &__func_info__d288526b39488ae2_field_0 };
+FuncInfo __func_info__d288526b39488ae2 = {"invoke block<(tarr:array<int> const# implicit):void> const", "", __func_info__d288526b39488ae2_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xd288526b39488ae2), 0x0 };
+VarInfo __func_info__987684a7db7b0827_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 8396, 8, UINT64_C(0x2b53753c9e06b87e), "data", 0 };
+VarInfo __func_info__987684a7db7b0827_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x4db606ebbb415df4), "size", 0 };
+VarInfo * __func_info__987684a7db7b0827_fields[2] =  { &__func_info__987684a7db7b0827_field_0, &__func_info__987684a7db7b0827_field_1 };
+FuncInfo __func_info__987684a7db7b0827 = {"invoke block<(data:int?# implicit;size:int const):void> const", "", __func_info__987684a7db7b0827_fields, 2, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x987684a7db7b0827), 0x0 };
+VarInfo __func_info__e9a029d22c57d9c0_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__ab623c79443cb772, nullptr, nullptr, nullptr, 0, 0, nullptr, 41154, 24, UINT64_C(0x7ebc384e9ad54cf5), "ftarr", 0 };
+VarInfo * __func_info__e9a029d22c57d9c0_fields[1] =  { &__func_info__e9a029d22c57d9c0_field_0 };
+FuncInfo __func_info__e9a029d22c57d9c0 = {"invoke block<(ftarr:array<UnitTest::TestObjectFoo># implicit):void> const", "", __func_info__e9a029d22c57d9c0_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xe9a029d22c57d9c0), 0x0 };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__ab623c79443cb772 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~UnitTest::TestObjectFoo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 56, UINT64_C(0xab623c79443cb772) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+
+static void resolveTypeInfoAnnotations()
+{
+	__type_info__ab623c79443cb772.resolveAnnotation();
+}
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline void _Funcbuiltin_0x60_lock_12751cddc08bcc29 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_657, Block DAS_COMMENT((void,TArray<int32_t> const )) const  & __blk_rename_at_657 );
+inline void _Funcbuiltin_0x60_lock_data_9f60f83d136f70bc ( Context * __context__, TArray<int32_t> const  & __a_rename_at_673, Block DAS_COMMENT((void,int32_t const  * const ,int32_t)) const  & __blk_rename_at_673 );
+inline void _Funcbuiltin_0x60_lock_data_ff58b4773ba03d68 ( Context * __context__, TArray<int32_t> & __a_rename_at_662, Block DAS_COMMENT((void,int32_t *,int32_t)) const  & __blk_rename_at_662 );
+inline void _Funcbuiltin_0x60_lock_cf3da1f452741925 ( Context * __context__, TArray<int32_t> & __a_rename_at_652, Block DAS_COMMENT((void,TArray<int32_t>)) const  & __blk_rename_at_652 );
+inline void _Funcbuiltin_0x60_push_488225fd8c3c264a ( Context * __context__, TArray<TestObjectFoo> & __Arr_rename_at_75, TestObjectFoo const  & __value_rename_at_75 );
+inline void _Funcbuiltin_0x60_lock_7a0dfef0e8dd2acb ( Context * __context__, TArray<TestObjectFoo> & __a_rename_at_652, Block DAS_COMMENT((void,TArray<TestObjectFoo>)) const  & __blk_rename_at_652 );
+inline bool test_50de0888bba2587 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_lock_12751cddc08bcc29 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_657, Block DAS_COMMENT((void,TArray<int32_t> const )) const  &  __blk_rename_at_657 )
+{
+	builtin_array_lock(__a_rename_at_657,__context__);
+	das_invoke<void>::invoke<TArray<int32_t> const  &>(__context__,nullptr,__blk_rename_at_657,__a_rename_at_657);
+	builtin_array_unlock(__a_rename_at_657,__context__);
+}
+
+inline void _Funcbuiltin_0x60_lock_data_9f60f83d136f70bc ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_673, Block DAS_COMMENT((void,int32_t const  * const ,int32_t)) const  &  __blk_rename_at_673 )
+{
+	int32_t __len_rename_at_674 = ((int32_t)builtin_array_size(__a_rename_at_673));
+	if ( __len_rename_at_674 != 0 )
+	{
+		builtin_array_lock(__a_rename_at_673,__context__);
+		das_invoke<void>::invoke<int32_t const  * const ,int32_t>(__context__,nullptr,__blk_rename_at_673,das_ref(__context__,__a_rename_at_673(0,__context__)),__len_rename_at_674);
+		builtin_array_unlock(__a_rename_at_673,__context__);
+	} else {
+		das_invoke<void>::invoke<void * const ,int32_t>(__context__,nullptr,__blk_rename_at_673,nullptr,0);
+	};
+}
+
+inline void _Funcbuiltin_0x60_lock_data_ff58b4773ba03d68 ( Context * __context__, TArray<int32_t> &  __a_rename_at_662, Block DAS_COMMENT((void,int32_t *,int32_t)) const  &  __blk_rename_at_662 )
+{
+	int32_t __len_rename_at_663 = ((int32_t)builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_662)));
+	if ( __len_rename_at_663 != 0 )
+	{
+		builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_662),__context__);
+		das_invoke<void>::invoke<int32_t *,int32_t>(__context__,nullptr,__blk_rename_at_662,das_ref(__context__,__a_rename_at_662(0,__context__)),__len_rename_at_663);
+		builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_662),__context__);
+	} else {
+		int32_t * __nullT_rename_at_670 = 0;
+		das_invoke<void>::invoke<int32_t *,int32_t>(__context__,nullptr,__blk_rename_at_662,__nullT_rename_at_670,0);
+	};
+}
+
+inline void _Funcbuiltin_0x60_lock_cf3da1f452741925 ( Context * __context__, TArray<int32_t> &  __a_rename_at_652, Block DAS_COMMENT((void,TArray<int32_t>)) const  &  __blk_rename_at_652 )
+{
+	builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_652),__context__);
+	das_invoke<void>::invoke<TArray<int32_t> &>(__context__,nullptr,__blk_rename_at_652,das_arg<TArray<int32_t>>::pass(__a_rename_at_652));
+	builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_652),__context__);
+}
+
+inline void _Funcbuiltin_0x60_push_488225fd8c3c264a ( Context * __context__, TArray<TestObjectFoo> &  __Arr_rename_at_75, TestObjectFoo const  &  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<TestObjectFoo>>::pass(__Arr_rename_at_75),56,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Funcbuiltin_0x60_lock_7a0dfef0e8dd2acb ( Context * __context__, TArray<TestObjectFoo> &  __a_rename_at_652, Block DAS_COMMENT((void,TArray<TestObjectFoo>)) const  &  __blk_rename_at_652 )
+{
+	builtin_array_lock(das_arg<TArray<TestObjectFoo>>::pass(__a_rename_at_652),__context__);
+	das_invoke<void>::invoke<TArray<TestObjectFoo> &>(__context__,nullptr,__blk_rename_at_652,das_arg<TArray<TestObjectFoo>>::pass(__a_rename_at_652));
+	builtin_array_unlock(das_arg<TArray<TestObjectFoo>>::pass(__a_rename_at_652),__context__);
+}
+
+inline bool test_50de0888bba2587 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,432,"test " DAS_FILE_LINE);
+{
+	TestObjectFoo _temp_make_local_26_14_352;
+	TArray<int32_t> __arr_rename_at_6_ConstRef; das_zero(__arr_rename_at_6_ConstRef); das_move(__arr_rename_at_6_ConstRef, ((TArray<int32_t>)das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<int32_t>{
+		TArray<int32_t> ____acomp_6_rename_at_6; das_zero(____acomp_6_rename_at_6);
+		builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_6_rename_at_6),false);
+		{
+			bool __need_loop_6 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_6;
+			__need_loop_6 = __x_iterator.first(__context__,(__x_rename_at_6)) && __need_loop_6;
+			for ( ; __need_loop_6 ; __need_loop_6 = __x_iterator.next(__context__,(__x_rename_at_6)) )
+			{
+				_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____acomp_6_rename_at_6),__x_rename_at_6);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_6));
+		};
+		builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_6_rename_at_6),true);
+		return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(____acomp_6_rename_at_6);
+	})));
+	TArray<int32_t> const  & __arr_rename_at_6 = __arr_rename_at_6_ConstRef; ;
+	_Funcbuiltin_0x60_lock_12751cddc08bcc29(__context__,__arr_rename_at_6,das_make_block<void,TArray<int32_t> const  &>(__context__,224,0,&__func_info__d288526b39488ae2,[&](TArray<int32_t> const  & __tarr_rename_at_7) -> void{
+		{
+			bool __need_loop_8 = true;
+			// a : int const&
+			das_iterator<TArray<int32_t> const > __a_iterator(__arr_rename_at_6);
+			int32_t const  * __a_rename_at_8;
+			__need_loop_8 = __a_iterator.first(__context__,(__a_rename_at_8)) && __need_loop_8;
+			// b : int const&#
+			das_iterator<TArray<int32_t> const > __b_iterator(__tarr_rename_at_7);
+			int32_t const  * __b_rename_at_8;
+			__need_loop_8 = __b_iterator.first(__context__,(__b_rename_at_8)) && __need_loop_8;
+			for ( ; __need_loop_8 ; __need_loop_8 = __a_iterator.next(__context__,(__a_rename_at_8)) && __b_iterator.next(__context__,(__b_rename_at_8)) )
+			{
+				DAS_ASSERT(((*__a_rename_at_8) == (*__b_rename_at_8)));
+			}
+			__a_iterator.close(__context__,(__a_rename_at_8));
+			__b_iterator.close(__context__,(__b_rename_at_8));
+		};
+	}));
+	_Funcbuiltin_0x60_lock_data_9f60f83d136f70bc(__context__,__arr_rename_at_6,das_make_block<void,int32_t const  * const ,int32_t>(__context__,224,0,&__func_info__7b907b9bb53120a1,[&](int32_t const  * const  __data_rename_at_10, int32_t const  __size_rename_at_10) -> void{
+		{
+			bool __need_loop_11 = true;
+			// j : int const
+			das_iterator<range> __j_iterator(range(0,10));
+			int32_t __j_rename_at_11;
+			__need_loop_11 = __j_iterator.first(__context__,(__j_rename_at_11)) && __need_loop_11;
+			for ( ; __need_loop_11 ; __need_loop_11 = __j_iterator.next(__context__,(__j_rename_at_11)) )
+			{
+				DAS_ASSERT((das_index<int32_t const  * const >::at(__data_rename_at_10,__j_rename_at_11,__context__) == __j_rename_at_11));
+			}
+			__j_iterator.close(__context__,(__j_rename_at_11));
+		};
+	}));
+	TArray<int32_t> __arr2_rename_at_14; das_zero(__arr2_rename_at_14); das_move(__arr2_rename_at_14, das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<int32_t>{
+		TArray<int32_t> ____acomp_14_rename_at_14; das_zero(____acomp_14_rename_at_14);
+		builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_14_rename_at_14),false);
+		{
+			bool __need_loop_14 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_14;
+			__need_loop_14 = __x_iterator.first(__context__,(__x_rename_at_14)) && __need_loop_14;
+			for ( ; __need_loop_14 ; __need_loop_14 = __x_iterator.next(__context__,(__x_rename_at_14)) )
+			{
+				_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____acomp_14_rename_at_14),__x_rename_at_14);
+			}
+			__x_iterator.close(__context__,(__x_rename_at_14));
+		};
+		builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_14_rename_at_14),true);
+		return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(____acomp_14_rename_at_14);
+	}));
+	_Funcbuiltin_0x60_lock_data_ff58b4773ba03d68(__context__,das_arg<TArray<int32_t>>::pass(__arr2_rename_at_14),das_make_block<void,int32_t *,int32_t>(__context__,368,0,&__func_info__987684a7db7b0827,[&](int32_t * __data_rename_at_15, int32_t const  __size_rename_at_15) -> void{
+		{
+			bool __need_loop_16 = true;
+			// j : int const
+			das_iterator<range> __j_iterator(range(0,10));
+			int32_t __j_rename_at_16;
+			__need_loop_16 = __j_iterator.first(__context__,(__j_rename_at_16)) && __need_loop_16;
+			for ( ; __need_loop_16 ; __need_loop_16 = __j_iterator.next(__context__,(__j_rename_at_16)) )
+			{
+				das_copy(das_index<int32_t *>::at(__data_rename_at_15,__j_rename_at_16,__context__),__j_rename_at_16 * 2);
+			}
+			__j_iterator.close(__context__,(__j_rename_at_16));
+		};
+	}));
+	{
+		bool __need_loop_19 = true;
+		// j : int const
+		das_iterator<range> __j_iterator(range(0,10));
+		int32_t __j_rename_at_19;
+		__need_loop_19 = __j_iterator.first(__context__,(__j_rename_at_19)) && __need_loop_19;
+		for ( ; __need_loop_19 ; __need_loop_19 = __j_iterator.next(__context__,(__j_rename_at_19)) )
+		{
+			DAS_ASSERT((__arr2_rename_at_14(__j_rename_at_19,__context__) == (__j_rename_at_19 * 2)));
+		}
+		__j_iterator.close(__context__,(__j_rename_at_19));
+	};
+	_Funcbuiltin_0x60_lock_cf3da1f452741925(__context__,das_arg<TArray<int32_t>>::pass(__arr2_rename_at_14),das_make_block<void,TArray<int32_t> &>(__context__,368,0,&__func_info__39e68453484bfe78,[&](TArray<int32_t> & __tarr2_rename_at_21) -> void{
+		{
+			bool __need_loop_22 = true;
+			// a : int&
+			das_iterator<TArray<int32_t>> __a_iterator(__arr2_rename_at_14);
+			int32_t * __a_rename_at_22;
+			__need_loop_22 = __a_iterator.first(__context__,(__a_rename_at_22)) && __need_loop_22;
+			// b : int&#
+			das_iterator<TArray<int32_t>> __b_iterator(__tarr2_rename_at_21);
+			int32_t * __b_rename_at_22;
+			__need_loop_22 = __b_iterator.first(__context__,(__b_rename_at_22)) && __need_loop_22;
+			for ( ; __need_loop_22 ; __need_loop_22 = __a_iterator.next(__context__,(__a_rename_at_22)) && __b_iterator.next(__context__,(__b_rename_at_22)) )
+			{
+				DAS_ASSERT(((*__a_rename_at_22) == (*__b_rename_at_22)));
+			}
+			__a_iterator.close(__context__,(__a_rename_at_22));
+			__b_iterator.close(__context__,(__b_rename_at_22));
+		};
+	}));
+	TArray<TestObjectFoo> __farr_rename_at_25; das_zero(__farr_rename_at_25);
+	_Funcbuiltin_0x60_push_488225fd8c3c264a(__context__,das_arg<TArray<TestObjectFoo>>::pass(__farr_rename_at_25),das_arg<TestObjectFoo>::pass((([&]() -> TestObjectFoo& {
+		das_zero(_temp_make_local_26_14_352);
+		return _temp_make_local_26_14_352;
+	})())));
+	_Funcbuiltin_0x60_lock_7a0dfef0e8dd2acb(__context__,das_arg<TArray<TestObjectFoo>>::pass(__farr_rename_at_25),das_make_block<void,TArray<TestObjectFoo> &>(__context__,400,0,&__func_info__e9a029d22c57d9c0,[&](TArray<TestObjectFoo> & __ftarr_rename_at_27) -> void{
+		TestObjectFoo * __q_rename_at_28 = das_ref(__context__,__ftarr_rename_at_27(0,__context__));
+		set_foo_data(__q_rename_at_28,1234);
+	}));
+	DAS_ASSERT((__farr_rename_at_25(0,__context__).fooData /*fooData*/ == 1234));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Funcbuiltin_0x60_lock_12751cddc08bcc29
+	aotLib[0xd769e7cfca5cfe45] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  & , Block DAS_COMMENT((void,TArray<int32_t> const )) const  &  ),&_Funcbuiltin_0x60_lock_12751cddc08bcc29>>();
+	};
+	// _Funcbuiltin_0x60_lock_data_9f60f83d136f70bc
+	aotLib[0xa379dc67d2f431e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> const  & , Block DAS_COMMENT((void,int32_t const  * const ,int32_t)) const  &  ),&_Funcbuiltin_0x60_lock_data_9f60f83d136f70bc>>();
+	};
+	// _Funcbuiltin_0x60_lock_data_ff58b4773ba03d68
+	aotLib[0xed85ea3eb7c16a85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , Block DAS_COMMENT((void,int32_t *,int32_t)) const  &  ),&_Funcbuiltin_0x60_lock_data_ff58b4773ba03d68>>();
+	};
+	// _Funcbuiltin_0x60_lock_cf3da1f452741925
+	aotLib[0x2ef43f191c373e85] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , Block DAS_COMMENT((void,TArray<int32_t>)) const  &  ),&_Funcbuiltin_0x60_lock_cf3da1f452741925>>();
+	};
+	// _Funcbuiltin_0x60_push_488225fd8c3c264a
+	aotLib[0xa301beabbc4f8e55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TestObjectFoo> & , TestObjectFoo const  &  ),&_Funcbuiltin_0x60_push_488225fd8c3c264a>>();
+	};
+	// _Funcbuiltin_0x60_lock_7a0dfef0e8dd2acb
+	aotLib[0x18ba0fb07aece389] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TestObjectFoo> & , Block DAS_COMMENT((void,TArray<TestObjectFoo>)) const  &  ),&_Funcbuiltin_0x60_lock_7a0dfef0e8dd2acb>>();
+	};
+	// test_50de0888bba2587
+	aotLib[0x4ad8ae1e9f39a4e8] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_50de0888bba2587>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
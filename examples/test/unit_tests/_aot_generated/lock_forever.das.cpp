@@ -0,0 +1,163 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14436499108770324171 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline char * const  * _Funcbuiltin_0x60_find_6ab8bdb98be33543 ( Context * __context__, TTable<int32_t,char *> const  & __Tab_rename_at_258, int32_t __at_rename_at_258 );
+inline bool test_997d64cc04f09e83 ( Context * __context__ );
+inline TTable<int32_t,char *> _Funcbuiltin_0x60_to_table_move_c6ec1189d1a5f4fe ( Context * __context__, TDim<TTuple<16,int32_t,char *>,3> & __a_rename_at_564 );
+inline TTable<int32_t,char *> _Funcbuiltin_0x60_lock_forever_ab6b930e096be381 ( Context * __context__, TTable<int32_t,char *> & __Tab_rename_at_420 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	TTable<int32_t,char *> _temp_make_local_2_33_32;
+	TDim<TTuple<16,int32_t,char *>,3> _temp_make_local_2_33_80;
+	das_global<TTable<int32_t,char *>,0xcf873d10fca9cc9>(__context__) = _Funcbuiltin_0x60_lock_forever_ab6b930e096be381(__context__,das_arg<TTable<int32_t,char *>>::pass((_temp_make_local_2_33_32 = (_Funcbuiltin_0x60_to_table_move_c6ec1189d1a5f4fe(__context__,das_arg<TDim<TTuple<16,int32_t,char *>,3>>::pass((([&]() -> TDim<TTuple<16,int32_t,char *>,3>& {
+		_temp_make_local_2_33_80(0,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+			TTuple<16,int32_t,char *> __mkt_3;
+			das_get_tuple_field<int32_t,0>::get(__mkt_3) = 0;
+			das_get_tuple_field<char *,8>::get(__mkt_3) = ((char *) "zero");
+			return __mkt_3;
+		})());
+		_temp_make_local_2_33_80(1,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+			TTuple<16,int32_t,char *> __mkt_4;
+			das_get_tuple_field<int32_t,0>::get(__mkt_4) = 1;
+			das_get_tuple_field<char *,8>::get(__mkt_4) = ((char *) "one");
+			return __mkt_4;
+		})());
+		_temp_make_local_2_33_80(2,__context__) = (([&]() -> TTuple<16,int32_t,char *> {
+			TTuple<16,int32_t,char *> __mkt_5;
+			das_get_tuple_field<int32_t,0>::get(__mkt_5) = 2;
+			das_get_tuple_field<char *,8>::get(__mkt_5) = ((char *) "two");
+			return __mkt_5;
+		})());
+		return _temp_make_local_2_33_80;
+	})())))))));/*num_2_name*/
+}
+
+inline char * const  * _Funcbuiltin_0x60_find_6ab8bdb98be33543 ( Context * __context__, TTable<int32_t,char *> const  &  __Tab_rename_at_258, int32_t __at_rename_at_258 )
+{
+	return das_auto_cast<char * const  *>::cast(das_cast<char * const  *>::cast(__builtin_table_find(__context__,__Tab_rename_at_258,__at_rename_at_258)));
+}
+
+inline bool test_997d64cc04f09e83 ( Context * __context__ )
+{
+	char * __n0_rename_at_10 = ((char *)(char *)(das_null_coalescing<char * const >::get(_Funcbuiltin_0x60_find_6ab8bdb98be33543(__context__,das_global<TTable<int32_t,char *>,0xcf873d10fca9cc9>(__context__) /*num_2_name*/,0),((char *) "0"))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__n0_rename_at_10),cast<char *>::from(((char *) "zero")),*__context__,nullptr)));
+	char * __n1_rename_at_12 = ((char *)(char *)(das_null_coalescing<char * const >::get(_Funcbuiltin_0x60_find_6ab8bdb98be33543(__context__,das_global<TTable<int32_t,char *>,0xcf873d10fca9cc9>(__context__) /*num_2_name*/,1),((char *) "1"))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__n1_rename_at_12),cast<char *>::from(((char *) "one")),*__context__,nullptr)));
+	char * __n2_rename_at_14 = ((char *)(char *)(das_null_coalescing<char * const >::get(_Funcbuiltin_0x60_find_6ab8bdb98be33543(__context__,das_global<TTable<int32_t,char *>,0xcf873d10fca9cc9>(__context__) /*num_2_name*/,2),((char *) "2"))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__n2_rename_at_14),cast<char *>::from(((char *) "two")),*__context__,nullptr)));
+	char * __n3_rename_at_16 = ((char *)(char *)(das_null_coalescing<char * const >::get(_Funcbuiltin_0x60_find_6ab8bdb98be33543(__context__,das_global<TTable<int32_t,char *>,0xcf873d10fca9cc9>(__context__) /*num_2_name*/,3),((char *) "3"))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__n3_rename_at_16),cast<char *>::from(((char *) "3")),*__context__,nullptr)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline TTable<int32_t,char *> _Funcbuiltin_0x60_to_table_move_c6ec1189d1a5f4fe ( Context * __context__, TDim<TTuple<16,int32_t,char *>,3> &  __a_rename_at_564 )
+{
+	TTable<int32_t,char *> __tab_rename_at_565; das_zero(__tab_rename_at_565);
+	{
+		bool __need_loop_567 = true;
+		// x : tuple<int aka keyT;string aka valT>&
+		das_iterator<TDim<TTuple<16,int32_t,char *>,3>> __x_iterator(__a_rename_at_564);
+		TTuple<16,int32_t,char *> * __x_rename_at_567;
+		__need_loop_567 = __x_iterator.first(__context__,(__x_rename_at_567)) && __need_loop_567;
+		for ( ; __need_loop_567 ; __need_loop_567 = __x_iterator.next(__context__,(__x_rename_at_567)) )
+		{
+			das_copy(__tab_rename_at_565(das_get_tuple_field<int32_t,0>::get((*__x_rename_at_567)),__context__),das_get_tuple_field<char *,8>::get((*__x_rename_at_567)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_567));
+	};
+	return /* <- */ das_auto_cast_move<TTable<int32_t,char *>>::cast(__tab_rename_at_565);
+}
+
+inline TTable<int32_t,char *> _Funcbuiltin_0x60_lock_forever_ab6b930e096be381 ( Context * __context__, TTable<int32_t,char *> &  __Tab_rename_at_420 )
+{
+	builtin_table_lock(das_arg<TTable<int32_t,char *>>::pass(__Tab_rename_at_420),__context__);
+	return /* <- */ das_auto_cast_move<TTable<int32_t,char *>>::cast(das_cast<TTable<int32_t,char *>>::cast(__Tab_rename_at_420));
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_find_6ab8bdb98be33543
+	aotLib[0xd9a29f3880e146f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * const  * (*) ( Context * __context__, TTable<int32_t,char *> const  & , int32_t  ),&_Funcbuiltin_0x60_find_6ab8bdb98be33543>>();
+	};
+	// test_997d64cc04f09e83
+	aotLib[0x3fb6b8f107afd592] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_997d64cc04f09e83>>();
+	};
+	// _Funcbuiltin_0x60_to_table_move_c6ec1189d1a5f4fe
+	aotLib[0xf06d083ddd01b765] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<int32_t,char *> (*) ( Context * __context__, TDim<TTuple<16,int32_t,char *>,3> &  ),&_Funcbuiltin_0x60_to_table_move_c6ec1189d1a5f4fe>>();
+	};
+	// _Funcbuiltin_0x60_lock_forever_ab6b930e096be381
+	aotLib[0xea0fca398e314ef1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<int32_t,char *> (*) ( Context * __context__, TTable<int32_t,char *> &  ),&_Funcbuiltin_0x60_lock_forever_ab6b930e096be381>>();
+	};
+	// [[ init script ]]
+	aotLib[0x752b22e638e2fa04] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
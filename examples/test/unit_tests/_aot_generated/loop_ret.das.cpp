@@ -0,0 +1,160 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require random
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_4822527913860963970 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace random { struct _lambda_random_95_8_1; };
+// unused structure _lambda_random_95_8_1
+
+inline void _Funcbuiltin_0x60_push_c57593a89d515ce2 ( Context * __context__, TArray<TTuple<16,int32_t,float3>> & __Arr_rename_at_75, TTuple<16,int32_t,float3> const  & __value_rename_at_75 );
+inline int32_t _Funcrandom_0x60_random_int_2fd6061b7238802b ( Context * __context__, int4 & __seed_rename_at_26 );
+inline void foo_13979c2cbe18cbad ( Context * __context__, TArray<TTuple<16,int32_t,float3>> & __attached_fires_rename_at_9 );
+inline bool test_cd00e5ac639ea262 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global_zero<int4,0x5dabe00e974c9589>(__context__);/*seed*/
+}
+
+inline void _Funcbuiltin_0x60_push_c57593a89d515ce2 ( Context * __context__, TArray<TTuple<16,int32_t,float3>> &  __Arr_rename_at_75, TTuple<16,int32_t,float3> const  &  __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<TTuple<16,int32_t,float3>>>::pass(__Arr_rename_at_75),16,__context__),__context__),__value_rename_at_75);
+}
+
+inline int32_t _Funcrandom_0x60_random_int_2fd6061b7238802b ( Context * __context__, int4 & __seed_rename_at_26 )
+{
+	das_copy(das_swizzle_ref<int32_t,int4,0>::swizzle(__seed_rename_at_26) /*x*/,(v_extract_xi(v_cast_vec4i(__seed_rename_at_26)) /*x*/ * 214013) + 2531011);
+	return das_auto_cast<int32_t>::cast((v_extract_xi(v_cast_vec4i(__seed_rename_at_26)) /*x*/ >> 16) & 32767);
+}
+
+inline void foo_13979c2cbe18cbad ( Context * __context__, TArray<TTuple<16,int32_t,float3>> &  __attached_fires_rename_at_9 )
+{
+	TTuple<16,int32_t,float3> _temp_make_local_14_31_48;
+	int32_t __t_rename_at_10 = ((int32_t)(SimPolicy<int32_t>::Mod(_Funcrandom_0x60_random_int_2fd6061b7238802b(__context__,das_global<int4,0x5dabe00e974c9589>(__context__) /*seed*/),100,*__context__,nullptr)));
+	{
+		bool __need_loop_11 = true;
+		// x : tuple<int;float3> aka Foo&
+		das_iterator<TArray<TTuple<16,int32_t,float3>>> __x_iterator(__attached_fires_rename_at_9);
+		TTuple<16,int32_t,float3> * __x_rename_at_11;
+		__need_loop_11 = __x_iterator.first(__context__,(__x_rename_at_11)) && __need_loop_11;
+		for ( ; __need_loop_11 ; __need_loop_11 = __x_iterator.next(__context__,(__x_rename_at_11)) )
+		{
+			if ( das_get_tuple_field<int32_t,0>::get((*__x_rename_at_11)) == __t_rename_at_10 )
+			{
+				return ;
+			};
+		}
+		__x_iterator.close(__context__,(__x_rename_at_11));
+	};
+	_Funcbuiltin_0x60_push_c57593a89d515ce2(__context__,das_arg<TArray<TTuple<16,int32_t,float3>>>::pass(__attached_fires_rename_at_9),das_arg<TTuple<16,int32_t,float3>>::pass((([&]() -> TTuple<16,int32_t,float3>& {
+		das_get_tuple_field<int32_t,0>::get(_temp_make_local_14_31_48) = __t_rename_at_10;
+		das_get_tuple_field<float3,4>::get(_temp_make_local_14_31_48) = v_zero();
+		return _temp_make_local_14_31_48;
+	})())));
+}
+
+inline bool test_cd00e5ac639ea262 ( Context * __context__ )
+{
+	TArray<TTuple<16,int32_t,float3>> __a_rename_at_18; das_zero(__a_rename_at_18);
+	{
+		bool __need_loop_19 = true;
+		// x : int const
+		das_iterator<range> __x_iterator(range(0,1000));
+		int32_t __x_rename_at_19;
+		__need_loop_19 = __x_iterator.first(__context__,(__x_rename_at_19)) && __need_loop_19;
+		for ( ; __need_loop_19 ; __need_loop_19 = __x_iterator.next(__context__,(__x_rename_at_19)) )
+		{
+			foo_13979c2cbe18cbad(__context__,das_arg<TArray<TTuple<16,int32_t,float3>>>::pass(__a_rename_at_18));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_19));
+	};
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<TTuple<16,int32_t,float3>>>::pass(__a_rename_at_18)) == 100));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_push_c57593a89d515ce2
+	aotLib[0x6267f29e231c0ac9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<16,int32_t,float3>> & , TTuple<16,int32_t,float3> const  &  ),&_Funcbuiltin_0x60_push_c57593a89d515ce2>>();
+	};
+	// _Funcrandom_0x60_random_int_2fd6061b7238802b
+	aotLib[0xce88576071ec5209] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int4 &  ),&_Funcrandom_0x60_random_int_2fd6061b7238802b>>();
+	};
+	// foo_13979c2cbe18cbad
+	aotLib[0xe0df1c3141cf88a1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<TTuple<16,int32_t,float3>> &  ),&foo_13979c2cbe18cbad>>();
+	};
+	// test_cd00e5ac639ea262
+	aotLib[0x8612dd0ac3eb2b39] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_cd00e5ac639ea262>>();
+	};
+	// [[ init script ]]
+	aotLib[0xc31ff3c05c3a509a] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,117 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require _module_a
+ // require _module_b
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_6713535388366099846 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline char * _Func_module_b_0x60_from_b_get_3_7765d7618fe7762e ( Context * __context__ );
+inline char * _Func_module_b_0x60_from_b_get_4_8629f045cf09dcc0 ( Context * __context__ );
+inline bool test_6d73ddff7fb4a2bb ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	das_global<char *,0xe327c7d92e302e53>(__context__) = ((char *) "local");/*global_1*/
+	das_global<char *,0xd0fb75d923a7a3e9>(__context__) = ((char *) "local");/*global_3*/
+}
+
+inline char * _Func_module_b_0x60_from_b_get_3_7765d7618fe7762e ( Context * __context__ )
+{
+	return das_auto_cast<char *>::cast(das_global<char *,0xc15814b3a7b08fe>(__context__) /*global_3*/);
+}
+
+inline char * _Func_module_b_0x60_from_b_get_4_8629f045cf09dcc0 ( Context * __context__ )
+{
+	return das_auto_cast<char *>::cast(das_global<char *,0x129fc48afb09c742>(__context__) /*global_4*/);
+}
+
+inline bool test_6d73ddff7fb4a2bb ( Context * __context__ )
+{
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(das_global<char *,0xe327c7d92e302e53>(__context__) /*::global_1*/),cast<char *>::from(((char *) "local")),*__context__,nullptr)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(das_global<char *,0xe74fff8ae2812e31>(__context__) /*_module_b::global_1*/),cast<char *>::from(((char *) "from_b")),*__context__,nullptr)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Func_module_b_0x60_from_b_get_3_7765d7618fe7762e(__context__)),cast<char *>::from(((char *) "from_a")),*__context__,nullptr)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(_Func_module_b_0x60_from_b_get_4_8629f045cf09dcc0(__context__)),cast<char *>::from(((char *) "from_b")),*__context__,nullptr)));
+	DAS_VERIFY((SimPolicy<char *>::Equ(cast<char *>::from(das_global<char *,0xd0fb75d923a7a3e9>(__context__) /*global_3*/),cast<char *>::from(((char *) "local")),*__context__,nullptr)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_module_b_0x60_from_b_get_3_7765d7618fe7762e
+	aotLib[0xa26065b6e7054c59] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__ ),&_Func_module_b_0x60_from_b_get_3_7765d7618fe7762e>>();
+	};
+	// _Func_module_b_0x60_from_b_get_4_8629f045cf09dcc0
+	aotLib[0x809eabf4f2acee01] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<char * (*) ( Context * __context__ ),&_Func_module_b_0x60_from_b_get_4_8629f045cf09dcc0>>();
+	};
+	// test_6d73ddff7fb4a2bb
+	aotLib[0xf8f0e1c1a63ed1b1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_6d73ddff7fb4a2bb>>();
+	};
+	// [[ init script ]]
+	aotLib[0x1ccea4dfac06fc62] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
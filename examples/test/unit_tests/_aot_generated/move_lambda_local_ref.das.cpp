@@ -0,0 +1,270 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14537985465962840243 {
+
+extern StructInfo __struct_info__b07a44ffecde32aa;
+extern TypeInfo __type_info__579eb20cb38ed255;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__fb77d00fcd2644c1;
+extern TypeInfo __type_info__ba617568b4f8a021;
+extern TypeInfo __type_info__3ceb21b1e6727087;
+extern VarInfo __var_info__2358fab10367aade;
+extern VarInfo __var_info__a1df582463939697;
+extern VarInfo __var_info__a691d27237d7bc4d;
+
+TypeInfo * __type_info__a1df582463939697_arg_types_var_12716552363815350954[1] = { &__type_info__fb77d00fcd2644c1 };
+VarInfo __struct_info__b07a44ffecde32aa_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__ba617568b4f8a021, nullptr, (TypeInfo **)__type_info__a1df582463939697_arg_types_var_12716552363815350954, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xa1df582463939697), "__lambda", 0 };
+TypeInfo * __type_info__2358fab10367aade_arg_types_var_12716552363815350954[1] = { &__type_info__579eb20cb38ed255 };
+VarInfo __struct_info__b07a44ffecde32aa_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__2358fab10367aade_arg_types_var_12716552363815350954, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x2358fab10367aade), "__finalize", 8 };
+VarInfo __struct_info__b07a44ffecde32aa_field_2 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xa691d27237d7bc4d), "arr", 16 };
+VarInfo * __struct_info__b07a44ffecde32aa_fields[3] =  { &__struct_info__b07a44ffecde32aa_field_0, &__struct_info__b07a44ffecde32aa_field_1, &__struct_info__b07a44ffecde32aa_field_2 };
+StructInfo __struct_info__b07a44ffecde32aa = {"_lambda_thismodule_6_2_1", "", 22, __struct_info__b07a44ffecde32aa_fields, 3, 40, UINT64_C(0x0), nullptr, UINT64_C(0xb07a44ffecde32aa) };
+TypeInfo __type_info__579eb20cb38ed255 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fb77d00fcd2644c1, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x579eb20cb38ed255) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__fb77d00fcd2644c1 = { Type::tStructure, &__struct_info__b07a44ffecde32aa, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 40, UINT64_C(0xfb77d00fcd2644c1) };
+TypeInfo __type_info__ba617568b4f8a021 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 41090, 24, UINT64_C(0xba617568b4f8a021) };
+TypeInfo __type_info__3ceb21b1e6727087 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x3ceb21b1e6727087) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__3ceb21b1e6727087 };
+namespace  { struct Foo; };
+namespace  { struct _lambda_thismodule_6_2_1; };
+namespace  {
+
+struct Foo {
+	Lambda DAS_COMMENT((TArray<int32_t>)) bar;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,bar)==0,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_6_2_1 {
+	Func DAS_COMMENT((TArray<int32_t>,_lambda_thismodule_6_2_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_6_2_1 *)) __finalize;
+	TArray<int32_t> arr;
+};
+static_assert(sizeof(_lambda_thismodule_6_2_1)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_6_2_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_6_2_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_6_2_1,arr)==16,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> & __a_rename_at_42 );
+inline void finalize_bc55851199976cfa ( Context * __context__, _lambda_thismodule_6_2_1 & ____this_rename_at_6 );
+inline void _Funcbuiltin_0x60_clone_4bc3594d348ca0bd ( Context * __context__, TArray<int32_t> & __a_rename_at_331, TArray<int32_t> const  & __b_rename_at_331 );
+inline TArray<int32_t> _Func_lambda_thismodule_6_2_1_0x60_function_be36c1de830577ec ( Context * __context__, _lambda_thismodule_6_2_1 & ____this_rename_at_6 );
+inline void _Func_lambda_thismodule_6_2_1_0x60_finalizer_7bd9f63d2c80d5e4 ( Context * __context__, _lambda_thismodule_6_2_1 * ____this_rename_at_6 );
+inline TArray<int32_t> _Funcbuiltin_0x60_clone_to_move_ca504ea2562ff7ec ( Context * __context__, TArray<int32_t> const  & __clone_src_rename_at_318 );
+inline Lambda DAS_COMMENT((TArray<int32_t>)) Bar_5b9d0b75ce418d31 ( Context * __context__, TArray<int32_t> & __arr_rename_at_4 );
+inline bool test_3e67f1c5653ea457 ( Context * __context__ );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_f9adbdca370c7b15 ( Context * __context__, TDim<int32_t,3> & __a_rename_at_517 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	TArray<int32_t> _temp_make_local_10_13_48;
+	TDim<int32_t,3> _temp_make_local_10_13_80;
+	das_global<Foo *,0xcf8e7480b2462845>(__context__) = das_ascend<Foo,Foo>::make(__context__,nullptr,(([&]() -> Foo {
+		Foo __mks_9;
+		das_move((__mks_9.bar),(Bar_5b9d0b75ce418d31(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_10_13_48 = (_Funcbuiltin_0x60_to_array_move_f9adbdca370c7b15(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+			_temp_make_local_10_13_80(0,__context__) = 1;
+			_temp_make_local_10_13_80(1,__context__) = 2;
+			_temp_make_local_10_13_80(2,__context__) = 3;
+			return _temp_make_local_10_13_80;
+		})())))))))));
+		return __mks_9;
+	})()));/*foo*/
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_42);
+}
+
+inline void finalize_bc55851199976cfa ( Context * __context__, _lambda_thismodule_6_2_1 &  ____this_rename_at_6 )
+{
+	memset(&(____this_rename_at_6), 0, 40);
+}
+
+inline void _Funcbuiltin_0x60_clone_4bc3594d348ca0bd ( Context * __context__, TArray<int32_t> &  __a_rename_at_331, TArray<int32_t> const  &  __b_rename_at_331 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_331),builtin_array_size(__b_rename_at_331));
+	{
+		bool __need_loop_333 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_331);
+		int32_t * __aV_rename_at_333;
+		__need_loop_333 = __aV_iterator.first(__context__,(__aV_rename_at_333)) && __need_loop_333;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_331);
+		int32_t const  * __bV_rename_at_333;
+		__need_loop_333 = __bV_iterator.first(__context__,(__bV_rename_at_333)) && __need_loop_333;
+		for ( ; __need_loop_333 ; __need_loop_333 = __aV_iterator.next(__context__,(__aV_rename_at_333)) && __bV_iterator.next(__context__,(__bV_rename_at_333)) )
+		{
+			das_copy((*__aV_rename_at_333),(*__bV_rename_at_333));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_333));
+		__bV_iterator.close(__context__,(__bV_rename_at_333));
+	};
+}
+
+inline TArray<int32_t> _Func_lambda_thismodule_6_2_1_0x60_function_be36c1de830577ec ( Context * __context__, _lambda_thismodule_6_2_1 &  ____this_rename_at_6 )
+{
+	TArray<int32_t> _temp_make_local_6_11_32;
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_6_11_32 = (_Funcbuiltin_0x60_clone_to_move_ca504ea2562ff7ec(__context__,das_arg<TArray<int32_t>>::pass(____this_rename_at_6.arr)))))));
+}
+
+inline void _Func_lambda_thismodule_6_2_1_0x60_finalizer_7bd9f63d2c80d5e4 ( Context * __context__, _lambda_thismodule_6_2_1 * ____this_rename_at_6 )
+{
+	finalize_bc55851199976cfa(__context__,das_arg<_lambda_thismodule_6_2_1>::pass(das_deref(__context__,____this_rename_at_6)));
+	das_delete_lambda_struct<_lambda_thismodule_6_2_1 *>::clear(__context__,____this_rename_at_6);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_clone_to_move_ca504ea2562ff7ec ( Context * __context__, TArray<int32_t> const  &  __clone_src_rename_at_318 )
+{
+	TArray<int32_t> __clone_dest_rename_at_320; das_zero(__clone_dest_rename_at_320);
+	_Funcbuiltin_0x60_clone_4bc3594d348ca0bd(__context__,das_arg<TArray<int32_t>>::pass(__clone_dest_rename_at_320),__clone_src_rename_at_318);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__clone_dest_rename_at_320);
+}
+
+inline Lambda DAS_COMMENT((TArray<int32_t>)) Bar_5b9d0b75ce418d31 ( Context * __context__, TArray<int32_t> &  __arr_rename_at_4 )
+{
+	return das_auto_cast<Lambda DAS_COMMENT((TArray<int32_t>))>::cast(das_ascend<TArray<int32_t>,_lambda_thismodule_6_2_1>::make(__context__,&__type_info__fb77d00fcd2644c1,(([&]() -> _lambda_thismodule_6_2_1 {
+		_lambda_thismodule_6_2_1 __mks_6;
+		das_copy((__mks_6.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_6_2_1`function XS<::_lambda_thismodule_6_2_1>*/ 12050418517275182924u))));
+		das_copy((__mks_6.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_6_2_1`finalizer X1<S<::_lambda_thismodule_6_2_1>>?*/ 9388715158519120204u))));
+		das_move((__mks_6.arr),(__arr_rename_at_4));
+		return __mks_6;
+	})())));
+}
+
+inline bool test_3e67f1c5653ea457 ( Context * __context__ )
+{
+	TArray<int32_t> __l_rename_at_15_ConstRef; das_zero(__l_rename_at_15_ConstRef); das_move(__l_rename_at_15_ConstRef, ((TArray<int32_t>)das_invoke_lambda<TArray<int32_t>>::invoke_cmres(__context__,nullptr,das_global<Foo *,0xcf8e7480b2462845>(__context__) /*foo*/->bar)));
+	TArray<int32_t> const  & __l_rename_at_15 = __l_rename_at_15_ConstRef; ;
+	DAS_ASSERT((((__l_rename_at_15(0,__context__) == 1) && (__l_rename_at_15(1,__context__) == 2)) && (__l_rename_at_15(2,__context__) == 3)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_f9adbdca370c7b15 ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_517 )
+{
+	TArray<int32_t> __arr_rename_at_518; das_zero(__arr_rename_at_518);
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__arr_rename_at_518),3,4,__context__);
+	das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_518(0,__context__))),__a_rename_at_517);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_518);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd
+	aotLib[0x66e322246598e835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<int32_t> & (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd>>();
+	};
+	// finalize_bc55851199976cfa
+	aotLib[0xaeceeeb50c408185] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_6_2_1 &  ),&finalize_bc55851199976cfa>>();
+	};
+	// _Funcbuiltin_0x60_clone_4bc3594d348ca0bd
+	aotLib[0x1366ab6fb285c311] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_4bc3594d348ca0bd>>();
+	};
+	// _Func_lambda_thismodule_6_2_1_0x60_function_be36c1de830577ec
+	aotLib[0x6e12fbfd1fc0b3f3] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, _lambda_thismodule_6_2_1 &  ),&_Func_lambda_thismodule_6_2_1_0x60_function_be36c1de830577ec>>();
+	};
+	// _Func_lambda_thismodule_6_2_1_0x60_finalizer_7bd9f63d2c80d5e4
+	aotLib[0x665a5de1c4afa9c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_6_2_1 *  ),&_Func_lambda_thismodule_6_2_1_0x60_finalizer_7bd9f63d2c80d5e4>>();
+	};
+	// _Funcbuiltin_0x60_clone_to_move_ca504ea2562ff7ec
+	aotLib[0xf87b49e9056d430c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_to_move_ca504ea2562ff7ec>>();
+	};
+	// Bar_5b9d0b75ce418d31
+	aotLib[0x8fee23c8e26e725e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Lambda DAS_COMMENT((TArray<int32_t>)) (*) ( Context * __context__, TArray<int32_t> &  ),&Bar_5b9d0b75ce418d31>>();
+	};
+	// test_3e67f1c5653ea457
+	aotLib[0x188af2f136501965] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_3e67f1c5653ea457>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_f9adbdca370c7b15
+	aotLib[0xc186aedfb6d4be05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,3> &  ),&_Funcbuiltin_0x60_to_array_move_f9adbdca370c7b15>>();
+	};
+	// [[ init script ]]
+	aotLib[0x7a8dc8819834bc71] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
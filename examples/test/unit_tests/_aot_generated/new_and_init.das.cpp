@@ -0,0 +1,139 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_11779966591173787535 {
+
+extern StructInfo __struct_info__f35ff723fded4627;
+extern TypeInfo __type_info__16a3436a66518fac;
+extern VarInfo __var_info__a08ac32745ae8127;
+extern VarInfo __var_info__a08ab82745ae6e76;
+extern VarInfo __var_info__a08ac52745ae848d;
+extern VarInfo __var_info__a08ac22745ae7f74;
+
+VarInfo __struct_info__f35ff723fded4627_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa08ac32745ae8127), "x", 0 };
+VarInfo __struct_info__f35ff723fded4627_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa08ac22745ae7f74), "y", 4 };
+VarInfo __struct_info__f35ff723fded4627_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa08ac52745ae848d), "z", 8 };
+VarInfo __struct_info__f35ff723fded4627_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xa08ab82745ae6e76), "w", 12 };
+VarInfo * __struct_info__f35ff723fded4627_fields[4] =  { &__struct_info__f35ff723fded4627_field_0, &__struct_info__f35ff723fded4627_field_1, &__struct_info__f35ff723fded4627_field_2, &__struct_info__f35ff723fded4627_field_3 };
+StructInfo __struct_info__f35ff723fded4627 = {"Foo", "", 0, __struct_info__f35ff723fded4627_fields, 4, 16, UINT64_C(0xf2bb95199c92e1d7), nullptr, UINT64_C(0xf35ff723fded4627) };
+TypeInfo __type_info__16a3436a66518fac = { Type::tStructure, &__struct_info__f35ff723fded4627, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 286, 16, UINT64_C(0x16a3436a66518fac) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__16a3436a66518fac };
+namespace  { struct Foo; };
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct Foo {
+	int32_t x;
+	int32_t y;
+	int32_t z;
+	int32_t w;
+};
+static_assert(sizeof(Foo)==16,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==4,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,z)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,w)==12,"structure field offset mismatch with DAS");
+}
+
+inline bool test_85d0b3bb642297ae ( Context * __context__ );
+inline Foo Foo_5822dd8c4a731ef9 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_85d0b3bb642297ae ( Context * __context__ )
+{
+	Foo __f_rename_at_14; das_zero(__f_rename_at_14);
+	Foo * __q_rename_at_15 = ((Foo *)das_auto_cast<Foo * const >::cast(das_call_interop<void *>::call(&new_and_init,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<Foo &>::from(__f_rename_at_14)))));
+	DAS_ASSERT(((((__q_rename_at_15->x == 1) && (__q_rename_at_15->y == 2)) && (__q_rename_at_15->z == 3)) && (__q_rename_at_15->w == 4)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline Foo Foo_5822dd8c4a731ef9 ( Context * __context__ )
+{
+	return das_auto_cast_ref<Foo>::cast((([&]() -> Foo {
+		Foo __mks_6;
+		das_copy((__mks_6.x),(1));
+		das_copy((__mks_6.y),(2));
+		das_copy((__mks_6.z),(3));
+		das_copy((__mks_6.w),(4));
+		return __mks_6;
+	})()));
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// test_85d0b3bb642297ae
+	aotLib[0xda05954e3d64c38d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_85d0b3bb642297ae>>();
+	};
+	// Foo_5822dd8c4a731ef9
+	aotLib[0xbdd8ee59cad0fb9d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Foo (*) ( Context * __context__ ),&Foo_5822dd8c4a731ef9>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,120 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_8656524225169759817 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline int32_t charg_19cb65f07420f7be ( Context * __context__, int32_t __t_rename_at_1 );
+inline void checkInc_da3dccc42c408511 ( Context * __context__, int32_t & __val_rename_at_5 );
+inline bool test_b332d1bc091a3ba2 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t charg_19cb65f07420f7be ( Context * __context__, int32_t __t_rename_at_1 )
+{
+	++__t_rename_at_1;
+	return das_auto_cast<int32_t>::cast(__t_rename_at_1);
+}
+
+inline void checkInc_da3dccc42c408511 ( Context * __context__, int32_t & __val_rename_at_5 )
+{
+	++__val_rename_at_5;
+}
+
+inline bool test_b332d1bc091a3ba2 ( Context * __context__ )
+{
+	int32_t __y_rename_at_11 = 0;
+	das_copy(__y_rename_at_11,charg_19cb65f07420f7be(__context__,1));
+	DAS_ASSERT((true && (__y_rename_at_11 == 2)));
+	int32_t __a_rename_at_15 = 0; int32_t __b_rename_at_15 = 0; int32_t __c_rename_at_15 = 0;
+	das_copy(__a_rename_at_15,1);
+	DAS_ASSERT(((__a_rename_at_15 == 1) && (__b_rename_at_15 == 0)));
+	das_copy(__b_rename_at_15,2);
+	DAS_ASSERT(((__a_rename_at_15 == 1) && (__b_rename_at_15 == 2)));
+	__c_rename_at_15++;
+	DAS_ASSERT((__c_rename_at_15 == 1));
+	__c_rename_at_15++;
+	DAS_ASSERT((__c_rename_at_15 == 2));
+	int32_t __idx_rename_at_25 = 1;
+	checkInc_da3dccc42c408511(__context__,__idx_rename_at_25);
+	DAS_ASSERT((__idx_rename_at_25 == 2));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// charg_19cb65f07420f7be
+	aotLib[0x48b45e135e79d72d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, int32_t  ),&charg_19cb65f07420f7be>>();
+	};
+	// checkInc_da3dccc42c408511
+	aotLib[0x8928af5591f171bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, int32_t &  ),&checkInc_da3dccc42c408511>>();
+	};
+	// test_b332d1bc091a3ba2
+	aotLib[0xe2b0ed451a259c10] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_b332d1bc091a3ba2>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
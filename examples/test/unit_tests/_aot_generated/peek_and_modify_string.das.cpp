@@ -0,0 +1,148 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require strings_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3146390561839823692 {
+
+extern TypeInfo __type_info__8c48207b56753d8;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__eedabc6736e7c61a;
+extern VarInfo __var_info__e27e784eb68f5d6f;
+extern FuncInfo __func_info__6b3737f5e71a8524;
+extern FuncInfo __func_info__2d318e654b248e86;
+
+VarInfo __func_info__6b3737f5e71a8524_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 41058, 24, UINT64_C(0xeedabc6736e7c61a), "foo", 0 };
+VarInfo * __func_info__6b3737f5e71a8524_fields[1] =  { &__func_info__6b3737f5e71a8524_field_0 };
+FuncInfo __func_info__6b3737f5e71a8524 = {"invoke block<(foo:array<uint8> const#):void> const", "", __func_info__6b3737f5e71a8524_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x6b3737f5e71a8524), 0x0 };
+VarInfo __func_info__2d318e654b248e86_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__8c48207b56753d8, nullptr, nullptr, nullptr, 0, 0, nullptr, 41026, 24, UINT64_C(0xe27e784eb68f5d6f), "foo", 0 };
+VarInfo * __func_info__2d318e654b248e86_fields[1] =  { &__func_info__2d318e654b248e86_field_0 };
+FuncInfo __func_info__2d318e654b248e86 = {"invoke block<(foo:array<uint8>#):void> const", "", __func_info__2d318e654b248e86_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x2d318e654b248e86), 0x0 };
+TypeInfo __type_info__8c48207b56753d8 = { Type::tUInt8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 1, UINT64_C(0x8c48207b56753d8) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline bool _Funcstrings_boost_0x60_is_character_at_c2754ac6d3665460 ( Context * __context__, TArray<uint8_t> const  & __foo_rename_at_75, int32_t __idx_rename_at_75, int32_t __ch_rename_at_75 );
+inline bool test_73898e93090282ed ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool _Funcstrings_boost_0x60_is_character_at_c2754ac6d3665460 ( Context * __context__, TArray<uint8_t> const  &  __foo_rename_at_75, int32_t __idx_rename_at_75, int32_t __ch_rename_at_75 )
+{
+	return das_auto_cast<bool>::cast(int32_t(__foo_rename_at_75(__idx_rename_at_75,__context__)) == __ch_rename_at_75);
+}
+
+inline bool test_73898e93090282ed ( Context * __context__ ) { das_stack_prologue __prologue(__context__,128,"test " DAS_FILE_LINE);
+{
+	builtin_string_peek(((char *) " a + b * ( c << d ) blah blah b"),das_make_block<void,TArray<uint8_t> const  &>(__context__,80,0,&__func_info__6b3737f5e71a8524,[&](TArray<uint8_t> const  & __foo_rename_at_6) -> void{
+		{
+			bool __need_loop_7 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(mk_range(builtin_array_size(__foo_rename_at_6)));
+			int32_t __x_rename_at_7;
+			__need_loop_7 = __x_iterator.first(__context__,(__x_rename_at_7)) && __need_loop_7;
+			for ( ; __need_loop_7 ; __need_loop_7 = __x_iterator.next(__context__,(__x_rename_at_7)) )
+			{
+				if ( _Funcstrings_boost_0x60_is_character_at_c2754ac6d3665460(__context__,__foo_rename_at_6,__x_rename_at_7,98) )
+				{
+					DAS_ASSERT(((((__x_rename_at_7 == 5) || (__x_rename_at_7 == 20)) || (__x_rename_at_7 == 25)) || (__x_rename_at_7 == 30)));
+				};
+			}
+			__x_iterator.close(__context__,(__x_rename_at_7));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	char * __new_sample_rename_at_10 = (char *)(((char *)(builtin_string_peek_and_modify(((char *) " a + b * ( c << d ) blah blah b"),das_make_block<void,TArray<uint8_t> &>(__context__,96,0,&__func_info__2d318e654b248e86,[&](TArray<uint8_t> & __foo_rename_at_10) -> void{
+		{
+			bool __need_loop_11 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(mk_range(builtin_array_size(das_arg<TArray<uint8_t>>::pass(__foo_rename_at_10))));
+			int32_t __x_rename_at_11;
+			__need_loop_11 = __x_iterator.first(__context__,(__x_rename_at_11)) && __need_loop_11;
+			for ( ; __need_loop_11 ; __need_loop_11 = __x_iterator.next(__context__,(__x_rename_at_11)) )
+			{
+				if ( _Funcstrings_boost_0x60_is_character_at_c2754ac6d3665460(__context__,das_arg<TArray<uint8_t>>::pass(__foo_rename_at_10),__x_rename_at_11,98) )
+				{
+					das_copy(__foo_rename_at_10(__x_rename_at_11,__context__),uint8_t(66));
+				};
+			}
+			__x_iterator.close(__context__,(__x_rename_at_11));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__new_sample_rename_at_10),cast<char *>::from(((char *) " a + B * ( c << d ) Blah Blah B")),*__context__,nullptr)));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcstrings_boost_0x60_is_character_at_c2754ac6d3665460
+	aotLib[0x3b845d5f92ff58e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<uint8_t> const  & , int32_t , int32_t  ),&_Funcstrings_boost_0x60_is_character_at_c2754ac6d3665460>>();
+	};
+	// test_73898e93090282ed
+	aotLib[0xf19a6487d620d0a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_73898e93090282ed>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
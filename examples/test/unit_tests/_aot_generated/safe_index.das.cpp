@@ -0,0 +1,201 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_13565293971285733706 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline TArray<int32_t> * _Func_0x60_safe_addr_6d2f350cc45f4361 ( Context * __context__, TArray<int32_t> & __a_rename_at_1 );
+inline TTable<char *,int32_t> * _Func_0x60_safe_addr_b7056ab0f0cf9b2f ( Context * __context__, TTable<char *,int32_t> & __a_rename_at_1 );
+inline TDim<int32_t,2> * _Func_0x60_safe_addr_396a08faf5567aaf ( Context * __context__, TDim<int32_t,2> & __a_rename_at_1 );
+inline int3 * _Func_0x60_safe_addr_val_cf82729a7c8e9bbf ( Context * __context__, int3 & __a_rename_at_5 );
+inline bool test_331fed7c13808420 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline TArray<int32_t> * _Func_0x60_safe_addr_6d2f350cc45f4361 ( Context * __context__, TArray<int32_t> &  __a_rename_at_1 )
+{
+	return das_auto_cast<TArray<int32_t> *>::cast(das_ref(__context__,__a_rename_at_1));
+}
+
+inline TTable<char *,int32_t> * _Func_0x60_safe_addr_b7056ab0f0cf9b2f ( Context * __context__, TTable<char *,int32_t> &  __a_rename_at_1 )
+{
+	return das_auto_cast<TTable<char *,int32_t> *>::cast(das_ref(__context__,__a_rename_at_1));
+}
+
+inline TDim<int32_t,2> * _Func_0x60_safe_addr_396a08faf5567aaf ( Context * __context__, TDim<int32_t,2> &  __a_rename_at_1 )
+{
+	return das_auto_cast<TDim<int32_t,2> *>::cast(das_ref(__context__,__a_rename_at_1));
+}
+
+inline int3 * _Func_0x60_safe_addr_val_cf82729a7c8e9bbf ( Context * __context__, int3 & __a_rename_at_5 )
+{
+	return das_auto_cast<int3 *>::cast(das_ref(__context__,__a_rename_at_5));
+}
+
+inline bool test_331fed7c13808420 ( Context * __context__ )
+{
+	TArray<int32_t> __ar_rename_at_12; das_zero(__ar_rename_at_12);
+	int32_t __dummy_rename_at_13 = 0;
+	das_copy(das_null_coalescing<int32_t &>::get(TArray<int32_t>::safe_index(&(__ar_rename_at_12),0,__context__),__dummy_rename_at_13),1);
+	DAS_ASSERT((__dummy_rename_at_13 == 1));
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__ar_rename_at_12),1,4,__context__);
+	das_copy(das_null_coalescing<int32_t &>::get(TArray<int32_t>::safe_index(&(__ar_rename_at_12),0,__context__),__dummy_rename_at_13),2);
+	DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(__ar_rename_at_12)) == 1) && (__ar_rename_at_12(0,__context__) == 2)));
+	DAS_ASSERT((__dummy_rename_at_13 == 1));
+	TArray<int32_t> * __par_rename_at_21 = _Func_0x60_safe_addr_6d2f350cc45f4361(__context__,das_arg<TArray<int32_t>>::pass(__ar_rename_at_12));
+	builtin_array_clear(das_arg<TArray<int32_t>>::pass(__ar_rename_at_12),__context__);
+	das_copy(__dummy_rename_at_13,0);
+	das_copy(das_null_coalescing<int32_t &>::get(TArray<int32_t>::safe_index((__par_rename_at_21),0,__context__),__dummy_rename_at_13),1);
+	DAS_ASSERT((__dummy_rename_at_13 == 1));
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__ar_rename_at_12),1,4,__context__);
+	das_copy(das_null_coalescing<int32_t &>::get(TArray<int32_t>::safe_index((__par_rename_at_21),0,__context__),__dummy_rename_at_13),2);
+	DAS_ASSERT(((builtin_array_size(das_arg<TArray<int32_t>>::pass(__ar_rename_at_12)) == 1) && (__ar_rename_at_12(0,__context__) == 2)));
+	DAS_ASSERT((__dummy_rename_at_13 == 1));
+	das_copy(__par_rename_at_21,nullptr);
+	das_copy(das_null_coalescing<int32_t &>::get(TArray<int32_t>::safe_index((__par_rename_at_21),0,__context__),__dummy_rename_at_13),3);
+	DAS_ASSERT((__dummy_rename_at_13 == 3));
+	TTable<char *,int32_t> __ta_rename_at_34; das_zero(__ta_rename_at_34);
+	das_copy(__dummy_rename_at_13,0);
+	das_copy(das_null_coalescing<int32_t &>::get(TTable<char *,int32_t>::safe_index(&(__ta_rename_at_34),((char *) "one"),__context__),__dummy_rename_at_13),1);
+	DAS_ASSERT((__dummy_rename_at_13 == 1));
+	das_copy(__ta_rename_at_34(((char *) "one"),__context__),0);
+	das_copy(das_null_coalescing<int32_t &>::get(TTable<char *,int32_t>::safe_index(&(__ta_rename_at_34),((char *) "one"),__context__),__dummy_rename_at_13),2);
+	DAS_VERIFY(((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__ta_rename_at_34)) == 1) && (__ta_rename_at_34(((char *) "one"),__context__) == 2)));
+	DAS_ASSERT((__dummy_rename_at_13 == 1));
+	TTable<char *,int32_t> * __pta_rename_at_43 = _Func_0x60_safe_addr_b7056ab0f0cf9b2f(__context__,das_arg<TTable<char *,int32_t>>::pass(__ta_rename_at_34));
+	builtin_table_clear(das_arg<TTable<char *,int32_t>>::pass(__ta_rename_at_34),__context__);
+	das_copy(__dummy_rename_at_13,0);
+	das_copy(das_null_coalescing<int32_t &>::get(TTable<char *,int32_t>::safe_index((__pta_rename_at_43),((char *) "one"),__context__),__dummy_rename_at_13),1);
+	DAS_ASSERT((__dummy_rename_at_13 == 1));
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__ta_rename_at_34)) == 0));
+	das_copy(__ta_rename_at_34(((char *) "one"),__context__),1);
+	das_copy(das_null_coalescing<int32_t &>::get(TTable<char *,int32_t>::safe_index((__pta_rename_at_43),((char *) "one"),__context__),__dummy_rename_at_13),2);
+	DAS_VERIFY(((builtin_table_size(das_arg<TTable<char *,int32_t>>::pass(__ta_rename_at_34)) == 1) && (__ta_rename_at_34(((char *) "one"),__context__) == 2)));
+	DAS_ASSERT((__dummy_rename_at_13 == 1));
+	das_copy(__pta_rename_at_43,nullptr);
+	das_copy(das_null_coalescing<int32_t &>::get(TTable<char *,int32_t>::safe_index((__pta_rename_at_43),((char *) "one"),__context__),__dummy_rename_at_13),3);
+	DAS_ASSERT((__dummy_rename_at_13 == 3));
+	TDim<int32_t,2> __di_rename_at_57; das_zero(__di_rename_at_57);
+	das_copy(__dummy_rename_at_13,0);
+	das_copy(das_null_coalescing<int32_t &>::get(TDim<int32_t,2>::safe_index(&(__di_rename_at_57),3,__context__),__dummy_rename_at_13),1);
+	DAS_ASSERT((__dummy_rename_at_13 == 1));
+	das_copy(das_null_coalescing<int32_t &>::get(TDim<int32_t,2>::safe_index(&(__di_rename_at_57),0,__context__),__dummy_rename_at_13),2);
+	DAS_ASSERT((__di_rename_at_57(0,__context__) == 2));
+	DAS_ASSERT((__dummy_rename_at_13 == 1));
+	TDim<int32_t,2> * __pdi_rename_at_65 = _Func_0x60_safe_addr_396a08faf5567aaf(__context__,das_arg<TDim<int32_t,2>>::pass(__di_rename_at_57));
+	das_copy(__dummy_rename_at_13,0);
+	das_copy(das_null_coalescing<int32_t &>::get(TDim<int32_t,2>::safe_index((__pdi_rename_at_65),3,__context__),__dummy_rename_at_13),1);
+	DAS_ASSERT((__dummy_rename_at_13 == 1));
+	das_copy(__di_rename_at_57(0,__context__),0);
+	das_copy(das_null_coalescing<int32_t &>::get(TDim<int32_t,2>::safe_index((__pdi_rename_at_65),0,__context__),__dummy_rename_at_13),2);
+	DAS_ASSERT((__di_rename_at_57(0,__context__) == 2));
+	DAS_ASSERT((__dummy_rename_at_13 == 1));
+	das_copy(__pdi_rename_at_65,nullptr);
+	das_copy(das_null_coalescing<int32_t &>::get(TDim<int32_t,2>::safe_index((__pdi_rename_at_65),0,__context__),__dummy_rename_at_13),3);
+	DAS_ASSERT((__dummy_rename_at_13 == 3));
+	int3 __vec_rename_at_77 = int3(1,2,3);
+	das_copy(__dummy_rename_at_13,0);
+	das_copy(das_null_coalescing<int32_t &>::get(das_index<int3>::safe_at(&(__vec_rename_at_77),3,__context__),__dummy_rename_at_13),1);
+	DAS_ASSERT((__dummy_rename_at_13 == 1));
+	das_copy(das_null_coalescing<int32_t &>::get(das_index<int3>::safe_at(&(__vec_rename_at_77),0,__context__),__dummy_rename_at_13),2);
+	DAS_ASSERT((das_index<int3>::at(__vec_rename_at_77,0,__context__) == 2));
+	DAS_ASSERT((__dummy_rename_at_13 == 1));
+	int3 * __pvec_rename_at_85 = _Func_0x60_safe_addr_val_cf82729a7c8e9bbf(__context__,__vec_rename_at_77);
+	das_copy(__dummy_rename_at_13,0);
+	das_copy(das_null_coalescing<int32_t &>::get(das_index<int3>::safe_at((__pvec_rename_at_85),3,__context__),__dummy_rename_at_13),1);
+	DAS_ASSERT((__dummy_rename_at_13 == 1));
+	das_copy(das_index<int3>::at(__vec_rename_at_77,0,__context__),0);
+	das_copy(das_null_coalescing<int32_t &>::get(das_index<int3>::safe_at((__pvec_rename_at_85),0,__context__),__dummy_rename_at_13),2);
+	DAS_ASSERT((das_index<int3>::at(__vec_rename_at_77,0,__context__) == 2));
+	DAS_ASSERT((__dummy_rename_at_13 == 1));
+	das_copy(__pvec_rename_at_85,nullptr);
+	das_copy(das_null_coalescing<int32_t &>::get(das_index<int3>::safe_at((__pvec_rename_at_85),0,__context__),__dummy_rename_at_13),3);
+	DAS_ASSERT((__dummy_rename_at_13 == 3));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Func_0x60_safe_addr_6d2f350cc45f4361
+	aotLib[0x1e95bfc0614dfbc5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<int32_t> * (*) ( Context * __context__, TArray<int32_t> &  ),&_Func_0x60_safe_addr_6d2f350cc45f4361>>();
+	};
+	// _Func_0x60_safe_addr_b7056ab0f0cf9b2f
+	aotLib[0x34b5a70c246a3b99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TTable<char *,int32_t> * (*) ( Context * __context__, TTable<char *,int32_t> &  ),&_Func_0x60_safe_addr_b7056ab0f0cf9b2f>>();
+	};
+	// _Func_0x60_safe_addr_396a08faf5567aaf
+	aotLib[0x4245fc95a41088f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TDim<int32_t,2> * (*) ( Context * __context__, TDim<int32_t,2> &  ),&_Func_0x60_safe_addr_396a08faf5567aaf>>();
+	};
+	// _Func_0x60_safe_addr_val_cf82729a7c8e9bbf
+	aotLib[0x70d02f8f86f77879] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int3 * (*) ( Context * __context__, int3 &  ),&_Func_0x60_safe_addr_val_cf82729a7c8e9bbf>>();
+	};
+	// test_331fed7c13808420
+	aotLib[0x5a0c25e3aa39682e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_331fed7c13808420>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,468 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_9196761617374806599 {
+
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__3ceb21b1e6727087;
+
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__3ceb21b1e6727087 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x3ceb21b1e6727087) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__3ceb21b1e6727087 };
+
+inline void _Funcbuiltin_0x60_clone_6c49f7c5af61778f ( Context * __context__, TTable<int32_t,void> & __a_rename_at_341, TTable<int32_t,void> const  & __b_rename_at_341 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> & __a_rename_at_42 );
+inline TTable<int32_t,void> _Funcbuiltin_0x60_clone_to_move_63c68afdd4582c42 ( Context * __context__, TTable<int32_t,void> const  & __clone_src_rename_at_318 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_9203c68f7d4aaffb ( Context * __context__, TTable<int32_t,void> const  & __a_rename_at_364 );
+inline void _Funcbuiltin_0x60_sort_4732ebdcad990f07 ( Context * __context__, TArray<int32_t> & __a_rename_at_594 );
+inline TTable<int32_t,void> _Funcbuiltin_0x60_to_table_move_b60f18452fffcf8d ( Context * __context__, TDim<int32_t,4> & __a_rename_at_557 );
+inline void _Funcbuiltin_0x60_insert_2267db139e0df384 ( Context * __context__, TTable<int32_t,void> & __Tab_rename_at_303, int32_t __at_rename_at_303 );
+inline TArray<int32_t> _Func_0x60_sorted_keys_3f40cecf6258f722 ( Context * __context__, TTable<int32_t,void> const  & __tab_rename_at_2 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_f9adbdca370c7b15 ( Context * __context__, TDim<int32_t,3> & __a_rename_at_517 );
+inline bool _Funcbuiltin_0x60_erase_f068f7f6b908bb11 ( Context * __context__, TTable<int32_t,void> & __Tab_rename_at_298, int32_t __at_rename_at_298 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_4a0c453305a7dd5 ( Context * __context__, TDim<int32_t,2> & __a_rename_at_517 );
+inline bool _Funcbuiltin_0x60_key_exists_521e4bee16959b33 ( Context * __context__, TTable<int32_t,void> const  & __Tab_rename_at_306, int32_t __at_rename_at_306 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_54f9a4ebca1fe3c1 ( Context * __context__, TDim<int32_t,4> & __a_rename_at_517 );
+inline TTable<int32_t,void> _Funcbuiltin_0x60_to_table_3f3328d93e964b26 ( Context * __context__, TDim<int32_t,4> const  & __a_rename_at_550 );
+inline bool test_289331a427b5d222 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_clone_6c49f7c5af61778f ( Context * __context__, TTable<int32_t,void> &  __a_rename_at_341, TTable<int32_t,void> const  &  __b_rename_at_341 )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_343_13_32;
+	builtin_table_clear(das_arg<TTable<int32_t,void>>::pass(__a_rename_at_341),__context__);
+	{
+		bool __need_loop_343 = true;
+		// k : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_343_13_32 = (_Funcbuiltin_0x60_keys_9203c68f7d4aaffb(__context__,__b_rename_at_341))));
+		int32_t const  * __k_rename_at_343;
+		__need_loop_343 = __k_iterator.first(__context__,(__k_rename_at_343)) && __need_loop_343;
+		for ( ; __need_loop_343 ; __need_loop_343 = __k_iterator.next(__context__,(__k_rename_at_343)) )
+		{
+			__builtin_table_set_insert(__context__,__a_rename_at_341,(*__k_rename_at_343));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_343));
+	};
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_42);
+}
+
+inline TTable<int32_t,void> _Funcbuiltin_0x60_clone_to_move_63c68afdd4582c42 ( Context * __context__, TTable<int32_t,void> const  &  __clone_src_rename_at_318 )
+{
+	TTable<int32_t,void> __clone_dest_rename_at_320; das_zero(__clone_dest_rename_at_320);
+	_Funcbuiltin_0x60_clone_6c49f7c5af61778f(__context__,das_arg<TTable<int32_t,void>>::pass(__clone_dest_rename_at_320),__clone_src_rename_at_318);
+	return /* <- */ das_auto_cast_move<TTable<int32_t,void>>::cast(__clone_dest_rename_at_320);
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_9203c68f7d4aaffb ( Context * __context__, TTable<int32_t,void> const  &  __a_rename_at_364 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_365; das_zero(__it_rename_at_365);
+	builtin_table_keys(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_365),__a_rename_at_364,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t const  &))>::cast(__it_rename_at_365);
+}
+
+inline void _Funcbuiltin_0x60_sort_4732ebdcad990f07 ( Context * __context__, TArray<int32_t> &  __a_rename_at_594 )
+{
+	builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_594),__context__);
+	builtin_sort<int32_t>(das_ref(__context__,__a_rename_at_594(0,__context__)),builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_594)));
+	builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_594),__context__);
+}
+
+inline TTable<int32_t,void> _Funcbuiltin_0x60_to_table_move_b60f18452fffcf8d ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_557 )
+{
+	TTable<int32_t,void> __tab_rename_at_558; das_zero(__tab_rename_at_558);
+	{
+		bool __need_loop_559 = true;
+		// at : int aka keyT&
+		das_iterator<TDim<int32_t,4>> __at_iterator(__a_rename_at_557);
+		int32_t * __at_rename_at_559;
+		__need_loop_559 = __at_iterator.first(__context__,(__at_rename_at_559)) && __need_loop_559;
+		for ( ; __need_loop_559 ; __need_loop_559 = __at_iterator.next(__context__,(__at_rename_at_559)) )
+		{
+			__builtin_table_set_insert(__context__,__tab_rename_at_558,(*__at_rename_at_559));
+		}
+		__at_iterator.close(__context__,(__at_rename_at_559));
+	};
+	return /* <- */ das_auto_cast_move<TTable<int32_t,void>>::cast(__tab_rename_at_558);
+}
+
+inline void _Funcbuiltin_0x60_insert_2267db139e0df384 ( Context * __context__, TTable<int32_t,void> &  __Tab_rename_at_303, int32_t __at_rename_at_303 )
+{
+	__builtin_table_set_insert(__context__,__Tab_rename_at_303,__at_rename_at_303);
+}
+
+inline TArray<int32_t> _Func_0x60_sorted_keys_3f40cecf6258f722 ( Context * __context__, TTable<int32_t,void> const  &  __tab_rename_at_2 )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_4_13_64;
+	TArray<int32_t> __res_rename_at_3; das_zero(__res_rename_at_3);
+	{
+		bool __need_loop_4 = true;
+		// k : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_4_13_64 = (_Funcbuiltin_0x60_keys_9203c68f7d4aaffb(__context__,__tab_rename_at_2))));
+		int32_t const  * __k_rename_at_4;
+		__need_loop_4 = __k_iterator.first(__context__,(__k_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __k_iterator.next(__context__,(__k_rename_at_4)) )
+		{
+			_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(__res_rename_at_3),(*__k_rename_at_4));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_4));
+	};
+	_Funcbuiltin_0x60_sort_4732ebdcad990f07(__context__,das_arg<TArray<int32_t>>::pass(__res_rename_at_3));
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass(__res_rename_at_3)));
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_f9adbdca370c7b15 ( Context * __context__, TDim<int32_t,3> &  __a_rename_at_517 )
+{
+	TArray<int32_t> __arr_rename_at_518; das_zero(__arr_rename_at_518);
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__arr_rename_at_518),3,4,__context__);
+	das_copy(das_cast<TDim<int32_t,3>>::cast(das_ref(__context__,__arr_rename_at_518(0,__context__))),__a_rename_at_517);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_518);
+}
+
+inline bool _Funcbuiltin_0x60_erase_f068f7f6b908bb11 ( Context * __context__, TTable<int32_t,void> &  __Tab_rename_at_298, int32_t __at_rename_at_298 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_erase(__context__,__Tab_rename_at_298,__at_rename_at_298));
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_4a0c453305a7dd5 ( Context * __context__, TDim<int32_t,2> &  __a_rename_at_517 )
+{
+	TArray<int32_t> __arr_rename_at_518; das_zero(__arr_rename_at_518);
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__arr_rename_at_518),2,4,__context__);
+	das_copy(das_cast<TDim<int32_t,2>>::cast(das_ref(__context__,__arr_rename_at_518(0,__context__))),__a_rename_at_517);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_518);
+}
+
+inline bool _Funcbuiltin_0x60_key_exists_521e4bee16959b33 ( Context * __context__, TTable<int32_t,void> const  &  __Tab_rename_at_306, int32_t __at_rename_at_306 )
+{
+	return das_auto_cast<bool>::cast(__builtin_table_key_exists(__context__,__Tab_rename_at_306,__at_rename_at_306));
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_54f9a4ebca1fe3c1 ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_517 )
+{
+	TArray<int32_t> __arr_rename_at_518; das_zero(__arr_rename_at_518);
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__arr_rename_at_518),4,4,__context__);
+	das_copy(das_cast<TDim<int32_t,4>>::cast(das_ref(__context__,__arr_rename_at_518(0,__context__))),__a_rename_at_517);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_518);
+}
+
+inline TTable<int32_t,void> _Funcbuiltin_0x60_to_table_3f3328d93e964b26 ( Context * __context__, TDim<int32_t,4> const  &  __a_rename_at_550 )
+{
+	TTable<int32_t,void> __tab_rename_at_551; das_zero(__tab_rename_at_551);
+	{
+		bool __need_loop_552 = true;
+		// at : int aka keyT const&
+		das_iterator<TDim<int32_t,4> const > __at_iterator(__a_rename_at_550);
+		int32_t const  * __at_rename_at_552;
+		__need_loop_552 = __at_iterator.first(__context__,(__at_rename_at_552)) && __need_loop_552;
+		for ( ; __need_loop_552 ; __need_loop_552 = __at_iterator.next(__context__,(__at_rename_at_552)) )
+		{
+			__builtin_table_set_insert(__context__,__tab_rename_at_551,(*__at_rename_at_552));
+		}
+		__at_iterator.close(__context__,(__at_rename_at_552));
+	};
+	return /* <- */ das_auto_cast_move<TTable<int32_t,void>>::cast(__tab_rename_at_551);
+}
+
+inline bool test_289331a427b5d222 ( Context * __context__ )
+{
+	TArray<int32_t> _temp_make_local_22_15_80;
+	TArray<int32_t> _temp_make_local_22_32_112;
+	TDim<int32_t,3> _temp_make_local_22_32_144;
+	TArray<int32_t> _temp_make_local_25_15_80;
+	TArray<int32_t> _temp_make_local_25_32_112;
+	TDim<int32_t,2> _temp_make_local_25_32_144;
+	TArray<int32_t> _temp_make_local_28_15_128;
+	TArray<int32_t> _temp_make_local_28_31_160;
+	TDim<int32_t,2> _temp_make_local_28_31_192;
+	TDim<int32_t,4> _temp_make_local_39_15_176;
+	TArray<int32_t> _temp_make_local_40_15_192;
+	TArray<int32_t> _temp_make_local_40_32_224;
+	TDim<int32_t,4> _temp_make_local_40_32_256;
+	TDim<int32_t,4> _temp_make_local_42_24_240;
+	TArray<int32_t> _temp_make_local_43_15_256;
+	TArray<int32_t> _temp_make_local_43_32_288;
+	TDim<int32_t,4> _temp_make_local_43_32_320;
+	TTable<int32_t,void> __tab_rename_at_11; das_zero(__tab_rename_at_11);
+	DAS_ASSERT((builtin_table_size(das_arg<TTable<int32_t,void>>::pass(__tab_rename_at_11)) == 0));
+	{
+		bool __need_loop_20 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(3,6));
+		int32_t __i_rename_at_20;
+		__need_loop_20 = __i_iterator.first(__context__,(__i_rename_at_20)) && __need_loop_20;
+		for ( ; __need_loop_20 ; __need_loop_20 = __i_iterator.next(__context__,(__i_rename_at_20)) )
+		{
+			_Funcbuiltin_0x60_insert_2267db139e0df384(__context__,das_arg<TTable<int32_t,void>>::pass(__tab_rename_at_11),__i_rename_at_20);
+		}
+		__i_iterator.close(__context__,(__i_rename_at_20));
+	};
+	{
+		bool __need_loop_22 = true;
+		// k : int&
+		das_iterator<TArray<int32_t>> __k_iterator((_temp_make_local_22_15_80 = (_Func_0x60_sorted_keys_3f40cecf6258f722(__context__,das_arg<TTable<int32_t,void>>::pass(__tab_rename_at_11)))));
+		int32_t * __k_rename_at_22;
+		__need_loop_22 = __k_iterator.first(__context__,(__k_rename_at_22)) && __need_loop_22;
+		// i : int&
+		das_iterator<TArray<int32_t>> __i_iterator((_temp_make_local_22_32_112 = (_Funcbuiltin_0x60_to_array_move_f9adbdca370c7b15(__context__,das_arg<TDim<int32_t,3>>::pass((([&]() -> TDim<int32_t,3>& {
+			_temp_make_local_22_32_144(0,__context__) = 3;
+			_temp_make_local_22_32_144(1,__context__) = 4;
+			_temp_make_local_22_32_144(2,__context__) = 5;
+			return _temp_make_local_22_32_144;
+		})()))))));
+		int32_t * __i_rename_at_22;
+		__need_loop_22 = __i_iterator.first(__context__,(__i_rename_at_22)) && __need_loop_22;
+		for ( ; __need_loop_22 ; __need_loop_22 = __k_iterator.next(__context__,(__k_rename_at_22)) && __i_iterator.next(__context__,(__i_rename_at_22)) )
+		{
+			DAS_ASSERT(((*__k_rename_at_22) == (*__i_rename_at_22)));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_22));
+		__i_iterator.close(__context__,(__i_rename_at_22));
+	};
+	_Funcbuiltin_0x60_erase_f068f7f6b908bb11(__context__,das_arg<TTable<int32_t,void>>::pass(__tab_rename_at_11),4);
+	{
+		bool __need_loop_25 = true;
+		// k : int&
+		das_iterator<TArray<int32_t>> __k_iterator((_temp_make_local_25_15_80 = (_Func_0x60_sorted_keys_3f40cecf6258f722(__context__,das_arg<TTable<int32_t,void>>::pass(__tab_rename_at_11)))));
+		int32_t * __k_rename_at_25;
+		__need_loop_25 = __k_iterator.first(__context__,(__k_rename_at_25)) && __need_loop_25;
+		// i : int&
+		das_iterator<TArray<int32_t>> __i_iterator((_temp_make_local_25_32_112 = (_Funcbuiltin_0x60_to_array_move_4a0c453305a7dd5(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+			_temp_make_local_25_32_144(0,__context__) = 3;
+			_temp_make_local_25_32_144(1,__context__) = 5;
+			return _temp_make_local_25_32_144;
+		})()))))));
+		int32_t * __i_rename_at_25;
+		__need_loop_25 = __i_iterator.first(__context__,(__i_rename_at_25)) && __need_loop_25;
+		for ( ; __need_loop_25 ; __need_loop_25 = __k_iterator.next(__context__,(__k_rename_at_25)) && __i_iterator.next(__context__,(__i_rename_at_25)) )
+		{
+			DAS_ASSERT(((*__k_rename_at_25) == (*__i_rename_at_25)));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_25));
+		__i_iterator.close(__context__,(__i_rename_at_25));
+	};
+	TTable<int32_t,void> __tc_rename_at_27; das_zero(__tc_rename_at_27); das_move(__tc_rename_at_27, _Funcbuiltin_0x60_clone_to_move_63c68afdd4582c42(__context__,das_arg<TTable<int32_t,void>>::pass(__tab_rename_at_11)));
+	{
+		bool __need_loop_28 = true;
+		// k : int&
+		das_iterator<TArray<int32_t>> __k_iterator((_temp_make_local_28_15_128 = (_Func_0x60_sorted_keys_3f40cecf6258f722(__context__,das_arg<TTable<int32_t,void>>::pass(__tc_rename_at_27)))));
+		int32_t * __k_rename_at_28;
+		__need_loop_28 = __k_iterator.first(__context__,(__k_rename_at_28)) && __need_loop_28;
+		// i : int&
+		das_iterator<TArray<int32_t>> __i_iterator((_temp_make_local_28_31_160 = (_Funcbuiltin_0x60_to_array_move_4a0c453305a7dd5(__context__,das_arg<TDim<int32_t,2>>::pass((([&]() -> TDim<int32_t,2>& {
+			_temp_make_local_28_31_192(0,__context__) = 3;
+			_temp_make_local_28_31_192(1,__context__) = 5;
+			return _temp_make_local_28_31_192;
+		})()))))));
+		int32_t * __i_rename_at_28;
+		__need_loop_28 = __i_iterator.first(__context__,(__i_rename_at_28)) && __need_loop_28;
+		for ( ; __need_loop_28 ; __need_loop_28 = __k_iterator.next(__context__,(__k_rename_at_28)) && __i_iterator.next(__context__,(__i_rename_at_28)) )
+		{
+			DAS_ASSERT(((*__k_rename_at_28) == (*__i_rename_at_28)));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_28));
+		__i_iterator.close(__context__,(__i_rename_at_28));
+	};
+	DAS_ASSERT((_Funcbuiltin_0x60_key_exists_521e4bee16959b33(__context__,das_arg<TTable<int32_t,void>>::pass(__tc_rename_at_27),3)));
+	DAS_ASSERT((!_Funcbuiltin_0x60_key_exists_521e4bee16959b33(__context__,das_arg<TTable<int32_t,void>>::pass(__tc_rename_at_27),4)));
+	TTable<int32_t,void> __ttt_rename_at_39; das_zero(__ttt_rename_at_39); das_move(__ttt_rename_at_39, _Funcbuiltin_0x60_to_table_move_b60f18452fffcf8d(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_39_15_176(0,__context__) = 1;
+		_temp_make_local_39_15_176(1,__context__) = 2;
+		_temp_make_local_39_15_176(2,__context__) = 3;
+		_temp_make_local_39_15_176(3,__context__) = 4;
+		return _temp_make_local_39_15_176;
+	})()))));
+	{
+		bool __need_loop_40 = true;
+		// k : int&
+		das_iterator<TArray<int32_t>> __k_iterator((_temp_make_local_40_15_192 = (_Func_0x60_sorted_keys_3f40cecf6258f722(__context__,das_arg<TTable<int32_t,void>>::pass(__ttt_rename_at_39)))));
+		int32_t * __k_rename_at_40;
+		__need_loop_40 = __k_iterator.first(__context__,(__k_rename_at_40)) && __need_loop_40;
+		// i : int&
+		das_iterator<TArray<int32_t>> __i_iterator((_temp_make_local_40_32_224 = (_Funcbuiltin_0x60_to_array_move_54f9a4ebca1fe3c1(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+			_temp_make_local_40_32_256(0,__context__) = 1;
+			_temp_make_local_40_32_256(1,__context__) = 2;
+			_temp_make_local_40_32_256(2,__context__) = 3;
+			_temp_make_local_40_32_256(3,__context__) = 4;
+			return _temp_make_local_40_32_256;
+		})()))))));
+		int32_t * __i_rename_at_40;
+		__need_loop_40 = __i_iterator.first(__context__,(__i_rename_at_40)) && __need_loop_40;
+		for ( ; __need_loop_40 ; __need_loop_40 = __k_iterator.next(__context__,(__k_rename_at_40)) && __i_iterator.next(__context__,(__i_rename_at_40)) )
+		{
+			DAS_ASSERT(((*__k_rename_at_40) == (*__i_rename_at_40)));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_40));
+		__i_iterator.close(__context__,(__i_rename_at_40));
+	};
+	TTable<int32_t,void> __qqq_rename_at_42; das_zero(__qqq_rename_at_42); das_move(__qqq_rename_at_42, _Funcbuiltin_0x60_to_table_3f3328d93e964b26(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_42_24_240(0,__context__) = 1;
+		_temp_make_local_42_24_240(1,__context__) = 2;
+		_temp_make_local_42_24_240(2,__context__) = 3;
+		_temp_make_local_42_24_240(3,__context__) = 4;
+		return _temp_make_local_42_24_240;
+	})()))));
+	{
+		bool __need_loop_43 = true;
+		// k : int&
+		das_iterator<TArray<int32_t>> __k_iterator((_temp_make_local_43_15_256 = (_Func_0x60_sorted_keys_3f40cecf6258f722(__context__,das_arg<TTable<int32_t,void>>::pass(__qqq_rename_at_42)))));
+		int32_t * __k_rename_at_43;
+		__need_loop_43 = __k_iterator.first(__context__,(__k_rename_at_43)) && __need_loop_43;
+		// i : int&
+		das_iterator<TArray<int32_t>> __i_iterator((_temp_make_local_43_32_288 = (_Funcbuiltin_0x60_to_array_move_54f9a4ebca1fe3c1(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+			_temp_make_local_43_32_320(0,__context__) = 1;
+			_temp_make_local_43_32_320(1,__context__) = 2;
+			_temp_make_local_43_32_320(2,__context__) = 3;
+			_temp_make_local_43_32_320(3,__context__) = 4;
+			return _temp_make_local_43_32_320;
+		})()))))));
+		int32_t * __i_rename_at_43;
+		__need_loop_43 = __i_iterator.first(__context__,(__i_rename_at_43)) && __need_loop_43;
+		for ( ; __need_loop_43 ; __need_loop_43 = __k_iterator.next(__context__,(__k_rename_at_43)) && __i_iterator.next(__context__,(__i_rename_at_43)) )
+		{
+			DAS_ASSERT(((*__k_rename_at_43) == (*__i_rename_at_43)));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_43));
+		__i_iterator.close(__context__,(__i_rename_at_43));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_clone_6c49f7c5af61778f
+	aotLib[0x98295398bbe80026] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,void> & , TTable<int32_t,void> const  &  ),&_Funcbuiltin_0x60_clone_6c49f7c5af61778f>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd
+	aotLib[0x66e322246598e835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<int32_t> & (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd>>();
+	};
+	// _Funcbuiltin_0x60_clone_to_move_63c68afdd4582c42
+	aotLib[0xad92c8d6612ec769] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<int32_t,void> (*) ( Context * __context__, TTable<int32_t,void> const  &  ),&_Funcbuiltin_0x60_clone_to_move_63c68afdd4582c42>>();
+	};
+	// _Funcbuiltin_0x60_keys_9203c68f7d4aaffb
+	aotLib[0x5ba981df7b0e9289] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TTable<int32_t,void> const  &  ),&_Funcbuiltin_0x60_keys_9203c68f7d4aaffb>>();
+	};
+	// _Funcbuiltin_0x60_sort_4732ebdcad990f07
+	aotLib[0xbd9e102c769f911d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_sort_4732ebdcad990f07>>();
+	};
+	// _Funcbuiltin_0x60_to_table_move_b60f18452fffcf8d
+	aotLib[0xcd032370c14db3f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<int32_t,void> (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Funcbuiltin_0x60_to_table_move_b60f18452fffcf8d>>();
+	};
+	// _Funcbuiltin_0x60_insert_2267db139e0df384
+	aotLib[0x93cab9dd1aa881fd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,void> & , int32_t  ),&_Funcbuiltin_0x60_insert_2267db139e0df384>>();
+	};
+	// _Func_0x60_sorted_keys_3f40cecf6258f722
+	aotLib[0x385aced0c75ee514] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TTable<int32_t,void> const  &  ),&_Func_0x60_sorted_keys_3f40cecf6258f722>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_f9adbdca370c7b15
+	aotLib[0xc186aedfb6d4be05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,3> &  ),&_Funcbuiltin_0x60_to_array_move_f9adbdca370c7b15>>();
+	};
+	// _Funcbuiltin_0x60_erase_f068f7f6b908bb11
+	aotLib[0xd98148c9f29f65ed] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,void> & , int32_t  ),&_Funcbuiltin_0x60_erase_f068f7f6b908bb11>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_4a0c453305a7dd5
+	aotLib[0xc571c6f94ed2c5f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,2> &  ),&_Funcbuiltin_0x60_to_array_move_4a0c453305a7dd5>>();
+	};
+	// _Funcbuiltin_0x60_key_exists_521e4bee16959b33
+	aotLib[0x16a7b6981733368d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TTable<int32_t,void> const  & , int32_t  ),&_Funcbuiltin_0x60_key_exists_521e4bee16959b33>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_54f9a4ebca1fe3c1
+	aotLib[0x3970d3262606058d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_54f9a4ebca1fe3c1>>();
+	};
+	// _Funcbuiltin_0x60_to_table_3f3328d93e964b26
+	aotLib[0xdad1a32f8237b865] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<int32_t,void> (*) ( Context * __context__, TDim<int32_t,4> const  &  ),&_Funcbuiltin_0x60_to_table_3f3328d93e964b26>>();
+	};
+	// test_289331a427b5d222
+	aotLib[0x1488e5be04120887] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_289331a427b5d222>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,165 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_17930604979603846189 {
+
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63ee4c86020b22;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__502b91db33cef49e;
+extern FuncInfo __func_info__5ba33848727f7e86;
+
+VarInfo __func_info__5ba33848727f7e86_field_0 =  { Type::tTable, nullptr, nullptr, nullptr, &__type_info__af63ee4c86020b22, &__type_info__af63e44c8601fa24, nullptr, nullptr, 0, 0, nullptr, 57442, 48, UINT64_C(0x502b91db33cef49e), "foo", 0 };
+VarInfo * __func_info__5ba33848727f7e86_fields[1] =  { &__func_info__5ba33848727f7e86_field_0 };
+FuncInfo __func_info__5ba33848727f7e86 = {"invoke block<(foo:table<string;int> const#):void> const", "", __func_info__5ba33848727f7e86_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x5ba33848727f7e86), 0x0 };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63ee4c86020b22 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16388, 8, UINT64_C(0xaf63ee4c86020b22) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+
+inline int32_t const  * _Funcbuiltin_0x60_find_cb0014d7064d046d ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_258, char * const  __at_rename_at_258 );
+inline void _Funcbuiltin_0x60_lock_6f9a904c7ea7ebe6 ( Context * __context__, TTable<char *,int32_t> const  & __Tab_rename_at_411, Block DAS_COMMENT((void,TTable<char *,int32_t> const )) const  & __blk_rename_at_411 );
+inline bool test_ace34a8a15fa566d ( Context * __context__ );
+inline TTable<char *,int32_t> _Funcbuiltin_0x60_to_table_move_d4e2568a5fc88cd5 ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> & __a_rename_at_564 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+	TDim<TTuple<16,char *,int32_t>,2> _temp_make_local_2_13_32;
+	if ( __init_shared ) das_shared<TTable<char *,int32_t>,0xc825345e695bdf5f>(__context__) = _Funcbuiltin_0x60_to_table_move_d4e2568a5fc88cd5(__context__,das_arg<TDim<TTuple<16,char *,int32_t>,2>>::pass((([&]() -> TDim<TTuple<16,char *,int32_t>,2>& {
+		_temp_make_local_2_13_32(0,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_2;
+			das_get_tuple_field<char *,0>::get(__mkt_2) = ((char *) "one");
+			das_get_tuple_field<int32_t,8>::get(__mkt_2) = 1;
+			return __mkt_2;
+		})());
+		_temp_make_local_2_13_32(1,__context__) = (([&]() -> TTuple<16,char *,int32_t> {
+			TTuple<16,char *,int32_t> __mkt_2;
+			das_get_tuple_field<char *,0>::get(__mkt_2) = ((char *) "two");
+			das_get_tuple_field<int32_t,8>::get(__mkt_2) = 2;
+			return __mkt_2;
+		})());
+		return _temp_make_local_2_13_32;
+	})())));/*g_foo*/
+}
+
+inline int32_t const  * _Funcbuiltin_0x60_find_cb0014d7064d046d ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_258, char * const  __at_rename_at_258 )
+{
+	return das_auto_cast<int32_t const  *>::cast(das_cast<int32_t const  *>::cast(__builtin_table_find(__context__,__Tab_rename_at_258,__at_rename_at_258)));
+}
+
+inline void _Funcbuiltin_0x60_lock_6f9a904c7ea7ebe6 ( Context * __context__, TTable<char *,int32_t> const  &  __Tab_rename_at_411, Block DAS_COMMENT((void,TTable<char *,int32_t> const )) const  &  __blk_rename_at_411 )
+{
+	builtin_table_lock(__Tab_rename_at_411,__context__);
+	das_invoke<void>::invoke<TTable<char *,int32_t> const  &>(__context__,nullptr,__blk_rename_at_411,das_cast<TTable<char *,int32_t> const >::cast(__Tab_rename_at_411));
+	builtin_table_unlock(__Tab_rename_at_411,__context__);
+}
+
+inline bool test_ace34a8a15fa566d ( Context * __context__ ) { das_stack_prologue __prologue(__context__,96,"test " DAS_FILE_LINE);
+{
+	_Funcbuiltin_0x60_lock_6f9a904c7ea7ebe6(__context__,das_shared<TTable<char *,int32_t>,0xc825345e695bdf5f>(__context__) /*g_foo*/,das_make_block<void,TTable<char *,int32_t> const  &>(__context__,80,0,&__func_info__5ba33848727f7e86,[&](TTable<char *,int32_t> const  & __foo_rename_at_6) -> void{
+		DAS_ASSERT((das_null_coalescing<int32_t>::get(_Funcbuiltin_0x60_find_cb0014d7064d046d(__context__,__foo_rename_at_6,((char *) "one")),0) == 1));
+		DAS_ASSERT((das_null_coalescing<int32_t>::get(_Funcbuiltin_0x60_find_cb0014d7064d046d(__context__,__foo_rename_at_6,((char *) "two")),0) == 2));
+		DAS_ASSERT((das_null_coalescing<int32_t>::get(_Funcbuiltin_0x60_find_cb0014d7064d046d(__context__,__foo_rename_at_6,((char *) "three")),0) == 0));
+	}));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+inline TTable<char *,int32_t> _Funcbuiltin_0x60_to_table_move_d4e2568a5fc88cd5 ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> &  __a_rename_at_564 )
+{
+	TTable<char *,int32_t> __tab_rename_at_565; das_zero(__tab_rename_at_565);
+	{
+		bool __need_loop_567 = true;
+		// x : tuple<string aka keyT;int aka valT>&
+		das_iterator<TDim<TTuple<16,char *,int32_t>,2>> __x_iterator(__a_rename_at_564);
+		TTuple<16,char *,int32_t> * __x_rename_at_567;
+		__need_loop_567 = __x_iterator.first(__context__,(__x_rename_at_567)) && __need_loop_567;
+		for ( ; __need_loop_567 ; __need_loop_567 = __x_iterator.next(__context__,(__x_rename_at_567)) )
+		{
+			das_copy(__tab_rename_at_565(das_get_tuple_field<char *,0>::get((*__x_rename_at_567)),__context__),das_get_tuple_field<int32_t,8>::get((*__x_rename_at_567)));
+		}
+		__x_iterator.close(__context__,(__x_rename_at_567));
+	};
+	return /* <- */ das_auto_cast_move<TTable<char *,int32_t>>::cast(__tab_rename_at_565);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_find_cb0014d7064d046d
+	aotLib[0xe6054bdc9b7f9865] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t const  * (*) ( Context * __context__, TTable<char *,int32_t> const  & , char * const   ),&_Funcbuiltin_0x60_find_cb0014d7064d046d>>();
+	};
+	// _Funcbuiltin_0x60_lock_6f9a904c7ea7ebe6
+	aotLib[0xd1419f3f2b8c5079] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<char *,int32_t> const  & , Block DAS_COMMENT((void,TTable<char *,int32_t> const )) const  &  ),&_Funcbuiltin_0x60_lock_6f9a904c7ea7ebe6>>();
+	};
+	// test_ace34a8a15fa566d
+	aotLib[0xe73208044f9586ee] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_ace34a8a15fa566d>>();
+	};
+	// _Funcbuiltin_0x60_to_table_move_d4e2568a5fc88cd5
+	aotLib[0xe70dcdfa92f52ee9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TTable<char *,int32_t> (*) ( Context * __context__, TDim<TTuple<16,char *,int32_t>,2> &  ),&_Funcbuiltin_0x60_to_table_move_d4e2568a5fc88cd5>>();
+	};
+	// [[ init script ]]
+	aotLib[0x237d534fdcaa7db] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*)(Context *, bool),&__init_script>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,1181 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_7006464871169573512 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace  { struct Foo; };
+namespace  {
+
+struct Foo {
+	int32_t x;
+	int32_t y;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Foo,y)==4,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_sort_4732ebdcad990f07 ( Context * __context__, TArray<int32_t> & __a_rename_at_594 );
+inline void _Funcbuiltin_0x60_sort_e577240fb029e3d2 ( Context * __context__, TArray<uint32_t> & __a_rename_at_594 );
+inline void _Funcbuiltin_0x60_sort_41715831ae7f1315 ( Context * __context__, TArray<int64_t> & __a_rename_at_594 );
+inline void _Funcbuiltin_0x60_sort_7c9a8c217ad5bb18 ( Context * __context__, TArray<uint64_t> & __a_rename_at_594 );
+inline void _Funcbuiltin_0x60_sort_b62e086287e4e9ac ( Context * __context__, TArray<float> & __a_rename_at_594 );
+inline void _Funcbuiltin_0x60_sort_a351332315ffdad7 ( Context * __context__, TArray<double> & __a_rename_at_594 );
+inline void _Funcbuiltin_0x60_sort_ff406c5ab603b771 ( Context * __context__, TArray<char *> & __a_rename_at_594 );
+inline void _Funcbuiltin_0x60_sort_67424656e829030e ( Context * __context__, TArray<Foo> & __a_rename_at_594 );
+inline void _Funcbuiltin_0x60_sort_5de58d1eb04c83e3 ( Context * __context__, TDim<int32_t,4> & __a_rename_at_576 );
+inline void _Funcbuiltin_0x60_sort_fe3388df434e572c ( Context * __context__, TDim<uint32_t,4> & __a_rename_at_576 );
+inline void _Funcbuiltin_0x60_sort_2284b0bf8fa51c75 ( Context * __context__, TDim<int64_t,4> & __a_rename_at_576 );
+inline void _Funcbuiltin_0x60_sort_321a87dafe5eb0a2 ( Context * __context__, TDim<uint64_t,4> & __a_rename_at_576 );
+inline void _Funcbuiltin_0x60_sort_20b4d52a5594ef8 ( Context * __context__, TDim<float,4> & __a_rename_at_576 );
+inline void _Funcbuiltin_0x60_sort_5e5b973bd52198d5 ( Context * __context__, TDim<double,4> & __a_rename_at_576 );
+inline void _Funcbuiltin_0x60_sort_efbd6153351590ed ( Context * __context__, TDim<char *,4> & __a_rename_at_576 );
+inline void _Funcbuiltin_0x60_sort_29fe750c208866cf ( Context * __context__, TDim<Foo,4> & __a_rename_at_576 );
+inline void _Func_0x60_test_sort_9bfd72e67b55af74 ( Context * __context__, TArray<int32_t> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_49cb210d58ee1c70 ( Context * __context__, TArray<uint32_t> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_bcc890138b35cb26 ( Context * __context__, TArray<int64_t> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_d51764b727a45406 ( Context * __context__, TArray<uint64_t> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_8131367e9c2f5a1 ( Context * __context__, TArray<float> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_68576acf01622dd1 ( Context * __context__, TArray<double> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_a39499a713a2a6d4 ( Context * __context__, TArray<char *> & __arr_rename_at_1 );
+inline void _Func_0x60_test_sort_6bcb6b7d5700cf53 ( Context * __context__, TArray<Foo> & __arr_rename_at_1 );
+inline void _Funcbuiltin_0x60_push_6c25697422f5e150 ( Context * __context__, TArray<float2> & __Arr_rename_at_75, float2 __value_rename_at_75 );
+inline void _Func_0x60_test_sort_comp_d8ee93a26582c6f9 ( Context * __context__, TArray<float2> & __arr_rename_at_10 );
+inline void _Func_0x60_test_sort_f516e845bec8da1 ( Context * __context__, TDim<int32_t,4> & __arr_rename_at_1 );
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_54f9a4ebca1fe3c1 ( Context * __context__, TDim<int32_t,4> & __a_rename_at_517 );
+inline void _Func_0x60_test_sort_6a9d5a88e18b98b3 ( Context * __context__, TDim<uint32_t,4> & __arr_rename_at_1 );
+inline TArray<uint32_t> _Funcbuiltin_0x60_to_array_move_92528fa94d98ce41 ( Context * __context__, TDim<uint32_t,4> & __a_rename_at_517 );
+inline void _Func_0x60_test_sort_8b2e5c3cf444fdb7 ( Context * __context__, TDim<int64_t,4> & __arr_rename_at_1 );
+inline TArray<int64_t> _Funcbuiltin_0x60_to_array_move_c99dd1a0e3290bbd ( Context * __context__, TDim<int64_t,4> & __a_rename_at_517 );
+inline void _Func_0x60_test_sort_f6be85e48ba8a845 ( Context * __context__, TDim<uint64_t,4> & __arr_rename_at_1 );
+inline TArray<uint64_t> _Funcbuiltin_0x60_to_array_move_1568bc758a054449 ( Context * __context__, TDim<uint64_t,4> & __a_rename_at_517 );
+inline void _Func_0x60_test_sort_28e87ed56f7f3aae ( Context * __context__, TDim<float,4> & __arr_rename_at_1 );
+inline TArray<float> _Funcbuiltin_0x60_to_array_move_d8cb1569aa332b19 ( Context * __context__, TDim<float,4> & __a_rename_at_517 );
+inline void _Func_0x60_test_sort_39d7b101d97e8d68 ( Context * __context__, TDim<double,4> & __arr_rename_at_1 );
+inline TArray<double> _Funcbuiltin_0x60_to_array_move_d8d2acf7e6ad0537 ( Context * __context__, TDim<double,4> & __a_rename_at_517 );
+inline void _Func_0x60_test_sort_7a20318454d4a5e5 ( Context * __context__, TDim<char *,4> & __arr_rename_at_1 );
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_5a483bf23c771f8b ( Context * __context__, TDim<char *,4> & __a_rename_at_517 );
+inline void _Func_0x60_test_sort_543ce0c280736484 ( Context * __context__, TDim<Foo,4> & __arr_rename_at_1 );
+inline TArray<Foo> _Funcbuiltin_0x60_to_array_move_ab97a8b83f2e7065 ( Context * __context__, TDim<Foo,4> & __a_rename_at_517 );
+inline bool _FuncLess_b668e86487895147 ( Context * __context__, Foo const  & __a_rename_at_20, Foo const  & __b_rename_at_20 );
+inline void test_vector_sort_74cc0281ce3a8534 ( Context * __context__ );
+inline bool test_fe5eb714fee9ce39 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_sort_4732ebdcad990f07 ( Context * __context__, TArray<int32_t> &  __a_rename_at_594 )
+{
+	builtin_array_lock(das_arg<TArray<int32_t>>::pass(__a_rename_at_594),__context__);
+	builtin_sort<int32_t>(das_ref(__context__,__a_rename_at_594(0,__context__)),builtin_array_size(das_arg<TArray<int32_t>>::pass(__a_rename_at_594)));
+	builtin_array_unlock(das_arg<TArray<int32_t>>::pass(__a_rename_at_594),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_e577240fb029e3d2 ( Context * __context__, TArray<uint32_t> &  __a_rename_at_594 )
+{
+	builtin_array_lock(das_arg<TArray<uint32_t>>::pass(__a_rename_at_594),__context__);
+	builtin_sort<uint32_t>(das_ref(__context__,__a_rename_at_594(0,__context__)),builtin_array_size(das_arg<TArray<uint32_t>>::pass(__a_rename_at_594)));
+	builtin_array_unlock(das_arg<TArray<uint32_t>>::pass(__a_rename_at_594),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_41715831ae7f1315 ( Context * __context__, TArray<int64_t> &  __a_rename_at_594 )
+{
+	builtin_array_lock(das_arg<TArray<int64_t>>::pass(__a_rename_at_594),__context__);
+	builtin_sort<int64_t>(das_ref(__context__,__a_rename_at_594(0,__context__)),builtin_array_size(das_arg<TArray<int64_t>>::pass(__a_rename_at_594)));
+	builtin_array_unlock(das_arg<TArray<int64_t>>::pass(__a_rename_at_594),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_7c9a8c217ad5bb18 ( Context * __context__, TArray<uint64_t> &  __a_rename_at_594 )
+{
+	builtin_array_lock(das_arg<TArray<uint64_t>>::pass(__a_rename_at_594),__context__);
+	builtin_sort<uint64_t>(das_ref(__context__,__a_rename_at_594(0,__context__)),builtin_array_size(das_arg<TArray<uint64_t>>::pass(__a_rename_at_594)));
+	builtin_array_unlock(das_arg<TArray<uint64_t>>::pass(__a_rename_at_594),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_b62e086287e4e9ac ( Context * __context__, TArray<float> &  __a_rename_at_594 )
+{
+	builtin_array_lock(das_arg<TArray<float>>::pass(__a_rename_at_594),__context__);
+	builtin_sort<float>(das_ref(__context__,__a_rename_at_594(0,__context__)),builtin_array_size(das_arg<TArray<float>>::pass(__a_rename_at_594)));
+	builtin_array_unlock(das_arg<TArray<float>>::pass(__a_rename_at_594),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_a351332315ffdad7 ( Context * __context__, TArray<double> &  __a_rename_at_594 )
+{
+	builtin_array_lock(das_arg<TArray<double>>::pass(__a_rename_at_594),__context__);
+	builtin_sort<double>(das_ref(__context__,__a_rename_at_594(0,__context__)),builtin_array_size(das_arg<TArray<double>>::pass(__a_rename_at_594)));
+	builtin_array_unlock(das_arg<TArray<double>>::pass(__a_rename_at_594),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_ff406c5ab603b771 ( Context * __context__, TArray<char *> &  __a_rename_at_594 )
+{
+	builtin_array_lock(das_arg<TArray<char *>>::pass(__a_rename_at_594),__context__);
+	builtin_sort_string(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_594(0,__context__))),builtin_array_size(das_arg<TArray<char *>>::pass(__a_rename_at_594)));
+	builtin_array_unlock(das_arg<TArray<char *>>::pass(__a_rename_at_594),__context__);
+}
+
+inline void _Funcbuiltin_0x60_sort_67424656e829030e ( Context * __context__, TArray<Foo> &  __a_rename_at_594 )
+{
+	builtin_sort_array_any_cblock_T(das_arg<TArray<Foo>>::pass(__a_rename_at_594),8,builtin_array_size(das_arg<TArray<Foo>>::pass(__a_rename_at_594)),[&](Foo const  & __x_rename_at_610, Foo const  & __y_rename_at_610) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(_FuncLess_b668e86487895147(__context__,__x_rename_at_610,__y_rename_at_610));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Funcbuiltin_0x60_sort_5de58d1eb04c83e3 ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_576 )
+{
+	builtin_sort<int32_t>(das_ref(__context__,__a_rename_at_576(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_fe3388df434e572c ( Context * __context__, TDim<uint32_t,4> &  __a_rename_at_576 )
+{
+	builtin_sort<uint32_t>(das_ref(__context__,__a_rename_at_576(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_2284b0bf8fa51c75 ( Context * __context__, TDim<int64_t,4> &  __a_rename_at_576 )
+{
+	builtin_sort<int64_t>(das_ref(__context__,__a_rename_at_576(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_321a87dafe5eb0a2 ( Context * __context__, TDim<uint64_t,4> &  __a_rename_at_576 )
+{
+	builtin_sort<uint64_t>(das_ref(__context__,__a_rename_at_576(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_20b4d52a5594ef8 ( Context * __context__, TDim<float,4> &  __a_rename_at_576 )
+{
+	builtin_sort<float>(das_ref(__context__,__a_rename_at_576(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_5e5b973bd52198d5 ( Context * __context__, TDim<double,4> &  __a_rename_at_576 )
+{
+	builtin_sort<double>(das_ref(__context__,__a_rename_at_576(0,__context__)),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_efbd6153351590ed ( Context * __context__, TDim<char *,4> &  __a_rename_at_576 )
+{
+	builtin_sort_string(das_auto_cast<void * const >::cast(das_ref(__context__,__a_rename_at_576(0,__context__))),4);
+}
+
+inline void _Funcbuiltin_0x60_sort_29fe750c208866cf ( Context * __context__, TDim<Foo,4> &  __a_rename_at_576 )
+{
+	builtin_sort_dim_any_cblock_T(das_arg<TDim<Foo,4>>::pass(__a_rename_at_576),8,4,[&](Foo const  & __x_rename_at_588, Foo const  & __y_rename_at_588) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(_FuncLess_b668e86487895147(__context__,__x_rename_at_588,__y_rename_at_588));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_0x60_test_sort_9bfd72e67b55af74 ( Context * __context__, TArray<int32_t> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_4732ebdcad990f07(__context__,das_arg<TArray<int32_t>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<int32_t>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_array_any_ref_cblock_T(das_arg<TArray<int32_t>>::pass(__arr_rename_at_1),4,0,[&](int32_t const  __a_rename_at_6, int32_t const  __b_rename_at_6) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline void _Func_0x60_test_sort_49cb210d58ee1c70 ( Context * __context__, TArray<uint32_t> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_e577240fb029e3d2(__context__,das_arg<TArray<uint32_t>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<uint32_t>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_array_any_ref_cblock_T(das_arg<TArray<uint32_t>>::pass(__arr_rename_at_1),4,0,[&](uint32_t const  __a_rename_at_6, uint32_t const  __b_rename_at_6) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline void _Func_0x60_test_sort_bcc890138b35cb26 ( Context * __context__, TArray<int64_t> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_41715831ae7f1315(__context__,das_arg<TArray<int64_t>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<int64_t>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_array_any_ref_cblock_T(das_arg<TArray<int64_t>>::pass(__arr_rename_at_1),8,0,[&](int64_t const  __a_rename_at_6, int64_t const  __b_rename_at_6) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline void _Func_0x60_test_sort_d51764b727a45406 ( Context * __context__, TArray<uint64_t> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_7c9a8c217ad5bb18(__context__,das_arg<TArray<uint64_t>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<uint64_t>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_array_any_ref_cblock_T(das_arg<TArray<uint64_t>>::pass(__arr_rename_at_1),8,0,[&](uint64_t const  __a_rename_at_6, uint64_t const  __b_rename_at_6) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline void _Func_0x60_test_sort_8131367e9c2f5a1 ( Context * __context__, TArray<float> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_b62e086287e4e9ac(__context__,das_arg<TArray<float>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<float>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_array_any_ref_cblock_T(das_arg<TArray<float>>::pass(__arr_rename_at_1),4,0,[&](float const  __a_rename_at_6, float const  __b_rename_at_6) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline void _Func_0x60_test_sort_68576acf01622dd1 ( Context * __context__, TArray<double> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_a351332315ffdad7(__context__,das_arg<TArray<double>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<double>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_array_any_ref_cblock_T(das_arg<TArray<double>>::pass(__arr_rename_at_1),8,0,[&](double const  __a_rename_at_6, double const  __b_rename_at_6) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline void _Func_0x60_test_sort_a39499a713a2a6d4 ( Context * __context__, TArray<char *> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_ff406c5ab603b771(__context__,das_arg<TArray<char *>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<char *>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_1((__i_rename_at_4 - 1),__context__)),cast<char *>::from(__arr_rename_at_1(__i_rename_at_4,__context__)),*__context__,nullptr)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_array_any_ref_cblock_T(das_arg<TArray<char *>>::pass(__arr_rename_at_1),8,0,[&](char * const  __a_rename_at_6, char * const  __b_rename_at_6) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(!(SimPolicy<char *>::Less(cast<char *>::from(__a_rename_at_6),cast<char *>::from(__b_rename_at_6),*__context__,nullptr)));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_1((__i_rename_at_7 - 1),__context__)),cast<char *>::from(__arr_rename_at_1(__i_rename_at_7,__context__)),*__context__,nullptr))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline void _Func_0x60_test_sort_6bcb6b7d5700cf53 ( Context * __context__, TArray<Foo> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_67424656e829030e(__context__,das_arg<TArray<Foo>>::pass(__arr_rename_at_1));
+	int32_t __len_rename_at_3 = ((int32_t)builtin_array_size(das_arg<TArray<Foo>>::pass(__arr_rename_at_1)));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((_FuncLess_b668e86487895147(__context__,das_arg<Foo>::pass(__arr_rename_at_1((__i_rename_at_4 - 1),__context__)),das_arg<Foo>::pass(__arr_rename_at_1(__i_rename_at_4,__context__)))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_array_any_cblock_T(das_arg<TArray<Foo>>::pass(__arr_rename_at_1),8,0,[&](Foo const  & __a_rename_at_6, Foo const  & __b_rename_at_6) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(!(_FuncLess_b668e86487895147(__context__,__a_rename_at_6,__b_rename_at_6)));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_3));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(_FuncLess_b668e86487895147(__context__,das_arg<Foo>::pass(__arr_rename_at_1((__i_rename_at_7 - 1),__context__)),das_arg<Foo>::pass(__arr_rename_at_1(__i_rename_at_7,__context__))))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline void _Funcbuiltin_0x60_push_6c25697422f5e150 ( Context * __context__, TArray<float2> &  __Arr_rename_at_75, float2 __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<float2>>::pass(__Arr_rename_at_75),8,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Func_0x60_test_sort_comp_d8ee93a26582c6f9 ( Context * __context__, TArray<float2> &  __arr_rename_at_10 )
+{
+	int32_t __len_rename_at_11 = ((int32_t)builtin_array_size(das_arg<TArray<float2>>::pass(__arr_rename_at_10)));
+	builtin_sort_array_any_ref_cblock_T(das_arg<TArray<float2>>::pass(__arr_rename_at_10),8,0,[&](float2 __a_rename_at_12, float2 __b_rename_at_12) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(v_extract_x(__a_rename_at_12) /*x*/ < v_extract_x(__b_rename_at_12) /*x*/);
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_14 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,__len_rename_at_11));
+		int32_t __i_rename_at_14;
+		__need_loop_14 = __i_iterator.first(__context__,(__i_rename_at_14)) && __need_loop_14;
+		for ( ; __need_loop_14 ; __need_loop_14 = __i_iterator.next(__context__,(__i_rename_at_14)) )
+		{
+			DAS_ASSERT((v_extract_x(__arr_rename_at_10((__i_rename_at_14 - 1),__context__)) /*x*/ < v_extract_x(__arr_rename_at_10(__i_rename_at_14,__context__)) /*x*/));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_14));
+	};
+}
+
+inline void _Func_0x60_test_sort_f516e845bec8da1 ( Context * __context__, TDim<int32_t,4> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_5de58d1eb04c83e3(__context__,das_arg<TDim<int32_t,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<int32_t,4>>::pass(__arr_rename_at_1),4,4,[&](int32_t const  __a_rename_at_6, int32_t const  __b_rename_at_6) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline TArray<int32_t> _Funcbuiltin_0x60_to_array_move_54f9a4ebca1fe3c1 ( Context * __context__, TDim<int32_t,4> &  __a_rename_at_517 )
+{
+	TArray<int32_t> __arr_rename_at_518; das_zero(__arr_rename_at_518);
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__arr_rename_at_518),4,4,__context__);
+	das_copy(das_cast<TDim<int32_t,4>>::cast(das_ref(__context__,__arr_rename_at_518(0,__context__))),__a_rename_at_517);
+	return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(__arr_rename_at_518);
+}
+
+inline void _Func_0x60_test_sort_6a9d5a88e18b98b3 ( Context * __context__, TDim<uint32_t,4> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_fe3388df434e572c(__context__,das_arg<TDim<uint32_t,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<uint32_t,4>>::pass(__arr_rename_at_1),4,4,[&](uint32_t const  __a_rename_at_6, uint32_t const  __b_rename_at_6) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline TArray<uint32_t> _Funcbuiltin_0x60_to_array_move_92528fa94d98ce41 ( Context * __context__, TDim<uint32_t,4> &  __a_rename_at_517 )
+{
+	TArray<uint32_t> __arr_rename_at_518; das_zero(__arr_rename_at_518);
+	builtin_array_resize(das_arg<TArray<uint32_t>>::pass(__arr_rename_at_518),4,4,__context__);
+	das_copy(das_cast<TDim<uint32_t,4>>::cast(das_ref(__context__,__arr_rename_at_518(0,__context__))),__a_rename_at_517);
+	return /* <- */ das_auto_cast_move<TArray<uint32_t>>::cast(__arr_rename_at_518);
+}
+
+inline void _Func_0x60_test_sort_8b2e5c3cf444fdb7 ( Context * __context__, TDim<int64_t,4> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_2284b0bf8fa51c75(__context__,das_arg<TDim<int64_t,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<int64_t,4>>::pass(__arr_rename_at_1),8,4,[&](int64_t const  __a_rename_at_6, int64_t const  __b_rename_at_6) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline TArray<int64_t> _Funcbuiltin_0x60_to_array_move_c99dd1a0e3290bbd ( Context * __context__, TDim<int64_t,4> &  __a_rename_at_517 )
+{
+	TArray<int64_t> __arr_rename_at_518; das_zero(__arr_rename_at_518);
+	builtin_array_resize(das_arg<TArray<int64_t>>::pass(__arr_rename_at_518),4,8,__context__);
+	das_copy(das_cast<TDim<int64_t,4>>::cast(das_ref(__context__,__arr_rename_at_518(0,__context__))),__a_rename_at_517);
+	return /* <- */ das_auto_cast_move<TArray<int64_t>>::cast(__arr_rename_at_518);
+}
+
+inline void _Func_0x60_test_sort_f6be85e48ba8a845 ( Context * __context__, TDim<uint64_t,4> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_321a87dafe5eb0a2(__context__,das_arg<TDim<uint64_t,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<uint64_t,4>>::pass(__arr_rename_at_1),8,4,[&](uint64_t const  __a_rename_at_6, uint64_t const  __b_rename_at_6) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline TArray<uint64_t> _Funcbuiltin_0x60_to_array_move_1568bc758a054449 ( Context * __context__, TDim<uint64_t,4> &  __a_rename_at_517 )
+{
+	TArray<uint64_t> __arr_rename_at_518; das_zero(__arr_rename_at_518);
+	builtin_array_resize(das_arg<TArray<uint64_t>>::pass(__arr_rename_at_518),4,8,__context__);
+	das_copy(das_cast<TDim<uint64_t,4>>::cast(das_ref(__context__,__arr_rename_at_518(0,__context__))),__a_rename_at_517);
+	return /* <- */ das_auto_cast_move<TArray<uint64_t>>::cast(__arr_rename_at_518);
+}
+
+inline void _Func_0x60_test_sort_28e87ed56f7f3aae ( Context * __context__, TDim<float,4> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_20b4d52a5594ef8(__context__,das_arg<TDim<float,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<float,4>>::pass(__arr_rename_at_1),4,4,[&](float const  __a_rename_at_6, float const  __b_rename_at_6) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline TArray<float> _Funcbuiltin_0x60_to_array_move_d8cb1569aa332b19 ( Context * __context__, TDim<float,4> &  __a_rename_at_517 )
+{
+	TArray<float> __arr_rename_at_518; das_zero(__arr_rename_at_518);
+	builtin_array_resize(das_arg<TArray<float>>::pass(__arr_rename_at_518),4,4,__context__);
+	das_copy(das_cast<TDim<float,4>>::cast(das_ref(__context__,__arr_rename_at_518(0,__context__))),__a_rename_at_517);
+	return /* <- */ das_auto_cast_move<TArray<float>>::cast(__arr_rename_at_518);
+}
+
+inline void _Func_0x60_test_sort_39d7b101d97e8d68 ( Context * __context__, TDim<double,4> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_5e5b973bd52198d5(__context__,das_arg<TDim<double,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((__arr_rename_at_1((__i_rename_at_4 - 1),__context__) < __arr_rename_at_1(__i_rename_at_4,__context__)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<double,4>>::pass(__arr_rename_at_1),8,4,[&](double const  __a_rename_at_6, double const  __b_rename_at_6) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(!(__a_rename_at_6 < __b_rename_at_6));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(__arr_rename_at_1((__i_rename_at_7 - 1),__context__) < __arr_rename_at_1(__i_rename_at_7,__context__))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline TArray<double> _Funcbuiltin_0x60_to_array_move_d8d2acf7e6ad0537 ( Context * __context__, TDim<double,4> &  __a_rename_at_517 )
+{
+	TArray<double> __arr_rename_at_518; das_zero(__arr_rename_at_518);
+	builtin_array_resize(das_arg<TArray<double>>::pass(__arr_rename_at_518),4,8,__context__);
+	das_copy(das_cast<TDim<double,4>>::cast(das_ref(__context__,__arr_rename_at_518(0,__context__))),__a_rename_at_517);
+	return /* <- */ das_auto_cast_move<TArray<double>>::cast(__arr_rename_at_518);
+}
+
+inline void _Func_0x60_test_sort_7a20318454d4a5e5 ( Context * __context__, TDim<char *,4> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_efbd6153351590ed(__context__,das_arg<TDim<char *,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_1((__i_rename_at_4 - 1),__context__)),cast<char *>::from(__arr_rename_at_1(__i_rename_at_4,__context__)),*__context__,nullptr)));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_dim_any_ref_cblock_T(das_arg<TDim<char *,4>>::pass(__arr_rename_at_1),8,4,[&](char * const  __a_rename_at_6, char * const  __b_rename_at_6) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(!(SimPolicy<char *>::Less(cast<char *>::from(__a_rename_at_6),cast<char *>::from(__b_rename_at_6),*__context__,nullptr)));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(SimPolicy<char *>::Less(cast<char *>::from(__arr_rename_at_1((__i_rename_at_7 - 1),__context__)),cast<char *>::from(__arr_rename_at_1(__i_rename_at_7,__context__)),*__context__,nullptr))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline TArray<char *> _Funcbuiltin_0x60_to_array_move_5a483bf23c771f8b ( Context * __context__, TDim<char *,4> &  __a_rename_at_517 )
+{
+	TArray<char *> __arr_rename_at_518; das_zero(__arr_rename_at_518);
+	builtin_array_resize(das_arg<TArray<char *>>::pass(__arr_rename_at_518),4,8,__context__);
+	das_copy(das_cast<TDim<char *,4>>::cast(das_ref(__context__,__arr_rename_at_518(0,__context__))),__a_rename_at_517);
+	return /* <- */ das_auto_cast_move<TArray<char *>>::cast(__arr_rename_at_518);
+}
+
+inline void _Func_0x60_test_sort_543ce0c280736484 ( Context * __context__, TDim<Foo,4> &  __arr_rename_at_1 )
+{
+	_Funcbuiltin_0x60_sort_29fe750c208866cf(__context__,das_arg<TDim<Foo,4>>::pass(__arr_rename_at_1));
+	{
+		bool __need_loop_4 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_4;
+		__need_loop_4 = __i_iterator.first(__context__,(__i_rename_at_4)) && __need_loop_4;
+		for ( ; __need_loop_4 ; __need_loop_4 = __i_iterator.next(__context__,(__i_rename_at_4)) )
+		{
+			DAS_ASSERT((_FuncLess_b668e86487895147(__context__,das_arg<Foo>::pass(__arr_rename_at_1((__i_rename_at_4 - 1),__context__)),das_arg<Foo>::pass(__arr_rename_at_1(__i_rename_at_4,__context__)))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_4));
+	};
+	builtin_sort_dim_any_cblock_T(das_arg<TDim<Foo,4>>::pass(__arr_rename_at_1),8,4,[&](Foo const  & __a_rename_at_6, Foo const  & __b_rename_at_6) DAS_AOT_INLINE_LAMBDA -> bool{
+		return das_auto_cast<bool>::cast(!(_FuncLess_b668e86487895147(__context__,__a_rename_at_6,__b_rename_at_6)));
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	{
+		bool __need_loop_7 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(1,4));
+		int32_t __i_rename_at_7;
+		__need_loop_7 = __i_iterator.first(__context__,(__i_rename_at_7)) && __need_loop_7;
+		for ( ; __need_loop_7 ; __need_loop_7 = __i_iterator.next(__context__,(__i_rename_at_7)) )
+		{
+			DAS_ASSERT((!(_FuncLess_b668e86487895147(__context__,das_arg<Foo>::pass(__arr_rename_at_1((__i_rename_at_7 - 1),__context__)),das_arg<Foo>::pass(__arr_rename_at_1(__i_rename_at_7,__context__))))));
+		}
+		__i_iterator.close(__context__,(__i_rename_at_7));
+	};
+}
+
+inline TArray<Foo> _Funcbuiltin_0x60_to_array_move_ab97a8b83f2e7065 ( Context * __context__, TDim<Foo,4> &  __a_rename_at_517 )
+{
+	TArray<Foo> __arr_rename_at_518; das_zero(__arr_rename_at_518);
+	builtin_array_resize(das_arg<TArray<Foo>>::pass(__arr_rename_at_518),4,8,__context__);
+	das_copy(das_cast<TDim<Foo,4>>::cast(das_ref(__context__,__arr_rename_at_518(0,__context__))),__a_rename_at_517);
+	return /* <- */ das_auto_cast_move<TArray<Foo>>::cast(__arr_rename_at_518);
+}
+
+inline bool _FuncLess_b668e86487895147 ( Context * __context__, Foo const  &  __a_rename_at_20, Foo const  &  __b_rename_at_20 )
+{
+	return das_auto_cast<bool>::cast((__a_rename_at_20.x + __a_rename_at_20.y) < (__b_rename_at_20.x + __b_rename_at_20.y));
+}
+
+inline void test_vector_sort_74cc0281ce3a8534 ( Context * __context__ )
+{
+	TArray<float2> __arr_rename_at_24; das_zero(__arr_rename_at_24);
+	_Funcbuiltin_0x60_push_6c25697422f5e150(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_24),v_make_vec4f(4.f,0.f,0.f,0.f));
+	_Funcbuiltin_0x60_push_6c25697422f5e150(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_24),v_make_vec4f(3.f,1.f,0.f,0.f));
+	_Funcbuiltin_0x60_push_6c25697422f5e150(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_24),v_make_vec4f(5.f,2.f,0.f,0.f));
+	_Func_0x60_test_sort_comp_d8ee93a26582c6f9(__context__,das_arg<TArray<float2>>::pass(__arr_rename_at_24));
+}
+
+inline bool test_fe5eb714fee9ce39 ( Context * __context__ )
+{
+	TDim<int32_t,4> _temp_make_local_33_16_32;
+	TArray<int32_t> _temp_make_local_34_16_32;
+	TDim<int32_t,4> _temp_make_local_34_16_64;
+	TDim<uint32_t,4> _temp_make_local_35_16_32;
+	TArray<uint32_t> _temp_make_local_36_16_32;
+	TDim<uint32_t,4> _temp_make_local_36_16_64;
+	TDim<int64_t,4> _temp_make_local_37_16_32;
+	TArray<int64_t> _temp_make_local_38_16_32;
+	TDim<int64_t,4> _temp_make_local_38_16_64;
+	TDim<uint64_t,4> _temp_make_local_39_16_32;
+	TArray<uint64_t> _temp_make_local_40_16_32;
+	TDim<uint64_t,4> _temp_make_local_40_16_64;
+	TDim<float,4> _temp_make_local_41_16_32;
+	TArray<float> _temp_make_local_42_16_32;
+	TDim<float,4> _temp_make_local_42_16_64;
+	TDim<double,4> _temp_make_local_43_16_32;
+	TArray<double> _temp_make_local_44_16_32;
+	TDim<double,4> _temp_make_local_44_16_64;
+	TDim<char *,4> _temp_make_local_46_16_32;
+	TArray<char *> _temp_make_local_47_16_32;
+	TDim<char *,4> _temp_make_local_47_16_64;
+	TDim<Foo,4> _temp_make_local_49_16_32;
+	TArray<Foo> _temp_make_local_50_16_32;
+	TDim<Foo,4> _temp_make_local_50_16_64;
+	_Func_0x60_test_sort_f516e845bec8da1(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_33_16_32(0,__context__) = 3;
+		_temp_make_local_33_16_32(1,__context__) = 2;
+		_temp_make_local_33_16_32(2,__context__) = 4;
+		_temp_make_local_33_16_32(3,__context__) = 1;
+		return _temp_make_local_33_16_32;
+	})())));
+	_Func_0x60_test_sort_9bfd72e67b55af74(__context__,das_arg<TArray<int32_t>>::pass((_temp_make_local_34_16_32 = (_Funcbuiltin_0x60_to_array_move_54f9a4ebca1fe3c1(__context__,das_arg<TDim<int32_t,4>>::pass((([&]() -> TDim<int32_t,4>& {
+		_temp_make_local_34_16_64(0,__context__) = 3;
+		_temp_make_local_34_16_64(1,__context__) = 2;
+		_temp_make_local_34_16_64(2,__context__) = 4;
+		_temp_make_local_34_16_64(3,__context__) = 1;
+		return _temp_make_local_34_16_64;
+	})())))))));
+	_Func_0x60_test_sort_6a9d5a88e18b98b3(__context__,das_arg<TDim<uint32_t,4>>::pass((([&]() -> TDim<uint32_t,4>& {
+		_temp_make_local_35_16_32(0,__context__) = 0x3u;
+		_temp_make_local_35_16_32(1,__context__) = 0x2u;
+		_temp_make_local_35_16_32(2,__context__) = 0x4u;
+		_temp_make_local_35_16_32(3,__context__) = 0x1u;
+		return _temp_make_local_35_16_32;
+	})())));
+	_Func_0x60_test_sort_49cb210d58ee1c70(__context__,das_arg<TArray<uint32_t>>::pass((_temp_make_local_36_16_32 = (_Funcbuiltin_0x60_to_array_move_92528fa94d98ce41(__context__,das_arg<TDim<uint32_t,4>>::pass((([&]() -> TDim<uint32_t,4>& {
+		_temp_make_local_36_16_64(0,__context__) = 0x3u;
+		_temp_make_local_36_16_64(1,__context__) = 0x2u;
+		_temp_make_local_36_16_64(2,__context__) = 0x4u;
+		_temp_make_local_36_16_64(3,__context__) = 0x1u;
+		return _temp_make_local_36_16_64;
+	})())))))));
+	_Func_0x60_test_sort_8b2e5c3cf444fdb7(__context__,das_arg<TDim<int64_t,4>>::pass((([&]() -> TDim<int64_t,4>& {
+		_temp_make_local_37_16_32(0,__context__) = INT64_C(3);
+		_temp_make_local_37_16_32(1,__context__) = INT64_C(2);
+		_temp_make_local_37_16_32(2,__context__) = INT64_C(4);
+		_temp_make_local_37_16_32(3,__context__) = INT64_C(1);
+		return _temp_make_local_37_16_32;
+	})())));
+	_Func_0x60_test_sort_bcc890138b35cb26(__context__,das_arg<TArray<int64_t>>::pass((_temp_make_local_38_16_32 = (_Funcbuiltin_0x60_to_array_move_c99dd1a0e3290bbd(__context__,das_arg<TDim<int64_t,4>>::pass((([&]() -> TDim<int64_t,4>& {
+		_temp_make_local_38_16_64(0,__context__) = INT64_C(3);
+		_temp_make_local_38_16_64(1,__context__) = INT64_C(2);
+		_temp_make_local_38_16_64(2,__context__) = INT64_C(4);
+		_temp_make_local_38_16_64(3,__context__) = INT64_C(1);
+		return _temp_make_local_38_16_64;
+	})())))))));
+	_Func_0x60_test_sort_f6be85e48ba8a845(__context__,das_arg<TDim<uint64_t,4>>::pass((([&]() -> TDim<uint64_t,4>& {
+		_temp_make_local_39_16_32(0,__context__) = UINT64_C(0x3);
+		_temp_make_local_39_16_32(1,__context__) = UINT64_C(0x2);
+		_temp_make_local_39_16_32(2,__context__) = UINT64_C(0x4);
+		_temp_make_local_39_16_32(3,__context__) = UINT64_C(0x1);
+		return _temp_make_local_39_16_32;
+	})())));
+	_Func_0x60_test_sort_d51764b727a45406(__context__,das_arg<TArray<uint64_t>>::pass((_temp_make_local_40_16_32 = (_Funcbuiltin_0x60_to_array_move_1568bc758a054449(__context__,das_arg<TDim<uint64_t,4>>::pass((([&]() -> TDim<uint64_t,4>& {
+		_temp_make_local_40_16_64(0,__context__) = UINT64_C(0x3);
+		_temp_make_local_40_16_64(1,__context__) = UINT64_C(0x2);
+		_temp_make_local_40_16_64(2,__context__) = UINT64_C(0x4);
+		_temp_make_local_40_16_64(3,__context__) = UINT64_C(0x1);
+		return _temp_make_local_40_16_64;
+	})())))))));
+	_Func_0x60_test_sort_28e87ed56f7f3aae(__context__,das_arg<TDim<float,4>>::pass((([&]() -> TDim<float,4>& {
+		_temp_make_local_41_16_32(0,__context__) = 3.f;
+		_temp_make_local_41_16_32(1,__context__) = 2.f;
+		_temp_make_local_41_16_32(2,__context__) = 4.f;
+		_temp_make_local_41_16_32(3,__context__) = 1.f;
+		return _temp_make_local_41_16_32;
+	})())));
+	_Func_0x60_test_sort_8131367e9c2f5a1(__context__,das_arg<TArray<float>>::pass((_temp_make_local_42_16_32 = (_Funcbuiltin_0x60_to_array_move_d8cb1569aa332b19(__context__,das_arg<TDim<float,4>>::pass((([&]() -> TDim<float,4>& {
+		_temp_make_local_42_16_64(0,__context__) = 3.f;
+		_temp_make_local_42_16_64(1,__context__) = 2.f;
+		_temp_make_local_42_16_64(2,__context__) = 4.f;
+		_temp_make_local_42_16_64(3,__context__) = 1.f;
+		return _temp_make_local_42_16_64;
+	})())))))));
+	_Func_0x60_test_sort_39d7b101d97e8d68(__context__,das_arg<TDim<double,4>>::pass((([&]() -> TDim<double,4>& {
+		_temp_make_local_43_16_32(0,__context__) = 3.;
+		_temp_make_local_43_16_32(1,__context__) = 2.;
+		_temp_make_local_43_16_32(2,__context__) = 4.;
+		_temp_make_local_43_16_32(3,__context__) = 1.;
+		return _temp_make_local_43_16_32;
+	})())));
+	_Func_0x60_test_sort_68576acf01622dd1(__context__,das_arg<TArray<double>>::pass((_temp_make_local_44_16_32 = (_Funcbuiltin_0x60_to_array_move_d8d2acf7e6ad0537(__context__,das_arg<TDim<double,4>>::pass((([&]() -> TDim<double,4>& {
+		_temp_make_local_44_16_64(0,__context__) = 3.;
+		_temp_make_local_44_16_64(1,__context__) = 2.;
+		_temp_make_local_44_16_64(2,__context__) = 4.;
+		_temp_make_local_44_16_64(3,__context__) = 1.;
+		return _temp_make_local_44_16_64;
+	})())))))));
+	_Func_0x60_test_sort_7a20318454d4a5e5(__context__,das_arg<TDim<char *,4>>::pass((([&]() -> TDim<char *,4>& {
+		_temp_make_local_46_16_32(0,__context__) = ((char *) "3.0lf");
+		_temp_make_local_46_16_32(1,__context__) = ((char *) "2.0lf");
+		_temp_make_local_46_16_32(2,__context__) = ((char *) "4.0lf");
+		_temp_make_local_46_16_32(3,__context__) = ((char *) "1.0lf");
+		return _temp_make_local_46_16_32;
+	})())));
+	_Func_0x60_test_sort_a39499a713a2a6d4(__context__,das_arg<TArray<char *>>::pass((_temp_make_local_47_16_32 = (_Funcbuiltin_0x60_to_array_move_5a483bf23c771f8b(__context__,das_arg<TDim<char *,4>>::pass((([&]() -> TDim<char *,4>& {
+		_temp_make_local_47_16_64(0,__context__) = ((char *) "3.0lf");
+		_temp_make_local_47_16_64(1,__context__) = ((char *) "2.0lf");
+		_temp_make_local_47_16_64(2,__context__) = ((char *) "4.0lf");
+		_temp_make_local_47_16_64(3,__context__) = ((char *) "1.0lf");
+		return _temp_make_local_47_16_64;
+	})())))))));
+	_Func_0x60_test_sort_543ce0c280736484(__context__,das_arg<TDim<Foo,4>>::pass((([&]() -> TDim<Foo,4>& {
+		das_copy((_temp_make_local_49_16_32(0,__context__).x),(1));
+		das_copy((_temp_make_local_49_16_32(0,__context__).y),(2));
+		das_copy((_temp_make_local_49_16_32(1,__context__).x),(1));
+		das_copy((_temp_make_local_49_16_32(1,__context__).y),(1));
+		das_copy((_temp_make_local_49_16_32(2,__context__).x),(2));
+		das_copy((_temp_make_local_49_16_32(2,__context__).y),(2));
+		das_copy((_temp_make_local_49_16_32(3,__context__).x),(0));
+		das_copy((_temp_make_local_49_16_32(3,__context__).y),(1));
+		return _temp_make_local_49_16_32;
+	})())));
+	_Func_0x60_test_sort_6bcb6b7d5700cf53(__context__,das_arg<TArray<Foo>>::pass((_temp_make_local_50_16_32 = (_Funcbuiltin_0x60_to_array_move_ab97a8b83f2e7065(__context__,das_arg<TDim<Foo,4>>::pass((([&]() -> TDim<Foo,4>& {
+		das_copy((_temp_make_local_50_16_64(0,__context__).x),(1));
+		das_copy((_temp_make_local_50_16_64(0,__context__).y),(2));
+		das_copy((_temp_make_local_50_16_64(1,__context__).x),(1));
+		das_copy((_temp_make_local_50_16_64(1,__context__).y),(1));
+		das_copy((_temp_make_local_50_16_64(2,__context__).x),(2));
+		das_copy((_temp_make_local_50_16_64(2,__context__).y),(2));
+		das_copy((_temp_make_local_50_16_64(3,__context__).x),(0));
+		das_copy((_temp_make_local_50_16_64(3,__context__).y),(1));
+		return _temp_make_local_50_16_64;
+	})())))))));
+	test_vector_sort_74cc0281ce3a8534(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_sort_4732ebdcad990f07
+	aotLib[0xbd9e102c769f911d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60_sort_4732ebdcad990f07>>();
+	};
+	// _Funcbuiltin_0x60_sort_e577240fb029e3d2
+	aotLib[0x92ad28c7a14e1d41] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> &  ),&_Funcbuiltin_0x60_sort_e577240fb029e3d2>>();
+	};
+	// _Funcbuiltin_0x60_sort_41715831ae7f1315
+	aotLib[0xe8957c42b10c356d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int64_t> &  ),&_Funcbuiltin_0x60_sort_41715831ae7f1315>>();
+	};
+	// _Funcbuiltin_0x60_sort_7c9a8c217ad5bb18
+	aotLib[0xce6fe8d66422e469] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint64_t> &  ),&_Funcbuiltin_0x60_sort_7c9a8c217ad5bb18>>();
+	};
+	// _Funcbuiltin_0x60_sort_b62e086287e4e9ac
+	aotLib[0x6cd7578140ba75d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Funcbuiltin_0x60_sort_b62e086287e4e9ac>>();
+	};
+	// _Funcbuiltin_0x60_sort_a351332315ffdad7
+	aotLib[0x9bb44e777dca65d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<double> &  ),&_Funcbuiltin_0x60_sort_a351332315ffdad7>>();
+	};
+	// _Funcbuiltin_0x60_sort_ff406c5ab603b771
+	aotLib[0x635aaf1fa4303005] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Funcbuiltin_0x60_sort_ff406c5ab603b771>>();
+	};
+	// _Funcbuiltin_0x60_sort_67424656e829030e
+	aotLib[0xaa9cabb2f58263bf] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Foo> &  ),&_Funcbuiltin_0x60_sort_67424656e829030e>>();
+	};
+	// _Funcbuiltin_0x60_sort_5de58d1eb04c83e3
+	aotLib[0x1d72689eeb43a3dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Funcbuiltin_0x60_sort_5de58d1eb04c83e3>>();
+	};
+	// _Funcbuiltin_0x60_sort_fe3388df434e572c
+	aotLib[0x166ceeb96669925] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,4> &  ),&_Funcbuiltin_0x60_sort_fe3388df434e572c>>();
+	};
+	// _Funcbuiltin_0x60_sort_2284b0bf8fa51c75
+	aotLib[0x1c141f56d7191805] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int64_t,4> &  ),&_Funcbuiltin_0x60_sort_2284b0bf8fa51c75>>();
+	};
+	// _Funcbuiltin_0x60_sort_321a87dafe5eb0a2
+	aotLib[0x7c7cb99e934b60e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint64_t,4> &  ),&_Funcbuiltin_0x60_sort_321a87dafe5eb0a2>>();
+	};
+	// _Funcbuiltin_0x60_sort_20b4d52a5594ef8
+	aotLib[0x4aa424e6163eabe5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<float,4> &  ),&_Funcbuiltin_0x60_sort_20b4d52a5594ef8>>();
+	};
+	// _Funcbuiltin_0x60_sort_5e5b973bd52198d5
+	aotLib[0x8f9ae5d52f7559dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<double,4> &  ),&_Funcbuiltin_0x60_sort_5e5b973bd52198d5>>();
+	};
+	// _Funcbuiltin_0x60_sort_efbd6153351590ed
+	aotLib[0xa9503aacd3f1e3f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<char *,4> &  ),&_Funcbuiltin_0x60_sort_efbd6153351590ed>>();
+	};
+	// _Funcbuiltin_0x60_sort_29fe750c208866cf
+	aotLib[0x27c25872113289c7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<Foo,4> &  ),&_Funcbuiltin_0x60_sort_29fe750c208866cf>>();
+	};
+	// _Func_0x60_test_sort_9bfd72e67b55af74
+	aotLib[0x42f3db23efea43eb] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> &  ),&_Func_0x60_test_sort_9bfd72e67b55af74>>();
+	};
+	// _Func_0x60_test_sort_49cb210d58ee1c70
+	aotLib[0xc817e72fea86c370] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint32_t> &  ),&_Func_0x60_test_sort_49cb210d58ee1c70>>();
+	};
+	// _Func_0x60_test_sort_bcc890138b35cb26
+	aotLib[0xbb2a52189e4b6c37] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int64_t> &  ),&_Func_0x60_test_sort_bcc890138b35cb26>>();
+	};
+	// _Func_0x60_test_sort_d51764b727a45406
+	aotLib[0xed8f784331bf0598] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<uint64_t> &  ),&_Func_0x60_test_sort_d51764b727a45406>>();
+	};
+	// _Func_0x60_test_sort_8131367e9c2f5a1
+	aotLib[0x35d9ef5183e1c99d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float> &  ),&_Func_0x60_test_sort_8131367e9c2f5a1>>();
+	};
+	// _Func_0x60_test_sort_68576acf01622dd1
+	aotLib[0x51af20456b8970e2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<double> &  ),&_Func_0x60_test_sort_68576acf01622dd1>>();
+	};
+	// _Func_0x60_test_sort_a39499a713a2a6d4
+	aotLib[0x6a63f9eb95716097] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<char *> &  ),&_Func_0x60_test_sort_a39499a713a2a6d4>>();
+	};
+	// _Func_0x60_test_sort_6bcb6b7d5700cf53
+	aotLib[0x29dc13a6dd270216] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Foo> &  ),&_Func_0x60_test_sort_6bcb6b7d5700cf53>>();
+	};
+	// _Funcbuiltin_0x60_push_6c25697422f5e150
+	aotLib[0x49ebe5856b0c910d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float2> & , float2  ),&_Funcbuiltin_0x60_push_6c25697422f5e150>>();
+	};
+	// _Func_0x60_test_sort_comp_d8ee93a26582c6f9
+	aotLib[0x43f068bfb52f85e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float2> &  ),&_Func_0x60_test_sort_comp_d8ee93a26582c6f9>>();
+	};
+	// _Func_0x60_test_sort_f516e845bec8da1
+	aotLib[0xf2b9649562153058] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Func_0x60_test_sort_f516e845bec8da1>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_54f9a4ebca1fe3c1
+	aotLib[0x3970d3262606058d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int32_t> (*) ( Context * __context__, TDim<int32_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_54f9a4ebca1fe3c1>>();
+	};
+	// _Func_0x60_test_sort_6a9d5a88e18b98b3
+	aotLib[0x7cf5d38cd33c10d1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint32_t,4> &  ),&_Func_0x60_test_sort_6a9d5a88e18b98b3>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_92528fa94d98ce41
+	aotLib[0x3fa2e9436bcfecf5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<uint32_t> (*) ( Context * __context__, TDim<uint32_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_92528fa94d98ce41>>();
+	};
+	// _Func_0x60_test_sort_8b2e5c3cf444fdb7
+	aotLib[0x2fc28dfcf4863e99] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<int64_t,4> &  ),&_Func_0x60_test_sort_8b2e5c3cf444fdb7>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_c99dd1a0e3290bbd
+	aotLib[0x2761734fe34ce29d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<int64_t> (*) ( Context * __context__, TDim<int64_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_c99dd1a0e3290bbd>>();
+	};
+	// _Func_0x60_test_sort_f6be85e48ba8a845
+	aotLib[0xfa1a96270423c554] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<uint64_t,4> &  ),&_Func_0x60_test_sort_f6be85e48ba8a845>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_1568bc758a054449
+	aotLib[0xdde4bec61284ded5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<uint64_t> (*) ( Context * __context__, TDim<uint64_t,4> &  ),&_Funcbuiltin_0x60_to_array_move_1568bc758a054449>>();
+	};
+	// _Func_0x60_test_sort_28e87ed56f7f3aae
+	aotLib[0xc341494a08e43435] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<float,4> &  ),&_Func_0x60_test_sort_28e87ed56f7f3aae>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_d8cb1569aa332b19
+	aotLib[0x1c2d386ef9f97b5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<float> (*) ( Context * __context__, TDim<float,4> &  ),&_Funcbuiltin_0x60_to_array_move_d8cb1569aa332b19>>();
+	};
+	// _Func_0x60_test_sort_39d7b101d97e8d68
+	aotLib[0x37cc173df0e10c21] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<double,4> &  ),&_Func_0x60_test_sort_39d7b101d97e8d68>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_d8d2acf7e6ad0537
+	aotLib[0x5c4ea475ea42c1f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<double> (*) ( Context * __context__, TDim<double,4> &  ),&_Funcbuiltin_0x60_to_array_move_d8d2acf7e6ad0537>>();
+	};
+	// _Func_0x60_test_sort_7a20318454d4a5e5
+	aotLib[0x5d105ec681ab10fa] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<char *,4> &  ),&_Func_0x60_test_sort_7a20318454d4a5e5>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_5a483bf23c771f8b
+	aotLib[0x2c21d49e73ca2b55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<char *> (*) ( Context * __context__, TDim<char *,4> &  ),&_Funcbuiltin_0x60_to_array_move_5a483bf23c771f8b>>();
+	};
+	// _Func_0x60_test_sort_543ce0c280736484
+	aotLib[0x9793b4fa1b2e62d4] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TDim<Foo,4> &  ),&_Func_0x60_test_sort_543ce0c280736484>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_ab97a8b83f2e7065
+	aotLib[0xc566c1174f3fb4dd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<Foo> (*) ( Context * __context__, TDim<Foo,4> &  ),&_Funcbuiltin_0x60_to_array_move_ab97a8b83f2e7065>>();
+	};
+	// _FuncLess_b668e86487895147
+	aotLib[0x6b48c1395d18b6d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, Foo const  & , Foo const  &  ),&_FuncLess_b668e86487895147>>();
+	};
+	// test_vector_sort_74cc0281ce3a8534
+	aotLib[0xa25ee73d51b331bc] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_vector_sort_74cc0281ce3a8534>>();
+	};
+	// test_fe5eb714fee9ce39
+	aotLib[0x7793383f0c6662f1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_fe5eb714fee9ce39>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,328 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings_boost
+ // require ast_boost
+ // require templates
+ // require contracts
+ // require array_boost
+ // require algorithm
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_8495388171295991224 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstSimulateMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupSimulateMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+namespace templates { struct DecltypeMacro; };
+namespace templates { struct DecltypeNoRefMacro; };
+namespace templates { struct TemplateMacro; };
+namespace contracts { struct IsAnyType; };
+namespace contracts { struct IsAnyArrayMacro; };
+namespace contracts { struct IsDimMacro; };
+namespace contracts { struct IsNotDimMacro; };
+namespace contracts { struct IsAnyEnumMacro; };
+namespace contracts { struct IsAnyVectorType; };
+namespace contracts { struct IsAnyStructMacro; };
+namespace contracts { struct IsAnyNumericMacro; };
+namespace contracts { struct IsAnyWorkhorse; };
+namespace contracts { struct IsAnyWorkhorseNonPtrMacro; };
+namespace contracts { struct IsAnyTupleNonPtrMacro; };
+namespace contracts { struct IsAnyVariantNonPtrMacro; };
+namespace contracts { struct IsAnyFunctionNonPtrMacro; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+// unused structure AstSimulateMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupForLoopMacro
+// unused structure SetupCaptureMacro
+// unused structure SetupSimulateMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+// unused structure DecltypeMacro
+// unused structure DecltypeNoRefMacro
+// unused structure TemplateMacro
+// unused structure IsAnyType
+// unused structure IsAnyArrayMacro
+// unused structure IsDimMacro
+// unused structure IsNotDimMacro
+// unused structure IsAnyEnumMacro
+// unused structure IsAnyVectorType
+// unused structure IsAnyStructMacro
+// unused structure IsAnyNumericMacro
+// unused structure IsAnyWorkhorse
+// unused structure IsAnyWorkhorseNonPtrMacro
+// unused structure IsAnyTupleNonPtrMacro
+// unused structure IsAnyVariantNonPtrMacro
+// unused structure IsAnyFunctionNonPtrMacro
+
+inline int32_t _Funcalgorithm_0x60_lower_bound_f32db290822072c9 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_49, int32_t __f_rename_at_49, int32_t __l_rename_at_49, int32_t __val_rename_at_49 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline int32_t _Funcalgorithm_0x60_lower_bound_de23813c330fe5e9 ( Context * __context__, TArray<int32_t> const  & __a_rename_at_65, int32_t __val_rename_at_65 );
+inline bool _Funcalgorithm_0x60_binary_search_45f13b9534d14afd ( Context * __context__, TArray<int32_t> const  & __a_rename_at_86, int32_t __val_rename_at_86 );
+inline bool test_9c911da945824cca ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline int32_t _Funcalgorithm_0x60_lower_bound_f32db290822072c9 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_49, int32_t __f_rename_at_49, int32_t __l_rename_at_49, int32_t __val_rename_at_49 )
+{
+	DAS_ASSERTF(((__f_rename_at_49 >= 0) && (__f_rename_at_49 <= __l_rename_at_49)),(((char *) "lower bound first out of range")));
+	DAS_ASSERTF(((__l_rename_at_49 >= __f_rename_at_49) && (__l_rename_at_49 <= builtin_array_size(__a_rename_at_49))),(((char *) "lower bound last out of range")));
+	int32_t __count_rename_at_53 = (__l_rename_at_49 - __f_rename_at_49);
+	int32_t __first_rename_at_54 = __f_rename_at_49;
+	while ( __count_rename_at_53 > 0 )
+	{
+		int32_t __step_rename_at_56 = ((int32_t)(SimPolicy<int32_t>::Div(__count_rename_at_53,2,*__context__,nullptr)));
+		int32_t __it_rename_at_57 = ((int32_t)(__first_rename_at_54 + __step_rename_at_56));
+		if ( __a_rename_at_49(__it_rename_at_57,__context__) < __val_rename_at_49 )
+		{
+			__first_rename_at_54 += (__step_rename_at_56 + 1);
+			__count_rename_at_53 -= (__step_rename_at_56 + 1);
+		} else {
+			das_copy(__count_rename_at_53,__step_rename_at_56);
+		};
+	};
+	return das_auto_cast<int32_t>::cast(__first_rename_at_54);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline int32_t _Funcalgorithm_0x60_lower_bound_de23813c330fe5e9 ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_65, int32_t __val_rename_at_65 )
+{
+	return das_auto_cast<int32_t>::cast(_Funcalgorithm_0x60_lower_bound_f32db290822072c9(__context__,__a_rename_at_65,0,builtin_array_size(__a_rename_at_65),__val_rename_at_65));
+}
+
+inline bool _Funcalgorithm_0x60_binary_search_45f13b9534d14afd ( Context * __context__, TArray<int32_t> const  &  __a_rename_at_86, int32_t __val_rename_at_86 )
+{
+	int32_t __first_rename_at_87 = ((int32_t)_Funcalgorithm_0x60_lower_bound_de23813c330fe5e9(__context__,__a_rename_at_86,__val_rename_at_86));
+	return das_auto_cast<bool>::cast((__first_rename_at_87 != builtin_array_size(__a_rename_at_86)) && !((__val_rename_at_86 < __a_rename_at_86(__first_rename_at_87,__context__))));
+}
+
+inline bool test_9c911da945824cca ( Context * __context__ )
+{
+	TArray<int32_t> __a_rename_at_5_ConstRef; das_zero(__a_rename_at_5_ConstRef); das_move(__a_rename_at_5_ConstRef, ((TArray<int32_t>)das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<int32_t>{
+		TArray<int32_t> ____acomp_5_rename_at_5; das_zero(____acomp_5_rename_at_5);
+		builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_5_rename_at_5),false);
+		{
+			bool __need_loop_5 = true;
+			// x : int const
+			das_iterator<range> __x_iterator(range(0,10));
+			int32_t __x_rename_at_5;
+			__need_loop_5 = __x_iterator.first(__context__,(__x_rename_at_5)) && __need_loop_5;
+			for ( ; __need_loop_5 ; __need_loop_5 = __x_iterator.next(__context__,(__x_rename_at_5)) )
+			{
+				if ( __x_rename_at_5 != 4 )
+				{
+					_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____acomp_5_rename_at_5),__x_rename_at_5);
+				};
+			}
+			__x_iterator.close(__context__,(__x_rename_at_5));
+		};
+		builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_5_rename_at_5),true);
+		return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(____acomp_5_rename_at_5);
+	})));
+	TArray<int32_t> const  & __a_rename_at_5 = __a_rename_at_5_ConstRef; ;
+	{
+		bool __need_loop_6 = true;
+		// i : int const
+		das_iterator<range> __i_iterator(range(-2,12));
+		int32_t __i_rename_at_6;
+		__need_loop_6 = __i_iterator.first(__context__,(__i_rename_at_6)) && __need_loop_6;
+		for ( ; __need_loop_6 ; __need_loop_6 = __i_iterator.next(__context__,(__i_rename_at_6)) )
+		{
+			int32_t __lb_rename_at_7 = ((int32_t)_Funcalgorithm_0x60_lower_bound_de23813c330fe5e9(__context__,__a_rename_at_5,__i_rename_at_6));
+			bool __bs_rename_at_8 = ((bool)_Funcalgorithm_0x60_binary_search_45f13b9534d14afd(__context__,__a_rename_at_5,__i_rename_at_6));
+			if ( __i_rename_at_6 < 0 )
+			{
+				DAS_ASSERT((__lb_rename_at_7 == 0));
+				DAS_ASSERT((__bs_rename_at_8 == false));
+			} else if ( __i_rename_at_6 >= 10 )
+			{
+				DAS_ASSERT((__lb_rename_at_7 == 9));
+				DAS_ASSERT((__bs_rename_at_8 == false));
+			} else if ( __i_rename_at_6 == 4 )
+			{
+				DAS_ASSERT((__lb_rename_at_7 == 4));
+				DAS_ASSERT((__bs_rename_at_8 == false));
+			} else if ( __i_rename_at_6 <= 3 )
+			{
+				DAS_ASSERT((__lb_rename_at_7 == __i_rename_at_6));
+				DAS_ASSERT((__bs_rename_at_8 == true));
+			} else {
+				DAS_ASSERT((__lb_rename_at_7 == (__i_rename_at_6 - 1)));
+				DAS_ASSERT((__bs_rename_at_8 == true));
+			};
+		}
+		__i_iterator.close(__context__,(__i_rename_at_6));
+	};
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcalgorithm_0x60_lower_bound_f32db290822072c9
+	aotLib[0x314b3204b962bb15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  & , int32_t , int32_t , int32_t  ),&_Funcalgorithm_0x60_lower_bound_f32db290822072c9>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Funcalgorithm_0x60_lower_bound_de23813c330fe5e9
+	aotLib[0xa3ecff93b9d1fc1e] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<int32_t (*) ( Context * __context__, TArray<int32_t> const  & , int32_t  ),&_Funcalgorithm_0x60_lower_bound_de23813c330fe5e9>>();
+	};
+	// _Funcalgorithm_0x60_binary_search_45f13b9534d14afd
+	aotLib[0xd8fc8c17e19f1668] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, TArray<int32_t> const  & , int32_t  ),&_Funcalgorithm_0x60_binary_search_45f13b9534d14afd>>();
+	};
+	// test_9c911da945824cca
+	aotLib[0x9a4155eff909c1f5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_9c911da945824cca>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
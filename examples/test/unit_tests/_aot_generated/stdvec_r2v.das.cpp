@@ -0,0 +1,114 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_13393055568187302492 {
+
+extern TypeInfo __type_info__af63eb4c86020609;
+extern VarInfo __var_info__1eea2c9ed711856c;
+extern FuncInfo __func_info__c4f16d6aa7a44ed1;
+
+VarInfo __func_info__c4f16d6aa7a44ed1_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~$::dasvector`TestObjectFoo"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8194, 24, UINT64_C(0x1eea2c9ed711856c), "arr", 0 };
+VarInfo * __func_info__c4f16d6aa7a44ed1_fields[1] =  { &__func_info__c4f16d6aa7a44ed1_field_0 };
+FuncInfo __func_info__c4f16d6aa7a44ed1 = {"invoke block<(arr:$::dasvector`TestObjectFoo):void> const", "", __func_info__c4f16d6aa7a44ed1_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xc4f16d6aa7a44ed1), 0x0 };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline bool test_1ee0c6e0ace85890 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline bool test_1ee0c6e0ace85890 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,112,"test " DAS_FILE_LINE);
+{
+	testFooArray(das_make_block<void,das::vector<TestObjectFoo> &>(__context__,80,0,&__func_info__c4f16d6aa7a44ed1,[&](das::vector<TestObjectFoo> & __arr_rename_at_5) -> void{
+		{
+			bool __need_loop_6 = true;
+			// i : int const
+			das_iterator<range> __i_iterator(mk_range(__arr_rename_at_5.size() /*length*/));
+			int32_t __i_rename_at_6;
+			__need_loop_6 = __i_iterator.first(__context__,(__i_rename_at_6)) && __need_loop_6;
+			for ( ; __need_loop_6 ; __need_loop_6 = __i_iterator.next(__context__,(__i_rename_at_6)) )
+			{
+				if ( das_index<das::vector<TestObjectFoo>>::at(__arr_rename_at_5,__i_rename_at_6,__context__).fooData /*fooData*/ != __i_rename_at_6 )
+				{
+					builtin_throw(((char *) "bad"),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+				};
+			}
+			__i_iterator.close(__context__,(__i_rename_at_6));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// test_1ee0c6e0ace85890
+	aotLib[0x85a1dabc285c1855] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_1ee0c6e0ace85890>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
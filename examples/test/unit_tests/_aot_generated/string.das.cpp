@@ -0,0 +1,223 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_17605247062180501265 {
+
+extern TypeInfo __type_info__af63e84c860200f0;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__af63db4c8601ead9;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__af63d94c8601e773;
+extern TypeInfo __type_info__90f5707b5a6f641;
+extern TypeInfo __type_info__f95678735cf0e442;
+
+TypeInfo __type_info__af63e84c860200f0 = { Type::tUInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e84c860200f0) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__af63db4c8601ead9 = { Type::tFloat, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63db4c8601ead9) };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+TypeInfo __type_info__af63d94c8601e773 = { Type::tDouble, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0xaf63d94c8601e773) };
+TypeInfo __type_info__90f5707b5a6f641 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 4, UINT64_C(0x90f5707b5a6f641) };
+TypeInfo __type_info__f95678735cf0e442 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~strings::StringBuilderWriter"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 40, UINT64_C(0xf95678735cf0e442) };
+
+static void resolveTypeInfoAnnotations()
+{
+	__type_info__f95678735cf0e442.resolveAnnotation();
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__f95678735cf0e442, &__type_info__90f3d07b5a6ca13 };
+TypeInfo * __tinfo_1[2] = { &__type_info__f95678735cf0e442, &__type_info__90f5707b5a6f641 };
+
+inline void failUint_880bc492214c1d36 ( Context * __context__, char * const  __val_rename_at_7 );
+inline void failInt_5e65702ca628b475 ( Context * __context__, char * const  __val_rename_at_13 );
+inline void failFloat_1475586ec164e896 ( Context * __context__, char * const  __val_rename_at_20 );
+inline void failDouble_183a4c58d418ec09 ( Context * __context__, char * const  __val_rename_at_26 );
+inline void failAll_de7ee9d63a345afb ( Context * __context__, char * const  __val_rename_at_32 );
+inline bool test_f8a97f52dd434199 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void failUint_880bc492214c1d36 ( Context * __context__, char * const  __val_rename_at_7 )
+{
+	das_try_recover(__context__, [&]()
+	{
+		das_debug(__context__,&__type_info__af63e84c860200f0,__FILE__,__LINE__,cast<uint32_t>::from(string_to_uint(__val_rename_at_7,__context__)),(((char *) "=")));
+		DAS_ASSERTF((false),(((char *) "can't convert non uint string without exception")));
+	}, [&]()
+	{
+	});
+}
+
+inline void failInt_5e65702ca628b475 ( Context * __context__, char * const  __val_rename_at_13 )
+{
+	das_try_recover(__context__, [&]()
+	{
+		das_debug(__context__,&__type_info__af63e44c8601fa24,__FILE__,__LINE__,cast<int32_t>::from(string_to_int(__val_rename_at_13,__context__)),(((char *) "=")));
+		DAS_ASSERTF((false),(((char *) "can't convert non int string without exception")));
+	}, [&]()
+	{
+	});
+}
+
+inline void failFloat_1475586ec164e896 ( Context * __context__, char * const  __val_rename_at_20 )
+{
+	das_try_recover(__context__, [&]()
+	{
+		das_debug(__context__,&__type_info__af63db4c8601ead9,__FILE__,__LINE__,cast<float>::from(string_to_float(__val_rename_at_20,__context__)),(((char *) "=")));
+		DAS_ASSERTF((false),(((char *) "can't convert non float string without exception")));
+	}, [&]()
+	{
+	});
+}
+
+inline void failDouble_183a4c58d418ec09 ( Context * __context__, char * const  __val_rename_at_26 )
+{
+	das_try_recover(__context__, [&]()
+	{
+		das_debug(__context__,&__type_info__af63d94c8601e773,__FILE__,__LINE__,cast<double>::from(string_to_double(__val_rename_at_26,__context__)),(((char *) "=")));
+		DAS_ASSERTF((false),(((char *) "can't convert non double string without exception")));
+	}, [&]()
+	{
+	});
+}
+
+inline void failAll_de7ee9d63a345afb ( Context * __context__, char * const  __val_rename_at_32 )
+{
+	failUint_880bc492214c1d36(__context__,__val_rename_at_32);
+	failInt_5e65702ca628b475(__context__,__val_rename_at_32);
+	failFloat_1475586ec164e896(__context__,__val_rename_at_32);
+	failDouble_183a4c58d418ec09(__context__,__val_rename_at_32);
+}
+
+inline bool test_f8a97f52dd434199 ( Context * __context__ )
+{
+	failAll_de7ee9d63a345afb(__context__,nullptr);
+	failAll_de7ee9d63a345afb(__context__,((char *) "abc"));
+	char * __st_rename_at_105 = ((char *)(char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_105) DAS_AOT_INLINE_LAMBDA -> void{
+		das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_0,cast<StringBuilderWriter &>::from(__writer_rename_at_105),cast<char * const >::from(((char *) "255 hex is "))));
+		format_and_write<int32_t>(das_arg<StringBuilderWriter>::pass(__writer_rename_at_105),((char *) "%2x"),255);
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)))))));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(__st_rename_at_105),cast<char *>::from(((char *) "255 hex is ff")),*__context__,nullptr)));
+	int32_t __count_rename_at_110 = 0;
+	int32_t __index_rename_at_111 = 0;
+	{
+		bool __need_loop_112 = true;
+		// ch : int const
+		das_iterator<char * const > __ch_iterator(__st_rename_at_105);
+		int32_t __ch_rename_at_112;
+		__need_loop_112 = __ch_iterator.first(__context__,(__ch_rename_at_112)) && __need_loop_112;
+		for ( ; __need_loop_112 ; __need_loop_112 = __ch_iterator.next(__context__,(__ch_rename_at_112)) )
+		{
+			if ( __ch_rename_at_112 == 53 )
+			{
+				++__count_rename_at_110;
+			};
+			int32_t __chAt_rename_at_115 = ((int32_t)get_character_at(__st_rename_at_105,__index_rename_at_111,__context__));
+			DAS_ASSERT((__ch_rename_at_112 == __chAt_rename_at_115));
+			++__index_rename_at_111;
+		}
+		__ch_iterator.close(__context__,(__ch_rename_at_112));
+	};
+	DAS_ASSERT((__count_rename_at_110 == 2));
+	char * __zzs_rename_at_120 = (char *)(((char *)(builtin_build_string_T([&](StringBuilderWriter & __writer_rename_at_120) DAS_AOT_INLINE_LAMBDA -> void{
+		{
+			bool __need_loop_121 = true;
+			// zzx : int const
+			das_iterator<range> __zzx_iterator(range(0,100500));
+			int32_t __zzx_rename_at_121;
+			__need_loop_121 = __zzx_iterator.first(__context__,(__zzx_rename_at_121)) && __need_loop_121;
+			for ( ; __need_loop_121 ; __need_loop_121 = __zzx_iterator.next(__context__,(__zzx_rename_at_121)) )
+			{
+				das_call_interop<void>::call(&builtin_write_string,__context__,SimNode_AotInterop<2>(__tinfo_1,cast<StringBuilderWriter &>::from(__writer_rename_at_120),cast<int32_t>::from(__zzx_rename_at_121)));
+			}
+			__zzx_iterator.close(__context__,(__zzx_rename_at_121));
+		};
+	},__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))))));
+	delete_string(__zzs_rename_at_120,__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// failUint_880bc492214c1d36
+	aotLib[0xf25c780cf633505d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const   ),&failUint_880bc492214c1d36>>();
+	};
+	// failInt_5e65702ca628b475
+	aotLib[0xd5ff0e1a9f73c98d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const   ),&failInt_5e65702ca628b475>>();
+	};
+	// failFloat_1475586ec164e896
+	aotLib[0xb4e7077a7be844d9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const   ),&failFloat_1475586ec164e896>>();
+	};
+	// failDouble_183a4c58d418ec09
+	aotLib[0xb86556ae16d94995] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const   ),&failDouble_183a4c58d418ec09>>();
+	};
+	// failAll_de7ee9d63a345afb
+	aotLib[0xd9a97dc05d6b1f07] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, char * const   ),&failAll_de7ee9d63a345afb>>();
+	};
+	// test_f8a97f52dd434199
+	aotLib[0x6f9f897367290da5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_f8a97f52dd434199>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,125 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require UnitTest
+#include "unitTest.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_14314517869206124838 {
+
+
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline float3 find_best_squad_pos_2d3d699d93dcca1a ( Context * __context__, float3 __wish_pos_rename_at_8, float3x4 const  & __leader_tm_rename_at_8, float3 __agent_pos_rename_at_8, float3 __offset_rename_at_9, int32_t __num_iter_rename_at_9, float __leader_min_dist_rename_at_9 );
+inline bool test_ea3e048c48628b18 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline float3 find_best_squad_pos_2d3d699d93dcca1a ( Context * __context__, float3 __wish_pos_rename_at_8, float3x4 const  &  __leader_tm_rename_at_8, float3 __agent_pos_rename_at_8, float3 __offset_rename_at_9, int32_t __num_iter_rename_at_9, float __leader_min_dist_rename_at_9 )
+{
+	float3 __wishPosition_rename_at_10 = __wish_pos_rename_at_8;
+	{
+		bool __need_loop_11 = true;
+		// iter : int const
+		das_iterator<range> __iter_iterator(mk_range(__num_iter_rename_at_9));
+		int32_t __iter_rename_at_11;
+		__need_loop_11 = __iter_iterator.first(__context__,(__iter_rename_at_11)) && __need_loop_11;
+		for ( ; __need_loop_11 ; __need_loop_11 = __iter_iterator.next(__context__,(__iter_rename_at_11)) )
+		{
+			project_to_nearest_navmesh_point(das_alias<Point3>::to(__wishPosition_rename_at_10),0.5f);
+			if ( lengthSq3(SimPolicy<float3>::Sub(__wishPosition_rename_at_10,das_index<float3x4 const >::at(__leader_tm_rename_at_8,3,__context__),*__context__,nullptr)) < (__leader_min_dist_rename_at_9 * __leader_min_dist_rename_at_9) )
+			{
+				das_copy(__wishPosition_rename_at_10,float3x4_mul_vec3p(__leader_tm_rename_at_8,(SimPolicy<float3>::Mul(v_splats(1 << (__iter_rename_at_11 + 1)),__offset_rename_at_9,*__context__,nullptr))));
+			} else {
+				break;
+			};
+		}
+		__iter_iterator.close(__context__,(__iter_rename_at_11));
+	};
+	project_to_nearest_navmesh_point(das_alias<Point3>::to(__wishPosition_rename_at_10),0.5f);
+	return das_auto_cast<float3>::cast(__wishPosition_rename_at_10);
+}
+
+inline bool test_ea3e048c48628b18 ( Context * __context__ )
+{
+	float3 __pos_rename_at_22 = v_make_vec4f(1.f,2.f,3.f,0.f);
+	project_to_nearest_navmesh_point(das_alias<Point3>::to(__pos_rename_at_22),1.f);
+	DAS_ASSERT((SimPolicy<float3>::Equ(__pos_rename_at_22,v_make_vec4f(2.f,3.f,4.f,0.f),*__context__,nullptr)));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// find_best_squad_pos_2d3d699d93dcca1a
+	aotLib[0x2796929a965ab251] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<float3 (*) ( Context * __context__, float3 , float3x4 const  & , float3 , float3 , int32_t , float  ),&find_best_squad_pos_2d3d699d93dcca1a>>();
+	};
+	// test_ea3e048c48628b18
+	aotLib[0x24a07c86cafdf04d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_ea3e048c48628b18>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -0,0 +1,954 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require jobque
+#include "daScript/simulate/aot_builtin_jobque.h"
+ // require rtti
+#include "daScript/simulate/aot_builtin_rtti.h"
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_handle.h"
+ // require strings
+#include "daScript/simulate/aot_builtin_string.h"
+ // require ast
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_builtin_ast.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+ // require strings_boost
+ // require ast_boost
+ // require templates
+ // require contracts
+ // require array_boost
+ // require algorithm
+ // require templates_boost
+ // require macro_boost
+ // require jobque_boost
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_3051613471692060290 {
+
+extern StructInfo __struct_info__c70a59dee7d757c8;
+extern StructInfo __struct_info__e5095599a587ca50;
+extern StructInfo __struct_info__39e00ee5a445fd07;
+extern StructInfo __struct_info__838012e86500b30d;
+extern StructInfo __struct_info__215ac4f59bf1bca7;
+extern TypeInfo __type_info__a7244f77d75ea149;
+extern TypeInfo __type_info__89f87fddfa254636;
+extern TypeInfo __type_info__569f9f2b1331f4d2;
+extern TypeInfo __type_info__baa4c4bc11614b7;
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__90f4c07b5a6e390;
+extern TypeInfo __type_info__117f5cf4148559d4;
+extern TypeInfo __type_info__2f707f193f39acb0;
+extern TypeInfo __type_info__de07e88d204ba4b0;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__f2b375a8773b443a;
+extern TypeInfo __type_info__527c1866e14c26a7;
+extern TypeInfo __type_info__87830cbb3176f4fe;
+extern TypeInfo __type_info__fe24a2dd43758fc9;
+extern TypeInfo __type_info__a0d441438a30bb26;
+extern VarInfo __var_info__7395b868f21cfae9;
+extern VarInfo __var_info__1fca1d553ac3e011;
+extern VarInfo __var_info__ed408fd07bade1c0;
+extern VarInfo __var_info__996b1cb2a31043fc;
+extern VarInfo __var_info__13f7c98505bae5c4;
+extern VarInfo __var_info__ed11594e4083ba86;
+extern VarInfo __var_info__a448ad9158800d44;
+extern VarInfo __var_info__bf0a7891be5e5b36;
+extern VarInfo __var_info__1e12ac326c257baf;
+extern VarInfo __var_info__1dfee10f7761dfd4;
+extern VarInfo __var_info__8b42cbb643d16300;
+extern VarInfo __var_info__18aab86bb3264c3a;
+extern VarInfo __var_info__401fe9c0f41e9c3;
+extern VarInfo __var_info__b8b4102db7595764;
+extern VarInfo __var_info__85046dd2ed4bae71;
+extern VarInfo __var_info__ed409bd07badf624;
+extern VarInfo __var_info__1dfee20f7761e187;
+extern VarInfo __var_info__c68ce48f6c3a8ae9;
+extern VarInfo __var_info__f39e46a82669d8f8;
+extern VarInfo __var_info__23f479c6e1a03f99;
+extern VarInfo __var_info__e91a2e3649f8d2df;
+extern VarInfo __var_info__3abde3f972d5b902;
+extern VarInfo __var_info__49adcf947981896c;
+extern FuncInfo __func_info__cfb81a8365a0ae64;
+extern FuncInfo __func_info__e3ccd7343d92b33;
+extern FuncInfo __func_info__3ad0a31d00c9d958;
+extern FuncInfo __func_info__eeb3b74c98cb09c3;
+
+TypeInfo * __type_info__23f479c6e1a03f99_arg_types_var_14342374777222027208[1] = { &__type_info__baa4c4bc11614b7 };
+VarInfo __struct_info__c70a59dee7d757c8_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__23f479c6e1a03f99_arg_types_var_14342374777222027208, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x23f479c6e1a03f99), "__lambda", 0 };
+TypeInfo * __type_info__f39e46a82669d8f8_arg_types_var_14342374777222027208[1] = { &__type_info__527c1866e14c26a7 };
+VarInfo __struct_info__c70a59dee7d757c8_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__f39e46a82669d8f8_arg_types_var_14342374777222027208, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xf39e46a82669d8f8), "__finalize", 8 };
+VarInfo __struct_info__c70a59dee7d757c8_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__89f87fddfa254636, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xe91a2e3649f8d2df), "channel", 16 };
+VarInfo __struct_info__c70a59dee7d757c8_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x49adcf947981896c), "x", 24 };
+VarInfo * __struct_info__c70a59dee7d757c8_fields[4] =  { &__struct_info__c70a59dee7d757c8_field_0, &__struct_info__c70a59dee7d757c8_field_1, &__struct_info__c70a59dee7d757c8_field_2, &__struct_info__c70a59dee7d757c8_field_3 };
+StructInfo __struct_info__c70a59dee7d757c8 = {"_lambda_thismodule_25_20_2", "", 6, __struct_info__c70a59dee7d757c8_fields, 4, 32, UINT64_C(0x0), nullptr, UINT64_C(0xc70a59dee7d757c8) };
+VarInfo __struct_info__e5095599a587ca50_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xed409bd07badf624), "x", 0 };
+VarInfo __struct_info__e5095599a587ca50_field_1 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xed408fd07bade1c0), "t", 4 };
+VarInfo * __struct_info__e5095599a587ca50_fields[2] =  { &__struct_info__e5095599a587ca50_field_0, &__struct_info__e5095599a587ca50_field_1 };
+StructInfo __struct_info__e5095599a587ca50 = {"Work", "", 0, __struct_info__e5095599a587ca50_fields, 2, 8, UINT64_C(0x0), nullptr, UINT64_C(0xe5095599a587ca50) };
+TypeInfo * __type_info__13f7c98505bae5c4_arg_types_var_4170349634411429127[1] = { &__type_info__87830cbb3176f4fe };
+VarInfo __struct_info__39e00ee5a445fd07_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__13f7c98505bae5c4_arg_types_var_4170349634411429127, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x13f7c98505bae5c4), "__lambda", 0 };
+TypeInfo * __type_info__85046dd2ed4bae71_arg_types_var_4170349634411429127[1] = { &__type_info__569f9f2b1331f4d2 };
+VarInfo __struct_info__39e00ee5a445fd07_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__85046dd2ed4bae71_arg_types_var_4170349634411429127, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x85046dd2ed4bae71), "__finalize", 8 };
+VarInfo __struct_info__39e00ee5a445fd07_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f707f193f39acb0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x1e12ac326c257baf), "status", 16 };
+VarInfo __struct_info__39e00ee5a445fd07_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x1dfee20f7761e187), "x", 24 };
+VarInfo __struct_info__39e00ee5a445fd07_field_4 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x1dfee10f7761dfd4), "y", 32 };
+VarInfo * __struct_info__39e00ee5a445fd07_fields[5] =  { &__struct_info__39e00ee5a445fd07_field_0, &__struct_info__39e00ee5a445fd07_field_1, &__struct_info__39e00ee5a445fd07_field_2, &__struct_info__39e00ee5a445fd07_field_3, &__struct_info__39e00ee5a445fd07_field_4 };
+StructInfo __struct_info__39e00ee5a445fd07 = {"_lambda_thismodule_16_20_1", "", 22, __struct_info__39e00ee5a445fd07_fields, 5, 56, UINT64_C(0x0), nullptr, UINT64_C(0x39e00ee5a445fd07) };
+TypeInfo * __type_info__bf0a7891be5e5b36_arg_types_var_9475594405323780877[1] = { &__type_info__de07e88d204ba4b0 };
+VarInfo __struct_info__838012e86500b30d_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__bf0a7891be5e5b36_arg_types_var_9475594405323780877, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0xbf0a7891be5e5b36), "__lambda", 0 };
+TypeInfo * __type_info__401fe9c0f41e9c3_arg_types_var_9475594405323780877[1] = { &__type_info__117f5cf4148559d4 };
+VarInfo __struct_info__838012e86500b30d_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__401fe9c0f41e9c3_arg_types_var_9475594405323780877, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x401fe9c0f41e9c3), "__finalize", 8 };
+VarInfo __struct_info__838012e86500b30d_field_2 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__89f87fddfa254636, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x3abde3f972d5b902), "channel", 16 };
+VarInfo __struct_info__838012e86500b30d_field_3 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x7395b868f21cfae9), "x", 24 };
+VarInfo * __struct_info__838012e86500b30d_fields[4] =  { &__struct_info__838012e86500b30d_field_0, &__struct_info__838012e86500b30d_field_1, &__struct_info__838012e86500b30d_field_2, &__struct_info__838012e86500b30d_field_3 };
+StructInfo __struct_info__838012e86500b30d = {"_lambda_thismodule_38_20_3", "", 6, __struct_info__838012e86500b30d_fields, 4, 32, UINT64_C(0x0), nullptr, UINT64_C(0x838012e86500b30d) };
+TypeInfo * __type_info__b8b4102db7595764_arg_types_var_2403449910317923495[2] = { &__type_info__f2b375a8773b443a, &__type_info__a7244f77d75ea149 };
+VarInfo __struct_info__215ac4f59bf1bca7_field_0 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__90f4c07b5a6e390, nullptr, (TypeInfo **)__type_info__b8b4102db7595764_arg_types_var_2403449910317923495, nullptr, 2, 0, nullptr, 28, 8, UINT64_C(0xb8b4102db7595764), "__lambda", 0 };
+TypeInfo * __type_info__1fca1d553ac3e011_arg_types_var_2403449910317923495[1] = { &__type_info__a0d441438a30bb26 };
+VarInfo __struct_info__215ac4f59bf1bca7_field_1 =  { Type::tFunction, nullptr, nullptr, nullptr, &__type_info__af63eb4c86020609, nullptr, (TypeInfo **)__type_info__1fca1d553ac3e011_arg_types_var_2403449910317923495, nullptr, 1, 0, nullptr, 28, 8, UINT64_C(0x1fca1d553ac3e011), "__finalize", 8 };
+VarInfo __struct_info__215ac4f59bf1bca7_field_2 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0x8b42cbb643d16300), "__yield", 16 };
+VarInfo __struct_info__215ac4f59bf1bca7_field_3 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__89f87fddfa254636, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xa448ad9158800d44), "channel", 24 };
+VarInfo __struct_info__215ac4f59bf1bca7_field_4 =  { Type::tPointer, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xed11594e4083ba86), "__void_data_rename_at_99", 32 };
+VarInfo * __struct_info__215ac4f59bf1bca7_fields[5] =  { &__struct_info__215ac4f59bf1bca7_field_0, &__struct_info__215ac4f59bf1bca7_field_1, &__struct_info__215ac4f59bf1bca7_field_2, &__struct_info__215ac4f59bf1bca7_field_3, &__struct_info__215ac4f59bf1bca7_field_4 };
+StructInfo __struct_info__215ac4f59bf1bca7 = {"_lambda_thismodule_98_12_4", "", 6, __struct_info__215ac4f59bf1bca7_fields, 5, 40, UINT64_C(0x0), nullptr, UINT64_C(0x215ac4f59bf1bca7) };
+VarInfo __func_info__cfb81a8365a0ae64_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__89f87fddfa254636, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xc68ce48f6c3a8ae9), "channel", 0 };
+VarInfo * __func_info__cfb81a8365a0ae64_fields[1] =  { &__func_info__cfb81a8365a0ae64_field_0 };
+FuncInfo __func_info__cfb81a8365a0ae64 = {"invoke block<(channel:jobque::Channel?):void> const", "", __func_info__cfb81a8365a0ae64_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xcfb81a8365a0ae64), 0x0 };
+VarInfo __func_info__e3ccd7343d92b33_field_0 =  { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__2f707f193f39acb0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x18aab86bb3264c3a), "status", 0 };
+VarInfo * __func_info__e3ccd7343d92b33_fields[1] =  { &__func_info__e3ccd7343d92b33_field_0 };
+FuncInfo __func_info__e3ccd7343d92b33 = {"invoke block<(status:jobque::JobStatus?):void> const", "", __func_info__e3ccd7343d92b33_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xe3ccd7343d92b33), 0x0 };
+VarInfo __func_info__3ad0a31d00c9d958_field_0 =  { Type::tStructure, &__struct_info__e5095599a587ca50, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 126, 8, UINT64_C(0x996b1cb2a31043fc), "w", 0 };
+VarInfo * __func_info__3ad0a31d00c9d958_fields[1] =  { &__func_info__3ad0a31d00c9d958_field_0 };
+FuncInfo __func_info__3ad0a31d00c9d958 = {"invoke block<(w:Work const#):void> const", "", __func_info__3ad0a31d00c9d958_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x3ad0a31d00c9d958), 0x0 };
+FuncInfo __func_info__eeb3b74c98cb09c3 = {"invoke block<void> const", "", nullptr, 0, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0xeeb3b74c98cb09c3), 0x0 };
+TypeInfo __type_info__a7244f77d75ea149 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__fe24a2dd43758fc9, nullptr, nullptr, nullptr, 0, 0, nullptr, 8461, 8, UINT64_C(0xa7244f77d75ea149) };
+TypeInfo __type_info__89f87fddfa254636 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~jobque::Channel"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 224, UINT64_C(0x89f87fddfa254636) };
+TypeInfo __type_info__569f9f2b1331f4d2 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__87830cbb3176f4fe, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x569f9f2b1331f4d2) };
+TypeInfo __type_info__baa4c4bc11614b7 = { Type::tStructure, &__struct_info__c70a59dee7d757c8, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 32, UINT64_C(0xbaa4c4bc11614b7) };
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__90f4c07b5a6e390 = { Type::tBool, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 1, UINT64_C(0x90f4c07b5a6e390) };
+TypeInfo __type_info__117f5cf4148559d4 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__de07e88d204ba4b0, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x117f5cf4148559d4) };
+TypeInfo __type_info__2f707f193f39acb0 = { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~jobque::JobStatus"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 2, 104, UINT64_C(0x2f707f193f39acb0) };
+TypeInfo __type_info__de07e88d204ba4b0 = { Type::tStructure, &__struct_info__838012e86500b30d, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 32, UINT64_C(0xde07e88d204ba4b0) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__f2b375a8773b443a = { Type::tStructure, &__struct_info__215ac4f59bf1bca7, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 8206, 40, UINT64_C(0xf2b375a8773b443a) };
+TypeInfo __type_info__527c1866e14c26a7 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__baa4c4bc11614b7, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0x527c1866e14c26a7) };
+TypeInfo __type_info__87830cbb3176f4fe = { Type::tStructure, &__struct_info__39e00ee5a445fd07, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 56, UINT64_C(0x87830cbb3176f4fe) };
+TypeInfo __type_info__fe24a2dd43758fc9 = { Type::tStructure, &__struct_info__e5095599a587ca50, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 126, 8, UINT64_C(0xfe24a2dd43758fc9) };
+TypeInfo __type_info__a0d441438a30bb26 = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__f2b375a8773b443a, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xa0d441438a30bb26) };
+
+static void resolveTypeInfoAnnotations()
+{
+	__type_info__89f87fddfa254636.resolveAnnotation();
+	__type_info__2f707f193f39acb0.resolveAnnotation();
+}
+
+namespace  { struct Work; };
+namespace  { struct _lambda_thismodule_16_20_1; };
+namespace  { struct _lambda_thismodule_25_20_2; };
+namespace  { struct _lambda_thismodule_38_20_3; };
+namespace  { struct _lambda_thismodule_98_12_4; };
+namespace  { struct _lambda_thismodule_16_20_1_new_job_clone; };
+namespace  { struct _lambda_thismodule_25_20_2_new_job_clone; };
+namespace  { struct _lambda_thismodule_38_20_3_new_job_clone; };
+namespace ast { struct AstFunctionAnnotation; };
+namespace ast { struct AstBlockAnnotation; };
+namespace ast { struct AstStructureAnnotation; };
+namespace ast { struct AstPassMacro; };
+namespace ast { struct AstVariantMacro; };
+namespace ast { struct AstForLoopMacro; };
+namespace ast { struct AstCaptureMacro; };
+namespace ast { struct AstSimulateMacro; };
+namespace ast { struct AstReaderMacro; };
+namespace ast { struct AstCommentReader; };
+namespace ast { struct AstCallMacro; };
+namespace ast { struct AstTypeInfoMacro; };
+namespace ast { struct AstEnumerationAnnotation; };
+namespace ast { struct AstVisitor; };
+namespace ast_boost { struct MacroMacro; };
+namespace ast_boost { struct TagFunctionAnnotation; };
+namespace ast_boost { struct TagStructureAnnotation; };
+namespace ast_boost { struct SetupAnyAnnotation; };
+namespace ast_boost { struct SetupFunctionAnnotatoin; };
+namespace ast_boost { struct SetupBlockAnnotatoin; };
+namespace ast_boost { struct SetupStructureAnnotatoin; };
+namespace ast_boost { struct SetupEnumerationAnnotation; };
+namespace ast_boost { struct SetupContractAnnotatoin; };
+namespace ast_boost { struct SetupReaderMacro; };
+namespace ast_boost { struct SetupCommentReader; };
+namespace ast_boost { struct SetupVariantMacro; };
+namespace ast_boost { struct SetupForLoopMacro; };
+namespace ast_boost { struct SetupCaptureMacro; };
+namespace ast_boost { struct SetupSimulateMacro; };
+namespace ast_boost { struct SetupCallMacro; };
+namespace ast_boost { struct SetupTypeInfoMacro; };
+namespace ast_boost { struct SetupInferMacro; };
+namespace ast_boost { struct SetupDirtyInferMacro; };
+namespace ast_boost { struct SetupLintMacro; };
+namespace ast_boost { struct SetupGlobalLintMacro; };
+namespace ast_boost { struct SetupOptimizationMacro; };
+namespace ast_boost { struct TagFunctionMacro; };
+namespace ast_boost { struct BetterRttiVisitor; };
+namespace templates { struct DecltypeMacro; };
+namespace templates { struct DecltypeNoRefMacro; };
+namespace templates { struct TemplateMacro; };
+namespace contracts { struct IsAnyType; };
+namespace contracts { struct IsAnyArrayMacro; };
+namespace contracts { struct IsDimMacro; };
+namespace contracts { struct IsNotDimMacro; };
+namespace contracts { struct IsAnyEnumMacro; };
+namespace contracts { struct IsAnyVectorType; };
+namespace contracts { struct IsAnyStructMacro; };
+namespace contracts { struct IsAnyNumericMacro; };
+namespace contracts { struct IsAnyWorkhorse; };
+namespace contracts { struct IsAnyWorkhorseNonPtrMacro; };
+namespace contracts { struct IsAnyTupleNonPtrMacro; };
+namespace contracts { struct IsAnyVariantNonPtrMacro; };
+namespace contracts { struct IsAnyFunctionNonPtrMacro; };
+namespace templates_boost { struct Template; };
+namespace templates_boost { struct TemplateVisitor; };
+namespace templates_boost { struct RemoveDerefVisitor; };
+namespace templates_boost { struct QRulesVisitor; };
+namespace templates_boost { struct AstQCallMacro; };
+namespace templates_boost { struct QMacro; };
+namespace templates_boost { struct QBlockMacro; };
+namespace templates_boost { struct QBlockToArrayMacro; };
+namespace templates_boost { struct QBlockExprMacro; };
+namespace templates_boost { struct QTypeMacro; };
+namespace templates_boost { struct AstQNamedMacro; };
+namespace templates_boost { struct AstQFunctionMacro; };
+namespace templates_boost { struct AstQVariableMacro; };
+namespace templates_boost { struct AstQNamedClassMacro; };
+namespace templates_boost { struct AstQMethodMacro; };
+namespace macro_boost { struct MacroVerifyMacro; };
+namespace jobque_boost { struct NewJobMacro; };
+namespace jobque_boost { struct ChannelAndStatusCapture; };
+// unused enumeration CompilationError
+// unused enumeration Type
+// unused enumeration RefMatters
+// unused enumeration ConstMatters
+// unused enumeration TemporaryMatters
+// unused enumeration SideEffects
+// unused enumeration CaptureMode
+// unused structure AstFunctionAnnotation
+// unused structure AstBlockAnnotation
+// unused structure AstStructureAnnotation
+// unused structure AstPassMacro
+// unused structure AstVariantMacro
+// unused structure AstForLoopMacro
+// unused structure AstCaptureMacro
+// unused structure AstSimulateMacro
+// unused structure AstReaderMacro
+// unused structure AstCommentReader
+// unused structure AstCallMacro
+// unused structure AstTypeInfoMacro
+// unused structure AstEnumerationAnnotation
+// unused structure AstVisitor
+// unused structure MacroMacro
+// unused structure TagFunctionAnnotation
+// unused structure TagStructureAnnotation
+// unused structure SetupAnyAnnotation
+// unused structure SetupFunctionAnnotatoin
+// unused structure SetupBlockAnnotatoin
+// unused structure SetupStructureAnnotatoin
+// unused structure SetupEnumerationAnnotation
+// unused structure SetupContractAnnotatoin
+// unused structure SetupReaderMacro
+// unused structure SetupCommentReader
+// unused structure SetupVariantMacro
+// unused structure SetupForLoopMacro
+// unused structure SetupCaptureMacro
+// unused structure SetupSimulateMacro
+// unused structure SetupCallMacro
+// unused structure SetupTypeInfoMacro
+// unused structure SetupInferMacro
+// unused structure SetupDirtyInferMacro
+// unused structure SetupLintMacro
+// unused structure SetupGlobalLintMacro
+// unused structure SetupOptimizationMacro
+// unused structure TagFunctionMacro
+// unused structure BetterRttiVisitor
+// unused structure DecltypeMacro
+// unused structure DecltypeNoRefMacro
+// unused structure TemplateMacro
+// unused structure IsAnyType
+// unused structure IsAnyArrayMacro
+// unused structure IsDimMacro
+// unused structure IsNotDimMacro
+// unused structure IsAnyEnumMacro
+// unused structure IsAnyVectorType
+// unused structure IsAnyStructMacro
+// unused structure IsAnyNumericMacro
+// unused structure IsAnyWorkhorse
+// unused structure IsAnyWorkhorseNonPtrMacro
+// unused structure IsAnyTupleNonPtrMacro
+// unused structure IsAnyVariantNonPtrMacro
+// unused structure IsAnyFunctionNonPtrMacro
+// unused structure Template
+// unused structure TemplateVisitor
+// unused structure RemoveDerefVisitor
+// unused structure QRulesVisitor
+// unused structure AstQCallMacro
+// unused structure QMacro
+// unused structure QBlockMacro
+// unused structure QBlockToArrayMacro
+// unused structure QBlockExprMacro
+// unused structure QTypeMacro
+// unused structure AstQNamedMacro
+// unused structure AstQFunctionMacro
+// unused structure AstQVariableMacro
+// unused structure AstQNamedClassMacro
+// unused structure AstQMethodMacro
+// unused structure MacroVerifyMacro
+// unused structure NewJobMacro
+// unused structure ChannelAndStatusCapture
+namespace  {
+
+struct Work {
+	int32_t x;
+	int32_t t;
+};
+static_assert(sizeof(Work)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Work,x)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(Work,t)==4,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_16_20_1 {
+	Func DAS_COMMENT((void,_lambda_thismodule_16_20_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_16_20_1 *)) __finalize;
+	JobStatus * status;
+	int32_t x;
+	TArray<int32_t> y;
+};
+static_assert(sizeof(_lambda_thismodule_16_20_1)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1,status)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1,y)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_25_20_2 {
+	Func DAS_COMMENT((void,_lambda_thismodule_25_20_2)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_25_20_2 *)) __finalize;
+	Channel * channel;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_25_20_2)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_25_20_2,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_25_20_2,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_25_20_2,channel)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_25_20_2,x)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_38_20_3 {
+	Func DAS_COMMENT((void,_lambda_thismodule_38_20_3)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_38_20_3 *)) __finalize;
+	Channel * channel;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_38_20_3)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_20_3,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_20_3,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_20_3,channel)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_20_3,x)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_98_12_4 {
+	Func DAS_COMMENT((bool,_lambda_thismodule_98_12_4,Work const  * &)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_98_12_4 *)) __finalize;
+	int32_t __yield;
+	Channel * channel;
+	void * __void_data_rename_at_99;
+};
+static_assert(sizeof(_lambda_thismodule_98_12_4)==40,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_98_12_4,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_98_12_4,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_98_12_4,__yield)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_98_12_4,channel)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_98_12_4,__void_data_rename_at_99)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_16_20_1_new_job_clone {
+	Func DAS_COMMENT((void,_lambda_thismodule_16_20_1)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_16_20_1 *)) __finalize;
+	JobStatus * status;
+	int32_t x;
+	TArray<int32_t> y;
+};
+static_assert(sizeof(_lambda_thismodule_16_20_1_new_job_clone)==56,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1_new_job_clone,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1_new_job_clone,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1_new_job_clone,status)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1_new_job_clone,x)==24,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_16_20_1_new_job_clone,y)==32,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_25_20_2_new_job_clone {
+	Func DAS_COMMENT((void,_lambda_thismodule_25_20_2)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_25_20_2 *)) __finalize;
+	Channel * channel;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_25_20_2_new_job_clone)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_25_20_2_new_job_clone,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_25_20_2_new_job_clone,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_25_20_2_new_job_clone,channel)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_25_20_2_new_job_clone,x)==24,"structure field offset mismatch with DAS");
+}
+namespace  {
+
+struct _lambda_thismodule_38_20_3_new_job_clone {
+	Func DAS_COMMENT((void,_lambda_thismodule_38_20_3)) __lambda;
+	Func DAS_COMMENT((void,_lambda_thismodule_38_20_3 *)) __finalize;
+	Channel * channel;
+	int32_t x;
+};
+static_assert(sizeof(_lambda_thismodule_38_20_3_new_job_clone)==32,"structure size mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_20_3_new_job_clone,__lambda)==0,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_20_3_new_job_clone,__finalize)==8,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_20_3_new_job_clone,channel)==16,"structure field offset mismatch with DAS");
+static_assert(offsetof(_lambda_thismodule_38_20_3_new_job_clone,x)==24,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline void _Funcbuiltin_0x60_clone_4bc3594d348ca0bd ( Context * __context__, TArray<int32_t> & __a_rename_at_331, TArray<int32_t> const  & __b_rename_at_331 );
+inline void finalize_77ff79d1e3c2237d ( Context * __context__, _lambda_thismodule_98_12_4 & ____this_rename_at_98 );
+inline Sequence DAS_COMMENT((Work const  &)) _Funcbuiltin_0x60_each_ref_d7642bb9cae45024 ( Context * __context__, Lambda DAS_COMMENT((bool,Work const  * &)) const  __lam_rename_at_483 );
+inline void finalize_bb0ef778d3414e1 ( Context * __context__, _lambda_thismodule_16_20_1 & ____this_rename_at_16 );
+inline void finalize_2310198c3f5c050c ( Context * __context__, _lambda_thismodule_25_20_2 & ____this_rename_at_25 );
+inline void finalize_c6cfad95212c91a3 ( Context * __context__, _lambda_thismodule_38_20_3 & ____this_rename_at_38 );
+inline bool _Func_lambda_thismodule_98_12_4_0x60_function_df8ba0e1ea096f5e ( Context * __context__, _lambda_thismodule_98_12_4 & ____this_rename_at_98, Work const  * & ___ryield98_rename_at_98 );
+inline void _Func_lambda_thismodule_98_12_4_0x60_finalizer_2a5c332297ddb46 ( Context * __context__, _lambda_thismodule_98_12_4 * ____this_rename_at_98 );
+inline void clone_f22a49f16d5e014d ( Context * __context__, _lambda_thismodule_16_20_1_new_job_clone & __a_rename_at_16, _lambda_thismodule_16_20_1_new_job_clone const  & __b_rename_at_16 );
+inline void clone_c8c1a4dd7f2f9a41 ( Context * __context__, _lambda_thismodule_25_20_2_new_job_clone & __a_rename_at_25, _lambda_thismodule_25_20_2_new_job_clone const  & __b_rename_at_25 );
+inline void clone_8ddf918c99b89333 ( Context * __context__, _lambda_thismodule_38_20_3_new_job_clone & __a_rename_at_38, _lambda_thismodule_38_20_3_new_job_clone const  & __b_rename_at_38 );
+inline Sequence DAS_COMMENT((Work const  &)) _Func_0x60_template_0x60_0x1cf5d8acf12a4409_0x60_jobque_boost_0x60_each_b6e776b90f1f19fe ( Context * __context__, Channel * __channel_rename_at_92 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline void _Func_lambda_thismodule_16_20_1_0x60_function_4eb9160b7c053bd2 ( Context * __context__, _lambda_thismodule_16_20_1 & ____this_rename_at_16 );
+inline void _Func_lambda_thismodule_16_20_1_0x60_finalizer_4fdddf92fd17908a ( Context * __context__, _lambda_thismodule_16_20_1 * ____this_rename_at_16 );
+inline void _Funcjobque_boost_0x60_push_clone_771ab102bd085e2b ( Context * __context__, Channel * const  __channel_rename_at_81, Work const  & __data_rename_at_81 );
+inline void _Func_lambda_thismodule_25_20_2_0x60_function_f26aa3b78a6f8e9e ( Context * __context__, _lambda_thismodule_25_20_2 & ____this_rename_at_25 );
+inline void _Func_lambda_thismodule_25_20_2_0x60_finalizer_99287f364d0fe9b4 ( Context * __context__, _lambda_thismodule_25_20_2 * ____this_rename_at_25 );
+inline void _Funcjobque_boost_0x60_for_each_d3cef10387b2669e ( Context * __context__, Channel * const  __channel_rename_at_69, Block DAS_COMMENT((void,Work const )) const  & __blk_rename_at_69 );
+inline void _Func_lambda_thismodule_38_20_3_0x60_function_c0f745f9b12da0af ( Context * __context__, _lambda_thismodule_38_20_3 & ____this_rename_at_38 );
+inline void _Func_lambda_thismodule_38_20_3_0x60_finalizer_4c08ba03df06924a ( Context * __context__, _lambda_thismodule_38_20_3 * ____this_rename_at_38 );
+inline bool test_e5673fbfad6d4a49 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline void _Funcbuiltin_0x60_clone_4bc3594d348ca0bd ( Context * __context__, TArray<int32_t> &  __a_rename_at_331, TArray<int32_t> const  &  __b_rename_at_331 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_331),builtin_array_size(__b_rename_at_331));
+	{
+		bool __need_loop_333 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_331);
+		int32_t * __aV_rename_at_333;
+		__need_loop_333 = __aV_iterator.first(__context__,(__aV_rename_at_333)) && __need_loop_333;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_331);
+		int32_t const  * __bV_rename_at_333;
+		__need_loop_333 = __bV_iterator.first(__context__,(__bV_rename_at_333)) && __need_loop_333;
+		for ( ; __need_loop_333 ; __need_loop_333 = __aV_iterator.next(__context__,(__aV_rename_at_333)) && __bV_iterator.next(__context__,(__bV_rename_at_333)) )
+		{
+			das_copy((*__aV_rename_at_333),(*__bV_rename_at_333));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_333));
+		__bV_iterator.close(__context__,(__bV_rename_at_333));
+	};
+}
+
+inline void finalize_77ff79d1e3c2237d ( Context * __context__, _lambda_thismodule_98_12_4 &  ____this_rename_at_98 )
+{
+	memset(&(____this_rename_at_98), 0, 40);
+}
+
+inline Sequence DAS_COMMENT((Work const  &)) _Funcbuiltin_0x60_each_ref_d7642bb9cae45024 ( Context * __context__, Lambda DAS_COMMENT((bool,Work const  * &)) const  __lam_rename_at_483 )
+{
+	Sequence DAS_COMMENT((Work *)) __it_rename_at_484; das_zero(__it_rename_at_484);
+	builtin_make_lambda_iterator(das_arg<Sequence DAS_COMMENT((Work const ))>::pass(__it_rename_at_484),__lam_rename_at_483,8,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((Work const  &))>::cast(__it_rename_at_484);
+}
+
+inline void finalize_bb0ef778d3414e1 ( Context * __context__, _lambda_thismodule_16_20_1 &  ____this_rename_at_16 )
+{
+	memset(&(____this_rename_at_16), 0, 56);
+}
+
+inline void finalize_2310198c3f5c050c ( Context * __context__, _lambda_thismodule_25_20_2 &  ____this_rename_at_25 )
+{
+	memset(&(____this_rename_at_25), 0, 32);
+}
+
+inline void finalize_c6cfad95212c91a3 ( Context * __context__, _lambda_thismodule_38_20_3 &  ____this_rename_at_38 )
+{
+	memset(&(____this_rename_at_38), 0, 32);
+}
+
+inline bool _Func_lambda_thismodule_98_12_4_0x60_function_df8ba0e1ea096f5e ( Context * __context__, _lambda_thismodule_98_12_4 &  ____this_rename_at_98, Work const  * & ___ryield98_rename_at_98 )
+{
+	switch (____this_rename_at_98.__yield) {
+	case 0: goto label_0;
+	case 2: goto label_2;
+	case 1: goto label_1;
+	case 3: goto label_3;
+	default: __context__->throw_error("invalid label");
+	};
+	label_0:;;
+	label_2:;;
+	das_copy(____this_rename_at_98.__void_data_rename_at_99,channelPop(____this_rename_at_98.channel,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+	if ( ____this_rename_at_98.__void_data_rename_at_99 == nullptr )
+	{
+		goto label_3;
+	};
+	das_copy(___ryield98_rename_at_98,das_ref(__context__,das_deref(__context__,das_cast<Work const  *>::cast(____this_rename_at_98.__void_data_rename_at_99))));
+	das_copy(____this_rename_at_98.__yield,1);
+	return das_auto_cast<bool>::cast(true);
+	label_1:;;
+	goto label_2;
+	label_3:;;
+	channelReleaseRef(____this_rename_at_98.channel,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(false);
+}
+
+inline void _Func_lambda_thismodule_98_12_4_0x60_finalizer_2a5c332297ddb46 ( Context * __context__, _lambda_thismodule_98_12_4 * ____this_rename_at_98 )
+{
+	finalize_77ff79d1e3c2237d(__context__,das_arg<_lambda_thismodule_98_12_4>::pass(das_deref(__context__,____this_rename_at_98)));
+	das_delete_lambda_struct<_lambda_thismodule_98_12_4 *>::clear(__context__,____this_rename_at_98);
+}
+
+inline void clone_f22a49f16d5e014d ( Context * __context__, _lambda_thismodule_16_20_1_new_job_clone &  __a_rename_at_16, _lambda_thismodule_16_20_1_new_job_clone const  &  __b_rename_at_16 )
+{
+	das_copy(__a_rename_at_16.__lambda,__b_rename_at_16.__lambda);
+	das_copy(__a_rename_at_16.__finalize,__b_rename_at_16.__finalize);
+	das_copy(__a_rename_at_16.status,__b_rename_at_16.status);
+	das_copy(__a_rename_at_16.x,__b_rename_at_16.x);
+	_Funcbuiltin_0x60_clone_4bc3594d348ca0bd(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_16.y),__b_rename_at_16.y);
+}
+
+inline void clone_c8c1a4dd7f2f9a41 ( Context * __context__, _lambda_thismodule_25_20_2_new_job_clone &  __a_rename_at_25, _lambda_thismodule_25_20_2_new_job_clone const  &  __b_rename_at_25 )
+{
+	das_copy(__a_rename_at_25.__lambda,__b_rename_at_25.__lambda);
+	das_copy(__a_rename_at_25.__finalize,__b_rename_at_25.__finalize);
+	das_copy(__a_rename_at_25.channel,__b_rename_at_25.channel);
+	das_copy(__a_rename_at_25.x,__b_rename_at_25.x);
+}
+
+inline void clone_8ddf918c99b89333 ( Context * __context__, _lambda_thismodule_38_20_3_new_job_clone &  __a_rename_at_38, _lambda_thismodule_38_20_3_new_job_clone const  &  __b_rename_at_38 )
+{
+	das_copy(__a_rename_at_38.__lambda,__b_rename_at_38.__lambda);
+	das_copy(__a_rename_at_38.__finalize,__b_rename_at_38.__finalize);
+	das_copy(__a_rename_at_38.channel,__b_rename_at_38.channel);
+	das_copy(__a_rename_at_38.x,__b_rename_at_38.x);
+}
+
+inline Sequence DAS_COMMENT((Work const  &)) _Func_0x60_template_0x60_0x1cf5d8acf12a4409_0x60_jobque_boost_0x60_each_b6e776b90f1f19fe ( Context * __context__, Channel * __channel_rename_at_92 )
+{
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((Work const  &))>::cast(_Funcbuiltin_0x60_each_ref_d7642bb9cae45024(__context__,das_ascend<bool,_lambda_thismodule_98_12_4>::make(__context__,&__type_info__f2b375a8773b443a,(([&]() -> _lambda_thismodule_98_12_4 {
+		_lambda_thismodule_98_12_4 __mks_97;
+		das_zero(__mks_97);
+		das_copy((__mks_97.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_98_12_4`function XS<::_lambda_thismodule_98_12_4> &1<C#XS<::Work>>?*/ 18328178643916128732u))));
+		das_copy((__mks_97.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_98_12_4`finalizer X1<S<::_lambda_thismodule_98_12_4>>?*/ 2953384274094813136u))));
+		das_copy((__mks_97.channel),(das_invoke_function<Channel *>::invoke<Channel * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::capture_jobque_channel C1<H<jobque::Channel>>?*/ 14129945787985015456u)),__channel_rename_at_92)));
+		return __mks_97;
+	})()))));
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void _Func_lambda_thismodule_16_20_1_0x60_function_4eb9160b7c053bd2 ( Context * __context__, _lambda_thismodule_16_20_1 &  ____this_rename_at_16 )
+{
+/* finally */ auto __finally_16= das_finally([&](){
+	das_invoke_function<void>::invoke<JobStatus * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::release_capture_jobque_job_status C1<H<jobque::JobStatus>>?*/ 13882985380930343467u)),____this_rename_at_16.status);
+/* end finally */ });
+	DAS_ASSERT((builtin_array_size(das_arg<TArray<int32_t>>::pass(____this_rename_at_16.y)) == 3));
+	{
+		bool __need_loop_17 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_17;
+		__need_loop_17 = __t_iterator.first(__context__,(__t_rename_at_17)) && __need_loop_17;
+		// c : int&
+		das_iterator<TArray<int32_t>> __c_iterator(____this_rename_at_16.y);
+		int32_t * __c_rename_at_17;
+		__need_loop_17 = __c_iterator.first(__context__,(__c_rename_at_17)) && __need_loop_17;
+		for ( ; __need_loop_17 ; __need_loop_17 = __t_iterator.next(__context__,(__t_rename_at_17)) && __c_iterator.next(__context__,(__c_rename_at_17)) )
+		{
+			DAS_ASSERT(((__t_rename_at_17 + ____this_rename_at_16.x) == (*__c_rename_at_17)));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_17));
+		__c_iterator.close(__context__,(__c_rename_at_17));
+	};
+	notifyAndReleaseJob(____this_rename_at_16.status,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_16_20_1_0x60_finalizer_4fdddf92fd17908a ( Context * __context__, _lambda_thismodule_16_20_1 * ____this_rename_at_16 )
+{
+	finalize_bb0ef778d3414e1(__context__,das_arg<_lambda_thismodule_16_20_1>::pass(das_deref(__context__,____this_rename_at_16)));
+	das_delete_lambda_struct<_lambda_thismodule_16_20_1 *>::clear(__context__,____this_rename_at_16);
+}
+
+inline void _Funcjobque_boost_0x60_push_clone_771ab102bd085e2b ( Context * __context__, Channel * const  __channel_rename_at_81, Work const  &  __data_rename_at_81 )
+{
+	Work * __heap_data_rename_at_83 = das_new<Work>::make(__context__);
+	das_copy(das_deref(__context__,__heap_data_rename_at_83),__data_rename_at_81);
+	channelPush(__channel_rename_at_81,das_auto_cast<void * const >::cast(__heap_data_rename_at_83),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_25_20_2_0x60_function_f26aa3b78a6f8e9e ( Context * __context__, _lambda_thismodule_25_20_2 &  ____this_rename_at_25 )
+{
+/* finally */ auto __finally_25= das_finally([&](){
+	das_invoke_function<void>::invoke<Channel * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::release_capture_jobque_channel C1<H<jobque::Channel>>?*/ 5115173217570402306u)),____this_rename_at_25.channel);
+/* end finally */ });
+	{
+		bool __need_loop_25 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_25;
+		__need_loop_25 = __t_iterator.first(__context__,(__t_rename_at_25)) && __need_loop_25;
+		for ( ; __need_loop_25 ; __need_loop_25 = __t_iterator.next(__context__,(__t_rename_at_25)) )
+		{
+			Work _temp_make_local_26_48_48;
+			_Funcjobque_boost_0x60_push_clone_771ab102bd085e2b(__context__,____this_rename_at_25.channel,das_arg<Work>::pass((([&]() -> Work& {
+				das_copy((_temp_make_local_26_48_48.x),(____this_rename_at_25.x));
+				das_copy((_temp_make_local_26_48_48.t),(__t_rename_at_25));
+				return _temp_make_local_26_48_48;
+			})())));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_25));
+	};
+	notifyAndReleaseChannel(____this_rename_at_25.channel,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_25_20_2_0x60_finalizer_99287f364d0fe9b4 ( Context * __context__, _lambda_thismodule_25_20_2 * ____this_rename_at_25 )
+{
+	finalize_2310198c3f5c050c(__context__,das_arg<_lambda_thismodule_25_20_2>::pass(das_deref(__context__,____this_rename_at_25)));
+	das_delete_lambda_struct<_lambda_thismodule_25_20_2 *>::clear(__context__,____this_rename_at_25);
+}
+
+inline void _Funcjobque_boost_0x60_for_each_d3cef10387b2669e ( Context * __context__, Channel * const  __channel_rename_at_69, Block DAS_COMMENT((void,Work const )) const  &  __blk_rename_at_69 )
+{
+	while ( true )
+	{
+		void * __void_data_rename_at_74 = ((void *)channelPop(__channel_rename_at_69,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL))));
+		if ( __void_data_rename_at_74 == nullptr )
+		{
+			break;
+		} else {
+			Work const  * __typed_data_rename_at_78 = ((Work const  *)das_cast<Work const  *>::cast(__void_data_rename_at_74));
+			das_invoke<void>::invoke<Work const  &>(__context__,nullptr,__blk_rename_at_69,das_deref(__context__,__typed_data_rename_at_78));
+		};
+	};
+}
+
+inline void _Func_lambda_thismodule_38_20_3_0x60_function_c0f745f9b12da0af ( Context * __context__, _lambda_thismodule_38_20_3 &  ____this_rename_at_38 )
+{
+/* finally */ auto __finally_38= das_finally([&](){
+	das_invoke_function<void>::invoke<Channel * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::release_capture_jobque_channel C1<H<jobque::Channel>>?*/ 5115173217570402306u)),____this_rename_at_38.channel);
+/* end finally */ });
+	{
+		bool __need_loop_38 = true;
+		// t : int const
+		das_iterator<range> __t_iterator(range(0,3));
+		int32_t __t_rename_at_38;
+		__need_loop_38 = __t_iterator.first(__context__,(__t_rename_at_38)) && __need_loop_38;
+		for ( ; __need_loop_38 ; __need_loop_38 = __t_iterator.next(__context__,(__t_rename_at_38)) )
+		{
+			Work _temp_make_local_39_48_48;
+			_Funcjobque_boost_0x60_push_clone_771ab102bd085e2b(__context__,____this_rename_at_38.channel,das_arg<Work>::pass((([&]() -> Work& {
+				das_copy((_temp_make_local_39_48_48.x),(____this_rename_at_38.x));
+				das_copy((_temp_make_local_39_48_48.t),(__t_rename_at_38));
+				return _temp_make_local_39_48_48;
+			})())));
+		}
+		__t_iterator.close(__context__,(__t_rename_at_38));
+	};
+	notifyAndReleaseChannel(____this_rename_at_38.channel,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}
+
+inline void _Func_lambda_thismodule_38_20_3_0x60_finalizer_4c08ba03df06924a ( Context * __context__, _lambda_thismodule_38_20_3 * ____this_rename_at_38 )
+{
+	finalize_c6cfad95212c91a3(__context__,das_arg<_lambda_thismodule_38_20_3>::pass(das_deref(__context__,____this_rename_at_38)));
+	das_delete_lambda_struct<_lambda_thismodule_38_20_3 *>::clear(__context__,____this_rename_at_38);
+}
+
+inline bool test_e5673fbfad6d4a49 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,320,"test " DAS_FILE_LINE);
+{
+	withJobQue(das_make_block<void>(__context__,0,0,&__func_info__eeb3b74c98cb09c3,[&]() -> void{
+		withJobStatus(5,das_make_block<void,JobStatus *>(__context__,128,0,&__func_info__e3ccd7343d92b33,[&](JobStatus * __status_rename_at_12) -> void{
+			{
+				bool __need_loop_13 = true;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,5));
+				int32_t __x_rename_at_13;
+				__need_loop_13 = __x_iterator.first(__context__,(__x_rename_at_13)) && __need_loop_13;
+				for ( ; __need_loop_13 ; __need_loop_13 = __x_iterator.next(__context__,(__x_rename_at_13)) )
+				{
+					TArray<int32_t> __y_rename_at_14; das_zero(__y_rename_at_14); das_move(__y_rename_at_14, das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<int32_t>{
+						TArray<int32_t> ____acomp_14_rename_at_14; das_zero(____acomp_14_rename_at_14);
+						builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_14_rename_at_14),false);
+						{
+							bool __need_loop_14 = true;
+							// t : int const
+							das_iterator<range> __t_iterator(range(0,3));
+							int32_t __t_rename_at_14;
+							__need_loop_14 = __t_iterator.first(__context__,(__t_rename_at_14)) && __need_loop_14;
+							for ( ; __need_loop_14 ; __need_loop_14 = __t_iterator.next(__context__,(__t_rename_at_14)) )
+							{
+								_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____acomp_14_rename_at_14),__t_rename_at_14 + __x_rename_at_13);
+							}
+							__t_iterator.close(__context__,(__t_rename_at_14));
+						};
+						builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_14_rename_at_14),true);
+						return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(____acomp_14_rename_at_14);
+					}));
+					new_job_invoke(das_ascend<void,_lambda_thismodule_16_20_1>::make(__context__,&__type_info__87830cbb3176f4fe,(([&]() -> _lambda_thismodule_16_20_1 {
+						_lambda_thismodule_16_20_1 __mks_16;
+						das_copy((__mks_16.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_16_20_1`function XS<::_lambda_thismodule_16_20_1>*/ 1272212481320918938u))));
+						das_copy((__mks_16.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_16_20_1`finalizer X1<S<::_lambda_thismodule_16_20_1>>?*/ 3481368400536447312u))));
+						das_copy((__mks_16.status),(das_invoke_function<JobStatus *>::invoke<JobStatus * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::capture_jobque_job_status C1<H<jobque::JobStatus>>?*/ 15451494409577770137u)),__status_rename_at_12)));
+						das_copy((__mks_16.x),(__x_rename_at_13));
+						das_move((__mks_16.y),(__y_rename_at_14));
+						return __mks_16;
+					})())),Func(__context__->fnByMangledName(/*clone XS<::_lambda_thismodule_16_20_1_new_job_clone> CIS<::_lambda_thismodule_16_20_1_new_job_clone>*/ 5392471600106507002u)),56,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_13));
+			};
+			waitForJob(__status_rename_at_12,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		withChannelEx(5,das_make_block<void,Channel *>(__context__,128,0,&__func_info__cfb81a8365a0ae64,[&](Channel * __channel_rename_at_22) -> void{
+			{
+				bool __need_loop_23 = true;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,5));
+				int32_t __x_rename_at_23;
+				__need_loop_23 = __x_iterator.first(__context__,(__x_rename_at_23)) && __need_loop_23;
+				for ( ; __need_loop_23 ; __need_loop_23 = __x_iterator.next(__context__,(__x_rename_at_23)) )
+				{
+					new_job_invoke(das_ascend<void,_lambda_thismodule_25_20_2>::make(__context__,&__type_info__baa4c4bc11614b7,(([&]() -> _lambda_thismodule_25_20_2 {
+						_lambda_thismodule_25_20_2 __mks_25;
+						das_copy((__mks_25.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_25_20_2`function XS<::_lambda_thismodule_25_20_2>*/ 16545670980346322864u))));
+						das_copy((__mks_25.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_25_20_2`finalizer X1<S<::_lambda_thismodule_25_20_2>>?*/ 11449628549393116428u))));
+						das_copy((__mks_25.channel),(das_invoke_function<Channel *>::invoke<Channel * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::capture_jobque_channel C1<H<jobque::Channel>>?*/ 14129945787985015456u)),__channel_rename_at_22)));
+						das_copy((__mks_25.x),(__x_rename_at_23));
+						return __mks_25;
+					})())),Func(__context__->fnByMangledName(/*clone XS<::_lambda_thismodule_25_20_2_new_job_clone> CIS<::_lambda_thismodule_25_20_2_new_job_clone>*/ 9001411922300667902u)),32,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_23));
+			};
+			int32_t __summ_rename_at_28 = 0;
+			_Funcjobque_boost_0x60_for_each_d3cef10387b2669e(__context__,__channel_rename_at_22,das_make_block<void,Work const  &>(__context__,208,0,&__func_info__3ad0a31d00c9d958,[&](Work const  & __w_rename_at_29) -> void{
+				__summ_rename_at_28 += (__w_rename_at_29.x * __w_rename_at_29.t);
+			}));
+			DAS_ASSERT((__summ_rename_at_28 == 30));
+			DAS_ASSERT((__channel_rename_at_22->isEmpty() /*isEmpty*/));
+			DAS_ASSERT((__channel_rename_at_22->isReady() /*isReady*/));
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+		withChannelEx(5,das_make_block<void,Channel *>(__context__,128,0,&__func_info__cfb81a8365a0ae64,[&](Channel * __channel_rename_at_35) -> void{
+			Sequence DAS_COMMENT((Work *)) _temp_make_local_42_21_160;
+			{
+				bool __need_loop_36 = true;
+				// x : int const
+				das_iterator<range> __x_iterator(range(0,5));
+				int32_t __x_rename_at_36;
+				__need_loop_36 = __x_iterator.first(__context__,(__x_rename_at_36)) && __need_loop_36;
+				for ( ; __need_loop_36 ; __need_loop_36 = __x_iterator.next(__context__,(__x_rename_at_36)) )
+				{
+					new_job_invoke(das_ascend<void,_lambda_thismodule_38_20_3>::make(__context__,&__type_info__de07e88d204ba4b0,(([&]() -> _lambda_thismodule_38_20_3 {
+						_lambda_thismodule_38_20_3 __mks_38;
+						das_copy((__mks_38.__lambda),(Func(__context__->fnByMangledName(/*_lambda_thismodule_38_20_3`function XS<::_lambda_thismodule_38_20_3>*/ 4864509860894236834u))));
+						das_copy((__mks_38.__finalize),(Func(__context__->fnByMangledName(/*_lambda_thismodule_38_20_3`finalizer X1<S<::_lambda_thismodule_38_20_3>>?*/ 16509389861020951620u))));
+						das_copy((__mks_38.channel),(das_invoke_function<Channel *>::invoke<Channel * const >(__context__,nullptr,Func(__context__->fnByMangledName(/*@jobque_boost::capture_jobque_channel C1<H<jobque::Channel>>?*/ 14129945787985015456u)),__channel_rename_at_35)));
+						das_copy((__mks_38.x),(__x_rename_at_36));
+						return __mks_38;
+					})())),Func(__context__->fnByMangledName(/*clone XS<::_lambda_thismodule_38_20_3_new_job_clone> CIS<::_lambda_thismodule_38_20_3_new_job_clone>*/ 7841980842205359938u)),32,__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+				}
+				__x_iterator.close(__context__,(__x_rename_at_36));
+			};
+			int32_t __summ_rename_at_41 = 0;
+			{
+				bool __need_loop_42 = true;
+				// w : Work const&#
+				das_iterator<Sequence DAS_COMMENT((Work const ))> __w_iterator((_temp_make_local_42_21_160 = (_Func_0x60_template_0x60_0x1cf5d8acf12a4409_0x60_jobque_boost_0x60_each_b6e776b90f1f19fe(__context__,__channel_rename_at_35))));
+				Work const  * __w_rename_at_42;
+				__need_loop_42 = __w_iterator.first(__context__,(__w_rename_at_42)) && __need_loop_42;
+				for ( ; __need_loop_42 ; __need_loop_42 = __w_iterator.next(__context__,(__w_rename_at_42)) )
+				{
+					__summ_rename_at_41 += ((*__w_rename_at_42).x * (*__w_rename_at_42).t);
+				}
+				__w_iterator.close(__context__,(__w_rename_at_42));
+			};
+			DAS_ASSERT((__summ_rename_at_41 == 30));
+			DAS_ASSERT((__channel_rename_at_35->isEmpty() /*isEmpty*/));
+			DAS_ASSERT((__channel_rename_at_35->isReady() /*isReady*/));
+		}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Funcbuiltin_0x60_clone_4bc3594d348ca0bd
+	aotLib[0x1366ab6fb285c311] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_4bc3594d348ca0bd>>();
+	};
+	// finalize_77ff79d1e3c2237d
+	aotLib[0x7835d6cefa3681f9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_98_12_4 &  ),&finalize_77ff79d1e3c2237d>>();
+	};
+	// _Funcbuiltin_0x60_each_ref_d7642bb9cae45024
+	aotLib[0xb4a3fcd5f7a65399] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((Work const  &)) (*) ( Context * __context__, Lambda DAS_COMMENT((bool,Work const  * &)) const   ),&_Funcbuiltin_0x60_each_ref_d7642bb9cae45024>>();
+	};
+	// finalize_bb0ef778d3414e1
+	aotLib[0xc57bf28147f3f161] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_16_20_1 &  ),&finalize_bb0ef778d3414e1>>();
+	};
+	// finalize_2310198c3f5c050c
+	aotLib[0xae6ee47cd45ef105] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_25_20_2 &  ),&finalize_2310198c3f5c050c>>();
+	};
+	// finalize_c6cfad95212c91a3
+	aotLib[0xc9cc0a3f86f87b15] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_38_20_3 &  ),&finalize_c6cfad95212c91a3>>();
+	};
+	// _Func_lambda_thismodule_98_12_4_0x60_function_df8ba0e1ea096f5e
+	aotLib[0x60223c3b06394939] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__, _lambda_thismodule_98_12_4 & , Work const  * &  ),&_Func_lambda_thismodule_98_12_4_0x60_function_df8ba0e1ea096f5e>>();
+	};
+	// _Func_lambda_thismodule_98_12_4_0x60_finalizer_2a5c332297ddb46
+	aotLib[0xdb5629b62819ff02] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_98_12_4 *  ),&_Func_lambda_thismodule_98_12_4_0x60_finalizer_2a5c332297ddb46>>();
+	};
+	// clone_f22a49f16d5e014d
+	aotLib[0x34aad1a44bbd428c] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_16_20_1_new_job_clone & , _lambda_thismodule_16_20_1_new_job_clone const  &  ),&clone_f22a49f16d5e014d>>();
+	};
+	// clone_c8c1a4dd7f2f9a41
+	aotLib[0xbbedbf5bbcb5a441] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_25_20_2_new_job_clone & , _lambda_thismodule_25_20_2_new_job_clone const  &  ),&clone_c8c1a4dd7f2f9a41>>();
+	};
+	// clone_8ddf918c99b89333
+	aotLib[0xae9104c6f6656dad] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_38_20_3_new_job_clone & , _lambda_thismodule_38_20_3_new_job_clone const  &  ),&clone_8ddf918c99b89333>>();
+	};
+	// _Func_0x60_template_0x60_0x1cf5d8acf12a4409_0x60_jobque_boost_0x60_each_b6e776b90f1f19fe
+	aotLib[0x6b3c74fe264f140f] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((Work const  &)) (*) ( Context * __context__, Channel *  ),&_Func_0x60_template_0x60_0x1cf5d8acf12a4409_0x60_jobque_boost_0x60_each_b6e776b90f1f19fe>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// _Func_lambda_thismodule_16_20_1_0x60_function_4eb9160b7c053bd2
+	aotLib[0xd0d89c539218a6a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_16_20_1 &  ),&_Func_lambda_thismodule_16_20_1_0x60_function_4eb9160b7c053bd2>>();
+	};
+	// _Func_lambda_thismodule_16_20_1_0x60_finalizer_4fdddf92fd17908a
+	aotLib[0xee784b14d64ebd84] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_16_20_1 *  ),&_Func_lambda_thismodule_16_20_1_0x60_finalizer_4fdddf92fd17908a>>();
+	};
+	// _Funcjobque_boost_0x60_push_clone_771ab102bd085e2b
+	aotLib[0xf6979f63dd113b05] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Channel * const  , Work const  &  ),&_Funcjobque_boost_0x60_push_clone_771ab102bd085e2b>>();
+	};
+	// _Func_lambda_thismodule_25_20_2_0x60_function_f26aa3b78a6f8e9e
+	aotLib[0x2dfccd6aa7fe8a89] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_25_20_2 &  ),&_Func_lambda_thismodule_25_20_2_0x60_function_f26aa3b78a6f8e9e>>();
+	};
+	// _Func_lambda_thismodule_25_20_2_0x60_finalizer_99287f364d0fe9b4
+	aotLib[0x56c12748c43f8615] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_25_20_2 *  ),&_Func_lambda_thismodule_25_20_2_0x60_finalizer_99287f364d0fe9b4>>();
+	};
+	// _Funcjobque_boost_0x60_for_each_d3cef10387b2669e
+	aotLib[0x1c934a3340875e95] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Channel * const  , Block DAS_COMMENT((void,Work const )) const  &  ),&_Funcjobque_boost_0x60_for_each_d3cef10387b2669e>>();
+	};
+	// _Func_lambda_thismodule_38_20_3_0x60_function_c0f745f9b12da0af
+	aotLib[0x97f69e2ca37ffed1] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_38_20_3 &  ),&_Func_lambda_thismodule_38_20_3_0x60_function_c0f745f9b12da0af>>();
+	};
+	// _Func_lambda_thismodule_38_20_3_0x60_finalizer_4c08ba03df06924a
+	aotLib[0x7ffd66bd89ee40a5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, _lambda_thismodule_38_20_3 *  ),&_Func_lambda_thismodule_38_20_3_0x60_finalizer_4c08ba03df06924a>>();
+	};
+	// test_e5673fbfad6d4a49
+	aotLib[0x10fcf0b5bd313aea] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_e5673fbfad6d4a49>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
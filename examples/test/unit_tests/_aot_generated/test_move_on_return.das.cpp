@@ -0,0 +1,218 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_16773856565238649519 {
+
+extern StructInfo __struct_info__9bbcc87309566a73;
+extern TypeInfo __type_info__f37e77187ecff815;
+extern TypeInfo __type_info__58dcabde67cc1e92;
+extern TypeInfo __type_info__b0585f6b59dafaa;
+extern VarInfo __var_info__f87d2421321a9468;
+
+VarInfo __struct_info__9bbcc87309566a73_field_0 =  { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xf87d2421321a9468), "a", 0 };
+VarInfo * __struct_info__9bbcc87309566a73_fields[1] =  { &__struct_info__9bbcc87309566a73_field_0 };
+StructInfo __struct_info__9bbcc87309566a73 = {"Pipeline", "", 0, __struct_info__9bbcc87309566a73_fields, 1, 4, UINT64_C(0x0), nullptr, UINT64_C(0x9bbcc87309566a73) };
+TypeInfo __type_info__f37e77187ecff815 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__b0585f6b59dafaa, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0xf37e77187ecff815) };
+TypeInfo __type_info__58dcabde67cc1e92 = { Type::tStructure, &__struct_info__9bbcc87309566a73, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 30, 4, UINT64_C(0x58dcabde67cc1e92) };
+TypeInfo __type_info__b0585f6b59dafaa = { Type::tPointer, nullptr, nullptr, nullptr, &__type_info__58dcabde67cc1e92, nullptr, nullptr, nullptr, 0, 0, nullptr, 8204, 8, UINT64_C(0xb0585f6b59dafaa) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__f37e77187ecff815 };
+namespace  { struct Pipeline; };
+namespace  {
+
+struct Pipeline {
+	int32_t a;
+};
+static_assert(sizeof(Pipeline)==4,"structure size mismatch with DAS");
+static_assert(offsetof(Pipeline,a)==0,"structure field offset mismatch with DAS");
+}
+
+inline void finalize_8d79ef91da6bf154 ( Context * __context__, Pipeline * & ____this_rename_at_399 );
+inline TArray<Pipeline *> & _Funcbuiltin_0x60__return_with_lockcheck_ed90c9f91faf1155 ( Context * __context__, TArray<Pipeline *> & __a_rename_at_42 );
+inline void _Funcbuiltin_0x60_finalize_4e3640b57aad4595 ( Context * __context__, TArray<Pipeline *> & __a_rename_at_395 );
+inline TArray<Pipeline *> _Funcbuiltin_0x60_to_array_move_73214a0b5d57fee1 ( Context * __context__, TDim<Pipeline *,2> & __a_rename_at_517 );
+inline void finalize_e9a2342b4a0a805e ( Context * __context__, Pipeline & __p_rename_at_4 );
+inline TArray<Pipeline *> create_graphics_pipelines_5e73abac3bf5878d ( Context * __context__ );
+inline Pipeline * fooBar_9c4288a6379df489 ( Context * __context__ );
+inline bool test_41536f4c3bcabca6 ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void finalize_8d79ef91da6bf154 ( Context * __context__, Pipeline * & ____this_rename_at_399 )
+{
+	if ( ____this_rename_at_399 != nullptr )
+	{
+		finalize_e9a2342b4a0a805e(__context__,das_arg<Pipeline>::pass(das_deref(__context__,____this_rename_at_399)));
+		das_delete<Pipeline *>::clear(__context__,____this_rename_at_399);
+		das_copy(____this_rename_at_399,nullptr);
+	};
+}
+
+inline TArray<Pipeline *> & _Funcbuiltin_0x60__return_with_lockcheck_ed90c9f91faf1155 ( Context * __context__, TArray<Pipeline *> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<Pipeline *> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<Pipeline *> &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcbuiltin_0x60_finalize_4e3640b57aad4595 ( Context * __context__, TArray<Pipeline *> &  __a_rename_at_395 )
+{
+	{
+		bool __need_loop_397 = true;
+		// aV : Pipeline? aka TT&
+		das_iterator<TArray<Pipeline *>> __aV_iterator(__a_rename_at_395);
+		Pipeline * * __aV_rename_at_397;
+		__need_loop_397 = __aV_iterator.first(__context__,(__aV_rename_at_397)) && __need_loop_397;
+		for ( ; __need_loop_397 ; __need_loop_397 = __aV_iterator.next(__context__,(__aV_rename_at_397)) )
+		{
+			finalize_8d79ef91da6bf154(__context__,(*__aV_rename_at_397));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_397));
+	};
+	builtin_array_free(das_arg<TArray<Pipeline *>>::pass(__a_rename_at_395),8,__context__);
+}
+
+inline TArray<Pipeline *> _Funcbuiltin_0x60_to_array_move_73214a0b5d57fee1 ( Context * __context__, TDim<Pipeline *,2> &  __a_rename_at_517 )
+{
+	TArray<Pipeline *> __arr_rename_at_518; das_zero(__arr_rename_at_518);
+	builtin_array_resize(das_arg<TArray<Pipeline *>>::pass(__arr_rename_at_518),2,8,__context__);
+	das_copy(das_cast<TDim<Pipeline *,2>>::cast(das_ref(__context__,__arr_rename_at_518(0,__context__))),__a_rename_at_517);
+	return /* <- */ das_auto_cast_move<TArray<Pipeline *>>::cast(__arr_rename_at_518);
+}
+
+inline void finalize_e9a2342b4a0a805e ( Context * __context__, Pipeline &  __p_rename_at_4 )
+{
+	DAS_ASSERT((__p_rename_at_4.a == 2));
+	das_copy(__p_rename_at_4.a,0);
+}
+
+inline TArray<Pipeline *> create_graphics_pipelines_5e73abac3bf5878d ( Context * __context__ )
+{
+	TArray<Pipeline *> _temp_make_local_9_14_32;
+	TDim<Pipeline *,2> _temp_make_local_9_14_64;
+	return /* <- */ das_auto_cast_move<TArray<Pipeline *>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_ed90c9f91faf1155(__context__,das_arg<TArray<Pipeline *>>::pass((_temp_make_local_9_14_32 = (_Funcbuiltin_0x60_to_array_move_73214a0b5d57fee1(__context__,das_arg<TDim<Pipeline *,2>>::pass((([&]() -> TDim<Pipeline *,2>& {
+		_temp_make_local_9_14_64(0,__context__) = das_ascend<Pipeline,Pipeline>::make(__context__,nullptr,(([&]() -> Pipeline {
+			Pipeline __mks_9;
+			das_copy((__mks_9.a),(1));
+			return __mks_9;
+		})()));
+		_temp_make_local_9_14_64(1,__context__) = das_ascend<Pipeline,Pipeline>::make(__context__,nullptr,(([&]() -> Pipeline {
+			Pipeline __mks_9;
+			das_copy((__mks_9.a),(2));
+			return __mks_9;
+		})()));
+		return _temp_make_local_9_14_64;
+	})()))))))));
+}
+
+inline Pipeline * fooBar_9c4288a6379df489 ( Context * __context__ )
+{
+	TArray<Pipeline *> __pipelines_rename_at_12; memset(&__pipelines_rename_at_12,0,sizeof(__pipelines_rename_at_12));
+/* finally */ auto __finally_12= das_finally([&](){
+	_Funcbuiltin_0x60_finalize_4e3640b57aad4595(__context__,das_arg<TArray<Pipeline *>>::pass(__pipelines_rename_at_12));
+/* end finally */ });
+	__pipelines_rename_at_12; das_zero(__pipelines_rename_at_12); das_move(__pipelines_rename_at_12, create_graphics_pipelines_5e73abac3bf5878d(__context__));
+	return /* <- */ das_auto_cast_move<Pipeline *>::cast(__pipelines_rename_at_12(0,__context__));
+}
+
+inline bool test_41536f4c3bcabca6 ( Context * __context__ )
+{
+	Pipeline * __x_rename_at_19 = fooBar_9c4288a6379df489(__context__);
+	DAS_ASSERT((__x_rename_at_19->a == 1));
+	return das_auto_cast<bool>::cast(true);
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// finalize_8d79ef91da6bf154
+	aotLib[0x5ab931b876fde41] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Pipeline * &  ),&finalize_8d79ef91da6bf154>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_ed90c9f91faf1155
+	aotLib[0x6bc7f329e3c27049] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<Pipeline *> & (*) ( Context * __context__, TArray<Pipeline *> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_ed90c9f91faf1155>>();
+	};
+	// _Funcbuiltin_0x60_finalize_4e3640b57aad4595
+	aotLib[0x954f93adc4121be9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<Pipeline *> &  ),&_Funcbuiltin_0x60_finalize_4e3640b57aad4595>>();
+	};
+	// _Funcbuiltin_0x60_to_array_move_73214a0b5d57fee1
+	aotLib[0x2db2761939f9fbd5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<Pipeline *> (*) ( Context * __context__, TDim<Pipeline *,2> &  ),&_Funcbuiltin_0x60_to_array_move_73214a0b5d57fee1>>();
+	};
+	// finalize_e9a2342b4a0a805e
+	aotLib[0x493f053cfb7629bd] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Pipeline &  ),&finalize_e9a2342b4a0a805e>>();
+	};
+	// create_graphics_pipelines_5e73abac3bf5878d
+	aotLib[0xc9862d94c6100ab2] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TArray<Pipeline *> (*) ( Context * __context__ ),&create_graphics_pipelines_5e73abac3bf5878d>>();
+	};
+	// fooBar_9c4288a6379df489
+	aotLib[0x24fef370a59e55f6] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<Pipeline * (*) ( Context * __context__ ),&fooBar_9c4288a6379df489>>();
+	};
+	// test_41536f4c3bcabca6
+	aotLib[0x1866b68f3a606123] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_41536f4c3bcabca6>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
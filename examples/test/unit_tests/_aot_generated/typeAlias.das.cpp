@@ -0,0 +1,224 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require UnitTest
+#include "unitTest.h"
+ // require math
+#include "daScript/simulate/aot_builtin_math.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_12466246395506813236 {
+
+extern TypeInfo __type_info__5d2d17c5f9277bb8;
+extern TypeInfo __type_info__90f3d07b5a6ca13;
+extern TypeInfo __type_info__8988e07b5422d51;
+extern TypeInfo __type_info__af63eb4c86020609;
+extern TypeInfo __type_info__bef6c19aaa05a9d;
+extern VarInfo __var_info__f638e4e21735a82c;
+extern VarInfo __var_info__781c2563a9c4e1c1;
+extern FuncInfo __func_info__4e377a5b40a54f4f;
+extern FuncInfo __func_info__56bffc19a7947257;
+
+VarInfo __func_info__4e377a5b40a54f4f_field_0 =  { Type::tArray, nullptr, nullptr, nullptr, &__type_info__5d2d17c5f9277bb8, nullptr, nullptr, nullptr, 0, 0, nullptr, 41058, 24, UINT64_C(0xf638e4e21735a82c), "tfoo", 0 };
+VarInfo * __func_info__4e377a5b40a54f4f_fields[1] =  { &__func_info__4e377a5b40a54f4f_field_0 };
+FuncInfo __func_info__4e377a5b40a54f4f = {"invoke block<(tfoo:array<float3 aka Point3> const#):void> const", "", __func_info__4e377a5b40a54f4f_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x4e377a5b40a54f4f), 0x0 };
+VarInfo __func_info__56bffc19a7947257_field_0 =  { Type::tHandle, nullptr, nullptr, DAS_MAKE_ANNOTATION("~UnitTest::Point3Array"), nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 34, 24, UINT64_C(0x781c2563a9c4e1c1), "arr", 0 };
+VarInfo * __func_info__56bffc19a7947257_fields[1] =  { &__func_info__56bffc19a7947257_field_0 };
+FuncInfo __func_info__56bffc19a7947257 = {"invoke block<(arr:UnitTest::Point3Array const):void> const", "", __func_info__56bffc19a7947257_fields, 1, 32, &__type_info__af63eb4c86020609, nullptr,0,UINT64_C(0x56bffc19a7947257), 0x0 };
+TypeInfo __type_info__5d2d17c5f9277bb8 = { Type::tFloat3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 12, UINT64_C(0x5d2d17c5f9277bb8) };
+TypeInfo __type_info__90f3d07b5a6ca13 = { Type::tString, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 16420, 8, UINT64_C(0x90f3d07b5a6ca13) };
+TypeInfo __type_info__8988e07b5422d51 = { Type::tFloat2, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 8, UINT64_C(0x8988e07b5422d51) };
+TypeInfo __type_info__af63eb4c86020609 = { Type::tVoid, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 0, UINT64_C(0xaf63eb4c86020609) };
+TypeInfo __type_info__bef6c19aaa05a9d = { Type::tFloat3, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 60, 12, UINT64_C(0xbef6c19aaa05a9d) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[2] = { &__type_info__90f3d07b5a6ca13, &__type_info__bef6c19aaa05a9d };
+TypeInfo * __tinfo_1[1] = { &__type_info__8988e07b5422d51 };
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+
+inline void _Funcbuiltin_0x60_push_6e2c19a869e61aba ( Context * __context__, TArray<float3> & __Arr_rename_at_75, float3 __value_rename_at_75 );
+inline void take3_eda4be5be266e88 ( Context * __context__, float3 __t_rename_at_6 );
+inline void indexFail_c49a5a80817f4f58 ( Context * __context__, Point3Array const  & __arr_rename_at_10 );
+inline void swizzleFail_be4ba1d85cec05ad ( Context * __context__, Point3Array const  & __battleAreaPoints_rename_at_16 );
+inline void arrayAliasFail_b9ee7a4e47f86c70 ( Context * __context__ );
+inline bool test_6c15d2e12bc1248f ( Context * __context__ );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_push_6e2c19a869e61aba ( Context * __context__, TArray<float3> &  __Arr_rename_at_75, float3 __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<float3>>::pass(__Arr_rename_at_75),12,__context__),__context__),__value_rename_at_75);
+}
+
+inline void take3_eda4be5be266e88 ( Context * __context__, float3 __t_rename_at_6 )
+{
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<2>(__tinfo_0, cast<char * const >::from(((char *) "t=")), cast<float3>::from(__t_rename_at_6))),__context__);
+}
+
+inline void indexFail_c49a5a80817f4f58 ( Context * __context__, Point3Array const  &  __arr_rename_at_10 )
+{
+	take3_eda4be5be266e88(__context__,das_alias<Point3>::from(das_index<Point3Array const >::at(__arr_rename_at_10,0,__context__)));
+	float3 * __t_rename_at_12 = ((float3 *)&(das_alias<Point3>::from(das_index<Point3Array const >::at(__arr_rename_at_10,1,__context__))));
+	take3_eda4be5be266e88(__context__,(*__t_rename_at_12));
+}
+
+inline void swizzleFail_be4ba1d85cec05ad ( Context * __context__, Point3Array const  &  __battleAreaPoints_rename_at_16 )
+{
+	float2 __pointStart_rename_at_17 = v_zero();
+	das_copy(das_swizzle_ref<float,float2,0>::swizzle(__pointStart_rename_at_17) /*x*/,das_swizzle_ref<float const ,float3 const ,0>::swizzle(das_alias<Point3>::from(das_alias<Point3>::from(das_index<Point3Array const >::at(__battleAreaPoints_rename_at_16,0,__context__)))) /*x*/);
+	builtin_print(das_string_builder(__context__,SimNode_AotInterop<1>(__tinfo_1, cast<float2>::from(__pointStart_rename_at_17))),__context__);
+}
+
+inline void arrayAliasFail_b9ee7a4e47f86c70 ( Context * __context__ ) { das_stack_prologue __prologue(__context__,160,"arrayAliasFail " DAS_FILE_LINE);
+{
+	TArray<float3> __foo_rename_at_23; das_zero(__foo_rename_at_23);
+	_Funcbuiltin_0x60_push_6e2c19a869e61aba(__context__,das_arg<TArray<float3>>::pass(__foo_rename_at_23),v_make_vec4f(1.f,2.f,3.f,0.f));
+	_Funcbuiltin_0x60_push_6e2c19a869e61aba(__context__,das_arg<TArray<float3>>::pass(__foo_rename_at_23),v_make_vec4f(2.f,3.f,4.f,0.f));
+	_Funcbuiltin_0x60_push_6e2c19a869e61aba(__context__,das_arg<TArray<float3>>::pass(__foo_rename_at_23),v_make_vec4f(3.f,4.f,5.f,0.f));
+	tempArrayAliasExample(das_reinterpret<TArray<Point3> const >::pass(das_arg<TArray<float3>>::pass(__foo_rename_at_23)),das_reinterpret<Block DAS_COMMENT((void,TArray<Point3> const )) const >::pass(das_make_block<void,TArray<float3> const  &>(__context__,112,0,&__func_info__4e377a5b40a54f4f,[&](TArray<float3> const  & __tfoo_rename_at_27) -> void{
+		float3 __f_rename_at_28 = v_zero();
+		{
+			bool __need_loop_29 = true;
+			// it : float3 aka Point3 const&#
+			das_iterator<TArray<float3> const > __it_iterator(__tfoo_rename_at_27);
+			float3 const  * __it_rename_at_29;
+			__need_loop_29 = __it_iterator.first(__context__,(__it_rename_at_29)) && __need_loop_29;
+			for ( ; __need_loop_29 ; __need_loop_29 = __it_iterator.next(__context__,(__it_rename_at_29)) )
+			{
+				SimPolicy<float3>::SetAdd((char *)&(__f_rename_at_28),das_alias<Point3>::from((*__it_rename_at_29)),*__context__,nullptr);
+			}
+			__it_iterator.close(__context__,(__it_rename_at_29));
+		};
+		DAS_ASSERT((SimPolicy<float3>::Equ(__f_rename_at_28,v_make_vec4f(6.f,9.f,12.f,0.f),*__context__,nullptr)));
+	})),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+}}
+
+inline bool test_6c15d2e12bc1248f ( Context * __context__ ) { das_stack_prologue __prologue(__context__,320,"test " DAS_FILE_LINE);
+{
+	float3 __a_rename_at_35 = das_alias<Point3>::from(das_alias<Point3>::from(getSamplePoint3()));
+	DAS_VERIFY((SimPolicy<float3>::Equ(das_alias<Point3>::from(doubleSamplePoint3(das_alias<Point3>::to(__a_rename_at_35))),v_make_vec4f(0.f,2.f,4.f,0.f),*__context__,nullptr)));
+	TestObjectFoo __foo_rename_at_39; das_zero(__foo_rename_at_39);
+	das_copy(das_alias<Point3>::from(__foo_rename_at_39.hit /*hit*/),das_alias<Point3>::from(getSamplePoint3()));
+	DAS_ASSERT((((v_extract_x(das_alias<Point3>::from(das_alias<Point3>::from(__foo_rename_at_39.hit /*hit*/))) /*x*/ == 0.f) && (v_extract_y(das_alias<Point3>::from(das_alias<Point3>::from(__foo_rename_at_39.hit /*hit*/))) /*y*/ == 1.f)) && (v_extract_z(das_alias<Point3>::from(das_alias<Point3>::from(__foo_rename_at_39.hit /*hit*/))) /*z*/ == 2.f)));
+	float3 __qq_rename_at_43 = das_alias<Point3>::from(das_alias<Point3>::from(__foo_rename_at_39.hit /*hit*/));
+	DAS_ASSERT((((v_extract_x(__qq_rename_at_43) /*x*/ == 0.f) && (v_extract_y(__qq_rename_at_43) /*y*/ == 1.f)) && (v_extract_z(__qq_rename_at_43) /*z*/ == 2.f)));
+	float3 __qq1_rename_at_45 = das_alias<Point3>::from(das_alias<Point3>::from(getSamplePoint3()));
+	DAS_ASSERT((((v_extract_x(__qq1_rename_at_45) /*x*/ == 0.f) && (v_extract_y(__qq1_rename_at_45) /*y*/ == 1.f)) && (v_extract_z(__qq1_rename_at_45) /*z*/ == 2.f)));
+	float3 __qq2_rename_at_47 = ((float3)das_alias<Point3>::from(das_alias<Point3>::from(__foo_rename_at_39.hitPos() /*hitPos*/)));
+	DAS_ASSERT((((v_extract_x(__qq2_rename_at_47) /*x*/ == 0.f) && (v_extract_y(__qq2_rename_at_47) /*y*/ == 1.f)) && (v_extract_z(__qq2_rename_at_47) /*z*/ == 2.f)));
+	float3 __qq3_rename_at_49 = das_alias<Point3>::from(das_alias<Point3>::from(__foo_rename_at_39.hitPos() /*hitPos*/));
+	DAS_ASSERT((((v_extract_x(__qq3_rename_at_49) /*x*/ == 0.f) && (v_extract_y(__qq3_rename_at_49) /*y*/ == 1.f)) && (v_extract_z(__qq3_rename_at_49) /*z*/ == 2.f)));
+	float3 __qq4_rename_at_51 = ((float3)(SimPolicy<float3>::Mul(das_alias<Point3>::from(__foo_rename_at_39.hitPosRef() /*hitPosRef*/),v_splats(1.f),*__context__,nullptr)));
+	DAS_ASSERT((((v_extract_x(__qq4_rename_at_51) /*x*/ == 0.f) && (v_extract_y(__qq4_rename_at_51) /*y*/ == 1.f)) && (v_extract_z(__qq4_rename_at_51) /*z*/ == 2.f)));
+	float3 __hitDir_rename_at_53 = safe_normalize3(SimPolicy<float3>::Unm(das_alias<Point3>::from(doubleSamplePoint3(das_alias<Point3>::to(das_alias<Point3>::from(__foo_rename_at_39.hit /*hit*/)))),*__context__,nullptr));
+	float3 __nhd_rename_at_54 = ((float3)v_make_vec4f(-0.f,-0.44721359f,-0.89442718f,0.f));
+	DAS_ASSERT((((v_extract_x(__hitDir_rename_at_53) /*x*/ == v_extract_x(__nhd_rename_at_54) /*x*/) && (v_extract_y(__hitDir_rename_at_53) /*y*/ == v_extract_y(__nhd_rename_at_54) /*y*/)) && (v_extract_z(__hitDir_rename_at_53) /*z*/ == v_extract_z(__nhd_rename_at_54) /*z*/)));
+	das_copy(__hitDir_rename_at_53,safe_normalize3(SimPolicy<float3>::Unm(das_alias<Point3>::from(__foo_rename_at_39.hit /*hit*/),*__context__,nullptr)));
+	float3 __nhdh_rename_at_57 = ((float3)v_make_vec4f(-0.f,-0.44721359f,-0.89442718f,0.f));
+	DAS_ASSERT((((v_extract_x(__hitDir_rename_at_53) /*x*/ == v_extract_x(__nhdh_rename_at_57) /*x*/) && (v_extract_y(__hitDir_rename_at_53) /*y*/ == v_extract_y(__nhdh_rename_at_57) /*y*/)) && (v_extract_z(__hitDir_rename_at_53) /*z*/ == v_extract_z(__nhdh_rename_at_57) /*z*/)));
+	testPoint3Array(das_make_block<void,Point3Array const  &>(__context__,288,0,&__func_info__56bffc19a7947257,[&](Point3Array const  & __arr_rename_at_60) -> void{
+		DAS_ASSERT((__arr_rename_at_60.size() /*length*/ == 10));
+		{
+			bool __need_loop_62 = true;
+			// p : float3 aka Point3 const&
+			das_iterator<Point3Array const > __p_iterator(__arr_rename_at_60);
+			float3 const  * __p_rename_at_62;
+			__need_loop_62 = __p_iterator.first(__context__,(__p_rename_at_62)) && __need_loop_62;
+			for ( ; __need_loop_62 ; __need_loop_62 = __p_iterator.next(__context__,(__p_rename_at_62)) )
+			{
+				DAS_ASSERT((((v_extract_x(das_alias<Point3>::from(das_alias<Point3>::from((*__p_rename_at_62)))) /*x*/ == 1.f) && (v_extract_y(das_alias<Point3>::from(das_alias<Point3>::from((*__p_rename_at_62)))) /*y*/ == 2.f)) && (v_extract_z(das_alias<Point3>::from(das_alias<Point3>::from((*__p_rename_at_62)))) /*z*/ == 3.f)));
+			}
+			__p_iterator.close(__context__,(__p_rename_at_62));
+		};
+	}),__context__,((LineInfoArg *)(&LineInfo::g_LineInfoNULL)));
+	arrayAliasFail_b9ee7a4e47f86c70(__context__);
+	return das_auto_cast<bool>::cast(true);
+}}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_push_6e2c19a869e61aba
+	aotLib[0xf4064c59c4a5bcd5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<float3> & , float3  ),&_Funcbuiltin_0x60_push_6e2c19a869e61aba>>();
+	};
+	// take3_eda4be5be266e88
+	aotLib[0x409383ce339f41c9] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, float3  ),&take3_eda4be5be266e88>>();
+	};
+	// indexFail_c49a5a80817f4f58
+	aotLib[0xf1a4063692181687] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Point3Array const  &  ),&indexFail_c49a5a80817f4f58>>();
+	};
+	// swizzleFail_be4ba1d85cec05ad
+	aotLib[0xf983af01ff3b8e5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, Point3Array const  &  ),&swizzleFail_be4ba1d85cec05ad>>();
+	};
+	// arrayAliasFail_b9ee7a4e47f86c70
+	aotLib[0xb2b85738e22dc19] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&arrayAliasFail_b9ee7a4e47f86c70>>();
+	};
+	// test_6c15d2e12bc1248f
+	aotLib[0x3491c2317905b675] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_6c15d2e12bc1248f>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
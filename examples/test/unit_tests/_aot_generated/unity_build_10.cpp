@@ -0,0 +1,11 @@
+// unity build batch 10
+#include "make_local.das.cpp"
+#include "make_struct_with_clone.das.cpp"
+#include "map_to_a.das.cpp"
+#include "mat_crash.das.cpp"
+#include "mat_ctors.das.cpp"
+#include "mat_let_handle.das.cpp"
+#include "math.das.cpp"
+#include "memzero.das.cpp"
+#include "method_semantic.das.cpp"
+#include "mksmart_zero.das.cpp"
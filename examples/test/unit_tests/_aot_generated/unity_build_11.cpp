@@ -0,0 +1,11 @@
+// unity build batch 11
+#include "module.das.cpp"
+#include "module_vis_fail.das.cpp"
+#include "move_lambda_local_ref.das.cpp"
+#include "named_call.das.cpp"
+#include "new_and_init.das.cpp"
+#include "new_delete.das.cpp"
+#include "new_with_init.das.cpp"
+#include "null_struct_init.das.cpp"
+#include "oop.das.cpp"
+#include "operator_overload.das.cpp"
@@ -0,0 +1,11 @@
+// unity build batch 12
+#include "operators.das.cpp"
+#include "override.das.cpp"
+#include "pack_and_unpack.das.cpp"
+#include "partial_specialization.das.cpp"
+#include "peek_and_modify_string.das.cpp"
+#include "persistent.das.cpp"
+#include "ptr_index.das.cpp"
+#include "reflection.das.cpp"
+#include "replace.das.cpp"
+#include "req_inc.das.cpp"
@@ -0,0 +1,11 @@
+// unity build batch 13
+#include "return_reference.das.cpp"
+#include "rpipe.das.cpp"
+#include "rtti_module.das.cpp"
+#include "saddr.das.cpp"
+#include "safe_index.das.cpp"
+#include "set_table.das.cpp"
+#include "setand_and_setor_bool.das.cpp"
+#include "shared.das.cpp"
+#include "smart_ptr.das.cpp"
+#include "sort.das.cpp"
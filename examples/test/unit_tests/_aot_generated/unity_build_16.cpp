@@ -0,0 +1,11 @@
+// unity build batch 16
+#include "toarray.das.cpp"
+#include "totable.das.cpp"
+#include "try-catch.das.cpp"
+#include "tuple.das.cpp"
+#include "typeAlias.das.cpp"
+#include "typeinfo.das.cpp"
+#include "typename.das.cpp"
+#include "types.das.cpp"
+#include "unused_arguments.das.cpp"
+#include "utf8.das.cpp"
@@ -0,0 +1,6 @@
+// unity build batch 17
+#include "variant.das.cpp"
+#include "vec_ctors.das.cpp"
+#include "vec_index.das.cpp"
+#include "vec_swizzle.das.cpp"
+#include "with.das.cpp"
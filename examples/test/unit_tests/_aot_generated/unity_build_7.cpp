@@ -0,0 +1,11 @@
+// unity build batch 7
+#include "global.das.cpp"
+#include "global_func_shadow_check.das.cpp"
+#include "global_order.das.cpp"
+#include "handle.das.cpp"
+#include "hint_macros_example.das.cpp"
+#include "ifnn.das.cpp"
+#include "include.das.cpp"
+#include "infer_alias_and_alias_ctor.das.cpp"
+#include "infer_alias_argument.das.cpp"
+#include "infer_remove_ref_const.das.cpp"
@@ -0,0 +1,11 @@
+// unity build batch 8
+#include "init_script.das.cpp"
+#include "inscope_return_inscope.das.cpp"
+#include "int2_crash.das.cpp"
+#include "int_types.das.cpp"
+#include "intern_strings.das.cpp"
+#include "invoke_cmres.das.cpp"
+#include "jit.das.cpp"
+#include "join.das.cpp"
+#include "label.das.cpp"
+#include "lambda.das.cpp"
@@ -0,0 +1,440 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/simulate/simulate.h"
+#include "daScript/simulate/aot.h"
+#include "daScript/simulate/aot_library.h"
+
+ // require builtin
+#include "daScript/misc/performance_time.h"
+ // require UnitTest
+#include "unitTest.h"
+
+#if defined(_MSC_VER)
+#pragma warning(push)
+#pragma warning(disable:4100)   // unreferenced formal parameter
+#pragma warning(disable:4189)   // local variable is initialized but not referenced
+#pragma warning(disable:4244)   // conversion from 'int32_t' to 'float', possible loss of data
+#pragma warning(disable:4114)   // same qualifier more than once
+#pragma warning(disable:4623)   // default constructor was implicitly defined as deleted
+#pragma warning(disable:4946)   // reinterpret_cast used between related classes
+#pragma warning(disable:4269)   // 'const' automatic data initialized with compiler generated default constructor produces unreliable results
+#pragma warning(disable:4555)   // result of expression not used
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wwrite-strings"
+#pragma GCC diagnostic ignored "-Wreturn-local-addr"
+#pragma GCC diagnostic ignored "-Wignored-qualifiers"
+#pragma GCC diagnostic ignored "-Wsign-compare"
+#pragma GCC diagnostic ignored "-Wsubobject-linkage"
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wunused-parameter"
+#pragma clang diagnostic ignored "-Wwritable-strings"
+#pragma clang diagnostic ignored "-Wunused-variable"
+#if defined(__APPLE__)
+#pragma clang diagnostic ignored "-Wunused-but-set-variable"
+#endif
+#pragma clang diagnostic ignored "-Wunsequenced"
+#pragma clang diagnostic ignored "-Wunused-function"
+#endif
+
+namespace das {
+namespace _anon_10009441680775026841 {
+
+extern TypeInfo __type_info__af63e44c8601fa24;
+extern TypeInfo __type_info__64be5dc860f5ba81;
+extern TypeInfo __type_info__3ceb21b1e6727087;
+extern TypeInfo __type_info__289c16574f003020;
+
+TypeInfo __type_info__af63e44c8601fa24 = { Type::tInt, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, 0, 0, nullptr, 28, 4, UINT64_C(0xaf63e44c8601fa24) };
+TypeInfo __type_info__64be5dc860f5ba81 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x64be5dc860f5ba81) };
+TypeInfo __type_info__3ceb21b1e6727087 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x3ceb21b1e6727087) };
+TypeInfo __type_info__289c16574f003020 = { Type::tArray, nullptr, nullptr, nullptr, &__type_info__af63e44c8601fa24, nullptr, nullptr, nullptr, 0, 0, nullptr, 40962, 24, UINT64_C(0x289c16574f003020) };
+
+static void resolveTypeInfoAnnotations()
+{
+}
+
+TypeInfo * __tinfo_0[1] = { &__type_info__3ceb21b1e6727087 };
+TypeInfo * __tinfo_1[1] = { &__type_info__64be5dc860f5ba81 };
+TypeInfo * __tinfo_2[1] = { &__type_info__289c16574f003020 };
+namespace  { struct Foo; };
+// unused enumeration GooEnum
+// unused enumeration SomeEnum
+// unused enumeration SomeEnum98
+// unused enumeration SomeEnum_16
+namespace  {
+
+struct Foo {
+	TVariant<8,uint32_t,float> * t;
+};
+static_assert(sizeof(Foo)==8,"structure size mismatch with DAS");
+static_assert(offsetof(Foo,t)==0,"structure field offset mismatch with DAS");
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> & __Arr_rename_at_54, int32_t __newSize_rename_at_54 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_5166a0dac2826af2 ( Context * __context__, TTable<int32_t,int32_t> const  & __a_rename_at_364 );
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_values_7efccdfd8fe19f3a ( Context * __context__, TTable<int32_t,int32_t> const  & __a_rename_at_376 );
+inline void _Funcbuiltin_0x60_clone_4bc3594d348ca0bd ( Context * __context__, TArray<int32_t> & __a_rename_at_331, TArray<int32_t> const  & __b_rename_at_331 );
+inline void _Funcbuiltin_0x60_clone_b2af4d0d4baecc5f ( Context * __context__, TTable<int32_t,int32_t> & __a_rename_at_352, TTable<int32_t,int32_t> const  & __b_rename_at_352 );
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> & __a_rename_at_42 );
+inline void _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07 ( Context * __context__, TArray<int32_t> & __a_rename_at_31, TArray<int32_t> & __b_rename_at_31 );
+inline TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> _Funcbuiltin_0x60_clone_to_move_5a7582dd4e738e13 ( Context * __context__, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> const  & __clone_src_rename_at_318 );
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> & __Arr_rename_at_75, int32_t __value_rename_at_75 );
+inline void finalize_95948c91a71d5d18 ( Context * __context__, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> & ____this_rename_at_115 );
+inline void test_ifs_7ea309ff539670c5 ( Context * __context__ );
+inline bool test_short_notation_5ea1b5fe6725fe55 ( Context * __context__ );
+inline bool test_c79ee2f14bb8a96b ( Context * __context__ );
+inline void clone_9bfcbf05ff6f7349 ( Context * __context__, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> & __dest_rename_at_321, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> const  & __src_rename_at_321 );
+
+void __init_script ( Context * __context__, bool __init_shared )
+{
+}
+
+inline void _Funcbuiltin_0x60_resize_ce974596f011d69b ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_54, int32_t __newSize_rename_at_54 )
+{
+	builtin_array_resize(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_54),__newSize_rename_at_54,4,__context__);
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_keys_5166a0dac2826af2 ( Context * __context__, TTable<int32_t,int32_t> const  &  __a_rename_at_364 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_365; das_zero(__it_rename_at_365);
+	builtin_table_keys(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_365),__a_rename_at_364,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t const  &))>::cast(__it_rename_at_365);
+}
+
+inline Sequence DAS_COMMENT((int32_t const  &)) _Funcbuiltin_0x60_values_7efccdfd8fe19f3a ( Context * __context__, TTable<int32_t,int32_t> const  &  __a_rename_at_376 )
+{
+	Sequence DAS_COMMENT((int32_t *)) __it_rename_at_377; das_zero(__it_rename_at_377);
+	builtin_table_values(das_arg<Sequence DAS_COMMENT((int32_t const ))>::pass(__it_rename_at_377),__a_rename_at_376,4,__context__);
+	return /* <- */ das_auto_cast_move<Sequence DAS_COMMENT((int32_t const  &))>::cast(__it_rename_at_377);
+}
+
+inline void _Funcbuiltin_0x60_clone_4bc3594d348ca0bd ( Context * __context__, TArray<int32_t> &  __a_rename_at_331, TArray<int32_t> const  &  __b_rename_at_331 )
+{
+	_Funcbuiltin_0x60_resize_ce974596f011d69b(__context__,das_arg<TArray<int32_t>>::pass(__a_rename_at_331),builtin_array_size(__b_rename_at_331));
+	{
+		bool __need_loop_333 = true;
+		// aV : int aka TT&
+		das_iterator<TArray<int32_t>> __aV_iterator(__a_rename_at_331);
+		int32_t * __aV_rename_at_333;
+		__need_loop_333 = __aV_iterator.first(__context__,(__aV_rename_at_333)) && __need_loop_333;
+		// bV : int const&
+		das_iterator<TArray<int32_t> const > __bV_iterator(__b_rename_at_331);
+		int32_t const  * __bV_rename_at_333;
+		__need_loop_333 = __bV_iterator.first(__context__,(__bV_rename_at_333)) && __need_loop_333;
+		for ( ; __need_loop_333 ; __need_loop_333 = __aV_iterator.next(__context__,(__aV_rename_at_333)) && __bV_iterator.next(__context__,(__bV_rename_at_333)) )
+		{
+			das_copy((*__aV_rename_at_333),(*__bV_rename_at_333));
+		}
+		__aV_iterator.close(__context__,(__aV_rename_at_333));
+		__bV_iterator.close(__context__,(__bV_rename_at_333));
+	};
+}
+
+inline void _Funcbuiltin_0x60_clone_b2af4d0d4baecc5f ( Context * __context__, TTable<int32_t,int32_t> &  __a_rename_at_352, TTable<int32_t,int32_t> const  &  __b_rename_at_352 )
+{
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_354_15_32;
+	Sequence DAS_COMMENT((int32_t *)) _temp_make_local_354_23_48;
+	builtin_table_clear(das_arg<TTable<int32_t,int32_t>>::pass(__a_rename_at_352),__context__);
+	{
+		bool __need_loop_354 = true;
+		// k : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __k_iterator((_temp_make_local_354_15_32 = (_Funcbuiltin_0x60_keys_5166a0dac2826af2(__context__,__b_rename_at_352))));
+		int32_t const  * __k_rename_at_354;
+		__need_loop_354 = __k_iterator.first(__context__,(__k_rename_at_354)) && __need_loop_354;
+		// v : int const&
+		das_iterator<Sequence DAS_COMMENT((int32_t const ))> __v_iterator((_temp_make_local_354_23_48 = (_Funcbuiltin_0x60_values_7efccdfd8fe19f3a(__context__,__b_rename_at_352))));
+		int32_t const  * __v_rename_at_354;
+		__need_loop_354 = __v_iterator.first(__context__,(__v_rename_at_354)) && __need_loop_354;
+		for ( ; __need_loop_354 ; __need_loop_354 = __k_iterator.next(__context__,(__k_rename_at_354)) && __v_iterator.next(__context__,(__v_rename_at_354)) )
+		{
+			das_copy(__a_rename_at_352((*__k_rename_at_354),__context__),(*__v_rename_at_354));
+		}
+		__k_iterator.close(__context__,(__k_rename_at_354));
+		__v_iterator.close(__context__,(__v_rename_at_354));
+	};
+}
+
+inline TArray<int32_t> & _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd ( Context * __context__, TArray<int32_t> &  __a_rename_at_42 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_0,cast<TArray<int32_t> &>::from(__a_rename_at_42)));
+	return das_auto_cast_ref<TArray<int32_t> &>::cast(__a_rename_at_42);
+}
+
+inline void _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07 ( Context * __context__, TArray<int32_t> &  __a_rename_at_31, TArray<int32_t> &  __b_rename_at_31 )
+{
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_1,cast<TArray<int32_t> &>::from(__a_rename_at_31)));
+	das_call_interop<void>::call(&builtin_verify_locks,__context__,SimNode_AotInterop<1>(__tinfo_2,cast<TArray<int32_t> &>::from(__b_rename_at_31)));
+	das_move(__a_rename_at_31,__b_rename_at_31);
+}
+
+inline TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> _Funcbuiltin_0x60_clone_to_move_5a7582dd4e738e13 ( Context * __context__, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> const  &  __clone_src_rename_at_318 )
+{
+	TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> __clone_dest_rename_at_320; das_zero(__clone_dest_rename_at_320);
+	clone_9bfcbf05ff6f7349(__context__,das_arg<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__clone_dest_rename_at_320),__clone_src_rename_at_318);
+	return /* <- */ das_auto_cast_move<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::cast(__clone_dest_rename_at_320);
+}
+
+inline void _Funcbuiltin_0x60_push_d21751720b4df10e ( Context * __context__, TArray<int32_t> &  __Arr_rename_at_75, int32_t __value_rename_at_75 )
+{
+	das_copy(__Arr_rename_at_75(builtin_array_push_back(das_arg<TArray<int32_t>>::pass(__Arr_rename_at_75),4,__context__),__context__),__value_rename_at_75);
+}
+
+inline void finalize_95948c91a71d5d18 ( Context * __context__, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> &  ____this_rename_at_115 )
+{
+	if ( das_get_variant_field<TArray<int32_t>,8,1>::is(____this_rename_at_115) )
+	{
+		builtin_array_free(das_arg<TArray<int32_t>>::pass(das_get_variant_field<TArray<int32_t>,8,1>::get(____this_rename_at_115)),4,__context__);
+	} else if ( das_get_variant_field<TTable<int32_t,int32_t>,8,3>::is(____this_rename_at_115) )
+	{
+		builtin_table_free(das_arg<TTable<int32_t,int32_t>>::pass(das_get_variant_field<TTable<int32_t,int32_t>,8,3>::get(____this_rename_at_115)),4,4,__context__);
+	};
+	memset(&(____this_rename_at_115), 0, 56);
+}
+
+inline void test_ifs_7ea309ff539670c5 ( Context * __context__ )
+{
+	TVariant<16,int32_t,float,char *> __i_rename_at_15_ConstRef = ((TVariant<16,int32_t,float,char *>)das_alias<SampleVariant>::from(das_alias<SampleVariant>::from(makeSampleI())));
+	TVariant<16,int32_t,float,char *> const  & __i_rename_at_15 = __i_rename_at_15_ConstRef; ;
+	DAS_ASSERT((das_get_variant_field<int32_t,8,0>::is(__i_rename_at_15)));
+	DAS_ASSERT((das_get_variant_field<int32_t,8,0>::as(__i_rename_at_15,__context__) == 1));
+	TVariant<16,int32_t,float,char *> __f_rename_at_18_ConstRef = ((TVariant<16,int32_t,float,char *>)das_alias<SampleVariant>::from(das_alias<SampleVariant>::from(makeSampleF())));
+	TVariant<16,int32_t,float,char *> const  & __f_rename_at_18 = __f_rename_at_18_ConstRef; ;
+	DAS_ASSERT((das_get_variant_field<float,8,1>::is(__f_rename_at_18)));
+	DAS_ASSERT((das_get_variant_field<float,8,1>::as(__f_rename_at_18,__context__) == 2.f));
+	TVariant<16,int32_t,float,char *> __s_rename_at_21_ConstRef = ((TVariant<16,int32_t,float,char *>)das_alias<SampleVariant>::from(das_alias<SampleVariant>::from(makeSampleS())));
+	TVariant<16,int32_t,float,char *> const  & __s_rename_at_21 = __s_rename_at_21_ConstRef; ;
+	DAS_ASSERT((das_get_variant_field<char *,8,2>::is(__s_rename_at_21)));
+	DAS_ASSERT((SimPolicy<char *>::Equ(cast<char *>::from(das_get_variant_field<char *,8,2>::as(__s_rename_at_21,__context__)),cast<char *>::from(((char *) "3")),*__context__,nullptr)));
+}
+
+inline bool test_short_notation_5ea1b5fe6725fe55 ( Context * __context__ )
+{
+	TVariant<16,int32_t,char *> __e_rename_at_32_ConstRef = ((TVariant<16,int32_t,char *>)(([&]() -> TVariant<16,int32_t,char *> {
+		TVariant<16,int32_t,char *> __mkv_32;
+		das_get_variant_field<int32_t,8,0>::set(__mkv_32) = 1;
+		return __mkv_32;
+	})()));
+	TVariant<16,int32_t,char *> const  & __e_rename_at_32 = __e_rename_at_32_ConstRef; ;
+	DAS_ASSERT((das_get_variant_field<int32_t,8,0>::is(__e_rename_at_32)));
+	DAS_ASSERT((das_get_variant_field<int32_t,8,0>::as(__e_rename_at_32,__context__) == 1));
+	TDim<TVariant<16,int32_t,char *>,2> __ee_rename_at_35_ConstRef = ((TDim<TVariant<16,int32_t,char *>,2>)(([&]() -> TDim<TVariant<16,int32_t,char *>,2> {
+		TDim<TVariant<16,int32_t,char *>,2> __mkv_35;
+		das_get_variant_field<int32_t,8,0>::set(__mkv_35(0,__context__)) = 1;
+		das_get_variant_field<char *,8,1>::set(__mkv_35(1,__context__)) = ((char *) "2");
+		return __mkv_35;
+	})()));
+	TDim<TVariant<16,int32_t,char *>,2> const  & __ee_rename_at_35 = __ee_rename_at_35_ConstRef; ;
+	DAS_ASSERT((das_get_variant_field<int32_t,8,0>::is(__ee_rename_at_35(0,__context__)) && (das_get_variant_field<int32_t,8,0>::as(__ee_rename_at_35(0,__context__),__context__) == 1)));
+	DAS_ASSERT((das_get_variant_field<char *,8,1>::is(__ee_rename_at_35(1,__context__)) && (SimPolicy<char *>::Equ(cast<char *>::from(das_get_variant_field<char *,8,1>::as(__ee_rename_at_35(1,__context__),__context__)),cast<char *>::from(((char *) "2")),*__context__,nullptr))));
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline bool test_c79ee2f14bb8a96b ( Context * __context__ )
+{
+	TVariant<8,uint32_t,float> __t_rename_at_45; das_zero(__t_rename_at_45);
+	das_copy(das_get_variant_field<float,4,1>::get(__t_rename_at_45),1.f);
+	DAS_ASSERT((das_get_variant_field<uint32_t,4,0>::get(__t_rename_at_45) == 0x3f800000u));
+	DAS_ASSERT((variant_index(das_arg<TVariant<8,uint32_t,float>>::pass(__t_rename_at_45)) == 0));
+	DAS_ASSERT((das_get_variant_field<uint32_t,4,0>::is(__t_rename_at_45)));
+	DAS_ASSERT((das_get_variant_field<uint32_t,4,0>::as(__t_rename_at_45,__context__) == 0x3f800000u));
+	set_variant_index(das_arg<TVariant<8,uint32_t,float>>::pass(__t_rename_at_45),1);
+	DAS_ASSERT((das_get_variant_field<float,4,1>::as(__t_rename_at_45,__context__) == 1.f));
+	DAS_ASSERT((das_null_coalescing<float>::get(das_get_variant_field<float,4,1>::safe_as(__t_rename_at_45),2.f) == 1.f));
+	DAS_ASSERT((das_null_coalescing<uint32_t>::get(das_get_variant_field<uint32_t,4,0>::safe_as(__t_rename_at_45),0x1u) == 0x1u));
+	das_copy(das_get_variant_field<float,4,1>::as(__t_rename_at_45,__context__),2.f);
+	set_variant_index(das_arg<TVariant<8,uint32_t,float>>::pass(__t_rename_at_45),0);
+	DAS_ASSERT((das_get_variant_field<uint32_t,4,0>::as(__t_rename_at_45,__context__) == 0x40000000u));
+	das_copy(das_get_variant_field<uint32_t,4,0>::as(__t_rename_at_45,__context__),0x3f800000u);
+	set_variant_index(das_arg<TVariant<8,uint32_t,float>>::pass(__t_rename_at_45),1);
+	DAS_ASSERT((das_get_variant_field<float,4,1>::as(__t_rename_at_45,__context__) == 1.f));
+	bool __paniced_rename_at_79 = false;
+	das_try_recover(__context__, [&]()
+	{
+		das_copy(das_get_variant_field<uint32_t,4,0>::as(__t_rename_at_45,__context__),0x40000000u);
+	}, [&]()
+	{
+		das_copy(__paniced_rename_at_79,true);
+	});
+	DAS_ASSERT((__paniced_rename_at_79));
+	DAS_ASSERT((das_get_variant_field<float,4,1>::get(__t_rename_at_45) == 1.f));
+	das_copy(__t_rename_at_45,(([&]() -> TVariant<8,uint32_t,float> {
+		TVariant<8,uint32_t,float> __mkv_88;
+		das_get_variant_field<uint32_t,4,0>::set(__mkv_88) = 0x40000000u;
+		return __mkv_88;
+	})()));
+	DAS_ASSERT((das_get_variant_field<uint32_t,4,0>::as(__t_rename_at_45,__context__) == 0x40000000u));
+	das_copy(__t_rename_at_45,(([&]() -> TVariant<8,uint32_t,float> {
+		TVariant<8,uint32_t,float> __mkv_90;
+		das_get_variant_field<float,4,1>::set(__mkv_90) = 1.f;
+		return __mkv_90;
+	})()));
+	TDim<TVariant<8,uint32_t,float>,2> __t2_rename_at_92 = (([&]() -> TDim<TVariant<8,uint32_t,float>,2> {
+		TDim<TVariant<8,uint32_t,float>,2> __mkv_92;
+		das_get_variant_field<uint32_t,4,0>::set(__mkv_92(0,__context__)) = 0x1u;
+		das_get_variant_field<float,4,1>::set(__mkv_92(1,__context__)) = 2.f;
+		return __mkv_92;
+	})());
+	DAS_ASSERT((das_get_variant_field<uint32_t,4,0>::is(__t2_rename_at_92(0,__context__)) && (das_get_variant_field<uint32_t,4,0>::as(__t2_rename_at_92(0,__context__),__context__) == 0x1u)));
+	DAS_ASSERT((das_get_variant_field<float,4,1>::is(__t2_rename_at_92(1,__context__)) && (das_get_variant_field<float,4,1>::as(__t2_rename_at_92(1,__context__),__context__) == 2.f)));
+	Foo __f_rename_at_97; das_zero(__f_rename_at_97);
+	Foo * __fp_rename_at_98 = 0;
+	DAS_ASSERT((das_null_coalescing<uint32_t>::get(das_safe_navigation_variant<uint32_t, 4, 0>::get(das_safe_navigation_ptr<Foo,TVariant<8,uint32_t,float> *,&Foo::t>::get(__fp_rename_at_98)),0xdu) == 0xdu));
+	das_copy(__fp_rename_at_98,das_ref(__context__,__f_rename_at_97));
+	DAS_ASSERT((das_null_coalescing<uint32_t>::get(das_safe_navigation_variant<uint32_t, 4, 0>::get(das_safe_navigation_ptr<Foo,TVariant<8,uint32_t,float> *,&Foo::t>::get(__fp_rename_at_98)),0xeu) == 0xeu));
+	das_copy(__f_rename_at_97.t,das_ref(__context__,__t_rename_at_45));
+	DAS_ASSERT((das_null_coalescing<uint32_t>::get(das_safe_navigation_variant<uint32_t, 4, 0>::get(das_safe_navigation_ptr<Foo,TVariant<8,uint32_t,float> *,&Foo::t>::get(__fp_rename_at_98)),0xfu) == 0x3f800000u));
+	DAS_ASSERT((das_null_coalescing<uint32_t>::get(das_get_variant_field<uint32_t,4,0>::safe_as(das_safe_navigation_ptr<Foo,TVariant<8,uint32_t,float> *,&Foo::t>::get(__fp_rename_at_98)),0xfu) == 0xfu));
+	TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> __x_rename_at_107; das_zero(__x_rename_at_107);
+	set_variant_index(das_arg<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__x_rename_at_107),1);
+	_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07(__context__,das_arg<TArray<int32_t>>::pass(das_get_variant_field<TArray<int32_t>,8,1>::get(__x_rename_at_107)),das_arg<TArray<int32_t>>::pass(das_invoke<TArray<int32_t>>::invoke_cmres(__context__,nullptr,[&]() DAS_AOT_INLINE_LAMBDA -> TArray<int32_t>{
+		TArray<int32_t> ____acomp_110_rename_at_110; das_zero(____acomp_110_rename_at_110);
+		builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_110_rename_at_110),false);
+		{
+			bool __need_loop_110 = true;
+			// tt : int const
+			das_iterator<range> __tt_iterator(range(0,10));
+			int32_t __tt_rename_at_110;
+			__need_loop_110 = __tt_iterator.first(__context__,(__tt_rename_at_110)) && __need_loop_110;
+			for ( ; __need_loop_110 ; __need_loop_110 = __tt_iterator.next(__context__,(__tt_rename_at_110)) )
+			{
+				_Funcbuiltin_0x60_push_d21751720b4df10e(__context__,das_arg<TArray<int32_t>>::pass(____acomp_110_rename_at_110),__tt_rename_at_110);
+			}
+			__tt_iterator.close(__context__,(__tt_rename_at_110));
+		};
+		builtin_set_verify_array_locks(das_arg<TArray<int32_t>>::pass(____acomp_110_rename_at_110),true);
+		return /* <- */ das_auto_cast_move<TArray<int32_t>>::cast(_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd(__context__,das_arg<TArray<int32_t>>::pass(____acomp_110_rename_at_110)));
+	})));
+	TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> __y_rename_at_111; das_zero(__y_rename_at_111); das_move(__y_rename_at_111, _Funcbuiltin_0x60_clone_to_move_5a7582dd4e738e13(__context__,das_arg<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__x_rename_at_107)));
+	DAS_ASSERT((das_get_variant_field<TArray<int32_t>,8,1>::is(__y_rename_at_111)));
+	{
+		bool __need_loop_113 = true;
+		// tt : int const
+		das_iterator<range> __tt_iterator(range(0,10));
+		int32_t __tt_rename_at_113;
+		__need_loop_113 = __tt_iterator.first(__context__,(__tt_rename_at_113)) && __need_loop_113;
+		for ( ; __need_loop_113 ; __need_loop_113 = __tt_iterator.next(__context__,(__tt_rename_at_113)) )
+		{
+			DAS_ASSERT((das_get_variant_field<TArray<int32_t>,8,1>::as(__y_rename_at_111,__context__)(__tt_rename_at_113,__context__) == __tt_rename_at_113));
+		}
+		__tt_iterator.close(__context__,(__tt_rename_at_113));
+	};
+	finalize_95948c91a71d5d18(__context__,das_arg<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__x_rename_at_107));
+	DAS_ASSERT((das_get_variant_field<int32_t,8,0>::is(__x_rename_at_107)));
+	DAS_ASSERT((das_get_variant_field<TArray<int32_t>,8,1>::is(__y_rename_at_111)));
+	{
+		bool __need_loop_118 = true;
+		// tt : int const
+		das_iterator<range> __tt_iterator(range(0,10));
+		int32_t __tt_rename_at_118;
+		__need_loop_118 = __tt_iterator.first(__context__,(__tt_rename_at_118)) && __need_loop_118;
+		for ( ; __need_loop_118 ; __need_loop_118 = __tt_iterator.next(__context__,(__tt_rename_at_118)) )
+		{
+			DAS_ASSERT((das_get_variant_field<TArray<int32_t>,8,1>::as(__y_rename_at_111,__context__)(__tt_rename_at_118,__context__) == __tt_rename_at_118));
+		}
+		__tt_iterator.close(__context__,(__tt_rename_at_118));
+	};
+	test_ifs_7ea309ff539670c5(__context__);
+	test_short_notation_5ea1b5fe6725fe55(__context__);
+	return das_auto_cast<bool>::cast(true);
+}
+
+inline void clone_9bfcbf05ff6f7349 ( Context * __context__, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> &  __dest_rename_at_321, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> const  &  __src_rename_at_321 )
+{
+	if ( das_get_variant_field<int32_t,8,0>::is(__src_rename_at_321) )
+	{
+		set_variant_index(das_arg<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__dest_rename_at_321),0);
+		das_copy(das_get_variant_field<int32_t,8,0>::get(__dest_rename_at_321),das_get_variant_field<int32_t,8,0>::get(__src_rename_at_321));
+	} else if ( das_get_variant_field<TArray<int32_t>,8,1>::is(__src_rename_at_321) )
+	{
+		set_variant_index(das_arg<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__dest_rename_at_321),1);
+		_Funcbuiltin_0x60_clone_4bc3594d348ca0bd(__context__,das_arg<TArray<int32_t>>::pass(das_get_variant_field<TArray<int32_t>,8,1>::get(__dest_rename_at_321)),das_get_variant_field<TArray<int32_t>,8,1>::get(__src_rename_at_321));
+	} else if ( das_get_variant_field<float,8,2>::is(__src_rename_at_321) )
+	{
+		set_variant_index(das_arg<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__dest_rename_at_321),2);
+		das_copy(das_get_variant_field<float,8,2>::get(__dest_rename_at_321),das_get_variant_field<float,8,2>::get(__src_rename_at_321));
+	} else if ( das_get_variant_field<TTable<int32_t,int32_t>,8,3>::is(__src_rename_at_321) )
+	{
+		set_variant_index(das_arg<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>>>::pass(__dest_rename_at_321),3);
+		_Funcbuiltin_0x60_clone_b2af4d0d4baecc5f(__context__,das_arg<TTable<int32_t,int32_t>>::pass(das_get_variant_field<TTable<int32_t,int32_t>,8,3>::get(__dest_rename_at_321)),das_get_variant_field<TTable<int32_t,int32_t>,8,3>::get(__src_rename_at_321));
+	};
+}
+
+static void registerAotFunctions ( AotLibrary & aotLib ) {
+	// _Funcbuiltin_0x60_resize_ce974596f011d69b
+	aotLib[0xc239005fc5b02335] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_resize_ce974596f011d69b>>();
+	};
+	// _Funcbuiltin_0x60_keys_5166a0dac2826af2
+	aotLib[0xaaa714fe0ea502d5] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TTable<int32_t,int32_t> const  &  ),&_Funcbuiltin_0x60_keys_5166a0dac2826af2>>();
+	};
+	// _Funcbuiltin_0x60_values_7efccdfd8fe19f3a
+	aotLib[0xed8b833736b5a581] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<Sequence DAS_COMMENT((int32_t const  &)) (*) ( Context * __context__, TTable<int32_t,int32_t> const  &  ),&_Funcbuiltin_0x60_values_7efccdfd8fe19f3a>>();
+	};
+	// _Funcbuiltin_0x60_clone_4bc3594d348ca0bd
+	aotLib[0x1366ab6fb285c311] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> const  &  ),&_Funcbuiltin_0x60_clone_4bc3594d348ca0bd>>();
+	};
+	// _Funcbuiltin_0x60_clone_b2af4d0d4baecc5f
+	aotLib[0xa6a8ec89344c341d] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TTable<int32_t,int32_t> & , TTable<int32_t,int32_t> const  &  ),&_Funcbuiltin_0x60_clone_b2af4d0d4baecc5f>>();
+	};
+	// _Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd
+	aotLib[0x66e322246598e835] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<TArray<int32_t> & (*) ( Context * __context__, TArray<int32_t> &  ),&_Funcbuiltin_0x60__return_with_lockcheck_69604d144cf094fd>>();
+	};
+	// _Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07
+	aotLib[0x44c6ff6768abbc55] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , TArray<int32_t> &  ),&_Funcbuiltin_0x60__move_with_lockcheck_2c57617b31fd6e07>>();
+	};
+	// _Funcbuiltin_0x60_clone_to_move_5a7582dd4e738e13
+	aotLib[0x82a4569cd2e09814] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_AotCMRES<TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> (*) ( Context * __context__, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> const  &  ),&_Funcbuiltin_0x60_clone_to_move_5a7582dd4e738e13>>();
+	};
+	// _Funcbuiltin_0x60_push_d21751720b4df10e
+	aotLib[0x9fb5b63c22625999] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TArray<int32_t> & , int32_t  ),&_Funcbuiltin_0x60_push_d21751720b4df10e>>();
+	};
+	// finalize_95948c91a71d5d18
+	aotLib[0x10f17fe1bc004325] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> &  ),&finalize_95948c91a71d5d18>>();
+	};
+	// test_ifs_7ea309ff539670c5
+	aotLib[0x55240e0e70c28375] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__ ),&test_ifs_7ea309ff539670c5>>();
+	};
+	// test_short_notation_5ea1b5fe6725fe55
+	aotLib[0xa646265a4072ec79] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_short_notation_5ea1b5fe6725fe55>>();
+	};
+	// test_c79ee2f14bb8a96b
+	aotLib[0x2fcd70430744a1f7] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<bool (*) ( Context * __context__ ),&test_c79ee2f14bb8a96b>>();
+	};
+	// clone_9bfcbf05ff6f7349
+	aotLib[0xdefb7afd8a4b77df] = [&](Context & ctx){
+		return ctx.code->makeNode<SimNode_Aot<void (*) ( Context * __context__, TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> & , TVariant<56,int32_t,TArray<int32_t>,float,TTable<int32_t,int32_t>> const  &  ),&clone_9bfcbf05ff6f7349>>();
+	};
+	resolveTypeInfoAnnotations();
+};
+
+AotListBase impl(registerAotFunctions);
+}
+}
+#if defined(_MSC_VER)
+#pragma warning(pop)
+#endif
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#if defined(__clang__)
+#pragma clang diagnostic pop
+#endif
@@ -782,6 +782,9 @@ namespace das
                 bool    requestJit : 1;
                 bool    unsafeOutsideOfFor : 1;
                 bool    skipLockCheck : 1;
+                bool    inlineFunction : 1;
+                bool    noInline : 1;
+                bool    elementWise : 1;
             };
             uint32_t moreFlags = 0;
 
@@ -1192,7 +1195,15 @@ namespace das
         uint32_t    stack = 16*1024;                    // 0 for unique stack
         bool        intern_strings = false;             // use string interning lookup for regular string heap
         bool        persistent_heap = false;
+        bool        profile_alloc = false;              // sample persistent heap allocations, and attribute them to the call sites
+        uint32_t    profile_alloc_sample = 4096;        // average number of bytes between the samples
         bool        multiple_contexts = false;          // code supports context safety
+        bool        cow_globals = false;                // clones map initialized globals copy-on-write, if all globals are raw POD
+        bool        lazy_simulate = false;              // function code is simulated on the first call. program and its modules have to outlive the context
+        bool        code_image = false;                 // code is relocated into the read-only page aligned image, which is shared by the forked processes
+        bool        jit = false;                        // functions are compiled to native code, unsupported nodes fall back to the interpreter
+        bool        background_aot = false;             // hot functions are compiled by the C++ compiler in the background, and swapped in once loaded
+        uint32_t    background_aot_threshold = 1000;    // number of calls, after which function is hot
         uint32_t    heap_size_hint = 65536;
         uint32_t    string_heap_size_hint = 65536;
         bool        solid_context = false;              // all access to varable and function lookup to be context-dependent (via index)
@@ -1225,7 +1236,9 @@ namespace das
         //  when enabled
         //      1. disables [fastcall]
         //      2. invoke of blocks will have extra prologue overhead
+        //      3. statements are patched with single step nodes, only while context is being stepped
         bool debugger = false;
+        bool debugger_step_checks = false;              // every statement checks for single step instead, like before node patching
         string debug_module;
     // profiler
         // only enabled if profiler is disabled
@@ -1288,8 +1301,13 @@ namespace das
         bool optimizationConstFolding();
         bool optimizationBlockFolding();
         bool optimizationCondFolding();
+        bool optimizationIteratorFolding();
+        bool optimizationBatchFolding();
+        bool optimizationInline(TextWriter & logs);
         bool optimizationUnused(TextWriter & logs);
-        void fusion ( Context & context, TextWriter & logs );
+        void fusion ( Context & context, TextWriter & logs, const vector<int> * skipFunctions = nullptr );
+        SimNode * fusion ( Context & context, SimNode * node, TextWriter & logs );
+        void jit ( Context & context, const vector<int> & jitFunctions, TextWriter & logs );
         void buildAccessFlags(TextWriter & logs);
         bool verifyAndFoldContracts();
         void optimize(TextWriter & logs, ModuleGroup & libGroup);
@@ -1303,6 +1321,7 @@ namespace das
         void dumpSymbolUse(TextWriter & logs);
         void allocateStack(TextWriter & logs);
         bool simulate ( Context & context, TextWriter & logs, StackAllocator * sharedStack = nullptr );
+        bool canShareGlobalsImage ( const Context & context ) const;
         uint64_t getInitSemanticHashWithDep( uint64_t initHash ) const;
         void error ( const string & str, const string & extra, const string & fixme, const LineInfo & at, CompilationError cerr = CompilationError::unspecified );
         bool failed() const { return failToCompile || macroException; }
@@ -1324,6 +1343,7 @@ namespace das
         void buildADLookup ( Context & context, TextWriter & logs );
         bool getOptimize() const;
         bool getDebugger() const;
+        bool getDebuggerStepChecks() const;
         bool getProfiler() const;
         void makeMacroModule( TextWriter & logs );
         vector<ReaderMacroPtr> getReaderMacro ( const string & markup ) const;
@@ -1331,6 +1351,7 @@ namespace das
         // this is no longer the way to link AOT
         //  set CodeOfPolicies::aot instead
         void linkCppAot ( Context & context, AotLibrary & aotLib, TextWriter & logs );
+        bool makeBackgroundAot ( Context & context, TextWriter & logs );
         void linkError ( const string & str, const string & extra );
     public:
         template <typename TT>
@@ -188,6 +188,51 @@ namespace das
         return fnX;
     }
 
+    template <typename FuncArgT, typename FuncT, FuncT fn> struct BatchFn;
+
+    template <typename R, typename A, typename FuncT, FuncT fn>
+    struct BatchFn<R (A), FuncT, fn> {
+        typedef typename remove_cv<typename remove_reference<A>::type>::type AT;
+        typedef typename remove_cv<typename remove_reference<R>::type>::type RT;
+        static void invoke ( const TArray<AT> & a, TArray<RT> & dst ) {
+            das_batch<FuncT,fn>::invoke(a, dst);
+        }
+        static void names ( BuiltInFunction * fnB ) {
+            fnB->args({"a","dst"});
+        }
+    };
+
+    template <typename R, typename A, typename B, typename FuncT, FuncT fn>
+    struct BatchFn<R (A,B), FuncT, fn> {
+        typedef typename remove_cv<typename remove_reference<A>::type>::type AT;
+        typedef typename remove_cv<typename remove_reference<B>::type>::type BT;
+        typedef typename remove_cv<typename remove_reference<R>::type>::type RT;
+        static void invoke ( const TArray<AT> & a, const TArray<BT> & b, TArray<RT> & dst ) {
+            das_batch<FuncT,fn>::invoke(a, b, dst);
+        }
+        static void names ( BuiltInFunction * fnB ) {
+            fnB->args({"a","b","dst"});
+        }
+    };
+
+    // adds element-wise function (no side effects, one or two arguments), along with its batch variant
+    //      def name_batch ( a:array<A>; var dst:array<R> )
+    //      def name_batch ( a:array<A>; b:array<B>; var dst:array<R> )
+    // for loops, which only copy the result of the function into the array, are folded into the batch call
+    // only functions which are not overloaded in C++ can be added this way, AOT takes the address of the cppName
+    template <typename FuncArgT, typename FuncT, FuncT fn>
+    inline auto addExternBatch ( Module & mod, const ModuleLibrary & lib, const char * name, const char * cppName ) {
+        auto fnX = addExternEx<FuncArgT, FuncT, fn>(mod, lib, name, SideEffects::none, cppName);
+        fnX->elementWise = true;
+        using BatchT = BatchFn<FuncArgT, FuncT, fn>;
+        string batchName = string(name) + "_batch";
+        string batchCppName = string("das_batch<decltype(&") + cppName + "),&" + cppName + ">::invoke";
+        auto fnB = addExtern<decltype(&BatchT::invoke), &BatchT::invoke>(mod, lib, batchName.c_str(),
+            SideEffects::modifyArgument, batchCppName.c_str());
+        BatchT::names(fnB.get());
+        return fnX;
+    }
+
 #if DAS_SLOW_CALL_INTEROP
     template <typename FuncT, FuncT fn, template <typename FuncTT> class SimNodeT = SimNode_ExtFuncCallRef, typename QQ = defaultTempFn>
 #else
@@ -84,6 +84,12 @@ using das_safe_set = std::set<K,C>;
   #define DAS_FUSION  0
 #endif
 
+// table keys and hash() use word-at-a-time wyhash. set to 0 to get byte-at-a-time FNV-1a instead
+// semantic and mangled name hashes are always FNV-1a, see fnv.h
+#ifndef DAS_FAST_HASH
+  #define DAS_FAST_HASH 1
+#endif
+
 #ifndef DAS_DEBUGGER
   #define DAS_DEBUGGER  1
 #endif
@@ -295,8 +295,16 @@ namespace das {
             offset = 0;
             next = n;
         }
+        // chunk over memory, which is owned by somebody else
+        __forceinline HeapChunk ( char * d, uint32_t s ) {
+            data = d;
+            size = s;
+            offset = 0;
+            next = nullptr;
+            external = true;
+        }
         ~HeapChunk() {
-            das_aligned_free16(data);
+            if ( !external ) das_aligned_free16(data);
             while (next) {
                 HeapChunk * toDelete = next;
                 next = toDelete->next;
@@ -322,6 +330,7 @@ namespace das {
         uint32_t    size;
         uint32_t    offset;
         HeapChunk * next;
+        bool        external = false;
     };
 
     class LinearChunkAllocator : public ptr_ref_count {
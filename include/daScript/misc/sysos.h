@@ -33,4 +33,21 @@ namespace das {
     void hwSetBreakpointHandler ( void (* handler ) ( int, void * ) );
     int hwBreakpointSet ( void * address, int len, int when );
     bool hwBreakpointClear ( int bp_index );
+
+    // copy-on-write memory image. mapping is private, only pages which are written to get copied
+    // returns nullptr if platform does not support it
+    void * cowImageCreate ( const void * data, size_t size );
+    void cowImageRelease ( void * image );
+    char * cowImageMap ( void * image );
+    void cowImageUnmap ( char * ptr, size_t size );
+    size_t cowImagePagesCopied ( const char * ptr, size_t size );   // number of privately copied pages
+    size_t cowImagePageSize ( void );
+
+    // page aligned memory, which can be made read-only. read-only pages are never copied after fork
+    // returns nullptr if platform does not support it
+    char * codeImageAllocate ( size_t size );
+    bool codeImageSeal ( char * ptr, size_t size );
+    bool codeImageUnseal ( char * ptr, size_t size );
+    void codeImageFree ( char * ptr, size_t size );
+    bool jitCodeSeal ( char * ptr, size_t size );                  // code image pages become read-only and executable
 }
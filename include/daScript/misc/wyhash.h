@@ -0,0 +1,106 @@
+#pragma once
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#pragma intrinsic(_umul128)
+#endif
+
+namespace das
+{
+    // word-at-a-time hash, based on wyhash (final version 4) by Wang Yi, which is released into the public domain
+    //  https://github.com/wangyi-fudan/wyhash
+    // unlike fnv.h, result depends on the platform endianness and is not meant to be stored
+
+    #define WYHASH_SEED     0xa0761d6478bd642full
+
+    __forceinline void wyhash_mum ( uint64_t * A, uint64_t * B ) {
+#if defined(__SIZEOF_INT128__)
+        __uint128_t r = *A;
+        r *= *B;
+        *A = uint64_t(r);
+        *B = uint64_t(r>>64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        *A = _umul128(*A, *B, B);
+#else
+        uint64_t ha = *A>>32, hb = *B>>32, la = uint32_t(*A), lb = uint32_t(*B), hi, lo;
+        uint64_t rh = ha*hb, rm0 = ha*lb, rm1 = hb*la, rl = la*lb, t = rl+(rm0<<32), c = t<rl;
+        lo = t+(rm1<<32);
+        c += lo<t;
+        hi = rh+(rm0>>32)+(rm1>>32)+c;
+        *A = lo;
+        *B = hi;
+#endif
+    }
+
+    __forceinline uint64_t wyhash_mix ( uint64_t A, uint64_t B ) {
+        wyhash_mum(&A, &B);
+        return A ^ B;
+    }
+
+    __forceinline uint64_t wyhash_r8 ( const uint8_t * p ) { uint64_t v; memcpy(&v, p, 8); return v; }
+    __forceinline uint64_t wyhash_r4 ( const uint8_t * p ) { uint32_t v; memcpy(&v, p, 4); return v; }
+    __forceinline uint64_t wyhash_r3 ( const uint8_t * p, size_t k ) { return (uint64_t(p[0])<<16) | (uint64_t(p[k>>1])<<8) | p[k-1]; }
+
+    __forceinline uint64_t wyhash_final ( uint64_t h ) {
+        return h <= HASH_KILLED64 ? 1099511628211ul : h;    // same reserved values as hash_block64
+    }
+
+    // integer keys are mixed directly, without going through the block loop
+    __forceinline uint64_t wyhash_int64 ( uint64_t x ) {
+        return wyhash_final(wyhash_mix(x ^ 0xe7037ed1a0b428dbull, WYHASH_SEED ^ 0x8ebc6af09c88c6e3ull));
+    }
+
+    __forceinline uint64_t wyhash_block64 ( const uint8_t * p, size_t len ) {
+        const uint64_t s0 = 0xa0761d6478bd642full, s1 = 0xe7037ed1a0b428dbull, s2 = 0x8ebc6af09c88c6e3ull, s3 = 0x589965cc75374cc3ull;
+        uint64_t seed = WYHASH_SEED ^ wyhash_mix(WYHASH_SEED ^ s0, s1);
+        uint64_t a, b;
+        if ( len<=16 ) {
+            if ( len>=4 ) {
+                a = (wyhash_r4(p)<<32) | wyhash_r4(p+((len>>3)<<2));
+                b = (wyhash_r4(p+len-4)<<32) | wyhash_r4(p+len-4-((len>>3)<<2));
+            } else if ( len>0 ) {
+                a = wyhash_r3(p, len);
+                b = 0;
+            } else {
+                a = b = 0;
+            }
+        } else {
+            size_t i = len;
+            if ( i>48 ) {
+                // three independent lanes, so that the multiplications are pipelined
+                uint64_t see1 = seed, see2 = seed;
+                do {
+                    seed = wyhash_mix(wyhash_r8(p)^s1, wyhash_r8(p+8)^seed);
+                    see1 = wyhash_mix(wyhash_r8(p+16)^s2, wyhash_r8(p+24)^see1);
+                    see2 = wyhash_mix(wyhash_r8(p+32)^s3, wyhash_r8(p+40)^see2);
+                    p += 48;
+                    i -= 48;
+                } while ( i>48 );
+                seed ^= see1 ^ see2;
+            }
+            while ( i>16 ) {
+                seed = wyhash_mix(wyhash_r8(p)^s1, wyhash_r8(p+8)^seed);
+                i -= 16;
+                p += 16;
+            }
+            a = wyhash_r8(p+i-16);
+            b = wyhash_r8(p+i-8);
+        }
+        a ^= s1;
+        b ^= seed;
+        wyhash_mum(&a, &b);
+        return wyhash_final(wyhash_mix(a^s0^len, b^s1));
+    }
+
+    // up to 16 characters its faster to hash byte-at-a-time while looking for the terminator, than to find the length first
+    // longer strings go through the vectorized strlen and the word-at-a-time loop
+    __forceinline uint64_t wyhash_blockz64 ( const uint8_t * p ) {
+        const uint64_t fnv_prime = 1099511628211ul;
+        uint64_t offset_basis = 14695981039346656037ul;
+        for ( const uint8_t * block = p; *block; block++ ) {
+            if ( block==p+16 ) return wyhash_block64(p, 16 + strlen((const char *)block));
+            offset_basis = ( offset_basis ^ *block ) * fnv_prime;
+        }
+        return wyhash_final(offset_basis);
+    }
+}
@@ -2959,6 +2959,59 @@ namespace das {
         return -1;
     }
 
+    // batch variant of the element-wise function, i.e. fn(a[i]) or fn(a[i],b[i]) for each element of dst
+    // it covers the shortest of the arrays, same as the 'for' loop it replaces, and never resizes dst
+    template <typename AC, typename A>
+    struct das_batch_arg {
+        static __forceinline AC pass ( const A & a ) { return a; }
+        static __forceinline AC pass_last ( const A & a ) { return a; }
+    };
+    template <typename TT>
+    struct das_batch_arg<vec4f,vec3<TT>> {
+        static __forceinline vec4f pass ( const vec3<TT> & a ) { return a; }
+        static __forceinline vec4f pass_last ( const vec3<TT> & a ) {
+            TT t[4] = { a.x, a.y, a.z, TT() };  // unaligned 16 byte load would read past the end of the array
+            return vec_loadu(t);
+        }
+    };
+
+    template <typename FuncT, FuncT fn> struct das_batch;
+
+    template <typename RC, typename AC, RC (*fn)(AC)>
+    struct das_batch<RC (*)(AC), fn> {
+        typedef typename remove_cv<typename remove_reference<AC>::type>::type ArgA;
+        template <typename A, typename R>
+        static __forceinline void invoke ( const TArray<A> & a, TArray<R> & dst ) {
+            uint32_t is = a.size<dst.size ? a.size : dst.size;
+            if ( !is ) return;
+            auto pa = (const A *) a.data;
+            auto pd = (R *) dst.data;
+            for ( uint32_t i=0; i!=is-1; ++i ) {
+                pd[i] = R(fn(das_batch_arg<ArgA,A>::pass(pa[i])));
+            }
+            pd[is-1] = R(fn(das_batch_arg<ArgA,A>::pass_last(pa[is-1])));
+        }
+    };
+
+    template <typename RC, typename AC, typename BC, RC (*fn)(AC,BC)>
+    struct das_batch<RC (*)(AC,BC), fn> {
+        typedef typename remove_cv<typename remove_reference<AC>::type>::type ArgA;
+        typedef typename remove_cv<typename remove_reference<BC>::type>::type ArgB;
+        template <typename A, typename B, typename R>
+        static __forceinline void invoke ( const TArray<A> & a, const TArray<B> & b, TArray<R> & dst ) {
+            uint32_t is = a.size<b.size ? a.size : b.size;
+            if ( dst.size<is ) is = dst.size;
+            if ( !is ) return;
+            auto pa = (const A *) a.data;
+            auto pb = (const B *) b.data;
+            auto pd = (R *) dst.data;
+            for ( uint32_t i=0; i!=is-1; ++i ) {
+                pd[i] = R(fn(das_batch_arg<ArgA,A>::pass(pa[i]),das_batch_arg<ArgB,B>::pass(pb[i])));
+            }
+            pd[is-1] = R(fn(das_batch_arg<ArgA,A>::pass_last(pa[is-1]),das_batch_arg<ArgB,B>::pass_last(pb[is-1])));
+        }
+    };
+
     float4 das_invoke_code ( void * pfun, vec4f anything, void * cmres, Context * context );
     bool das_is_jit_function ( const Func func );
     bool das_remove_jit ( const Func func );
@@ -29,6 +29,7 @@ namespace das {
     uint64_t heap_bytes_allocated ( Context * context );
     int32_t heap_depth ( Context * context );
     uint64_t string_heap_bytes_allocated ( Context * context );
+    uint64_t globals_pages_copied ( Context * context );
     int32_t string_heap_depth ( Context * context );
     void string_heap_collect ( bool validate, Context * context, LineInfoArg * info );
     void string_heap_report ( Context * context, LineInfoArg * info );
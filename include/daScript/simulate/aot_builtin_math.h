@@ -159,5 +159,15 @@ namespace das {
         return v_byte_to_float(value);
     }
 
+    // bulk operations over arrays. output array is resized to match the input, and can be the input itself
+    void float4x4_transform_points ( TArray<float3> & dst, const TArray<float3> & src, const float4x4 & m, Context * context );
+    void float3x4_transform_points ( TArray<float3> & dst, const TArray<float3> & src, const float3x4 & m, Context * context );
+    void float4x4_transform_points_soa ( TArray<float> & x, TArray<float> & y, TArray<float> & z, const float4x4 & m, Context * context, LineInfoArg * at );
+    void normalize_all3 ( TArray<float3> & v );
+    void normalize_all_soa ( TArray<float> & x, TArray<float> & y, TArray<float> & z, Context * context, LineInfoArg * at );
+    void dot_all3 ( TArray<float> & dst, const TArray<float3> & a, const TArray<float3> & b, Context * context, LineInfoArg * at );
+    void lerp_all1 ( TArray<float> & dst, const TArray<float> & a, const TArray<float> & b, float t, Context * context, LineInfoArg * at );
+    void lerp_all3 ( TArray<float3> & dst, const TArray<float3> & a, const TArray<float3> & b, float t, Context * context, LineInfoArg * at );
+
 }
 
@@ -2,13 +2,45 @@
 
 #include "daScript/simulate/simulate.h"
 #include "daScript/misc/fnv.h"
+#include "daScript/misc/wyhash.h"
 
 namespace das {
+#if DAS_FAST_HASH
+    __forceinline uint64_t hash_function ( Context &, const void * x, size_t size ) {
+        return wyhash_block64((const uint8_t *)x, size);
+    }
+
+    template <typename TT, bool isWord = (sizeof(TT)<=sizeof(uint64_t))>
+    struct HashValue {
+        static __forceinline uint64_t hash ( const TT & x ) {
+            return wyhash_block64((const uint8_t *)&x, sizeof(x));
+        }
+    };
+
+    // int, int64, float, pointers, enumerations etc. are mixed as one word
+    template <typename TT>
+    struct HashValue<TT,true> {
+        static __forceinline uint64_t hash ( const TT & x ) {
+            uint64_t u = 0;
+            memcpy(&u, &x, sizeof(TT));
+            return wyhash_int64(u);
+        }
+    };
+#else
     __forceinline uint64_t hash_function ( Context &, const void * x, size_t size ) {
         return hash_block64((uint8_t *)x, size);
     }
 
-    __forceinline uint32_t stringLength ( Context &, const char * str ) { // str!=nullptr
+    template <typename TT>
+    struct HashValue {
+        static __forceinline uint64_t hash ( const TT & x ) {
+            return hash_block64((const uint8_t *)&x, sizeof(x));
+        }
+    };
+#endif
+
+    __forceinline uint32_t stringLength ( Context & ctx, const char * str ) { // str!=nullptr
+        if ( auto hdr = ctx.stringHeader(str) ) return hdr->length;
         return uint32_t(strlen(str));
     }
 
@@ -18,20 +50,22 @@ namespace das {
 
     template <typename TT>
     __forceinline uint64_t hash_function ( Context &, const TT x ) {
-        return hash_block64((const uint8_t *)&x, sizeof(x));
+        return HashValue<TT>::hash(x);
     }
 
+    // constant and interned strings have the hash precomputed
     template <>
-    __forceinline uint64_t hash_function ( Context &, char * str ) {
-        return str ? hash_blockz64((uint8_t *)str) : 1099511628211ul;
+    __forceinline uint64_t hash_function ( Context & ctx, const char * str ) {
+        if ( !str ) return 1099511628211ul;
+        if ( auto hdr = ctx.stringHeader(str) ) return hdr->hash;
+        return hash_string_key(str);
     }
 
     template <>
-    __forceinline uint64_t hash_function ( Context &, const char * str ) {
-        return str ? hash_blockz64((uint8_t *)str) : 1099511628211ul;
+    __forceinline uint64_t hash_function ( Context & ctx, char * str ) {
+        return hash_function<const char *>(ctx, str);
     }
 
     uint64_t hash_value ( Context & ctx, void * pX, TypeInfo * info );
     uint64_t hash_value ( Context & ctx, vec4f value, TypeInfo * info );
 }
-
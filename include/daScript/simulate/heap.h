@@ -2,10 +2,15 @@
 
 #include "daScript/misc/memory_model.h"
 #include "daScript/misc/fnv.h"
+#include "daScript/misc/wyhash.h"
 #include "daScript/misc/callable.h"
+#include "daScript/misc/string_writer.h"
 
 namespace das {
 
+    class Context;
+    struct FuncInfo;
+
     class StackAllocator {
     public:
         StackAllocator(const StackAllocator &) = delete;
@@ -124,6 +129,57 @@ namespace das {
         uint32_t    stackSize = 0;
     };
 
+    class AnyHeapAllocator;
+
+    // allocation site is the function, and the line it was called from (i.e. the prologue of the current frame)
+    // inlined functions and [fastcall] functions have no prologue, so their allocations go to the caller
+    struct AllocationSite {
+        FuncInfo *  fn = nullptr;
+        LineInfo *  at = nullptr;
+        const char *aotFile = nullptr;  // AOT frames only have the file name
+        bool        string = false;
+        uint64_t    samples = 0;
+        uint64_t    bytes = 0;          // estimate, each sample stands for the whole sampling interval
+        uint64_t    liveBytes = 0;      // estimate, only valid during the report
+    };
+
+    // every 'interval' bytes the allocation is sampled, and attributed to its site
+    // sampled allocations are tracked until they are freed or collected, which gives the live bytes by site
+    class AllocationProfiler {
+    public:
+        AllocationProfiler ( Context * ctx, uint32_t sampleBytes );
+        __forceinline void onAllocate ( char * ptr, uint32_t size, bool str ) {
+            countdown -= int64_t(size);
+            if ( countdown<=0 && ptr ) sample(ptr, size, str);
+        }
+        __forceinline void onFree ( char * ptr ) {
+            if ( !live.empty() ) live.erase(ptr);
+        }
+        __forceinline void onReallocate ( char * oldPtr, char * newPtr, uint32_t newSize, bool str ) {
+            onFree(oldPtr);
+            onAllocate(newPtr, newSize, str);
+        }
+        void sweep ( AnyHeapAllocator * heap, bool str );
+        void reset ( bool str );
+        void report ( TextWriter & tw, uint32_t top );
+        uint32_t getInterval() const { return interval; }
+        bool empty() const { return sites.empty(); }
+    protected:
+        void sample ( char * ptr, uint32_t size, bool str );
+        struct LiveSample {
+            uint32_t    site;
+            uint32_t    size;
+            uint64_t    weight;
+            bool        string;
+        };
+        Context *                                   context = nullptr;
+        uint32_t                                    interval = 0;
+        int64_t                                     countdown = 0;
+        vector<AllocationSite>                      sites;
+        das_hash_map<uint64_t,vector<uint32_t>>     siteIndex;
+        das_hash_map<void *,LiveSample>             live;
+    };
+
     class AnyHeapAllocator : public ptr_ref_count {
     public:
         virtual char * allocate ( uint32_t ) = 0;
@@ -152,6 +208,7 @@ namespace das {
 #endif
     public:
         char * allocateName ( const string & name );
+        AllocationProfiler * profiler = nullptr;    // owned by the context
     };
 
     struct StrHashEntry {
@@ -177,6 +234,42 @@ namespace das {
 
     typedef das_hash_set<StrHashEntry,StrHashPred,StrEqPred> das_string_set;
 
+    // same as hash_function(context,str), which is used for the table keys
+    __forceinline uint64_t hash_string_key ( const char * str ) {
+#if DAS_FAST_HASH
+        return wyhash_blockz64((const uint8_t *)str);
+#else
+        return hash_blockz64((const uint8_t *)str);
+#endif
+    }
+
+    // interned strings are allocated with the header, which caches hash and length of the string
+    struct StringHeader {
+        uint64_t    hash;
+        uint32_t    length;
+        uint32_t    padding;
+    };
+
+    class ConstStringAllocator : public LinearChunkAllocator {
+    public:
+        ConstStringAllocator() { alignMask = 7; }
+        char * allocateString ( const char * text, uint32_t length );
+        __forceinline char * allocateString ( const string & str ) {
+            return allocateString ( str.c_str(), uint32_t(str.length()) );
+        }
+        virtual void reset () override;
+        char * intern ( const char * str, uint32_t length ) const;
+        // every string here comes from allocateString, so it has the header
+        __forceinline const StringHeader * getHeader ( const char * str ) const {
+            for ( auto ch=chunk; ch; ch=ch->next ) {
+                if ( ch->isOwnPtr(str) ) return (const StringHeader *)(str - sizeof(StringHeader));
+            }
+            return nullptr;
+        }
+    protected:
+        das_string_set internMap;
+    };
+
     class StringHeapAllocator : public AnyHeapAllocator {
     public:
         virtual void forEachString ( const callable<void (const char *)> & fn ) = 0;
@@ -188,26 +281,50 @@ namespace das {
         void setIntern ( bool on );
         bool isIntern() const { return needIntern; }
         char * intern ( const char * str, uint32_t length ) const;
-        void recognize ( char * str );
+        char * recognize ( char * str );
+        __forceinline const StringHeader * getHeader ( const char * str ) const {
+            return internHeap.chunk ? internHeap.getHeader(str) : nullptr;
+        }
+        __forceinline bool isInternedPtr ( const char * str ) const {
+            return internHeap.isOwnPtr(str);
+        }
     protected:
-        das_string_set internMap;
+        // interned strings are never freed individually, they live until the heap is reset
+        ConstStringAllocator internHeap;
         bool needIntern = false;
     };
 
     class PersistentHeapAllocator : public AnyHeapAllocator {
     public:
         PersistentHeapAllocator() {}
-        virtual char * allocate ( uint32_t size ) override { return model.allocate(size); }
-        virtual void free ( char * ptr, uint32_t size ) override { model.free(ptr,size); }
-        virtual char * reallocate ( char * ptr, uint32_t oldSize, uint32_t newSize ) override { return model.reallocate(ptr,oldSize,newSize); }
+        virtual char * allocate ( uint32_t size ) override {
+            auto ptr = model.allocate(size);
+            if ( profiler ) profiler->onAllocate(ptr, size, false);
+            return ptr;
+        }
+        virtual void free ( char * ptr, uint32_t size ) override {
+            if ( profiler ) profiler->onFree(ptr);
+            model.free(ptr,size);
+        }
+        virtual char * reallocate ( char * ptr, uint32_t oldSize, uint32_t newSize ) override {
+            auto nptr = model.reallocate(ptr,oldSize,newSize);
+            if ( profiler ) profiler->onReallocate(ptr, nptr, newSize, false);
+            return nptr;
+        }
         virtual int depth() const override { return model.depth(); }
         virtual uint64_t bytesAllocated() const override { return model.bytesAllocated(); }
         virtual uint64_t totalAlignedMemoryAllocated() const override { return model.totalAlignedMemoryAllocated(); }
-        virtual void reset() override { model.reset(); }
+        virtual void reset() override {
+            if ( profiler ) profiler->reset(false);
+            model.reset();
+        }
         virtual void report() override;
         virtual bool mark() override;
         virtual void mark ( char * ptr, uint32_t size ) override;
-        virtual void sweep() override { model.sweep(); }
+        virtual void sweep() override {
+            model.sweep();
+            if ( profiler ) profiler->sweep(this, false);
+        }
         virtual bool isOwnPtr ( char * ptr, uint32_t size ) override { return model.isOwnPtr(ptr,size); }
         virtual bool isValidPtr ( char * ptr, uint32_t size ) override { return model.isAllocatedPtr(ptr,size); }
         virtual void setInitialSize ( uint32_t size ) override { model.setInitialSize(size); }
@@ -250,29 +367,31 @@ namespace das {
     void das_track_string_breakpoint ( uint64_t id );
 #endif
 
-    class ConstStringAllocator : public LinearChunkAllocator {
-    public:
-        ConstStringAllocator() { alignMask = 3; }
-        char * allocateString ( const char * text, uint32_t length );
-        __forceinline char * allocateString ( const string & str ) {
-            return allocateString ( str.c_str(), uint32_t(str.length()) );
-        }
-        virtual void reset () override;
-        char * intern ( const char * str, uint32_t length ) const;
-    protected:
-        das_string_set internMap;
-    };
-
     class PersistentStringAllocator : public StringHeapAllocator {
     public:
         PersistentStringAllocator() { model.alignMask = 3; }
-        virtual char * allocate ( uint32_t size ) override { return model.allocate(size); }
-        virtual void free ( char * ptr, uint32_t size ) override { model.free(ptr,size); }
-        virtual char * reallocate ( char * ptr, uint32_t oldSize, uint32_t newSize ) override { return model.reallocate(ptr,oldSize,newSize); }
+        virtual char * allocate ( uint32_t size ) override {
+            auto ptr = model.allocate(size);
+            if ( profiler ) profiler->onAllocate(ptr, size, true);
+            return ptr;
+        }
+        virtual void free ( char * ptr, uint32_t size ) override {
+            if ( profiler ) profiler->onFree(ptr);
+            model.free(ptr,size);
+        }
+        virtual char * reallocate ( char * ptr, uint32_t oldSize, uint32_t newSize ) override {
+            auto nptr = model.reallocate(ptr,oldSize,newSize);
+            if ( profiler ) profiler->onReallocate(ptr, nptr, newSize, true);
+            return nptr;
+        }
         virtual int depth() const override { return model.depth(); }
-        virtual uint64_t bytesAllocated() const override { return model.bytesAllocated(); }
-        virtual uint64_t totalAlignedMemoryAllocated() const override { return model.totalAlignedMemoryAllocated(); }
-        virtual void reset() override { model.reset(); }
+        virtual uint64_t bytesAllocated() const override { return model.bytesAllocated() + internHeap.bytesAllocated(); }
+        virtual uint64_t totalAlignedMemoryAllocated() const override { return model.totalAlignedMemoryAllocated() + internHeap.totalAlignedMemoryAllocated(); }
+        virtual void reset() override {
+            if ( profiler ) profiler->reset(true);
+            model.reset();
+            StringHeapAllocator::reset();
+        }
         virtual void forEachString ( const callable<void (const char *)> & fn ) override ;
         virtual void report() override;
         virtual bool mark() override;
@@ -298,9 +417,9 @@ namespace das {
         virtual void free ( char * ptr, uint32_t size ) override { model.free(ptr,size); }
         virtual char * reallocate ( char * ptr, uint32_t oldSize, uint32_t newSize ) override { return model.reallocate(ptr,oldSize,newSize); }
         virtual int depth() const override { return model.depth(); }
-        virtual uint64_t bytesAllocated() const override { return model.bytesAllocated(); }
-        virtual uint64_t totalAlignedMemoryAllocated() const override { return model.totalAlignedMemoryAllocated(); }
-        virtual void reset() override { model.reset(); }
+        virtual uint64_t bytesAllocated() const override { return model.bytesAllocated() + internHeap.bytesAllocated(); }
+        virtual uint64_t totalAlignedMemoryAllocated() const override { return model.totalAlignedMemoryAllocated() + internHeap.totalAlignedMemoryAllocated(); }
+        virtual void reset() override { model.reset(); StringHeapAllocator::reset(); }
         virtual void forEachString ( const callable<void (const char *)> & fn ) override;
         virtual void report() override;
         virtual bool mark() override { return false; }
@@ -331,6 +450,7 @@ namespace das {
     public:
         bool prefixWithHeader = true;
         uint32_t totalNodesAllocated = 0;
+        shared_ptr<void> jitCode;           // native code, which points to the nodes of this allocator
     public:
         NodeAllocator() {}
 
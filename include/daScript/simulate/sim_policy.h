@@ -622,14 +622,27 @@ namespace  das {
         return s ? s : rts_null;
     }
 
+    // constant and interned strings are compared by the cached length and hash first
+    __forceinline bool string_equ ( const char * a, const char * b, Context & context ) {
+        if ( a==b ) return true;
+        if ( a && b ) {
+            auto ha = context.stringHeader(a);
+            if ( ha ) {
+                auto hb = context.stringHeader(b);
+                if ( hb && (ha->length!=hb->length || ha->hash!=hb->hash) ) return false;
+            }
+        }
+        return strcmp(to_rts(a), to_rts(b))==0;
+    }
+
     struct SimPolicy_String {
         // even more basic
         static __forceinline void Set     ( char * & a, char * b, Context &, LineInfo * ) { a = b;}
-        static __forceinline bool Equ     ( char * a, char * b, Context &, LineInfo * ) { return strcmp(to_rts(a), to_rts(b))==0; }
-        static __forceinline bool NotEqu  ( char * a, char * b, Context &, LineInfo * ) { return (bool) strcmp(to_rts(a), to_rts(b)); }
+        static __forceinline bool Equ     ( char * a, char * b, Context & context, LineInfo * ) { return string_equ(a, b, context); }
+        static __forceinline bool NotEqu  ( char * a, char * b, Context & context, LineInfo * ) { return !string_equ(a, b, context); }
         // basic
-        static __forceinline bool Equ     ( vec4f a, vec4f b, Context &, LineInfo * ) { return strcmp(to_rts(a), to_rts(b))==0; }
-        static __forceinline bool NotEqu  ( vec4f a, vec4f b, Context &, LineInfo * ) { return (bool) strcmp(to_rts(a), to_rts(b)); }
+        static __forceinline bool Equ     ( vec4f a, vec4f b, Context & context, LineInfo * ) { return string_equ(cast<char *>::to(a), cast<char *>::to(b), context); }
+        static __forceinline bool NotEqu  ( vec4f a, vec4f b, Context & context, LineInfo * ) { return !string_equ(cast<char *>::to(a), cast<char *>::to(b), context); }
         // ordered
         static __forceinline bool LessEqu ( vec4f a, vec4f b, Context &, LineInfo * ) { return strcmp(to_rts(a), to_rts(b))<=0; }
         static __forceinline bool GtEqu   ( vec4f a, vec4f b, Context &, LineInfo * ) { return strcmp(to_rts(a), to_rts(b))>=0; }
@@ -110,6 +110,7 @@ namespace das
         virtual bool rtti_node_isBlock() const { return false; }
         virtual bool rtti_node_isInstrument() const { return false; }
         virtual bool rtti_node_isInstrumentFunction() const { return false; }
+        virtual bool rtti_node_isSingleStep() const { return false; }
         virtual bool rtti_node_isJit() const { return false; }
     protected:
         virtual ~SimNode() {}
@@ -249,6 +250,26 @@ namespace das
 
     typedef shared_ptr<Context> ContextPtr;
 
+    // simulates function code on the first call (see CodeOfPolicies::lazy_simulate)
+    struct LazySimulation {
+        virtual ~LazySimulation() {}
+        virtual void simulateAll ( Context & context ) = 0;
+    };
+
+    // compiles hot functions to a shared library in the background (see CodeOfPolicies::background_aot)
+    struct BackgroundAot;
+
+    // statements of the debugger build, which are patched with single step nodes while any of the contexts is being stepped
+    struct SingleStepNodes;
+
+    // snapshot of initialized globals, which clones map copy-on-write
+    struct GlobalsImage {
+        GlobalsImage ( const char * data, uint32_t sz );
+        ~GlobalsImage();
+        void *      image = nullptr;
+        uint32_t    size = 0;
+    };
+
     class Context : public ptr_ref_count, public enable_shared_from_this<Context> {
         template <typename TT> friend struct SimNode_GetGlobalR2V;
         friend struct SimNode_GetGlobal;
@@ -258,6 +279,8 @@ namespace das
         friend struct SimNode_FuncConstValue;
         friend class Program;
         friend class Module;
+        friend struct ProgramLazySimulation;
+        friend struct BackgroundAot;
     public:
         Context(uint32_t stackSize = 16*1024, bool ph = false);
         Context(const Context &, uint32_t category_);
@@ -309,6 +332,12 @@ namespace das
             stringHeap->reset();
         }
 
+        // constant and interned strings carry cached hash and length, everything else returns nullptr
+        __forceinline const StringHeader * stringHeader ( const char * str ) const {
+            if ( auto hdr = constStringHeap->getHeader(str) ) return hdr;
+            return stringHeap->getHeader(str);
+        }
+
         __forceinline uint32_t tryRestartAndLock() {
             if (insideContext == 0) {
                 restart();
@@ -600,6 +629,7 @@ namespace das
         }
 
         void relocateCode( bool pwh = false );
+        void relocateCode( const shared_ptr<NodeAllocator> & newCode );
         void announceCreation();
         void collectStringHeap(LineInfo * at, bool validate);
         void collectHeap(LineInfo * at, bool stringHeap, bool validate);
@@ -607,14 +637,27 @@ namespace das
         void instrumentFunction ( SimFunction * , bool isInstrumenting, uint64_t userData );
         void instrumentContextNode ( const Block & blk, bool isInstrumenting, Context * context, LineInfo * line );
         void clearInstruments();
+        void makeSingleStepNodes();
         void runVisitor ( SimVisitor * vis ) const;
 
         uint64_t getSharedMemorySize() const;
         uint64_t getUniqueMemorySize() const;
 
+        bool makeGlobalsImage();
+        uint64_t getGlobalsPagesCopied() const;
+
+        void simulateLazyFunctions();
+
+        bool makeCodeImage();
+        bool sealCodeImage();
+        bool isCodeImage() const { return codeImage; }
+
         void resetProfiler();
         void collectProfileInfo( TextWriter & tout );
 
+        void profileAllocations ( uint32_t sampleBytes );   // 0 stops profiling
+        void reportAllocations ( TextWriter & tout, uint32_t top = 16 );
+
         vector<FileInfo *> getAllFiles() const;
 
         char * intern ( const char * str );
@@ -642,7 +685,7 @@ namespace das
             }
         }
 
-        __forceinline void setSingleStep ( bool step ) { singleStepMode = step; }
+        void setSingleStep ( bool step );
         void triggerHwBreakpoint ( void * addr, int index );
 
         __forceinline bool isGlobalPtr ( char * ptr ) const { return globals<=ptr && ptr<(globals+globalsSize); }
@@ -657,6 +700,10 @@ namespace das
         shared_ptr<ConstStringAllocator> constStringHeap;
         shared_ptr<NodeAllocator>       code;
         shared_ptr<DebugInfoAllocator>  debugInfo;
+        shared_ptr<LazySimulation>      lazySimulation;
+        shared_ptr<BackgroundAot>       backgroundAot;
+        shared_ptr<SingleStepNodes>     singleStepNodes;
+        unique_ptr<AllocationProfiler>  allocProfiler;
         StackAllocator                  stack;
         uint32_t                        insideContext = 0;
         bool                            ownStack = false;
@@ -678,9 +725,14 @@ namespace das
 #if !DAS_ENABLE_EXCEPTIONS
         jmp_buf *       throwBuf = nullptr;
 #endif
+    protected:
+        void freeGlobals();
     protected:
         GlobalVariable * globalVariables = nullptr;
         bool     globalsOwner = true;
+        bool     globalsCow = false;            // globals are copy-on-write mapping of the globalsImage
+        shared_ptr<GlobalsImage> globalsImage;
+        bool     codeImage = false;             // code is in the read-only image, and can't be patched
         uint32_t sharedSize = 0;
         bool     sharedOwner = true;
         uint32_t globalsSize = 0;
@@ -2655,6 +2655,28 @@ SIM_NODE_AT_VECTOR(Float, float)
         SimNode * subexpr;
     };
 
+    // statement of the debugger build, while context is being stepped
+    struct SimNodeDebug_SingleStep : SimNode {
+        SimNodeDebug_SingleStep ( const LineInfo & at, SimNode * se )
+            : SimNode(at), subexpr(se) {}
+        virtual bool rtti_node_isSingleStep() const override { return true; }
+        virtual SimNode * visit ( SimVisitor & vis ) override;
+        virtual vec4f DAS_EVAL_ABI eval ( Context & context ) override {
+            DAS_PROFILE_NODE
+            DAS_SINGLE_STEP(context,subexpr->debugInfo,false);
+            return subexpr->eval(context);
+        }
+#define EVAL_NODE(TYPE,CTYPE) \
+        virtual CTYPE eval##TYPE ( Context & context ) override { \
+                DAS_PROFILE_NODE \
+                DAS_SINGLE_STEP(context,subexpr->debugInfo,false); \
+                return subexpr->eval##TYPE(context); \
+            }
+        DAS_EVAL_NODE
+#undef EVAL_NODE
+        SimNode * subexpr;
+    };
+
     struct SimNodeDebug_InstrumentFunction : SimNode {
         SimNodeDebug_InstrumentFunction ( const LineInfo & at, SimFunction * simF, int64_t mnh, SimNode * se, uint64_t ud )
             : SimNode(at), func(simF), fnMnh(mnh), subexpr(se), userData(ud) {}
@@ -1424,6 +1424,8 @@ namespace das {
         cexpr->subexpr = subexpr->clone();
         cexpr->index = index->clone();
         cexpr->no_promotion = no_promotion;
+        cexpr->r2v = r2v;
+        cexpr->r2cr = r2cr;
         return cexpr;
     }
 
@@ -1633,6 +1635,9 @@ namespace das {
         Expression::clone(cexpr);
         cexpr->mask = mask;
         cexpr->value = value->clone();
+        cexpr->fields = fields;
+        cexpr->r2v = r2v;
+        cexpr->r2cr = r2cr;
         return cexpr;
     }
 
@@ -1653,9 +1658,12 @@ namespace das {
         }
         cexpr->field = field;
         cexpr->fieldIndex = fieldIndex;
+        cexpr->annotation = annotation;
         cexpr->unsafeDeref = unsafeDeref;
         cexpr->no_promotion = no_promotion;
         cexpr->atField = atField;
+        cexpr->r2v = r2v;
+        cexpr->r2cr = r2cr;
         return cexpr;
     }
 
@@ -1784,6 +1792,8 @@ namespace das {
         cexpr->pBlock = pBlock;
         cexpr->argument = argument;
         cexpr->argumentIndex = argumentIndex;
+        cexpr->r2v = r2v;
+        cexpr->r2cr = r2cr;
         return cexpr;
     }
 
@@ -3003,6 +3013,10 @@ namespace das {
         return policies.debugger || options.getBoolOption("debugger",false);
     }
 
+    bool Program::getDebuggerStepChecks() const {
+        return getDebugger() && options.getBoolOption("debugger_step_checks",policies.debugger_step_checks);
+    }
+
     bool Program::getProfiler() const {
         return policies.profiler || options.getBoolOption("profiler",false);
     }
@@ -3026,6 +3040,12 @@ namespace das {
             if ( log ) logs << "COND FOLDING:" << (last ? "optimized" : "nothing") << "\n" << *this;
             last = optimizationBlockFolding();  if ( failed() ) break;  any |= last;
             if ( log ) logs << "BLOCK FOLDING:" << (last ? "optimized" : "nothing") << "\n" << *this;
+            last = optimizationIteratorFolding();  if ( failed() ) break;  any |= last;
+            if ( log ) logs << "ITERATOR FOLDING:" << (last ? "optimized" : "nothing") << "\n" << *this;
+            last = optimizationBatchFolding();  if ( failed() ) break;  any |= last;
+            if ( log ) logs << "BATCH FOLDING:" << (last ? "optimized" : "nothing") << "\n" << *this;
+            last = optimizationInline(logs);  if ( failed() ) break;  any |= last;
+            if ( log ) logs << "INLINE:" << (last ? "optimized" : "nothing") << "\n" << *this;
             // this is here again for a reason
             last = optimizationUnused(logs);    if ( failed() ) break;  any |= last;
             if ( log ) logs << "REMOVE UNUSED:" << (last ? "optimized" : "nothing") << "\n" << *this;
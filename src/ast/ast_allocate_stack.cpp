@@ -82,6 +82,8 @@ namespace das {
             log = prog->options.getBoolOption("log_stack");
             log_var_scope = prog->options.getBoolOption("log_var_scope");
             optimize = prog->getOptimize();
+            // debugger and gc see every local variable of the frame, so slots are only shared when neither is present
+            shareSlots = optimize && !prog->getDebugger() && !prog->options.getBoolOption("gc",false);
             if( log ) {
                 logs << "\nSTACK INFORMATION:\n";
             }
@@ -90,7 +92,10 @@ namespace das {
         ProgramPtr              program;
         FunctionPtr             func;
         uint32_t                stackTop = 0;
+        uint32_t                maxStackTop = 0;        // high watermark of the frame
+        uint32_t                unsharedStackTop = 0;   // what frame would be, if no slots were shared
         vector<uint32_t>        stackTopStack;
+        vector<uint32_t>        closureStackTop;
         vector<ExprBlock *>     blocks;
         vector<ExprBlock *>     scopes;
         bool                    log = false;
@@ -98,12 +103,25 @@ namespace das {
         bool                    optimize = false;
         TextWriter &            logs;
         bool                    inStruct = false;
+        bool                    shareSlots = false;
+        int32_t                 noShare = 0;
     protected:
         uint32_t allocateStack ( uint32_t size ) {
             auto result = stackTop;
-            stackTop += (size + 0xf) & ~0xf;
+            auto aligned = (size + 0xf) & ~0xf;
+            stackTop += aligned;
+            unsharedStackTop += aligned;
+            maxStackTop = das::max(maxStackTop, stackTop);
             return result;
         }
+        void resetStack() {
+            stackTop = maxStackTop = unsharedStackTop = sizeof(Prologue);
+        }
+        // slots of a temporary or a variable are reused once it is out of scope.
+        // block with the finally section zeroes and finalizes its variables, so its slots are never shared
+        bool canShareSlots() const {
+            return shareSlots && !noShare && !inStruct;
+        }
     // structure
         virtual void preVisit ( Structure * var ) override {
             Visitor::preVisit(var);
@@ -116,7 +134,7 @@ namespace das {
     // global variable init
         virtual void preVisitGlobalLet ( const VariablePtr & var ) override {
             var->initStackSize = 0;
-            stackTop = sizeof(Prologue);
+            resetStack();
             if ( var->init  ) {
                 if ( var->init->rtti_isMakeLocal() ) {
                     uint32_t sz = sizeof(void *);
@@ -143,22 +161,23 @@ namespace das {
             }
         }
         virtual VariablePtr visitGlobalLet ( const VariablePtr & var ) override {
-            var->initStackSize = stackTop;
-            program->globalInitStackSize = das::max(program->globalInitStackSize, stackTop);
+            var->initStackSize = maxStackTop;
+            program->globalInitStackSize = das::max(program->globalInitStackSize, maxStackTop);
             return Visitor::visitGlobalLet(var);
         }
     // function
         virtual void preVisit ( Function * f ) override {
             Visitor::preVisit(f);
             func = f;
-            func->totalStackSize = stackTop = sizeof(Prologue);
+            resetStack();
+            func->totalStackSize = stackTop;
             if ( log ) {
                 if (!func->used) logs << "unused ";
                 logs << func->describe() << "\n";
             }
         }
         virtual FunctionPtr visit ( Function * that ) override {
-            func->totalStackSize = das::max(func->totalStackSize, stackTop);
+            func->totalStackSize = das::max(func->totalStackSize, maxStackTop);
             // detecting fastcall
             if ( !program->getDebugger() && !program->getProfiler() ) {
                 if ( !func->exports && !func->addr && func->totalStackSize==sizeof(Prologue) && func->arguments.size()<=32 ) {
@@ -179,7 +198,9 @@ namespace das {
                 }
             }
             if ( log ) {
-                logs << func->totalStackSize << "\ttotal" << (func->fastCall ? ", fastcall" : "") << "\n";
+                logs << func->totalStackSize << "\ttotal";
+                if ( unsharedStackTop!=func->totalStackSize ) logs << ", " << unsharedStackTop << " without shared slots";
+                logs << (func->fastCall ? ", fastcall" : "") << "\n";
             }
             func.reset();
             return Visitor::visit(that);
@@ -248,6 +269,11 @@ namespace das {
             if ( inStruct ) return;
             if ( block->isClosure ) {
                 blocks.push_back(block);
+                closureStackTop.push_back(maxStackTop);
+                maxStackTop = stackTop;
+            }
+            if ( block->finalList.size() ) {
+                noShare ++;
             }
             scopes.push_back(block);
             block->maxLabelIndex = -1;
@@ -266,11 +292,34 @@ namespace das {
                 return Visitor::visit(block);
             }
             scopes.pop_back();
+            if ( block->finalList.size() ) {
+                noShare --;
+            }
             if ( block->isClosure ) {
                 blocks.pop_back();
+                // closure is invoked later, while the rest of the expression is still being evaluated.
+                // its whole frame stays reserved until the end of the statement
+                stackTop = maxStackTop;
+                maxStackTop = das::max(maxStackTop, closureStackTop.back());
+                closureStackTop.pop_back();
+            } else if ( canShareSlots() ) {
+                stackTop = block->stackVarTop;
             }
             return Visitor::visit(block);
         }
+        virtual void preVisitBlockExpression ( ExprBlock * block, Expression * expr ) override {
+            Visitor::preVisitBlockExpression(block, expr);
+            stackTopStack.push_back(stackTop);
+        }
+        virtual ExpressionPtr visitBlockExpression ( ExprBlock * block, Expression * expr ) override {
+            auto top = stackTopStack.back();
+            stackTopStack.pop_back();
+            // temporaries of the statement are dead once its done. local variables live until the end of the block
+            if ( canShareSlots() && !expr->rtti_isLet() ) {
+                stackTop = top;
+            }
+            return Visitor::visitBlockExpression(block, expr);
+        }
     // ExprOp1
         virtual void preVisit ( ExprOp1 * expr ) override {
             Visitor::preVisit(expr);
@@ -540,8 +589,8 @@ namespace das {
             if ( !message.empty() ) {
                 if ( uniStr.find(message)==uniStr.end() ) {
                     uniStr.insert(message);
-                    uint32_t allocSize = uint32_t(message.length()) + 1;
-                    allocSize = (allocSize + 3) & ~3;
+                    uint32_t allocSize = uint32_t(sizeof(StringHeader) + message.length()) + 1;
+                    allocSize = (allocSize + 7) & ~7;
                     bytesTotal += allocSize;
                 }
             }
@@ -0,0 +1,288 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/aot_library.h"
+#include "daScript/simulate/simulate_visit_op.h"
+#include "daScript/misc/sysos.h"
+
+// background AOT. C++ for the program is generated when the context is simulated,
+// and compiled into a shared library by the system compiler, once the first function gets hot.
+// library is loaded on the compiler thread, and hot functions are patched on the thread which calls them
+
+#if defined(__linux__) && !defined(_EMSCRIPTEN_VER)
+#define DAS_BACKGROUND_AOT 1
+#include <dlfcn.h>
+#include <unistd.h>
+#include <thread>
+#else
+#define DAS_BACKGROUND_AOT 0
+#endif
+
+// compiler and flags of the host build, so that the library matches its layout. DAS_AOT_CXX environment variable overrides the compiler
+#ifndef DAS_AOT_CXX
+#define DAS_AOT_CXX "c++"
+#endif
+#ifndef DAS_AOT_CXX_FLAGS
+#define DAS_AOT_CXX_FLAGS "-O2"
+#endif
+
+namespace das {
+
+#if DAS_BACKGROUND_AOT
+
+    struct SimNode_AotCounter;
+
+    typedef void ( * BackgroundAotEntry ) ( AotLibrary & );
+
+    struct BackgroundAot {
+        enum class Status { idle, building, loaded, failed, done };
+        ~BackgroundAot() {
+            if ( builder.joinable() ) {
+                builder.join();
+            }
+            // library stays loaded, since hosts can hold on to the aotFunction pointers
+        }
+        void hot ( Context & context );
+        void install ( Context & context );
+        void restore ();
+        void build ();
+        void report ( Context & context, const string & message ) const {
+            context.to_out(("background AOT: " + message + "\n").c_str());
+        }
+        string                          source;
+        string                          includeDir;
+        vector<uint64_t>                hashes;         // by function index, 0 if function is not compiled
+        vector<SimNode_AotCounter *>    counters;       // by function index, until function is installed
+        SimFunction *                   functions = nullptr;
+        uint32_t                        threshold = 1000;
+        bool                            log = false;
+        atomic<Status>                  status { Status::idle };
+        mutex                           lock;
+        thread                          builder;
+        void *                          handle = nullptr;
+        string                          errors;
+        AotLibrary                      library;
+        bool                            registered = false;
+    };
+
+    // counts calls, until function is replaced with the AOT one
+    struct SimNode_AotCounter : SimNode {
+        SimNode_AotCounter ( const LineInfo & at, BackgroundAot * o, SimNode * b )
+            : SimNode(at), owner(o), body(b) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override {
+            V_BEGIN();
+            V_OP(AotCounter);
+            V_ARG(calls);
+            V_SUB(body);
+            V_END();
+        }
+        __forceinline void tick ( Context & context ) {
+            if ( ++calls >= owner->threshold ) {
+                owner->hot(context);
+            }
+        }
+        virtual vec4f DAS_EVAL_ABI eval ( Context & context ) override {
+            DAS_PROFILE_NODE
+            tick(context);
+            return body->eval(context);
+        }
+#define EVAL_NODE(TYPE,CTYPE)                                           \
+        virtual CTYPE eval##TYPE ( Context & context ) override {       \
+            DAS_PROFILE_NODE                                            \
+            tick(context);                                              \
+            return body->eval##TYPE(context);                           \
+        }
+        DAS_EVAL_NODE
+#undef EVAL_NODE
+        BackgroundAot * owner;
+        SimNode *       body;
+        uint32_t        calls = 0;
+    };
+
+    void BackgroundAot::hot ( Context & context ) {
+        if ( status.load(memory_order_acquire)==Status::building ) {
+            return;
+        }
+        lock_guard<mutex> guard(lock);
+        switch ( status.load(memory_order_acquire) ) {
+        case Status::idle:
+            if ( log ) report(context, "compiling " + to_string(source.size()) + " bytes of C++");
+            status.store(Status::building, memory_order_release);
+            builder = thread([this](){ build(); });
+            break;
+        case Status::building:
+        case Status::done:
+            break;
+        case Status::loaded:
+            install(context);
+            break;
+        case Status::failed:
+            report(context, "failed, functions stay interpreted\n" + errors);
+            restore();
+            status.store(Status::done, memory_order_release);
+            break;
+        }
+    }
+
+    // patches every function, which is hot by now. the rest are patched when they get hot
+    void BackgroundAot::install ( Context & context ) {
+        if ( !registered ) {
+            auto entry = (BackgroundAotEntry) dlsym(handle, "das_background_aot_register");
+            (*entry)(library);          // resolves type info annotations, so it runs on the context thread
+            registered = true;
+        }
+        for ( size_t index=0, is=counters.size(); index!=is; ++index ) {
+            auto counter = counters[index];
+            if ( !counter || counter->calls<threshold ) continue;
+            counters[index] = nullptr;
+            auto & fn = functions[index];
+            auto it = library.find(hashes[index]);
+            if ( it==library.end() ) {
+                fn.code = counter->body;
+                if ( log ) report(context, string("NOT FOUND ") + fn.mangledName);
+                continue;
+            }
+            auto code = (it->second)(context);
+            fn.aotFunction = ((SimNode_CallBase *)code)->aotFunction;
+            fn.aot = true;
+            fn.code = code;
+            if ( log ) report(context, string(fn.mangledName) + " after " + to_string(counter->calls) + " calls");
+        }
+    }
+
+    void BackgroundAot::restore () {
+        for ( size_t index=0, is=counters.size(); index!=is; ++index ) {
+            if ( auto counter = counters[index] ) {
+                functions[index].code = counter->body;
+                counters[index] = nullptr;
+            }
+        }
+    }
+
+    static string readTextFile ( const string & fileName ) {
+        string text;
+        if ( FILE * f = fopen(fileName.c_str(), "rb") ) {
+            char buf[4096];
+            size_t sz;
+            while ( (sz = fread(buf, 1, sizeof(buf), f)) != 0 ) {
+                text.append(buf, sz);
+            }
+            fclose(f);
+        }
+        return text;
+    }
+
+    void BackgroundAot::build () {
+        const char * tmpDir = getenv("TMPDIR");
+        string dirTemplate = string(tmpDir && *tmpDir ? tmpDir : "/tmp") + "/das_aot_XXXXXX";
+        vector<char> dirName(dirTemplate.begin(), dirTemplate.end());
+        dirName.push_back(0);
+        if ( !mkdtemp(dirName.data()) ) {
+            errors = "can't create temporary directory " + dirTemplate;
+            status.store(Status::failed, memory_order_release);
+            return;
+        }
+        string dir = dirName.data();
+        string cppName = dir + "/aot.cpp", libName = dir + "/aot.so", logName = dir + "/errors.txt";
+        if ( FILE * f = fopen(cppName.c_str(), "wb") ) {
+            fwrite(source.c_str(), 1, source.size(), f);
+            fclose(f);
+            const char * cxx = getenv("DAS_AOT_CXX");
+            string cmd = string(cxx && *cxx ? cxx : DAS_AOT_CXX) + " " DAS_AOT_CXX_FLAGS " -shared -fPIC -w"
+                " -I\"" + includeDir + "\" -o \"" + libName + "\" \"" + cppName + "\" > \"" + logName + "\" 2>&1";
+            if ( system(cmd.c_str())==0 ) {
+                handle = dlopen(libName.c_str(), RTLD_NOW | RTLD_LOCAL);
+                if ( !handle ) {
+                    errors = dlerror();
+                } else if ( !dlsym(handle, "das_background_aot_register") ) {
+                    errors = "missing das_background_aot_register in " + libName;
+                    handle = nullptr;
+                }
+            } else {
+                errors = cmd + "\n" + readTextFile(logName);
+            }
+        } else {
+            errors = "can't write " + cppName;
+        }
+        remove(cppName.c_str());
+        remove(libName.c_str());
+        remove(logName.c_str());
+        rmdir(dir.c_str());
+        status.store(handle ? Status::loaded : Status::failed, memory_order_release);
+    }
+
+    bool Program::makeBackgroundAot ( Context & context, TextWriter & logs ) {
+        bool logIt = options.getBoolOption("log_aot",false);
+        if ( options.getBoolOption("no_aot",false) ) {
+            return false;
+        }
+        TextWriter tw;
+        tw << "#include \"daScript/misc/platform.h\"\n\n";
+        tw << "#include \"daScript/simulate/simulate.h\"\n";
+        tw << "#include \"daScript/simulate/aot.h\"\n";
+        tw << "#include \"daScript/simulate/aot_library.h\"\n";
+        tw << "\n";
+        string noAotModule;
+        library.foreach([&](Module * mod){
+            if ( !mod->name.empty() && mod->aotRequire(tw)==ModuleAotType::no_aot ) {
+                noAotModule = mod->name;
+            }
+            return true;
+        },"*");
+        if ( !noAotModule.empty() ) {
+            if ( logIt ) logs << "background AOT disabled due to module " << noAotModule << "\n";
+            return false;
+        }
+        tw << "\nnamespace das {\n";
+        tw << "namespace " << thisNamespace << " {\n";
+        auto saveProgram = daScriptEnvironment::bound->g_Program;
+        daScriptEnvironment::bound->g_Program = this;   // setting it for the AOT macros
+        aotCpp(context, tw);
+        daScriptEnvironment::bound->g_Program = saveProgram;
+        tw << "\nstatic void registerAotFunctions ( AotLibrary & aotLib ) {\n";
+        registerAotCpp(tw, context, false);
+        tw << "\tresolveTypeInfoAnnotations();\n";
+        tw << "};\n";
+        tw << "}\n";
+        tw << "}\n\n";
+        tw << "extern \"C\" void das_background_aot_register ( das::AotLibrary & aotLib ) {\n";
+        tw << "\tdas::" << thisNamespace << "::registerAotFunctions(aotLib);\n";
+        tw << "}\n";
+        // same functions registerAotCpp lists
+        auto bga = make_shared<BackgroundAot>();
+        bga->hashes.resize(context.totalFunctions, 0);
+        bga->counters.resize(context.totalFunctions, nullptr);
+        int totalHot = 0;
+        thisModule->functions.foreach([&](auto pfun){
+            if ( pfun->index<0 || !pfun->used || pfun->noAot )
+                return;
+            auto & fn = context.functions[pfun->index];
+            bga->hashes[pfun->index] = pfun->aotHash;
+            bga->counters[pfun->index] = context.code->makeNode<SimNode_AotCounter>(pfun->at, bga.get(), fn.code);
+            fn.code = bga->counters[pfun->index];
+            totalHot ++;
+        });
+        if ( !totalHot ) {
+            return false;
+        }
+        bga->source = tw.str();
+        bga->includeDir = getDasRoot() + "/include";
+        bga->functions = context.functions;
+        bga->threshold = max(options.getIntOption("background_aot_threshold", policies.background_aot_threshold), 1);
+        bga->log = logIt;
+        context.backgroundAot = bga;
+        if ( logIt ) {
+            logs << "background AOT: " << totalHot << " functions, " << uint64_t(bga->source.size()) << " bytes of C++\n";
+        }
+        return true;
+    }
+
+#else
+
+    bool Program::makeBackgroundAot ( Context &, TextWriter & ) {
+        return false;
+    }
+
+#endif
+
+}
@@ -333,6 +333,164 @@ namespace das {
         }
     };
 
+    // this folds iteration over builtin 'each' into the native loop over its source
+    //  for x in each(range)    = for x in range
+    //  for x in each(string)   = for x in string
+    //  for x in each(array)    = for x in array
+    //  for x in each(dim)      = for x in dim
+    // native loops avoid the Iterator::next virtual call per element
+    class IteratorFolding : public PassVisitor {
+    protected:
+        static bool isBuiltinEach ( ExprCall * call ) {
+            Function * fn = call->func;
+            if ( !fn || call->arguments.size()!=1 ) return false;
+            if ( auto origin = fn->getOrigin() ) fn = origin;
+            return fn->name=="each" && fn->module && fn->module->name=="$";
+        }
+        static TypeDeclPtr makeIteratorType ( const TypeDeclPtr & srcType ) {
+            TypeDeclPtr res;
+            if ( srcType->dim.size() ) {
+                res = make_smart<TypeDecl>(*srcType);
+                res->ref = true;
+                res->dim.erase(res->dim.begin());
+                if ( !res->dimExpr.empty() ) {
+                    res->dimExpr.erase(res->dimExpr.begin());
+                }
+            } else if ( srcType->isGoodArrayType() ) {
+                res = make_smart<TypeDecl>(*srcType->firstType);
+                res->ref = true;
+            } else if ( srcType->baseType==Type::tRange ) {
+                res = make_smart<TypeDecl>(srcType->getRangeBaseType());
+                res->ref = false;
+                res->constant = true;
+            } else if ( srcType->isString() ) {
+                res = make_smart<TypeDecl>(Type::tInt);
+                res->ref = false;
+                res->constant = true;
+            } else {
+                return nullptr;
+            }
+            res->constant |= srcType->isConst();
+            res->temporary |= srcType->isTemp();
+            return res;
+        }
+    protected:
+        virtual ExpressionPtr visit ( ExprFor * expr ) override {
+            if ( expr->sources.size()==expr->iteratorVariables.size() ) {
+                for ( size_t i=0, is=expr->sources.size(); i!=is; ++i ) {
+                    auto & src = expr->sources[i];
+                    if ( !src->rtti_isCall() ) continue;
+                    auto call = static_cast<ExprCall *>(src.get());
+                    if ( !isBuiltinEach(call) ) continue;
+                    auto & arg = call->arguments[0];
+                    if ( !arg->type || (arg->type->isRef() && !arg->type->isRefType()) ) continue;
+                    auto & var = expr->iteratorVariables[i];
+                    auto varType = makeIteratorType(arg->type);
+                    if ( !varType || !varType->isSameType(*var->type, RefMatters::yes, ConstMatters::no, TemporaryMatters::no) ) continue;
+                    // AOT iterates const source via const reference, so loop variable has to be const as well
+                    if ( var->type->ref && varType->constant && !var->type->constant ) continue;
+                    ExpressionPtr nsrc = arg;
+                    nsrc->isForLoopSource = true;
+                    var->source = nsrc;
+                    src = nsrc;
+                    reportFolding();
+                }
+            }
+            return Visitor::visit(expr);
+        }
+    };
+
+    // this folds loop, which only copies result of the element-wise function into the array, into its batch variant
+    //  for d, x in dst, a          = fn_batch(a, dst)
+    //      d = fn(x)
+    //  for d, x, y in dst, a, b    = fn_batch(a, b, dst)
+    //      d = fn(x, y)
+    // batch variant loops in C++, instead of the interop call per element
+    class BatchFolding : public PassVisitor {
+    protected:
+        static bool isPlainSource ( Expression * expr ) {
+            while ( expr->rtti_isField() ) {
+                expr = static_cast<ExprField *>(expr)->value.get();
+            }
+            return expr->rtti_isVar();
+        }
+        static int iteratorIndex ( ExprFor * expr, Expression * arg ) {
+            if ( arg->rtti_isR2V() ) arg = static_cast<ExprRef2Value *>(arg)->subexpr.get();
+            if ( !arg->rtti_isVar() ) return -1;
+            auto var = static_cast<ExprVar *>(arg)->variable.get();
+            for ( size_t i=0, is=expr->iteratorVariables.size(); i!=is; ++i ) {
+                if ( expr->iteratorVariables[i].get()==var ) return int(i);
+            }
+            return -1;
+        }
+        static Function * findBatch ( Function * fn, const vector<ExpressionPtr> & args ) {
+            if ( !fn->module ) return nullptr;
+            auto batchName = fn->name + "_batch";
+            auto it = fn->module->functionsByName.find(hash64z(batchName.c_str()));
+            if ( it==fn->module->functionsByName.end() ) return nullptr;
+            for ( auto & bfn : it->second ) {
+                if ( bfn->arguments.size()!=args.size() ) continue;
+                bool same = true;
+                for ( size_t i=0, is=args.size(); i!=is && same; ++i ) {
+                    same = bfn->arguments[i]->type->isSameType(*args[i]->type, RefMatters::no, ConstMatters::no, TemporaryMatters::no);
+                }
+                if ( same ) return bfn.get();
+            }
+            return nullptr;
+        }
+        ExpressionPtr makeBatchCall ( ExprFor * expr ) {
+            auto nIter = expr->iteratorVariables.size();
+            if ( nIter<2 || expr->sources.size()!=nIter ) return nullptr;
+            for ( auto & src : expr->sources ) {
+                if ( !src->type || !src->type->isGoodArrayType() || !isPlainSource(src.get()) ) return nullptr;
+            }
+            if ( !expr->body || !expr->body->rtti_isBlock() ) return nullptr;
+            auto body = static_cast<ExprBlock *>(expr->body.get());
+            if ( body->list.size()!=1 || !body->finalList.empty() ) return nullptr;
+            if ( strcmp(body->list[0]->__rtti,"ExprCopy")!=0 ) return nullptr;
+            auto cpy = static_cast<ExprCopy *>(body->list[0].get());
+            if ( !cpy->right->rtti_isCall() ) return nullptr;
+            auto call = static_cast<ExprCall *>(cpy->right.get());
+            if ( !call->func || !call->func->elementWise || call->arguments.size()+1!=nIter ) return nullptr;
+            // every iterator is used exactly once, result goes to the last argument
+            vector<int> order;
+            for ( auto & arg : call->arguments ) {
+                order.push_back(iteratorIndex(expr, arg.get()));
+            }
+            order.push_back(iteratorIndex(expr, cpy->left.get()));
+            for ( size_t i=0; i!=nIter; ++i ) {
+                if ( order[i]==-1 ) return nullptr;
+                for ( size_t j=0; j!=i; ++j ) {
+                    if ( order[i]==order[j] ) return nullptr;
+                }
+            }
+            auto & dst = expr->sources[order.back()];
+            if ( dst->type->isConst() ) return nullptr;
+            vector<ExpressionPtr> args;
+            for ( auto idx : order ) {
+                args.push_back(expr->sources[idx]);
+            }
+            auto batch = findBatch(call->func, args);
+            if ( !batch ) return nullptr;
+            auto pCall = make_smart<ExprCall>(expr->at, batch->name);
+            pCall->func = batch;
+            for ( auto & arg : args ) {
+                arg->isForLoopSource = false;
+                pCall->arguments.push_back(arg);
+            }
+            pCall->type = make_smart<TypeDecl>(*batch->result);
+            return pCall;
+        }
+    protected:
+        virtual ExpressionPtr visit ( ExprFor * expr ) override {
+            if ( auto pCall = makeBatchCall(expr) ) {
+                reportFolding();
+                return pCall;
+            }
+            return Visitor::visit(expr);
+        }
+    };
+
     // program
 
     bool Program::optimizationRefFolding() {
@@ -352,6 +510,18 @@ namespace das {
         return context.didAnything();
     }
 
+    bool Program::optimizationIteratorFolding() {
+        IteratorFolding context;
+        visit(context);
+        return context.didAnything();
+    }
+
+    bool Program::optimizationBatchFolding() {
+        BatchFolding context;
+        visit(context);
+        return context.didAnything();
+    }
+
     bool Program::optimizationCondFolding() {
         CondFolding context;
         visit(context);
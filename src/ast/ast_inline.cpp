@@ -0,0 +1,275 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast.h"
+#include "daScript/ast/ast_visitor.h"
+
+namespace das {
+
+    // this substitutes bodies of small functions at the call site
+    //  def add(a,b:int) : int                                  a + b
+    //      return a + b                                ->
+    //  add(x,1)                                                x + 1
+    //  def update(var a:Obj)                                   obj.pos += obj.vel
+    //      a.pos += a.vel                              ->
+    //  update(obj)
+    // only functions, which call nothing but builtins, are inlined. that way inlining always terminates
+    // arguments are substituted with their expressions, so only constants and variables (or fields of variables) are passed in
+    // [inline] ignores the size limit, [noinline] disables inlining of the function
+
+    // checks if the function body can be inlined, and counts its nodes
+    class InlineCheck : public Visitor {
+    public:
+        InlineCheck ( Function * f ) : func(f) {}
+        Function *  func = nullptr;
+        int         nodes = 0;
+        bool        ok = true;
+    protected:
+        virtual void preVisitExpression ( Expression * expr ) override {
+            Visitor::preVisitExpression(expr);
+            nodes ++;
+            if ( !ok ) return;
+            if ( expr->rtti_isConstant() || expr->rtti_isR2V() || expr->rtti_isField() || expr->rtti_isSwizzle() || expr->rtti_isAt() ) {
+                // ok
+            } else if ( expr->rtti_isVar() ) {
+                auto evar = static_cast<ExprVar *>(expr);
+                ok = evar->argument && evar->argumentIndex>=0 && evar->argumentIndex<int(func->arguments.size())
+                    && evar->variable==func->arguments[evar->argumentIndex];
+            } else if ( expr->rtti_isOp1() || expr->rtti_isOp2() || expr->rtti_isOp3() ) {
+                auto op = static_cast<ExprOp *>(expr);
+                if ( op->func ) {
+                    ok = op->func->builtIn;
+                } else {
+                    ok = strcmp(expr->__rtti,"ExprCopy")==0 && expr->type && expr->type->isWorkhorseType();
+                }
+            } else if ( expr->rtti_isCall() ) {
+                auto call = static_cast<ExprCall *>(expr);
+                ok = call->func && call->func->builtIn;
+            } else {
+                ok = false;
+            }
+        }
+    };
+
+    // replaces arguments of the inlined function with the expressions from the call site
+    class InlineSubstitute : public Visitor {
+    public:
+        InlineSubstitute ( Function * f, ExprCall * c ) : func(f), call(c) {}
+        Function *  func = nullptr;
+        ExprCall *  call = nullptr;
+        bool        ok = true;
+    protected:
+        ExpressionPtr valueArgument ( int index ) const {
+            auto & arg = call->arguments[index];
+            if ( arg->rtti_isR2V() ) {
+                return arg->clone();
+            } else if ( arg->type->isRef() ) {
+                return nullptr;
+            } else {
+                return arg->clone();
+            }
+        }
+        ExpressionPtr refArgument ( int index ) const {
+            auto & arg = call->arguments[index];
+            if ( arg->rtti_isR2V() ) {
+                return static_cast<ExprRef2Value *>(arg.get())->subexpr->clone();
+            } else if ( arg->type->isRef() || arg->type->isRefType() ) {
+                return arg->clone();
+            } else if ( arg->rtti_isVar() ) {
+                auto cvar = static_pointer_cast<ExprVar>(arg->clone());
+                cvar->r2v = false;
+                cvar->type->ref = true;
+                return cvar;
+            } else if ( arg->rtti_isField() ) {
+                auto cfield = static_pointer_cast<ExprField>(arg->clone());
+                cfield->r2v = false;
+                cfield->type->ref = true;
+                return cfield;
+            } else {
+                return nullptr;
+            }
+        }
+        virtual ExpressionPtr visit ( ExprRef2Value * expr ) override {
+            if ( expr->subexpr->rtti_isVar() ) {
+                auto evar = static_cast<ExprVar *>(expr->subexpr.get());
+                if ( evar->argument ) {
+                    if ( auto res = valueArgument(evar->argumentIndex) ) return res;
+                    ok = false;
+                }
+            }
+            return Visitor::visit(expr);
+        }
+        virtual ExpressionPtr visit ( ExprVar * expr ) override {
+            if ( expr->argument ) {
+                auto res = expr->r2v ? valueArgument(expr->argumentIndex) : refArgument(expr->argumentIndex);
+                if ( res ) return res;
+                ok = false;
+            }
+            return Visitor::visit(expr);
+        }
+    };
+
+    class InlineFolding : public PassVisitor {
+    public:
+        InlineFolding ( Program * prog, TextWriter & l ) : logs(l) {
+            maxNodes = prog->options.getIntOption("inline_max_nodes", 16);
+            log = prog->options.getBoolOption("log_inline", false);
+        }
+    protected:
+        TextWriter &    logs;
+        Function *      func = nullptr;
+        int32_t         maxNodes = 16;
+        bool            log = false;
+    protected:
+        // call site arguments are substituted as is, so they have to be cheap and have no side effects
+        static bool isSimpleArgument ( Expression * arg ) {
+            for ( ;; ) {
+                if ( arg->rtti_isConstant() ) {
+                    return true;
+                } else if ( arg->rtti_isVar() ) {
+                    return true;
+                } else if ( arg->rtti_isR2V() ) {
+                    arg = static_cast<ExprRef2Value *>(arg)->subexpr.get();
+                } else if ( arg->rtti_isField() ) {
+                    auto efield = static_cast<ExprField *>(arg);
+                    if ( efield->value->type->isPointer() ) return false;
+                    arg = efield->value.get();
+                } else {
+                    return false;
+                }
+            }
+        }
+        // void body may write into its reference arguments, so values passed in can't come from anything, which can be aliased
+        static bool isUnaliasedValue ( Expression * arg ) {
+            if ( arg->rtti_isConstant() ) return true;
+            if ( arg->rtti_isR2V() ) arg = static_cast<ExprRef2Value *>(arg)->subexpr.get();
+            if ( !arg->rtti_isVar() ) return false;
+            auto evar = static_cast<ExprVar *>(arg);
+            return (evar->local || evar->argument) && evar->variable && evar->variable->type->isWorkhorseType() && !evar->variable->type->isRef();
+        }
+        bool canInlineFunction ( Function * fn, string & reason ) const {
+            if ( fn==func ) { reason = "recursive"; return false; }
+            if ( fn->builtIn || !fn->body || !fn->body->rtti_isBlock() ) { reason = "no body"; return false; }
+            if ( fn->noInline ) { reason = "[noinline]"; return false; }
+            if ( fn->generator || fn->lambda || fn->hasMakeBlock || fn->macroFunction || fn->hasToRunAtCompileTime
+                || fn->unsafeOperation || fn->noAot || fn->aotHybrid || fn->requestJit || fn->init || fn->shutdown ) {
+                reason = "special function"; return false;
+            }
+            for ( auto & ann : fn->annotations ) {
+                if ( ann->annotation->name!="inline" ) { reason = "annotated with [" + ann->annotation->name + "]"; return false; }
+            }
+            for ( auto & arg : fn->arguments ) {
+                if ( arg->type->isWorkhorseType() && !arg->type->isRef() ) {
+                    if ( !arg->type->isConst() ) { reason = "argument " + arg->name + " is modified"; return false; }
+                } else if ( !arg->type->isRefType() ) {
+                    reason = "argument " + arg->name + " is not passed by value"; return false;
+                }
+            }
+            auto block = static_cast<ExprBlock *>(fn->body.get());
+            if ( block->finalList.size() || block->list.empty() ) { reason = "block shape"; return false; }
+            if ( fn->result->isVoid() ) {
+                for ( auto & ex : block->list ) {
+                    if ( ex->rtti_isReturn() ) { reason = "early return"; return false; }
+                }
+            } else {
+                if ( block->list.size()!=1 || !block->list[0]->rtti_isReturn() ) { reason = "more than a return"; return false; }
+                auto ret = static_cast<ExprReturn *>(block->list[0].get());
+                if ( !ret->subexpr || ret->subexpr->type->isRef() || !fn->result->isWorkhorseType() || fn->result->isRef() ) {
+                    reason = "result is not a value"; return false;
+                }
+            }
+            InlineCheck check(fn);
+            for ( auto & ex : block->list ) {
+                if ( ex->rtti_isReturn() ) {
+                    static_cast<ExprReturn *>(ex.get())->subexpr->visit(check);
+                } else {
+                    ex->visit(check);
+                }
+            }
+            if ( !check.ok ) { reason = "body is not simple"; return false; }
+            bool forceInline = fn->inlineFunction;
+            if ( !forceInline && check.nodes>maxNodes ) { reason = "too big (" + to_string(check.nodes) + " nodes)"; return false; }
+            return true;
+        }
+        ExpressionPtr inlineCall ( ExprCall * call ) {
+            auto fn = call->func;
+            if ( !fn || fn->builtIn ) return nullptr;
+            string reason;
+            bool ok = canInlineFunction(fn, reason);
+            if ( ok ) {
+                for ( auto & arg : call->arguments ) {
+                    if ( !arg->type || !isSimpleArgument(arg.get()) ) {
+                        reason = "argument is not simple";
+                        ok = false;
+                        break;
+                    }
+                }
+                if ( ok && fn->result->isVoid() ) {
+                    for ( size_t i=0, is=fn->arguments.size(); i!=is; ++i ) {
+                        if ( !fn->arguments[i]->type->isRefType() && !isUnaliasedValue(call->arguments[i].get()) ) {
+                            reason = "argument may be aliased";
+                            ok = false;
+                            break;
+                        }
+                    }
+                }
+            }
+            ExpressionPtr res;
+            if ( ok ) {
+                auto block = static_cast<ExprBlock *>(fn->body.get());
+                InlineSubstitute subst(fn, call);
+                if ( fn->result->isVoid() ) {
+                    auto nblock = static_pointer_cast<ExprBlock>(block->clone());
+                    nblock->at = call->at;
+                    res = nblock->visit(subst);
+                } else {
+                    auto ret = static_cast<ExprReturn *>(block->list[0].get());
+                    res = ret->subexpr->clone()->visit(subst);
+                    if ( !res->type->isSameType(*call->type, RefMatters::yes, ConstMatters::no, TemporaryMatters::no) ) {
+                        subst.ok = false;
+                    }
+                }
+                if ( !subst.ok ) {
+                    reason = "argument can't be substituted";
+                    ok = false;
+                    res.reset();
+                }
+            }
+            if ( log && (ok || fn->inlineFunction) ) {
+                logs << call->at.describe() << ": " << fn->getMangledName() << (ok ? " inlined" : " not inlined, " + reason) << "\n";
+            }
+            if ( ok ) reportFolding();
+            return res;
+        }
+    protected:
+        virtual void preVisit ( Function * f ) override {
+            Visitor::preVisit(f);
+            func = f;
+        }
+        virtual FunctionPtr visit ( Function * that ) override {
+            func = nullptr;
+            return Visitor::visit(that);
+        }
+        virtual ExpressionPtr visitBlockExpression ( ExprBlock * block, Expression * expr ) override {
+            if ( func && expr->rtti_isCall() ) {
+                auto call = static_cast<ExprCall *>(expr);
+                if ( call->func && call->func->result->isVoid() ) {
+                    if ( auto res = inlineCall(call) ) return res;
+                }
+            }
+            return Visitor::visitBlockExpression(block, expr);
+        }
+        virtual ExpressionPtr visit ( ExprCall * call ) override {
+            if ( func && call->func && !call->func->result->isVoid() ) {
+                if ( auto res = inlineCall(call) ) return res;
+            }
+            return Visitor::visit(call);
+        }
+    };
+
+    bool Program::optimizationInline(TextWriter & logs) {
+        if ( getDebugger() || getProfiler() || options.getBoolOption("no_inline", false) ) return false;
+        InlineFolding context(this, logs);
+        visit(context);
+        return context.didAnything();
+    }
+}
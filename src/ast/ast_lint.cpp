@@ -512,7 +512,12 @@ namespace das {
         "stack",                        Type::tInt,
         "intern_strings",               Type::tBool,
         "multiple_contexts",            Type::tBool,
+        "cow_globals",                  Type::tBool,
+        "lazy_simulate",                Type::tBool,
+        "code_image",                   Type::tBool,
         "persistent_heap",              Type::tBool,
+        "profile_alloc",                Type::tBool,
+        "profile_alloc_sample",         Type::tInt,
         "heap_size_hint",               Type::tInt,
         "string_heap_size_hint",        Type::tInt,
         "gc",                           Type::tBool,
@@ -520,15 +525,19 @@ namespace das {
     // aot
         "no_aot",                       Type::tBool,
         "aot_prologue",                 Type::tBool,
+        "background_aot",               Type::tBool,
+        "background_aot_threshold",     Type::tInt,
     // logging
         "log",                          Type::tBool,
         "log_optimization_passes",      Type::tBool,
+        "log_inline",                   Type::tBool,
         "log_stack",                    Type::tBool,
         "log_init",                     Type::tBool,
         "log_symbol_use",               Type::tBool,
         "log_var_scope",                Type::tBool,
         "log_nodes",                    Type::tBool,
         "log_nodes_aot_hash",           Type::tBool,
+        "log_jit",                      Type::tBool,
         "log_mem",                      Type::tBool,
         "log_debug_mem",                Type::tBool,
         "log_cpp",                      Type::tBool,
@@ -549,7 +558,10 @@ namespace das {
     // optimization
         "optimize",                     Type::tBool,
         "fusion",                       Type::tBool,
+        "jit",                          Type::tBool,
         "remove_unused_symbols",        Type::tBool,
+        "no_inline",                    Type::tBool,
+        "inline_max_nodes",             Type::tInt,
     // language
         "always_export_initializer",    Type::tBool,
         "infer_time_folding",           Type::tBool,
@@ -558,6 +570,7 @@ namespace das {
         "indenting",                    Type::tInt,
     // debugger
         "debugger",                     Type::tBool,
+        "debugger_step_checks",         Type::tBool,
     // profiler
         "profiler",                     Type::tBool,
     // runtime checks
@@ -272,6 +272,9 @@ namespace das {
                 if ( fn->requestJit ) {
                     ss << "[jit]";
                 }
+                if ( fn->elementWise ) {
+                    ss << "[element_wise]";
+                }
                 ss << "\n";
             }
             if ( fn->fastCall ) { ss << "[fastcall]\n"; }
@@ -465,7 +465,12 @@ namespace das
             if ( context.thisProgram->getDebugger() ) {
                 auto sbody = body->simulate(context);
                 if ( !sbody->rtti_node_isBlock() ) {
-                    auto block = context.code->makeNode<SimNodeDebug_BlockNF>(sbody->debugInfo);
+                    SimNode_BlockNF * block;
+                    if ( context.thisProgram->getDebuggerStepChecks() ) {
+                        block = context.code->makeNode<SimNodeDebug_BlockNF>(sbody->debugInfo);
+                    } else {
+                        block = context.code->makeNode<SimNode_BlockNF>(sbody->debugInfo);
+                    }
                     block->total = 1;
                     block->list = (SimNode **) context.code->allocate(sizeof(SimNode *)*1);
                     block->list[0] = sbody;
@@ -1763,14 +1768,20 @@ namespace das
                 }
             }
         }
+        // debugger build keeps single statement in the block, so that it can be patched for the single step
+#if DAS_DEBUGGER
+        bool stepSlot = context.thisProgram->getDebugger() && !context.thisProgram->getDebuggerStepChecks();
+#else
+        bool stepSlot = false;
+#endif
         // TODO: what if list size is 0?
-        if ( simlist.size()!=1 || isClosure || finalList.size() ) {
+        if ( simlist.size()!=1 || isClosure || finalList.size() || stepSlot ) {
             SimNode_Block * block;
             if ( isClosure ) {
                 bool needResult = type!=nullptr && type->baseType!=Type::tVoid;
                 bool C0 = !needResult && simlist.size()==1 && finalList.size()==0;
 #if DAS_DEBUGGER
-                if ( context.thisProgram->getDebugger() ) {
+                if ( context.thisProgram->getDebuggerStepChecks() ) {
                     block = context.code->makeNode<SimNodeDebug_ClosureBlock>(at, needResult, C0, annotationData);
                 } else
 #endif
@@ -1780,7 +1791,7 @@ namespace das
             } else {
                 if ( maxLabelIndex!=-1 ) {
 #if DAS_DEBUGGER
-                    if ( context.thisProgram->getDebugger() ) {
+                    if ( context.thisProgram->getDebuggerStepChecks() ) {
                         block = context.code->makeNode<SimNodeDebug_BlockWithLabels>(at);
                     } else
 #endif
@@ -1791,7 +1802,7 @@ namespace das
                 } else {
                     if ( finalList.size()==0 ) {
 #if DAS_DEBUGGER
-                        if ( context.thisProgram->getDebugger() ) {
+                        if ( context.thisProgram->getDebuggerStepChecks() ) {
                             block = context.code->makeNode<SimNodeDebug_BlockNF>(at);
                         } else
 #endif
@@ -1800,7 +1811,7 @@ namespace das
                         }
                     } else {
 #if DAS_DEBUGGER
-                        if ( context.thisProgram->getDebugger() ) {
+                        if ( context.thisProgram->getDebuggerStepChecks() ) {
                             block = context.code->makeNode<SimNodeDebug_Block>(at);
                         } else
 #endif
@@ -2265,7 +2276,7 @@ namespace das
 
     SimNode * ExprTryCatch::simulate (Context & context) const {
 #if DAS_DEBUGGER
-        if ( context.thisProgram->getDebugger() ) {
+        if ( context.thisProgram->getDebuggerStepChecks() ) {
             return context.code->makeNode<SimNodeDebug_TryCatch>(at,
                                                     try_block->simulate(context),
                                                     catch_block->simulate(context));
@@ -2387,7 +2398,7 @@ namespace das
         bool condIfZero = false;
         bool match0 = matchEquNequZero(cond, zeroCond, condIfZero);
 #if DAS_DEBUGGER
-        if ( context.thisProgram->getDebugger() ) {
+        if ( context.thisProgram->getDebuggerStepChecks() ) {
             if ( match0 && zeroCond->type->isWorkhorseType() ) {
                 if ( condIfZero ) {
                     if ( if_false ) {
@@ -2476,7 +2487,7 @@ namespace das
 
     SimNode * ExprWhile::simulate (Context & context) const {
 #if DAS_DEBUGGER
-        if ( context.thisProgram->getDebugger() ) {
+        if ( context.thisProgram->getDebuggerStepChecks() ) {
             auto node = context.code->makeNode<SimNodeDebug_While>(at, cond->simulate(context));
             simulateFinal(context, body, node);
             return node;
@@ -2525,7 +2536,7 @@ namespace das
         if ( (sourceTypes>1) || hybridRange || nativeIterators || stringChars || /* this is how much we can unroll */ total>MAX_FOR_UNROLL ) {
             SimNode_ForWithIteratorBase * result;
 #if DAS_DEBUGGER
-            if ( context.thisProgram->getDebugger() ) {
+            if ( context.thisProgram->getDebuggerStepChecks() ) {
                 if ( total>MAX_FOR_UNROLL ) {
                     result = (SimNode_ForWithIteratorBase *) context.code->makeNode<SimNodeDebug_ForWithIteratorBase>(at);
                 } else {
@@ -2595,7 +2606,8 @@ namespace das
             auto subB = static_pointer_cast<ExprBlock>(body);
             bool loop1 = (subB->list.size() == 1);
 #if DAS_DEBUGGER
-            if ( context.thisProgram->getDebugger() ) {
+            // single statement loops read the body once, before the loop, so patching it would not step the loop which already runs
+            if ( context.thisProgram->getDebuggerStepChecks() || (loop1 && context.thisProgram->getDebugger()) ) {
                 if ( dynamicArrays ) {
                     if (loop1) {
                         result = (SimNode_ForBase *) context.code->makeNodeUnrollNZ_FOR<SimNodeDebug_ForGoodArray1>(total, at);
@@ -2909,6 +2921,160 @@ namespace das
     extern "C" int64_t ref_time_ticks ();
     extern "C" int get_time_usec (int64_t reft);
 
+    // function bodies are simulated on the first call. state is shared between the context and its clones.
+    // functions can be called from other contexts (i.e. via invoke_in_context), so code heap and function table
+    // of the program are used during the simulation, and not the ones of the calling context.
+    // modules are shared between programs, and other programs reassign function and variable indices,
+    // so indices are saved and swapped back in for the duration of the simulation
+    struct ProgramLazySimulation : LazySimulation {
+        ProgramLazySimulation ( Program * prog, const shared_ptr<DebugInfoAllocator> & di )
+            : program(prog), helper(di) {}
+        void addFunction ( Function * fn ) {
+            if ( fn->index>=int(functions.size()) ) {
+                functions.resize(fn->index + 1, nullptr);
+                bodies.resize(fn->index + 1, nullptr);
+            }
+            functions[fn->index] = fn;
+            totalLazy ++;
+        }
+        void saveIndices () {
+            program->library.foreach([&](Module * pm){
+                for ( auto & fn : pm->functions.each() ) {
+                    if ( fn->index>=0 ) {
+                        savedFunctions.emplace_back(fn.get(), fn->index);
+                    }
+                }
+                for ( auto & var : pm->globals.each() ) {
+                    if ( var->index>=0 ) {
+                        savedVariables.emplace_back(var.get(), var->index, var->stackTop);
+                    }
+                }
+                return true;
+            }, "*");
+        }
+        void swapIndices () {
+            for ( auto & sf : savedFunctions ) {
+                swap(sf.first->index, sf.second);
+            }
+            for ( auto & sv : savedVariables ) {
+                swap(get<0>(sv)->index, get<1>(sv));
+                swap(get<0>(sv)->stackTop, get<2>(sv));
+            }
+        }
+        void bind ( Context & context ) {
+            code = context.code;
+            constStringHeap = context.constStringHeap;
+            simFunctions = context.functions;
+            totalSimFunctions = context.totalFunctions;
+        }
+        SimNode * simulate ( Context & context, int32_t index, SimNode * stub ) {
+            SimNode * body = nullptr;
+            bool failed = false;
+            {
+                lock_guard<mutex> guard(lock);
+                body = bodies[index];
+                if ( !body ) {
+                    auto saveCode = context.code;
+                    auto saveConstStringHeap = context.constStringHeap;
+                    auto saveFunctions = context.functions;
+                    auto saveTotalFunctions = context.totalFunctions;
+                    auto saveProgram = context.thisProgram;
+                    auto saveHelper = context.thisHelper;
+                    context.code = code;
+                    context.constStringHeap = constStringHeap;
+                    context.functions = simFunctions;
+                    context.totalFunctions = totalSimFunctions;
+                    context.thisProgram = program.get();
+                    context.thisHelper = &helper;
+                    swapIndices();
+                    body = functions[index]->simulate(context);
+                    failed = !body || program->failed();
+#if DAS_FUSION
+                    if ( !failed ) {
+                        TextWriter logs;
+                        body = program->fusion(context, body, logs);
+                    }
+#endif
+                    swapIndices();
+                    context.code = saveCode;
+                    context.constStringHeap = saveConstStringHeap;
+                    context.functions = saveFunctions;
+                    context.totalFunctions = saveTotalFunctions;
+                    context.thisProgram = saveProgram;
+                    context.thisHelper = saveHelper;
+                    if ( !failed ) {
+                        bodies[index] = body;
+                        totalSimulated ++;
+                    }
+                }
+                if ( !failed && simFunctions[index].code==stub ) {
+                    simFunctions[index].code = body;
+                }
+            }
+            if ( failed ) {
+                context.throw_error_ex("failed to simulate function %s", simFunctions[index].mangledName);
+            }
+            return body;
+        }
+        virtual void simulateAll ( Context & context ) override {
+            for ( int32_t index=0, is=int32_t(functions.size()); index!=is; ++index ) {
+                if ( functions[index] ) {
+                    simulate(context, index, simFunctions[index].code);
+                }
+            }
+        }
+        ProgramPtr                      program;
+        DebugInfoHelper                 helper;
+        shared_ptr<NodeAllocator>       code;
+        shared_ptr<ConstStringAllocator> constStringHeap;
+        SimFunction *                   simFunctions = nullptr;
+        int32_t                         totalSimFunctions = 0;
+        vector<Function *>              functions;
+        vector<SimNode *>               bodies;
+        vector<pair<Function *,int>>                    savedFunctions;
+        vector<tuple<Variable *,int,uint32_t>>          savedVariables;
+        mutex                           lock;
+        int32_t                         totalLazy = 0;
+        int32_t                         totalSimulated = 0;
+    };
+
+    struct SimNode_LazyFunction : SimNode {
+        SimNode_LazyFunction ( const LineInfo & at, ProgramLazySimulation * o, int32_t i )
+            : SimNode(at), owner(o), index(i) {}
+        virtual SimNode * visit ( SimVisitor & vis ) override {
+            V_BEGIN();
+            V_OP(LazyFunction);
+            V_ARG(index);
+            V_SUB_OPT(body);
+            V_END();
+        }
+        virtual vec4f DAS_EVAL_ABI eval ( Context & context ) override {
+            DAS_PROFILE_NODE
+            if ( !body ) {
+                body = owner->simulate(context, index, this);
+            }
+            return body->eval(context);
+        }
+        ProgramLazySimulation * owner;
+        int32_t                 index;
+        SimNode *               body = nullptr;
+    };
+
+    bool Program::canShareGlobalsImage ( const Context & context ) const {
+        // clones skip the init script, so [init] functions would not run
+        if ( context.totalInitFunctions ) return false;
+        // globals which can reference heap of the original context can't be shared
+        bool allRawPod = true;
+        for (auto & pm : library.modules ) {
+            pm->globals.foreach([&](auto pvar){
+                if ( pvar->used && !pvar->global_shared && !pvar->type->isRawPod() ) {
+                    allRawPod = false;
+                }
+            });
+        }
+        return allRawPod;
+    }
+
     bool Program::simulate ( Context & context, TextWriter & logs, StackAllocator * sharedStack ) {
         auto time0 = ref_time_ticks();
         isSimulating = true;
@@ -2923,13 +3089,33 @@ namespace das
         }
         context.heap->setInitialSize ( options.getIntOption("heap_size_hint", policies.heap_size_hint) );
         context.stringHeap->setInitialSize ( options.getIntOption("string_heap_size_hint", policies.string_heap_size_hint) );
+        if ( context.persistent && !folding && options.getBoolOption("profile_alloc", policies.profile_alloc) ) {
+            context.profileAllocations(uint32_t(options.getIntOption("profile_alloc_sample", policies.profile_alloc_sample)));
+        }
         context.constStringHeap = make_shared<ConstStringAllocator>();
         if ( globalStringHeapSize ) {
             context.constStringHeap->setInitialSize(globalStringHeapSize);
         }
-        DebugInfoHelper helper(context.debugInfo);
+        // lazy simulation keeps the helper, since functions are simulated after we are done here
+        // macro contexts are simulated while the program is still being inferred, so they are never lazy
+        // AOT tool hashes the simulated code, so it needs the real function bodies
+        // background AOT generates C++ for the whole program, and hashes the code, so it needs the real function bodies too
+        bool background_aot = !folding && !isCompilingMacros && !getDebugger() && !(policies.aot && !thisModule->isModule) && !policies.aot_module
+            && options.getBoolOption("background_aot", policies.background_aot)
+            && !options.getBoolOption("code_image", policies.code_image);   // image function table is read-only
+        bool lazy = !folding && !isCompilingMacros && !getDebugger() && !(policies.aot && !thisModule->isModule) && !policies.aot_module
+            && options.getBoolOption("lazy_simulate", policies.lazy_simulate) && !background_aot
+            && !options.getBoolOption("code_image", policies.code_image);   // image needs all the code up front
+        shared_ptr<ProgramLazySimulation> lazySim;
+        if ( lazy ) {
+            lazySim = make_shared<ProgramLazySimulation>(this, context.debugInfo);
+            lazySim->saveIndices();
+        }
+        DebugInfoHelper localHelper(context.debugInfo);
+        DebugInfoHelper & helper = lazySim ? lazySim->helper : localHelper;
         helper.rtti = options.getBoolOption("rtti",policies.rtti);
         context.thisHelper = &helper;
+        context.lazySimulation = lazySim;
         context.globalVariables = (GlobalVariable *) context.code->allocate( totalVariables*sizeof(GlobalVariable) );
         context.globalsSize = 0;
         context.sharedSize = 0;
@@ -2968,6 +3154,11 @@ namespace das
         context.functions = (SimFunction *) context.code->allocate( totalFunctions*sizeof(SimFunction) );
         context.totalFunctions = totalFunctions;
         auto debuggerOrGC = getDebugger()  || context.thisProgram->options.getBoolOption("gc",false);
+        // jit keeps node pointers in the native code, so it goes after the last relocation and never into the image
+        bool jitAllowed = !folding && !isCompilingMacros && !getDebugger() && !policies.aot_module && !background_aot
+            && !options.getBoolOption("code_image", policies.code_image);
+        bool jitAll = options.getBoolOption("jit", policies.jit);
+        vector<int> jitFunctions;
         vector<FunctionPtr> lookupFunctionTable;
         das_hash_map<uint64_t,Function *> fnByMnh;
         if ( totalFunctions ) {
@@ -3005,7 +3196,15 @@ namespace das
                     if ( pfun->module->builtIn && !pfun->module->promoted ) {
                         gfun.builtin = true;
                     }
-                    gfun.code = pfun->simulate(context);
+                    if ( lazySim && pfun->annotations.empty() ) {   // annotated functions may need code during simulate
+                        gfun.code = context.code->makeNode<SimNode_LazyFunction>(pfun->at, lazySim.get(), pfun->index);
+                        lazySim->addFunction(pfun.get());
+                    } else {
+                        gfun.code = pfun->simulate(context);
+                        if ( jitAllowed && (jitAll || pfun->requestJit) ) {
+                            jitFunctions.push_back(pfun->index);
+                        }
+                    }
                     lookupFunctionTable.push_back(pfun);
                 });
             }
@@ -3050,9 +3249,13 @@ namespace das
             return false;
         }
         bool aot_hint = policies.aot && !folding && !thisModule->isModule;
+        // AOT tool visits the code to compute semantic hashes, so it keeps the regular code heap
+        bool code_image = !folding && !getDebugger() && !policies.aot_module && !isCompilingMacros
+            && options.getBoolOption("code_image",policies.code_image);
 #if DAS_FUSION
         if ( !folding ) {               // note: only run fusion when not folding
-            fusion(context, logs);
+            // AOT semantic hash is computed over the fused code, so linking keeps jit candidates fused
+            fusion(context, logs, aot_hint ? nullptr : &jitFunctions);
             context.relocateCode(true); // this to get better estimate on relocated size. its fust enough
         }
 #else
@@ -3061,11 +3264,14 @@ namespace das
         }
 #endif
         if ( !folding ) {
-            if ( !aot_hint ) {
+            if ( !aot_hint && !code_image ) {   // code image is relocated from the code with node headers
                 context.relocateCode();
             }
         }
         context.restart();
+        if ( lazySim ) {
+            lazySim->bind(context);
+        }
         // now call annotation simulate
         das_hash_map<int,Function *> indexToFunction;
         for (auto & pm : library.modules) {
@@ -3116,7 +3322,22 @@ namespace das
         if ( aot_hint ) {
             linkCppAot(context, getGlobalAotLibrary(), logs);
             context.relocateCode(true);
-            context.relocateCode();
+            if ( !code_image ) {
+                context.relocateCode();
+            }
+        }
+        if ( !jitFunctions.empty() ) {
+            jit(context, jitFunctions, logs);
+        }
+        if ( background_aot ) {
+            makeBackgroundAot(context, logs);
+        }
+        // code image is made before the init script, so that globals point to the final function table
+        if ( code_image && !context.makeCodeImage() ) {
+            if ( context.code->prefixWithHeader ) {
+                context.relocateCode();
+            }
+            code_image = false;
         }
         // build init functions
         vector<SimFunction *> allInitFunctions;
@@ -3194,6 +3415,12 @@ namespace das
             }
         }
         context.restart();
+        // copy-on-write globals for the clones
+        if ( !folding && options.getBoolOption("cow_globals",policies.cow_globals) ) {
+            if ( canShareGlobalsImage(context) ) {
+                context.makeGlobalsImage();
+            }
+        }
         if (options.getBoolOption("log_mem",false) ) {
             context.logMemInfo(logs);
             logs << "shared        " << context.getSharedMemorySize() << "\n";
@@ -3206,6 +3433,9 @@ namespace das
             registerAotCpp(logs,context);
         }
         context.debugger = getDebugger();
+        if ( context.debugger && !getDebuggerStepChecks() ) {
+            context.makeSingleStepNodes();
+        }
         isSimulating = false;
         context.thisHelper = &helper;   // note - we may need helper for the 'complete'
         auto boundProgram = daScriptEnvironment::bound->g_Program;
@@ -3251,6 +3481,13 @@ namespace das
         }, thisModule.get());
         context.thisHelper = nullptr;
         daScriptEnvironment::bound->g_Program = boundProgram;
+        // code image is sealed read-only, after everything which patches the code
+        if ( code_image ) {
+            code_image = context.sealCodeImage();
+        }
+        if ( options.getBoolOption("code_image",policies.code_image) && options.getBoolOption("log_mem",false) ) {
+            logs << "code image    " << (code_image ? "read-only" : "not available") << "\n";
+        }
         // dispatch about new inited context
         context.announceCreation();
         if ( options.getBoolOption("log_debug_mem",false) ) {
@@ -3262,6 +3499,10 @@ namespace das
         if ( options.getBoolOption("log_total_compile_time",false) ) {
             auto dt = get_time_usec(time0) / 1000000.;
             logs << "simulate (including init script) took " << dt << "\n";
+            if ( lazySim ) {
+                logs << "lazy simulate " << lazySim->totalLazy << " of " << totalFunctions << " functions, "
+                    << lazySim->totalSimulated << " simulated so far\n";
+            }
         }
         dapiSimulateContext(context);
         return errors.size() == 0;
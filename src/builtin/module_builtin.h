@@ -16,6 +16,9 @@ namespace das {
         void addTime(ModuleLibrary & lib);
         void addMiscTypes(ModuleLibrary & lib);
         bool appendCompiledFunctions();
-        virtual ModuleAotType aotRequire ( TextWriter & ) const override { return ModuleAotType::cpp; }
+        virtual ModuleAotType aotRequire ( TextWriter & tw ) const override {
+            tw << "#include \"daScript/misc/performance_time.h\"\n";     // ref_time_ticks, get_time_usec
+            return ModuleAotType::cpp;
+        }
     };
 }
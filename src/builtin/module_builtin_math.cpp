@@ -617,6 +617,141 @@ namespace das {
         return v_quat_conjugate(q);
     }
 
+    // float3 is packed, so the 16 byte load is only safe when there is another element after it
+    __forceinline vec4f v_ld_float3_last ( const float3 & v ) {
+        return v_make_vec4f(v.x, v.y, v.z, 0.0f);
+    }
+
+    template <typename OpT>
+    __forceinline void map_float3 ( float3 * dst, const float3 * src, uint32_t n, OpT && op ) {
+        if ( !n ) return;
+        for ( uint32_t i=0; i!=n-1; ++i ) {
+            v_stu_p3(&dst[i].x, op(v_ldu(&src[i].x)));
+        }
+        v_stu_p3(&dst[n-1].x, op(v_ld_float3_last(src[n-1])));
+    }
+
+    template <typename OpT>
+    __forceinline void map_float3_pair ( const float3 * a, const float3 * b, uint32_t n, OpT && op ) {
+        if ( !n ) return;
+        for ( uint32_t i=0; i!=n-1; ++i ) {
+            op(i, v_ldu(&a[i].x), v_ldu(&b[i].x));
+        }
+        op(n-1, v_ld_float3_last(a[n-1]), v_ld_float3_last(b[n-1]));
+    }
+
+    // four elements at a time, then one at a time for the tail. op stores the result
+    template <typename OpT>
+    __forceinline void map_float_soa ( uint32_t n, OpT && op ) {
+        uint32_t i = 0;
+        for ( ; i+4<=n; i+=4 ) {
+            op(i, false);
+        }
+        for ( ; i!=n; ++i ) {
+            op(i, true);
+        }
+    }
+
+    __forceinline vec4f v_ld_soa ( const float * p, bool one ) {
+        return one ? v_set_x(*p) : v_ldu(p);
+    }
+
+    __forceinline void v_st_soa ( float * p, vec4f v, bool one ) {
+        if ( one ) *p = v_extract_x(v); else v_stu(p, v);
+    }
+
+    template <typename TT>
+    __forceinline uint32_t same_size ( const TArray<TT> & a, const TArray<TT> & b, Context * context, LineInfoArg * at ) {
+        if ( a.size!=b.size ) context->throw_error_at(at ? *at : LineInfo(), "array size mismatch, %u vs %u", a.size, b.size);
+        return a.size;
+    }
+
+    void float4x4_transform_points ( TArray<float3> & dst, const TArray<float3> & src, const float4x4 & m, Context * context ) {
+        array_resize(*context, dst, src.size, sizeof(float3), false);
+        mat44f vm;
+        memcpy(&vm, &m, sizeof(float4x4));
+        map_float3((float3 *)dst.data, (const float3 *)src.data, src.size, [&](vec4f v) {
+            return v_mat44_mul_vec3p(vm, v);
+        });
+    }
+
+    void float3x4_transform_points ( TArray<float3> & dst, const TArray<float3> & src, const float3x4 & m, Context * context ) {
+        array_resize(*context, dst, src.size, sizeof(float3), false);
+        mat44f vm;
+        v_mat44_make_from_43cu_unsafe(vm, &m.m[0].x);
+        map_float3((float3 *)dst.data, (const float3 *)src.data, src.size, [&](vec4f v) {
+            return v_mat44_mul_vec3p(vm, v);
+        });
+    }
+
+    void float4x4_transform_points_soa ( TArray<float> & x, TArray<float> & y, TArray<float> & z, const float4x4 & m, Context * context, LineInfoArg * at ) {
+        same_size(x, y, context, at);
+        uint32_t n = same_size(x, z, context, at);
+        vec4f c[4][3];
+        for ( int col=0; col!=4; ++col ) {
+            c[col][0] = v_splats(m.m[col].x);
+            c[col][1] = v_splats(m.m[col].y);
+            c[col][2] = v_splats(m.m[col].z);
+        }
+        float * px = (float *)x.data, * py = (float *)y.data, * pz = (float *)z.data;
+        map_float_soa(n, [&](uint32_t i, bool one) {
+            vec4f vx = v_ld_soa(px+i, one), vy = v_ld_soa(py+i, one), vz = v_ld_soa(pz+i, one);
+            v_st_soa(px+i, v_madd(c[0][0], vx, v_madd(c[1][0], vy, v_madd(c[2][0], vz, c[3][0]))), one);
+            v_st_soa(py+i, v_madd(c[0][1], vx, v_madd(c[1][1], vy, v_madd(c[2][1], vz, c[3][1]))), one);
+            v_st_soa(pz+i, v_madd(c[0][2], vx, v_madd(c[1][2], vy, v_madd(c[2][2], vz, c[3][2]))), one);
+        });
+    }
+
+    void normalize_all3 ( TArray<float3> & v ) {
+        map_float3((float3 *)v.data, (const float3 *)v.data, v.size, [](vec4f a) {
+            return v_norm3_safe(a);
+        });
+    }
+
+    void normalize_all_soa ( TArray<float> & x, TArray<float> & y, TArray<float> & z, Context * context, LineInfoArg * at ) {
+        same_size(x, y, context, at);
+        uint32_t n = same_size(x, z, context, at);
+        float * px = (float *)x.data, * py = (float *)y.data, * pz = (float *)z.data;
+        map_float_soa(n, [&](uint32_t i, bool one) {
+            vec4f vx = v_ld_soa(px+i, one), vy = v_ld_soa(py+i, one), vz = v_ld_soa(pz+i, one);
+            vec4f len = v_sqrt4(v_madd(vx, vx, v_madd(vy, vy, v_mul(vz, vz))));
+            v_st_soa(px+i, v_remove_not_finite(v_div(vx, len)), one);
+            v_st_soa(py+i, v_remove_not_finite(v_div(vy, len)), one);
+            v_st_soa(pz+i, v_remove_not_finite(v_div(vz, len)), one);
+        });
+    }
+
+    void dot_all3 ( TArray<float> & dst, const TArray<float3> & a, const TArray<float3> & b, Context * context, LineInfoArg * at ) {
+        uint32_t n = same_size(a, b, context, at);
+        array_resize(*context, dst, n, sizeof(float), false);
+        float * pd = (float *)dst.data;
+        map_float3_pair((const float3 *)a.data, (const float3 *)b.data, n, [&](uint32_t i, vec4f va, vec4f vb) {
+            pd[i] = v_extract_x(v_dot3_x(va, vb));
+        });
+    }
+
+    void lerp_all1 ( TArray<float> & dst, const TArray<float> & a, const TArray<float> & b, float t, Context * context, LineInfoArg * at ) {
+        uint32_t n = same_size(a, b, context, at);
+        array_resize(*context, dst, n, sizeof(float), false);
+        float * pd = (float *)dst.data;
+        const float * pa = (const float *)a.data, * pb = (const float *)b.data;
+        vec4f vt = v_splats(t);
+        map_float_soa(n, [&](uint32_t i, bool one) {
+            vec4f va = v_ld_soa(pa+i, one);
+            v_st_soa(pd+i, v_madd(v_sub(v_ld_soa(pb+i, one), va), vt, va), one);
+        });
+    }
+
+    void lerp_all3 ( TArray<float3> & dst, const TArray<float3> & a, const TArray<float3> & b, float t, Context * context, LineInfoArg * at ) {
+        uint32_t n = same_size(a, b, context, at);
+        array_resize(*context, dst, n, sizeof(float3), false);
+        float3 * pd = (float3 *)dst.data;
+        vec4f vt = v_splats(t);
+        map_float3_pair((const float3 *)a.data, (const float3 *)b.data, n, [&](uint32_t i, vec4f va, vec4f vb) {
+            v_stu_p3(&pd[i].x, v_madd(v_sub(vb, va), vt, va));
+        });
+    }
+
     class Module_Math : public Module {
     public:
         Module_Math() : Module("math") {
@@ -666,42 +801,42 @@ namespace das {
             addFunctionCommonTyped<double>(*this, lib);
             addFunctionCommonTyped<int64_t>(*this, lib);
             addFunctionCommonTyped<uint64_t>(*this, lib);
-            addExtern<DAS_BIND_FUN(uint32_hash)>(*this, lib, "uint32_hash", SideEffects::none, "uint32_hash")->arg("seed");
-            addExtern<DAS_BIND_FUN(uint_noise1D)>(*this, lib, "uint_noise_1D", SideEffects::none, "uint_noise1D")->args({"position","seed"});
+            addExternBatch<uint32_t(uint32_t),DAS_BIND_FUN(uint32_hash)>(*this, lib, "uint32_hash", "uint32_hash")->arg("seed");
+            addExternBatch<uint32_t(int32_t,uint32_t),DAS_BIND_FUN(uint_noise1D)>(*this, lib, "uint_noise_1D", "uint_noise1D")->args({"position","seed"});
             addExtern<DAS_BIND_FUN(uint_noise2D_int2)>(*this, lib, "uint_noise_2D", SideEffects::none, "uint_noise2D_int2")->args({"position","seed"});
             addExtern<DAS_BIND_FUN(uint_noise3D_int3)>(*this, lib, "uint_noise_3D", SideEffects::none, "uint_noise3D_int3")->args({"position","seed"});
-            addExternEx<float(float2,float2),DAS_BIND_FUN(dot2)>(*this, lib, "dot", SideEffects::none, "dot2")->args({"x","y"});
-            addExternEx<float(float3,float3),DAS_BIND_FUN(dot3)>(*this, lib, "dot", SideEffects::none, "dot3")->args({"x","y"});
-            addExternEx<float(float4,float4),DAS_BIND_FUN(dot4)>(*this, lib, "dot", SideEffects::none, "dot4")->args({"x","y"});
+            addExternBatch<float(float2,float2),DAS_BIND_FUN(dot2)>(*this, lib, "dot", "dot2")->args({"x","y"});
+            addExternBatch<float(float3,float3),DAS_BIND_FUN(dot3)>(*this, lib, "dot", "dot3")->args({"x","y"});
+            addExternBatch<float(float4,float4),DAS_BIND_FUN(dot4)>(*this, lib, "dot", "dot4")->args({"x","y"});
             addExternEx<float3(float3,float3),DAS_BIND_FUN(cross3)>(*this, lib, "cross", SideEffects::none, "cross3")->args({"x","y"});
             addExternEx<float2(float2),DAS_BIND_FUN(normalize2)>(*this, lib, "fast_normalize", SideEffects::none, "normalize2")->arg("x");
             addExternEx<float3(float3),DAS_BIND_FUN(normalize3)>(*this, lib, "fast_normalize", SideEffects::none, "normalize3")->arg("x");
             addExternEx<float4(float4),DAS_BIND_FUN(normalize4)>(*this, lib, "fast_normalize", SideEffects::none, "normalize4")->arg("x");
-            addExternEx<float2(float2),DAS_BIND_FUN(safe_normalize2)>(*this, lib, "normalize", SideEffects::none, "safe_normalize2")->arg("x");
-            addExternEx<float3(float3),DAS_BIND_FUN(safe_normalize3)>(*this, lib, "normalize", SideEffects::none, "safe_normalize3")->arg("x");
-            addExternEx<float4(float4),DAS_BIND_FUN(safe_normalize4)>(*this, lib, "normalize", SideEffects::none, "safe_normalize4")->arg("x");
-            addExternEx<float(float2),DAS_BIND_FUN(length2)>(*this, lib, "length", SideEffects::none, "length2")->arg("x");
-            addExternEx<float(float3),DAS_BIND_FUN(length3)>(*this, lib, "length", SideEffects::none, "length3")->arg("x");
-            addExternEx<float(float4),DAS_BIND_FUN(length4)>(*this, lib, "length", SideEffects::none, "length4")->arg("x");
-            addExternEx<float(float2),DAS_BIND_FUN(invlength2)>(*this, lib, "inv_length", SideEffects::none,"invlength2")->arg("x");
-            addExternEx<float(float3),DAS_BIND_FUN(invlength3)>(*this, lib, "inv_length", SideEffects::none,"invlength3")->arg("x");
-            addExternEx<float(float4),DAS_BIND_FUN(invlength4)>(*this, lib, "inv_length", SideEffects::none,"invlength4")->arg("x");
-            addExternEx<float(float2),DAS_BIND_FUN(invlengthSq2)>(*this, lib, "inv_length_sq", SideEffects::none, "invlengthSq2")->arg("x");
-            addExternEx<float(float3),DAS_BIND_FUN(invlengthSq3)>(*this, lib, "inv_length_sq", SideEffects::none, "invlengthSq3")->arg("x");
-            addExternEx<float(float4),DAS_BIND_FUN(invlengthSq4)>(*this, lib, "inv_length_sq", SideEffects::none, "invlengthSq4")->arg("x");
-            addExternEx<float(float2),DAS_BIND_FUN(lengthSq2)>(*this, lib, "length_sq", SideEffects::none, "lengthSq2")->arg("x");
-            addExternEx<float(float3),DAS_BIND_FUN(lengthSq3)>(*this, lib, "length_sq", SideEffects::none, "lengthSq3")->arg("x");
-            addExternEx<float(float4),DAS_BIND_FUN(lengthSq4)>(*this, lib, "length_sq", SideEffects::none, "lengthSq4")->arg("x");
-            addExternEx<float(float2,float2),DAS_BIND_FUN(distance2)>(*this, lib, "distance", SideEffects::none, "distance2")->args({"x","y"});
-            addExternEx<float(float2,float2),DAS_BIND_FUN(distanceSq2)>(*this, lib, "distance_sq", SideEffects::none, "distanceSq2")->args({"x","y"});
+            addExternBatch<float2(float2),DAS_BIND_FUN(safe_normalize2)>(*this, lib, "normalize", "safe_normalize2")->arg("x");
+            addExternBatch<float3(float3),DAS_BIND_FUN(safe_normalize3)>(*this, lib, "normalize", "safe_normalize3")->arg("x");
+            addExternBatch<float4(float4),DAS_BIND_FUN(safe_normalize4)>(*this, lib, "normalize", "safe_normalize4")->arg("x");
+            addExternBatch<float(float2),DAS_BIND_FUN(length2)>(*this, lib, "length", "length2")->arg("x");
+            addExternBatch<float(float3),DAS_BIND_FUN(length3)>(*this, lib, "length", "length3")->arg("x");
+            addExternBatch<float(float4),DAS_BIND_FUN(length4)>(*this, lib, "length", "length4")->arg("x");
+            addExternBatch<float(float2),DAS_BIND_FUN(invlength2)>(*this, lib, "inv_length", "invlength2")->arg("x");
+            addExternBatch<float(float3),DAS_BIND_FUN(invlength3)>(*this, lib, "inv_length", "invlength3")->arg("x");
+            addExternBatch<float(float4),DAS_BIND_FUN(invlength4)>(*this, lib, "inv_length", "invlength4")->arg("x");
+            addExternBatch<float(float2),DAS_BIND_FUN(invlengthSq2)>(*this, lib, "inv_length_sq", "invlengthSq2")->arg("x");
+            addExternBatch<float(float3),DAS_BIND_FUN(invlengthSq3)>(*this, lib, "inv_length_sq", "invlengthSq3")->arg("x");
+            addExternBatch<float(float4),DAS_BIND_FUN(invlengthSq4)>(*this, lib, "inv_length_sq", "invlengthSq4")->arg("x");
+            addExternBatch<float(float2),DAS_BIND_FUN(lengthSq2)>(*this, lib, "length_sq", "lengthSq2")->arg("x");
+            addExternBatch<float(float3),DAS_BIND_FUN(lengthSq3)>(*this, lib, "length_sq", "lengthSq3")->arg("x");
+            addExternBatch<float(float4),DAS_BIND_FUN(lengthSq4)>(*this, lib, "length_sq", "lengthSq4")->arg("x");
+            addExternBatch<float(float2,float2),DAS_BIND_FUN(distance2)>(*this, lib, "distance", "distance2")->args({"x","y"});
+            addExternBatch<float(float2,float2),DAS_BIND_FUN(distanceSq2)>(*this, lib, "distance_sq", "distanceSq2")->args({"x","y"});
             addExternEx<float(float2,float2),DAS_BIND_FUN(invdistance2)>(*this, lib, "inv_distance", SideEffects::none, "invdistance2")->args({"x","y"});
             addExternEx<float(float2,float2),DAS_BIND_FUN(invdistanceSq2)>(*this, lib, "inv_distance_sq", SideEffects::none, "invdistanceSq2")->args({"x","y"});
-            addExternEx<float(float3,float3),DAS_BIND_FUN(distance3)>(*this, lib, "distance", SideEffects::none, "distance3")->args({"x","y"});
-            addExternEx<float(float3,float3),DAS_BIND_FUN(distanceSq3)>(*this, lib, "distance_sq", SideEffects::none, "distanceSq3")->args({"x","y"});
+            addExternBatch<float(float3,float3),DAS_BIND_FUN(distance3)>(*this, lib, "distance", "distance3")->args({"x","y"});
+            addExternBatch<float(float3,float3),DAS_BIND_FUN(distanceSq3)>(*this, lib, "distance_sq", "distanceSq3")->args({"x","y"});
             addExternEx<float(float3,float3),DAS_BIND_FUN(invdistance3)>(*this, lib, "inv_distance", SideEffects::none, "invdistance3")->args({"x","y"});
             addExternEx<float(float3,float3),DAS_BIND_FUN(invdistanceSq3)>(*this, lib, "inv_distance_sq", SideEffects::none, "invdistanceSq3")->args({"x","y"});
-            addExternEx<float(float4,float4),DAS_BIND_FUN(distance4)>(*this, lib, "distance", SideEffects::none, "distance4")->args({"x","y"});
-            addExternEx<float(float4,float4),DAS_BIND_FUN(distanceSq4)>(*this, lib, "distance_sq", SideEffects::none, "distanceSq4")->args({"x","y"});
+            addExternBatch<float(float4,float4),DAS_BIND_FUN(distance4)>(*this, lib, "distance", "distance4")->args({"x","y"});
+            addExternBatch<float(float4,float4),DAS_BIND_FUN(distanceSq4)>(*this, lib, "distance_sq", "distanceSq4")->args({"x","y"});
             addExternEx<float(float4,float4),DAS_BIND_FUN(invdistance4)>(*this, lib, "inv_distance", SideEffects::none, "invdistance4")->args({"x","y"});
             addExternEx<float(float4,float4),DAS_BIND_FUN(invdistanceSq4)>(*this, lib, "inv_distance_sq", SideEffects::none, "invdistanceSq4")->args({"x","y"});
             // unique float functions
@@ -830,6 +965,23 @@ namespace das {
                 SideEffects::none,"pack_float_to_byte")->arg("x");
             addExtern<DAS_BIND_FUN(unpack_byte_to_float)>(*this, lib, "unpack_byte_to_float",
                 SideEffects::none,"unpack_byte_to_float")->arg("x");
+            // bulk
+            addExtern<DAS_BIND_FUN(float4x4_transform_points)>(*this, lib, "transform_points",
+                SideEffects::modifyArgument,"float4x4_transform_points")->args({"dst","src","m","context"});
+            addExtern<DAS_BIND_FUN(float3x4_transform_points)>(*this, lib, "transform_points",
+                SideEffects::modifyArgument,"float3x4_transform_points")->args({"dst","src","m","context"});
+            addExtern<DAS_BIND_FUN(float4x4_transform_points_soa)>(*this, lib, "transform_points",
+                SideEffects::modifyArgument,"float4x4_transform_points_soa")->args({"x","y","z","m","context","at"});
+            addExtern<DAS_BIND_FUN(normalize_all3)>(*this, lib, "normalize_all",
+                SideEffects::modifyArgument,"normalize_all3")->arg("v");
+            addExtern<DAS_BIND_FUN(normalize_all_soa)>(*this, lib, "normalize_all",
+                SideEffects::modifyArgument,"normalize_all_soa")->args({"x","y","z","context","at"});
+            addExtern<DAS_BIND_FUN(dot_all3)>(*this, lib, "dot_all",
+                SideEffects::modifyArgument,"dot_all3")->args({"dst","a","b","context","at"});
+            addExtern<DAS_BIND_FUN(lerp_all1)>(*this, lib, "lerp_all",
+                SideEffects::modifyArgument,"lerp_all1")->args({"dst","a","b","t","context","at"});
+            addExtern<DAS_BIND_FUN(lerp_all3)>(*this, lib, "lerp_all",
+                SideEffects::modifyArgument,"lerp_all3")->args({"dst","a","b","t","context","at"});
             // lets make sure its all aot ready
             verifyAotReady();
         }
@@ -637,7 +637,15 @@ namespace das {
             addField<DAS_BIND_MANAGED_FIELD(stack)>("stack");
             addField<DAS_BIND_MANAGED_FIELD(intern_strings)>("intern_strings");
             addField<DAS_BIND_MANAGED_FIELD(persistent_heap)>("persistent_heap");
+            addField<DAS_BIND_MANAGED_FIELD(profile_alloc)>("profile_alloc");
+            addField<DAS_BIND_MANAGED_FIELD(profile_alloc_sample)>("profile_alloc_sample");
             addField<DAS_BIND_MANAGED_FIELD(multiple_contexts)>("multiple_contexts");
+            addField<DAS_BIND_MANAGED_FIELD(cow_globals)>("cow_globals");
+            addField<DAS_BIND_MANAGED_FIELD(lazy_simulate)>("lazy_simulate");
+            addField<DAS_BIND_MANAGED_FIELD(code_image)>("code_image");
+            addField<DAS_BIND_MANAGED_FIELD(jit)>("jit");
+            addField<DAS_BIND_MANAGED_FIELD(background_aot)>("background_aot");
+            addField<DAS_BIND_MANAGED_FIELD(background_aot_threshold)>("background_aot_threshold");
             addField<DAS_BIND_MANAGED_FIELD(heap_size_hint)>("heap_size_hint");
             addField<DAS_BIND_MANAGED_FIELD(string_heap_size_hint)>("string_heap_size_hint");
             addField<DAS_BIND_MANAGED_FIELD(solid_context)>("solid_context");
@@ -667,6 +675,7 @@ namespace das {
             addField<DAS_BIND_MANAGED_FIELD(fail_on_lack_of_aot_export)>("fail_on_lack_of_aot_export");
         // debugger
             addField<DAS_BIND_MANAGED_FIELD(debugger)>("debugger");
+            addField<DAS_BIND_MANAGED_FIELD(debugger_step_checks)>("debugger_step_checks");
         // profiler
             addField<DAS_BIND_MANAGED_FIELD(profiler)>("profiler");
         }
@@ -114,6 +114,22 @@ namespace das
         };
     };
 
+    struct InlineFunctionAnnotation : MarkFunctionAnnotation {
+        InlineFunctionAnnotation() : MarkFunctionAnnotation("inline") { }
+        virtual bool apply(const FunctionPtr & func, ModuleGroup &, const AnnotationArgumentList &, string &) override {
+            func->inlineFunction = true;
+            return true;
+        };
+    };
+
+    struct NoInlineFunctionAnnotation : MarkFunctionAnnotation {
+        NoInlineFunctionAnnotation() : MarkFunctionAnnotation("noinline") { }
+        virtual bool apply(const FunctionPtr & func, ModuleGroup &, const AnnotationArgumentList &, string &) override {
+            func->noInline = true;
+            return true;
+        };
+    };
+
     struct GenericFunctionAnnotation : MarkFunctionAnnotation {
         GenericFunctionAnnotation() : MarkFunctionAnnotation("generic") { }
         virtual bool isGeneric() const override {
@@ -503,6 +519,10 @@ namespace das
         return (int32_t) context->stringHeap->depth();
     }
 
+    uint64_t globals_pages_copied ( Context * context ) {
+        return context->getGlobalsPagesCopied();
+    }
+
     void string_heap_collect ( bool validate, Context * context, LineInfoArg * info ) {
         context->collectStringHeap(info,validate);
     }
@@ -521,6 +541,17 @@ namespace das
         context->reportAnyHeap(info, false, true, true, false);
     }
 
+    void allocation_profile_report ( Context * context, LineInfoArg * ) {
+        LOG tout(LogLevel::debug);
+        context->reportAllocations(tout);
+    }
+
+    char * get_allocation_profile ( int32_t top, Context * context, LineInfoArg * ) {
+        TextWriter tw;
+        context->reportAllocations(tw, uint32_t(max(top, 0)));
+        return context->stringHeap->allocateString(tw.str());
+    }
+
     void memory_report ( bool errOnly, Context * context, LineInfoArg * info ) {
         /*
         context->stringHeap->report();
@@ -1058,6 +1089,7 @@ namespace das
     bool das_instrument_jit ( void * pfun, const Func func, Context * context ) {
         auto simfn = func.PTR;
         if ( !simfn ) return false;
+        if ( context->isCodeImage() ) return false;     // function table is read-only
         if ( simfn->code && simfn->code->rtti_node_isJit() ) {
             auto jitNode = static_cast<SimNode_Jit *>(simfn->code);
             jitNode->func = (JitFunction) pfun;
@@ -1315,6 +1347,8 @@ namespace das
         addAnnotation(make_smart<HybridFunctionAnnotation>());
         addAnnotation(make_smart<UnsafeDerefFunctionAnnotation>());
         addAnnotation(make_smart<SkipLockCheckFunctionAnnotation>());
+        addAnnotation(make_smart<InlineFunctionAnnotation>());
+        addAnnotation(make_smart<NoInlineFunctionAnnotation>());
         addAnnotation(make_smart<MarkUsedFunctionAnnotation>());
         addAnnotation(make_smart<LocalOnlyFunctionAnnotation>());
         addAnnotation(make_smart<PersistentStructureAnnotation>());
@@ -1430,6 +1464,9 @@ namespace das
         addExtern<DAS_BIND_FUN(string_heap_depth)>(*this, lib, "string_heap_depth",
             SideEffects::modifyExternal, "string_heap_depth")
                 ->arg("context");
+        addExtern<DAS_BIND_FUN(globals_pages_copied)>(*this, lib, "globals_pages_copied",
+            SideEffects::modifyExternal, "globals_pages_copied")
+                ->arg("context");
         auto shcol = addExtern<DAS_BIND_FUN(string_heap_collect)>(*this, lib, "string_heap_collect",
             SideEffects::modifyExternal, "string_heap_collect")
                 ->args({"validate","context","at"});
@@ -1447,6 +1484,13 @@ namespace das
         addExtern<DAS_BIND_FUN(heap_report)>(*this, lib, "heap_report",
             SideEffects::modifyExternal, "heap_report")
                 ->args({"context","line"});
+        addExtern<DAS_BIND_FUN(allocation_profile_report)>(*this, lib, "allocation_profile_report",
+            SideEffects::modifyExternal, "allocation_profile_report")
+                ->args({"context","line"});
+        auto gap = addExtern<DAS_BIND_FUN(get_allocation_profile)>(*this, lib, "get_allocation_profile",
+            SideEffects::accessExternal, "get_allocation_profile")
+                ->args({"top","context","at"});
+        gap->arguments[0]->init = make_smart<ExprConstInt>(16);
         addExtern<DAS_BIND_FUN(memory_report)>(*this, lib, "memory_report",
             SideEffects::modifyExternal, "memory_report")
                 ->args({"errorsOnly","context","lineinfo"});
@@ -818,14 +818,14 @@ namespace das
             addExtern<DAS_BIND_FUN(format<double>)>  (*this, lib, "format",
                 SideEffects::none, "format<double>")->args({"format","value","context"});
             // queries
-            addExtern<DAS_BIND_FUN(is_alpha)> (*this, lib, "is_alpha",
-                SideEffects::none, "is_alpha")->arg("Character");
-            addExtern<DAS_BIND_FUN(is_new_line)> (*this, lib, "is_new_line",
-                SideEffects::none, "is_new_line")->arg("Character");
-            addExtern<DAS_BIND_FUN(is_white_space)> (*this, lib, "is_white_space",
-                SideEffects::none, "is_white_space")->arg("Character");
-            addExtern<DAS_BIND_FUN(is_number)> (*this, lib, "is_number",
-                SideEffects::none, "is_number")->arg("Character");
+            addExternBatch<bool(int32_t),DAS_BIND_FUN(is_alpha)> (*this, lib, "is_alpha",
+                "is_alpha")->arg("Character");
+            addExternBatch<bool(int32_t),DAS_BIND_FUN(is_new_line)> (*this, lib, "is_new_line",
+                "is_new_line")->arg("Character");
+            addExternBatch<bool(int32_t),DAS_BIND_FUN(is_white_space)> (*this, lib, "is_white_space",
+                "is_white_space")->arg("Character");
+            addExternBatch<bool(int32_t),DAS_BIND_FUN(is_number)> (*this, lib, "is_number",
+                "is_number")->arg("Character");
             // bitset helpers
             addExtern<DAS_BIND_FUN(is_char_in_set)>(*this, lib, "is_char_in_set",
                 SideEffects::none,"is_char_in_set")->args({"Character","Charset","Context","At"});
@@ -483,3 +483,119 @@ namespace das {
         return g_dasRoot;
     }
 }
+
+#if defined(__linux__) && !defined(_EMSCRIPTEN_VER)
+    #include <unistd.h>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    namespace das {
+        struct CowImage {
+            int     fd;
+            size_t  size;
+        };
+        void * cowImageCreate ( const void * data, size_t size ) {
+            if ( !size ) return nullptr;
+            int fd = memfd_create("das_cow_image", MFD_CLOEXEC);
+            if ( fd==-1 ) return nullptr;
+            if ( ftruncate(fd, size)!=0 ) {
+                close(fd);
+                return nullptr;
+            }
+            void * pm = mmap(nullptr, size, PROT_READ|PROT_WRITE, MAP_SHARED, fd, 0);
+            if ( pm==MAP_FAILED ) {
+                close(fd);
+                return nullptr;
+            }
+            memcpy(pm, data, size);
+            munmap(pm, size);
+            auto image = new CowImage;
+            image->fd = fd;
+            image->size = size;
+            return image;
+        }
+        void cowImageRelease ( void * image ) {
+            if ( !image ) return;
+            auto cimg = (CowImage *) image;
+            close(cimg->fd);
+            delete cimg;
+        }
+        char * cowImageMap ( void * image ) {
+            auto cimg = (CowImage *) image;
+            void * pm = mmap(nullptr, cimg->size, PROT_READ|PROT_WRITE, MAP_PRIVATE, cimg->fd, 0);
+            return pm==MAP_FAILED ? nullptr : (char *) pm;
+        }
+        void cowImageUnmap ( char * ptr, size_t size ) {
+            munmap(ptr, size);
+        }
+        size_t cowImagePageSize ( void ) {
+            return size_t(sysconf(_SC_PAGESIZE));
+        }
+        size_t cowImagePagesCopied ( const char * ptr, size_t size ) {
+            // pagemap entry: bit 63 - page present, bit 61 - page is file backed or shared anonymous
+            // present page of private mapping which is not file backed is a copy
+            int fd = open("/proc/self/pagemap", O_RDONLY);
+            if ( fd==-1 ) return 0;
+            size_t pageSize = cowImagePageSize();
+            size_t first = uintptr_t(ptr) / pageSize;
+            size_t total = (size + pageSize - 1) / pageSize;
+            size_t copied = 0;
+            for ( size_t i=0; i!=total; ++i ) {
+                uint64_t entry = 0;
+                if ( pread(fd, &entry, sizeof(entry), off_t((first+i)*sizeof(entry)))!=sizeof(entry) ) break;
+                if ( (entry & (1ull<<63)) && !(entry & (1ull<<61)) ) copied ++;
+            }
+            close(fd);
+            return copied;
+        }
+        char * codeImageAllocate ( size_t size ) {
+            if ( !size ) return nullptr;
+            void * pm = mmap(nullptr, size, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+            return pm==MAP_FAILED ? nullptr : (char *) pm;
+        }
+        bool codeImageSeal ( char * ptr, size_t size ) {
+            return mprotect(ptr, size, PROT_READ)==0;
+        }
+        bool codeImageUnseal ( char * ptr, size_t size ) {
+            return mprotect(ptr, size, PROT_READ|PROT_WRITE)==0;
+        }
+        bool jitCodeSeal ( char * ptr, size_t size ) {
+            return mprotect(ptr, size, PROT_READ|PROT_EXEC)==0;
+        }
+        void codeImageFree ( char * ptr, size_t size ) {
+            munmap(ptr, size);
+        }
+    }
+#else
+    namespace das {
+        void * cowImageCreate ( const void *, size_t ) {
+            return nullptr;
+        }
+        void cowImageRelease ( void * ) {
+        }
+        char * cowImageMap ( void * ) {
+            return nullptr;
+        }
+        void cowImageUnmap ( char *, size_t ) {
+        }
+        size_t cowImagePagesCopied ( const char *, size_t ) {
+            return 0;
+        }
+        size_t cowImagePageSize ( void ) {
+            return 4096;
+        }
+        char * codeImageAllocate ( size_t ) {
+            return nullptr;
+        }
+        bool codeImageSeal ( char *, size_t ) {
+            return false;
+        }
+        bool codeImageUnseal ( char *, size_t ) {
+            return false;
+        }
+        bool jitCodeSeal ( char *, size_t ) {
+            return false;
+        }
+        void codeImageFree ( char *, size_t ) {
+        }
+    }
+#endif
@@ -9,6 +9,20 @@
 namespace das
 {
     struct HashDataWalker : DataWalker {
+#if DAS_FAST_HASH
+        uint64_t hash = WYHASH_SEED;
+        template <typename TT>
+        __forceinline void update ( TT & data ) {
+            hash = wyhash_mix(hash ^ HashValue<TT>::hash(data), 0xe7037ed1a0b428dbull);
+        }
+        __forceinline void updateString ( char * & str ) {
+            uint64_t shash = str ? wyhash_blockz64((uint8_t *)str) : 1099511628211ul;
+            hash = wyhash_mix(hash ^ shash, 0xe7037ed1a0b428dbull);
+        }
+        __forceinline uint64_t getHash ( void ) const {
+            return wyhash_final(hash);
+        }
+#else
         const uint64_t fnv_prime = 1099511628211ul;
         uint64_t fnv_bias = 14695981039346656037ul;
         template <typename TT>
@@ -35,6 +49,7 @@ namespace das
             }
             return fnv_bias;
         }
+#endif
     // walker
         HashDataWalker ( Context & ctx ) {
             context = &ctx;
@@ -141,34 +141,25 @@ namespace das {
 
     void StringHeapAllocator::setIntern(bool on) {
         needIntern = on;
-        if ( !needIntern ) {
-            das_string_set empty;
-            swap ( internMap, empty );
-        }
     }
 
     void StringHeapAllocator::reset() {
-        das_string_set empty;
-        swap ( internMap, empty );
+        internHeap.reset();
     }
 
     char * StringHeapAllocator::intern(const char * str, uint32_t length) const {
-        if ( needIntern ) {
-            auto it = internMap.find(StrHashEntry(str,length));
-            return it != internMap.end() ? (char *)it->ptr : nullptr;
-        } else {
-            return nullptr;
-        }
+        return needIntern ? internHeap.intern(str,length) : nullptr;
     }
 
-    void StringHeapAllocator::recognize ( char * str ) {
-        if ( !str ) return;
+    char * StringHeapAllocator::recognize ( char * str ) {
+        if ( !str || !needIntern ) return str;
         uint32_t length = uint32_t(strlen(str));
         uint32_t size = length + 1;
         size = (size + 15) & ~15;
-        if ( needIntern && isOwnPtr(str, size) ) {
-            internMap.insert(StrHashEntry(str,length));
-        }
+        if ( !isOwnPtr(str, size) ) return str;
+        auto istr = internHeap.allocateString(str, length);
+        free(str, length + 1);
+        return istr;
     }
 
     char * ConstStringAllocator::intern(const char * str, uint32_t length) const {
@@ -190,9 +181,13 @@ namespace das {
                     return (char *) it->ptr;
                 }
             }
-            if ( auto str = (char *)allocate(length + 1) ) {
+            if ( auto hdr = (StringHeader *)allocate(uint32_t(sizeof(StringHeader)) + length + 1) ) {
+                auto str = (char *)(hdr + 1);
                 if ( text ) memcpy(str, text, length);
                 str[length] = 0;
+                hdr->hash = hash_string_key(str);
+                hdr->length = length;
+                hdr->padding = 0;
                 internMap.insert(StrHashEntry(str,length));
                 return str;
             }
@@ -203,10 +198,7 @@ namespace das {
     char * StringHeapAllocator::allocateString ( const char * text, uint32_t length ) {
         if ( length ) {
             if ( needIntern && text ) {
-                auto it = internMap.find(StrHashEntry(text,length));
-                if ( it != internMap.end() ) {
-                    return (char *) it->ptr;
-                }
+                return internHeap.allocateString(text, length);
             }
             if ( auto str = (char *)allocate(length + 1) ) {
 #if DAS_TRACK_ALLOCATIONS
@@ -214,7 +206,6 @@ namespace das {
 #endif
                 if ( text ) memcpy(str, text, length);
                 str[length] = 0;
-                if ( needIntern && text ) internMap.insert(StrHashEntry(str,length));
                 return str;
             }
         }
@@ -222,7 +213,7 @@ namespace das {
     }
 
     void StringHeapAllocator::freeString ( char * text, uint32_t length ) {
-        if ( needIntern ) internMap.erase(StrHashEntry(text,length));
+        if ( internHeap.isOwnPtr(text) ) return;
         free ( text, length + 1 );
     }
 
@@ -256,14 +247,6 @@ namespace das {
 
     void PersistentStringAllocator::sweep() {
         model.sweep();
-        if ( needIntern ) {
-            das_string_set empty;
-            swap ( internMap, empty );
-            forEachString([&](const char * str){
-                uint32_t length = uint32_t(strlen(str));
-                internMap.insert(StrHashEntry(str,length));
-            });
-        }
     }
 
     void PersistentStringAllocator::report() {
@@ -344,4 +327,115 @@ namespace das {
         stringBytes += bytes;
         return nname;
     }
+
+    AllocationProfiler::AllocationProfiler ( Context * ctx, uint32_t sampleBytes )
+        : context(ctx), interval(sampleBytes ? sampleBytes : 1), countdown(int64_t(interval)) {
+    }
+
+    void AllocationProfiler::sample ( char * ptr, uint32_t size, bool str ) {
+        countdown = int64_t(interval);
+        FuncInfo * fn = nullptr;
+        LineInfo * at = nullptr;
+        const char * aotFile = nullptr;
+#if DAS_ENABLE_STACK_WALK
+        if ( context && context->stack.ap() < context->stack.top() ) {
+            Prologue * pp = (Prologue *) context->stack.ap();
+            if ( pp->info ) {
+                intptr_t iblock = intptr_t(pp->block);
+                fn = (iblock & 1) ? ((Block *)(iblock & ~1))->info : pp->info;
+            }
+            if ( fn ) {
+                at = pp->line;
+            } else {
+                aotFile = pp->fileName;
+            }
+        }
+#endif
+        uint64_t key = uint64_t(intptr_t(fn)) ^ (uint64_t(intptr_t(at))<<7) ^ (uint64_t(intptr_t(aotFile))<<13) ^ uint64_t(str);
+        auto & bucket = siteIndex[key];
+        uint32_t siteId = uint32_t(-1);
+        for ( auto si : bucket ) {
+            const auto & site = sites[si];
+            if ( site.fn==fn && site.at==at && site.aotFile==aotFile && site.string==str ) {
+                siteId = si;
+                break;
+            }
+        }
+        if ( siteId==uint32_t(-1) ) {
+            siteId = uint32_t(sites.size());
+            AllocationSite site;
+            site.fn = fn;
+            site.at = at;
+            site.aotFile = aotFile;
+            site.string = str;
+            sites.push_back(site);
+            bucket.push_back(siteId);
+        }
+        uint64_t weight = das::max(uint64_t(size), uint64_t(interval));
+        auto & site = sites[siteId];
+        site.samples ++;
+        site.bytes += weight;
+        live[ptr] = LiveSample{siteId, size, weight, str};
+    }
+
+    void AllocationProfiler::sweep ( AnyHeapAllocator * heap, bool str ) {
+        for ( auto it = live.begin(); it!=live.end(); ) {
+            uint32_t size = (it->second.size + 15) & ~15;   // shoe is bucketed by 16 bytes
+            if ( it->second.string==str && !heap->isValidPtr((char *)it->first, size) ) {
+                it = live.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void AllocationProfiler::reset ( bool str ) {
+        for ( auto it = live.begin(); it!=live.end(); ) {
+            if ( it->second.string==str ) {
+                it = live.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    void AllocationProfiler::report ( TextWriter & tw, uint32_t top ) {
+        for ( auto & site : sites ) site.liveBytes = 0;
+        for ( auto & ls : live ) sites[ls.second.site].liveBytes += ls.second.weight;
+        auto describeSite = [&]( const AllocationSite & site ) {
+            tw << (site.string ? "string\t" : "heap\t");
+            if ( site.fn ) {
+                tw << site.fn->name;
+                if ( site.at ) tw << " from " << site.at->describe();
+            } else if ( site.aotFile ) {
+                tw << "<aot> " << site.aotFile;
+            } else {
+                tw << "<no frame>";
+            }
+            tw << "\n";
+        };
+        vector<uint32_t> order(sites.size());
+        for ( uint32_t i=0, is=uint32_t(sites.size()); i!=is; ++i ) order[i] = i;
+        uint32_t count = das::min(top, uint32_t(order.size()));
+        tw << "allocation profile, sampled every " << interval << " bytes\n";
+        tw << "top allocation sites:\nbytes\tsamples\tkind\tsite\n";
+        partial_sort(order.begin(), order.begin()+count, order.end(), [&]( uint32_t a, uint32_t b ){
+            return sites[a].bytes > sites[b].bytes;
+        });
+        for ( uint32_t i=0; i!=count; ++i ) {
+            const auto & site = sites[order[i]];
+            tw << site.bytes << "\t" << site.samples << "\t";
+            describeSite(site);
+        }
+        tw << "live bytes by site:\nbytes\tkind\tsite\n";
+        partial_sort(order.begin(), order.begin()+count, order.end(), [&]( uint32_t a, uint32_t b ){
+            return sites[a].liveBytes > sites[b].liveBytes;
+        });
+        for ( uint32_t i=0; i!=count; ++i ) {
+            const auto & site = sites[order[i]];
+            if ( !site.liveBytes ) break;
+            tw << site.liveBytes << "\t";
+            describeSite(site);
+        }
+    }
 }
@@ -6,6 +6,7 @@
 #include "daScript/simulate/debug_print.h"
 #include "daScript/misc/fpe.h"
 #include "daScript/misc/debug_break.h"
+#include "daScript/misc/sysos.h"
 
 #include <stdarg.h>
 
@@ -955,14 +956,50 @@ namespace das
         persistent = ph;
     }
 
+    GlobalsImage::GlobalsImage ( const char * data, uint32_t sz ) {
+        image = cowImageCreate(data, sz);
+        size = sz;
+    }
+
+    GlobalsImage::~GlobalsImage() {
+        cowImageRelease(image);
+    }
+
+    void Context::freeGlobals() {
+        if ( globals && globalsOwner ) {
+            if ( globalsCow ) {
+                cowImageUnmap(globals, globalsSize);
+            } else {
+                das_aligned_free16(globals);
+            }
+        }
+        globals = nullptr;
+        globalsCow = false;
+    }
+
+    bool Context::makeGlobalsImage() {
+        if ( !globals || !globalsSize || !globalsOwner ) return false;
+        auto img = make_shared<GlobalsImage>(globals, globalsSize);
+        if ( !img->image ) return false;
+        globalsImage = img;
+        return true;
+    }
+
+    uint64_t Context::getGlobalsPagesCopied() const {
+        return globalsCow ? cowImagePagesCopied(globals, globalsSize) : 0;
+    }
+
+    void Context::simulateLazyFunctions() {
+        if ( lazySimulation ) {
+            lazySimulation->simulateAll(*this);
+        }
+    }
+
     void Context::strip() {
         stringHeap.reset();
         heap.reset();
         stack.strip();
-        if ( globals && globalsOwner ) {
-            das_aligned_free16(globals);
-            globals = nullptr;
-        }
+        freeGlobals();
         if ( shared && sharedOwner ) {
             das_aligned_free16(shared);
             shared = nullptr;
@@ -998,7 +1035,7 @@ namespace das
     // code
         if ( code ) {
             tw << "\tcode: " << code->bytesAllocated() << " of " << code->totalAlignedMemoryAllocated()
-                << ", depth = " << code->depth() << "\n";
+                << ", depth = " << code->depth() << (codeImage ? ", read-only image" : "") << "\n";
             tw << "\t\ttableMN[" << tabMnLookup.size() << "]\n";
             tw << "\t\ttableGMN[" << tabGMnLookup.size() << "]\n";
             tw << "\t\ttableAd[" << tabAdLookup.size() << "]\n";
@@ -1036,9 +1073,17 @@ namespace das
         //bytesUsed += totalVariables*sizeof(GlobalVariable);
     // globals data
         if ( globals ) {
-            tw << "\tglobal data: " << globalsSize << "\n";
-            bytesTotal += globalsSize;
-            bytesUsed += globalsSize;
+            if ( globalsCow ) {
+                uint64_t copied = getGlobalsPagesCopied();
+                uint64_t copiedSize = copied * cowImagePageSize();
+                tw << "\tglobal data: " << globalsSize << " copy-on-write, " << copied << " pages copied (" << copiedSize << ")\n";
+                bytesTotal += copiedSize;
+                bytesUsed += copiedSize;
+            } else {
+                tw << "\tglobal data: " << globalsSize << "\n";
+                bytesTotal += globalsSize;
+                bytesUsed += globalsSize;
+            }
         }
     // shared
         if ( shared ) {
@@ -1061,6 +1106,10 @@ namespace das
         code = ctx.code;
         constStringHeap = ctx.constStringHeap;
         debugInfo = ctx.debugInfo;
+        lazySimulation = ctx.lazySimulation;
+        backgroundAot = ctx.backgroundAot;
+        singleStepNodes = ctx.singleStepNodes;
+        codeImage = ctx.codeImage;
         thisProgram = ctx.thisProgram;
         thisHelper = ctx.thisHelper;
         category.value = ctx.category.value;
@@ -1094,12 +1143,13 @@ namespace das
         mem += constStringHeap ? constStringHeap->totalAlignedMemoryAllocated() : 0;
         mem += debugInfo ? debugInfo->totalAlignedMemoryAllocated() : 0;
         mem += sharedSize;
+        mem += globalsImage ? globalsImage->size : 0;
         return mem;
     }
 
     uint64_t Context::getUniqueMemorySize() const {
         uint64_t mem = 0;
-        mem += globalsSize;
+        mem += globalsCow ? getGlobalsPagesCopied()*cowImagePageSize() : globalsSize;
         mem += stack.size();
         mem += heap ? heap->totalAlignedMemoryAllocated() : 0;
         mem += stringHeap ? stringHeap->totalAlignedMemoryAllocated() : 0;
@@ -1112,6 +1162,10 @@ namespace das
         code = ctx.code;
         constStringHeap = ctx.constStringHeap;
         debugInfo = ctx.debugInfo;
+        lazySimulation = ctx.lazySimulation;
+        backgroundAot = ctx.backgroundAot;
+        singleStepNodes = ctx.singleStepNodes;
+        codeImage = ctx.codeImage;
         thisProgram = ctx.thisProgram;
         thisHelper = ctx.thisHelper;
         name = "clone of " + ctx.name;
@@ -1128,6 +1182,7 @@ namespace das
         heap->setInitialSize(ctx.heap->getInitialSize());
         stringHeap->setInitialSize(ctx.stringHeap->getInitialSize());
         stringHeap->setIntern(ctx.stringHeap->isIntern());
+        if ( ctx.allocProfiler ) profileAllocations(ctx.allocProfiler->getInterval());
         // globals
         annotationData = ctx.annotationData;
         globalsSize = ctx.globalsSize;
@@ -1135,7 +1190,16 @@ namespace das
         globalVariables = ctx.globalVariables;
         totalVariables = ctx.totalVariables;
         if ( ctx.globals ) {
-            globals = (char *) das_aligned_alloc16(globalsSize);
+            if ( ctx.globalsImage ) {
+                globals = cowImageMap(ctx.globalsImage->image);
+                if ( globals ) {
+                    globalsCow = true;
+                    globalsImage = ctx.globalsImage;
+                }
+            }
+            if ( !globals ) {
+                globals = (char *) das_aligned_alloc16(globalsSize);
+            }
         }
         // shared
         sharedSize = ctx.sharedSize;
@@ -1156,7 +1220,9 @@ namespace das
         announceCreation();
         // now, make it good to go
         restart();
-        if ( stack.size() > globalInitStackSize ) {
+        if ( globalsCow ) {
+            // globals are already initialized in the image, and shared globals belong to the owner
+        } else if ( stack.size() > globalInitStackSize ) {
             runInitScript();
         } else {
             auto ssz = max ( int(stack.size()), 16384 ) + globalInitStackSize;
@@ -1178,13 +1244,15 @@ namespace das
         });
         // shutdown
         runShutdownScript();
+        // other contexts, which share the code, may still be stepped
+        setSingleStep(false);
         // and free memory
-        if ( globals && globalsOwner ) {
-            das_aligned_free16(globals);
-        }
+        freeGlobals();
         if ( shared && sharedOwner ) {
             das_aligned_free16(shared);
         }
+        // heaps are ref-counted, and can outlive the context
+        if ( allocProfiler ) profileAllocations(0);
     }
 
     struct SimNodeRelocator : SimVisitor {
@@ -1198,10 +1266,8 @@ namespace das
     };
 
     void Context::relocateCode( bool pwh ) {
-        SimNodeRelocator rel;
-        rel.context = this;
-        rel.newCode = make_shared<NodeAllocator>();
-        rel.newCode->customGrow = [&](int ) { return 4000; };   // because SimNode_Aot is 80 bytes
+        auto newCode = make_shared<NodeAllocator>();
+        newCode->customGrow = [&](int ) { return 4000; };   // because SimNode_Aot is 80 bytes
         uint32_t codeSize = uint32_t(code->bytesAllocated());
         if ( code->prefixWithHeader && !pwh ) {
             // printf("[REL] %i adjusting\n", code->totalNodesAllocated);
@@ -1209,8 +1275,15 @@ namespace das
         } else {
             // printf("[REL] %i not adjusting\n", code->totalNodesAllocated);
         }
-        rel.newCode->prefixWithHeader = pwh;
-        rel.newCode->setInitialSize(codeSize);
+        newCode->prefixWithHeader = pwh;
+        newCode->setInitialSize(codeSize);
+        relocateCode(newCode);
+    }
+
+    void Context::relocateCode( const shared_ptr<NodeAllocator> & newCode ) {
+        SimNodeRelocator rel;
+        rel.context = this;
+        rel.newCode = newCode;
         SimFunction * oldFunctions = functions;
         if ( totalFunctions ) {
             SimFunction * newFunctions = (SimFunction *) rel.newCode->allocate(totalFunctions*sizeof(SimFunction));
@@ -1229,6 +1302,13 @@ namespace das
             }
             globalVariables = newVariables;
         }
+        if ( totalInitFunctions ) {
+            SimFunction ** newInitFunctions = (SimFunction **) rel.newCode->allocate(totalInitFunctions*sizeof(SimFunction *));
+            for ( uint32_t i=0; i!=totalInitFunctions; ++i ) {
+                newInitFunctions[i] = functions + (initFunctions[i] - oldFunctions);
+            }
+            initFunctions = newInitFunctions;
+        }
         // relocate mangle-name lookup
         for ( auto & kv : tabMnLookup ) {
             auto fn = kv.second;
@@ -1263,6 +1343,62 @@ namespace das
         code = rel.newCode;
     }
 
+    // code image is a page aligned mapping, which is sealed read-only after the relocation
+    // it is never written to, so processes forked after the simulation keep sharing its pages
+    struct CodeImageAllocator : NodeAllocator {
+        CodeImageAllocator ( uint32_t size ) {
+            auto pageSize = uint32_t(cowImagePageSize());
+            imageSize = (size + pageSize - 1) & ~(pageSize - 1);
+            image = codeImageAllocate(imageSize);
+            if ( image ) {
+                chunk = new HeapChunk(image, imageSize);
+            }
+        }
+        virtual ~CodeImageAllocator() {
+            if ( chunk ) {
+                delete chunk;
+                chunk = nullptr;
+            }
+            if ( image ) {
+                codeImageFree(image, imageSize);
+            }
+        }
+        char *      image = nullptr;
+        uint32_t    imageSize = 0;
+    };
+
+    bool Context::makeCodeImage() {
+        if ( codeImage || !code ) return false;
+        if ( !code->prefixWithHeader ) return false;    // nodes can only be relocated, if they know their size
+        // image is never patched, so all the lazy functions have to be there
+        simulateLazyFunctions();
+        lazySimulation.reset();
+        uint32_t codeSize = uint32_t(code->bytesAllocated()) - code->totalNodesAllocated * uint32_t(sizeof(NodePrefix));
+        codeSize += totalInitFunctions * uint32_t(sizeof(SimFunction *)) + code->alignMask + 1;
+        auto newCode = make_shared<CodeImageAllocator>(codeSize);
+        if ( !newCode->image ) return false;
+        newCode->customGrow = [&](int ) { return 4000; };
+        newCode->prefixWithHeader = false;
+        relocateCode(newCode);
+        // if relocation did not fit, the rest is on the regular heap, and the image is never sealed
+        return newCode->depth()==1;
+    }
+
+    bool Context::sealCodeImage() {
+        if ( codeImage || !code || !code->chunk ) return codeImage;
+        // image is the last chunk. nodes, which are made after the relocation, are on the regular heap
+        // only code image allocator makes external chunks
+        auto chunk = code->chunk;
+        while ( chunk->next ) chunk = chunk->next;
+        if ( !chunk->external ) return false;
+        auto image = static_cast<CodeImageAllocator *>(code.get());
+        codeImage = codeImageSeal(image->image, image->imageSize);
+        if ( codeImage ) {
+            chunk->offset = chunk->size;
+        }
+        return codeImage;
+    }
+
     void Context::announceCreation() {
         for_each_debug_agent([&](const DebugAgentPtr & pAgent){
             pAgent->onCreateContext(this);
@@ -1691,9 +1827,9 @@ namespace das
     }
 
     void Context::triggerHwBreakpoint ( void * addr, int index ) {
-        singleStepMode = true;
         hwBpAddress = addr;
         hwBpIndex = index;
+        setSingleStep(true);
     }
 
     void Context::breakPoint(const LineInfo & at, const char * reason, const char * text) {
@@ -1968,6 +2104,24 @@ namespace das
 #endif
     }
 
+    void Context::profileAllocations ( uint32_t sampleBytes ) {
+        if ( sampleBytes ) {
+            allocProfiler = make_unique<AllocationProfiler>(this, sampleBytes);
+        } else {
+            allocProfiler.reset();
+        }
+        if ( heap ) heap->profiler = allocProfiler.get();
+        if ( stringHeap ) stringHeap->profiler = allocProfiler.get();
+    }
+
+    void Context::reportAllocations ( TextWriter & tout, uint32_t top ) {
+        if ( allocProfiler ) {
+            allocProfiler->report(tout, top);
+        } else {
+            tout << "allocation profiler is off\n";
+        }
+    }
+
     void Context::collectProfileInfo( TextWriter & tout ) {
 #if DAS_ENABLE_PROFILER
         uint64_t totalGoo = 0;
@@ -2075,6 +2229,9 @@ namespace das
     }
 
     void Context::runVisitor ( SimVisitor * vis ) const {
+        // visitor writes sub-nodes back, even if they did not change. pages it touches stop being shared
+        auto image = codeImage ? static_cast<CodeImageAllocator *>(code.get()) : nullptr;
+        if ( image ) codeImageUnseal(image->image, image->imageSize);
         for ( int gvi=0; gvi!=totalVariables; ++gvi ) {
             const auto & gv = globalVariables[gvi];
             if ( gv.init ) gv.init->visit(*vis);
@@ -2083,6 +2240,7 @@ namespace das
             const auto & fn = functions[fni];
             if ( fn.code ) fn.code->visit(*vis);
         }
+        if ( image ) codeImageSeal(image->image, image->imageSize);
     }
 
     const LineInfo * SimFunction::getLineInfo() const { return &code->debugInfo; }
@@ -202,9 +202,13 @@ namespace das {
         das_hash_map<SimNode *,SimNodeInfo> & info;
     };
 
-    void Program::fusion ( Context & context, TextWriter & logs ) {
+    void Program::fusion ( Context & context, TextWriter & logs, const vector<int> * skipFunctions ) {
         // log all functions
         if ( options.getBoolOption("fusion",true) ) {
+            vector<bool> skip(context.totalFunctions, false);   // jit compiles the unfused code
+            if ( skipFunctions ) {
+                for ( auto fni : *skipFunctions ) skip[fni] = true;
+            }
             bool anyFusion = true;
             while ( anyFusion) {
                 anyFusion = false;
@@ -219,6 +223,7 @@ namespace das {
                     }
                 }
                 for ( int i=0; i!=context.totalFunctions; ++i ) {
+                    if ( skip[i] ) continue;
                     SimFunction * fn = context.getFunction(i);
                     SimNodeCollector collector;
                     fn->code->visit(collector);
@@ -230,6 +235,20 @@ namespace das {
         }
     }
 
+    SimNode * Program::fusion ( Context & context, SimNode * node, TextWriter & logs ) {
+        if ( options.getBoolOption("fusion",true) ) {
+            bool anyFusion = true;
+            while ( anyFusion ) {
+                SimNodeCollector collector;
+                node->visit(collector);
+                SimFusion fuse(&context, logs, move(collector.info));
+                node = node->visit(fuse);
+                anyFusion = fuse.fused;
+            }
+        }
+        return node;
+    }
+
     void registerFusion ( const char * OpName, const char * CTypeName, FusionPoint * node ) {
         (*g_fusionEngine)[fuseName(OpName,CTypeName)].emplace_back(node);
     }
@@ -86,6 +86,8 @@ namespace das
                 }
             } else if ( context->constStringHeap->isOwnPtr(pa) ) {
                 if ( show ) tp << "\tCONSTSTRINGHEAP";
+            } else if ( context->stringHeap->isInternedPtr(pa) ) {
+                if ( show ) tp << "\tINTERNEDSTRING";
             } else if  ( context->code->isOwnPtr(pa) ) {
                 if ( show ) tp << "\tCODE";
             } else if ( context->debugInfo->isOwnPtr(pa) ) {
@@ -349,6 +351,7 @@ namespace das
             if ( !reportStringHeap ) return;
             if ( !st ) return;
             if ( context->constStringHeap->isOwnPtr(st) ) return;
+            if ( context->stringHeap->isInternedPtr(st) ) return;
             bool show = !errorsOnly;
             char buf[32];
             uint32_t ulen = uint32_t(strlen(st)) + 1;
@@ -503,6 +506,7 @@ namespace das
             DataWalker::String(st);
             if ( !st ) return;
             if ( context->constStringHeap->isOwnPtr(st) ) return;
+            if ( context->stringHeap->isInternedPtr(st) ) return;
             uint32_t len = uint32_t(strlen(st)) + 1;
             len = (len + 15) & ~15;
             if ( !context->stringHeap->isOwnPtr(st, len) ) return;
@@ -756,6 +760,7 @@ namespace das
             if ( !markStringHeap ) return;
             if ( !st ) return;
             if ( context->constStringHeap->isOwnPtr(st) ) return;
+            if ( context->stringHeap->isInternedPtr(st) ) return;
             uint32_t len = uint32_t(strlen(st)) + 1;
             len = (len + 15) & ~15;
             if ( !context->stringHeap->isOwnPtr(st, len) ) return;
@@ -845,6 +850,10 @@ namespace das
         if ( sheap ) stringHeap->sweep();
         // report errors
         heap->sweep();
+        if ( allocProfiler ) {
+            LOG tout(LogLevel::debug);
+            reportAllocations(tout);
+        }
         if ( !walker.failed.empty() ) {
             reportAnyHeap(at, sheap, true, true, true);
             TextWriter tw;
@@ -33,20 +33,21 @@ namespace das {
                 return expr;
             }
         }
+        void instrumentSlot ( SimNode * & expr ) {
+            if ( expr->rtti_node_isSingleStep() ) {     // single step node stays on the outside, so that it can be unpatched
+                instrumentSlot(((SimNodeDebug_SingleStep *)expr)->subexpr);
+            } else if ( anyLine || isCorrectFileAndLine(expr->debugInfo) ) {
+                expr = isInstrumenting ? instrumentNode(expr) : clearNode(expr);
+            }
+        }
         virtual SimNode * visit ( SimNode * node ) override {
             if ( node->rtti_node_isBlock() ) {
                 SimNode_Block * blk = (SimNode_Block *) node;
                 for ( uint32_t i=0; i!=blk->total; ++i ) {
-                    auto & expr = blk->list[i];
-                    if ( anyLine || isCorrectFileAndLine(expr->debugInfo) ) {
-                        expr = isInstrumenting ? instrumentNode(expr) : clearNode(expr);
-                    }
+                    instrumentSlot(blk->list[i]);
                 }
                 for ( uint32_t i=0; i!=blk->totalFinal; ++i ) {
-                    auto & expr = blk->finalList[i];
-                    if ( anyLine || isCorrectFileAndLine(expr->debugInfo) ) {
-                        expr = isInstrumenting ? instrumentNode(expr) : clearNode(expr);
-                    }
+                    instrumentSlot(blk->finalList[i]);
                 }
             }
             return node;
@@ -60,6 +61,7 @@ namespace das {
     };
 
     void Context::instrumentContextNode ( const Block & blk, bool isInstrumenting, Context * context, LineInfo * line ) {
+        if ( codeImage ) return;
         SimInstVisitor instrument;
         instrument.context = this;
         instrument.cmpBlk = &blk;
@@ -69,6 +71,77 @@ namespace das {
         runVisitor(&instrument);
     }
 
+    struct SingleStepNodes {
+        void patch () {
+            for ( size_t i=0, is=slots.size(); i!=is; ++i ) {
+                if ( *slots[i]!=nodes[i] ) {
+                    nodes[i]->subexpr = *slots[i];
+                    *slots[i] = nodes[i];
+                }
+            }
+        }
+        void unpatch () {
+            for ( size_t i=0, is=slots.size(); i!=is; ++i ) {
+                if ( *slots[i]==nodes[i] ) {
+                    *slots[i] = nodes[i]->subexpr;
+                }
+            }
+        }
+        vector<SimNode **>                  slots;
+        vector<SimNodeDebug_SingleStep *>   nodes;
+        mutex                               lock;
+        int32_t                             stepping = 0;   // number of contexts in single step mode
+    };
+
+    struct SimSingleStepVisitor : SimVisitor {
+        virtual SimNode * visit ( SimNode * node ) override {
+            if ( node->rtti_node_isBlock() ) {
+                SimNode_Block * blk = (SimNode_Block *) node;
+                for ( uint32_t i=0; i!=blk->total; ++i ) {
+                    addSlot(blk->list + i);
+                }
+                for ( uint32_t i=0; i!=blk->totalFinal; ++i ) {
+                    addSlot(blk->finalList + i);
+                }
+            }
+            return node;
+        }
+        void addSlot ( SimNode ** slot ) {
+            steps->slots.push_back(slot);
+            steps->nodes.push_back(context->code->makeNode<SimNodeDebug_SingleStep>((*slot)->debugInfo, *slot));
+        }
+        Context * context = nullptr;
+        SingleStepNodes * steps = nullptr;
+    };
+
+    // single step nodes are allocated once, after the code is final. stepping only swaps pointers,
+    // which is safe to do while other contexts run the same code
+    void Context::makeSingleStepNodes() {
+        if ( codeImage ) return;
+        auto steps = make_shared<SingleStepNodes>();
+        SimSingleStepVisitor collect;
+        collect.context = this;
+        collect.steps = steps.get();
+        runVisitor(&collect);
+        singleStepNodes = steps;
+    }
+
+    void Context::setSingleStep ( bool step ) {
+        if ( !singleStepNodes ) {
+            singleStepMode = step;
+            return;
+        }
+        lock_guard<mutex> guard(singleStepNodes->lock);
+        if ( singleStepMode!=step ) {
+            if ( step ) {
+                if ( singleStepNodes->stepping++==0 ) singleStepNodes->patch();
+            } else {
+                if ( --singleStepNodes->stepping==0 ) singleStepNodes->unpatch();
+            }
+            singleStepMode = step;
+        }
+    }
+
     void Context::clearInstruments() {
         SimInstVisitor instrument;
         instrument.context = this;
@@ -79,6 +152,7 @@ namespace das {
     }
 
     void Context::instrumentFunction ( SimFunction * FNPTR, bool isInstrumenting, uint64_t userData ) {
+        if ( codeImage ) return;
         auto instFn = [&](SimFunction * fun, uint64_t fnMnh) {
             if ( !fun->code ) return;
             if ( isInstrumenting ) {
@@ -101,6 +175,8 @@ namespace das {
         }
     }
 #else
+    void Context::makeSingleStepNodes() {}
+    void Context::setSingleStep ( bool step ) { singleStepMode = step; }
     void Context::instrumentFunction ( SimFunction *, bool, uint64_t ) {}
     void Context::instrumentContextNode ( const Block &, bool, Context *, LineInfo * ) {}
     void Context::clearInstruments() {}
@@ -0,0 +1,1226 @@
+#include "daScript/misc/platform.h"
+
+#include "daScript/ast/ast.h"
+#include "daScript/simulate/simulate_nodes.h"
+#include "daScript/misc/sysos.h"
+
+// baseline jit. simulated function body is translated node by node into x86-64 code
+// control flow, scalar arithmetic, comparisons, locals, arguments and globals are native
+// everything else is a call into the interpreter for that sub-tree (fallback)
+
+#if (defined(__x86_64__) || defined(_M_X64)) && defined(__linux__) && !DAS_ENABLE_EXCEPTIONS
+#define DAS_JIT_X64 1
+#else
+#define DAS_JIT_X64 0
+#endif
+
+namespace das {
+
+#if DAS_JIT_X64
+
+    // interpreter entry points for the fallback nodes
+    static vec4f    jit_eval ( SimNode * node, Context * context )          { return node->eval(*context); }
+    static int32_t  jit_evalInt ( SimNode * node, Context * context )       { return node->evalInt(*context); }
+    static uint32_t jit_evalUInt ( SimNode * node, Context * context )      { return node->evalUInt(*context); }
+    static int64_t  jit_evalInt64 ( SimNode * node, Context * context )     { return node->evalInt64(*context); }
+    static uint64_t jit_evalUInt64 ( SimNode * node, Context * context )    { return node->evalUInt64(*context); }
+    static float    jit_evalFloat ( SimNode * node, Context * context )     { return node->evalFloat(*context); }
+    static double   jit_evalDouble ( SimNode * node, Context * context )    { return node->evalDouble(*context); }
+    static bool     jit_evalBool ( SimNode * node, Context * context )      { return node->evalBool(*context); }
+    static char *   jit_evalPtr ( SimNode * node, Context * context )       { return node->evalPtr(*context); }
+
+    static void jit_throw ( Context * context, LineInfo * at, const char * message ) {
+        context->throw_error_at(*at, "%s", message);
+    }
+
+    // records how node describes itself to the visitor, without visiting the children
+    struct JitNodeShape : SimVisitor {
+        JitNodeShape ( SimNode * node ) { node->visit(*this); }
+        virtual void op ( const char * name, uint32_t, const string & TT ) override {
+            if ( opName.empty() ) {
+                opName = name;
+                typeName = TT;
+            }
+        }
+        virtual void sp ( uint32_t v, const char * ) override { stackTop = v; }
+        virtual void arg ( int32_t, const char * ) override { totalArgs ++; }
+        virtual void arg ( uint32_t, const char * ) override { totalArgs ++; }
+        virtual void arg ( const char *, const char * ) override { totalArgs ++; }
+        virtual void arg ( vec4f, const char * ) override { totalArgs ++; }
+        virtual void arg ( int64_t, const char * ) override { totalArgs ++; }
+        virtual void arg ( uint64_t, const char * ) override { totalArgs ++; }
+        virtual void arg ( float, const char * ) override { totalArgs ++; }
+        virtual void arg ( double, const char * ) override { totalArgs ++; }
+        virtual void arg ( bool, const char * ) override { totalArgs ++; }
+        virtual void arg ( Func, const char *, const char * ) override { totalArgs ++; }
+        virtual void arg ( Func, uint32_t, const char * ) override { totalArgs ++; }
+        virtual void sub ( SimNode ** nodes, uint32_t count, const char * name ) override {
+            lists.push_back({name, nodes, count});
+        }
+        virtual SimNode * sub ( SimNode * node, const char * name ) override {
+            subs.push_back({name, node});
+            return node;
+        }
+        bool is ( const char * name ) const { return opName==name; }
+        SimNode * child ( const char * name ) const {
+            for ( auto & s : subs ) if ( strcmp(s.name,name)==0 ) return s.node;
+            return nullptr;
+        }
+        bool list ( const char * name, SimNode ** & nodes, uint32_t & count ) const {
+            for ( auto & l : lists ) {
+                if ( strcmp(l.name,name)==0 ) {
+                    nodes = l.nodes;
+                    count = l.count;
+                    return true;
+                }
+            }
+            nodes = nullptr;
+            count = 0;
+            return false;
+        }
+        uint32_t listSize ( const char * name ) const {
+            SimNode ** nodes; uint32_t count;
+            list(name, nodes, count);
+            return count;
+        }
+        struct Sub { const char * name; SimNode * node; };
+        struct List { const char * name; SimNode ** nodes; uint32_t count; };
+        string          opName;
+        string          typeName;
+        uint32_t        stackTop = 0;
+        int             totalArgs = 0;
+        vector<Sub>     subs;
+        vector<List>    lists;
+    };
+
+    enum JitReg : uint8_t {
+        RAX = 0, RCX, RDX, RBX, RSP, RBP, RSI, RDI,
+        R8, R9, R10, R11, R12, R13, R14, R15
+    };
+
+    enum JitCC : uint8_t {
+        CC_B = 0x2, CC_AE = 0x3, CC_E = 0x4, CC_NE = 0x5, CC_BE = 0x6, CC_A = 0x7,
+        CC_P = 0xa, CC_NP = 0xb, CC_L = 0xc, CC_GE = 0xd, CC_LE = 0xe, CC_G = 0xf
+    };
+
+    struct JitMem {
+        uint8_t base;
+        int32_t disp;
+    };
+
+    // minimal x86-64 encoder. labels are resolved with rel32 fixups, so the code is position independent
+    struct JitAsm {
+        vector<uint8_t> code;
+        vector<int32_t> labels;
+        vector<pair<uint32_t,int>> fixups;
+        void byte ( uint8_t b ) { code.push_back(b); }
+        void dword ( uint32_t d ) { for ( int i=0; i!=4; ++i ) byte(uint8_t(d >> (i*8))); }
+        void qword ( uint64_t q ) { for ( int i=0; i!=8; ++i ) byte(uint8_t(q >> (i*8))); }
+        int label() { labels.push_back(-1); return int(labels.size()) - 1; }
+        void bind ( int l ) { labels[l] = int32_t(code.size()); }
+        void rel32 ( int l ) { fixups.emplace_back(uint32_t(code.size()), l); dword(0); }
+        bool link() {
+            for ( auto & fx : fixups ) {
+                if ( labels[fx.second]<0 ) return false;
+                int32_t rel = labels[fx.second] - int32_t(fx.first + 4);
+                memcpy(code.data() + fx.first, &rel, 4);
+            }
+            return true;
+        }
+        void rex ( bool w, uint8_t reg, uint8_t base ) {
+            uint8_t r = 0x40 | (w ? 8 : 0) | ((reg & 8) ? 4 : 0) | ((base & 8) ? 1 : 0);
+            if ( r!=0x40 ) byte(r);
+        }
+        void ops ( uint8_t prefix, bool w, uint8_t reg, uint8_t base, std::initializer_list<uint8_t> op ) {
+            if ( prefix ) byte(prefix);
+            rex(w, reg, base);
+            for ( auto o : op ) byte(o);
+        }
+        // op reg, [base+disp]
+        void m ( uint8_t prefix, bool w, std::initializer_list<uint8_t> op, uint8_t reg, JitMem mem ) {
+            ops(prefix, w, reg, mem.base, op);
+            uint8_t b = mem.base & 7;
+            uint8_t mod = (mem.disp==0 && b!=5) ? 0 : ((mem.disp>=-128 && mem.disp<=127) ? 1 : 2);
+            byte(uint8_t((mod << 6) | ((reg & 7) << 3) | b));
+            if ( b==4 ) byte(0x24);                 // rsp and r12 need sib
+            if ( mod==1 ) byte(uint8_t(int8_t(mem.disp)));
+            else if ( mod==2 ) dword(uint32_t(mem.disp));
+        }
+        // op reg, rm
+        void r ( uint8_t prefix, bool w, std::initializer_list<uint8_t> op, uint8_t reg, uint8_t rm ) {
+            ops(prefix, w, reg, rm, op);
+            byte(uint8_t(0xc0 | ((reg & 7) << 3) | (rm & 7)));
+        }
+        // general purpose
+        void mov ( bool w, uint8_t dst, uint8_t src ) { r(0, w, {0x8b}, dst, src); }
+        void load ( bool w, uint8_t dst, JitMem mem ) { m(0, w, {0x8b}, dst, mem); }
+        void store ( bool w, JitMem mem, uint8_t src ) { m(0, w, {0x89}, src, mem); }
+        void load8 ( uint8_t dst, JitMem mem ) { m(0, false, {0x0f,0xb6}, dst, mem); }
+        void store8 ( JitMem mem, uint8_t src ) { m(0, false, {0x88}, src, mem); }
+        void zx8 ( uint8_t dst, uint8_t src ) { r(0, false, {0x0f,0xb6}, dst, src); }
+        void lea ( uint8_t dst, JitMem mem ) { m(0, true, {0x8d}, dst, mem); }
+        void imm64 ( uint8_t dst, uint64_t v ) { rex(true, 0, dst); byte(uint8_t(0xb8 + (dst & 7))); qword(v); }
+        void imm32 ( uint8_t dst, uint32_t v ) { rex(false, 0, dst); byte(uint8_t(0xb8 + (dst & 7))); dword(v); }
+        void alu ( uint8_t op, bool w, uint8_t dst, uint8_t src ) { r(0, w, {op}, src, dst); }
+        void alu ( uint8_t op, bool w, JitMem mem, uint8_t src ) { m(0, w, {op}, src, mem); }
+        void alu8 ( uint8_t op, uint8_t dst, uint8_t src ) { r(0, false, {op}, src, dst); }
+        void imul ( bool w, uint8_t dst, uint8_t src ) { r(0, w, {0x0f,0xaf}, dst, src); }
+        void grp3 ( uint8_t ext, bool w, uint8_t rm ) { r(0, w, {0xf7}, ext, rm); }
+        void shift ( uint8_t ext, bool w, uint8_t rm ) { r(0, w, {0xd3}, ext, rm); }
+        void shift ( uint8_t ext, bool w, JitMem mem ) { m(0, w, {0xd3}, ext, mem); }
+        void aluImm ( uint8_t ext, bool w, uint8_t rm, int32_t v ) { r(0, w, {0x81}, ext, rm); dword(uint32_t(v)); }
+        void aluImm ( uint8_t ext, JitMem mem, int32_t v ) { m(0, false, {0x81}, ext, mem); dword(uint32_t(v)); }
+        void testImm ( JitMem mem, uint32_t v ) { m(0, false, {0xf7}, 0, mem); dword(v); }
+        void cmpZero ( JitMem mem ) { m(0, false, {0x83}, 7, mem); byte(0); }
+        void cmp ( uint8_t reg, JitMem mem ) { m(0, false, {0x3b}, reg, mem); }
+        void signExtend ( bool w ) { if ( w ) byte(0x48); byte(0x99); }
+        void setcc ( uint8_t cc, uint8_t dst ) { r(0, false, {0x0f, uint8_t(0x90 | cc)}, 0, dst); }
+        void jcc ( uint8_t cc, int l ) { byte(0x0f); byte(uint8_t(0x80 | cc)); rel32(l); }
+        void jmp ( int l ) { byte(0xe9); rel32(l); }
+        void call ( const void * fn ) { imm64(RAX, uint64_t(intptr_t(fn))); r(0, false, {0xff}, 2, RAX); }
+        uint32_t callRel32() { byte(0xe8); dword(0); return uint32_t(code.size()) - 4; }
+        void push ( uint8_t reg ) { rex(false, 0, reg); byte(uint8_t(0x50 + (reg & 7))); }
+        void pop ( uint8_t reg ) { rex(false, 0, reg); byte(uint8_t(0x58 + (reg & 7))); }
+        void ret() { byte(0xc3); }
+        // sse
+        void sse ( uint8_t prefix, uint8_t op, uint8_t dst, uint8_t src ) { r(prefix, false, {0x0f,op}, dst, src); }
+        void sse ( uint8_t prefix, uint8_t op, uint8_t reg, JitMem mem ) { m(prefix, false, {0x0f,op}, reg, mem); }
+        void movdToX ( bool w, uint8_t x, uint8_t gpr ) { r(0x66, w, {0x0f,0x6e}, x, gpr); }
+        void movdFromX ( bool w, uint8_t gpr, uint8_t x ) { r(0x66, w, {0x0f,0x7e}, x, gpr); }
+    };
+
+    enum class JitKind { none, vec, i32, u32, i64, u64, f32, f64, b, ptr };
+
+    static JitKind jitKindOf ( const string & TT ) {
+        if ( TT=="int" ) return JitKind::i32;
+        if ( TT=="uint" ) return JitKind::u32;
+        if ( TT=="int64" ) return JitKind::i64;
+        if ( TT=="uint64" ) return JitKind::u64;
+        if ( TT=="float" ) return JitKind::f32;
+        if ( TT=="double" ) return JitKind::f64;
+        if ( TT=="bool" ) return JitKind::b;
+        if ( TT=="string" || TT=="pointer" ) return JitKind::ptr;
+        return JitKind::none;
+    }
+
+    static bool jitIsFloat ( JitKind k ) { return k==JitKind::f32 || k==JitKind::f64; }
+    static bool jitIsInt ( JitKind k ) { return k==JitKind::i32 || k==JitKind::u32 || k==JitKind::i64 || k==JitKind::u64; }
+    static bool jitIsSigned ( JitKind k ) { return k==JitKind::i32 || k==JitKind::i64; }
+    static bool jitIs64 ( JitKind k ) { return k==JitKind::i64 || k==JitKind::u64 || k==JitKind::ptr; }
+    static bool jitIsXmm ( JitKind k ) { return jitIsFloat(k) || k==JitKind::vec; }
+
+    struct JitLoop {
+        int     breakLabel;
+        int     continueLabel;
+        int     flagsLabel;
+        bool    flagsUsed;
+    };
+
+    struct JitThrow {
+        int         label;
+        LineInfo *  at;
+        const char * message;
+    };
+
+    struct JitCompiler {
+        JitCompiler ( Program * prog, Context * ctx, TextWriter & wr ) : program(prog), context(ctx), logs(wr) {
+            auto base = (char *) context;
+            offStopFlags = int32_t((char *)&context->stopFlags - base);
+            offResult = int32_t((char *)&context->result - base);
+            offGlobals = int32_t((char *)&context->globals - base);
+            offShared = int32_t((char *)&context->shared - base);
+            offEvalTop = int32_t((char *)&context->stack.evalTop - base);
+            offStackTop = int32_t((char *)&context->stack.stackTop - base);
+            offStackBottom = int32_t((char *)&context->stack.stack - base);
+            offAbiArg = int32_t((char *)&context->abiArg - base);
+            offAbiCMRES = int32_t((char *)&context->abiCMRES - base);
+        }
+        // registers: rbx context, r12 arguments, r13 cmres, r14 stack frame, r15 loop variables
+        JitMem flags() const { return JitMem{RBX, offStopFlags}; }
+        JitMem result() const { return JitMem{RBX, offResult}; }
+        JitMem rangeSlot ( int depth ) const { return JitMem{R15, -16 * (depth + 1)}; }
+        // values
+        uint8_t primary ( JitKind k ) const { return jitIsXmm(k) ? 0 : RAX; }
+        uint8_t secondary ( JitKind k ) const { return jitIsXmm(k) ? 1 : RCX; }
+        void load ( JitKind k, uint8_t reg, JitMem mem ) {
+            switch ( k ) {
+                case JitKind::i32:
+                case JitKind::u32:  as.load(false, reg, mem); break;
+                case JitKind::b:    as.load8(reg, mem); break;
+                case JitKind::i64:
+                case JitKind::u64:
+                case JitKind::ptr:  as.load(true, reg, mem); break;
+                case JitKind::f32:  as.sse(0xf3, 0x10, reg, mem); break;
+                case JitKind::f64:  as.sse(0xf2, 0x10, reg, mem); break;
+                case JitKind::vec:  as.sse(0, 0x10, reg, mem); break;
+                default:            break;
+            }
+        }
+        void store ( JitKind k, JitMem mem, uint8_t reg ) {
+            switch ( k ) {
+                case JitKind::i32:
+                case JitKind::u32:  as.store(false, mem, reg); break;
+                case JitKind::b:    as.store8(mem, reg); break;
+                case JitKind::i64:
+                case JitKind::u64:
+                case JitKind::ptr:  as.store(true, mem, reg); break;
+                case JitKind::f32:  as.sse(0xf3, 0x11, reg, mem); break;
+                case JitKind::f64:  as.sse(0xf2, 0x11, reg, mem); break;
+                case JitKind::vec:  as.sse(0, 0x11, reg, mem); break;
+                default:            break;
+            }
+        }
+        void spill ( JitKind k ) {
+            as.aluImm(5, true, RSP, 16);
+            store(k, JitMem{RSP,0}, primary(k));
+            spillDepth ++;
+        }
+        void unspill ( JitKind k, uint8_t reg ) {
+            load(k, reg, JitMem{RSP,0});
+            as.aluImm(0, true, RSP, 16);
+            spillDepth --;
+        }
+        void toSecondary ( JitKind k ) {
+            if ( jitIsXmm(k) ) as.sse(0, 0x28, 1, 0);
+            else as.mov(true, RCX, RAX);
+        }
+        void toVec ( JitKind k ) {
+            switch ( k ) {
+                case JitKind::i32:
+                case JitKind::u32:
+                case JitKind::b:    as.movdToX(false, 0, RAX); break;
+                case JitKind::i64:
+                case JitKind::u64:
+                case JitKind::ptr:  as.movdToX(true, 0, RAX); break;
+                case JitKind::f32:  as.movdFromX(false, RAX, 0); as.movdToX(false, 0, RAX); break;
+                case JitKind::f64:  as.movdFromX(true, RAX, 0); as.movdToX(true, 0, RAX); break;
+                default:            break;
+            }
+        }
+        bool accept ( JitKind natural, JitKind want ) const {
+            return want==natural || want==JitKind::none || (want==JitKind::vec && natural!=JitKind::none);
+        }
+        void finish ( JitKind natural, JitKind want ) {
+            if ( want==JitKind::vec && natural!=JitKind::vec ) toVec(natural);
+        }
+        void fromVec ( JitKind want ) {
+            switch ( want ) {
+                case JitKind::i32:
+                case JitKind::u32:  as.movdFromX(false, RAX, 0); break;
+                case JitKind::b:    as.movdFromX(false, RAX, 0); as.alu(0x85, false, RAX, RAX); as.setcc(CC_NE, RAX); as.zx8(RAX, RAX); break;
+                case JitKind::i64:
+                case JitKind::u64:
+                case JitKind::ptr:  as.movdFromX(true, RAX, 0); break;
+                default:            break;
+            }
+        }
+        // interpreter
+        void fallback ( SimNode * node, JitKind want ) {
+            as.imm64(RDI, uint64_t(intptr_t(node)));     // fused once the final code is picked
+            fallbacks.emplace_back(uint32_t(as.code.size()) - 8, node);
+            as.mov(true, RSI, RBX);
+            switch ( want ) {
+                case JitKind::i32:  as.call((void *)&jit_evalInt); break;
+                case JitKind::u32:  as.call((void *)&jit_evalUInt); break;
+                case JitKind::i64:  as.call((void *)&jit_evalInt64); break;
+                case JitKind::u64:  as.call((void *)&jit_evalUInt64); break;
+                case JitKind::f32:  as.call((void *)&jit_evalFloat); break;
+                case JitKind::f64:  as.call((void *)&jit_evalDouble); break;
+                case JitKind::b:    as.call((void *)&jit_evalBool); as.zx8(RAX, RAX); break;
+                case JitKind::ptr:  as.call((void *)&jit_evalPtr); break;
+                default:            as.call((void *)&jit_eval); break;
+            }
+            totalFallbacks ++;
+        }
+        int throwLabel ( SimNode * node, const char * message ) {
+            JitThrow th;
+            th.label = as.label();
+            th.at = &node->debugInfo;
+            th.message = message;
+            throws.push_back(th);
+            return th.label;
+        }
+        // sources
+        bool isValueSource ( const JitNodeShape & sh ) const {
+            return sh.is("GetArgument") || sh.is("GetArgumentRef") || sh.is("GetLocalR2V") || sh.is("GetLocalRefOffR2V")
+                || sh.is("GetArgumentR2V") || sh.is("GetArgumentRefOffR2V") || sh.is("GetGlobalR2V")
+                || sh.is("GetSharedR2V") || sh.is("GetCMResOfsR2V");
+        }
+        // GetArgumentRef is both, its pointer is the address of the argument
+        bool isAddressSource ( const JitNodeShape & sh ) const {
+            return sh.is("GetLocal") || sh.is("GetArgumentRef") || sh.is("GetLocalRefOff") || sh.is("GetArgumentRefOff")
+                || sh.is("GetGlobal") || sh.is("GetShared") || sh.is("GetCMResOfs");
+        }
+        // memory operand of the source, only 'tmp' is modified
+        void sourceMem ( SimNode * node, const JitNodeShape & sh, uint8_t tmp, JitMem & mem ) {
+            auto & src = static_cast<SimNode_SourceBase *>(node)->subexpr;
+            const string & op = sh.opName;
+            if ( op=="GetLocal" || op=="GetLocalR2V" ) {
+                mem = JitMem{R14, int32_t(src.stackTop)};
+            } else if ( op=="GetLocalRefOff" || op=="GetLocalRefOffR2V" ) {
+                as.load(true, tmp, JitMem{R14, int32_t(src.stackTop)});
+                mem = JitMem{tmp, int32_t(src.offset)};
+            } else if ( op=="GetArgument" || op=="GetArgumentRef" ) {
+                mem = JitMem{R12, src.index * 16};
+            } else if ( op=="GetArgumentR2V" ) {
+                as.load(true, tmp, JitMem{R12, src.index * 16});
+                mem = JitMem{tmp, 0};
+            } else if ( op=="GetArgumentRefOff" || op=="GetArgumentRefOffR2V" ) {
+                as.load(true, tmp, JitMem{R12, src.index * 16});
+                mem = JitMem{tmp, int32_t(src.offset)};
+            } else if ( op=="GetGlobal" || op=="GetGlobalR2V" ) {
+                as.load(true, tmp, JitMem{RBX, offGlobals});
+                mem = JitMem{tmp, int32_t(src.offset)};
+            } else if ( op=="GetShared" || op=="GetSharedR2V" ) {
+                as.load(true, tmp, JitMem{RBX, offShared});
+                mem = JitMem{tmp, int32_t(src.offset)};
+            } else {    // GetCMResOfs
+                mem = JitMem{R13, int32_t(src.offset)};
+            }
+        }
+        bool isSource ( SimNode * node, const JitNodeShape & sh ) const {
+            return (isValueSource(sh) || isAddressSource(sh)) && node->rtti_node_isSourceBase();
+        }
+        // value of the leaf node can be loaded into any register, without calls
+        bool isLeaf ( SimNode * node, const JitNodeShape & sh, JitKind k ) const {
+            if ( sh.is("ConstValue") && node->rtti_node_isSourceBase() ) return true;
+            if ( !isSource(node, sh) || !isValueSource(sh) ) return false;
+            if ( k==JitKind::ptr && isAddressSource(sh) ) return false;
+            return sh.typeName.empty() || jitKindOf(sh.typeName)==k;
+        }
+        void loadLeaf ( SimNode * node, const JitNodeShape & sh, JitKind k, uint8_t reg, uint8_t tmp ) {
+            if ( sh.is("ConstValue") ) {
+                auto & src = static_cast<SimNode_SourceBase *>(node)->subexpr;
+                switch ( k ) {
+                    case JitKind::i32:
+                    case JitKind::u32:  as.imm32(reg, src.valueU); break;
+                    case JitKind::b:    as.imm32(reg, src.valueB ? 1 : 0); break;
+                    case JitKind::i64:
+                    case JitKind::u64:
+                    case JitKind::ptr:  as.imm64(reg, src.valueU64); break;
+                    case JitKind::f32:  as.imm32(tmp, src.valueU); as.movdToX(false, reg, tmp); break;
+                    case JitKind::f64:  as.imm64(tmp, src.valueU64); as.movdToX(true, reg, tmp); break;
+                    case JitKind::vec:  as.imm64(tmp, uint64_t(intptr_t(&src.value))); load(k, reg, JitMem{tmp,0}); break;
+                    default:            break;
+                }
+            } else {
+                JitMem mem;
+                sourceMem(node, sh, tmp, mem);
+                load(k, reg, mem);
+            }
+        }
+        // address of the assignment target goes to r8
+        void genTarget ( SimNode * node ) {
+            JitNodeShape sh(node);
+            if ( isSource(node, sh) && isAddressSource(sh) ) {
+                JitMem mem;
+                sourceMem(node, sh, R8, mem);
+                as.lea(R8, mem);
+                totalNative ++;
+            } else {
+                genExpr(node, sh, JitKind::ptr);
+                as.mov(true, R8, RAX);
+            }
+        }
+        bool isSimpleTarget ( SimNode * node ) {
+            JitNodeShape sh(node);
+            return isSource(node, sh) && isAddressSource(sh);
+        }
+        // value of 'r' in the primary register, address of 'l' in r8. 'l' is evaluated first
+        void genAssign ( SimNode * l, SimNode * r, JitKind k ) {
+            if ( isSimpleTarget(l) ) {
+                genExpr(r, k);
+                genTarget(l);
+            } else {
+                genTarget(l);
+                as.mov(true, RAX, R8);
+                spill(JitKind::ptr);
+                genExpr(r, k);
+                unspill(JitKind::ptr, R8);
+            }
+        }
+        // left operand in the primary register, right operand in the secondary
+        void genOperands ( SimNode * l, SimNode * r, JitKind k ) {
+            genExpr(l, k);
+            JitNodeShape rs(r);
+            if ( isLeaf(r, rs, k) ) {
+                loadLeaf(r, rs, k, secondary(k), RCX);
+                totalNative ++;
+            } else {
+                spill(k);
+                genExpr(r, rs, k);
+                toSecondary(k);
+                unspill(k, primary(k));
+            }
+        }
+        // calls to other compiled functions skip the interpreter
+        bool isNativeCall ( SimNode * node, const JitNodeShape & sh ) const {
+            if ( !targets || !(sh.is("Call") || sh.is("FastCall")) || !sh.subs.empty() ) return false;
+            auto call = static_cast<SimNode_CallBase *>(node);
+            return call->fnPtr && !call->fnPtr->cmres && targets->find(call->fnPtr)!=targets->end();
+        }
+        // same as Context::call, or SimNode_FastCall for the fastcall. arguments go to the machine stack
+        void genCall ( SimNode_CallBase * call, bool fast, JitKind want ) {
+            SimFunction * fn = call->fnPtr;
+            int32_t argSize = 16 * (call->nArguments ? call->nArguments : 1);
+            int32_t frame = 32 + argSize;       // abiArg, evalTop, stackTop, then arguments
+            as.aluImm(5, true, RSP, frame);
+            spillDepth += frame / 16;
+            for ( int32_t i=0; i!=call->nArguments; ++i ) {
+                genExpr(call->arguments[i], JitKind::vec);
+                store(JitKind::vec, JitMem{RSP, 32 + 16*i}, 0);
+            }
+            if ( !fast ) {
+                as.load(true, RAX, JitMem{RBX, offStackTop});
+                as.aluImm(5, true, RAX, int32_t(fn->stackSize));
+                as.alu(0x3b, true, JitMem{RBX, offStackBottom}, RAX);
+                string message = string("stack overflow while calling ") + fn->mangledName;
+                as.jcc(CC_B, throwLabel(call, context->code->allocateName(message)));
+                as.load(true, RCX, JitMem{RBX, offEvalTop});
+                as.store(true, JitMem{RSP, 8}, RCX);
+                as.load(true, RCX, JitMem{RBX, offStackTop});
+                as.store(true, JitMem{RSP, 16}, RCX);
+                as.store(true, JitMem{RBX, offStackTop}, RAX);
+                as.store(true, JitMem{RBX, offEvalTop}, RAX);
+            }
+            as.load(true, RCX, JitMem{RBX, offAbiArg});
+            as.store(true, JitMem{RSP, 0}, RCX);
+            as.lea(RSI, JitMem{RSP, 32});
+            as.store(true, JitMem{RBX, offAbiArg}, RSI);
+#if DAS_ENABLE_STACK_WALK
+            if ( !fast ) {
+                as.imm64(RCX, uint64_t(intptr_t(fn->debugInfo)));
+                as.store(true, JitMem{RAX, int32_t(offsetof(Prologue, info))}, RCX);
+                as.store(true, JitMem{RAX, int32_t(offsetof(Prologue, arguments))}, RSI);
+                as.imm32(RCX, 0);
+                as.store(true, JitMem{RAX, int32_t(offsetof(Prologue, cmres))}, RCX);
+                as.imm64(RCX, uint64_t(intptr_t(&call->debugInfo)));
+                as.store(true, JitMem{RAX, int32_t(offsetof(Prologue, line))}, RCX);
+            }
+#endif
+            as.mov(true, RDI, RBX);
+            as.load(true, RDX, JitMem{RBX, offAbiCMRES});
+            calls.emplace_back(as.callRel32(), targets->find(fn)->second);
+            if ( fast ) {
+                as.aluImm(4, flags(), int32_t(~uint32_t(EvalFlags::stopForReturn | EvalFlags::stopForBreak | EvalFlags::stopForContinue)));
+            } else {
+                as.aluImm(4, flags(), 0);
+                as.load(true, RCX, JitMem{RSP, 8});
+                as.store(true, JitMem{RBX, offEvalTop}, RCX);
+                as.load(true, RCX, JitMem{RSP, 16});
+                as.store(true, JitMem{RBX, offStackTop}, RCX);
+            }
+            as.load(true, RCX, JitMem{RSP, 0});
+            as.store(true, JitMem{RBX, offAbiArg}, RCX);
+            as.aluImm(0, true, RSP, frame);
+            spillDepth -= frame / 16;
+            fromVec(want);
+        }
+        // comparisons
+        bool isCompare ( const JitNodeShape & sh, JitKind & k ) const {
+            if ( !(sh.is("Equ") || sh.is("NotEqu") || sh.is("Less") || sh.is("LessEqu") || sh.is("Gt") || sh.is("GtEqu")) ) return false;
+            if ( sh.lists.size() || !sh.child("l") || !sh.child("r") ) return false;
+            k = jitKindOf(sh.typeName);
+            if ( k==JitKind::none || sh.typeName=="string" ) return false;     // strings compare text
+            if ( k==JitKind::b ) return sh.is("Equ") || sh.is("NotEqu");
+            return true;
+        }
+        // compares operands, returns condition code which is true when the comparison is true
+        uint8_t genCompare ( const JitNodeShape & sh, JitKind k ) {
+            genOperands(sh.child("l"), sh.child("r"), k);
+            const string & op = sh.opName;
+            if ( jitIsFloat(k) ) {
+                uint8_t pfx = k==JitKind::f64 ? 0x66 : 0;
+                bool swap = op=="Less" || op=="LessEqu";
+                if ( swap ) as.sse(pfx, 0x2e, 1, 0);
+                else as.sse(pfx, 0x2e, 0, 1);
+                if ( op=="Equ" ) return CC_E;
+                if ( op=="NotEqu" ) return CC_NE;
+                return (op=="Less" || op=="Gt") ? CC_A : CC_AE;
+            } else {
+                as.alu(0x39, jitIs64(k), RAX, RCX);
+                bool sign = jitIsSigned(k);
+                if ( op=="Equ" ) return CC_E;
+                if ( op=="NotEqu" ) return CC_NE;
+                if ( op=="Less" ) return sign ? CC_L : CC_B;
+                if ( op=="LessEqu" ) return sign ? CC_LE : CC_BE;
+                if ( op=="Gt" ) return sign ? CC_G : CC_A;
+                return sign ? CC_GE : CC_AE;
+            }
+        }
+        // jumps to 'label' when condition is equal to 'when'
+        void genCond ( SimNode * node, int label, bool when ) {
+            JitNodeShape sh(node);
+            JitKind k;
+            if ( isCompare(sh,k) ) {
+                uint8_t cc = genCompare(sh, k);
+                totalNative ++;
+                if ( jitIsFloat(k) && (cc==CC_E || cc==CC_NE) ) {
+                    // unordered compares are not equal
+                    if ( (cc==CC_E)==when ) {
+                        int skip = as.label();
+                        as.jcc(CC_P, skip);
+                        as.jcc(CC_E, label);
+                        as.bind(skip);
+                    } else {
+                        as.jcc(CC_P, label);
+                        as.jcc(CC_NE, label);
+                    }
+                } else {
+                    as.jcc(when ? cc : uint8_t(cc ^ 1), label);
+                }
+            } else if ( sh.is("BoolNot") && sh.child("x") && jitKindOf(sh.typeName)==JitKind::b ) {
+                genCond(sh.child("x"), label, !when);
+                totalNative ++;
+            } else if ( (sh.is("BoolAnd") || sh.is("BoolOr")) && sh.child("l") && sh.child("r") ) {
+                // and: jump on false when either is false. or: jump on true when either is true
+                bool shortCircuit = sh.is("BoolAnd") ? !when : when;
+                if ( shortCircuit ) {
+                    genCond(sh.child("l"), label, when);
+                    genCond(sh.child("r"), label, when);
+                } else {
+                    int skip = as.label();
+                    genCond(sh.child("l"), skip, !when);
+                    genCond(sh.child("r"), label, when);
+                    as.bind(skip);
+                }
+                totalNative ++;
+            } else {
+                genExpr(node, sh, JitKind::b);
+                as.alu(0x85, false, RAX, RAX);
+                as.jcc(when ? CC_NE : CC_E, label);
+            }
+        }
+        // expressions
+        void genExpr ( SimNode * node, JitKind want ) {
+            JitNodeShape sh(node);
+            genExpr(node, sh, want);
+        }
+        void genExpr ( SimNode * node, const JitNodeShape & sh, JitKind want ) {
+            if ( genNative(node, sh, want) ) {
+                totalNative ++;
+            } else {
+                fallback(node, want);
+            }
+        }
+        bool genNative ( SimNode * node, const JitNodeShape & sh, JitKind want ) {
+            const string & op = sh.opName;
+            JitKind k = jitKindOf(sh.typeName);
+            SimNode * l = sh.child("l");
+            SimNode * r = sh.child("r");
+            SimNode * x = sh.child("x");
+            bool op2 = l && r && sh.lists.empty();
+            bool op1 = x && sh.lists.empty();
+            // leaves
+            if ( op=="ConstValue" && node->rtti_node_isSourceBase() ) {
+                if ( want!=JitKind::none ) loadLeaf(node, sh, want, primary(want), RAX);
+                return true;
+            }
+            if ( isSource(node, sh) ) {
+                if ( isAddressSource(sh) && (want==JitKind::ptr || !isValueSource(sh)) ) {
+                    if ( !accept(JitKind::ptr, want) ) return false;
+                    JitMem mem;
+                    sourceMem(node, sh, RAX, mem);
+                    as.lea(RAX, mem);
+                    finish(JitKind::ptr, want);
+                } else if ( sh.typeName.empty() ) {      // argument
+                    if ( want!=JitKind::none ) loadLeaf(node, sh, want, primary(want), RAX);
+                } else {
+                    if ( k==JitKind::none || !accept(k, want) ) return false;
+                    loadLeaf(node, sh, k, primary(k), RAX);
+                    finish(k, want);
+                }
+                return true;
+            }
+            if ( op=="NOP" ) {
+                if ( want!=JitKind::none ) return false;
+                return true;
+            }
+            if ( isNativeCall(node, sh) ) {
+                genCall(static_cast<SimNode_CallBase *>(node), sh.is("FastCall"), want);
+                return true;
+            }
+            // ternary
+            if ( op=="IfThenElse" && sh.child("cond") && sh.child("if_true") && sh.child("if_false") && want!=JitKind::none ) {
+                int lfalse = as.label(), lend = as.label();
+                genCond(sh.child("cond"), lfalse, false);
+                genExpr(sh.child("if_true"), want);
+                as.jmp(lend);
+                as.bind(lfalse);
+                genExpr(sh.child("if_false"), want);
+                as.bind(lend);
+                return true;
+            }
+            // arithmetic
+            if ( op2 && (op=="Add" || op=="Sub" || op=="Mul" || op=="Div") && (jitIsInt(k) || jitIsFloat(k)) ) {
+                if ( !accept(k, want) ) return false;
+                genOperands(l, r, k);
+                if ( jitIsFloat(k) ) {
+                    uint8_t pfx = k==JitKind::f32 ? 0xf3 : 0xf2;
+                    uint8_t sop = op=="Add" ? 0x58 : op=="Sub" ? 0x5c : op=="Mul" ? 0x59 : 0x5e;
+                    as.sse(pfx, sop, 0, 1);
+                } else if ( op=="Div" ) {
+                    genDivide(node, k, false);
+                } else if ( op=="Mul" ) {
+                    as.imul(jitIs64(k), RAX, RCX);
+                } else {
+                    as.alu(op=="Add" ? 0x01 : 0x29, jitIs64(k), RAX, RCX);
+                }
+                finish(k, want);
+                return true;
+            }
+            if ( op2 && jitIsInt(k) && (op=="Mod" || op=="BinAnd" || op=="BinOr" || op=="BinXor"
+                    || op=="BinShl" || op=="BinShr" || op=="BinRotl" || op=="BinRotr") ) {
+                if ( !accept(k, want) ) return false;
+                genOperands(l, r, k);
+                bool w = jitIs64(k);
+                if ( op=="Mod" ) genDivide(node, k, true);
+                else if ( op=="BinAnd" ) as.alu(0x21, w, RAX, RCX);
+                else if ( op=="BinOr" ) as.alu(0x09, w, RAX, RCX);
+                else if ( op=="BinXor" ) as.alu(0x31, w, RAX, RCX);
+                else if ( op=="BinShl" ) as.shift(4, w, RAX);
+                else if ( op=="BinShr" ) as.shift(jitIsSigned(k) ? 7 : 5, w, RAX);
+                else if ( op=="BinRotl" ) as.shift(0, w, RAX);
+                else as.shift(1, w, RAX);
+                finish(k, want);
+                return true;
+            }
+            if ( op1 && (op=="Unm" || op=="Unp") && (jitIsInt(k) || jitIsFloat(k)) ) {
+                if ( !accept(k, want) ) return false;
+                genExpr(x, k);
+                if ( op=="Unm" ) {
+                    if ( k==JitKind::f32 ) {
+                        as.imm32(RAX, 0x80000000u);
+                        as.movdToX(false, 1, RAX);
+                        as.sse(0, 0x57, 0, 1);
+                    } else if ( k==JitKind::f64 ) {
+                        as.imm64(RAX, 0x8000000000000000ull);
+                        as.movdToX(true, 1, RAX);
+                        as.sse(0, 0x57, 0, 1);
+                    } else {
+                        as.grp3(3, jitIs64(k), RAX);
+                    }
+                }
+                finish(k, want);
+                return true;
+            }
+            if ( op1 && op=="BinNot" && jitIsInt(k) ) {
+                if ( !accept(k, want) ) return false;
+                genExpr(x, k);
+                as.grp3(2, jitIs64(k), RAX);
+                finish(k, want);
+                return true;
+            }
+            if ( op1 && (op=="Inc" || op=="Dec" || op=="IncPost" || op=="DecPost") && (jitIsInt(k) || jitIsFloat(k)) ) {
+                if ( !accept(k, want) ) return false;
+                genTarget(x);
+                bool post = op=="IncPost" || op=="DecPost";
+                bool inc = op=="Inc" || op=="IncPost";
+                if ( jitIsFloat(k) ) {
+                    bool f = k==JitKind::f32;
+                    load(k, 0, JitMem{R8,0});
+                    if ( post ) as.sse(0, 0x28, 2, 0);
+                    if ( f ) { as.imm32(RAX, 0x3f800000u); as.movdToX(false, 1, RAX); }
+                    else { as.imm64(RAX, 0x3ff0000000000000ull); as.movdToX(true, 1, RAX); }
+                    as.sse(f ? 0xf3 : 0xf2, inc ? 0x58 : 0x5c, 0, 1);
+                    store(k, JitMem{R8,0}, 0);
+                    if ( post ) as.sse(0, 0x28, 0, 2);
+                } else {
+                    bool w = jitIs64(k);
+                    load(k, RAX, JitMem{R8,0});
+                    if ( post ) as.mov(w, RDX, RAX);
+                    as.aluImm(inc ? 0 : 5, w, RAX, 1);
+                    store(k, JitMem{R8,0}, RAX);
+                    if ( post ) as.mov(w, RAX, RDX);
+                }
+                finish(k, want);
+                return true;
+            }
+            // logic
+            JitKind ck;
+            if ( isCompare(sh, ck) ) {
+                if ( !accept(JitKind::b, want) ) return false;
+                uint8_t cc = genCompare(sh, ck);
+                as.setcc(cc, RAX);
+                if ( jitIsFloat(ck) && cc==CC_E ) {
+                    as.setcc(CC_NP, RCX);
+                    as.alu8(0x20, RAX, RCX);
+                } else if ( jitIsFloat(ck) && cc==CC_NE ) {
+                    as.setcc(CC_P, RCX);
+                    as.alu8(0x08, RAX, RCX);
+                }
+                as.zx8(RAX, RAX);
+                finish(JitKind::b, want);
+                return true;
+            }
+            if ( (op=="BoolAnd" || op=="BoolOr") && op2 ) {
+                if ( !accept(JitKind::b, want) ) return false;
+                int lfalse = as.label(), lend = as.label();
+                genCond(node, lfalse, false);
+                as.imm32(RAX, 1);
+                as.jmp(lend);
+                as.bind(lfalse);
+                as.alu(0x31, false, RAX, RAX);
+                as.bind(lend);
+                finish(JitKind::b, want);
+                return true;
+            }
+            if ( op=="BoolNot" && op1 && k==JitKind::b ) {
+                if ( !accept(JitKind::b, want) ) return false;
+                genExpr(x, JitKind::b);
+                as.aluImm(6, false, RAX, 1);
+                finish(JitKind::b, want);
+                return true;
+            }
+            // assignment
+            if ( op=="Set" && op2 && k!=JitKind::none ) {
+                if ( want!=JitKind::none ) return false;
+                genAssign(l, r, k);
+                store(k, JitMem{R8,0}, primary(k));
+                return true;
+            }
+            if ( op2 && want==JitKind::none && (jitIsInt(k) || jitIsFloat(k)) ) {
+                return genSetOp(node, sh, k);
+            }
+            // memory
+            if ( op=="InitLocal" && want==JitKind::none && sh.totalArgs==1 ) {
+                as.lea(RDI, JitMem{R14, int32_t(sh.stackTop)});
+                genFill(static_cast<SimNode_InitLocal *>(node)->size);
+                return true;
+            }
+            if ( op=="CopyRefValue" && want==JitKind::none && l && r && sh.totalArgs==1 ) {
+                genExpr(l, JitKind::ptr);
+                spill(JitKind::ptr);
+                genExpr(r, JitKind::ptr);
+                as.mov(true, RSI, RAX);
+                unspill(JitKind::ptr, RDI);
+                genCopy(static_cast<SimNode_CopyRefValue *>(node)->size);
+                return true;
+            }
+            return false;
+        }
+        // zero 'size' bytes at rdi. small sizes are unrolled
+        void genFill ( uint32_t size ) {
+            if ( size > 128 ) {
+                as.imm32(RSI, 0);
+                as.imm64(RDX, size);
+                as.call((void *)&memset);
+                return;
+            }
+            as.alu(0x31, false, RAX, RAX);
+            uint32_t ofs = 0;
+            for ( ; ofs+8<=size; ofs+=8 ) as.store(true, JitMem{RDI, int32_t(ofs)}, RAX);
+            for ( ; ofs+4<=size; ofs+=4 ) as.store(false, JitMem{RDI, int32_t(ofs)}, RAX);
+            for ( ; ofs<size; ofs++ ) as.store8(JitMem{RDI, int32_t(ofs)}, RAX);
+        }
+        // copy 'size' bytes from rsi to rdi
+        void genCopy ( uint32_t size ) {
+            if ( size > 128 ) {
+                as.imm64(RDX, size);
+                as.call((void *)&memcpy);
+                return;
+            }
+            uint32_t ofs = 0;
+            for ( ; ofs+8<=size; ofs+=8 ) {
+                as.load(true, RAX, JitMem{RSI, int32_t(ofs)});
+                as.store(true, JitMem{RDI, int32_t(ofs)}, RAX);
+            }
+            for ( ; ofs+4<=size; ofs+=4 ) {
+                as.load(false, RAX, JitMem{RSI, int32_t(ofs)});
+                as.store(false, JitMem{RDI, int32_t(ofs)}, RAX);
+            }
+            for ( ; ofs<size; ofs++ ) {
+                as.load8(RAX, JitMem{RSI, int32_t(ofs)});
+                as.store8(JitMem{RDI, int32_t(ofs)}, RAX);
+            }
+        }
+        void genDivide ( SimNode * node, JitKind k, bool mod ) {
+            bool w = jitIs64(k);
+            as.alu(0x85, w, RCX, RCX);
+            as.jcc(CC_E, throwLabel(node, mod ? "division by zero in modulo" : "division by zero"));
+            if ( jitIsSigned(k) ) {
+                as.signExtend(w);
+                as.grp3(7, w, RCX);
+            } else {
+                as.alu(0x31, false, RDX, RDX);
+                as.grp3(6, w, RCX);
+            }
+            if ( mod ) as.mov(w, RAX, RDX);
+        }
+        bool genSetOp ( SimNode * node, const JitNodeShape & sh, JitKind k ) {
+            const string & op = sh.opName;
+            bool fp = jitIsFloat(k);
+            bool w = jitIs64(k);
+            static const char * intOps[] = { "SetAdd", "SetSub", "SetMul", "SetDiv", "SetMod",
+                "SetBinAnd", "SetBinOr", "SetBinXor", "SetBinShl", "SetBinShr", "SetBinRotl", "SetBinRotr" };
+            int which = -1;
+            for ( int i=0; i!=int(sizeof(intOps)/sizeof(intOps[0])); ++i ) {
+                if ( op==intOps[i] ) which = i;
+            }
+            if ( which<0 || (fp && which>3) ) return false;
+            genAssign(sh.child("l"), sh.child("r"), k);
+            JitMem target{R8,0};
+            if ( fp ) {
+                uint8_t pfx = k==JitKind::f32 ? 0xf3 : 0xf2;
+                static const uint8_t sseOps[] = { 0x58, 0x5c, 0x59, 0x5e };
+                load(k, 1, target);
+                as.sse(pfx, sseOps[which], 1, 0);
+                store(k, target, 1);
+                return true;
+            }
+            switch ( which ) {
+                case 0:     as.alu(0x01, w, target, RAX); break;
+                case 1:     as.alu(0x29, w, target, RAX); break;
+                case 2:     load(k, RCX, target); as.imul(w, RCX, RAX); store(k, target, RCX); break;
+                case 3:
+                case 4:     as.mov(w, RCX, RAX); load(k, RAX, target); genDivide(node, k, which==4); store(k, target, RAX); break;
+                case 5:     as.alu(0x21, w, target, RAX); break;
+                case 6:     as.alu(0x09, w, target, RAX); break;
+                case 7:     as.alu(0x31, w, target, RAX); break;
+                default: {
+                    static const uint8_t shiftOps[] = { 4, 0, 0, 1 };   // shl, shr (by sign), rol, ror
+                    uint8_t ext = which==9 ? (jitIsSigned(k) ? 7 : 5) : shiftOps[which - 8];
+                    as.mov(false, RCX, RAX);
+                    as.shift(ext, w, target);
+                    break;
+                }
+            }
+            return true;
+        }
+        // statements
+        void checkFlags() {
+            if ( loops.empty() ) {
+                as.cmpZero(flags());
+                as.jcc(CC_NE, functionFlags);
+            } else {
+                loops.back().flagsUsed = true;
+                as.cmpZero(flags());
+                as.jcc(CC_NE, loops.back().flagsLabel);
+            }
+        }
+        // statement, followed by the check of the flags, which interpreted nodes may have set
+        void genBody ( SimNode * node ) {
+            auto before = totalFallbacks;
+            genStmt(node);
+            if ( spillDepth!=0 ) failed = true;
+            if ( totalFallbacks!=before ) checkFlags();
+        }
+        void genList ( SimNode ** list, uint32_t total ) {
+            for ( uint32_t i=0; i!=total; ++i ) genBody(list[i]);
+        }
+        void beginLoop ( int continueLabel ) {
+            loops.push_back(JitLoop{as.label(), continueLabel, as.label(), false});
+        }
+        void endLoop ( uint32_t clearFlags, uint32_t fallbacksBefore ) {
+            auto loop = loops.back();
+            loops.pop_back();
+            if ( loop.flagsUsed ) {
+                as.jmp(loop.breakLabel);
+                as.bind(loop.flagsLabel);
+                as.testImm(flags(), EvalFlags::stopForContinue);
+                as.jcc(CC_E, loop.breakLabel);
+                as.aluImm(4, flags(), int32_t(~uint32_t(EvalFlags::stopForContinue)));
+                as.jmp(loop.continueLabel);
+            }
+            as.bind(loop.breakLabel);
+            if ( totalFallbacks!=fallbacksBefore ) {
+                as.aluImm(4, flags(), int32_t(~clearFlags));
+            }
+        }
+        void genStmt ( SimNode * node ) {
+            JitNodeShape sh(node);
+            const string & op = sh.opName;
+            SimNode ** list; uint32_t total;
+            if ( ((op=="Block" && sh.totalArgs==0) || op=="Let") && sh.listSize("final")==0 && sh.list("block", list, total) ) {
+                genList(list, total);
+            } else if ( (op=="IfThen" || op=="IfThenElse") && sh.child("cond") && sh.child("if_true") ) {
+                int lfalse = as.label();
+                genCond(sh.child("cond"), lfalse, false);
+                genBody(sh.child("if_true"));
+                if ( op=="IfThenElse" ) {
+                    int lend = as.label();
+                    as.jmp(lend);
+                    as.bind(lfalse);
+                    genBody(sh.child("if_false"));
+                    as.bind(lend);
+                } else {
+                    as.bind(lfalse);
+                }
+            } else if ( op=="While" && sh.child("cond") && sh.listSize("final")==0 && sh.list("list", list, total) ) {
+                auto before = totalFallbacks;
+                int top = as.label();
+                beginLoop(top);
+                as.bind(top);
+                genCond(sh.child("cond"), loops.back().breakLabel, false);
+                genList(list, total);
+                as.jmp(top);
+                endLoop(EvalFlags::stopForBreak, before);
+            } else if ( (op=="ForRange" || op=="ForURange" || op=="ForRangeNF" || op=="ForURangeNF"
+                    || op=="ForRange1" || op=="ForURange1" || op=="ForRangeNF1" || op=="ForURangeNF1")
+                    && sh.child("sources[0]") && sh.listSize("final")==0 ) {
+                genRange(sh);
+            } else if ( op=="Return" && sh.totalArgs==0 ) {
+                if ( auto sub = sh.child("subexpr") ) {
+                    genExpr(sub, JitKind::vec);
+                } else {
+                    load(JitKind::vec, 0, result());
+                }
+                as.jmp(functionExit);
+            } else if ( op=="ReturnNothing" ) {
+                load(JitKind::vec, 0, result());
+                as.jmp(functionExit);
+            } else if ( op=="ReturnConst" ) {
+                as.imm64(RAX, uint64_t(intptr_t(&static_cast<SimNode_ReturnConst *>(node)->value)));
+                load(JitKind::vec, 0, JitMem{RAX,0});
+                as.jmp(functionExit);
+            } else if ( op=="Break" && !loops.empty() ) {
+                as.jmp(loops.back().breakLabel);
+            } else if ( op=="Continue" && !loops.empty() ) {
+                as.jmp(loops.back().continueLabel);
+            } else {
+                genExpr(node, sh, JitKind::none);
+                return;
+            }
+            totalNative ++;
+        }
+        void genRange ( const JitNodeShape & sh ) {
+            const string & op = sh.opName;
+            bool isSigned = op.find("URange")==string::npos;
+            bool one = op.back()=='1';
+            bool nf = op.find("NF")!=string::npos;
+            SimNode ** list; uint32_t total;
+            SimNode * single = nullptr;
+            if ( one ) {
+                single = sh.child("list[0]");
+                list = &single;
+                total = single ? 1 : 0;
+            } else {
+                sh.list("list", list, total);
+            }
+            auto before = totalFallbacks;
+            int depth = rangeDepth ++;
+            maxRangeDepth = max(maxRangeDepth, rangeDepth);
+            JitMem slot = rangeSlot(depth);
+            JitMem slotTo{slot.base, slot.disp + 4};
+            genExpr(sh.child("sources[0]"), JitKind::vec);
+            as.movdFromX(true, RAX, 0);
+            as.store(true, slot, RAX);
+            int top = as.label(), cont = as.label();
+            beginLoop(cont);
+            as.load(false, RAX, slot);
+            as.cmp(RAX, slotTo);
+            as.jcc(isSigned ? CC_GE : CC_AE, loops.back().breakLabel);
+            as.bind(top);
+            as.load(false, RAX, slot);
+            as.store(false, JitMem{R14, int32_t(sh.stackTop)}, RAX);
+            genList(list, total);
+            as.bind(cont);
+            as.load(false, RAX, slot);
+            as.aluImm(0, false, RAX, 1);
+            as.store(false, slot, RAX);
+            as.cmp(RAX, slotTo);
+            as.jcc(CC_NE, top);
+            rangeDepth --;
+            endLoop((nf || one) ? (EvalFlags::stopForBreak | EvalFlags::stopForContinue) : EvalFlags::stopForBreak, before);
+        }
+        // function
+        // fastcall function is a single expression, its value is the result
+        bool compile ( SimNode * body, bool fastcall ) {
+            functionExit = as.label();
+            functionFlags = as.label();
+            // prologue
+            as.push(RBX); as.push(R12); as.push(R13); as.push(R14); as.push(R15);
+            as.mov(true, RBX, RDI);
+            as.mov(true, R12, RSI);
+            as.mov(true, R13, RDX);
+            as.load(true, R14, JitMem{RBX, offEvalTop});
+            as.mov(true, R15, RSP);
+            as.r(0, true, {0x81}, 5, RSP);
+            uint32_t frameAt = uint32_t(as.code.size());
+            as.dword(0);
+            // body
+            if ( fastcall ) {
+                genExpr(body, JitKind::vec);
+            } else {
+                genBody(body);
+                load(JitKind::vec, 0, result());
+            }
+            as.jmp(functionExit);
+            // interpreted code stopped the function
+            as.bind(functionFlags);
+            load(JitKind::vec, 0, result());
+            // epilogue
+            as.bind(functionExit);
+            as.mov(true, RSP, R15);
+            as.pop(R15); as.pop(R14); as.pop(R13); as.pop(R12); as.pop(RBX);
+            as.ret();
+            // cold code
+            for ( auto & th : throws ) {
+                as.bind(th.label);
+                as.mov(true, RDI, RBX);
+                as.imm64(RSI, uint64_t(intptr_t(th.at)));
+                as.imm64(RDX, uint64_t(intptr_t(th.message)));
+                as.call((void *)&jit_throw);
+            }
+            uint32_t frameSize = uint32_t(maxRangeDepth * 16);
+            memcpy(as.code.data() + frameAt, &frameSize, 4);
+            if ( failed || spillDepth!=0 || !as.link() ) return false;
+            return totalNative!=0;
+        }
+        JitAsm          as;
+        Program *       program = nullptr;
+        Context *       context = nullptr;
+        TextWriter &    logs;
+        int32_t         offStopFlags = 0;
+        int32_t         offResult = 0;
+        int32_t         offGlobals = 0;
+        int32_t         offShared = 0;
+        int32_t         offEvalTop = 0;
+        int32_t         offStackTop = 0;
+        int32_t         offStackBottom = 0;
+        int32_t         offAbiArg = 0;
+        int32_t         offAbiCMRES = 0;
+        const das_hash_map<SimFunction *,int> * targets = nullptr;
+        vector<pair<uint32_t,int>> calls;
+        vector<pair<uint32_t,SimNode *>> fallbacks;
+        int             functionExit = -1;
+        int             functionFlags = -1;
+        vector<JitLoop> loops;
+        vector<JitThrow> throws;
+        int             rangeDepth = 0;
+        int             maxRangeDepth = 0;
+        int             spillDepth = 0;
+        uint32_t        totalNative = 0;
+        uint32_t        totalFallbacks = 0;
+        bool            failed = false;
+    };
+
+    struct JitCompiled {
+        SimFunction *               fn = nullptr;
+        bool                        ok = false;
+        vector<uint8_t>             code;
+        vector<pair<uint32_t,int>>  calls;
+        vector<pair<uint32_t,SimNode *>> fallbacks;
+        uint32_t                    totalNative = 0;
+        uint32_t                    totalFallbacks = 0;
+    };
+
+    void Program::jit ( Context & context, const vector<int> & jitFunctions, TextWriter & logs ) {
+        bool logJit = options.getBoolOption("log_jit",false);
+        vector<SimFunction *> candidates;
+        for ( auto fni : jitFunctions ) {
+            SimFunction * fn = context.getFunction(fni);
+            if ( !fn || !fn->code ) continue;
+            if ( fn->aot || fn->code->rtti_node_isJit() ) {     // aot or annotation provided the code
+                fn->code = fusion(context, fn->code, logs);
+                continue;
+            }
+            candidates.push_back(fn);
+        }
+        auto compileAll = [&]( const das_hash_map<SimFunction *,int> * targets ) {
+            vector<JitCompiled> res(candidates.size());
+            for ( size_t i=0; i!=candidates.size(); ++i ) {
+                JitCompiler jc(this, &context, logs);
+                jc.targets = targets;
+                res[i].fn = candidates[i];
+                res[i].ok = jc.compile(candidates[i]->code, candidates[i]->fastcall);
+                res[i].code = move(jc.as.code);
+                res[i].calls = move(jc.calls);
+                res[i].fallbacks = move(jc.fallbacks);
+                res[i].totalNative = jc.totalNative;
+                res[i].totalFallbacks = jc.totalFallbacks;
+            }
+            return res;
+        };
+        // first pass finds out which functions compile, the second one calls them directly
+        auto compiled = compileAll(nullptr);
+        das_hash_map<SimFunction *,int> targets;
+        for ( size_t i=0; i!=compiled.size(); ++i ) {
+            if ( compiled[i].ok ) targets[compiled[i].fn] = int(i);
+        }
+        if ( !targets.empty() ) {
+            auto direct = compileAll(&targets);
+            bool allTargets = true;
+            for ( auto & tf : targets ) allTargets &= direct[tf.second].ok;
+            if ( allTargets ) compiled = move(direct);
+        }
+        for ( auto & cf : compiled ) {
+            if ( logJit ) {
+                if ( cf.ok ) {
+                    logs << "// jit " << cf.fn->mangledName << " " << uint32_t(cf.code.size()) << " bytes, "
+                        << cf.totalNative << " native nodes, " << cf.totalFallbacks << " interpreted, "
+                        << uint32_t(cf.calls.size()) << " direct calls\n";
+                } else {
+                    logs << "// jit " << cf.fn->mangledName << " skipped, nothing to compile\n";
+                }
+            }
+            if ( !cf.ok ) {
+                cf.fn->code = fusion(context, cf.fn->code, logs);
+            } else {
+                for ( auto & fb : cf.fallbacks ) {
+                    auto fused = fusion(context, fb.second, logs);
+                    memcpy(cf.code.data() + fb.first, &fused, sizeof(SimNode *));
+                }
+            }
+        }
+        // all the functions go into one executable mapping, which lives as long as the code
+        size_t codeSize = 0;
+        vector<size_t> offsets(compiled.size(), 0);
+        for ( size_t i=0; i!=compiled.size(); ++i ) {
+            if ( !compiled[i].ok ) continue;
+            codeSize = (codeSize + 15) & ~size_t(15);
+            offsets[i] = codeSize;
+            codeSize += compiled[i].code.size();
+        }
+        if ( !codeSize ) return;
+        size_t imageSize = (codeSize + 4095) & ~size_t(4095);
+        char * image = codeImageAllocate(imageSize);
+        if ( image ) {
+            for ( size_t i=0; i!=compiled.size(); ++i ) {
+                auto & cf = compiled[i];
+                if ( !cf.ok ) continue;
+                memcpy(image + offsets[i], cf.code.data(), cf.code.size());
+                for ( auto & cl : cf.calls ) {
+                    int32_t rel = int32_t(int64_t(offsets[cl.second]) - int64_t(offsets[i] + cl.first + 4));
+                    memcpy(image + offsets[i] + cl.first, &rel, 4);
+                }
+            }
+            if ( !jitCodeSeal(image, imageSize) ) {
+                codeImageFree(image, imageSize);
+                image = nullptr;
+            }
+        }
+        if ( !image ) {
+            for ( auto & cf : compiled ) {
+                if ( cf.ok ) cf.fn->code = fusion(context, cf.fn->code, logs);
+            }
+            return;
+        }
+        context.code->jitCode = shared_ptr<void>(image, [imageSize](void * ptr) { codeImageFree((char *)ptr, imageSize); });
+        for ( size_t i=0; i!=compiled.size(); ++i ) {
+            if ( !compiled[i].ok ) continue;
+            SimFunction * fn = compiled[i].fn;
+            auto node = context.code->makeNode<SimNode_Jit>(LineInfo(), (JitFunction)(image + offsets[i]));
+            node->saved_code = fn->code;
+            node->saved_aot = fn->aot;
+            node->saved_aot_function = fn->aotFunction;
+            fn->code = node;
+            fn->aot = false;
+            fn->aotFunction = nullptr;
+            fn->jit = true;
+        }
+    }
+
+#else
+
+    void Program::jit ( Context & context, const vector<int> & jitFunctions, TextWriter & logs ) {
+        // no native code generator for this platform. functions are interpreted, as usual
+        for ( auto fni : jitFunctions ) {
+            if ( SimFunction * fn = context.getFunction(fni) ) {
+                fn->code = fusion(context, fn->code, logs);
+            }
+        }
+    }
+
+#endif
+}
@@ -857,6 +857,13 @@ namespace das {
         V_END();
     }
 
+    SimNode * SimNodeDebug_SingleStep::visit ( SimVisitor & vis ) {
+        V_BEGIN();
+        V_OP(SingleStep);
+        V_SUB(subexpr);
+        V_END();
+    }
+
     SimNode * SimNodeDebug_InstrumentFunction::visit ( SimVisitor & vis ) {
         V_BEGIN();
         V_OP(Instrument);